@@ -27,6 +27,35 @@ std::ostream& operator<<(std::ostream& o, const iobuf& io) {
              << ", fragments=" << std::distance(io.cbegin(), io.cend()) << "}";
 }
 
+bool iobuf::linearize_if_fragmented(size_t threshold) {
+    bool previous_small = false;
+    bool has_small_run = false;
+    for (const auto& f : _frags) {
+        const bool small = f.size() < threshold;
+        if (small && previous_small) {
+            has_small_run = true;
+            break;
+        }
+        previous_small = small;
+    }
+    if (!has_small_run) {
+        return false;
+    }
+    iobuf out;
+    for (auto& f : _frags) {
+        if (f.size() == 0) {
+            continue;
+        }
+        if (f.size() < threshold) {
+            out.append(f.get(), f.size());
+        } else {
+            out.append(std::make_unique<fragment>(f.share()));
+        }
+    }
+    *this = std::move(out);
+    return true;
+}
+
 iobuf iobuf::copy() const {
     auto in = iobuf::iterator_consumer(cbegin(), cend());
     return iobuf_copy(in, _size);
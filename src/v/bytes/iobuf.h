@@ -144,6 +144,19 @@ public:
      */
     iobuf copy() const;
 
+    /**
+     * Coalesces the runs of adjacent fragments smaller than \p threshold
+     * bytes into regularly sized fragments. Larger fragments are kept as they
+     * are, shared with their current owners, so at most \p threshold bytes are
+     * copied per small fragment. Buffers made of many tiny fragments, e.g. after
+     * many share() and trim operations, are then cheaper to iterate over and
+     * to hand to the network as a scattered message.
+     *
+     * Returns false, leaving the buffer untouched, if there are no adjacent
+     * small fragments.
+     */
+    bool linearize_if_fragmented(size_t threshold);
+
     /// makes a reservation with the internal storage. adds a layer of
     /// indirection instead of raw byte pointer to allow the
     /// details::io_fragments to internally compact buffers as long as they
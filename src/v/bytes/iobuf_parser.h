@@ -46,12 +46,21 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
+        if (auto [val, length_size] = read_contiguous_varint(vint::max_length);
+            likely(length_size > 0)) {
+            return {vint::decode_zigzag(val), length_size};
+        }
         auto [val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
     }
 
     std::pair<uint32_t, uint8_t> read_unsigned_varint() {
+        if (auto [val, length_size] = read_contiguous_varint(
+              unsigned_vint::max_length);
+            likely(length_size > 0)) {
+            return {static_cast<uint32_t>(val), length_size};
+        }
         auto [val, length_size] = unsigned_vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
@@ -115,6 +124,22 @@ protected:
     iobuf& ref() { return *std::get<owned_buf>(_buf); }
 
 private:
+    /// Decodes a varint of the current fragment without going through the
+    /// byte iterator, returns a length of 0 if it may cross into the next
+    /// fragment or is longer than what the word decoder handles.
+    std::pair<uint64_t, uint8_t> read_contiguous_varint(size_t max_bytes) {
+        if (_in.segment_bytes_left() < unsigned_vint::detail::word_length) {
+            return {0, 0};
+        }
+        auto [val, length_size] = unsigned_vint::detail::deserialize_word(
+          _in.segment_data());
+        if (length_size == 0 || length_size > max_bytes) {
+            return {0, 0};
+        }
+        _in.skip(length_size);
+        return {val, length_size};
+    }
+
     using const_ref = const iobuf*;
     using owned_buf = std::unique_ptr<iobuf>;
 
@@ -83,6 +83,27 @@ ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n) {
     });
 }
 
+ss::future<iobuf>
+read_iobuf_exactly_zero_copy(ss::input_stream<char>& in, size_t n) {
+    return ss::do_with(iobuf{}, n, [&in](iobuf& b, size_t& n) {
+        return ss::do_until(
+                 [&n] { return n == 0; },
+                 [&n, &in, &b] {
+                     return in.read_up_to(n).then(
+                       [&n, &b](ss::temporary_buffer<char> buf) {
+                           if (buf.empty()) {
+                               n = 0;
+                               return;
+                           }
+                           n -= buf.size();
+                           b.append(
+                             std::make_unique<iobuf::fragment>(std::move(buf)));
+                       });
+                 })
+          .then([&b] { return std::move(b); });
+    });
+}
+
 ss::future<>
 write_iobuf_to_output_stream(iobuf buf, ss::output_stream<char>& output) {
     return ss::do_with(std::move(buf), [&output](iobuf& buf) {
@@ -22,4 +22,11 @@ ss::output_stream<char> make_iobuf_ref_output_stream(iobuf& io);
 /// \brief exactly like input_stream<char>::read_exactly but returns iobuf
 ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n);
 
+/// \brief like read_iobuf_exactly but the buffers returned by the stream
+/// become fragments of the result as they are, they are never copied to
+/// linearize the result. Meant for large payloads whose data is kept around,
+/// e.g. record batches, the fragments share the memory of the stream buffers.
+ss::future<iobuf>
+read_iobuf_exactly_zero_copy(ss::input_stream<char>& in, size_t n);
+
 ss::future<> write_iobuf_to_output_stream(iobuf, ss::output_stream<char>&);
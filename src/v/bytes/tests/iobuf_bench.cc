@@ -0,0 +1,97 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "bytes/scattered_message.h"
+#include "random/generators.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+namespace {
+
+constexpr size_t buffer_bytes = 1_MiB;
+constexpr size_t iterations = 100;
+
+// A response made of tiny encoded fields interleaved with the shared payload
+// of record batches, as built by the fetch path.
+iobuf make_fragmented(size_t small_bytes, size_t payload_bytes) {
+    auto data = random_generators::gen_alphanum_string(buffer_bytes);
+    iobuf buf;
+    size_t pos = 0;
+    size_t i = 0;
+    while (pos < data.size()) {
+        const auto len = std::min(
+          i++ % 8 == 7 ? payload_bytes : small_bytes, data.size() - pos);
+        iobuf frag;
+        frag.append(data.data() + pos, len);
+        buf.append_fragments(std::move(frag));
+        pos += len;
+    }
+    return buf;
+}
+
+template<typename F>
+size_t fragmented_body(size_t small_bytes, size_t payload_bytes, F f) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        auto buf = make_fragmented(small_bytes, payload_bytes);
+        perf_tests::start_measuring_time();
+        bytes += f(buf);
+        perf_tests::stop_measuring_time();
+    }
+    return bytes;
+}
+
+size_t as_scattered(iobuf& buf) {
+    auto msg = iobuf_as_scattered(std::move(buf));
+    perf_tests::do_not_optimize(msg);
+    return msg.size();
+}
+
+size_t linearize_as_scattered(iobuf& buf) {
+    buf.linearize_if_fragmented(512);
+    return as_scattered(buf);
+}
+
+size_t iterate(iobuf& buf) {
+    size_t sum = 0;
+    for (const auto& f : buf) {
+        sum += static_cast<uint8_t>(*f.get());
+    }
+    perf_tests::do_not_optimize(sum);
+    return buf.size_bytes();
+}
+
+size_t linearize_iterate(iobuf& buf) {
+    buf.linearize_if_fragmented(512);
+    return iterate(buf);
+}
+
+} // namespace
+
+PERF_TEST(iobuf_fragmented, as_scattered) {
+    return fragmented_body(16, 4_KiB, as_scattered);
+}
+
+PERF_TEST(iobuf_fragmented, linearize_as_scattered) {
+    return fragmented_body(16, 4_KiB, linearize_as_scattered);
+}
+
+PERF_TEST(iobuf_fragmented, iterate) {
+    return fragmented_body(16, 4_KiB, iterate);
+}
+
+PERF_TEST(iobuf_fragmented, linearize_iterate) {
+    return fragmented_body(16, 4_KiB, linearize_iterate);
+}
+
+PERF_TEST(iobuf_unfragmented, linearize_as_scattered) {
+    return fragmented_body(16_KiB, 16_KiB, linearize_as_scattered);
+}
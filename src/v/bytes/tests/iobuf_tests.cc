@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
 #include "bytes/iobuf.h"
@@ -799,3 +800,38 @@ SEASTAR_THREAD_TEST_CASE(iobuf_hexdump) {
   00000000 | 41 65 6e 65 61 6e 20 73  65 64 20 6c 65 6f 20 70  | Aenean sed leo p
   00000010 | 6f 72 74 74 69 74 6f 72  2e                       | orttitor.)");
 }
+
+SEASTAR_THREAD_TEST_CASE(iobuf_linearize_if_fragmented) {
+    auto fragments = [](const iobuf& b) {
+        return std::distance(b.begin(), b.end());
+    };
+    auto data = random_generators::gen_alphanum_string(512_KiB);
+
+    // a mix of runs of tiny fragments and large ones
+    iobuf buf;
+    size_t pos = 0;
+    size_t i = 0;
+    while (pos < data.size()) {
+        const size_t len = std::min(
+          i++ % 100 == 99 ? size_t{64_KiB} : size_t{17}, data.size() - pos);
+        iobuf frag;
+        frag.append(data.data() + pos, len);
+        buf.append_fragments(std::move(frag));
+        pos += len;
+    }
+    const auto before = fragments(buf);
+    auto copy = buf.copy();
+
+    BOOST_REQUIRE(buf.linearize_if_fragmented(512));
+    BOOST_REQUIRE_EQUAL(buf, copy);
+    BOOST_REQUIRE_LT(fragments(buf), before / 10);
+
+    // no tiny fragments left to coalesce
+    const auto after = fragments(buf);
+    BOOST_REQUIRE(!buf.linearize_if_fragmented(64));
+    BOOST_REQUIRE_EQUAL(fragments(buf), after);
+    BOOST_REQUIRE_EQUAL(buf, copy);
+
+    iobuf empty;
+    BOOST_REQUIRE(!empty.linearize_if_fragmented(512));
+}
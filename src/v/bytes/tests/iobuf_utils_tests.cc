@@ -42,6 +42,26 @@ SEASTAR_THREAD_TEST_CASE(test_reading_some_bytes) {
     BOOST_REQUIRE_EQUAL(read_buf.size_bytes(), 16);
 };
 
+SEASTAR_THREAD_TEST_CASE(test_reading_zero_copy) {
+    iobuf buf;
+    for (int i = 0; i < 4; ++i) {
+        ss::temporary_buffer<char> frag(1024);
+        std::fill_n(frag.get_write(), frag.size(), static_cast<char>('a' + i));
+        buf.append(std::make_unique<iobuf::fragment>(std::move(frag)));
+    }
+    auto expected = buf.copy();
+    auto is = make_iobuf_input_stream(std::move(buf));
+
+    auto read_buf = read_iobuf_exactly_zero_copy(is, 3000).get();
+    BOOST_REQUIRE_EQUAL(read_buf.size_bytes(), 3000);
+    // every buffer returned by the stream is its own fragment
+    BOOST_REQUIRE_EQUAL(std::distance(read_buf.begin(), read_buf.end()), 3);
+    BOOST_REQUIRE_EQUAL(read_buf, expected.share(0, 3000));
+
+    auto rest = read_iobuf_exactly_zero_copy(is, 2000).get();
+    BOOST_REQUIRE_EQUAL(rest.size_bytes(), 1096);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_bytes_conversion) {
     static constexpr std::string_view key = "magic_key";
     iobuf buf;
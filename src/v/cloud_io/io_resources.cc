@@ -190,6 +190,15 @@ ss::future<std::optional<device_throughput>> get_storage_device_throughput() {
     co_return std::nullopt;
 }
 
+/// At most a tenth of the connections of the shard are used for hedged
+/// downloads so that hedging can't amplify the load on an object store which
+/// is already slow.
+size_t max_hedged_downloads() {
+    auto max_connections
+      = config::shard_local_cfg().cloud_storage_max_connections();
+    return std::max<size_t>(1, max_connections / 10);
+}
+
 } // namespace
 
 io_resources::io_resources()
@@ -197,6 +206,7 @@ io_resources::io_resources()
       config::shard_local_cfg()
         .cloud_storage_max_concurrent_hydrations_per_shard.bind())
   , _hydration_units(max_parallel_hydrations(), "cst_hydrations")
+  , _hedge_units(max_hedged_downloads(), "cst_hedges")
   , _throughput_limit(
       // apply shard limit to downloads
       get_hard_throughput_limit().download_shard_throughput_limit,
@@ -225,6 +235,7 @@ ss::future<> io_resources::stop() {
     log.debug("Stopping cloud_io::io_resources...");
     _throughput_limit.shutdown();
     _hydration_units.broken();
+    _hedge_units.broken();
 
     co_await _gate.close();
     log.debug("Stopped cloud_io::io_resources...");
@@ -256,6 +267,10 @@ size_t io_resources::current_ongoing_hydrations() const {
     return _hydration_units.outstanding();
 }
 
+std::optional<ssx::semaphore_units> io_resources::try_get_hedge_units() {
+    return ss::try_get_units(_hedge_units, 1);
+}
+
 ss::future<> io_resources::set_disk_max_bandwidth(size_t tput) {
     try {
         if (tput == 0 || tput == std::numeric_limits<size_t>::max()) {
@@ -19,6 +19,8 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 
+#include <optional>
+
 namespace cloud_io {
 
 /**
@@ -46,6 +48,11 @@ public:
     /// How many partition_record_batch_reader_impl instances exist
     size_t current_ongoing_hydrations() const;
 
+    /// Units for a hedged download or nullopt if the shard already has the
+    /// maximum number of hedged downloads in flight. Hedges are extra load on
+    /// the object store, they never wait for units.
+    std::optional<ssx::semaphore_units> try_get_hedge_units();
+
 private:
     config::binding<std::optional<uint32_t>>
       _max_concurrent_hydrations_per_shard;
@@ -65,6 +72,7 @@ private:
     ss::gate _gate;
 
     adjustable_semaphore _hydration_units;
+    ssx::semaphore _hedge_units;
 
     token_bucket<> _throughput_limit;
     config::binding<std::optional<size_t>> _throughput_shard_limit_config;
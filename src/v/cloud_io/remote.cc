@@ -25,6 +25,7 @@
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/coroutine/as_future.hh>
@@ -32,8 +33,9 @@
 
 #include <boost/beast/http/field.hpp>
 #include <boost/lexical_cast.hpp>
-#include <boost/range/irange.hpp>
 
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <iterator>
 #include <utility>
@@ -47,18 +49,6 @@ struct key_and_node {
     std::unique_ptr<retry_chain_node> node;
 };
 
-template<typename R>
-requires std::ranges::range<R>
-size_t num_chunks(const R& r, size_t max_batch_size) {
-    const auto range_size = std::distance(r.begin(), r.end());
-
-    if (range_size % max_batch_size == 0) {
-        return range_size / max_batch_size;
-    } else {
-        return range_size / max_batch_size + 1;
-    }
-}
-
 static constexpr auto gcs_scheme = "gs";
 static constexpr auto s3_scheme = "s3";
 
@@ -102,7 +92,15 @@ remote::remote(
   , _cloud_storage_backend{cloud_storage_clients::
                              infer_backend_from_configuration(
                                conf, cloud_credentials_source)}
-  , _provider(infer_provider(_cloud_storage_backend, conf)) {
+  , _provider(infer_provider(_cloud_storage_backend, conf))
+  , _delete_batch_concurrency(
+      config::shard_local_cfg().cloud_storage_delete_batch_concurrency.bind())
+  , _delete_batch_timeout(
+      config::shard_local_cfg().cloud_storage_delete_batch_timeout_ms.bind())
+  , _delete_rtc(_as)
+  , _hedged_download_percentile(
+      config::shard_local_cfg()
+        .cloud_storage_hedged_download_percentile.bind()) {
     vlog(
       log.info, "remote initialized with backend {}", _cloud_storage_backend);
     // If the credentials source is from config file, bypass the background
@@ -178,6 +176,8 @@ ss::future<> remote::stop() {
     if (!_as.abort_requested()) {
         _as.request_abort();
     }
+    // Fail the deletions which didn't start yet
+    dispatch_delete_batches();
     co_await _resources->stop();
     co_await _gate.close();
     co_await _auth_refresh_bg_op.stop();
@@ -436,6 +436,168 @@ ss::future<download_result> remote::download_stream(
     co_return *result;
 }
 
+namespace {
+
+constexpr auto min_hedge_delay = 10ms;
+
+ss::future<result<iobuf, cloud_storage_clients::error_outcome>> get_and_drain(
+  cloud_storage_clients::client& client,
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  ss::lowres_clock::duration timeout,
+  bool expect_missing,
+  retry_chain_logger& ctxlog) {
+    auto resp = co_await client.get_object(
+      bucket, path, timeout, expect_missing);
+    if (!resp) {
+        co_return resp.error();
+    }
+    try {
+        co_return co_await cloud_storage_clients::util::drain_response_stream(
+          resp.value());
+    } catch (...) {
+        co_return cloud_storage_clients::util::handle_client_transport_error(
+          std::current_exception(), ctxlog);
+    }
+}
+
+/// One of the two requests of a hedged GET
+struct hedged_attempt {
+    std::optional<result<iobuf, cloud_storage_clients::error_outcome>> outcome;
+    std::exception_ptr error;
+
+    bool done() const { return outcome.has_value() || error != nullptr; }
+    bool succeeded() const {
+        return outcome.has_value() && outcome->has_value();
+    }
+};
+
+struct hedged_get_state {
+    std::array<hedged_attempt, 2> attempts;
+    ss::condition_variable cv;
+};
+
+ss::future<> run_attempt(
+  ss::lw_shared_ptr<hedged_get_state> state,
+  size_t index,
+  ss::future<result<iobuf, cloud_storage_clients::error_outcome>> f) {
+    auto& attempt = state->attempts.at(index);
+    try {
+        attempt.outcome = co_await std::move(f);
+    } catch (...) {
+        attempt.error = std::current_exception();
+    }
+    state->cv.signal();
+}
+
+} // namespace
+
+void remote::download_latency_window::record(ss::lowres_clock::duration d) {
+    _samples.at(_count % capacity) = d;
+    ++_count;
+}
+
+std::optional<ss::lowres_clock::duration>
+remote::download_latency_window::percentile(size_t pct) const {
+    const auto n = std::min(_count, capacity);
+    if (n < min_samples) {
+        return std::nullopt;
+    }
+    auto samples = _samples;
+    auto nth = samples.begin() + static_cast<ptrdiff_t>((n - 1) * pct / 100);
+    std::nth_element(
+      samples.begin(), nth, samples.begin() + static_cast<ptrdiff_t>(n));
+    return *nth;
+}
+
+ss::future<remote::get_object_result> remote::hedged_get_object(
+  cloud_storage_clients::client& client,
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  ss::lowres_clock::duration timeout,
+  bool expect_missing,
+  ss::abort_source& as,
+  retry_chain_logger& ctxlog) {
+    const auto pct = _hedged_download_percentile();
+    auto delay = pct ? _download_latency.percentile(*pct) : std::nullopt;
+    if (!delay) {
+        co_return co_await get_and_drain(
+          client, bucket, path, timeout, expect_missing, ctxlog);
+    }
+    delay = std::max<ss::lowres_clock::duration>(*delay, min_hedge_delay);
+
+    auto state = ss::make_lw_shared<hedged_get_state>();
+    auto& first = state->attempts[0];
+    auto& second = state->attempts[1];
+    auto primary = run_attempt(
+      state,
+      0,
+      get_and_drain(client, bucket, path, timeout, expect_missing, ctxlog));
+    try {
+        co_await state->cv.wait(
+          ss::lowres_clock::now() + *delay, [&first] { return first.done(); });
+    } catch (const ss::condition_variable_timed_out&) {
+    }
+
+    // Hedge only if it doesn't have to wait for a connection or exceed the
+    // hedging budget of the shard.
+    std::optional<ssx::semaphore_units> units;
+    if (!first.done() && _pool.local().size() > 0) {
+        units = _resources->try_get_hedge_units();
+    }
+    std::optional<ss::future<cloud_storage_clients::client_pool::client_lease>>
+      lease_fut;
+    if (units) {
+        lease_fut = co_await ss::coroutine::as_future(
+          _pool.local().acquire(as));
+        if (lease_fut->failed()) {
+            vlog(
+              ctxlog.debug,
+              "Not hedging the download of {}: {}",
+              path,
+              lease_fut->get_exception());
+            lease_fut.reset();
+        }
+    }
+    if (!lease_fut) {
+        co_await std::move(primary);
+    } else {
+        auto lease = lease_fut->get();
+        vlog(
+          ctxlog.debug,
+          "Download of {} is slower than {}, sending a hedged request",
+          path,
+          std::chrono::duration_cast<std::chrono::milliseconds>(*delay));
+        auto hedge = run_attempt(
+          state,
+          1,
+          get_and_drain(
+            *lease.client, bucket, path, timeout, expect_missing, ctxlog));
+        co_await state->cv.wait([&first, &second] {
+            return first.succeeded() || second.succeeded()
+                   || (first.done() && second.done());
+        });
+        // Shutting down the connection cancels the slower request
+        if (!first.done()) {
+            client.shutdown();
+        }
+        if (!second.done()) {
+            lease.client->shutdown();
+        }
+        co_await std::move(primary);
+        co_await std::move(hedge);
+        if (!first.succeeded() && second.succeeded()) {
+            vlog(ctxlog.debug, "Hedged request for {} completed first", path);
+        }
+    }
+
+    auto& winner = !first.succeeded() && second.succeeded() ? second : first;
+    if (winner.error) {
+        std::rethrow_exception(winner.error);
+    }
+    co_return std::move(*winner.outcome);
+}
+
 ss::future<download_result>
 remote::download_object(download_request download_request) {
     auto guard = _gate.hold();
@@ -455,23 +617,22 @@ remote::download_object(download_request download_request) {
     std::optional<download_result> result;
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         download_request.transfer_details.on_request(fib.retry_count());
-        auto resp = co_await lease.client->get_object(
-          bucket, path, fib.get_timeout(), download_request.expect_missing);
+        const auto started = ss::lowres_clock::now();
+        auto resp = co_await hedged_get_object(
+          *lease.client,
+          bucket,
+          path,
+          fib.get_timeout(),
+          download_request.expect_missing,
+          fib.root_abort_source(),
+          ctxlog);
 
         if (resp) {
             vlog(ctxlog.debug, "Receive OK response from {}", path);
-            try {
-                auto buffer
-                  = co_await cloud_storage_clients::util::drain_response_stream(
-                    resp.value());
-                download_request.payload.append_fragments(std::move(buffer));
-                transfer_details.on_success();
-                co_return download_result::success;
-            } catch (...) {
-                resp
-                  = cloud_storage_clients::util::handle_client_transport_error(
-                    std::current_exception(), ctxlog);
-            }
+            _download_latency.record(ss::lowres_clock::now() - started);
+            download_request.payload.append_fragments(std::move(resp.value()));
+            transfer_details.on_success();
+            co_return download_result::success;
         }
 
         lease.client->shutdown();
@@ -524,6 +685,15 @@ remote::download_object(download_request download_request) {
 }
 
 ss::future<download_result> remote::object_exists(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  retry_chain_node& parent,
+  std::string_view object_type) {
+    auto res = co_await head_object(bucket, path, parent, object_type);
+    co_return res.result;
+}
+
+ss::future<remote::head_object_result> remote::head_object(
   const cloud_storage_clients::bucket_name& bucket,
   const cloud_storage_clients::object_key& path,
   retry_chain_node& parent,
@@ -546,7 +716,10 @@ ss::future<download_result> remote::object_exists(
               path,
               resp.value().object_size,
               resp.value().etag);
-            co_return download_result::success;
+            co_return head_object_result{
+              .result = download_result::success,
+              .metadata = std::move(resp.value()),
+            };
         }
 
         // Error path
@@ -590,7 +763,7 @@ ss::future<download_result> remote::object_exists(
           object_type,
           path);
     }
-    co_return *result;
+    co_return head_object_result{.result = *result};
 }
 
 ss::future<upload_result>
@@ -690,59 +863,120 @@ ss::future<upload_result> remote::delete_objects(
           bucket, std::forward<R>(keys), parent, std::move(req_cb));
     }
 
-    const auto batches_to_delete = num_chunks(keys, delete_objects_max_keys());
-    std::vector<upload_result> results;
-    results.reserve(batches_to_delete);
-
-    co_await ss::max_concurrent_for_each(
-      boost::irange(batches_to_delete),
-      concurrency(),
-      [this, bucket, &keys, &parent, &results, cb = std::move(req_cb)](
-        auto chunk_ix) -> ss::future<> {
-          auto chunk_start_offset = (chunk_ix * delete_objects_max_keys());
-
-          auto chunk_begin = keys.begin();
-          std::advance(chunk_begin, chunk_start_offset);
-
-          auto chunk_end = chunk_begin;
-          if (
-            delete_objects_max_keys()
-            < std::distance(chunk_begin, keys.end())) {
-              std::advance(chunk_end, delete_objects_max_keys());
-          } else {
-              chunk_end = keys.end();
-          }
-
-          std::vector<cloud_storage_clients::object_key> key_batch;
-          key_batch.insert(
-            key_batch.end(),
-            std::make_move_iterator(chunk_begin),
-            std::make_move_iterator(chunk_end));
-
-          vassert(
-            key_batch.size() > 0,
-            "The chunking logic must always produce non-empty batches.");
+    auto request = ss::make_lw_shared<delete_request>();
+    request->req_cb = std::move(req_cb);
+    auto& queue = _delete_queue[bucket];
+    for (auto& key : keys) {
+        queue.push_back({.key = std::move(key), .request = request});
+        ++request->remaining;
+    }
+    auto done = request->done.get_future();
+    dispatch_delete_batches();
+    co_return co_await std::move(done);
+}
 
-          return delete_object_batch(bucket, std::move(key_batch), parent, cb)
-            .then([&results](auto result) { results.push_back(result); });
-      });
+void remote::delete_request::complete(upload_result r) {
+    if (r != upload_result::success && result == upload_result::success) {
+        result = r;
+    }
+    if (--remaining == 0) {
+        done.set_value(result);
+    }
+}
 
-    if (results.empty()) {
-        vlog(ctxlog.error, "No keys were deleted");
-        co_return upload_result::failed;
+void remote::dispatch_delete_batches() {
+    if (_gate.is_closed() || _as.abort_requested()) {
+        for (auto& [bucket, queue] : _delete_queue) {
+            for (auto& queued : queue) {
+                queued.request->complete(upload_result::cancelled);
+            }
+        }
+        _delete_queue.clear();
+        return;
+    }
+    const auto max_keys = static_cast<size_t>(delete_objects_max_keys());
+    const auto max_in_flight = std::max(_delete_batch_concurrency(), size_t{1});
+    while (_delete_batches_in_flight < max_in_flight
+           && !_delete_queue.empty()) {
+        // Keys queued while all batches were in flight are coalesced with
+        // the keys of other callers, so under load every request carries
+        // max_keys keys.
+        auto it = _delete_queue.begin();
+        auto& queue = it->second;
+        const auto batch_size = std::min(max_keys, queue.size());
+        std::vector<queued_delete> batch;
+        batch.reserve(batch_size);
+        std::move(
+          queue.begin(),
+          std::next(queue.begin(), batch_size),
+          std::back_inserter(batch));
+        queue.erase(queue.begin(), std::next(queue.begin(), batch_size));
+        auto bucket = it->first;
+        if (queue.empty()) {
+            _delete_queue.erase(it);
+        }
+        ++_delete_batches_in_flight;
+        ssx::spawn_with_gate(
+          _gate,
+          [this,
+           bucket = std::move(bucket),
+           batch = std::move(batch)]() mutable {
+              return run_delete_batch(std::move(bucket), std::move(batch))
+                .finally([this] {
+                    --_delete_batches_in_flight;
+                    dispatch_delete_batches();
+                });
+          });
     }
+}
 
-    co_return std::reduce(
-      results.begin(),
-      results.end(),
-      upload_result::success,
-      [](auto res_a, auto res_b) {
-          if (res_a != upload_result::success) {
-              return res_a;
-          }
+ss::future<> remote::run_delete_batch(
+  cloud_storage_clients::bucket_name bucket, std::vector<queued_delete> batch) {
+    retry_chain_node fib(
+      _delete_batch_timeout(),
+      config::shard_local_cfg().cloud_storage_initial_backoff_ms(),
+      &_delete_rtc);
+
+    std::vector<cloud_storage_clients::object_key> keys;
+    keys.reserve(batch.size());
+    // The keys of a request are queued next to each other, so this collects
+    // the requests which contributed to the batch.
+    std::vector<ss::lw_shared_ptr<delete_request>> requests;
+    for (auto& queued : batch) {
+        keys.push_back(std::move(queued.key));
+        if (requests.empty() || requests.back() != queued.request) {
+            requests.push_back(queued.request);
+        }
+    }
+    auto cb = [&requests](size_t retry_count) {
+        for (const auto& request : requests) {
+            if (request->req_cb) {
+                request->req_cb(retry_count);
+            }
+        }
+    };
 
-          return res_b;
-      });
+    auto fut = co_await ss::coroutine::as_future(
+      delete_object_batch(bucket, std::move(keys), fib, std::move(cb)));
+    auto result = upload_result::failed;
+    if (fut.failed()) {
+        auto ex = fut.get_exception();
+        if (ssx::is_shutdown_exception(ex)) {
+            result = upload_result::cancelled;
+        } else {
+            vlog(
+              log.warn,
+              "DeleteObjects (batch size={}, bucket={}) failed: {}",
+              batch.size(),
+              bucket,
+              ex);
+        }
+    } else {
+        result = fut.get();
+    }
+    for (auto& queued : batch) {
+        queued.request->complete(result);
+    }
 }
 
 ss::future<upload_result> remote::delete_object_batch(
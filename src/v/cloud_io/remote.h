@@ -27,9 +27,14 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <array>
+#include <deque>
+#include <map>
+#include <optional>
 #include <ranges>
 #include <utility>
 
@@ -186,6 +191,20 @@ public:
       retry_chain_node& parent,
       std::string_view object_type) override;
 
+    struct head_object_result {
+        download_result result;
+        /// Size and etag of the object, set if it exists
+        std::optional<cloud_storage_clients::client::head_object_result>
+          metadata;
+    };
+
+    /// Same as object_exists, also returns the metadata of the object
+    ss::future<head_object_result> head_object(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      retry_chain_node& parent,
+      std::string_view object_type);
+
     /// \brief Delete object from S3
     ///
     /// The method deletes the object. It can retry after some errors.
@@ -197,8 +216,11 @@ public:
     /// \brief Delete multiple objects from S3
     ///
     /// Deletes multiple objects from S3, utilizing the S3 client delete_objects
-    /// API. For the backends where batch deletes are supported, batch deletes
-    /// are performed. In other cases, sequential deletes are used as fallback.
+    /// API. For the backends where batch deletes are supported, the keys are
+    /// added to the shard-wide delete queue, which coalesces the keys of all
+    /// callers into batches of delete_objects_max_keys and limits the number
+    /// of batches in flight. In other cases, sequential deletes are used as
+    /// fallback.
     ///
     /// Note: the caller must ensure that if the backend does not support batch
     /// deletes, then the timeout or deadline set in parent should be sufficient
@@ -302,6 +324,61 @@ public:
 private:
     ss::future<> propagate_credentials(cloud_roles::credentials credentials);
 
+    /// A delete_objects call waiting for its keys to be deleted by the
+    /// delete queue.
+    struct delete_request {
+        /// Number of keys which are not deleted yet
+        size_t remaining{0};
+        upload_result result{upload_result::success};
+        ss::promise<upload_result> done;
+        std::function<void(size_t)> req_cb;
+
+        void complete(upload_result);
+    };
+
+    struct queued_delete {
+        cloud_storage_clients::object_key key;
+        ss::lw_shared_ptr<delete_request> request;
+    };
+
+    /// Send the queued keys in batches while the concurrency limit allows it.
+    void dispatch_delete_batches();
+
+    ss::future<> run_delete_batch(
+      cloud_storage_clients::bucket_name bucket,
+      std::vector<queued_delete> batch);
+
+    /// Latencies of the most recent successful download_object requests
+    class download_latency_window {
+    public:
+        static constexpr size_t capacity = 128;
+        /// Fewer samples make for a meaningless percentile
+        static constexpr size_t min_samples = 32;
+
+        void record(ss::lowres_clock::duration d);
+        std::optional<ss::lowres_clock::duration>
+        percentile(size_t pct) const;
+
+    private:
+        std::array<ss::lowres_clock::duration, capacity> _samples{};
+        size_t _count{0};
+    };
+
+    using get_object_result
+      = result<iobuf, cloud_storage_clients::error_outcome>;
+
+    /// GET the whole object. If the request takes longer than the configured
+    /// percentile of recent downloads, the same request is made on another
+    /// connection and the first successful response is used.
+    ss::future<get_object_result> hedged_get_object(
+      cloud_storage_clients::client& client,
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      ss::lowres_clock::duration timeout,
+      bool expect_missing,
+      ss::abort_source& as,
+      retry_chain_logger& ctxlog);
+
     ss::sharded<cloud_storage_clients::client_pool>& _pool;
     ss::gate _gate;
     ss::abort_source _as;
@@ -312,6 +389,16 @@ private:
 
     model::cloud_storage_backend _cloud_storage_backend;
     cloud_io::provider _provider;
+
+    /// Keys waiting to be deleted, per bucket
+    std::map<cloud_storage_clients::bucket_name, std::deque<queued_delete>>
+      _delete_queue;
+    size_t _delete_batches_in_flight{0};
+    config::binding<size_t> _delete_batch_concurrency;
+    config::binding<std::chrono::milliseconds> _delete_batch_timeout;
+    retry_chain_node _delete_rtc;
+    download_latency_window _download_latency;
+    config::binding<std::optional<size_t>> _hedged_download_percentile;
 };
 
 } // namespace cloud_io
@@ -13,6 +13,7 @@
 #include "base/units.h"
 #include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
+#include "hashing/crc32c.h"
 #include "serde/peek.h"
 #include "serde/rw/enum.h"
 #include "serde/rw/envelope.h"
@@ -27,7 +28,9 @@
 #include <absl/container/btree_map.h>
 #include <absl/container/btree_set.h>
 
+#include <cstring>
 #include <exception>
+#include <limits>
 #include <ranges>
 #include <variant>
 
@@ -59,13 +62,27 @@ namespace cloud_storage {
 // is defined by hand in the read/write methods so that it can be done
 // with streaming.
 struct table_header
-  : serde::envelope<table_header, serde::version<1>, serde::compat_version<0>> {
+  : serde::envelope<table_header, serde::version<2>, serde::compat_version<0>> {
     size_t table_size{0};
     tracker_version version{tracker_version::v1};
+    // Added in version 2, journal records of other generations are stale
+    uint64_t generation{0};
 
-    auto serde_fields() { return std::tie(table_size, version); }
+    auto serde_fields() { return std::tie(table_size, version, generation); }
 };
 
+// Journal records are framed as [body size][crc32c of body][body] and padded
+// with zeros to journal_alignment. A zero size marks the end of the journal.
+struct journal_frame {
+    uint32_t body_size{0};
+    uint32_t crc{0};
+
+    static constexpr size_t size = 2 * sizeof(uint32_t);
+};
+
+// Below this many journaled entries the journal is never compacted.
+static constexpr size_t journal_compaction_min_entries = 10000;
+
 ss::future<> access_time_tracker::write(
   ss::output_stream<char>& out, tracker_version version) {
     // This lock protects us from the _table being mutated while we
@@ -74,7 +91,16 @@ ss::future<> access_time_tracker::write(
 
     _dirty = false;
 
-    const table_header h{.table_size = _table.size(), .version = version};
+    // The snapshot contains all changes made so far, start a new journal.
+    ++_generation;
+    _journal.clear();
+    _journaled_entries = 0;
+    _snapshot_required = false;
+
+    const table_header h{
+      .table_size = _table.size(),
+      .version = version,
+      .generation = _generation};
     iobuf header_buf;
     serde::write(header_buf, h);
     co_await write_iobuf_to_output_stream(std::move(header_buf), out);
@@ -122,20 +148,45 @@ void access_time_tracker::on_released_table_lock() {
         _dirty = true;
     }
 
-    for (const auto& [hash, ts] : _pending_upserts) {
+    for (const auto& [path, ts] : _pending_upserts) {
         if (ts.has_value()) {
-            _table[hash] = ts.value();
+            upsert(path, ts.value());
         } else {
-            _table.erase(hash);
+            erase(path);
         }
     }
     _pending_upserts.clear();
 }
 
+void access_time_tracker::upsert(
+  const ss::sstring& path, file_metadata metadata) {
+    auto [it, inserted] = _table.try_emplace(path, metadata);
+    if (!inserted) {
+        _lru.erase(lru_t::value_type{it->second.atime_sec, it->first});
+        it->second = metadata;
+    }
+    _lru.emplace(metadata.atime_sec, it->first);
+    _journal[path] = metadata;
+    _dirty = true;
+}
+
+void access_time_tracker::erase(const ss::sstring& path) {
+    if (auto it = _table.find(path); it != _table.end()) {
+        _lru.erase(lru_t::value_type{it->second.atime_sec, it->first});
+        _table.erase(it);
+        _journal[path] = std::nullopt;
+    }
+    _dirty = true;
+}
+
 ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
+    _lru.clear();
     _table.clear();
+    _journal.clear();
+    _journaled_entries = 0;
+    _snapshot_required = false;
     _dirty = false;
 
     // Accumulate a serialized table_header in this buffer
@@ -156,6 +207,7 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     header_buf.append(tmp.get(), tmp.size());
     auto h_parser = iobuf_parser(std::move(header_buf));
     auto h = serde::read_nested<table_header>(h_parser, 0);
+    _generation = h.generation;
 
     auto defer = ss::defer([&] {
         lock_guard.return_all();
@@ -186,8 +238,11 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
             auto path = serde::read_nested<ss::sstring>(parser, 0);
             auto atime = serde::read_nested<uint32_t>(parser, 0);
             auto size = serde::read_nested<uint64_t>(parser, 0);
-            _table.emplace(
+            auto [it, inserted] = _table.emplace(
               path, file_metadata{.atime_sec = atime, .size = size});
+            if (inserted) {
+                _lru.emplace(atime, it->first);
+            }
         }
     }
 
@@ -211,8 +266,7 @@ void access_time_tracker::add(
     auto units = seastar::try_get_units(_table_lock, 1);
     if (units.has_value()) {
         // Got lock, update main table
-        _table[path] = {.atime_sec = seconds, .size = size};
-        _dirty = true;
+        upsert(path, {.atime_sec = seconds, .size = size});
     } else {
         // Locked during serialization, defer write
         _pending_upserts[path] = {.atime_sec = seconds, .size = size};
@@ -225,8 +279,7 @@ void access_time_tracker::remove(std::string_view key) noexcept {
         auto units = seastar::try_get_units(_table_lock, 1);
         if (units.has_value()) {
             // Unlocked, update main table
-            _table.erase(k);
-            _dirty = true;
+            erase(k);
         } else {
             // Locked during serialization, defer write
             _pending_upserts[k] = std::nullopt;
@@ -250,38 +303,34 @@ ss::future<> access_time_tracker::sync(
 
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
-    table_t tmp;
-
+    fragmented_vector<ss::sstring> removed;
     for (const auto& it : _table) {
-        if (paths.contains(it.first)) {
-            tmp.insert(it);
+        if (!paths.contains(it.first)) {
+            removed.push_back(it.first);
         }
         co_await ss::maybe_yield();
     }
 
+    for (const auto& path : removed) {
+        erase(path);
+    }
+
     if (add_entries) {
-        auto should_add = [this, &tmp](const auto& e) {
-            return should_track(e.path) && !tmp.contains(e.path);
+        auto should_add = [this](const auto& e) {
+            return should_track(e.path) && !_table.contains(e.path);
         };
         for (const auto& entry : existent | std::views::filter(should_add)) {
-            _dirty = true;
-            tmp.insert(
-              {entry.path,
-               {static_cast<uint32_t>(
-                  std::chrono::time_point_cast<std::chrono::seconds>(
-                    entry.access_time)
-                    .time_since_epoch()
-                    .count()),
-                entry.size}});
+            upsert(
+              entry.path,
+              {static_cast<uint32_t>(
+                 std::chrono::time_point_cast<std::chrono::seconds>(
+                   entry.access_time)
+                   .time_since_epoch()
+                   .count()),
+               entry.size});
         }
     }
 
-    if (_table.size() != tmp.size()) {
-        // We dropped one or more entries, therefore mutated the table.
-        _dirty = true;
-    }
-    _table = std::move(tmp);
-
     lock_guard.return_all();
     on_released_table_lock();
 }
@@ -297,16 +346,135 @@ access_time_tracker::get(const std::string& key) const {
 bool access_time_tracker::is_dirty() const { return _dirty; }
 
 fragmented_vector<file_list_item> access_time_tracker::lru_entries() const {
+    return lru_entries(
+      std::numeric_limits<uint64_t>::max(),
+      std::numeric_limits<size_t>::max(),
+      0);
+}
+
+fragmented_vector<file_list_item> access_time_tracker::lru_entries(
+  uint64_t size_limit, size_t objects_limit, size_t extra_bytes) const {
     fragmented_vector<file_list_item> items;
-    items.reserve(_table.size());
-    for (const auto& [path, metadata] : _table) {
-        items.emplace_back(metadata.time_point(), path, metadata.size);
+    uint64_t total_size = 0;
+    auto it = _lru.begin();
+    for (; it != _lru.end()
+           && (total_size < size_limit || items.size() < objects_limit);
+         ++it) {
+        ss::sstring path{it->second};
+        const auto& metadata = _table.find(path)->second;
+        items.emplace_back(
+          metadata.time_point(), std::move(path), metadata.size);
+        total_size += metadata.size;
+    }
+    auto extra_left = static_cast<ssize_t>(extra_bytes);
+    for (; it != _lru.end() && extra_left > 0; ++it) {
+        ss::sstring path{it->second};
+        const auto& metadata = _table.find(path)->second;
+        items.emplace_back(
+          metadata.time_point(), std::move(path), metadata.size);
+        extra_left -= static_cast<ssize_t>(
+          sizeof(file_list_item) + it->second.size());
     }
-    std::ranges::sort(
-      items, {}, [](const auto& item) { return item.access_time; });
     return items;
 }
 
+iobuf access_time_tracker::take_journal_record() {
+    if (_journal.empty()) {
+        return {};
+    }
+
+    iobuf body;
+    serde::write(body, _generation);
+    serde::write(body, static_cast<uint64_t>(_journal.size()));
+    for (const auto& [path, metadata] : _journal) {
+        serde::write(body, path);
+        serde::write(body, metadata.has_value());
+        serde::write(body, metadata.has_value() ? metadata->atime_sec : 0U);
+        serde::write(body, metadata.has_value() ? metadata->size : 0UL);
+    }
+
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, body);
+
+    iobuf record;
+    serde::write(record, static_cast<uint32_t>(body.size_bytes()));
+    serde::write(record, crc.value());
+    record.append(std::move(body));
+
+    auto unaligned = record.size_bytes() % journal_alignment;
+    if (unaligned != 0) {
+        ss::temporary_buffer<char> padding(journal_alignment - unaligned);
+        std::memset(padding.get_write(), 0, padding.size());
+        record.append(std::move(padding));
+    }
+
+    _journaled_entries += _journal.size();
+    _journal.clear();
+    _dirty = false;
+    return record;
+}
+
+size_t access_time_tracker::replay_journal(iobuf buf) {
+    iobuf_parser parser(std::move(buf));
+    size_t valid_bytes = 0;
+    while (parser.bytes_left() >= journal_frame::size) {
+        journal_frame frame{
+          .body_size = serde::read_nested<uint32_t>(parser, 0),
+          .crc = serde::read_nested<uint32_t>(parser, 0),
+        };
+        if (frame.body_size == 0 || frame.body_size > parser.bytes_left()) {
+            break;
+        }
+        auto body = parser.share(frame.body_size);
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, body);
+        if (crc.value() != frame.crc) {
+            break;
+        }
+
+        iobuf_parser body_parser(std::move(body));
+        auto generation = serde::read_nested<uint64_t>(body_parser, 0);
+        auto count = serde::read_nested<uint64_t>(body_parser, 0);
+        if (generation != _generation) {
+            // Left behind by a snapshot which didn't truncate the journal
+            _snapshot_required = true;
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            auto path = serde::read_nested<ss::sstring>(body_parser, 0);
+            auto present = serde::read_nested<bool>(body_parser, 0);
+            auto atime = serde::read_nested<uint32_t>(body_parser, 0);
+            auto size = serde::read_nested<uint64_t>(body_parser, 0);
+            if (generation != _generation) {
+                continue;
+            }
+            if (present) {
+                upsert(path, {.atime_sec = atime, .size = size});
+            } else {
+                erase(path);
+            }
+        }
+        if (generation == _generation) {
+            _journaled_entries += count;
+        }
+
+        auto consumed = parser.bytes_consumed();
+        valid_bytes = ((consumed + journal_alignment - 1) / journal_alignment)
+                      * journal_alignment;
+        parser.skip(std::min(valid_bytes - consumed, parser.bytes_left()));
+    }
+
+    // The replayed changes are already persisted.
+    _journal.clear();
+    _dirty = false;
+    return valid_bytes;
+}
+
+bool access_time_tracker::needs_snapshot() const {
+    return _snapshot_required
+           || _journaled_entries
+                > std::max(_table.size(), journal_compaction_min_entries);
+}
+
 std::chrono::system_clock::time_point file_metadata::time_point() const {
     return std::chrono::system_clock::time_point{
       std::chrono::seconds{atime_sec}};
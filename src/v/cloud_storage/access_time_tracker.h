@@ -21,6 +21,8 @@
 #include <seastar/core/future.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
+#include <absl/container/node_hash_map.h>
 
 #include <chrono>
 #include <string_view>
@@ -37,11 +39,25 @@ struct file_metadata {
 
 /// Access time tracker maps cache entry file paths to their last accessed
 /// timestamp and file size.
+///
+/// Entries are kept in eviction order alongside the table, so the oldest
+/// entries can be listed without sorting the whole table.
+///
+/// The tracker is persisted as a snapshot written by \ref write, followed by
+/// a journal of the changes made since. Each snapshot starts a new
+/// generation, journal records of an older generation are ignored when the
+/// journal is replayed.
 class access_time_tracker {
     using timestamp_t = uint32_t;
-    using table_t = absl::btree_map<ss::sstring, file_metadata>;
+    using table_t = absl::node_hash_map<ss::sstring, file_metadata>;
+    // Keys point into _table, whose nodes are stable.
+    using lru_t = absl::btree_set<std::pair<timestamp_t, std::string_view>>;
 
 public:
+    /// Journal records are padded to this size so that they can be appended
+    /// with aligned writes.
+    static constexpr size_t journal_alignment = 4096;
+
     /// Add metadata to the container.
     void add(
       ss::sstring path,
@@ -70,9 +86,40 @@ public:
 
     size_t size() const { return _table.size(); }
 
+    /// Return all entries, least recently accessed first.
     fragmented_vector<file_list_item> lru_entries() const;
 
+    /// Return the least recently accessed entries which add up to at least
+    /// \p size_limit bytes and \p objects_limit objects, followed by more
+    /// entries using up to \p extra_bytes of memory.
+    fragmented_vector<file_list_item> lru_entries(
+      uint64_t size_limit, size_t objects_limit, size_t extra_bytes) const;
+
+    /// Serialize the changes made since the last call to \ref write or
+    /// \ref take_journal_record into a journal record padded to
+    /// journal_alignment. Returns an empty buffer if there are no changes.
+    iobuf take_journal_record();
+
+    /// Apply the journal records of the current generation found in \p buf
+    /// on top of the table. Replay stops at the first torn or corrupted
+    /// record. Returns the number of bytes of valid records, the offset at
+    /// which new records have to be appended.
+    size_t replay_journal(iobuf buf);
+
+    /// Returns true if the journal has grown large enough relative to the
+    /// table that a new snapshot should be written instead of appending to
+    /// it.
+    bool needs_snapshot() const;
+
+    /// Make the next save write a snapshot, used when persisting the tracker
+    /// failed and the journal on disk may be missing changes.
+    void invalidate_journal() noexcept { _snapshot_required = true; }
+
 private:
+    /// Update the table, the eviction order and the journal.
+    void upsert(const ss::sstring& path, file_metadata metadata);
+    void erase(const ss::sstring& path);
+
     /// Returns true if the key's metadata should be tracked.
     /// We do not wish to track index files and transaction manifests
     /// as they are just an appendage to segment/chunk files and are
@@ -83,6 +130,17 @@ private:
     void on_released_table_lock();
 
     table_t _table;
+    lru_t _lru;
+
+    // Changes not persisted yet, the value is empty for removed keys
+    absl::btree_map<ss::sstring, std::optional<file_metadata>> _journal;
+
+    // Generation of the last snapshot
+    uint64_t _generation{0};
+    // Number of entries in the journal records of the current generation
+    size_t _journaled_entries{0};
+    // Set when the journal on disk can't be appended to
+    bool _snapshot_required{false};
 
     // Lock taken during async loops over the table (ser/de and trim())
     // modifications may proceed without the lock if it is not taken.
@@ -16,6 +16,8 @@
 #include "cloud_storage/partition_manifest_downloader.h"
 #include "cloud_storage/remote.h"
 #include "config/node_config.h"
+#include "hashing/xx.h"
+#include "random/generators.h"
 
 namespace cloud_storage {
 
@@ -105,11 +107,12 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
     vlog(
       _logger.debug,
       "segments checked in cloud storage: {} [override: {}, inv-scrub enabled: "
-      "{}, inv-data available: {}]",
+      "{}, inv-data available: {}, sample: {}%]",
       _result.detected.segment_existence_checked,
       query_ctx.force_segment_existence_check,
       query_ctx.is_inv_scrub_enabled,
-      query_ctx.is_inv_data_available);
+      query_ctx.is_inv_data_available,
+      query_ctx.sample_percent);
 
     const auto stop_at_stm = co_await check_manifest(
       manifest, scrub_from, rtc_node, query_ctx);
@@ -351,7 +354,10 @@ existence_query_context::existence_query_context(
   bool always_check_for_segments, model::ntp ntp)
   : is_inv_scrub_enabled{config::shard_local_cfg()
                            .cloud_storage_inventory_based_scrub_enabled()}
-  , force_segment_existence_check{always_check_for_segments} {
+  , force_segment_existence_check{always_check_for_segments}
+  , sample_percent{config::shard_local_cfg()
+                     .cloud_storage_scrubbing_sample_percent()}
+  , sample_seed{random_generators::get_int<uint64_t>()} {
     if (is_inv_scrub_enabled) {
         hashes.emplace(
           std::move(ntp), config::node().cloud_storage_inventory_hash_path());
@@ -373,10 +379,10 @@ bool existence_query_context::should_lookup_in_cloud_storage(
         return true;
     }
 
-    // scrubbing is enabled but inv. based scrub is disabled, always check cloud
-    // storage
+    // scrubbing is enabled but inv. based scrub is disabled, check the sampled
+    // segments in cloud storage
     if (!is_inv_scrub_enabled) {
-        return true;
+        return is_sampled(p);
     }
 
     // if data is available and segment is missing there, check cloud storage
@@ -390,6 +396,15 @@ bool existence_query_context::should_lookup_in_cloud_storage(
     return false;
 }
 
+bool existence_query_context::is_sampled(const remote_segment_path& p) const {
+    if (sample_percent >= 100) {
+        return true;
+    }
+    const auto& path = p().native();
+    return (xxhash_64(path.data(), path.size()) ^ sample_seed) % 100
+           < sample_percent;
+}
+
 ss::future<existence_query_context>
 existence_query_context::load(bool always_check_for_segments, model::ntp ntp) {
     existence_query_context q{always_check_for_segments, std::move(ntp)};
@@ -27,6 +27,11 @@ struct existence_query_context {
     bool is_inv_scrub_enabled{false};
     bool is_inv_data_available{false};
     bool force_segment_existence_check{false};
+    /// Percentage of segments looked up in cloud storage when there is no
+    /// inventory data to consult. Which segments fall into the sample
+    /// depends on the seed, it is picked randomly for every scrub run.
+    uint32_t sample_percent{100};
+    uint64_t sample_seed{0};
     std::optional<inventory::ntp_path_hashes> hashes;
 
     existence_query_context(bool always_check_for_segments, model::ntp ntp);
@@ -35,6 +40,9 @@ struct existence_query_context {
 
     bool should_lookup_in_cloud_storage(const remote_segment_path& p) const;
 
+    /// True if the segment belongs to the sample checked by this run
+    bool is_sampled(const remote_segment_path& p) const;
+
     static ss::future<existence_query_context>
     load(bool always_check_for_segments, model::ntp ntp);
 };
@@ -257,6 +257,7 @@ async_manifest_view_cursor::seek(async_view_search_query_t q) {
     } else {
         _stm_start_offset = std::nullopt;
     }
+    maybe_prefetch();
     _timer.rearm(_idle_timeout + ss::lowres_clock::now());
     co_return true;
 }
@@ -321,10 +322,21 @@ async_manifest_view_cursor::next() {
         //            set to expected base offset
         _stm_start_offset = std::clamp(next_base_offset, _begin, _end);
     }
+    maybe_prefetch();
     _timer.rearm(_idle_timeout + ss::lowres_clock::now());
     co_return eof::no;
 }
 
+void async_manifest_view_cursor::maybe_prefetch() {
+    const auto* m = std::get_if<ss::shared_ptr<materialized_manifest>>(
+      &_current);
+    if (m == nullptr) {
+        return;
+    }
+    _view.prefetch_spillover_manifests(
+      model::next_offset((*m)->manifest.get_last_offset()), _end);
+}
+
 ss::future<ss::stop_iteration> async_manifest_view_cursor::next_iter() {
     auto res = co_await next();
     if (res.has_failure()) {
@@ -410,6 +422,9 @@ async_manifest_view::async_manifest_view(
       config::shard_local_cfg().storage_read_readahead_count.bind())
   , _manifest_meta_ttl(
       config::shard_local_cfg().cloud_storage_manifest_cache_ttl_ms.bind())
+  , _prefetch_depth(
+      config::shard_local_cfg()
+        .cloud_storage_spillover_manifest_prefetch.bind())
   , _manifest_cache(
       _remote.local().materialized().get_materialized_manifest_cache()) {}
 
@@ -456,6 +471,13 @@ ss::future<> async_manifest_view::run_bg_loop() {
                     front.promise.set_value(std::ref(_stm_manifest));
                     continue;
                 }
+                if (auto it = _inflight_prefetches.find(
+                      front.search_vec.base_offset);
+                    it != _inflight_prefetches.end()) {
+                    // The manifest is being prefetched, wait for it
+                    // instead of downloading it for the second time.
+                    co_await it->second.get_shared_future();
+                }
                 if (!_manifest_cache.contains(std::make_tuple(
                       get_ntp(), front.search_vec.base_offset))) {
                     // Manifest is not cached and has to be hydrated and/or
@@ -736,10 +758,16 @@ async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
         } else {
             // look for first segment in next term, segments are sorted by
             // base_offset and term
-            for (const auto& p : stmm) {
-                if (p.segment_term > term) {
-                    co_return p.base_kafka_offset() - kafka::offset(1);
-                }
+            const auto& starts = get_stm_term_index().term_starts;
+            auto it = std::upper_bound(
+              starts.begin(),
+              starts.end(),
+              term,
+              [](model::term_id t, const auto& start) {
+                  return t < start.first;
+              });
+            if (it != starts.end()) {
+                co_return it->second - kafka::offset(1);
             }
         }
     } else if (stmm.get_archive_start_offset() != model::offset{}) {
@@ -848,6 +876,41 @@ async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
     co_return std::nullopt;
 }
 
+const async_manifest_view::stm_term_index&
+async_manifest_view::get_stm_term_index() {
+    const auto& stmm = stm_manifest();
+    const auto insync_offset = stmm.get_insync_offset();
+    const auto start_offset = stmm.get_start_offset().value_or(
+      model::offset{});
+    if (
+      _stm_term_index.has_value()
+      && _stm_term_index->insync_offset == insync_offset
+      && _stm_term_index->num_segments == stmm.size()
+      && _stm_term_index->start_offset == start_offset) {
+        return *_stm_term_index;
+    }
+    stm_term_index index{
+      .insync_offset = insync_offset,
+      .num_segments = stmm.size(),
+      .start_offset = start_offset,
+    };
+    for (const auto& p : stmm) {
+        if (
+          index.term_starts.empty()
+          || index.term_starts.back().first != p.segment_term) {
+            index.term_starts.emplace_back(
+              p.segment_term, p.base_kafka_offset());
+        }
+    }
+    vlog(
+      _ctxlog.debug,
+      "Rebuilt term index of the STM manifest, {} terms in {} segments",
+      index.term_starts.size(),
+      index.num_segments);
+    _stm_term_index = std::move(index);
+    return *_stm_term_index;
+}
+
 bool async_manifest_view::is_empty() const noexcept {
     return _stm_manifest.size() == 0;
 }
@@ -1606,6 +1669,81 @@ remote_manifest_path async_manifest_view::get_spillover_manifest_path(
       path_provider().spillover_manifest_path(_stm_manifest, comp)};
 }
 
+void async_manifest_view::prefetch_spillover_manifests(
+  model::offset next_base_offset, model::offset end_inclusive) {
+    const auto depth = static_cast<size_t>(_prefetch_depth());
+    if (depth == 0 || _gate.is_closed()) {
+        return;
+    }
+    const auto& spillover_map = _stm_manifest.get_spillover_map();
+    size_t scanned = 0;
+    for (auto it = spillover_map.lower_bound(next_base_offset);
+         it != spillover_map.end() && scanned < depth;
+         ++it, ++scanned) {
+        if (_inflight_prefetches.size() >= depth) {
+            break;
+        }
+        auto meta = *it;
+        if (meta.base_offset > end_inclusive) {
+            break;
+        }
+        if (
+          _inflight_prefetches.contains(meta.base_offset)
+          || _manifest_cache.contains(
+            std::make_tuple(get_ntp(), meta.base_offset))) {
+            continue;
+        }
+        // Prefetching only uses memory which is not needed by anyone else.
+        // Nothing gets evicted to make room for a manifest which might not
+        // be read.
+        auto units = _manifest_cache.try_prepare(meta.metadata_size_hint);
+        if (!units.has_value()) {
+            break;
+        }
+        vlog(
+          _ctxlog.debug,
+          "Prefetching spillover manifest {}, {} bytes",
+          meta.base_offset,
+          meta.metadata_size_hint);
+        _inflight_prefetches.emplace(meta.base_offset, ss::shared_promise<>{});
+        ssx::spawn_with_gate(
+          _gate, [this, meta, u = std::move(units.value())]() mutable {
+              return prefetch_manifest(meta, std::move(u));
+          });
+    }
+}
+
+ss::future<> async_manifest_view::prefetch_manifest(
+  segment_meta meta, ssx::semaphore_units units) noexcept {
+    auto done = ss::defer([this, bo = meta.base_offset] {
+        auto it = _inflight_prefetches.find(bo);
+        if (it != _inflight_prefetches.end()) {
+            it->second.set_value();
+            _inflight_prefetches.erase(it);
+        }
+    });
+    auto path = get_spillover_manifest_path(meta);
+    auto m_res = co_await materialize_manifest(path);
+    if (m_res.has_failure()) {
+        // The manifest will be materialized on demand if it's needed
+        vlog(
+          _ctxlog.debug,
+          "Failed to prefetch spillover manifest {}: {}",
+          path,
+          m_res.error());
+        co_return;
+    }
+    if (_manifest_cache.contains(
+          std::make_tuple(get_ntp(), meta.base_offset))) {
+        co_return;
+    }
+    _manifest_cache.put(std::move(units), std::move(m_res.value()), _ctxlog);
+    _ts_probe.set_spillover_manifest_bytes(
+      static_cast<int64_t>(_manifest_cache.size_bytes()));
+    _ts_probe.set_spillover_manifest_instances(
+      static_cast<int32_t>(_manifest_cache.size()));
+}
+
 ss::future<result<spillover_manifest, error_outcome>>
 async_manifest_view::materialize_manifest(
   remote_manifest_path path) const noexcept {
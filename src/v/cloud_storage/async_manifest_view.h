@@ -18,6 +18,7 @@
 #include "cloud_storage/remote_probe.h"
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/types.h"
+#include "container/fragmented_vector.h"
 #include "model/metadata.h"
 #include "model/timestamp.h"
 #include "ssx/task_local_ptr.h"
@@ -28,6 +29,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/timed_out_error.hh>
 
@@ -165,6 +167,19 @@ public:
     }
 
 private:
+    /// First kafka offset of every term of the STM manifest, ordered by term
+    struct stm_term_index {
+        model::offset insync_offset;
+        size_t num_segments{0};
+        model::offset start_offset;
+        chunked_vector<std::pair<model::term_id, kafka::offset>> term_starts;
+    };
+
+    /// Term index of the STM manifest. It is built by the first term lookup
+    /// and rebuilt once the manifest changed, consumers without a matching
+    /// last term don't scan the whole manifest on every lookup.
+    const stm_term_index& get_stm_term_index();
+
     ss::future<result<archive_start_offset_advance, error_outcome>>
     time_based_retention(std::chrono::milliseconds time_limit) noexcept;
 
@@ -225,6 +240,15 @@ private:
     remote_manifest_path
     get_spillover_manifest_path(const segment_meta& meta) const;
 
+    /// Start materializing the spillover manifests which follow
+    /// 'next_base_offset' in the background, up to the configured prefetch
+    /// depth and within the free space of the manifest cache.
+    void prefetch_spillover_manifests(
+      model::offset next_base_offset, model::offset end_inclusive);
+
+    ss::future<>
+    prefetch_manifest(segment_meta meta, ssx::semaphore_units units) noexcept;
+
     mutable ss::gate _gate;
     ss::abort_source _as;
     cloud_storage_clients::bucket_name _bucket;
@@ -242,6 +266,7 @@ private:
     config::binding<int16_t> _readahead_size;
 
     config::binding<std::chrono::milliseconds> _manifest_meta_ttl;
+    config::binding<uint16_t> _prefetch_depth;
 
     materialized_manifest_cache& _manifest_cache;
 
@@ -255,6 +280,12 @@ private:
     };
     std::deque<materialization_request_t> _requests;
     ss::condition_variable _cvar;
+
+    /// Spillover manifests being prefetched, keyed by base offset. The
+    /// promise is resolved once the prefetch finishes.
+    std::map<model::offset, ss::shared_promise<>> _inflight_prefetches;
+
+    std::optional<stm_term_index> _stm_term_index;
 };
 
 enum class async_manifest_view_cursor_status {
@@ -371,6 +402,9 @@ private:
 
     bool manifest_in_range(const manifest_section_t& m);
 
+    /// Prefetch the spillover manifests which follow the current one
+    void maybe_prefetch();
+
     /// Manifest view ref
     async_manifest_view& _view;
 
@@ -50,6 +50,11 @@ cache_probe::cache_probe() {
               [this] { return _cur_in_progress_files; },
               sm::description(
                 "Current number of files that are being put to cache.")),
+            sm::make_counter(
+              "coalesced_downloads",
+              [this] { return _coalesced_downloads; },
+              sm::description("Total number of downloads skipped because "
+                              "another shard downloaded the same object.")),
           });
     }
 
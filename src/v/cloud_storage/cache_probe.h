@@ -47,6 +47,8 @@ public:
 
     void tracker_sync() { ++_tracker_syncs; }
 
+    void coalesced_download() { ++_coalesced_downloads; }
+
 private:
     uint64_t _num_puts = 0;
     uint64_t _num_gets = 0;
@@ -68,6 +70,8 @@ private:
 
     uint64_t _tracker_syncs{0};
 
+    uint64_t _coalesced_downloads{0};
+
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
 };
@@ -18,6 +18,7 @@
 #include "seastar/util/file.hh"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
+#include "utils/file_io.h"
 #include "utils/human.h"
 
 #include <seastar/core/coroutine.hh>
@@ -53,6 +54,8 @@ static constexpr auto access_timer_period = 60s;
 static constexpr const char* access_time_tracker_file_name = "accesstime";
 static constexpr const char* access_time_tracker_file_name_tmp
   = "accesstime.tmp";
+static constexpr const char* access_time_tracker_journal_file_name
+  = "accesstime.journal";
 
 std::ostream& operator<<(std::ostream& o, cache_element_status s) {
     switch (s) {
@@ -391,7 +394,12 @@ ss::future<> cache::trim(
         - std::min(
           target_objects, _current_cache_objects + _reserved_cache_objects);
 
-    auto tracker_lru_entries = _access_time_tracker.lru_entries();
+    // Only the oldest entries which can satisfy the trim are needed, plus
+    // the ones kept as carryover for the next trim.
+    auto tracker_lru_entries = _access_time_tracker.lru_entries(
+      size_to_delete,
+      objects_to_delete,
+      config::shard_local_cfg().cloud_storage_cache_trim_carryover_bytes());
     vlog(
       cst_log.debug,
       "in-memory trim: set target_size {}/{}, size {}/{}, reserved {}/{}, "
@@ -429,7 +437,8 @@ ss::future<> cache::trim(
     // Subsequent calculations require knowledge of how much data cannot
     // possibly be deleted (because all trims skip it) in order to decide
     // whether the trim worked properly.
-    static constexpr size_t undeletable_objects = 1;
+    const size_t undeletable_objects
+      = _access_tracker_journal_offset > 0 ? 2 : 1;
     auto undeletable_bytes = (co_await access_time_tracker_size()).value_or(0);
 
     if (
@@ -802,7 +811,9 @@ ss::future<cache::trim_result> cache::do_trim(
 bool cache::is_trim_exempt(const ss::sstring& path) const {
     if (
       path == (_cache_dir / access_time_tracker_file_name).string()
-      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()) {
+      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()
+      || path
+           == (_cache_dir / access_time_tracker_journal_file_name).string()) {
         return true;
     }
 
@@ -901,16 +912,22 @@ cache::trim_exhaustive(uint64_t size_to_delete, size_t objects_to_delete) {
 }
 
 ss::future<std::optional<uint64_t>> cache::access_time_tracker_size() const {
-    auto path = _cache_dir / access_time_tracker_file_name;
-    try {
-        co_return static_cast<uint64_t>(co_await ss::file_size(path.string()));
-    } catch (const std::filesystem::filesystem_error& e) {
-        if (e.code() == std::errc::no_such_file_or_directory) {
-            co_return std::nullopt;
-        } else {
-            throw;
+    std::optional<uint64_t> total;
+    for (const auto* name :
+         {access_time_tracker_file_name,
+          access_time_tracker_journal_file_name}) {
+        auto path = _cache_dir / name;
+        try {
+            total = total.value_or(0)
+                    + static_cast<uint64_t>(
+                      co_await ss::file_size(path.string()));
+        } catch (const std::filesystem::filesystem_error& e) {
+            if (e.code() != std::errc::no_such_file_or_directory) {
+                throw;
+            }
         }
     }
+    co_return total;
 }
 
 ss::future<> cache::load_access_time_tracker() {
@@ -920,6 +937,8 @@ ss::future<> cache::load_access_time_tracker() {
     auto present = co_await ss::file_exists(source.native());
     if (!present) {
         vlog(cst_log.info, "Access time tracker doesn't exist at '{}'", source);
+        // A journal written before the first snapshot may still exist
+        co_await load_access_time_tracker_journal(true);
         co_return;
     }
     vlog(
@@ -935,6 +954,7 @@ ss::future<> cache::load_access_time_tracker() {
       = priority_manager::local().shadow_indexing_priority();
 
     auto exists = co_await ss::file_exists(source.string());
+    bool snapshot_loaded = false;
     if (exists) {
         try {
             co_await ss::util::with_file_input_stream(
@@ -944,6 +964,7 @@ ss::future<> cache::load_access_time_tracker() {
               },
               open_opts,
               input_opts);
+            snapshot_loaded = true;
         } catch (...) {
             vlog(
               cst_log.warn,
@@ -955,6 +976,40 @@ ss::future<> cache::load_access_time_tracker() {
         vlog(
           cst_log.info, "Access time tracker is not available at '{}'", source);
     }
+    co_await load_access_time_tracker_journal(snapshot_loaded);
+}
+
+ss::future<> cache::load_access_time_tracker_journal(bool snapshot_loaded) {
+    auto source = _cache_dir / access_time_tracker_journal_file_name;
+    if (!co_await ss::file_exists(source.native())) {
+        co_return;
+    }
+    if (!snapshot_loaded) {
+        // The journal can only be replayed on top of the snapshot it follows,
+        // replace both with a new snapshot.
+        _access_time_tracker.invalidate_journal();
+        co_return;
+    }
+
+    try {
+        auto buf = co_await read_fully(source);
+        auto journal_size = buf.size_bytes();
+        _access_tracker_journal_offset = _access_time_tracker.replay_journal(
+          std::move(buf));
+        vlog(
+          cst_log.info,
+          "Replayed {}/{} bytes of access time tracker journal '{}'",
+          _access_tracker_journal_offset,
+          journal_size,
+          source);
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to replay access time tracker journal '{}'. Error: {}",
+          source,
+          std::current_exception());
+        _access_time_tracker.invalidate_journal();
+    }
 }
 
 /**
@@ -975,26 +1030,95 @@ ss::future<> cache::save_access_time_tracker() {
     // Protect the file from concurrent writes.
     auto lock_guard = co_await ss::get_units(_access_tracker_writer_sm, 1);
 
-    ss::file_open_options open_opts;
-    co_await ss::with_file(
-      ss::open_file_dma(
-        tmp_path.string(),
-        ss::open_flags::create | ss::open_flags::wo,
-        open_opts),
-      [this](ss::file f) -> ss::future<> {
-          return _save_access_time_tracker(std::move(f));
-      });
-
-    auto final_path = _cache_dir / access_time_tracker_file_name;
-    co_await ss::rename_file(tmp_path.string(), final_path.string());
+    try {
+        ss::file_open_options open_opts;
+        co_await ss::with_file(
+          ss::open_file_dma(
+            tmp_path.string(),
+            ss::open_flags::create | ss::open_flags::wo,
+            open_opts),
+          [this](ss::file f) -> ss::future<> {
+              return _save_access_time_tracker(std::move(f));
+          });
+
+        auto final_path = _cache_dir / access_time_tracker_file_name;
+        co_await ss::rename_file(tmp_path.string(), final_path.string());
+    } catch (...) {
+        // The tracker already started a new journal generation
+        _access_time_tracker.invalidate_journal();
+        throw;
+    }
+
+    // The snapshot supersedes the journal. If the journal can't be removed,
+    // its records are ignored on load as they belong to an older generation.
+    auto journal_path = _cache_dir / access_time_tracker_journal_file_name;
+    if (co_await ss::file_exists(journal_path.string())) {
+        co_await ss::remove_file(journal_path.string());
+    }
+    _access_tracker_journal_offset = 0;
 
     lock_guard.return_all();
 }
 
+ss::future<> cache::append_access_time_tracker_journal() {
+    ss::gate::holder guard{_gate};
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+
+    auto lock_guard = co_await ss::get_units(_access_tracker_writer_sm, 1);
+
+    auto record = _access_time_tracker.take_journal_record();
+    if (record.empty()) {
+        co_return;
+    }
+
+    try {
+        co_await _append_access_time_tracker_journal(std::move(record));
+    } catch (...) {
+        _access_time_tracker.invalidate_journal();
+        throw;
+    }
+}
+
+/**
+ * Inner part of append_access_time_tracker_journal, writes \p record at the
+ * end of the journal.
+ */
+ss::future<> cache::_append_access_time_tracker_journal(iobuf record) {
+    auto path = _cache_dir / access_time_tracker_journal_file_name;
+    auto buf = ss::temporary_buffer<char>::aligned(
+      access_time_tracker::journal_alignment, record.size_bytes());
+    iobuf::iterator_consumer(record.cbegin(), record.cend())
+      .consume_to(record.size_bytes(), buf.get_write());
+
+    auto f = co_await ss::open_file_dma(
+      path.string(), ss::open_flags::create | ss::open_flags::wo);
+    std::exception_ptr ex;
+    try {
+        auto written = co_await f.dma_write(
+          _access_tracker_journal_offset, buf.get(), buf.size());
+        if (written != buf.size()) {
+            throw std::runtime_error(fmt::format(
+              "short write to '{}': {}/{} bytes", path, written, buf.size()));
+        }
+        co_await f.flush();
+        _access_tracker_journal_offset += buf.size();
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
 ss::future<> cache::maybe_save_access_time_tracker() {
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     if (_access_time_tracker.is_dirty() && !_gate.is_closed()) {
-        co_await save_access_time_tracker();
+        if (_access_time_tracker.needs_snapshot()) {
+            co_await save_access_time_tracker();
+        } else {
+            co_await append_access_time_tracker_journal();
+        }
     }
 }
 
@@ -1046,6 +1170,10 @@ ss::future<> cache::stop() {
     _block_puts_cond.broken();
     _cleanup_sm.broken();
     _tracker_sync_timer_sem.broken();
+    for (auto& [key, download] : _inflight_downloads) {
+        download.set_exception(ss::abort_requested_exception{});
+    }
+    _inflight_downloads.clear();
     if (ss::this_shard_id() == 0) {
         co_await save_access_time_tracker().handle_exception([](auto eptr) {
             // NOTE: see issue/11270 if the exception is "filesystem error:
@@ -1388,6 +1516,69 @@ cache::_is_cached(const std::filesystem::path& key) {
     }
 }
 
+ss::future<> cache::download_once(
+  std::filesystem::path key,
+  ss::noncopyable_function<ss::future<>()> download) {
+    auto guard = _gate.hold();
+    // A download on another shard may fail, in which case one of the waiting
+    // shards takes over. Bound the number of times we wait for others before
+    // downloading the object regardless.
+    static constexpr int max_waits = 3;
+    for (int i = 0; i < max_waits; ++i) {
+        const bool leader = co_await container().invoke_on(
+          ss::shard_id{0},
+          [k = ss::sstring(key.native())](cache& c) {
+              return c.join_download(k);
+          });
+        if (leader) {
+            std::exception_ptr eptr;
+            try {
+                co_await download();
+            } catch (...) {
+                eptr = std::current_exception();
+            }
+            co_await container().invoke_on(
+              ss::shard_id{0}, [k = ss::sstring(key.native())](cache& c) {
+                  c.finish_download(k);
+              });
+            if (eptr) {
+                std::rethrow_exception(eptr);
+            }
+            co_return;
+        }
+
+        if (co_await is_cached(key) == cache_element_status::available) {
+            vlog(
+              cst_log.debug,
+              "{} was downloaded by another shard",
+              key.native());
+            probe.coalesced_download();
+            co_return;
+        }
+    }
+    co_await download();
+}
+
+ss::future<bool> cache::join_download(const ss::sstring& key) {
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+    auto guard = _gate.hold();
+    auto [it, inserted] = _inflight_downloads.try_emplace(key);
+    if (inserted) {
+        co_return true;
+    }
+    co_await it->second.get_shared_future();
+    co_return false;
+}
+
+void cache::finish_download(const ss::sstring& key) {
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+    if (auto it = _inflight_downloads.find(key);
+        it != _inflight_downloads.end()) {
+        it->second.set_value();
+        _inflight_downloads.erase(it);
+    }
+}
+
 ss::future<> cache::invalidate(const std::filesystem::path& key) {
     std::vector<std::filesystem::path> keys = make_candidate_object_names(
       key, "invalidate");
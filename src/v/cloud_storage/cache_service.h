@@ -27,7 +27,11 @@
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/node_hash_map.h>
 
 #include <filesystem>
 #include <iterator>
@@ -126,6 +130,18 @@ public:
     /// Remove element from cache by key
     ss::future<> invalidate(const std::filesystem::path& key);
 
+    /// Bring an object into the cache by running \p download, unless the same
+    /// key is already being downloaded on any shard of this node. In that case
+    /// wait for that download to finish instead, and only run \p download if
+    /// the object still isn't in the cache afterwards. The registry of
+    /// in-flight downloads is kept on shard 0.
+    ///
+    /// \param key is a cache key
+    /// \param download puts the object into the cache
+    ss::future<> download_once(
+      std::filesystem::path key,
+      ss::noncopyable_function<ss::future<>()> download);
+
     // Total cleaned is exposed for better testability of eviction
     uint64_t get_total_cleaned();
 
@@ -181,10 +197,18 @@ private:
     /// Load access time tracker from file
     ss::future<> load_access_time_tracker();
 
-    /// Save access time tracker to file
+    /// Replay the access time tracker journal on top of the loaded snapshot
+    ss::future<> load_access_time_tracker_journal(bool snapshot_loaded);
+
+    /// Save access time tracker snapshot to file
     ss::future<> save_access_time_tracker();
     ss::future<> _save_access_time_tracker(ss::file);
 
+    /// Append the access time tracker changes since the last save to the
+    /// journal
+    ss::future<> append_access_time_tracker_journal();
+    ss::future<> _append_access_time_tracker_journal(iobuf);
+
     /// Save access time tracker state to the file if needed
     ss::future<> maybe_save_access_time_tracker();
 
@@ -208,6 +232,14 @@ private:
     ss::future<cache_element_status>
     _is_cached(const std::filesystem::path& key);
 
+    /// Shard 0 only. Returns true if the caller is the first to download the
+    /// key, otherwise waits for the download in progress to finish and
+    /// returns false.
+    ss::future<bool> join_download(const ss::sstring& key);
+
+    /// Shard 0 only. Wake up the shards waiting for the download of the key.
+    void finish_download(const ss::sstring& key);
+
     /// Ordinary trim: prioritze trimming data chunks, only delete indices etc
     /// if all their chunks are dropped.
     ss::future<trim_result> trim_fast(
@@ -339,11 +371,18 @@ private:
 
     ssx::semaphore _cleanup_sm{1, "cloud/cache"};
     std::set<std::filesystem::path> _files_in_progress;
+
+    /// Downloads in progress on any shard, keyed by cache key (shard 0 only)
+    absl::node_hash_map<ss::sstring, ss::shared_promise<>> _inflight_downloads;
+
     cache_probe probe;
     access_time_tracker _access_time_tracker;
     ss::timer<ss::lowres_clock> _tracker_timer;
     ssx::semaphore _access_tracker_writer_sm{
       1, "cloud/cache/access_tracker_writer"};
+    /// Offset at which the next access time tracker journal record is
+    /// written (shard 0 only)
+    uint64_t _access_tracker_journal_offset{0};
 
     /// Remember when we last finished clean_up_cache, in order to
     /// avoid wastefully running it again soon after.
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/chunk_memory_cache.h"
+
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/util/defer.hh>
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+chunk_memory_cache::chunk_memory_cache(size_t capacity_bytes)
+  : _max_entry_size(capacity_bytes / 10)
+  , _cache(utils::chunked_kv_cache<ss::sstring, iobuf>::config{
+      .cache_size = std::max<size_t>(capacity_bytes, 2),
+      .small_size = std::max<size_t>(capacity_bytes / 10, 1)})
+  , _reclaimer(
+      [this](reclaimer::request r) { return reclaim(r); },
+      reclaim_scope::sync) {
+    setup_metrics();
+}
+
+std::optional<iobuf> chunk_memory_cache::get(const ss::sstring& key) {
+    _locked = true;
+    auto unlock = ss::defer([this] { _locked = false; });
+    auto cached = _cache.get_value(key);
+    if (!cached) {
+        return std::nullopt;
+    }
+    auto& data = **cached;
+    return data.share(0, data.size_bytes());
+}
+
+void chunk_memory_cache::put(const ss::sstring& key, iobuf data) {
+    const auto size = data.size_bytes();
+    if (!admits(size)) {
+        return;
+    }
+    _locked = true;
+    auto unlock = ss::defer([this] { _locked = false; });
+    _cache.try_insert(key, ss::make_shared<iobuf>(std::move(data)), size);
+}
+
+size_t chunk_memory_cache::reclaim(size_t size) noexcept {
+    if (_locked) {
+        return 0;
+    }
+    const auto before = size_bytes();
+    size_t released = 0;
+    while (released < size && _cache.evict()) {
+        released = before - size_bytes();
+    }
+    return released;
+}
+
+size_t chunk_memory_cache::size_bytes() const noexcept {
+    const auto s = _cache.stat();
+    return s.small_queue_size + s.main_queue_size;
+}
+
+chunk_memory_cache::stat chunk_memory_cache::get_stat() const noexcept {
+    const auto s = _cache.stat();
+    return {
+      .size_bytes = s.small_queue_size + s.main_queue_size,
+      .hit_count = s.hit_count,
+      .access_count = s.access_count,
+    };
+}
+
+void chunk_memory_cache::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cloud_storage:chunk_memory_cache"),
+      {
+        sm::make_gauge(
+          "size_bytes",
+          [this] { return size_bytes(); },
+          sm::description("Bytes of segment chunks held in memory.")),
+        sm::make_counter(
+          "hits",
+          [this] { return _cache.stat().hit_count; },
+          sm::description("Number of chunk reads served from memory.")),
+        sm::make_counter(
+          "accesses",
+          [this] { return _cache.stat().access_count; },
+          sm::description("Number of chunk lookups in the memory tier.")),
+      });
+}
+
+} // namespace cloud_storage
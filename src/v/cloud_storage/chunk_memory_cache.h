@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "metrics/metrics.h"
+#include "utils/chunked_kv_cache.h"
+
+#include <seastar/core/memory.hh>
+#include <seastar/core/sstring.hh>
+
+#include <optional>
+
+namespace cloud_storage {
+
+/// Shard local, memory bounded tier of segment chunks in front of the disk
+/// cache.
+///
+/// Chunks are inserted once a reader has consumed them completely from the
+/// disk cache, and subsequent readers of the same chunk are served from
+/// memory without reading the chunk file. Eviction uses the s3-fifo algorithm
+/// with the size of the chunk as the cost of an entry, so chunks read only
+/// once don't displace the hot working set. Chunks larger than the small
+/// queue, a tenth of the capacity, are not cached.
+///
+/// The cache registers a Seastar memory reclaimer, like the batch cache, so
+/// that chunks are released when the shard runs low on memory.
+class chunk_memory_cache {
+    using reclaimer = ss::memory::reclaimer;
+    using reclaim_scope = ss::memory::reclaimer_scope;
+    using reclaim_result = ss::memory::reclaiming_result;
+
+public:
+    explicit chunk_memory_cache(size_t capacity_bytes);
+
+    chunk_memory_cache(const chunk_memory_cache&) = delete;
+    chunk_memory_cache& operator=(const chunk_memory_cache&) = delete;
+    chunk_memory_cache(chunk_memory_cache&&) noexcept = delete;
+    chunk_memory_cache& operator=(chunk_memory_cache&&) noexcept = delete;
+    ~chunk_memory_cache() = default;
+
+    /// Return the data of the chunk stored under the cache key \p key.
+    std::optional<iobuf> get(const ss::sstring& key);
+
+    /// Add the data of a chunk stored under the cache key \p key.
+    void put(const ss::sstring& key, iobuf data);
+
+    /// True if a chunk of \p size bytes can be cached, readers use this to
+    /// decide whether to collect the chunk data while reading it.
+    bool admits(size_t size) const noexcept { return size <= _max_entry_size; }
+
+    struct stat {
+        /// Number of chunk bytes held by the cache
+        size_t size_bytes;
+        /// Number of lookups served from memory
+        size_t hit_count;
+        /// Number of lookups
+        size_t access_count;
+    };
+
+    stat get_stat() const noexcept;
+
+    /// Evict chunks until at least \p size bytes are released or the cache is
+    /// empty. Returns the number of bytes released.
+    size_t reclaim(size_t size) noexcept;
+
+private:
+    reclaim_result reclaim(reclaimer::request r) {
+        return reclaim(r.bytes_to_reclaim) != 0
+                 ? reclaim_result::reclaimed_something
+                 : reclaim_result::reclaimed_nothing;
+    }
+
+    size_t size_bytes() const noexcept;
+
+    void setup_metrics();
+
+    size_t _max_entry_size;
+    utils::chunked_kv_cache<ss::sstring, iobuf> _cache;
+
+    /// Set while the cache is modified, allocations in that window may invoke
+    /// the reclaimer which must not evict concurrently.
+    bool _locked{false};
+    reclaimer _reclaimer;
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace cloud_storage
@@ -103,6 +103,7 @@ inventory_consumer::process_paths(fragmented_vector<ss::sstring> paths) {
         // was a path in this row it will be recorded as missing.
         if (pieces.size() != 2) {
             vlog(cst_log.warn, "unexpected row in inventory report: {}", path);
+            continue;
         }
         process_path(pieces[1]);
     }
@@ -112,17 +113,13 @@ inventory_consumer::process_paths(fragmented_vector<ss::sstring> paths) {
     }
 }
 
-void inventory_consumer::process_path(ss::sstring path) {
+void inventory_consumer::process_path(const ss::sstring& path) {
     if (auto maybe_ntp = ntp_from_path(path);
         maybe_ntp.has_value() && _ntps.contains(maybe_ntp.value())) {
-        const auto& ntp = maybe_ntp.value();
         auto hash = xxhash_64(path.data(), path.size());
-
-        if (!_ntp_flush_states.contains(ntp)) {
-            _ntp_flush_states.insert({ntp, flush_state{}});
-        }
-
-        _ntp_flush_states[ntp].hashes.push_back(hash);
+        auto [it, _] = _ntp_flush_states.try_emplace(
+          std::move(maybe_ntp.value()));
+        it->second.hashes.push_back(hash);
         _total_size += sizeof(hash);
     }
 }
@@ -70,7 +70,7 @@ private:
     // Checks if the path belongs to one of the NTPs whose leadership belongs to
     // this node. If so, the path is hashed and added to current NTP flush
     // states, and will be written to disk on the next flush operation.
-    void process_path(ss::sstring path);
+    void process_path(const ss::sstring& path);
 
     // Writes the largest hash vectors to disk. The vectors are written in files
     // named after their NTP. If write_all_entries is true, all hashes are
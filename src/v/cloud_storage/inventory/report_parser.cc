@@ -18,19 +18,18 @@
 
 #include <zlib.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace {
 constexpr auto newline{'\n'};
 
+// memchr is vectorized by libc, which makes it much faster than walking the
+// buffer a byte at a time
 bool has_newline(const iobuf& b) {
-    iobuf::byte_iterator begin{b.cbegin(), b.cend()};
-    iobuf::byte_iterator end{b.cend(), b.cend()};
-    while (begin != end) {
-        if (*begin == newline) {
-            return true;
-        }
-        ++begin;
-    }
-    return false;
+    return std::any_of(b.begin(), b.end(), [](const auto& frag) {
+        return std::memchr(frag.get(), newline, frag.size()) != nullptr;
+    });
 }
 
 } // namespace
@@ -51,12 +50,16 @@ report_parser::report_parser(
 
 ss::future<report_parser::rows_t> report_parser::next() {
     auto h = _gate.hold();
-    while (!has_newline(_buffer)) {
+    // What is left from the previous call is a partial row, so after it only
+    // the newly read chunks have to be scanned
+    auto found_newline = has_newline(_buffer);
+    while (!found_newline) {
         auto fill_res = co_await fill_buffer();
         if (!fill_res.has_value()) {
             _eof = true;
             break;
         }
+        found_newline = has_newline(fill_res.value());
         _buffer.append(std::move(fill_res.value()));
     }
 
@@ -64,13 +67,12 @@ ss::future<report_parser::rows_t> report_parser::next() {
         co_return rows_t{};
     }
 
-    if (eof() && !has_newline(_buffer)) {
+    if (eof() && !found_newline) {
         iobuf_parser p{std::move(_buffer)};
         co_return rows_t{p.read_string(p.bytes_left())};
     }
 
-    vassert(
-      has_newline(_buffer), "Buffer {} does not contain a newline", _buffer);
+    vassert(found_newline, "Buffer {} does not contain a newline", _buffer);
     co_return split_to_rows();
 }
 
@@ -82,21 +84,30 @@ ss::future<> report_parser::stop() {
 }
 
 report_parser::rows_t report_parser::split_to_rows() {
-    using ibi = iobuf::byte_iterator;
     rows_t rows;
-    fragmented_vector<char> row;
-    for (auto begin = ibi{_buffer.cbegin(), _buffer.cend()},
-              end = ibi{_buffer.cend(), _buffer.cend()};
-         begin != end;
-         ++begin) {
-        if (*begin == newline) {
-            rows.emplace_back(row.begin(), row.end());
-            row.clear();
-        } else {
-            row.push_back(*begin);
+    // A row which spans fragments is assembled here. Rows which fit in a
+    // fragment are copied out of it directly.
+    ss::sstring partial;
+    for (const auto& frag : _buffer) {
+        const char* begin = frag.get();
+        const char* end = begin + frag.size();
+        while (begin != end) {
+            const auto* nl = static_cast<const char*>(
+              std::memchr(begin, newline, end - begin));
+            if (nl == nullptr) {
+                partial.append(begin, end - begin);
+                break;
+            }
+            if (partial.empty()) {
+                rows.emplace_back(begin, nl - begin);
+            } else {
+                partial.append(begin, nl - begin);
+                rows.push_back(std::exchange(partial, {}));
+            }
+            begin = nl + 1;
         }
     }
-    _buffer.trim_front(_buffer.size_bytes() - row.size());
+    _buffer.trim_front(_buffer.size_bytes() - partial.size());
     return rows;
 }
 
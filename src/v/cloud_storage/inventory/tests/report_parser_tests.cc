@@ -78,6 +78,19 @@ TEST(Parser, ParseTrailingNewLine) {
     }
 }
 
+TEST(Parser, ParseEmptyRows) {
+    std::string input{"a\n\nbc\n\n"};
+    std::vector<ss::sstring> expected{"a", "", "bc", ""};
+    for (const auto compression :
+         {is_gzip_compressed::no, is_gzip_compressed::yes}) {
+        // A small chunk size splits rows across buffer fragments
+        for (const size_t chunk_size : {1, 2, 4096}) {
+            auto p = make_parser(input, compression, chunk_size);
+            EXPECT_EQ(collect(p), expected);
+        }
+    }
+}
+
 TEST(Parser, ParseLargePayloadWithSmallChunkSize) {
     std::vector<ss::sstring> input;
     input.reserve(1024);
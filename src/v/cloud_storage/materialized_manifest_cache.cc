@@ -164,6 +164,14 @@ size_t materialized_manifest_cache::size() const noexcept {
     return _access_order.size() + _eviction_rollback.size();
 }
 
+std::optional<ssx::semaphore_units>
+materialized_manifest_cache::try_prepare(size_t size_bytes) {
+    if (_gate.is_closed() || size_bytes > _capacity_bytes) {
+        return std::nullopt;
+    }
+    return ss::try_get_units(_sem, size_bytes);
+}
+
 size_t materialized_manifest_cache::size_bytes() const noexcept {
     size_t res = 0;
     for (const auto& m : _access_order) {
@@ -106,6 +106,16 @@ public:
       retry_chain_logger& ctxlog,
       std::optional<ss::lowres_clock::duration> timeout = std::nullopt);
 
+    /// Reserve space to store next manifest if the cache has enough free
+    /// space.
+    ///
+    /// \note Unlike 'prepare' the method never evicts anything and never
+    ///       waits. Manifests larger than the capacity are not admitted.
+    /// \param size_bytes is a size of the manifest in bytes
+    /// \return acquired semaphore units or nullopt if there is not enough
+    ///         free space
+    std::optional<ssx::semaphore_units> try_prepare(size_t size_bytes);
+
     /// Return number of elements stored in the cache
     size_t size() const noexcept;
 
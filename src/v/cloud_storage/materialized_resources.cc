@@ -68,6 +68,13 @@ materialized_resources::materialized_resources()
     _storage_read_buffer_size.watch(update_max_mem);
     _storage_read_readahead_count.watch(update_max_mem);
 
+    if (const auto chunk_memory_cache_size
+        = config::shard_local_cfg().cloud_storage_chunk_memory_cache_size();
+        chunk_memory_cache_size > 0) {
+        _chunk_memory_cache = std::make_unique<chunk_memory_cache>(
+          chunk_memory_cache_size);
+    }
+
     _manifest_meta_size.watch([this] {
         ssx::background = ss::with_gate(_gate, [this] {
             vlog(
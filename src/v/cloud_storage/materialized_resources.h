@@ -11,6 +11,7 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "cloud_storage/chunk_memory_cache.h"
 #include "cloud_storage/materialized_manifest_cache.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote_partition.h"
@@ -72,6 +73,11 @@ public:
 
     materialized_manifest_cache& get_materialized_manifest_cache();
 
+    /// In-memory tier of segment chunks, nullptr if it is disabled
+    chunk_memory_cache* get_chunk_memory_cache() {
+        return _chunk_memory_cache.get();
+    }
+
     ts_read_path_probe& get_read_path_probe();
 
 private:
@@ -145,6 +151,9 @@ private:
     /// Cache used to store materialized spillover manifests
     ss::shared_ptr<materialized_manifest_cache> _manifest_cache;
 
+    /// Hot segment chunks kept in memory
+    std::unique_ptr<chunk_memory_cache> _chunk_memory_cache;
+
     /// Counter that is exposed via probe object.
     uint64_t _partition_readers_delayed{0};
     uint64_t _segment_readers_delayed{0};
@@ -28,30 +28,28 @@ ss::future<stream_stats> offset_translator::copy_stream(
   ss::output_stream<char> dst,
   retry_chain_node& fib) const {
     retry_chain_logger ctxlog(cst_log, fib);
-    model::offset min_offset = model::offset::max();
-    model::offset max_offset = model::offset::min();
-
-    auto pred =
-      [this, &min_offset, &max_offset](model::record_batch_header& hdr) {
-          static const auto types = model::offset_translator_batch_types();
-          auto n = std::count(types.begin(), types.end(), hdr.type);
-          if (n > 0) {
-              _ot_state->add_gap(hdr.base_offset, hdr.last_offset());
-          }
-          min_offset = std::min(min_offset, hdr.base_offset);
-          max_offset = std::max(max_offset, hdr.last_offset());
-          return storage::batch_consumer::consume_result::accept_batch;
-      };
+    stream_stats stats;
+
+    auto pred = [this, &stats](model::record_batch_header& hdr) {
+        static const auto types = model::offset_translator_batch_types();
+        auto n = std::count(types.begin(), types.end(), hdr.type);
+        if (n > 0) {
+            stats.gaps.push_back({hdr.base_offset, hdr.last_offset()});
+            if (_ot_state) {
+                _ot_state->add_gap(hdr.base_offset, hdr.last_offset());
+            }
+        }
+        stats.min_offset = std::min(stats.min_offset, hdr.base_offset);
+        stats.max_offset = std::max(stats.max_offset, hdr.last_offset());
+        return storage::batch_consumer::consume_result::accept_batch;
+    };
     auto len = co_await storage::transform_stream(
       std::move(src), std::move(dst), pred, _as);
     if (len.has_error()) {
         throw std::system_error(len.error());
     }
-    co_return stream_stats{
-      .min_offset = min_offset,
-      .max_offset = max_offset,
-      .size_bytes = len.value(),
-    };
+    stats.size_bytes = len.value();
+    co_return stats;
 }
 
 } // namespace cloud_storage
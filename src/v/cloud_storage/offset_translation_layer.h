@@ -22,12 +22,21 @@
 
 #include <absl/container/btree_map.h>
 
+#include <vector>
+
 namespace cloud_storage {
 
 struct stream_stats {
+    struct gap {
+        model::offset base_offset;
+        model::offset last_offset;
+    };
+
     model::offset min_offset = model::offset::max();
     model::offset max_offset = model::offset::min();
     uint64_t size_bytes{};
+    /// Non-data batches of the stream, in offset order
+    std::vector<gap> gaps;
 };
 
 /// This instance of this class is supposed to be used to
@@ -47,7 +56,8 @@ public:
     /// Copy source stream into the destination stream
     ///
     /// Patch stream content by removing all non-data batches and adjusting the
-    /// record batch offsets/checksums.
+    /// record batch offsets/checksums. The non-data batches are returned as
+    /// gaps and also added to the offset translator state, if there is one.
     /// The caller is responsible for patching the segement file name and
     /// passing correct base_offset of the original segment.
     ss::future<stream_stats> copy_stream(
@@ -36,6 +36,7 @@
 #include "serde/rw/scalar.h"
 #include "serde/rw/vector.h"
 #include "ssx/sformat.h"
+#include "ssx/task_slice.h"
 #include "storage/fs_utils.h"
 #include "utils/to_string.h"
 
@@ -52,7 +53,6 @@
 #include <exception>
 #include <iterator>
 #include <memory>
-#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <tuple>
@@ -291,37 +291,23 @@ partition_manifest::segment_containing(kafka::offset o) const {
         return end();
     }
 
-    // Kafka offset is always <= log offset.
-    // To find a segment by its kafka offset we can simply query
-    // manifest by log offset and then traverse forward until we
-    // find a matching segment.
-    auto it = _segments.lower_bound(kafka::offset_cast(o));
-    if (it == _segments.begin()) {
-        if (it->base_kafka_offset() > o) {
-            // The beginning of the manifest already has a base offset that
-            // doesn't satisfy the query.
-            return end();
-        } else {
-            // move it to the second element, so we can safely call
-            // _segments.prev(it)
-            ++it;
-        }
-    }
-
     // We need to find first element which has greater kafka offset than
     // the target and step back. It is possible to have a segment that
-    // doesn't have data batches. This scan has to skip segments like that.
-    auto end_it = end();
-    for (; it != end_it; ++it) {
-        if (it->base_kafka_offset() > o) {
-            // On the first segment we see with a base kafka offset higher than
-            // 'o', return its previous segment.
-            return _segments.prev(it);
-        }
+    // doesn't have data batches. This lookup skips segments like that.
+    auto ix = _segments.kafka_lower_bound_index(kafka::next_offset(o));
+    if (ix == 0) {
+        // The beginning of the manifest already has a base offset that
+        // doesn't satisfy the query.
+        return end();
+    }
+    if (ix < _segments.size()) {
+        // The segment before the first one with a base kafka offset higher
+        // than 'o'.
+        return _segments.at_index(ix - 1);
     }
 
     // All segments had base kafka offsets lower than 'o'.
-    auto back = _segments.prev(end_it);
+    auto back = _segments.at_index(ix - 1);
     if (back->delta_offset_end != model::offset_delta{}) {
         // If 'prev' points to the last segment, it's not guaranteed that
         // the segment contains the required kafka offset. We need an extra
@@ -329,7 +315,7 @@ partition_manifest::segment_containing(kafka::offset o) const {
         // will return the last segment. This is OK since delta_offset_end
         // will always be set for new segments.
         if (back->next_kafka_offset() <= o) {
-            return end_it;
+            return end();
         }
     }
     return back;
@@ -417,12 +403,11 @@ void partition_manifest::flush_write_buffer() {
 
 uint64_t partition_manifest::compute_cloud_log_size() const {
     const auto& bo_col = _segments.get_base_offset_column();
-    const auto& sz_col = _segments.get_size_bytes_column();
     auto it = bo_col.find(_start_offset);
     if (it.is_end()) {
         return 0;
     }
-    return std::accumulate(sz_col.at_index(it.index()), sz_col.end(), 0);
+    return _segments.size_bytes_sum(it.index(), _segments.size());
 }
 
 uint64_t partition_manifest::cloud_log_size() const {
@@ -2035,6 +2020,7 @@ ss::future<iobuf> partition_manifest::serialize_buf() const {
 
 void partition_manifest::serialize_json(
   std::ostream& out, bool include_segments) const {
+    ssx::task_slice slice("manifest_serialize");
     serialization_cursor_ptr c = make_cursor(out);
     serialize_begin(c);
     if (include_segments) {
@@ -2057,7 +2043,10 @@ partition_manifest::serialize_json(ss::output_stream<char>& output) const {
     serialization_cursor_ptr c = make_cursor(os);
     serialize_begin(c);
     while (!c->segments_done) {
-        serialize_segments(c);
+        {
+            ssx::task_slice slice("manifest_serialize");
+            serialize_segments(c);
+        }
 
         co_await write_iobuf_to_output_stream(
           serialized.share(0, serialized.size_bytes()), output);
@@ -2477,16 +2466,9 @@ partition_manifest::timequery(model::timestamp t) const {
       base_t,
       max_t);
 
-    auto base_timestamp = _segments.get_base_timestamp_column().begin();
-    auto max_timestamp = _segments.get_max_timestamp_column().begin();
-    size_t target_ix = 0;
-    while (!base_timestamp.is_end()) {
-        if (*max_timestamp >= t.value() || *base_timestamp > t.value()) {
-            target_ix = base_timestamp.index();
-            break;
-        }
-        ++base_timestamp;
-        ++max_timestamp;
+    auto target_ix = _segments.timestamp_lower_bound_index(t);
+    if (target_ix == _segments.size()) {
+        target_ix = 0;
     }
     return *_segments.at_index(target_ix);
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/ranged_download_source.h"
+
+#include "base/vassert.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+ranged_download_source::ranged_download_source(
+  uint64_t size, uint64_t range_size, size_t max_in_flight, fetch_range fetch)
+  : _size(size)
+  , _range_size(range_size)
+  , _max_in_flight(std::max<size_t>(max_in_flight, 1))
+  , _fetch(std::move(fetch)) {
+    vassert(_range_size > 0, "range size must be positive");
+}
+
+void ranged_download_source::dispatch() {
+    while (_in_flight.size() < _max_in_flight && _next_range_start < _size) {
+        const auto last = std::min(_next_range_start + _range_size, _size) - 1;
+        _in_flight.push_back(ss::futurize_invoke(
+          _fetch,
+          cloud_storage_clients::http_byte_range{_next_range_start, last}));
+        _next_range_start = last + 1;
+    }
+}
+
+ss::future<ss::temporary_buffer<char>> ranged_download_source::get() {
+    while (_current.empty()) {
+        dispatch();
+        if (_in_flight.empty()) {
+            co_return ss::temporary_buffer<char>{};
+        }
+        auto next = std::move(_in_flight.front());
+        _in_flight.pop_front();
+        _current = co_await std::move(next);
+        // keep the pipeline full while the range is consumed
+        dispatch();
+    }
+    auto buf = _current.begin()->share();
+    _current.pop_front();
+    co_return buf;
+}
+
+ss::future<> ranged_download_source::close() {
+    // stop dispatching, the remaining ranges are not needed
+    _next_range_start = _size;
+    while (!_in_flight.empty()) {
+        auto next = std::move(_in_flight.front());
+        _in_flight.pop_front();
+        try {
+            co_await std::move(next);
+        } catch (...) {
+            // the error of the range is reported by get() if it was consumed
+        }
+    }
+    _current.clear();
+}
+
+ss::input_stream<char> make_ranged_download_stream(
+  uint64_t size,
+  uint64_t range_size,
+  size_t max_in_flight,
+  ranged_download_source::fetch_range fetch) {
+    return ss::input_stream<char>{
+      ss::data_source{std::make_unique<ranged_download_source>(
+        size, range_size, max_in_flight, std::move(fetch))}};
+}
+
+} // namespace cloud_storage
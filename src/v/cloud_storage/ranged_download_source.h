@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cloud_storage_clients/client.h"
+
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+namespace cloud_storage {
+
+/// Data source which downloads an object as consecutive byte ranges, with
+/// several range requests in flight, and returns the ranges in order.
+///
+/// Used to hydrate a whole segment at the aggregate bandwidth of several
+/// connections while the consumer still sees a single sequential stream.
+/// At most `max_in_flight` ranges are buffered in memory at a time.
+class ranged_download_source final : public ss::data_source_impl {
+public:
+    /// Downloads the inclusive byte range of the object
+    using fetch_range = ss::noncopyable_function<ss::future<iobuf>(
+      cloud_storage_clients::http_byte_range)>;
+
+    ranged_download_source(
+      uint64_t size,
+      uint64_t range_size,
+      size_t max_in_flight,
+      fetch_range fetch);
+
+    ranged_download_source(const ranged_download_source&) = delete;
+    ranged_download_source& operator=(const ranged_download_source&) = delete;
+    ranged_download_source(ranged_download_source&&) = delete;
+    ranged_download_source& operator=(ranged_download_source&&) = delete;
+    ~ranged_download_source() override = default;
+
+    ss::future<ss::temporary_buffer<char>> get() override;
+
+    /// Waits for the ranges still in flight
+    ss::future<> close() override;
+
+private:
+    /// Start range requests until max_in_flight are pending
+    void dispatch();
+
+    uint64_t _size;
+    uint64_t _range_size;
+    size_t _max_in_flight;
+    fetch_range _fetch;
+
+    uint64_t _next_range_start{0};
+    ss::circular_buffer<ss::future<iobuf>> _in_flight;
+    iobuf _current;
+};
+
+/// Create an input stream which reads the object of \p size bytes through a
+/// \ref ranged_download_source
+ss::input_stream<char> make_ranged_download_stream(
+  uint64_t size,
+  uint64_t range_size,
+  size_t max_in_flight,
+  ranged_download_source::fetch_range fetch);
+
+} // namespace cloud_storage
@@ -475,6 +475,15 @@ ss::future<download_result> remote::object_exists(
       bucket, path, parent, fmt::to_string(object_type));
 }
 
+ss::future<cloud_io::remote::head_object_result> remote::head_object(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  retry_chain_node& parent,
+  existence_check_type object_type) {
+    co_return co_await io().head_object(
+      bucket, path, parent, fmt::to_string(object_type));
+}
+
 ss::future<download_result> remote::segment_exists(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& segment_path,
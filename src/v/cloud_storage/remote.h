@@ -330,6 +330,13 @@ public:
       retry_chain_node& parent,
       existence_check_type object_type) override;
 
+    /// Same as object_exists, also returns the size and etag of the object
+    ss::future<cloud_io::remote::head_object_result> head_object(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      retry_chain_node& parent,
+      existence_check_type object_type);
+
     /// Checks if the segment exists in the bucket
     ss::future<download_result> segment_exists(
       const cloud_storage_clients::bucket_name& bucket,
@@ -16,9 +16,12 @@
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/download_exception.h"
 #include "cloud_storage/logger.h"
+#include "cloud_storage/materialized_resources.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/ranged_download_source.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/segment_chunk_data_source.h"
+#include "cloud_storage/segment_frames.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "config/configuration.h"
@@ -478,6 +481,15 @@ ss::future<> remote_segment::do_hydrate_segment() {
       _size + storage::segment_index::estimate_size(_size), 1);
 
     track_hydration t{_ts_probe};
+
+    const auto parallel_ranges
+      = config::shard_local_cfg().cloud_storage_hydration_parallel_ranges();
+    if (parallel_ranges > 1 && _size > _chunk_size) {
+        co_await do_hydrate_segment_in_ranges(
+          reservation, parallel_ranges, local_rtc);
+        co_return;
+    }
+
     auto res = co_await _api.download_segment(
       _bucket,
       _path,
@@ -501,6 +513,48 @@ ss::future<> remote_segment::do_hydrate_segment() {
     }
 }
 
+ss::future<> remote_segment::do_hydrate_segment_in_ranges(
+  space_reservation_guard& reservation,
+  size_t parallel_ranges,
+  retry_chain_node& rtc) {
+    vlog(
+      _ctxlog.debug,
+      "Hydrating segment {} of {} bytes in ranges of {} bytes, {} in flight",
+      _path,
+      _size,
+      _chunk_size,
+      parallel_ranges);
+
+    // Ranges are downloaded in the background and handed over in order, so
+    // the cache and the index builder still consume a single stream.
+    auto fetch = [this, &rtc](cloud_storage_clients::http_byte_range range)
+      -> ss::future<iobuf> {
+        iobuf buf;
+        auto res = co_await _api.download_segment(
+          _bucket,
+          _path,
+          [&buf](uint64_t, ss::input_stream<char> s) -> ss::future<uint64_t> {
+              // a retried download starts over
+              buf.clear();
+              auto out = make_iobuf_ref_output_stream(buf);
+              co_await ss::copy(s, out).finally([&s] { return s.close(); });
+              co_return buf.size_bytes();
+          },
+          rtc,
+          range);
+        if (res != download_result::success) {
+            throw download_exception(res, _path);
+        }
+        co_return buf;
+    };
+
+    co_await put_segment_in_cache_and_create_index(
+      _size,
+      reservation,
+      make_ranged_download_stream(
+        _size, _chunk_size, parallel_ranges, std::move(fetch)));
+}
+
 ss::future<> remote_segment::do_hydrate_index() {
     retry_chain_node local_rtc(
       cache_hydration_timeout, cache_hydration_backoff, &_rtc);
@@ -1075,6 +1129,13 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
         co_return;
     }
 
+    co_await _cache.download_once(path_to_start, [this, start_offset] {
+        return do_hydrate_chunk(start_offset);
+    });
+}
+
+ss::future<>
+remote_segment::do_hydrate_chunk(chunk_start_offset_t start_offset) {
     retry_chain_node rtc{
       cache_hydration_timeout, cache_hydration_backoff, &_rtc};
 
@@ -1087,11 +1148,24 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
     auto measurement = _ts_probe.chunk_hydration_latency();
     track_hydration t{_ts_probe};
 
+    // A compressed segment is downloaded in whole frames. The chunk is stored
+    // in the cache decompressed, so the readers don't need to know about it.
+    std::optional<segment_frame_index::frame_range> frames;
+    if (_index && _index->frame_index()) {
+        frames = _index->frame_index()->to_frame_range(
+          byte_range.first, byte_range.second);
+        byte_range = frames->compressed_bytes;
+    }
+
     auto res = co_await _api.download_segment(
       _bucket,
       _path,
-      [this, start_offset, &reserved](
+      [this, start_offset, &reserved, &frames](
         auto size, auto stream) -> ss::future<unsigned long> {
+          if (frames.has_value()) {
+              stream = make_frame_decompression_stream(
+                std::move(stream), _index->frame_index().value(), *frames);
+          }
           return put_chunk_in_cache(reserved, std::move(stream), start_offset)
             .then([size] { return size; });
       },
@@ -1107,6 +1181,34 @@ ss::future<> remote_segment::hydrate_chunk(chunk_start_offset_t start_offset) {
     _ts_probe.on_chunks_hydration(1);
 }
 
+std::optional<iobuf>
+remote_segment::get_chunk_from_memory(chunk_start_offset_t chunk_start) {
+    auto* tier = _api.materialized().get_chunk_memory_cache();
+    if (tier == nullptr) {
+        return std::nullopt;
+    }
+    return tier->get(get_path_to_chunk(chunk_start).native());
+}
+
+bool remote_segment::chunk_memory_tier_admits(
+  chunk_start_offset_t chunk_start) const {
+    const auto* tier = _api.materialized().get_chunk_memory_cache();
+    if (tier == nullptr || !_chunks_api) {
+        return false;
+    }
+    const auto [first, last] = _chunks_api->get_byte_range_for_chunk(
+      chunk_start, _size - 1);
+    return tier->admits(last - first + 1);
+}
+
+void remote_segment::put_chunk_in_memory(
+  chunk_start_offset_t chunk_start, iobuf data) {
+    if (auto* tier = _api.materialized().get_chunk_memory_cache();
+        tier != nullptr) {
+        tier->put(get_path_to_chunk(chunk_start).native(), std::move(data));
+    }
+}
+
 ss::future<ss::file>
 remote_segment::materialize_chunk(chunk_start_offset_t chunk_start) {
     auto res = co_await _cache.get(get_path_to_chunk(chunk_start));
@@ -1662,7 +1764,10 @@ ss::future<> hydration_loop_state::hydrate(size_t wait_list_size) {
               state.path_kind,
               state.path,
               wait_list_size);
-            fs.push_back(state.hydrate_action());
+            // Another shard may be reading the same segment, download it
+            // only once per node.
+            fs.push_back(_cache.download_once(
+              state.path, [&state] { return state.hydrate_action(); }));
             break;
         case cache_element_status::in_progress:
             // Ths means that we have two remote_segment instances running
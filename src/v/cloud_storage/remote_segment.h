@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/partition_manifest.h"
@@ -182,6 +183,18 @@ public:
 
     size_t concurrency() { return _api.concurrency(); }
 
+    /// Returns the data of the chunk if it is held by the in-memory chunk
+    /// tier.
+    std::optional<iobuf> get_chunk_from_memory(chunk_start_offset_t chunk_start);
+
+    /// True if the in-memory chunk tier is enabled and would keep the chunk
+    /// starting at the given offset.
+    bool chunk_memory_tier_admits(chunk_start_offset_t chunk_start) const;
+
+    /// Adds the data of a chunk, fully read from the disk cache, to the
+    /// in-memory chunk tier.
+    void put_chunk_in_memory(chunk_start_offset_t chunk_start, iobuf data);
+
 private:
     /// get a file offset for the corresponding kafka offset
     /// if the index is available
@@ -207,6 +220,11 @@ private:
     /// to the cache dir and updates the segment index.
     ss::future<> do_hydrate_segment();
 
+    /// Hydrate the segment with up to \p parallel_ranges concurrent byte
+    /// range requests of one chunk each.
+    ss::future<> do_hydrate_segment_in_ranges(
+      space_reservation_guard&, size_t parallel_ranges, retry_chain_node&);
+
     /// Helper for do_hydrate_segment
     ss::future<uint64_t> put_segment_in_cache_and_create_index(
       uint64_t, space_reservation_guard&, ss::input_stream<char>);
@@ -227,6 +245,9 @@ private:
 
     ss::future<> do_hydrate_index();
 
+    /// Download a chunk into the cache, helper for hydrate_chunk
+    ss::future<> do_hydrate_chunk(chunk_start_offset_t start_offset);
+
     /// Materilize segment. Segment has to be hydrated beforehand. The
     /// 'materialization' process opens file handle and creates
     /// compressed segment index in memory.
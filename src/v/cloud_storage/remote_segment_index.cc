@@ -15,8 +15,12 @@
 #include "raft/consensus.h"
 #include "serde/rw/envelope.h"
 #include "serde/rw/iobuf.h"
+#include "serde/rw/optional.h"
 #include "serde/rw/vector.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace cloud_storage {
 
 offset_index::offset_index(
@@ -42,7 +46,9 @@ offset_index::offset_index(
 
 size_t offset_index::estimate_memory_use() const {
     return _file_index.mem_use() + _rp_index.mem_use() + _kaf_index.mem_use()
-           + _time_index.mem_use();
+           + _time_index.mem_use()
+           + (_frames ? _frames->num_frames() * sizeof(uint64_t) : 0)
+           + _pages.capacity() * sizeof(page);
 }
 
 void offset_index::add(
@@ -75,20 +81,161 @@ void offset_index::add(
         _file_index = foffset_encoder_t(
           _initial_file_pos, delta_delta_t(_min_file_pos_step));
         _time_index = encoder_t(_initial_time.value());
+        reset_pages();
         throw;
     }
 }
 
+void offset_index::reset_pages() {
+    _pages.clear();
+    _paged_rows = std::nullopt;
+}
+
+void offset_index::maybe_build_pages() {
+    const auto row_count = _rp_index.get_row_count();
+    if (_paged_rows == row_count) {
+        return;
+    }
+    decoder_t rp_dec(
+      _rp_index.get_initial_value(), row_count, _rp_index.share());
+    decoder_t kaf_dec(
+      _kaf_index.get_initial_value(), row_count, _kaf_index.share());
+    foffset_decoder_t file_dec(
+      _file_index.get_initial_value(),
+      row_count,
+      _file_index.share(),
+      delta_delta_t(_min_file_pos_step));
+    decoder_t time_dec(
+      _time_index.get_initial_value(), row_count, _time_index.share());
+
+    std::array<int64_t, num_columns> running_max{};
+    running_max.fill(std::numeric_limits<int64_t>::min());
+    uint32_t first_row = 0;
+    // The columns are append only, pages which were built before stay
+    // valid. Only the last page can be incomplete, it is decoded again.
+    if (!_pages.empty()) {
+        const auto last = _pages.back();
+        _pages.pop_back();
+        if (!_pages.empty()) {
+            running_max = _pages.back().running_max;
+        }
+        rp_dec.skip(last.pos.at(static_cast<size_t>(column::rp)));
+        kaf_dec.skip(last.pos.at(static_cast<size_t>(column::kaf)));
+        file_dec.skip(last.pos.at(static_cast<size_t>(column::file)));
+        time_dec.skip(last.pos.at(static_cast<size_t>(column::time)));
+        first_row = last.pos.at(static_cast<size_t>(column::rp)).num_rows;
+    }
+    _pages.reserve((row_count + rows_per_page - 1) / rows_per_page);
+
+    std::array<std::array<int64_t, buffer_depth>, num_columns> rows{};
+    auto row = [&rows](column c) -> std::array<int64_t, buffer_depth>& {
+        return rows.at(static_cast<size_t>(c));
+    };
+    for (uint32_t r = first_row; r < row_count; ++r) {
+        if (r % rows_per_page == 0) {
+            _pages.push_back(page{
+              .pos = {
+                rp_dec.get_position(),
+                kaf_dec.get_position(),
+                file_dec.get_position(),
+                time_dec.get_position()},
+            });
+        }
+        rows = {};
+        bool ok = rp_dec.read(row(column::rp))
+                  && kaf_dec.read(row(column::kaf))
+                  && file_dec.read(row(column::file))
+                  && time_dec.read(row(column::time));
+        vassert(ok, "Inconsistent index state");
+        for (size_t c = 0; c < num_columns; ++c) {
+            running_max.at(c) = std::max(
+              running_max.at(c), std::ranges::max(rows.at(c)));
+        }
+        _pages.back().running_max = running_max;
+    }
+    _paged_rows = row_count;
+}
+
+deltafor_decoder<int64_t>
+offset_index::decoder_at(column col, const page& p) const {
+    const encoder_t* enc = nullptr;
+    switch (col) {
+    case column::rp:
+        enc = &_rp_index;
+        break;
+    case column::kaf:
+        enc = &_kaf_index;
+        break;
+    case column::time:
+        enc = &_time_index;
+        break;
+    case column::file:
+        vassert(false, "File positions are not a search column");
+    }
+    decoder_t dec(enc->get_initial_value(), enc->get_row_count(), enc->share());
+    dec.skip(p.pos.at(static_cast<size_t>(col)));
+    return dec;
+}
+
+std::optional<offset_index::index_value>
+offset_index::find_under(column col, int64_t upper_bound) {
+    maybe_build_pages();
+    if (_pages.empty()) {
+        return std::nullopt;
+    }
+    const auto c = static_cast<size_t>(col);
+    // first page with an element which isn't lower than the upper bound
+    auto it = std::partition_point(
+      _pages.begin(), _pages.end(), [c, upper_bound](const page& p) {
+          return p.running_max.at(c) < upper_bound;
+      });
+    if (it == _pages.end()) {
+        // all encoded elements are lower, return the last one
+        auto max_index = _rp_index.get_row_count() * buffer_depth - 1;
+        return index_value{.ix = max_index, .value = fetch_ix(col, max_index)};
+    }
+    // the result can be the last element of the previous page
+    if (it != _pages.begin()) {
+        it = std::prev(it);
+    }
+    auto res = _find_under(decoder_at(col, *it), upper_bound);
+    if (res) {
+        res->ix += it->pos.at(c).num_rows * buffer_depth;
+    }
+    return res;
+}
+
+int64_t offset_index::fetch_ix(column col, size_t ix) const {
+    vassert(
+      _paged_rows == _rp_index.get_row_count(),
+      "Index pages are not up to date");
+    const auto& p = _pages.at(ix / (rows_per_page * buffer_depth));
+    const auto c = static_cast<size_t>(col);
+    auto local_ix = ix - p.pos.at(c).num_rows * buffer_depth;
+    std::optional<int64_t> res;
+    if (col == column::file) {
+        foffset_decoder_t dec(
+          _file_index.get_initial_value(),
+          _file_index.get_row_count(),
+          _file_index.share(),
+          delta_delta_t(_min_file_pos_step));
+        dec.skip(p.pos.at(c));
+        res = _fetch_ix(std::move(dec), local_ix);
+    } else {
+        res = _fetch_ix(decoder_at(col, p), local_ix);
+    }
+    vassert(res.has_value(), "Inconsistent index state");
+    return *res;
+}
+
 std::
   variant<std::monostate, offset_index::index_value, offset_index::find_result>
   offset_index::maybe_find_offset(
     int64_t upper_bound,
-    deltafor_encoder<int64_t>& encoder,
+    column col,
     const std::array<int64_t, buffer_depth>& write_buffer) {
-    deltafor_decoder<int64_t> decoder(
-      encoder.get_initial_value(), encoder.get_row_count(), encoder.share());
-    auto max_index = encoder.get_row_count() * details::FOR_buffer_depth - 1;
-    auto maybe_ix = _find_under(std::move(decoder), upper_bound);
+    auto max_index = _rp_index.get_row_count() * details::FOR_buffer_depth - 1;
+    auto maybe_ix = find_under(col, upper_bound);
     if (!maybe_ix || maybe_ix->ix == max_index) {
         auto ixend = _pos & index_mask;
         std::optional<find_result> candidate;
@@ -121,65 +268,37 @@ std::
 
 std::optional<offset_index::find_result>
 offset_index::find_rp_offset(model::offset upper_bound) {
-    auto search_result = maybe_find_offset(upper_bound, _rp_index, _rp_offsets);
+    auto search_result = maybe_find_offset(
+      upper_bound(), column::rp, _rp_offsets);
 
     return ss::visit(
       search_result,
       [](std::monostate) -> std::optional<find_result> { return std::nullopt; },
       [](find_result result) -> std::optional<find_result> { return result; },
       [this](index_value index_result) -> std::optional<find_result> {
-          find_result res{};
-
-          size_t ix = index_result.ix;
-          res.rp_offset = model::offset(index_result.value);
-
-          decoder_t kaf_dec(
-            _kaf_index.get_initial_value(),
-            _kaf_index.get_row_count(),
-            _kaf_index.copy());
-          auto kaf_offset = _fetch_ix(std::move(kaf_dec), ix);
-          vassert(kaf_offset.has_value(), "Inconsistent index state");
-          res.kaf_offset = kafka::offset(*kaf_offset);
-          foffset_decoder_t file_dec(
-            _file_index.get_initial_value(),
-            _file_index.get_row_count(),
-            _file_index.copy(),
-            delta_delta_t(_min_file_pos_step));
-          auto file_pos = _fetch_ix(std::move(file_dec), ix);
-          res.file_pos = *file_pos;
-          return res;
+          return find_result{
+            .rp_offset = model::offset(index_result.value),
+            .kaf_offset = kafka::offset(
+              fetch_ix(column::kaf, index_result.ix)),
+            .file_pos = fetch_ix(column::file, index_result.ix),
+          };
       });
 }
 
 std::optional<offset_index::find_result>
 offset_index::find_kaf_offset(kafka::offset upper_bound) {
     auto search_result = maybe_find_offset(
-      upper_bound, _kaf_index, _kaf_offsets);
+      upper_bound(), column::kaf, _kaf_offsets);
     return ss::visit(
       search_result,
       [](std::monostate) -> std::optional<find_result> { return std::nullopt; },
       [](find_result result) -> std::optional<find_result> { return result; },
       [this](index_value index_result) -> std::optional<find_result> {
-          find_result res{};
-
-          size_t ix = index_result.ix;
-          res.kaf_offset = kafka::offset(index_result.value);
-
-          decoder_t rp_dec(
-            _rp_index.get_initial_value(),
-            _rp_index.get_row_count(),
-            _rp_index.copy());
-          auto rp_offset = _fetch_ix(std::move(rp_dec), ix);
-          vassert(rp_offset.has_value(), "Inconsistent index state");
-          res.rp_offset = model::offset(*rp_offset);
-          foffset_decoder_t file_dec(
-            _file_index.get_initial_value(),
-            _file_index.get_row_count(),
-            _file_index.copy(),
-            delta_delta_t(_min_file_pos_step));
-          auto file_pos = _fetch_ix(std::move(file_dec), ix);
-          res.file_pos = *file_pos;
-          return res;
+          return find_result{
+            .rp_offset = model::offset(fetch_ix(column::rp, index_result.ix)),
+            .kaf_offset = kafka::offset(index_result.value),
+            .file_pos = fetch_ix(column::file, index_result.ix),
+          };
       });
 }
 
@@ -192,42 +311,19 @@ offset_index::find_timestamp(model::timestamp upper_bound) {
     }
 
     auto search_result = maybe_find_offset(
-      upper_bound.value(), _time_index, _time_offsets);
+      upper_bound.value(), column::time, _time_offsets);
 
     return ss::visit(
       search_result,
       [](std::monostate) -> std::optional<find_result> { return std::nullopt; },
       [](find_result result) -> std::optional<find_result> { return result; },
       [this](index_value index_result) -> std::optional<find_result> {
-          size_t ix = index_result.ix;
-
-          // Decode all offset indices to build up the result.
-          decoder_t rp_dec(
-            _rp_index.get_initial_value(),
-            _rp_index.get_row_count(),
-            _rp_index.copy());
-          auto rp_offset = _fetch_ix(std::move(rp_dec), ix);
-          vassert(rp_offset.has_value(), "Inconsistent index state");
-
-          decoder_t kaf_dec(
-            _kaf_index.get_initial_value(),
-            _kaf_index.get_row_count(),
-            _kaf_index.copy());
-          auto kaf_offset = _fetch_ix(std::move(kaf_dec), ix);
-          vassert(kaf_offset.has_value(), "Inconsistent index state");
-
-          foffset_decoder_t file_dec(
-            _file_index.get_initial_value(),
-            _file_index.get_row_count(),
-            _file_index.copy(),
-            delta_delta_t(_min_file_pos_step));
-          auto file_pos = _fetch_ix(std::move(file_dec), ix);
-          vassert(file_pos.has_value(), "Inconsistent index state");
-
+          // Decode the offset columns of the page to build up the result.
           return offset_index::find_result{
-            .rp_offset = model::offset(*rp_offset),
-            .kaf_offset = kafka::offset(*kaf_offset),
-            .file_pos = *file_pos};
+            .rp_offset = model::offset(fetch_ix(column::rp, index_result.ix)),
+            .kaf_offset = kafka::offset(
+              fetch_ix(column::kaf, index_result.ix)),
+            .file_pos = fetch_ix(column::file, index_result.ix)};
       });
 }
 
@@ -248,14 +344,14 @@ offset_index::coarse_index_t offset_index::build_coarse_index(
     foffset_decoder_t file_dec(
       _file_index.get_initial_value(),
       _file_index.get_row_count(),
-      _file_index.copy(),
+      _file_index.share(),
       delta_delta_t(_min_file_pos_step));
     std::array<int64_t, buffer_depth> file_row{};
 
     decoder_t kaf_dec(
       _kaf_index.get_initial_value(),
       _kaf_index.get_row_count(),
-      _kaf_index.copy());
+      _kaf_index.share());
     std::array<int64_t, buffer_depth> kafka_row{};
 
     coarse_index_t index;
@@ -299,7 +395,7 @@ offset_index::coarse_index_t offset_index::build_coarse_index(
 struct offset_index_header
   : serde::envelope<
       offset_index_header,
-      serde::version<2>,
+      serde::version<3>,
       serde::compat_version<1>> {
     int64_t min_file_pos_step;
     uint64_t num_elements;
@@ -322,6 +418,9 @@ struct offset_index_header
     std::vector<int64_t> time_write_buf;
     iobuf time_index;
 
+    // Version 3 fields
+    std::optional<segment_frame_index> frames;
+
     auto serde_fields() {
         return std::tie(
           min_file_pos_step,
@@ -341,7 +440,8 @@ struct offset_index_header
           base_time,
           last_time,
           time_write_buf,
-          time_index);
+          time_index,
+          frames);
     }
 };
 
@@ -368,7 +468,8 @@ iobuf offset_index::to_iobuf() const {
       .last_time = _time_index.get_last_value(),
       .time_write_buf = std::vector<int64_t>(
         _time_offsets.begin(), _time_offsets.end()),
-      .time_index = _time_index.copy()};
+      .time_index = _time_index.copy(),
+      .frames = _frames};
     return serde::to_iobuf(std::move(hdr));
 }
 
@@ -410,6 +511,8 @@ void offset_index::from_iobuf(iobuf b) {
       hdr.time_write_buf.begin(),
       hdr.time_write_buf.end(),
       _time_offsets.begin());
+    _frames = std::move(hdr.frames);
+    reset_pages();
 }
 
 std::optional<offset_index::index_value>
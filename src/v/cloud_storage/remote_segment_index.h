@@ -14,6 +14,7 @@
 #include "base/units.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "cloud_storage/segment_frames.h"
 #include "model/fundamental.h"
 #include "model/record_batch_types.h"
 #include "storage/parser.h"
@@ -23,7 +24,10 @@
 
 #include <absl/container/btree_map.h>
 
+#include <array>
+#include <optional>
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
@@ -104,6 +108,16 @@ public:
     coarse_index_t
     build_coarse_index(uint64_t step_size, std::string_view index_path) const;
 
+    /// Set if the segment was uploaded compressed, file positions in the
+    /// index refer to the uncompressed segment.
+    const std::optional<segment_frame_index>& frame_index() const {
+        return _frames;
+    }
+
+    void set_frame_index(segment_frame_index frames) {
+        _frames = std::move(frames);
+    }
+
     /// Serialize offset_index
     iobuf to_iobuf() const;
 
@@ -116,16 +130,47 @@ private:
         int64_t value;
     };
 
+    enum class column : uint8_t { rp, kaf, file, time };
+    static constexpr size_t num_columns = 4;
+
+    /// Number of encoded rows in a page
+    static constexpr uint32_t rows_per_page = 8;
+
+    /// Lookups don't decode the columns from the start. The encoded rows are
+    /// split into pages and a lookup decodes a single page of every column
+    /// it needs. The page table is built from the encoded columns by the
+    /// first lookup and extended once rows were added.
+    struct page {
+        /// Position of the first row of the page in every column
+        std::array<deltafor_stream_pos_t<int64_t>, num_columns> pos;
+        /// Largest value in the column up to the end of the page
+        std::array<int64_t, num_columns> running_max;
+    };
+
+    void maybe_build_pages();
+    void reset_pages();
+
+    /// Decoder of a search column starting at the page
+    deltafor_decoder<int64_t> decoder_at(column, const page&) const;
+
+    /// Find the last element which is lower than the upper bound before the
+    /// first element which isn't. Only the page where that happens is
+    /// decoded.
+    std::optional<index_value> find_under(column, int64_t upper_bound);
+
+    /// Return element of the column by index
+    int64_t fetch_ix(column, size_t ix) const;
+
     /// Find index entry which is strictly lower than the provided value
     ///
-    /// The encoder and the write buffer have to be provided via parameters.
+    /// The column and the write buffer have to be provided via parameters.
     /// The returned value is a variant which contains a monostate if no
     /// value can be found; index_value if the value is found in the
     /// encoder; find_result if the value is found in the write buffer (in
     /// this case no further search is needed).
     std::variant<std::monostate, index_value, find_result> maybe_find_offset(
       int64_t upper_bound,
-      deltafor_encoder<int64_t>& encoder,
+      column col,
       const std::array<int64_t, buffer_depth>& write_buffer);
 
     /// Find element inside the offset range stored in the decoder which is
@@ -175,6 +220,11 @@ private:
     foffset_encoder_t _file_index;
     encoder_t _time_index;
     int64_t _min_file_pos_step;
+    std::optional<segment_frame_index> _frames;
+
+    std::vector<page> _pages;
+    /// Number of encoded rows covered by _pages
+    std::optional<uint32_t> _paged_rows;
 
     friend class offset_index_accessor;
 };
@@ -13,7 +13,9 @@
 #include "cloud_storage/logger.h"
 #include "cloud_storage/remote_segment.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 using namespace std::chrono_literals;
 
@@ -135,6 +137,15 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
           chunk.handle,
           "chunk state is hydrated without data file for id {}",
           chunk_start);
+        // Keep the prefetch window ahead of sequential readers moving through
+        // chunks that were already prefetched, otherwise they stall every
+        // `prefetch` chunks.
+        if (auto n = prefetch_override.value_or(
+              config::shard_local_cfg().cloud_storage_chunk_prefetch);
+            n > 0) {
+            schedule_prefetches(chunk_start, n);
+            _bg_cvar.signal();
+        }
         co_return chunk.handle.value();
     }
 
@@ -189,6 +200,46 @@ void segment_chunks::schedule_prefetches(
     }
 }
 
+size_t segment_chunks::prefetch_capacity() const {
+    const auto in_use = std::ranges::count_if(
+      _chunks | views::values, [](const auto& chunk) {
+          return chunk.current_state == chunk_state::hydrated
+                 || chunk.current_state == chunk_state::download_in_progress;
+      });
+    const auto used = static_cast<uint64_t>(in_use);
+    return used >= _max_hydrated_chunks ? 0 : _max_hydrated_chunks - used;
+}
+
+void segment_chunks::record_download_latency(
+  ss::lowres_clock::duration latency) {
+    // Exponential moving average with a weight of 1/8 for the new sample, the
+    // first sample seeds the average.
+    if (_download_latency == ss::lowres_clock::duration{0}) {
+        _download_latency = latency;
+    } else {
+        _download_latency = (_download_latency * 7 + latency) / 8;
+    }
+}
+
+uint16_t predict_chunk_prefetch(
+  double bytes_per_second,
+  ss::lowres_clock::duration download_latency,
+  uint64_t chunk_size,
+  uint16_t min_prefetch,
+  uint16_t max_prefetch) {
+    if (bytes_per_second <= 0 || chunk_size == 0) {
+        return min_prefetch;
+    }
+    // A reader consumes a chunk in chunk_size / bytes_per_second seconds, so
+    // it needs enough chunks in flight to cover one download latency.
+    const auto latency_s
+      = std::chrono::duration<double>(download_latency).count();
+    const auto needed = std::ceil(
+      latency_s * bytes_per_second / static_cast<double>(chunk_size));
+    return static_cast<uint16_t>(std::clamp<double>(
+      needed, min_prefetch, std::max(min_prefetch, max_prefetch)));
+}
+
 void segment_chunks::resolve_prefetch_futures() {
     auto available_it = std::ranges::partition(
       _prefetches, [](const auto& f) { return !f.available(); });
@@ -290,7 +341,9 @@ segment_chunks::do_hydrate_chunk(chunk_start_offset_t start_offset) {
     }
 
     try {
+        const auto started = ss::lowres_clock::now();
         auto handle = co_await _segment.download_chunk(start_offset);
+        record_download_latency(ss::lowres_clock::now() - started);
         vassert(
           chunk.handle == std::nullopt,
           "attempt to set file handle to chunk {} which already has a file "
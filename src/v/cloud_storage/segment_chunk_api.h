@@ -82,6 +82,16 @@ public:
     std::pair<size_t, size_t> get_byte_range_for_chunk(
       chunk_start_offset_t start_offset, size_t last_byte_in_segment) const;
 
+    /// Moving average of the time it takes to hydrate a chunk, zero until the
+    /// first chunk is hydrated.
+    ss::lowres_clock::duration download_latency() const {
+        return _download_latency;
+    }
+
+    /// Returns how many more chunks can be hydrated or scheduled for download
+    /// before the segment reaches its budget of hydrated chunks.
+    size_t prefetch_capacity() const;
+
 private:
     // Periodically closes chunk file handles for the space to be reclaimable by
     // cache eviction. The chunks are evicted when they are no longer opened for
@@ -113,6 +123,8 @@ private:
     /// extracts exceptions if any.
     void resolve_prefetch_futures();
 
+    void record_download_latency(ss::lowres_clock::duration latency);
+
     /// The chunk map holds a mapping from file offset to chunk metadata. This
     /// struct is initialized when the object starts, and will never change
     /// after this during the lifetime of this object, IE no inserts or deletes
@@ -140,8 +152,20 @@ private:
     uint64_t _max_hydrated_chunks;
     ss::condition_variable _bg_cvar;
     fragmented_vector<ss::future<segment_chunk::handle_t>> _prefetches;
+    ss::lowres_clock::duration _download_latency{0};
 };
 
+/// Returns the number of chunks to prefetch ahead of a reader consuming
+/// `bytes_per_second`, so that the download of a chunk completes before the
+/// reader is done with the chunks in front of it. The result is clamped to
+/// [min_prefetch, max(min_prefetch, max_prefetch)].
+uint16_t predict_chunk_prefetch(
+  double bytes_per_second,
+  ss::lowres_clock::duration download_latency,
+  uint64_t chunk_size,
+  uint16_t min_prefetch,
+  uint16_t max_prefetch);
+
 class chunk_eviction_strategy {
 public:
     chunk_eviction_strategy() = default;
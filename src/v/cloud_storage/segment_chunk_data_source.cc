@@ -11,7 +11,13 @@
 
 #include "cloud_storage/segment_chunk_data_source.h"
 
+#include "bytes/iostream.h"
 #include "cloud_storage/remote_segment.h"
+#include "config/configuration.h"
+
+#include <seastar/util/defer.hh>
+
+#include <algorithm>
 
 namespace cloud_storage {
 
@@ -51,6 +57,10 @@ chunk_data_source_impl::~chunk_data_source_impl() {
 ss::future<ss::temporary_buffer<char>> chunk_data_source_impl::get() {
     auto g = _gate.hold();
 
+    if (!_first_read) {
+        _first_read = ss::lowres_clock::now();
+    }
+
     if (!_current_stream) {
         co_await load_stream_for_chunk(_current_chunk_start);
         vassert(
@@ -61,26 +71,33 @@ ss::future<ss::temporary_buffer<char>> chunk_data_source_impl::get() {
     }
 
     auto buf = co_await _current_stream->read();
+    collect_for_memory_tier(buf);
     while (buf.empty() && _current_chunk_start < _last_chunk_start) {
         _current_chunk_start = _chunks.get_next_chunk_start(
           _current_chunk_start);
         co_await load_stream_for_chunk(_current_chunk_start);
         buf = co_await _current_stream->read();
+        collect_for_memory_tier(buf);
     }
 
+    _bytes_consumed += buf.size();
     co_return buf;
 }
 
 ss::future<>
 chunk_data_source_impl::load_chunk_handle(chunk_start_offset_t chunk_start) {
+    const auto started = ss::lowres_clock::now();
+    auto record_wait = ss::defer(
+      [this, started] { _hydration_wait += ss::lowres_clock::now() - started; });
     try {
+        const auto prefetch = prefetch_for_next_chunk();
         vlog(
           _ctxlog.debug,
           "Hydrating chunk {} with prefetch {}",
           chunk_start,
-          _prefetch_override);
+          prefetch);
         _current_data_file = co_await _chunks.hydrate_chunk(
-          chunk_start, _prefetch_override);
+          chunk_start, prefetch);
     } catch (const ss::abort_requested_exception& ex) {
         throw;
     } catch (const ss::gate_closed_exception& ex) {
@@ -95,10 +112,86 @@ chunk_data_source_impl::load_chunk_handle(chunk_start_offset_t chunk_start) {
     }
 }
 
+std::optional<uint16_t>
+chunk_data_source_impl::prefetch_for_next_chunk() const {
+    const auto& cfg = config::shard_local_cfg();
+    const auto max_prefetch = cfg.cloud_storage_chunk_prefetch_max();
+    if (_prefetch_override.has_value() || max_prefetch == 0 || !_first_read) {
+        return _prefetch_override;
+    }
+
+    const auto active = ss::lowres_clock::now() - *_first_read
+                        - _hydration_wait;
+    if (active <= ss::lowres_clock::duration{0} || _bytes_consumed == 0) {
+        return std::nullopt;
+    }
+
+    const auto bytes_per_second = static_cast<double>(_bytes_consumed)
+                                  / std::chrono::duration<double>(active)
+                                      .count();
+    const auto min_prefetch = cfg.cloud_storage_chunk_prefetch();
+    const auto predicted = predict_chunk_prefetch(
+      bytes_per_second,
+      _chunks.download_latency(),
+      cfg.cloud_storage_cache_chunk_size(),
+      min_prefetch,
+      max_prefetch);
+
+    // Prefetch beyond the configured minimum only while the segment has
+    // budget for more hydrated chunks.
+    const auto capacity = _chunks.prefetch_capacity();
+    return std::max<uint16_t>(
+      min_prefetch,
+      static_cast<uint16_t>(std::min<size_t>(predicted, capacity)));
+}
+
+void chunk_data_source_impl::collect_for_memory_tier(
+  ss::temporary_buffer<char>& buf) {
+    if (!_memory_tier_data) {
+        return;
+    }
+    if (!buf.empty()) {
+        _memory_tier_data->append(buf.share());
+        return;
+    }
+    // The chunk was read to the end, so the collected data is the whole chunk
+    _segment.put_chunk_in_memory(
+      _current_chunk_start, std::move(*_memory_tier_data));
+    _memory_tier_data.reset();
+}
+
+uint64_t chunk_data_source_impl::stream_begin() const {
+    // The first read of the data source begins at _begin_stream_at. This is
+    // necessary because the remote segment reader which uses this data source
+    // sets a delta before reading, and the remote segment consumer which
+    // consumes data from this source expects all offsets to be below the delta.
+    // Setting the appropriate start offset on the stream makes sure that we do
+    // not break that assertion.
+    if (_current_chunk_start == _first_chunk_start) {
+        return _begin_stream_at;
+    }
+    return 0;
+}
+
 ss::future<> chunk_data_source_impl::load_stream_for_chunk(
   chunk_start_offset_t chunk_start) {
     vlog(_ctxlog.debug, "loading stream for chunk starting at {}", chunk_start);
 
+    _memory_tier_data.reset();
+    if (auto data = _segment.get_chunk_from_memory(chunk_start); data) {
+        vlog(
+          _ctxlog.trace,
+          "serving chunk at {} from the memory tier",
+          chunk_start);
+        _chunks.mark_acquired_and_update_stats(
+          _current_chunk_start, _last_chunk_start);
+        co_await maybe_close_stream();
+        _current_data_file = nullptr;
+        data->trim_front(stream_begin());
+        _current_stream = make_iobuf_input_stream(std::move(*data));
+        co_return;
+    }
+
     std::exception_ptr eptr;
 
     try {
@@ -132,16 +225,7 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
         co_await _current_stream->close();
     }
 
-    // The first read of the data source begins at _begin_stream_at. This is
-    // necessary because the remote segment reader which uses this data source
-    // sets a delta before reading, and the remote segment consumer which
-    // consumes data from this source expects all offsets to be below the delta.
-    // Setting the appropriate start offset on the file stream makes sure that
-    // we do not break that assertion.
-    uint64_t begin = 0;
-    if (_current_chunk_start == _first_chunk_start) {
-        begin = _begin_stream_at;
-    }
+    const auto begin = stream_begin();
     vlog(
       _ctxlog.trace,
       "creating stream for chunk at {}, begin at {}",
@@ -150,6 +234,12 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
 
     _current_stream = ss::make_file_input_stream(
       *_current_data_file, begin, _stream_options);
+
+    // Collect the data of chunks read from the start, so that the next readers
+    // of the chunk are served from memory.
+    if (begin == 0 && _segment.chunk_memory_tier_admits(chunk_start)) {
+        _memory_tier_data.emplace();
+    }
 }
 
 ss::future<> chunk_data_source_impl::close() {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "cloud_storage/segment_chunk_api.h"
 #include "model/fundamental.h"
 
@@ -51,6 +52,20 @@ private:
     ss::future<> maybe_close_stream();
     ss::future<> load_chunk_handle(chunk_start_offset_t chunk_start);
 
+    // Returns the number of chunks to prefetch when hydrating the next chunk.
+    // Unless overridden, this is sized from the rate at which the reader
+    // consumes data and the chunk download latency, so that sequential
+    // readers do not wait for chunks. Returns nullopt to use the configured
+    // default.
+    std::optional<uint16_t> prefetch_for_next_chunk() const;
+
+    // Offset in the current chunk at which its stream starts.
+    uint64_t stream_begin() const;
+
+    // Collects the data read from the current chunk for the in-memory chunk
+    // tier, and hands it over once the chunk is read to the end.
+    void collect_for_memory_tier(ss::temporary_buffer<char>& buf);
+
     segment_chunks& _chunks;
     remote_segment& _segment;
 
@@ -70,6 +85,16 @@ private:
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
     std::optional<uint16_t> _prefetch_override;
+
+    // Consumption rate tracking. Time spent waiting for hydration is excluded
+    // so that stalls do not lower the estimated rate.
+    uint64_t _bytes_consumed{0};
+    std::optional<ss::lowres_clock::time_point> _first_read;
+    ss::lowres_clock::duration _hydration_wait{0};
+
+    // Data of the current chunk collected while reading it, set when the
+    // chunk is read from its start and fits in the in-memory chunk tier.
+    std::optional<iobuf> _memory_tier_data;
 };
 
 } // namespace cloud_storage
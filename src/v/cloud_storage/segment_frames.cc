@@ -0,0 +1,220 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_frames.h"
+
+#include "base/vassert.h"
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "compression/async_stream_zstd.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace cloud_storage {
+
+uint64_t segment_frame_index::compressed_frame_size(size_t frame) const {
+    vassert(
+      frame < compressed_ends.size(),
+      "Frame {} out of range, {} frames",
+      frame,
+      compressed_ends.size());
+    const auto begin = frame == 0 ? 0 : compressed_ends[frame - 1];
+    return compressed_ends[frame] - begin;
+}
+
+segment_frame_index::frame_range
+segment_frame_index::to_frame_range(uint64_t first, uint64_t last) const {
+    vassert(
+      first <= last && last < uncompressed_size && !compressed_ends.empty(),
+      "Invalid range [{}, {}] of a segment of {} bytes in {} frames",
+      first,
+      last,
+      uncompressed_size,
+      compressed_ends.size());
+    const auto first_frame = static_cast<size_t>(first / frame_size);
+    const auto last_frame = std::min(
+      static_cast<size_t>(last / frame_size), compressed_ends.size() - 1);
+    const auto begin = first_frame == 0 ? 0 : compressed_ends[first_frame - 1];
+    return frame_range{
+      .first_frame = first_frame,
+      .last_frame = last_frame,
+      .compressed_bytes = {begin, compressed_ends[last_frame] - 1},
+      .skip = first - first_frame * frame_size,
+      .length = last - first + 1,
+    };
+}
+
+namespace {
+
+class frame_compression_source final : public ss::data_source_impl {
+public:
+    frame_compression_source(
+      ss::input_stream<char> src, segment_frame_index& index)
+      : _src(std::move(src))
+      , _index(index)
+      , _recording(index.compressed_ends.empty()) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_current.empty()) {
+            if (_eof) {
+                co_return ss::temporary_buffer<char>{};
+            }
+            auto frame = co_await read_iobuf_exactly(_src, _index.frame_size);
+            if (frame.size_bytes() < _index.frame_size) {
+                _eof = true;
+            }
+            if (frame.empty()) {
+                finish();
+                co_return ss::temporary_buffer<char>{};
+            }
+            _uncompressed_size += frame.size_bytes();
+            _current = co_await compression::async_stream_zstd_instance()
+                         .compress(std::move(frame));
+            _compressed_size += _current.size_bytes();
+            add_frame();
+            if (_eof) {
+                finish();
+            }
+        }
+        auto buf = _current.begin()->share();
+        _current.pop_front();
+        co_return buf;
+    }
+
+    ss::future<> close() override { return _src.close(); }
+
+private:
+    void add_frame() {
+        if (_recording) {
+            _index.compressed_ends.push_back(_compressed_size);
+        } else if (
+          _frame >= _index.num_frames()
+          || _index.compressed_ends[_frame] != _compressed_size) {
+            throw std::runtime_error(fmt::format(
+              "Frame {} of the segment doesn't match the frame index, "
+              "compressed end: {}, frames in the index: {}",
+              _frame,
+              _compressed_size,
+              _index.num_frames()));
+        }
+        ++_frame;
+    }
+
+    void finish() {
+        if (_recording) {
+            _index.uncompressed_size = _uncompressed_size;
+        } else if (
+          _frame != _index.num_frames()
+          || _uncompressed_size != _index.uncompressed_size) {
+            throw std::runtime_error(fmt::format(
+              "Segment of {} bytes in {} frames doesn't match the frame "
+              "index of {} bytes in {} frames",
+              _uncompressed_size,
+              _frame,
+              _index.uncompressed_size,
+              _index.num_frames()));
+        }
+    }
+
+    ss::input_stream<char> _src;
+    segment_frame_index& _index;
+    bool _recording;
+    bool _eof{false};
+    size_t _frame{0};
+    uint64_t _uncompressed_size{0};
+    uint64_t _compressed_size{0};
+    iobuf _current;
+};
+
+class frame_decompression_source final : public ss::data_source_impl {
+public:
+    frame_decompression_source(
+      ss::input_stream<char> compressed,
+      std::vector<uint64_t> frame_sizes,
+      uint64_t skip,
+      uint64_t length)
+      : _compressed(std::move(compressed))
+      , _frame_sizes(std::move(frame_sizes))
+      , _skip(skip)
+      , _remaining(length) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_current.empty()) {
+            if (_remaining == 0 || _next_frame == _frame_sizes.size()) {
+                co_return ss::temporary_buffer<char>{};
+            }
+            const auto expected = _frame_sizes[_next_frame++];
+            auto frame = co_await read_iobuf_exactly(_compressed, expected);
+            if (frame.size_bytes() != expected) {
+                throw std::runtime_error(fmt::format(
+                  "Compressed frame truncated, expected {} bytes, got {}",
+                  expected,
+                  frame.size_bytes()));
+            }
+            auto data = co_await compression::async_stream_zstd_instance()
+                          .uncompress(std::move(frame));
+            if (_skip > 0) {
+                const auto n = std::min(_skip, data.size_bytes());
+                data.trim_front(n);
+                _skip -= n;
+            }
+            if (data.size_bytes() > _remaining) {
+                data.trim_back(data.size_bytes() - _remaining);
+            }
+            _remaining -= data.size_bytes();
+            _current = std::move(data);
+        }
+        auto buf = _current.begin()->share();
+        _current.pop_front();
+        co_return buf;
+    }
+
+    ss::future<> close() override { return _compressed.close(); }
+
+private:
+    ss::input_stream<char> _compressed;
+    std::vector<uint64_t> _frame_sizes;
+    size_t _next_frame{0};
+    uint64_t _skip;
+    uint64_t _remaining;
+    iobuf _current;
+};
+
+} // namespace
+
+ss::input_stream<char> make_frame_compression_stream(
+  ss::input_stream<char> src, segment_frame_index& index) {
+    return ss::input_stream<char>{ss::data_source{
+      std::make_unique<frame_compression_source>(std::move(src), index)}};
+}
+
+ss::input_stream<char> make_frame_decompression_stream(
+  ss::input_stream<char> compressed,
+  const segment_frame_index& index,
+  segment_frame_index::frame_range range) {
+    std::vector<uint64_t> frame_sizes;
+    frame_sizes.reserve(range.last_frame - range.first_frame + 1);
+    for (auto frame = range.first_frame; frame <= range.last_frame; ++frame) {
+        frame_sizes.push_back(index.compressed_frame_size(frame));
+    }
+    return ss::input_stream<char>{
+      ss::data_source{std::make_unique<frame_decompression_source>(
+        std::move(compressed),
+        std::move(frame_sizes),
+        range.skip,
+        range.length)}};
+}
+
+} // namespace cloud_storage
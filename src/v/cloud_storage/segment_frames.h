@@ -0,0 +1,97 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/units.h"
+#include "cloud_storage_clients/client.h"
+#include "serde/envelope.h"
+
+#include <seastar/core/iostream.hh>
+
+#include <cstdint>
+#include <vector>
+
+namespace cloud_storage {
+
+/// Amount of segment data compressed into a single frame. Frames are
+/// independent zstd frames, so any byte range of the segment can be read by
+/// downloading and decompressing the frames which overlap it.
+inline constexpr uint64_t segment_frame_size = 1_MiB;
+
+/// Layout of a segment uploaded as a sequence of independent zstd frames.
+///
+/// Frame N holds bytes [N * frame_size, (N + 1) * frame_size) of the original
+/// segment, so positions stored in the remote_segment_index and the chunk
+/// boundaries derived from them keep referring to the uncompressed segment.
+/// The index is stored as a part of the remote segment index.
+struct segment_frame_index
+  : serde::envelope<
+      segment_frame_index,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    /// Uncompressed size of every frame except the last one
+    uint64_t frame_size{segment_frame_size};
+    /// Size of the original segment
+    uint64_t uncompressed_size{0};
+    /// Position in the uploaded object where each frame ends
+    std::vector<uint64_t> compressed_ends;
+
+    auto serde_fields() {
+        return std::tie(frame_size, uncompressed_size, compressed_ends);
+    }
+
+    bool operator==(const segment_frame_index&) const = default;
+
+    size_t num_frames() const { return compressed_ends.size(); }
+
+    /// Size of the uploaded object
+    uint64_t compressed_size() const {
+        return compressed_ends.empty() ? 0 : compressed_ends.back();
+    }
+
+    uint64_t compressed_frame_size(size_t frame) const;
+
+    /// Frames which contain a range of the original segment
+    struct frame_range {
+        size_t first_frame;
+        size_t last_frame;
+        /// Inclusive byte range of the frames in the uploaded object
+        cloud_storage_clients::http_byte_range compressed_bytes;
+        /// Number of decompressed bytes to skip at the start of first_frame
+        uint64_t skip;
+        /// Number of decompressed bytes which belong to the range
+        uint64_t length;
+    };
+
+    /// Map the inclusive range [first, last] of the original segment
+    /// to the frames which contain it.
+    frame_range to_frame_range(uint64_t first, uint64_t last) const;
+};
+
+/// Compress the segment \p src into consecutive frames.
+///
+/// If \p index has no frames, the compressed size of each frame is recorded
+/// in it. Otherwise the stream is compressed for a known layout (e.g. when an
+/// upload is retried) and it fails if the output doesn't match the index.
+///
+/// The index must outlive the stream.
+ss::input_stream<char> make_frame_compression_stream(
+  ss::input_stream<char> src, segment_frame_index& index);
+
+/// Decompress the frames of \p range read from \p compressed, which starts
+/// at the beginning of range.first_frame. The stream yields only the
+/// requested bytes of the original segment.
+ss::input_stream<char> make_frame_decompression_stream(
+  ss::input_stream<char> compressed,
+  const segment_frame_index& index,
+  segment_frame_index::frame_range range);
+
+} // namespace cloud_storage
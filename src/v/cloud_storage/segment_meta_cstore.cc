@@ -22,8 +22,12 @@
 #include <functional>
 #include <limits>
 #include <new>
+#include <numeric>
+#include <span>
 #include <stdexcept>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace cloud_storage {
 
@@ -227,6 +231,42 @@ class column_store
       "segment_meta has a field that is not in segment_meta_accessors. check "
       "also that the members of column_store match the members of "
       "segment_meta");
+
+    /// Decode the columns a frame at a time starting from index 'begin_ix'
+    /// and invoke 'fn' with the index of the first decoded value followed by
+    /// the decoded values of every column. All columns of the store share
+    /// frame boundaries so the spans have the same size. Iteration stops when
+    /// 'fn' returns ss::stop_iteration::yes.
+    template<class Fn, class... Col>
+    static void scan_frames(size_t begin_ix, Fn fn, const Col&... cols) {
+        std::array<std::vector<int64_t>, sizeof...(Col)> buffers;
+        auto frames = std::make_tuple(cols._frames.begin()...);
+        const auto lead_end = std::get<0>(std::tie(cols...))._frames.end();
+        size_t first_ix = 0;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            while (std::get<0>(frames) != lead_end) {
+                const auto frame_size = std::get<0>(frames)->size();
+                if (first_ix + frame_size > begin_ix) {
+                    vassert(
+                      ((std::get<I>(frames)->size() == frame_size) && ...),
+                      "Column frames are not aligned at index {}",
+                      first_ix);
+                    const auto skip = begin_ix > first_ix ? begin_ix - first_ix
+                                                          : 0;
+                    (buffers[I].resize(frame_size), ...);
+                    (std::get<I>(frames)->decode_into(buffers[I]), ...);
+                    if (
+                      fn(first_ix + skip,
+                         std::span<const int64_t>(buffers[I]).subspan(skip)...)
+                      == ss::stop_iteration::yes) {
+                        return;
+                    }
+                }
+                first_ix += frame_size;
+                (++std::get<I>(frames), ...);
+            }
+        }(std::index_sequence_for<Col...>{});
+    }
     /**
      * private constructor used to create a store that share the underlying
      * buffers with another store
@@ -699,6 +739,75 @@ public:
 
     size_t size() const { return _base_offset.size(); }
 
+    /// Index of the first segment with base kafka offset >= ko
+    size_t kafka_lower_bound_index(int64_t ko) const {
+        // Kafka offset is always <= log offset, segments before the log
+        // offset lower bound can be skipped without decoding them.
+        auto start = _base_offset.lower_bound(ko);
+        if (start.is_end()) {
+            return size();
+        }
+        auto result = size();
+        scan_frames(
+          start.index(),
+          [&](
+            size_t ix,
+            std::span<const int64_t> base_offset,
+            std::span<const int64_t> delta_offset) {
+              for (size_t i = 0; i < base_offset.size(); ++i) {
+                  if (base_offset[i] - delta_offset[i] >= ko) {
+                      result = ix + i;
+                      return ss::stop_iteration::yes;
+                  }
+              }
+              return ss::stop_iteration::no;
+          },
+          _base_offset,
+          _delta_offset);
+        return result;
+    }
+
+    /// Index of the first segment which has data with timestamp >= ts
+    size_t timestamp_lower_bound_index(int64_t ts) const {
+        auto result = size();
+        scan_frames(
+          0,
+          [&](
+            size_t ix,
+            std::span<const int64_t> max_timestamp,
+            std::span<const int64_t> base_timestamp) {
+              for (size_t i = 0; i < max_timestamp.size(); ++i) {
+                  if (max_timestamp[i] >= ts || base_timestamp[i] > ts) {
+                      result = ix + i;
+                      return ss::stop_iteration::yes;
+                  }
+              }
+              return ss::stop_iteration::no;
+          },
+          _max_timestamp,
+          _base_timestamp);
+        return result;
+    }
+
+    /// Total size of the segments with indexes in [begin_ix, end_ix)
+    uint64_t size_bytes_sum(size_t begin_ix, size_t end_ix) const {
+        uint64_t total = 0;
+        if (begin_ix >= end_ix) {
+            return total;
+        }
+        scan_frames(
+          begin_ix,
+          [&](size_t ix, std::span<const int64_t> size_bytes) {
+              auto values = size_bytes.first(
+                std::min(size_bytes.size(), end_ix - ix));
+              total = std::accumulate(values.begin(), values.end(), total);
+              return ix + values.size() < end_ix ? ss::stop_iteration::no
+                                                 : ss::stop_iteration::yes;
+          },
+          _size_bytes);
+        return total;
+    }
+
     bool contains(int64_t o) const {
         auto it = _base_offset.find(o);
         return it != _base_offset.end();
@@ -929,6 +1038,21 @@ public:
         return _col.get_column_cref<segment_meta_ix::archiver_term>();
     }
 
+    size_t kafka_lower_bound_index(kafka::offset o) const {
+        flush_write_buffer();
+        return _col.kafka_lower_bound_index(o());
+    }
+
+    size_t timestamp_lower_bound_index(model::timestamp t) const {
+        flush_write_buffer();
+        return _col.timestamp_lower_bound_index(t());
+    }
+
+    uint64_t size_bytes_sum(size_t begin_ix, size_t end_ix) const {
+        flush_write_buffer();
+        return _col.size_bytes_sum(begin_ix, end_ix);
+    }
+
     std::unique_ptr<segment_meta_materializing_iterator::impl> begin() const {
         flush_write_buffer();
         return std::make_unique<segment_meta_materializing_iterator::impl>(
@@ -1167,6 +1291,20 @@ segment_meta_cstore::lower_bound(model::offset o) const {
     return const_iterator(_impl->lower_bound(o));
 }
 
+size_t segment_meta_cstore::kafka_lower_bound_index(kafka::offset o) const {
+    return _impl->kafka_lower_bound_index(o);
+}
+
+size_t
+segment_meta_cstore::timestamp_lower_bound_index(model::timestamp t) const {
+    return _impl->timestamp_lower_bound_index(t);
+}
+
+uint64_t
+segment_meta_cstore::size_bytes_sum(size_t begin_ix, size_t end_ix) const {
+    return _impl->size_bytes_sum(begin_ix, end_ix);
+}
+
 void segment_meta_cstore::insert(const segment_meta& s) { _impl->insert(s); }
 
 void segment_meta_cstore::prefix_truncate(model::offset new_start_offset) {
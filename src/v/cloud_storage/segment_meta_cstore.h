@@ -125,6 +125,20 @@ public:
     const_iterator at_index(size_t ix) const;
     const_iterator prev(const const_iterator& it) const;
 
+    /// Queries below run on the compressed columns a frame at a time and
+    /// don't materialize segment_meta values.
+
+    /// Index of the first segment with base kafka offset >= o, or size() if
+    /// there is no such segment
+    size_t kafka_lower_bound_index(kafka::offset o) const;
+
+    /// Index of the first segment which has max_timestamp >= t or starts
+    /// after t, or size() if there is no such segment
+    size_t timestamp_lower_bound_index(model::timestamp t) const;
+
+    /// Sum of size_bytes of the segments with indexes in [begin_ix, end_ix)
+    uint64_t size_bytes_sum(size_t begin_ix, size_t end_ix) const;
+
     void insert(const segment_meta&);
 
     class [[nodiscard]] append_tx {
@@ -30,6 +30,7 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <chrono>
 
 using namespace std::chrono_literals;
@@ -1270,6 +1271,44 @@ SEASTAR_THREAD_TEST_CASE(test_should_make_api_call_when_inv_scrub_disabled) {
     BOOST_REQUIRE(q.should_lookup_in_cloud_storage({}));
 }
 
+SEASTAR_THREAD_TEST_CASE(test_sampled_api_calls_when_inv_scrub_disabled) {
+    // Without inventory data only the sampled share of the segments is looked
+    // up, and successive runs sample different segments.
+    scoped_config sc{};
+    sc.get("cloud_storage_inventory_based_scrub_enabled").set_value(false);
+    sc.get("cloud_storage_scrubbing_sample_percent").set_value(uint32_t{25});
+
+    constexpr size_t num_paths = 1000;
+    std::vector<cloud_storage::remote_segment_path> paths;
+    for (size_t i = 0; i < num_paths; ++i) {
+        paths.emplace_back(fmt::format("0/t/{}.log.1", i));
+    }
+    auto sample = [&paths](const cloud_storage::existence_query_context& q) {
+        std::vector<bool> s;
+        for (const auto& p : paths) {
+            s.push_back(q.should_lookup_in_cloud_storage(p));
+        }
+        return s;
+    };
+
+    auto q
+      = cloud_storage::existence_query_context::load(false, model::ntp{}).get();
+    q.sample_seed = 1;
+    auto first = sample(q);
+    auto sampled = static_cast<size_t>(
+      std::count(first.begin(), first.end(), true));
+    BOOST_REQUIRE_GT(sampled, num_paths / 8);
+    BOOST_REQUIRE_LT(sampled, num_paths / 2);
+
+    q.sample_seed = 2;
+    BOOST_REQUIRE(sample(q) != first);
+
+    // The override disables sampling
+    q.force_segment_existence_check = true;
+    auto forced = sample(q);
+    BOOST_REQUIRE(std::ranges::all_of(forced, [](bool b) { return b; }));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_should_not_make_api_call_when_inv_data_missing) {
     // Inv. scrub is enabled but no data found on disk.  The intention behind
     // using inventory data is to avoid API calls, so skip making calls because
@@ -19,6 +19,7 @@
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 #include "utils/retry_chain_node.h"
 
@@ -34,6 +35,7 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <iterator>
 #include <numeric>
@@ -432,6 +434,47 @@ FIXTURE_TEST(test_async_manifest_view_iter, async_manifest_view_fixture) {
     BOOST_REQUIRE(expected == actual);
 }
 
+FIXTURE_TEST(test_async_manifest_view_prefetch, async_manifest_view_fixture) {
+    std::vector<segment_meta> expected;
+    collect_segments_to(expected);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    listen();
+
+    auto maybe_cursor = view.get_cursor(model::offset{0}).get();
+    BOOST_REQUIRE(!maybe_cursor.has_failure());
+    auto cursor = std::move(maybe_cursor.value());
+
+    // The manifests which follow the one the cursor points to should be
+    // materialized in the background.
+    auto& manifest_cache
+      = api.local().materialized().get_materialized_manifest_cache();
+    tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return std::all_of(
+          std::next(spillover_start_offsets.begin()),
+          spillover_start_offsets.end(),
+          [&](model::offset so) {
+              return manifest_cache.contains(
+                std::make_tuple(manifest_ntp, so));
+          });
+    }).get();
+
+    std::vector<segment_meta> actual;
+    do {
+        cursor
+          ->with_manifest([&](const partition_manifest& m) {
+              for (auto meta : m) {
+                  actual.push_back(meta);
+              }
+          })
+          .get();
+    } while (cursor->next().get().value() != eof::yes);
+    print_diff(actual, expected);
+    BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
+    BOOST_REQUIRE(expected == actual);
+}
+
 FIXTURE_TEST(test_async_manifest_view_truncate, async_manifest_view_fixture) {
     // Check archive truncation
     std::vector<segment_meta> expected;
@@ -968,6 +1011,44 @@ FIXTURE_TEST(
     BOOST_REQUIRE(past_term_query.value() == std::nullopt);
 }
 
+FIXTURE_TEST(
+  test_async_manifest_view_last_offset_term_stm, async_manifest_view_fixture) {
+    // All terms are in the stm manifest, the term index used for lookups
+    // has to follow the manifest as it changes.
+    auto first_term = generate_random_segments(stm_manifest, 10);
+    auto first_term_last_offset = first_term.back().committed_offset;
+    add_segments_to_stm_manifest(std::move(first_term));
+
+    auto third_term = generate_random_segments(stm_manifest, 10);
+    auto third_term_last_offset = third_term.back().committed_offset;
+    for (auto& meta : third_term) {
+        meta.segment_term = model::term_id{3};
+    }
+    add_segments_to_stm_manifest(std::move(third_term));
+
+    auto query = [this](model::term_id term) {
+        auto res = view.get_term_last_offset(term).get();
+        BOOST_REQUIRE(res.has_value());
+        BOOST_REQUIRE(res.value().has_value());
+        return kafka::offset_cast(res.value().value());
+    };
+
+    BOOST_REQUIRE_EQUAL(query(model::term_id{1}), first_term_last_offset);
+    // unknown term in between, the offset before the next term is returned
+    BOOST_REQUIRE_EQUAL(query(model::term_id{2}), first_term_last_offset);
+    BOOST_REQUIRE_EQUAL(query(model::term_id{3}), third_term_last_offset);
+
+    auto fifth_term = generate_random_segments(stm_manifest, 10);
+    for (auto& meta : fifth_term) {
+        meta.segment_term = model::term_id{5};
+    }
+    add_segments_to_stm_manifest(std::move(fifth_term));
+
+    BOOST_REQUIRE_EQUAL(query(model::term_id{1}), first_term_last_offset);
+    BOOST_REQUIRE_EQUAL(query(model::term_id{3}), third_term_last_offset);
+    BOOST_REQUIRE_EQUAL(query(model::term_id{4}), third_term_last_offset);
+}
+
 FIXTURE_TEST(
   test_async_manifest_view_spill_concurrently, async_manifest_view_fixture) {
     // Enumerate all segments while spilling.
@@ -30,6 +30,7 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <fstream>
@@ -467,6 +468,100 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_read_skipped_on_old_version) {
     BOOST_REQUIRE_EQUAL(out.size(), 0);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_lru_order) {
+    access_time_tracker t;
+    t.add("key0", make_ts(30), 1);
+    t.add("key1", make_ts(10), 2);
+    t.add("key2", make_ts(20), 4);
+    t.add("key3", make_ts(40), 8);
+
+    // Updating the access time moves the entry
+    t.add("key1", make_ts(50), 2);
+    t.remove("key3");
+
+    auto entries = t.lru_entries();
+    BOOST_REQUIRE_EQUAL(entries.size(), 3);
+    BOOST_REQUIRE_EQUAL(entries[0].path, "key2");
+    BOOST_REQUIRE_EQUAL(entries[1].path, "key0");
+    BOOST_REQUIRE_EQUAL(entries[2].path, "key1");
+
+    // Enough entries to free 5 bytes and one object
+    auto bounded = t.lru_entries(5, 1, 0);
+    BOOST_REQUIRE_EQUAL(bounded.size(), 2);
+    BOOST_REQUIRE_EQUAL(bounded[0].path, "key2");
+    BOOST_REQUIRE_EQUAL(bounded[1].path, "key0");
+
+    // Extra entries are returned as carryover
+    BOOST_REQUIRE_EQUAL(t.lru_entries(0, 1, 1).size(), 2);
+}
+
+static iobuf serialize_tracker(access_time_tracker& t) {
+    iobuf serialized;
+    auto out_stream = make_iobuf_ref_output_stream(serialized);
+    t.write(out_stream).get();
+    out_stream.flush().get();
+    return serialized;
+}
+
+static void deserialize_tracker(access_time_tracker& t, const iobuf& buf) {
+    auto in_stream = make_iobuf_input_stream(buf.copy());
+    t.read(in_stream).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_journal) {
+    access_time_tracker in;
+    in.add("key0", make_ts(1), 1);
+    in.add("key1", make_ts(2), 2);
+    auto snapshot = serialize_tracker(in);
+    BOOST_REQUIRE(!in.is_dirty());
+
+    in.add("key2", make_ts(3), 3);
+    in.add("key0", make_ts(4), 1);
+    in.remove("key1");
+    BOOST_REQUIRE(in.is_dirty());
+    auto record = in.take_journal_record();
+    BOOST_REQUIRE(!in.is_dirty());
+    BOOST_REQUIRE_EQUAL(
+      record.size_bytes() % access_time_tracker::journal_alignment, 0);
+    BOOST_REQUIRE(in.take_journal_record().empty());
+
+    in.add("key3", make_ts(5), 4);
+    auto second_record = in.take_journal_record();
+
+    // Both records are replayed on top of the snapshot
+    access_time_tracker out;
+    deserialize_tracker(out, snapshot);
+    iobuf journal = record.copy();
+    journal.append(second_record.copy());
+    BOOST_REQUIRE_EQUAL(
+      out.replay_journal(journal.copy()), journal.size_bytes());
+    BOOST_REQUIRE(!out.is_dirty());
+    BOOST_REQUIRE(!out.needs_snapshot());
+    BOOST_REQUIRE_EQUAL(out.size(), 3);
+    BOOST_REQUIRE_EQUAL(out.get("key0")->atime_sec, 4);
+    BOOST_REQUIRE(!out.get("key1").has_value());
+    BOOST_REQUIRE_EQUAL(out.get("key2")->size, 3);
+    BOOST_REQUIRE_EQUAL(out.get("key3")->size, 4);
+
+    // A torn record at the end of the journal is ignored
+    access_time_tracker torn;
+    deserialize_tracker(torn, snapshot);
+    iobuf torn_journal = record.copy();
+    torn_journal.append(second_record.share(0, 16));
+    BOOST_REQUIRE_EQUAL(
+      torn.replay_journal(std::move(torn_journal)), record.size_bytes());
+    BOOST_REQUIRE_EQUAL(torn.size(), 2);
+    BOOST_REQUIRE(!torn.get("key3").has_value());
+
+    // Records which predate the snapshot are skipped
+    auto next_snapshot = serialize_tracker(in);
+    access_time_tracker stale;
+    deserialize_tracker(stale, next_snapshot);
+    stale.replay_journal(record.copy());
+    BOOST_REQUIRE_EQUAL(stale.size(), 3);
+    BOOST_REQUIRE(stale.needs_snapshot());
+}
+
 ss::future<size_t> count_files(ss::sstring dirname) {
     directory_walker walker;
     size_t count = 0;
@@ -825,3 +920,54 @@ FIXTURE_TEST(test_tracker_sync_add_remove, cache_test_fixture) {
     BOOST_REQUIRE_EQUAL(cache.get_usage_bytes(), 1024);
     BOOST_REQUIRE_EQUAL(cache.get_usage_objects(), 1);
 }
+
+FIXTURE_TEST(test_download_once_coalesces, cache_test_fixture) {
+    // Concurrent downloads of the same key, from every shard, run the
+    // download function only once.
+    std::atomic<int> downloads{0};
+    std::vector<ss::future<>> fs;
+    for (ss::shard_id shard = 0; shard < ss::smp::count; ++shard) {
+        for (int i = 0; i < 4; ++i) {
+            fs.push_back(
+              sharded_cache.invoke_on(shard, [this, &downloads](cache& c) {
+                  return c.download_once(KEY, [this, &downloads] {
+                      return ss::async([this, &downloads] {
+                          ss::sleep(100ms).get();
+                          ++downloads;
+                          put_into_cache(create_data_string('a', 1_KiB), KEY);
+                      });
+                  });
+              }));
+        }
+    }
+    ss::when_all_succeed(fs.begin(), fs.end()).get();
+    BOOST_REQUIRE_EQUAL(downloads.load(), 1);
+    BOOST_REQUIRE(
+      sharded_cache.local().is_cached(KEY).get()
+      == cache_element_status::available);
+}
+
+FIXTURE_TEST(test_download_once_after_failure, cache_test_fixture) {
+    // If the first download fails, a waiter downloads the object itself.
+    auto& cache = sharded_cache.local();
+    int attempts = 0;
+    auto download = [&] {
+        ++attempts;
+        if (attempts == 1) {
+            return ss::sleep(100ms).then([] {
+                return ss::make_exception_future<>(
+                  std::runtime_error("download failed"));
+            });
+        }
+        return ss::async([&] {
+            put_into_cache(create_data_string('b', 1_KiB), KEY);
+        });
+    };
+
+    auto first = cache.download_once(KEY, download);
+    auto second = cache.download_once(KEY, download);
+    BOOST_REQUIRE_THROW(first.get(), std::runtime_error);
+    second.get();
+    BOOST_REQUIRE_EQUAL(attempts, 2);
+    BOOST_REQUIRE(cache.is_cached(KEY).get() == cache_element_status::available);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "cloud_storage/chunk_memory_cache.h"
+#include "ssx/sformat.h"
+#include "test_utils/test.h"
+
+#include <gtest/gtest.h>
+
+using namespace cloud_storage;
+
+namespace {
+
+iobuf make_chunk(size_t size, char c) {
+    iobuf buf;
+    ss::sstring data(size, c);
+    buf.append(data.data(), data.size());
+    return buf;
+}
+
+} // namespace
+
+TEST(ChunkMemoryCacheTest, PutGet) {
+    chunk_memory_cache cache(10_MiB);
+    EXPECT_FALSE(cache.get("chunk/0").has_value());
+
+    cache.put("chunk/0", make_chunk(1_MiB, 'a'));
+    auto data = cache.get("chunk/0");
+    ASSERT_TRUE(data.has_value());
+    EXPECT_EQ(*data, make_chunk(1_MiB, 'a'));
+
+    const auto stat = cache.get_stat();
+    EXPECT_EQ(stat.size_bytes, 1_MiB);
+    EXPECT_EQ(stat.hit_count, 1);
+    EXPECT_EQ(stat.access_count, 2);
+}
+
+TEST(ChunkMemoryCacheTest, LargeChunksAreNotCached) {
+    chunk_memory_cache cache(10_MiB);
+    EXPECT_TRUE(cache.admits(1_MiB));
+    EXPECT_FALSE(cache.admits(2_MiB));
+
+    cache.put("chunk/0", make_chunk(2_MiB, 'a'));
+    EXPECT_FALSE(cache.get("chunk/0").has_value());
+    EXPECT_EQ(cache.get_stat().size_bytes, 0);
+}
+
+TEST(ChunkMemoryCacheTest, SizeIsBounded) {
+    chunk_memory_cache cache(10_MiB);
+    for (int i = 0; i < 100; ++i) {
+        cache.put(ssx::sformat("chunk/{}", i), make_chunk(1_MiB, 'a'));
+        // the cache may exceed its capacity by at most one chunk
+        EXPECT_LE(cache.get_stat().size_bytes, 11_MiB);
+    }
+}
+
+TEST(ChunkMemoryCacheTest, Reclaim) {
+    chunk_memory_cache cache(10_MiB);
+    for (int i = 0; i < 4; ++i) {
+        cache.put(ssx::sformat("chunk/{}", i), make_chunk(1_MiB, 'a'));
+    }
+    EXPECT_EQ(cache.get_stat().size_bytes, 4_MiB);
+
+    EXPECT_GE(cache.reclaim(1), 1_MiB);
+    EXPECT_EQ(cache.get_stat().size_bytes, 3_MiB);
+
+    EXPECT_EQ(cache.reclaim(100_MiB), 3_MiB);
+    EXPECT_EQ(cache.get_stat().size_bytes, 0);
+    EXPECT_EQ(cache.reclaim(1), 0);
+}
+
+TEST(ChunkMemoryCacheTest, SharedDataOutlivesEviction) {
+    chunk_memory_cache cache(10_MiB);
+    cache.put("chunk/0", make_chunk(1_MiB, 'a'));
+    auto data = cache.get("chunk/0");
+    ASSERT_TRUE(data.has_value());
+
+    cache.reclaim(100_MiB);
+    EXPECT_FALSE(cache.get("chunk/0").has_value());
+    EXPECT_EQ(*data, make_chunk(1_MiB, 'a'));
+}
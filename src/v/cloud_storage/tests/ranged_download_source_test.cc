@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iostream.h"
+#include "cloud_storage/ranged_download_source.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/sleep.hh>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+namespace {
+
+ss::sstring make_object(size_t size) {
+    ss::sstring object(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+        object[i] = static_cast<char>('a' + (i % 26));
+    }
+    return object;
+}
+
+ss::sstring read_all(ss::input_stream<char>& stream) {
+    ss::sstring result;
+    while (true) {
+        auto buf = stream.read().get();
+        if (buf.empty()) {
+            break;
+        }
+        result += ss::sstring(buf.get(), buf.size());
+    }
+    stream.close().get();
+    return result;
+}
+
+} // namespace
+
+TEST(RangedDownloadSourceTest, ReassemblesRangesInOrder) {
+    const auto object = make_object(1000);
+    size_t in_flight = 0;
+    size_t max_in_flight = 0;
+    std::vector<cloud_storage_clients::http_byte_range> requested;
+
+    auto stream = make_ranged_download_stream(
+      object.size(),
+      64,
+      4,
+      [&](cloud_storage_clients::http_byte_range range) -> ss::future<iobuf> {
+          requested.push_back(range);
+          max_in_flight = std::max(max_in_flight, ++in_flight);
+          // later ranges complete first
+          co_await ss::sleep(std::chrono::milliseconds(
+            10 - std::min<uint64_t>(range.first / 64, 9)));
+          --in_flight;
+          iobuf buf;
+          buf.append(
+            object.data() + range.first, range.second - range.first + 1);
+          co_return buf;
+      });
+
+    EXPECT_EQ(read_all(stream), object);
+    EXPECT_EQ(max_in_flight, 4);
+
+    // ranges are inclusive and cover the object exactly once
+    ASSERT_EQ(requested.size(), 16);
+    uint64_t next = 0;
+    for (const auto& [first, last] : requested) {
+        EXPECT_EQ(first, next);
+        next = last + 1;
+    }
+    EXPECT_EQ(next, object.size());
+}
+
+TEST(RangedDownloadSourceTest, PropagatesRangeFailure) {
+    auto stream = make_ranged_download_stream(
+      100,
+      10,
+      3,
+      [](cloud_storage_clients::http_byte_range range) -> ss::future<iobuf> {
+          if (range.first == 20) {
+              throw std::runtime_error("range failed");
+          }
+          iobuf buf;
+          buf.append(ss::temporary_buffer<char>(range.second - range.first + 1));
+          co_return buf;
+      });
+
+    EXPECT_THROW(
+      {
+          while (!stream.read().get().empty()) {
+          }
+      },
+      std::runtime_error);
+    stream.close().get();
+}
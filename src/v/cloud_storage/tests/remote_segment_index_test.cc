@@ -317,3 +317,53 @@ SEASTAR_THREAD_TEST_CASE(
         BOOST_REQUIRE_GT(it_b->second, it_a->second);
     }
 }
+
+BOOST_AUTO_TEST_CASE(remote_segment_index_frames_roundtrip_test) {
+    offset_index tmp_index(
+      model::offset{0}, kafka::offset{0}, 0U, 1000, model::timestamp{0});
+    tmp_index.add(model::offset{10}, kafka::offset{10}, 100, {});
+    BOOST_REQUIRE(!tmp_index.frame_index().has_value());
+
+    segment_frame_index frames;
+    frames.uncompressed_size = 2_MiB + 10;
+    frames.compressed_ends = {1000, 1900, 1910};
+    tmp_index.set_frame_index(frames);
+
+    offset_index index(
+      model::offset{0}, kafka::offset{0}, 0U, 1000, model::timestamp{0});
+    index.from_iobuf(tmp_index.to_iobuf());
+    BOOST_REQUIRE(index.frame_index().has_value());
+    BOOST_REQUIRE(index.frame_index().value() == frames);
+    BOOST_REQUIRE(index.find_rp_offset(model::offset{11}).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(remote_segment_index_search_while_appending_test) {
+    // Lookups between appends have to see the rows encoded since the
+    // previous lookup, the index spans many pages of encoded rows.
+    offset_index index(
+      model::offset{0}, kafka::offset{0}, 0U, 1000, model::timestamp{0});
+    std::vector<int64_t> offsets;
+    int64_t offset = 10;
+    for (int i = 0; i < 3000; i++) {
+        index.add(
+          model::offset{offset},
+          kafka::offset{offset},
+          offset * 1000,
+          model::timestamp{offset});
+        offsets.push_back(offset);
+        offset += random_generators::get_int(2, 10);
+
+        auto last = index.find_rp_offset(model::offset{offsets.back() + 1});
+        BOOST_REQUIRE(last.has_value());
+        BOOST_REQUIRE_EQUAL(last->rp_offset, model::offset{offsets.back()});
+        BOOST_REQUIRE_EQUAL(last->file_pos, offsets.back() * 1000);
+
+        auto target = offsets.at(
+          random_generators::get_int(offsets.size() - 1));
+        auto res = index.find_timestamp(model::timestamp{target + 1});
+        BOOST_REQUIRE(res.has_value());
+        BOOST_REQUIRE_EQUAL(res->rp_offset, model::offset{target});
+        BOOST_REQUIRE_EQUAL(res->kaf_offset, kafka::offset{target});
+        BOOST_REQUIRE_EQUAL(res->file_pos, target * 1000);
+    }
+}
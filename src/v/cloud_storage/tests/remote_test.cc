@@ -874,6 +874,59 @@ TEST_P(all_types_remote_fixture, test_delete_objects_multiple_batches) {
     ASSERT_EQ(to_delete, deleted_keys);
 }
 
+TEST_P(all_types_remote_fixture, test_delete_objects_coalesced) {
+    // Keys of concurrent callers are deleted by shared requests.
+    set_expectations_and_listen({});
+    config::shard_local_cfg().cloud_storage_delete_batch_concurrency.set_value(
+      size_t{1});
+    auto reset_concurrency = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_delete_batch_concurrency.reset();
+    });
+
+    retry_chain_node fib(never_abort, 500ms, 20ms);
+
+    constexpr auto num_callers = 10;
+    constexpr auto keys_per_caller = 150;
+    std::vector<cloud_storage_clients::object_key> to_delete;
+    std::vector<ss::future<cloud_storage::upload_result>> results;
+    for (auto caller : boost::irange(num_callers)) {
+        std::vector<cloud_storage_clients::object_key> keys;
+        for (auto k : boost::irange(keys_per_caller)) {
+            keys.emplace_back(fmt::format("{}-{}", caller, k));
+        }
+        to_delete.insert(to_delete.end(), keys.begin(), keys.end());
+        results.push_back(
+          remote.local().delete_objects(bucket_name, std::move(keys), fib));
+    }
+    for (auto& result : results) {
+        ASSERT_EQ(cloud_storage::upload_result::success, result.get());
+    }
+
+    // The first caller is sent on its own, the keys queued while it was in
+    // flight fill the following requests.
+    auto requests = get_requests();
+    ASSERT_EQ(requests.size(), 3);
+
+    std::vector<cloud_storage_clients::object_key> deleted_keys;
+    for (const auto& request : requests) {
+        ASSERT_TRUE(request.has_q_delete);
+        auto request_keys = keys_from_delete_objects_request(request);
+        ASSERT_LE(
+          request_keys.size(),
+          static_cast<size_t>(remote.local().delete_objects_max_keys()));
+        deleted_keys.insert(
+          deleted_keys.end(),
+          std::make_move_iterator(request_keys.begin()),
+          std::make_move_iterator(request_keys.end()));
+    }
+
+    std::sort(to_delete.begin(), to_delete.end());
+    std::sort(deleted_keys.begin(), deleted_keys.end());
+
+    ASSERT_EQ(to_delete, deleted_keys);
+}
+
 TEST_P(
   all_types_remote_fixture,
   test_delete_objects_multiple_batches_single_failure) {
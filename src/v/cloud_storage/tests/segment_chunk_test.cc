@@ -8,6 +8,7 @@
  * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
  */
 
+#include "base/units.h"
 #include "cloud_storage/segment_chunk.h"
 #include "cloud_storage/segment_chunk_api.h"
 
@@ -207,3 +208,28 @@ SEASTAR_THREAD_TEST_CASE(test_predictive_chunk_eviction) {
     BOOST_REQUIRE(chunks[2].handle.has_value());
     BOOST_REQUIRE(chunks[2].current_state == chunk_state::hydrated);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_predict_chunk_prefetch) {
+    using namespace std::chrono_literals;
+    constexpr uint64_t chunk_size = 16_MiB;
+
+    // No rate estimate yet, fall back to the configured minimum.
+    BOOST_REQUIRE_EQUAL(predict_chunk_prefetch(0, 200ms, chunk_size, 2, 16), 2);
+
+    // A reader consuming a chunk in 100ms needs two chunks in flight to hide
+    // a 200ms download.
+    BOOST_REQUIRE_EQUAL(
+      predict_chunk_prefetch(160_MiB, 200ms, chunk_size, 0, 16), 2);
+
+    // Slow readers are served by the minimum prefetch.
+    BOOST_REQUIRE_EQUAL(
+      predict_chunk_prefetch(1_MiB, 200ms, chunk_size, 1, 16), 1);
+
+    // Fast readers are capped by the maximum.
+    BOOST_REQUIRE_EQUAL(
+      predict_chunk_prefetch(10240_MiB, 1s, chunk_size, 0, 16), 16);
+
+    // The minimum wins over a lower maximum.
+    BOOST_REQUIRE_EQUAL(
+      predict_chunk_prefetch(10240_MiB, 1s, chunk_size, 4, 2), 4);
+}
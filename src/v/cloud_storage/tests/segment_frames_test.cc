@@ -0,0 +1,122 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "cloud_storage/segment_frames.h"
+#include "test_utils/test.h"
+
+#include <gtest/gtest.h>
+
+using namespace cloud_storage;
+
+namespace {
+
+ss::sstring make_segment(size_t size) {
+    ss::sstring segment(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+        segment[i] = static_cast<char>('a' + (i % 26));
+    }
+    return segment;
+}
+
+ss::sstring read_all(ss::input_stream<char> stream) {
+    ss::sstring result;
+    while (true) {
+        auto buf = stream.read().get();
+        if (buf.empty()) {
+            break;
+        }
+        result += ss::sstring(buf.get(), buf.size());
+    }
+    stream.close().get();
+    return result;
+}
+
+iobuf compress(const ss::sstring& segment, segment_frame_index& frames) {
+    iobuf out;
+    auto stream = make_frame_compression_stream(
+      make_iobuf_input_stream(iobuf::from(segment)), frames);
+    while (true) {
+        auto buf = stream.read().get();
+        if (buf.empty()) {
+            break;
+        }
+        out.append(std::move(buf));
+    }
+    stream.close().get();
+    return out;
+}
+
+} // namespace
+
+TEST(SegmentFramesTest, CompressRecordsFrames) {
+    const auto segment = make_segment(1000);
+    segment_frame_index frames;
+    frames.frame_size = 128;
+    auto compressed = compress(segment, frames);
+
+    EXPECT_EQ(frames.uncompressed_size, segment.size());
+    EXPECT_EQ(frames.num_frames(), 8);
+    EXPECT_EQ(frames.compressed_size(), compressed.size_bytes());
+    EXPECT_LT(compressed.size_bytes(), segment.size());
+}
+
+TEST(SegmentFramesTest, CompressEmptySegment) {
+    segment_frame_index frames;
+    auto compressed = compress("", frames);
+    EXPECT_EQ(frames.num_frames(), 0);
+    EXPECT_EQ(frames.uncompressed_size, 0);
+    EXPECT_TRUE(compressed.empty());
+}
+
+TEST(SegmentFramesTest, DecompressArbitraryRanges) {
+    const auto segment = make_segment(1000);
+    segment_frame_index frames;
+    frames.frame_size = 128;
+    auto compressed = compress(segment, frames);
+
+    const std::vector<std::pair<uint64_t, uint64_t>> ranges = {
+      {0, 999}, {0, 0}, {127, 128}, {128, 255}, {300, 700}, {999, 999}};
+    for (auto [first, last] : ranges) {
+        auto range = frames.to_frame_range(first, last);
+        EXPECT_EQ(range.first_frame, first / 128);
+        EXPECT_EQ(range.last_frame, last / 128);
+
+        auto [begin, end] = range.compressed_bytes;
+        auto stream = make_frame_decompression_stream(
+          make_iobuf_input_stream(compressed.share(begin, end - begin + 1)),
+          frames,
+          range);
+        EXPECT_EQ(
+          read_all(std::move(stream)), segment.substr(first, last - first + 1))
+          << "range [" << first << ", " << last << "]";
+    }
+}
+
+TEST(SegmentFramesTest, RecompressMatchesFrames) {
+    const auto segment = make_segment(1000);
+    segment_frame_index frames;
+    frames.frame_size = 128;
+    auto first = compress(segment, frames);
+
+    auto expected = frames;
+    auto second = compress(segment, frames);
+    EXPECT_EQ(frames, expected);
+    EXPECT_EQ(first, second);
+}
+
+TEST(SegmentFramesTest, RecompressMismatchThrows) {
+    segment_frame_index frames;
+    frames.frame_size = 128;
+    compress(make_segment(1000), frames);
+
+    EXPECT_THROW(compress(make_segment(900), frames), std::runtime_error);
+}
@@ -19,6 +19,7 @@
 
 #include <absl/container/btree_map.h>
 
+#include <algorithm>
 #include <ranges>
 #include <vector>
 
@@ -286,6 +287,106 @@ void cs_deserialize_test(auto& store, size_t sz) {
     store.from_iobuf(std::move(buf));
     perf_tests::stop_measuring_time();
 }
+
+// Queries which scan the columns: iterating materialized rows vs. running
+// on the decoded frames.
+
+void cs_size_sum_scan_test(segment_meta_cstore& store, size_t sz) {
+    for (auto manifest = generate_metadata(sz); auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    perf_tests::start_measuring_time();
+    uint64_t total = 0;
+    for (const auto& s : store) {
+        total += s.size_bytes;
+    }
+    perf_tests::do_not_optimize(total);
+    perf_tests::stop_measuring_time();
+}
+
+void cs_size_sum_test(segment_meta_cstore& store, size_t sz) {
+    for (auto manifest = generate_metadata(sz); auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    perf_tests::start_measuring_time();
+    auto total = store.size_bytes_sum(0, store.size());
+    perf_tests::do_not_optimize(total);
+    perf_tests::stop_measuring_time();
+}
+
+void cs_timestamp_lower_bound_scan_test(
+  segment_meta_cstore& store, size_t sz) {
+    auto manifest = generate_metadata(sz);
+    for (const auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    for (auto& e : manifest | last_n(20)) {
+        perf_tests::start_measuring_time();
+        auto it = std::ranges::find_if(store, [&e](const segment_meta& s) {
+            return s.max_timestamp >= e.base_timestamp
+                   || s.base_timestamp > e.base_timestamp;
+        });
+        perf_tests::do_not_optimize(it);
+        perf_tests::stop_measuring_time();
+    }
+}
+
+void cs_timestamp_lower_bound_test(segment_meta_cstore& store, size_t sz) {
+    auto manifest = generate_metadata(sz);
+    for (const auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    for (auto& e : manifest | last_n(20)) {
+        perf_tests::start_measuring_time();
+        auto ix = store.timestamp_lower_bound_index(e.base_timestamp);
+        perf_tests::do_not_optimize(ix);
+        perf_tests::stop_measuring_time();
+    }
+}
+
+void cs_kafka_lower_bound_scan_test(segment_meta_cstore& store, size_t sz) {
+    auto manifest = generate_metadata(sz);
+    for (const auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    for (auto& e : manifest | last_n(20)) {
+        auto ko = e.base_kafka_offset();
+        perf_tests::start_measuring_time();
+        auto it = store.lower_bound(kafka::offset_cast(ko));
+        while (!it.is_end() && it->base_kafka_offset() < ko) {
+            ++it;
+        }
+        perf_tests::do_not_optimize(it);
+        perf_tests::stop_measuring_time();
+    }
+}
+
+void cs_kafka_lower_bound_test(segment_meta_cstore& store, size_t sz) {
+    auto manifest = generate_metadata(sz);
+    for (const auto& s : manifest) {
+        store.insert(s);
+    }
+    store.flush_write_buffer();
+
+    for (auto& e : manifest | last_n(20)) {
+        auto ko = e.base_kafka_offset();
+        perf_tests::start_measuring_time();
+        auto ix = store.kafka_lower_bound_index(ko);
+        perf_tests::do_not_optimize(ix);
+        perf_tests::stop_measuring_time();
+    }
+}
+
 PERF_TEST(cstore_bench, column_store_append_baseline) {
     baseline_column_store store;
     cs_append_test(store, 10000);
@@ -374,3 +475,33 @@ PERF_TEST(cstore_bench, column_store_deserialize_result) {
     segment_meta_cstore store;
     cs_deserialize_test(store, 10000);
 }
+
+PERF_TEST(cstore_bench, column_store_size_sum_scan) {
+    segment_meta_cstore store;
+    cs_size_sum_scan_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_size_sum_result) {
+    segment_meta_cstore store;
+    cs_size_sum_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_timestamp_lower_bound_scan) {
+    segment_meta_cstore store;
+    cs_timestamp_lower_bound_scan_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_timestamp_lower_bound_result) {
+    segment_meta_cstore store;
+    cs_timestamp_lower_bound_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_kafka_lower_bound_scan) {
+    segment_meta_cstore store;
+    cs_kafka_lower_bound_scan_test(store, 100000);
+}
+
+PERF_TEST(cstore_bench, column_store_kafka_lower_bound_result) {
+    segment_meta_cstore store;
+    cs_kafka_lower_bound_test(store, 100000);
+}
@@ -201,6 +201,60 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_full_upper_bound) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_column_queries) {
+    segment_meta_cstore store;
+    auto manifest = generate_metadata(short_test_size);
+    for (const auto& sm : manifest) {
+        store.insert(sm);
+    }
+
+    // Truncate so that the first frame is partial
+    auto truncate_ix = random_generators::get_int<size_t>(1, 100);
+    store.prefix_truncate(manifest[truncate_ix].base_offset);
+    manifest.erase(manifest.begin(), manifest.begin() + truncate_ix);
+    BOOST_REQUIRE_EQUAL(store.size(), manifest.size());
+
+    for (int i = 0; i < 100; i++) {
+        auto begin = random_generators::get_int<size_t>(0, manifest.size());
+        auto end = random_generators::get_int<size_t>(begin, manifest.size());
+        uint64_t expected = 0;
+        for (auto ix = begin; ix < end; ix++) {
+            expected += manifest[ix].size_bytes;
+        }
+        BOOST_REQUIRE_EQUAL(store.size_bytes_sum(begin, end), expected);
+    }
+
+    for (int i = 0; i < 100; i++) {
+        const auto& target = manifest[random_generators::get_int<size_t>(
+          0, manifest.size() - 1)];
+
+        auto ko = target.base_kafka_offset();
+        auto kafka_it = std::ranges::find_if(manifest, [ko](const auto& m) {
+            return m.base_kafka_offset() >= ko;
+        });
+        BOOST_REQUIRE_EQUAL(
+          store.kafka_lower_bound_index(ko),
+          static_cast<size_t>(std::distance(manifest.begin(), kafka_it)));
+
+        auto ts = target.base_timestamp;
+        auto ts_it = std::ranges::find_if(manifest, [ts](const auto& m) {
+            return m.max_timestamp >= ts || m.base_timestamp > ts;
+        });
+        BOOST_REQUIRE_EQUAL(
+          store.timestamp_lower_bound_index(ts),
+          static_cast<size_t>(std::distance(manifest.begin(), ts_it)));
+    }
+
+    BOOST_REQUIRE_EQUAL(
+      store.kafka_lower_bound_index(
+        kafka::next_offset(manifest.back().base_kafka_offset())),
+      store.size());
+    BOOST_REQUIRE_EQUAL(
+      store.timestamp_lower_bound_index(
+        model::timestamp(manifest.back().max_timestamp() + 1)),
+      store.size());
+}
+
 BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_iterators) {
     segment_meta_cstore store;
 
@@ -21,6 +21,7 @@
 #include "config/configuration.h"
 #include "json/document.h"
 #include "json/istreamwrapper.h"
+#include "utils/base64.h"
 
 #include <utility>
 
@@ -45,6 +46,8 @@ constexpr std::array<boost::beast::http::status, 6> retryable_http_codes = {
 constexpr boost::beast::string_view content_type_value = "text/plain";
 constexpr boost::beast::string_view blob_type_value = "BlockBlob";
 constexpr boost::beast::string_view blob_type_name = "x-ms-blob-type";
+constexpr boost::beast::string_view blob_content_type_name
+  = "x-ms-blob-content-type";
 constexpr boost::beast::string_view delete_snapshot_name
   = "x-ms-delete-snapshots";
 constexpr boost::beast::string_view is_hns_enabled_name = "x-ms-is-hns-enabled";
@@ -59,6 +62,10 @@ constexpr boost::beast::string_view
   hierarchical_namespace_not_enabled_error_code
   = "HierarchicalNamespaceNotEnabled";
 
+// uncommitted blocks are scoped to the blob, so a single placeholder id is
+// used for all block list uploads
+constexpr std::string_view block_list_upload_id = "block-list";
+
 // filename for the set expiry test file
 constexpr std::string_view set_expiry_test_file = "testsetexpiry";
 
@@ -239,6 +246,69 @@ result<http::client::request_header> abs_request_creator::make_put_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& block_id,
+  size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_list_request(
+  const bucket_name& name, const object_key& key, size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // x-ms-blob-content-type: text/plain
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(blob_content_type_name, content_type_value);
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
 result<http::client::request_header>
 abs_request_creator::make_get_blob_metadata_request(
   const bucket_name& name, const object_key& key) {
@@ -488,6 +558,11 @@ ss::future<> abs_client::stop() {
 
 void abs_client::shutdown() { _client.shutdown_now(); }
 
+ss::future<> abs_client::warm_up(ss::lowres_clock::duration timeout) {
+    // The ADLS client is only used by a few operations, leave it lazy.
+    return _client.warm_up(timeout);
+}
+
 template<typename T>
 ss::future<result<T, error_outcome>> abs_client::send_request(
   ss::future<T> request_future,
@@ -692,6 +767,153 @@ ss::future<> abs_client::do_put_object(
     }
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::create_multipart_upload(
+  const bucket_name&, const object_key&, ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<ss::sstring, error_outcome>>(
+      ss::sstring{block_list_upload_id});
+}
+
+ss::future<result<abs_client::multipart_part, error_outcome>>
+abs_client::upload_part(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring&,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block(
+        name, key, part_number, payload_size, std::move(body), timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<abs_client::multipart_part> abs_client::do_put_block(
+  const bucket_name& name,
+  const object_key& key,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    // Block ids must have the same length for all the blocks of a blob. Six
+    // zero padded digits cover the 50000 blocks a blob can have and encode
+    // to base64 without padding or characters that need escaping.
+    const auto padded_number = fmt::format("{:06d}", part_number);
+    auto block_id = bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(padded_number.data()),
+       padded_number.size()});
+
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, payload_size);
+    if (!header) {
+        co_await body.close();
+
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_await util::drain_response_stream(std::move(response_stream));
+
+    co_return multipart_part{
+      .part_number = part_number, .etag = std::move(block_id)};
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring&,
+  std::vector<multipart_part> parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, std::move(parts), timeout).then([] {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  const bucket_name& name,
+  const object_key& key,
+  std::vector<multipart_part> parts,
+  ss::lowres_clock::duration timeout) {
+    // <?xml version="1.0" encoding="utf-8"?>
+    // <BlockList>
+    //   <Latest>{block-id}</Latest>
+    //   ...
+    // </BlockList>
+    std::string block_list{R"(<?xml version="1.0" encoding="utf-8"?>)"};
+    block_list += "<BlockList>";
+    for (const auto& part : parts) {
+        fmt::format_to(
+          std::back_inserter(block_list), "<Latest>{}</Latest>", part.etag);
+    }
+    block_list += "</BlockList>";
+    iobuf payload;
+    payload.append(block_list.data(), block_list.size());
+
+    auto header = _requestor.make_put_block_list_request(
+      name, key, payload.size_bytes());
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto body = make_iobuf_input_stream(std::move(payload));
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  const bucket_name&,
+  const object_key& key,
+  const ss::sstring&,
+  ss::lowres_clock::duration) {
+    // There is no request to discard uncommitted blocks, they are garbage
+    // collected by the service or replaced by the next upload of the blob.
+    vlog(abs_log.debug, "Abandoning uncommitted blocks of {}", key);
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::head_object_result, error_outcome>>
 abs_client::head_object(
   const bucket_name& name,
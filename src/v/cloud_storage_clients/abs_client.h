@@ -39,6 +39,30 @@ public:
       const object_key& key,
       size_t payload_size_bytes);
 
+    /// \brief Create a 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 encoded id of the block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& block_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'Put Block List' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param payload_size_bytes is a size of the block list in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_list_request(
+      const bucket_name& name,
+      const object_key& key,
+      size_t payload_size_bytes);
+
     /// \brief Create a 'Get Blob' request header
     ///
     /// \param name is container name
@@ -137,6 +161,8 @@ public:
     /// Shutdown the underlying connection
     void shutdown() override;
 
+    ss::future<> warm_up(ss::lowres_clock::duration timeout) override;
+
     /// Download object from ABS container
     ///
     /// \param name is a container name
@@ -177,6 +203,38 @@ public:
       ss::lowres_clock::duration timeout,
       bool accept_no_content = false) override;
 
+    /// Block blobs have no upload session: the returned id is a placeholder
+    /// and uncommitted blocks are discarded by the service, so no request is
+    /// sent.
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request for the part
+    ss::future<result<multipart_part, error_outcome>> upload_part(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request committing the parts
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      std::vector<multipart_part> parts,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     /// Send List Blobs request
     /// \param name is a container name
     /// \param prefix is an optional blob prefix to match
@@ -266,6 +324,20 @@ private:
       ss::lowres_clock::duration timeout,
       bool accept_no_content = false);
 
+    ss::future<multipart_part> do_put_block(
+      const bucket_name& name,
+      const object_key& key,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      const bucket_name& name,
+      const object_key& key,
+      std::vector<multipart_part> parts,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       const bucket_name& name,
       const object_key& key,
@@ -40,6 +40,11 @@ public:
     /// Shutdown the underlying connection
     virtual void shutdown() = 0;
 
+    /// Connect ahead of the next request. Never fails.
+    ///
+    /// \param timeout is a timeout of the connection attempt
+    virtual ss::future<> warm_up(ss::lowres_clock::duration timeout) = 0;
+
     /// Download object from cloud storage.
     ///
     /// \param name is a bucket name
@@ -91,6 +96,81 @@ public:
       bool accept_no_content = false)
       = 0;
 
+    /// An uploaded part of a multipart upload
+    struct multipart_part {
+        /// One-based position of the part in the object
+        size_t part_number;
+        /// Identifier of the uploaded part returned by the backend
+        ss::sstring etag;
+    };
+
+    /// Start a multipart upload. The parts of the upload can be sent
+    /// concurrently by different clients, the object becomes visible once the
+    /// upload is completed.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready with the id of the upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    create_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload a single part of a multipart upload
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param part_number is the one-based position of the part
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready with the uploaded part
+    virtual ss::future<result<multipart_part, error_outcome>> upload_part(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Assemble the object from the uploaded parts
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param parts are the uploaded parts ordered by part number
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the object is assembled
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      std::vector<multipart_part> parts,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Discard the parts of an upload that won't be completed
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the upload is aborted
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
     struct list_bucket_item {
         ss::sstring key;
         std::chrono::system_clock::time_point last_modified;
@@ -29,6 +29,7 @@ using namespace std::chrono_literals;
 namespace {
 constexpr auto self_configure_attempts = 3;
 constexpr auto self_configure_backoff = 1s;
+constexpr auto warm_up_timeout = 1s;
 } // namespace
 
 namespace cloud_storage_clients {
@@ -407,10 +408,27 @@ client_pool::acquire(ss::abort_source& as) {
       }),
       std::move(measurement));
     _leased.push_back(lease);
+    maybe_warm_up_next();
 
     co_return lease;
 }
 
+void client_pool::maybe_warm_up_next() {
+    if (
+      _warm_up_in_progress || _pool.empty() || _bg_gate.is_closed()
+      || _as.abort_requested()) {
+        return;
+    }
+    // Clients are leased from the back. The client stays in the pool while
+    // it connects, a request made on it waits for the warm up to finish.
+    _warm_up_in_progress = true;
+    ssx::spawn_with_gate(_bg_gate, [this, client = _pool.back()] {
+        return client->warm_up(warm_up_timeout).finally([this, client] {
+            _warm_up_in_progress = false;
+        });
+    });
+}
+
 void client_pool::update_usage_stats() {
     if (_probe) {
         _probe->register_utilization(normalized_num_clients_in_use());
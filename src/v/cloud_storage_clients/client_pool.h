@@ -160,6 +160,10 @@ private:
 
     void update_usage_stats();
 
+    /// Connect the client which will be leased next in the background, so
+    /// that the next acquire gets a client with a live connection.
+    void maybe_warm_up_next();
+
     ///  Wait for credentials to be acquired. Once credentials are acquired,
     ///  based on the policy, optionally wait for client pool to initialize.
     ss::future<> wait_for_credentials();
@@ -186,6 +190,7 @@ private:
     ss::condition_variable _credentials_var;
 
     ssx::semaphore _self_config_barrier{0, "self_config_barrier"};
+    bool _warm_up_in_progress{false};
 };
 
 } // namespace cloud_storage_clients
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage_clients/multipart_upload.h"
+
+#include "base/vlog.h"
+#include "cloud_storage_clients/logger.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+
+#include <boost/range/irange.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <vector>
+
+namespace cloud_storage_clients {
+
+size_t multipart_part_size(
+  size_t payload_size, const multipart_upload_config& cfg) noexcept {
+    const auto min_for_max_parts = (payload_size + multipart_max_parts - 1)
+                                   / multipart_max_parts;
+    return std::max({cfg.part_size, multipart_min_part_size, min_for_max_parts});
+}
+
+ss::future<result<client::no_response, error_outcome>> multipart_upload(
+  client_pool& pool,
+  ss::abort_source& as,
+  const bucket_name& name,
+  const object_key& key,
+  size_t payload_size,
+  part_stream_factory make_stream,
+  multipart_upload_config cfg) {
+    const auto part_size = multipart_part_size(payload_size, cfg);
+    const auto num_parts = std::max<size_t>(
+      (payload_size + part_size - 1) / part_size, 1);
+
+    ss::sstring upload_id;
+    {
+        auto lease = co_await pool.acquire(as);
+        auto res = co_await lease.client->create_multipart_upload(
+          name, key, cfg.timeout);
+        if (!res) {
+            co_return res.error();
+        }
+        upload_id = std::move(res.value());
+    }
+
+    vlog(
+      pool_log.debug,
+      "Uploading {} bytes to {} in {} parts of {} bytes, upload id {}",
+      payload_size,
+      key,
+      num_parts,
+      part_size,
+      upload_id);
+
+    std::vector<client::multipart_part> parts(num_parts);
+    std::optional<error_outcome> failure;
+    std::exception_ptr exception;
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, num_parts),
+      std::max<size_t>(cfg.max_concurrency, 1),
+      [&](size_t index) -> ss::future<> {
+          // stop dispatching parts after the first failure
+          if (failure.has_value() || exception) {
+              co_return;
+          }
+          const auto offset = index * part_size;
+          const auto size = std::min(part_size, payload_size - offset);
+          try {
+              auto lease = co_await pool.acquire(as);
+              auto res = co_await lease.client->upload_part(
+                name,
+                key,
+                upload_id,
+                index + 1,
+                size,
+                make_stream(offset, size),
+                cfg.timeout);
+              if (!res) {
+                  failure = failure.value_or(res.error());
+                  co_return;
+              }
+              parts[index] = std::move(res.value());
+          } catch (...) {
+              if (!exception) {
+                  exception = std::current_exception();
+              }
+          }
+      });
+
+    if (!failure.has_value() && !exception) {
+        auto lease = co_await pool.acquire(as);
+        co_return co_await lease.client->complete_multipart_upload(
+          name, key, upload_id, std::move(parts), cfg.timeout);
+    }
+
+    vlog(
+      pool_log.warn,
+      "Aborting multipart upload {} of {}: {}",
+      upload_id,
+      key,
+      failure.has_value() ? fmt::format("{}", *failure)
+                          : fmt::format("{}", exception));
+    if (!as.abort_requested()) {
+        try {
+            auto lease = co_await pool.acquire(as);
+            auto res = co_await lease.client->abort_multipart_upload(
+              name, key, upload_id, cfg.timeout);
+            if (!res) {
+                vlog(
+                  pool_log.warn,
+                  "Failed to abort multipart upload {} of {}: {}",
+                  upload_id,
+                  key,
+                  res.error());
+            }
+        } catch (...) {
+            vlog(
+              pool_log.warn,
+              "Failed to abort multipart upload {} of {}: {}",
+              upload_id,
+              key,
+              std::current_exception());
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    co_return *failure;
+}
+
+} // namespace cloud_storage_clients
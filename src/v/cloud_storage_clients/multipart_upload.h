@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/outcome.h"
+#include "base/units.h"
+#include "cloud_storage_clients/client.h"
+#include "cloud_storage_clients/client_pool.h"
+#include "cloud_storage_clients/types.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+namespace cloud_storage_clients {
+
+/// Smallest part accepted by S3, except for the last part of an upload
+inline constexpr size_t multipart_min_part_size = 5_MiB;
+/// Largest number of parts of an S3 upload
+inline constexpr size_t multipart_max_parts = 10000;
+
+/// Produces the body of the byte range [offset, offset + size) of the
+/// uploaded object. Invoked once per part, concurrently for different parts.
+using part_stream_factory = ss::noncopyable_function<ss::input_stream<char>(
+  size_t offset, size_t size)>;
+
+struct multipart_upload_config {
+    /// Target size of the parts. Raised to multipart_min_part_size and to the
+    /// size that keeps the upload under multipart_max_parts.
+    size_t part_size{64_MiB};
+    /// Number of parts uploaded at the same time, each over its own client
+    /// leased from the pool.
+    size_t max_concurrency{4};
+    /// Timeout of each request
+    ss::lowres_clock::duration timeout{http::default_connect_timeout};
+};
+
+/// Upload an object as a multipart upload (a block list on ABS) whose parts
+/// are sent in parallel over several connections of the pool, so that the
+/// throughput of a large upload isn't limited by a single stream.
+///
+/// The upload is aborted if any part fails, and the error of the first
+/// failed request is returned. Parts are not retried individually: callers
+/// retry the whole upload like they would retry a put_object.
+///
+/// \param pool is the pool the clients are leased from
+/// \param as aborts the upload
+/// \param name is a bucket name
+/// \param key is an id of the object
+/// \param payload_size is a size of the object in bytes
+/// \param make_stream produces the body of every part
+/// \param cfg controls the size and concurrency of the parts
+/// \return future that becomes ready when the object is assembled
+ss::future<result<client::no_response, error_outcome>> multipart_upload(
+  client_pool& pool,
+  ss::abort_source& as,
+  const bucket_name& name,
+  const object_key& key,
+  size_t payload_size,
+  part_stream_factory make_stream,
+  multipart_upload_config cfg = {});
+
+/// Size of the parts used to upload \p payload_size bytes with \p cfg
+size_t multipart_part_size(
+  size_t payload_size, const multipart_upload_config& cfg) noexcept;
+
+} // namespace cloud_storage_clients
@@ -369,6 +369,189 @@ request_creator::make_delete_objects_request(
         std::make_unique<delete_objects_body>(std::move(body))}}};
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  const bucket_name& name, const object_key& key) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateMultipartUpload.html
+    //
+    // Virtual Style:
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // POST /{bucket-name}/{object-id}?uploads HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Content-Type: text/plain
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name, object_key{fmt::format("{}?uploads", key().string())});
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size_bytes) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_UploadPart.html
+    //
+    // Virtual Style:
+    // PUT /{object-id}?partNumber={part}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // PUT /{bucket-name}/{object-id}?partNumber={part}&uploadId={upload-id}
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Content-Length: {payload-size}
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // [payload-size bytes of part data]
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format(
+        "{}?partNumber={}&uploadId={}",
+        key().string(),
+        part_number,
+        upload_id)});
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  std::span<const client::multipart_part> parts) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+    //
+    // Virtual Style:
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // POST /{bucket-name}/{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // Content-Length: <...>
+    //
+    // <?xml version="1.0" encoding="UTF-8"?>
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <ETag>etag</ETag>
+    //         <PartNumber>1</PartNumber>
+    //     </Part>
+    //     ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        for (auto part_tree = boost::property_tree::ptree{};
+             const auto& part : parts) {
+            part_tree.put("ETag", part.etag.c_str());
+            part_tree.put("PartNumber", part.part_number);
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::post);
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format("{}?uploadId={}", key().string(), upload_id)});
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    return {
+      std::move(header),
+      ss::input_stream<char>{ss::data_source{
+        std::make_unique<delete_objects_body>(std::move(body))}}};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id) {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_AbortMultipartUpload.html
+    //
+    // Virtual Style:
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.{region}.amazonaws.com
+    // Path Style:
+    // DELETE /{bucket-name}/{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: s3.{region}.amazonaws.com
+    //
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = make_host(name);
+    auto target = make_target(
+      name,
+      object_key{fmt::format("{}?uploadId={}", key().string(), upload_id)});
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 std::string request_creator::make_host(const bucket_name& name) const {
     switch (_ap_style) {
     case s3_url_style::virtual_host:
@@ -633,6 +816,10 @@ ss::future<> s3_client::stop() { return _client.stop(); }
 
 void s3_client::shutdown() { _client.shutdown_now(); }
 
+ss::future<> s3_client::warm_up(ss::lowres_clock::duration timeout) {
+    return _client.warm_up(timeout);
+}
+
 ss::future<result<http::client::response_stream_ref, error_outcome>>
 s3_client::get_object(
   const bucket_name& name,
@@ -859,6 +1046,229 @@ ss::future<> s3_client::do_put_object(
       });
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::create_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_create_multipart_upload(name, key, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_create_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(name, key);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CreateMultipartUpload request failed for key {}: {} {:l}",
+          key,
+          status,
+          ref->get_headers());
+        co_return co_await parse_rest_error_response<ss::sstring>(
+          status, std::move(res));
+    }
+    auto parse_result = iobuf_to_create_multipart_upload_result(
+      std::move(res));
+    if (std::holds_alternative<rest_error_response>(parse_result)) {
+        throw std::get<rest_error_response>(parse_result);
+    }
+    co_return std::get<ss::sstring>(std::move(parse_result));
+}
+
+ss::future<result<s3_client::multipart_part, error_outcome>>
+s3_client::upload_part(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name,
+        key,
+        upload_id,
+        part_number,
+        payload_size,
+        std::move(body),
+        timeout),
+      name,
+      key);
+}
+
+ss::future<s3_client::multipart_part> s3_client::do_upload_part(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        co_await body.close();
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    try {
+        auto ref = co_await _client
+                     .request(std::move(header.value()), body, timeout)
+                     .finally([&body] { return body.close(); });
+        auto res = co_await util::drain_response_stream(ref);
+        auto status = ref->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 UploadPart request failed for key {} part {}: {} {:l}",
+              key,
+              part_number,
+              status,
+              ref->get_headers());
+            co_await parse_rest_error_response<>(status, std::move(res));
+        }
+        auto etag = ref->get_headers().at(boost::beast::http::field::etag);
+        co_return multipart_part{
+          .part_number = part_number,
+          .etag = ss::sstring(etag.data(), etag.length()),
+        };
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  std::vector<multipart_part> parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(
+        name, key, upload_id, std::move(parts), timeout)
+        .then(
+          []() { return ss::make_ready_future<no_response>(no_response{}); }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  std::vector<multipart_part> parts,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, parts);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send CompleteMultipartUpload request:\n{}", header);
+
+    auto ref = co_await _client.request(std::move(header), body, timeout)
+                 .finally([&body] { return body.close(); });
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CompleteMultipartUpload request failed for key {}: {} {:l}",
+          key,
+          status,
+          ref->get_headers());
+        co_await parse_rest_error_response<>(status, std::move(res));
+    }
+    // S3 can reply with 200 and an error in the body if the upload fails
+    // after the response headers were sent.
+    auto root = util::iobuf_to_ptree(std::move(res), s3_log);
+    if (auto code = root.get_optional<ss::sstring>("Error.Code"); code) {
+        constexpr const char* empty = "";
+        throw rest_error_response(
+          *code,
+          root.get<ss::sstring>("Error.Message", empty),
+          root.get<ss::sstring>("Error.RequestId", empty),
+          root.get<ss::sstring>("Error.Resource", empty));
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([] {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  const bucket_name& name,
+  const object_key& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::no_content
+      && status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 AbortMultipartUpload request failed for key {}: {} {:l}",
+          key,
+          status,
+          ref->get_headers());
+        co_await parse_rest_error_response<>(status, std::move(res));
+    }
+}
+
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_create_multipart_upload_result(iobuf&& buf) {
+    auto root = util::iobuf_to_ptree(std::move(buf), s3_log);
+    if (auto code = root.get_optional<ss::sstring>("Error.Code"); code) {
+        constexpr const char* empty = "";
+        return rest_error_response(
+          *code,
+          root.get<ss::sstring>("Error.Message", empty),
+          root.get<ss::sstring>("Error.RequestId", empty),
+          root.get<ss::sstring>("Error.Resource", empty));
+    }
+    auto upload_id = root.get_optional<ss::sstring>(
+      "InitiateMultipartUploadResult.UploadId");
+    if (!upload_id.has_value() || upload_id->empty()) {
+        return rest_error_response(
+          "InternalError",
+          "CreateMultipartUpload response has no UploadId",
+          "",
+          "");
+    }
+    return std::move(*upload_id);
+}
+
 ss::future<result<s3_client::list_bucket_result, error_outcome>>
 s3_client::list_objects(
   const bucket_name& name,
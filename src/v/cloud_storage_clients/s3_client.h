@@ -89,6 +89,54 @@ public:
     make_delete_objects_request(
       const bucket_name& name, std::span<const object_key> keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      const bucket_name& name, const object_key& key);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \param part_number is the one-based position of the part
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_unsigned_upload_part_request(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header and body
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \param parts are the uploaded parts ordered by part number
+    /// \return the header and an the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_complete_multipart_upload_request(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      std::span<const client::multipart_part> parts);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket that has the upload
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id);
+
     /// \brief Initialize http header for 'ListObjectsV2' request
     ///
     /// \param name of the bucket
@@ -143,6 +191,8 @@ public:
     /// Shutdown the underlying connection
     void shutdown() override;
 
+    ss::future<> warm_up(ss::lowres_clock::duration timeout) override;
+
     /// Download object from S3 bucket
     ///
     /// \param name is a bucket name
@@ -201,6 +251,33 @@ public:
       std::vector<object_key> keys,
       ss::lowres_clock::duration timeout) override;
 
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<multipart_part, error_outcome>> upload_part(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      std::vector<multipart_part> parts,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
 private:
     ss::future<head_object_result> do_head_object(
       const bucket_name& name,
@@ -242,6 +319,33 @@ private:
       std::span<const object_key> keys,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_create_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<multipart_part> do_upload_part(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_complete_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      std::vector<multipart_part> parts,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_abort_multipart_upload(
+      const bucket_name& name,
+      const object_key& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout);
+
     template<typename T>
     ss::future<result<T, error_outcome>> send_request(
       ss::future<T> request_future,
@@ -263,4 +367,7 @@ private:
 std::variant<client::delete_objects_result, rest_error_response>
 iobuf_to_delete_objects_result(iobuf&& buf);
 
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_create_multipart_upload_result(iobuf&& buf);
+
 } // namespace cloud_storage_clients
@@ -9,10 +9,12 @@
  */
 
 #include "base/seastarx.h"
+#include "base/units.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "cloud_storage_clients/client_pool.h"
+#include "cloud_storage_clients/multipart_upload.h"
 #include "cloud_storage_clients/s3_client.h"
 #include "hashing/secure.h"
 #include "net/dns.h"
@@ -41,6 +43,7 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/beast/http/field.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/property_tree/ptree_fwd.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include <boost/test/tools/old/interface.hpp>
@@ -48,6 +51,7 @@
 
 #include <chrono>
 #include <exception>
+#include <map>
 
 using namespace std::chrono_literals;
 
@@ -114,6 +118,27 @@ constexpr auto delete_objects_payload_error = R"xml(
     </Error>
 )xml";
 
+static constexpr const char* multipart_upload_id = "test-upload-id";
+static constexpr auto create_multipart_upload_payload = R"xml(
+<?xml version="1.0" encoding="UTF-8"?>
+<InitiateMultipartUploadResult>
+    <Bucket>test-bucket</Bucket>
+    <Key>test-multipart</Key>
+    <UploadId>test-upload-id</UploadId>
+</InitiateMultipartUploadResult>
+)xml";
+static constexpr auto complete_multipart_upload_payload = R"xml(
+<?xml version="1.0" encoding="UTF-8"?>
+<CompleteMultipartUploadResult>
+    <Key>test-multipart</Key>
+    <ETag>"test-etag"</ETag>
+</CompleteMultipartUploadResult>
+)xml";
+
+/// Parts received by the multipart upload handlers, keyed by part number
+static std::map<size_t, ss::sstring> multipart_parts; // NOLINT
+static bool multipart_aborted = false;                // NOLINT
+
 static constexpr auto no_such_config_payload = R"xml(
 <?xml version="1.0" encoding="UTF-8"?>
 <Error>
@@ -288,6 +313,53 @@ void set_routes(ss::httpd::routes& r) {
           return no_such_config_payload;
       },
       "txt");
+    auto multipart_post_response = new function_handler(
+      [](const_req req, reply& reply) -> std::string {
+          if (req.query_parameters.contains("uploads")) {
+              return create_multipart_upload_payload;
+          }
+          BOOST_REQUIRE_EQUAL(
+            req.get_query_param("uploadId"), multipart_upload_id);
+          auto buffer_stream = std::istringstream{std::string{req.content}};
+          auto tree = boost::property_tree::ptree{};
+          boost::property_tree::read_xml(buffer_stream, tree);
+          size_t expected_part = 1;
+          for (const auto& [tag, value] :
+               tree.get_child("CompleteMultipartUpload")) {
+              BOOST_REQUIRE_EQUAL(tag, "Part");
+              auto part_number = value.get<size_t>("PartNumber");
+              BOOST_REQUIRE_EQUAL(part_number, expected_part++);
+              BOOST_REQUIRE_EQUAL(
+                value.get<std::string>("ETag"),
+                fmt::format("etag-{}", part_number));
+          }
+          if (expected_part - 1 != multipart_parts.size()) {
+              reply.set_status(reply::status_type::bad_request);
+              return "missing parts";
+          }
+          return complete_multipart_upload_payload;
+      },
+      "txt");
+    auto multipart_put_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(
+            req.get_query_param("uploadId"), multipart_upload_id);
+          auto part_number = boost::lexical_cast<size_t>(
+            req.get_query_param("partNumber"));
+          multipart_parts[part_number] = req.content;
+          reply.add_header("ETag", fmt::format("etag-{}", part_number));
+          return "";
+      },
+      "txt");
+    auto multipart_delete_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(
+            req.get_query_param("uploadId"), multipart_upload_id);
+          multipart_aborted = true;
+          reply.set_status(reply::status_type::no_content);
+          return "";
+      },
+      "txt");
     r.add(operation_type::PUT, url("/test"), empty_put_response);
     r.add(operation_type::PUT, url("/test-error"), erroneous_put_response);
     r.add(operation_type::GET, url("/test"), get_response);
@@ -312,6 +384,13 @@ void set_routes(ss::httpd::routes& r) {
       url("/test-put-no-content"),
       put_response_no_content);
     r.add(operation_type::GET, url("/no-config"), no_such_config);
+    r.add(
+      operation_type::POST, url("/test-multipart"), multipart_post_response);
+    r.add(operation_type::PUT, url("/test-multipart"), multipart_put_response);
+    r.add(
+      operation_type::DELETE,
+      url("/test-multipart"),
+      multipart_delete_response);
 }
 
 /// Http server and client
@@ -922,6 +1001,57 @@ FIXTURE_TEST(test_client_pool_reconnect, client_pool_fixture) {
     BOOST_REQUIRE(count == 20);
 }
 
+FIXTURE_TEST(test_multipart_upload, client_pool_fixture) {
+    multipart_parts.clear();
+    multipart_aborted = false;
+
+    // three full parts and a short one
+    const auto part_size = cloud_storage_clients::multipart_min_part_size;
+    const auto payload_size = 3 * part_size + 1000;
+    ss::sstring payload(payload_size, 'x');
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<char>('a' + (i / part_size));
+    }
+
+    ss::abort_source never_abort;
+    auto result = cloud_storage_clients::multipart_upload(
+                    pool.local(),
+                    never_abort,
+                    cloud_storage_clients::bucket_name("test-bucket"),
+                    cloud_storage_clients::object_key("test-multipart"),
+                    payload_size,
+                    [&payload](size_t offset, size_t size) {
+                        iobuf buf;
+                        buf.append(payload.data() + offset, size);
+                        return make_iobuf_input_stream(std::move(buf));
+                    },
+                    {.part_size = part_size,
+                     .max_concurrency = 2,
+                     .timeout = 10s})
+                    .get();
+    BOOST_REQUIRE(result);
+    BOOST_REQUIRE(!multipart_aborted);
+
+    BOOST_REQUIRE_EQUAL(multipart_parts.size(), 4);
+    ss::sstring assembled;
+    for (const auto& [part_number, content] : multipart_parts) {
+        assembled += content;
+    }
+    BOOST_REQUIRE(assembled == payload);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_multipart_part_size) {
+    using namespace cloud_storage_clients;
+    const multipart_upload_config cfg{.part_size = 1_MiB};
+    // parts are never smaller than the S3 minimum
+    BOOST_REQUIRE_EQUAL(multipart_part_size(10_MiB, cfg), 5_MiB);
+    // large objects get larger parts to stay under the part limit
+    const auto huge = 100_GiB;
+    const auto part_size = multipart_part_size(huge, cfg);
+    BOOST_REQUIRE_LE(
+      (huge + part_size - 1) / part_size, multipart_max_parts);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_parse_delete_object_response_infra_error) {
     const ss::sstring xml_response
       = "<Error><Code>SlowDown</Code><Message>Please reduce your request "
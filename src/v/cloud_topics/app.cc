@@ -11,18 +11,33 @@
 #include "cloud_topics/app.h"
 
 #include "cloud_topics/reconciler/reconciler.h"
+#include "cloud_topics/throttler/resource_governor.h"
+#include "config/configuration.h"
+
+#include <seastar/core/coroutine.hh>
 
 namespace experimental::cloud_topics::reconciler {
 
 app::app(
   seastar::sharded<cluster::partition_manager>* partition_manager,
   seastar::sharded<cloud_io::remote>* remote)
-  : _reconciler(std::make_unique<reconciler>(partition_manager, remote)) {}
+  : _governor(std::make_unique<resource_governor<>>(
+      resource_governor<>::limits{
+        .upload_bytes_per_sec
+        = config::shard_local_cfg().cloud_storage_max_throughput_per_shard(),
+        .download_bytes_per_sec
+        = config::shard_local_cfg().cloud_storage_max_throughput_per_shard(),
+      }))
+  , _reconciler(std::make_unique<reconciler>(
+      partition_manager, remote, std::nullopt, _governor.get())) {}
 
 app::~app() = default;
 
 seastar::future<> app::start() { return _reconciler->start(); }
 
-seastar::future<> app::stop() { return _reconciler->stop(); }
+seastar::future<> app::stop() {
+    co_await _reconciler->stop();
+    _governor->stop();
+}
 
 } // namespace experimental::cloud_topics::reconciler
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/sharded.hh>
 
 #include <memory>
@@ -23,6 +24,11 @@ namespace cloud_io {
 class remote;
 }
 
+namespace experimental::cloud_topics {
+template<class Clock>
+class resource_governor;
+}
+
 namespace experimental::cloud_topics::reconciler {
 
 class reconciler;
@@ -43,6 +49,8 @@ public:
     seastar::future<> stop();
 
 private:
+    // shard local limits on the object storage traffic of cloud topics
+    std::unique_ptr<resource_governor<seastar::lowres_clock>> _governor;
     std::unique_ptr<reconciler> _reconciler;
 };
 
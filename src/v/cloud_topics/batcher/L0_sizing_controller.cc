@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_topics/batcher/L0_sizing_controller.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace experimental::cloud_topics {
+
+L0_sizing_controller::L0_sizing_controller(duration latency_target) noexcept
+  : _latency_target(latency_target) {}
+
+void L0_sizing_controller::set_latency_target(duration target) noexcept {
+    _latency_target = target;
+}
+
+void L0_sizing_controller::record_collection(
+  size_t bytes, duration elapsed) noexcept {
+    _sample_bytes += bytes;
+    _sample_elapsed += elapsed;
+    if (_sample_elapsed < min_upload_interval) {
+        return;
+    }
+    auto rate = static_cast<double>(_sample_bytes) * 1000.0
+                / static_cast<double>(_sample_elapsed.count());
+    _sample_bytes = 0;
+    _sample_elapsed = duration{0};
+    if (!_has_arrival_rate) {
+        _arrival_rate = rate;
+        _has_arrival_rate = true;
+        return;
+    }
+    _arrival_rate += smoothing * (rate - _arrival_rate);
+}
+
+void L0_sizing_controller::record_upload(duration put_latency) noexcept {
+    auto latency = static_cast<double>(put_latency.count());
+    if (!_has_put_latency) {
+        _put_latency_ms = latency;
+        _has_put_latency = true;
+        return;
+    }
+    _put_latency_ms += smoothing * (latency - _put_latency_ms);
+}
+
+L0_sizing_controller::duration
+L0_sizing_controller::upload_interval() const noexcept {
+    auto budget = static_cast<double>(_latency_target.count())
+                  - _put_latency_ms;
+    auto interval = duration(std::lround(budget));
+    // If the PUT latency alone exceeds the target the uploads are as
+    // frequent as possible
+    return std::clamp(
+      interval,
+      min_upload_interval,
+      std::max(min_upload_interval, _latency_target));
+}
+
+size_t L0_sizing_controller::upload_threshold() const noexcept {
+    if (!_has_arrival_rate) {
+        return max_upload_threshold;
+    }
+    auto interval_s = static_cast<double>(upload_interval().count()) / 1000.0;
+    auto expected = 2.0 * _arrival_rate * interval_s;
+    if (expected >= static_cast<double>(max_upload_threshold)) {
+        return max_upload_threshold;
+    }
+    return std::max(min_upload_threshold, static_cast<size_t>(expected));
+}
+
+} // namespace experimental::cloud_topics
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/units.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace experimental::cloud_topics {
+
+/// Picks how long the batcher accumulates write requests and how large the
+/// L0 object can grow before it is uploaded.
+///
+/// A write request which arrives right after an upload waits for the whole
+/// upload interval and then for the PUT request, so the interval is the
+/// latency target minus the observed PUT latency. Within that budget the
+/// interval is as long as possible, every PUT has a fixed cost and larger
+/// objects amortize it. The size threshold is twice the number of bytes
+/// expected to arrive during the interval, it only triggers an early upload
+/// when the produce rate spikes.
+class L0_sizing_controller {
+public:
+    using duration = std::chrono::milliseconds;
+
+    static constexpr duration min_upload_interval{10};
+    static constexpr size_t min_upload_threshold = 1_MiB;
+    static constexpr size_t max_upload_threshold = 10_MiB;
+
+    explicit L0_sizing_controller(duration latency_target) noexcept;
+
+    /// Update the latency target, e.g. after a config change
+    void set_latency_target(duration) noexcept;
+
+    /// Account for \p bytes which were collected \p elapsed after the
+    /// previous collection
+    void record_collection(size_t bytes, duration elapsed) noexcept;
+
+    /// Account for a successful PUT request
+    void record_upload(duration put_latency) noexcept;
+
+    /// How long to wait for new write requests before uploading
+    duration upload_interval() const noexcept;
+
+    /// Number of pending bytes at which the upload starts early
+    size_t upload_threshold() const noexcept;
+
+    duration latency_target() const noexcept { return _latency_target; }
+    /// Smoothed PUT latency, in milliseconds
+    double put_latency() const noexcept { return _put_latency_ms; }
+    /// Smoothed produce rate, in bytes per second
+    double arrival_rate() const noexcept { return _arrival_rate; }
+
+private:
+    /// Weight of the newest sample in the moving averages
+    static constexpr double smoothing = 0.2;
+
+    duration _latency_target;
+    double _put_latency_ms{0};
+    double _arrival_rate{0};
+    bool _has_put_latency{false};
+    bool _has_arrival_rate{false};
+    /// Collections which are too close to each other to give a meaningful
+    /// rate are merged into one sample
+    size_t _sample_bytes{0};
+    duration _sample_elapsed{0};
+};
+
+} // namespace experimental::cloud_topics
@@ -18,6 +18,7 @@
 #include "cloud_topics/core/write_request.h"
 #include "cloud_topics/errc.h"
 #include "cloud_topics/logger.h"
+#include "cloud_topics/reader/l0_object_cache.h"
 #include "cloud_topics/types.h"
 #include "config/configuration.h"
 #include "ssx/sformat.h"
@@ -28,6 +29,7 @@
 
 #include <chrono>
 #include <exception>
+#include <utility>
 
 using namespace std::chrono_literals;
 
@@ -37,18 +39,27 @@ template<class Clock>
 batcher<Clock>::batcher(
   core::write_pipeline<Clock>& pipeline,
   cloud_storage_clients::bucket_name bucket,
-  cloud_io::remote_api<Clock>& remote_api)
+  cloud_io::remote_api<Clock>& remote_api,
+  L0_object_cache* L0_cache,
+  resource_governor<Clock>* governor)
   : _remote(remote_api)
   , _bucket(std::move(bucket))
   , _upload_timeout(
       config::shard_local_cfg().cloud_storage_segment_upload_timeout_ms.bind())
-  , _upload_interval(config::shard_local_cfg()
-                       .cloud_storage_upload_loop_initial_backoff_ms
-                       .bind()) // TODO: use different config
+  , _latency_target(
+      config::shard_local_cfg().cloud_topics_produce_latency_target_ms.bind())
+  , _sizing(_latency_target())
+  , _probe(_sizing)
+  , _last_collection(Clock::now())
   , _pipeline(pipeline)
   , _rtc(_as)
   , _logger(cd_log, _rtc)
-  , _my_stage(_pipeline.register_pipeline_stage()) {}
+  , _my_stage(_pipeline.register_pipeline_stage())
+  , _L0_cache(L0_cache)
+  , _governor(governor) {
+    _latency_target.watch(
+      [this] { _sizing.set_latency_target(_latency_target()); });
+}
 
 template<class Clock>
 ss::future<> batcher<Clock>::start() {
@@ -74,7 +85,22 @@ batcher<Clock>::upload_object(object_id id, iobuf payload) {
     // TODO: this should be replaced with the proper name
     auto name = ssx::sformat("{}", id);
 
+    ssx::semaphore_units governor_units;
+    if (_governor != nullptr) {
+        auto admitted = co_await _governor->acquire_upload(
+          content_length, _as);
+        if (admitted.has_error()) {
+            vlog(
+              _logger.warn,
+              "L0 upload is not admitted: {}",
+              admitted.error().message());
+            co_return admitted.error();
+        }
+        governor_units = std::move(admitted.value());
+    }
+
     auto err = errc::success;
+    auto started = Clock::now();
     try {
         // Clock type is not parametrized further down the call chain.
         basic_retry_chain_node<Clock> local_rtc(
@@ -122,16 +148,28 @@ batcher<Clock>::upload_object(object_id id, iobuf payload) {
 
     if (err != errc::success) {
         vlog(_logger.error, "L0 upload error: {}", err);
+        if (err != errc::shutting_down) {
+            _probe.upload_failure();
+            if (_governor != nullptr) {
+                _governor->record_failure();
+            }
+        }
         co_return err;
     }
+    if (_governor != nullptr) {
+        _governor->record_success();
+    }
 
+    _sizing.record_upload(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - started));
+    _probe.upload(content_length);
     co_return content_length;
-    ;
 }
 
 template<class Clock>
 ss::future<errc> batcher<Clock>::wait_for_next_upload() noexcept {
-    auto deadline = Clock::now() + _upload_interval();
+    auto deadline = Clock::now() + _sizing.upload_interval();
     while (true) {
         core::event_filter<Clock> filter(
           core::event_type::new_write_request, _my_stage, deadline);
@@ -149,7 +187,7 @@ ss::future<errc> batcher<Clock>::wait_for_next_upload() noexcept {
         case core::event_type::shutting_down:
             co_return errc::shutting_down;
         case core::event_type::new_write_request:
-            if (event.pending_write_bytes < 10_MiB) {
+            if (event.pending_write_bytes < _sizing.upload_threshold()) {
                 // Ignore all write requests until timed
                 // out or enough data.
                 break;
@@ -165,59 +203,103 @@ ss::future<errc> batcher<Clock>::wait_for_next_upload() noexcept {
     co_return errc::success;
 }
 
+template<class Clock>
+std::optional<typename batcher<Clock>::prepared_upload>
+batcher<Clock>::prepare_upload() {
+    // NOTE: the main workflow looks like this:
+    // - remove expired write requests
+    // - collect write requests which can be aggregated/uploaded as L0
+    //   object
+    // - create 'aggregator' and fill it with write requests (the
+    //   requests which are added to the aggregator shouldn't be removed
+    //   from _pending list)
+    // - the 'aggregator' is used to generate L0 object and upload it
+    // - the 'aggregator' is used to acknowledge (either success or
+    //   failure) all aggregated write requests
+    //
+    // The invariants here are:
+    // 1. expired write requests shouldn't be added to the 'aggregator'
+    // 2. if the request is added to the 'aggregator' its promise
+    //    shouldn't be set
+    //
+    // The first invariant is enforced by calling
+    // 'remote_timed_out_write_requests' in the same time slice as
+    // collecting the write requests. The second invariant is enforced
+    // by the strict order in which the ack() method is called
+    // explicitly after the operation is either committed or failed.
+
+    auto list = _pipeline.get_write_requests(
+      L0_sizing_controller::max_upload_threshold, _my_stage);
+
+    if (list.ready.empty()) {
+        return std::nullopt;
+    }
+
+    prepared_upload upload{
+      .aggr = std::make_unique<aggregator<Clock>>(),
+      .complete = list.complete,
+    };
+    while (!list.ready.empty()) {
+        auto& wr = list.ready.back();
+        wr._hook.unlink();
+        upload.aggr->add(wr);
+    }
+    // TODO: skip waiting if list.completed is not true
+    upload.payload = upload.aggr->prepare();
+
+    auto now = Clock::now();
+    _sizing.record_collection(
+      upload.payload.size_bytes(),
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - std::exchange(_last_collection, now)));
+    if (_L0_cache != nullptr) {
+        upload.cached_payload = upload.payload.share(
+          0, upload.payload.size_bytes());
+    }
+    return upload;
+}
+
+template<class Clock>
+ss::future<result<void>> batcher<Clock>::upload_and_ack(
+  prepared_upload upload, std::optional<ss::shared_future<>> previous_ack) {
+    auto& aggregator = *upload.aggr;
+    auto uploaded = co_await upload_object(
+      aggregator.get_object_id(), std::move(upload.payload));
+    if (previous_ack.has_value()) {
+        co_await previous_ack->get_future();
+    }
+    if (uploaded.has_error()) {
+        // TODO: fix the error
+        // NOTE: it should be possible to translate the
+        // error to kafka error at the call site but I
+        // don't want to depend on kafka layer directly.
+        // Timeout should work well at this point.
+        aggregator.ack_error(errc::timeout);
+        co_return uploaded.error();
+    }
+    // Populate the cache before the placeholders are propagated, so
+    // the object is in memory by the time the first reader sees them.
+    if (upload.cached_payload.has_value()) {
+        _L0_cache->insert(
+          aggregator.get_object_id(), std::move(upload.cached_payload.value()));
+    }
+    aggregator.ack();
+    co_return outcome::success();
+}
+
 template<class Clock>
 ss::future<result<bool>> batcher<Clock>::run_once() noexcept {
     try {
-        // NOTE: the main workflow looks like this:
-        // - remove expired write requests
-        // - collect write requests which can be aggregated/uploaded as L0
-        //   object
-        // - create 'aggregator' and fill it with write requests (the
-        //   requests which are added to the aggregator shouldn't be removed
-        //   from _pending list)
-        // - the 'aggregator' is used to generate L0 object and upload it
-        // - the 'aggregator' is used to acknowledge (either success or
-        //   failure) all aggregated write requests
-        //
-        // The invariants here are:
-        // 1. expired write requests shouldn't be added to the 'aggregator'
-        // 2. if the request is added to the 'aggregator' its promise
-        //    shouldn't be set
-        //
-        // The first invariant is enforced by calling
-        // 'remote_timed_out_write_requests' in the same time slice as
-        // collecting the write requests. The second invariant is enforced
-        // by the strict order in which the ack() method is called
-        // explicitly after the operation is either committed or failed.
-
-        auto list = _pipeline.get_write_requests(
-          10_MiB, _my_stage); // TODO: use configuration parameter
-
-        if (list.ready.empty()) {
+        auto upload = prepare_upload();
+        if (!upload.has_value()) {
             co_return true;
         }
-
-        aggregator<Clock> aggregator;
-        while (!list.ready.empty()) {
-            auto& wr = list.ready.back();
-            wr._hook.unlink();
-            aggregator.add(wr);
-        }
-        // TODO: skip waiting if list.completed is not true
-        auto payload = aggregator.prepare();
-        auto result = co_await upload_object(
-          aggregator.get_object_id(), std::move(payload));
-        if (result.has_error()) {
-            // TODO: fix the error
-            // NOTE: it should be possible to translate the
-            // error to kafka error at the call site but I
-            // don't want to depend on kafka layer directly.
-            // Timeout should work well at this point.
-            aggregator.ack_error(errc::timeout);
-            co_return result.error();
+        auto complete = upload->complete;
+        auto res = co_await upload_and_ack(std::move(upload.value()));
+        if (res.has_error()) {
+            co_return res.error();
         }
-        aggregator.ack();
-        co_return list.complete;
+        co_return complete;
     } catch (...) {
         auto err = std::current_exception();
         if (ssx::is_shutdown_exception(err)) {
@@ -246,18 +328,64 @@ ss::future<> batcher<Clock>::bg_controller_loop() {
                 co_return;
             }
         }
-        auto res = co_await run_once();
-        if (res.has_error()) {
-            if (res.error() == errc::shutting_down) {
-                vlog(_logger.info, "Batcher upload loop is shutting down");
-                co_return;
-            } else {
-                // Some other (most likely upload) error
-                vlog(
-                  _logger.info, "Batcher upload loop error: {}", res.error());
-                more_work = true;
-            }
+        auto units_fut = co_await ss::coroutine::as_future(
+          ss::get_units(_inflight_uploads, 1, _as));
+        if (units_fut.failed()) {
+            auto err = units_fut.get_exception();
+            vlog(_logger.info, "Batcher upload loop is shutting down {}", err);
+            co_return;
         }
+        auto units = units_fut.get();
+
+        std::optional<prepared_upload> upload;
+        try {
+            upload = prepare_upload();
+        } catch (...) {
+            vlog(
+              _logger.error,
+              "Unexpected batcher error: {}",
+              std::current_exception());
+            more_work = false;
+            continue;
+        }
+        if (!upload.has_value()) {
+            more_work = false;
+            continue;
+        }
+        more_work = !upload->complete;
+
+        // The acks are chained, so that they happen in the order in which
+        // uploads are started.
+        ss::promise<> acked;
+        auto previous_ack = std::exchange(
+          _last_ack, ss::shared_future<>(acked.get_future()));
+        ssx::spawn_with_gate(
+          _gate,
+          [this,
+           upload = std::move(upload.value()),
+           previous_ack = std::move(previous_ack),
+           acked = std::move(acked),
+           units = std::move(units)]() mutable {
+              return upload_and_ack(std::move(upload), std::move(previous_ack))
+                .then_wrapped([this, acked = std::move(acked)](
+                                ss::future<result<void>> fut) mutable {
+                    acked.set_value();
+                    if (fut.failed()) {
+                        vlog(
+                          _logger.error,
+                          "Unexpected batcher error: {}",
+                          fut.get_exception());
+                    } else if (auto res = fut.get(); res.has_error()) {
+                        // Most likely an upload error, the write requests are
+                        // acknowledged with an error.
+                        vlog(
+                          _logger.info,
+                          "Batcher upload error: {}",
+                          res.error());
+                    }
+                })
+                .finally([units = std::move(units)] {});
+          });
     }
 }
 
@@ -14,12 +14,16 @@
 #include "base/seastarx.h"
 #include "base/units.h"
 #include "bytes/iobuf.h"
+#include "cloud_topics/batcher/L0_sizing_controller.h"
+#include "cloud_topics/batcher/batcher_probe.h"
 #include "cloud_topics/core/pipeline_stage.h"
 #include "cloud_topics/core/write_pipeline.h"
+#include "cloud_topics/throttler/resource_governor.h"
 #include "cloud_topics/types.h"
 #include "config/property.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
+#include "ssx/semaphore.h"
 #include "utils/retry_chain_node.h"
 #include "utils/uuid.h"
 
@@ -28,10 +32,13 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_future.hh>
 
 #include <absl/container/btree_map.h>
 
 #include <chrono>
+#include <memory>
+#include <optional>
 
 namespace cloud_io {
 template<typename Clock>
@@ -40,6 +47,11 @@ class remote_api;
 
 namespace experimental::cloud_topics {
 
+class L0_object_cache;
+
+template<class Clock>
+class aggregator;
+
 struct batcher_result {
     uuid_t uuid;
     // Reader that contains placeholder batches. Batches
@@ -63,15 +75,49 @@ class batcher {
     friend struct batcher_accessor;
 
 public:
+    /// If \p L0_cache is provided every uploaded L0 object is added to it,
+    /// so that tailing consumers materialize placeholders of new objects
+    /// from memory. If \p governor is provided every upload is admitted by
+    /// it.
     explicit batcher(
       core::write_pipeline<Clock>& pipeline,
       cloud_storage_clients::bucket_name bucket,
-      cloud_io::remote_api<Clock>& remote_api);
+      cloud_io::remote_api<Clock>& remote_api,
+      L0_object_cache* L0_cache = nullptr,
+      resource_governor<Clock>* governor = nullptr);
 
     ss::future<> start();
     ss::future<> stop();
 
 private:
+    /// L0 object which is ready to be uploaded
+    struct prepared_upload {
+        std::unique_ptr<aggregator<Clock>> aggr;
+        iobuf payload;
+        /// Copy of the payload for the L0 object cache
+        std::optional<iobuf> cached_payload;
+        /// True if all pending write requests were added
+        bool complete{false};
+    };
+
+    /// Collect write requests which can be uploaded as one L0 object
+    ///
+    /// Runs in a single time slice, so that no expired write request ends up
+    /// in the object.
+    ///
+    /// \returns nullopt if there are no write requests to upload
+    std::optional<prepared_upload> prepare_upload();
+
+    /// Upload the L0 object and acknowledge its write requests
+    ///
+    /// \param previous_ack is resolved when the write requests of the
+    ///        previous object are acknowledged. Uploads can complete in any
+    ///        order but placeholders of a partition have to be propagated in
+    ///        the order in which its write requests were collected.
+    ss::future<result<void>> upload_and_ack(
+      prepared_upload upload,
+      std::optional<ss::shared_future<>> previous_ack = std::nullopt);
+
     /// Run one iteration of the background loop
     ///
     /// Single call
@@ -87,16 +133,18 @@ private:
     /// aggregated log data and sending it to the
     /// cloud storage
     ///
-    /// The method should only be invoked on shard 0
+    /// Up to max_inflight_uploads objects are uploaded concurrently.
     ss::future<> bg_controller_loop();
 
     /// Wait until upload interval elapses or until
     /// enough bytes are accumulated
+    ///
+    /// Both are picked by the sizing controller.
     ss::future<errc> wait_for_next_upload() noexcept;
 
     /// Upload L0 object based on placeholders
     ///
-    /// Collect data from every shard and upload stream of data to S3.
+    /// Upload the stream of data of the local write requests to S3.
     ///
     /// \return size of the uploaded object or error code
     ss::future<result<size_t>> upload_object(object_id id, iobuf payload);
@@ -104,7 +152,12 @@ private:
     cloud_io::remote_api<Clock>& _remote;
     cloud_storage_clients::bucket_name _bucket;
     config::binding<std::chrono::milliseconds> _upload_timeout;
-    config::binding<std::chrono::milliseconds> _upload_interval;
+    config::binding<std::chrono::milliseconds> _latency_target;
+
+    L0_sizing_controller _sizing;
+    batcher_probe _probe;
+    /// Time of the last prepare_upload call which collected write requests
+    timestamp_t _last_collection;
 
     ss::gate _gate;
     ss::abort_source _as;
@@ -113,10 +166,21 @@ private:
 
     static constexpr size_t max_buffer_size = 16_MiB;
     static constexpr size_t max_cardinality = 1000;
+    /// Limit on concurrent L0 uploads, a single upload stream can't keep
+    /// up with the ingest of a shard because of the per-request latency.
+    static constexpr size_t max_inflight_uploads = 4;
+
+    ssx::semaphore _inflight_uploads{max_inflight_uploads, "ct_L0_uploads"};
+    /// Resolved once the write requests of the most recently started upload
+    /// are acknowledged
+    std::optional<ss::shared_future<>> _last_ack;
 
     basic_retry_chain_node<Clock> _rtc;
     basic_retry_chain_logger<Clock> _logger;
 
     core::pipeline_stage _my_stage;
+
+    L0_object_cache* _L0_cache;
+    resource_governor<Clock>* _governor;
 };
 } // namespace experimental::cloud_topics
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_topics/batcher/batcher_probe.h"
+
+#include "cloud_topics/batcher/L0_sizing_controller.h"
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace experimental::cloud_topics {
+
+batcher_probe::batcher_probe(const L0_sizing_controller& controller)
+  : _controller(controller) {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cloud_topics:batcher"),
+      {
+        sm::make_counter(
+          "uploads",
+          [this] { return _uploads; },
+          sm::description("Total number of uploaded L0 objects.")),
+        sm::make_counter(
+          "uploaded_bytes",
+          [this] { return _uploaded_bytes; },
+          sm::description("Total number of bytes uploaded as L0 objects.")),
+        sm::make_counter(
+          "upload_failures",
+          [this] { return _upload_failures; },
+          sm::description("Total number of failed L0 object uploads.")),
+        sm::make_gauge(
+          "upload_interval_ms",
+          [this] { return _controller.upload_interval().count(); },
+          sm::description("Time the batcher waits for write requests before "
+                          "uploading an L0 object.")),
+        sm::make_gauge(
+          "upload_threshold_bytes",
+          [this] { return _controller.upload_threshold(); },
+          sm::description("Number of pending bytes which trigger an L0 "
+                          "upload before the interval elapses.")),
+        sm::make_gauge(
+          "put_latency_ms",
+          [this] { return _controller.put_latency(); },
+          sm::description("Moving average of the L0 upload latency.")),
+        sm::make_gauge(
+          "arrival_rate_bytes",
+          [this] { return _controller.arrival_rate(); },
+          sm::description(
+            "Moving average of the produce rate in bytes per second.")),
+      });
+}
+
+} // namespace experimental::cloud_topics
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "metrics/metrics.h"
+
+namespace experimental::cloud_topics {
+
+class L0_sizing_controller;
+
+/// Exposes the state of the L0 sizing controller and the upload counters
+class batcher_probe {
+public:
+    explicit batcher_probe(const L0_sizing_controller& controller);
+
+    void upload(size_t bytes) {
+        ++_uploads;
+        _uploaded_bytes += bytes;
+    }
+    void upload_failure() { ++_upload_failures; }
+
+private:
+    const L0_sizing_controller& _controller;
+
+    uint64_t _uploads{0};
+    uint64_t _uploaded_bytes{0};
+    uint64_t _upload_failures{0};
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace experimental::cloud_topics
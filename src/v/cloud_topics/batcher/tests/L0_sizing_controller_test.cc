@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "base/units.h"
+#include "cloud_topics/batcher/L0_sizing_controller.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+using experimental::cloud_topics::L0_sizing_controller;
+
+TEST(L0SizingControllerTest, DefaultsToLatencyTarget) {
+    L0_sizing_controller ctrl(250ms);
+    EXPECT_EQ(ctrl.upload_interval(), 250ms);
+    EXPECT_EQ(
+      ctrl.upload_threshold(), L0_sizing_controller::max_upload_threshold);
+}
+
+TEST(L0SizingControllerTest, PutLatencyShortensInterval) {
+    L0_sizing_controller ctrl(250ms);
+    ctrl.record_upload(100ms);
+    EXPECT_EQ(ctrl.upload_interval(), 150ms);
+
+    // The average moves towards the new samples
+    for (int i = 0; i < 50; i++) {
+        ctrl.record_upload(50ms);
+    }
+    EXPECT_EQ(ctrl.upload_interval(), 200ms);
+
+    ctrl.set_latency_target(500ms);
+    EXPECT_EQ(ctrl.upload_interval(), 450ms);
+}
+
+TEST(L0SizingControllerTest, SlowPutUsesMinInterval) {
+    L0_sizing_controller ctrl(250ms);
+    ctrl.record_upload(400ms);
+    EXPECT_EQ(
+      ctrl.upload_interval(), L0_sizing_controller::min_upload_interval);
+}
+
+TEST(L0SizingControllerTest, ThresholdFollowsArrivalRate) {
+    L0_sizing_controller ctrl(250ms);
+    // 8MiB per second, twice the bytes of a 250ms interval
+    ctrl.record_collection(8_MiB, 1000ms);
+    EXPECT_EQ(ctrl.upload_threshold(), 4_MiB);
+
+    L0_sizing_controller slow(250ms);
+    slow.record_collection(1_KiB, 1000ms);
+    EXPECT_EQ(
+      slow.upload_threshold(), L0_sizing_controller::min_upload_threshold);
+
+    L0_sizing_controller fast(250ms);
+    fast.record_collection(100_MiB, 1000ms);
+    EXPECT_EQ(
+      fast.upload_threshold(), L0_sizing_controller::max_upload_threshold);
+}
+
+TEST(L0SizingControllerTest, ShortCollectionsAreMerged) {
+    L0_sizing_controller ctrl(250ms);
+    ctrl.record_collection(1_MiB, 1ms);
+    EXPECT_EQ(ctrl.arrival_rate(), 0);
+    ctrl.record_collection(1_MiB, 999ms);
+    EXPECT_DOUBLE_EQ(ctrl.arrival_rate(), 2_MiB);
+}
@@ -87,8 +87,22 @@ get_random_reader(int num_batches, int num_records) { // NOLINT
 
 namespace experimental::cloud_topics {
 struct batcher_accessor {
+    using prepared_upload
+      = cloud_topics::batcher<ss::manual_clock>::prepared_upload;
+
     ss::future<result<bool>> run_once() noexcept { return batcher->run_once(); }
 
+    std::optional<prepared_upload> prepare_upload() {
+        return batcher->prepare_upload();
+    }
+
+    ss::future<result<void>> upload_and_ack(
+      prepared_upload upload,
+      std::optional<ss::shared_future<>> previous_ack = std::nullopt) {
+        return batcher->upload_and_ack(
+          std::move(upload), std::move(previous_ack));
+    }
+
     cloud_topics::batcher<ss::manual_clock>* batcher;
 };
 } // namespace experimental::cloud_topics
@@ -336,6 +350,70 @@ TEST_CORO(batcher_test, expired_write_request) {
     }
 }
 
+TEST_CORO(batcher_test, acks_follow_upload_order) {
+    // Two L0 objects are uploaded concurrently. The upload of the second one
+    // completes first but its write request is acknowledged only after the
+    // write request of the first one.
+    remote_mock mock;
+    cloud_storage_clients::bucket_name bucket("foo");
+    cloud_topics::core::write_pipeline<ss::manual_clock> pipeline;
+    cloud_topics::batcher<ss::manual_clock> batcher(pipeline, bucket, mock);
+    cloud_topics::batcher_accessor batcher_accessor{
+      .batcher = &batcher,
+    };
+    cloud_topics::core::write_pipeline_accessor pipeline_accessor{
+      .pipeline = &pipeline,
+    };
+
+    auto [_1, records1, reader1] = get_random_reader(10, 10);
+    auto [_2, records2, reader2] = get_random_reader(10, 10);
+    chunked_vector<bytes> all_records;
+    std::copy(
+      std::make_move_iterator(records1.begin()),
+      std::make_move_iterator(records1.end()),
+      std::back_inserter(all_records));
+    std::copy(
+      std::make_move_iterator(records2.begin()),
+      std::make_move_iterator(records2.end()),
+      std::back_inserter(all_records));
+    mock.expect_upload_object(all_records);
+
+    const auto timeout = 1s;
+    auto fut1 = pipeline.write_and_debounce(
+      model::controller_ntp, std::move(reader1), timeout);
+    co_await sleep_until(
+      10ms, [&] { return pipeline_accessor.write_requests_pending(1); });
+    auto first = batcher_accessor.prepare_upload();
+    ASSERT_TRUE_CORO(first.has_value());
+
+    auto fut2 = pipeline.write_and_debounce(
+      model::controller_ntp, std::move(reader2), timeout);
+    co_await sleep_until(
+      10ms, [&] { return pipeline_accessor.write_requests_pending(1); });
+    auto second = batcher_accessor.prepare_upload();
+    ASSERT_TRUE_CORO(second.has_value());
+
+    ss::promise<> first_acked;
+    auto second_res = batcher_accessor.upload_and_ack(
+      std::move(second.value()), ss::shared_future<>(first_acked.get_future()));
+    co_await sleep(0ms);
+    ASSERT_EQ_CORO(mock.keys.size(), 1);
+    ASSERT_FALSE_CORO(second_res.available());
+    ASSERT_FALSE_CORO(fut2.available());
+
+    auto first_res = co_await batcher_accessor.upload_and_ack(
+      std::move(first.value()));
+    ASSERT_TRUE_CORO(first_res.has_value());
+    first_acked.set_value();
+    ASSERT_TRUE_CORO((co_await std::move(second_res)).has_value());
+    ASSERT_EQ_CORO(mock.keys.size(), 2);
+
+    auto write_res1 = co_await std::move(fut1);
+    auto write_res2 = co_await std::move(fut2);
+    ASSERT_TRUE_CORO(write_res1.has_value());
+    ASSERT_TRUE_CORO(write_res2.has_value());
+}
+
 // TODO: add more tests
 // - behaviour in case if pending write request sizes exceed L0 object size
 // limit
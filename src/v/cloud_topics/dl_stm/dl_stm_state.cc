@@ -20,12 +20,20 @@ namespace experimental::cloud_topics {
 void dl_stm_state::push_overlay(dl_version version, dl_overlay overlay) {
     _version_invariant.set_version(version);
 
-    auto entry_it = std::find_if(
-      _overlays.begin(),
-      _overlays.end(),
-      [&overlay](const dl_overlay_entry& entry) {
-          return entry.overlay == overlay;
+    auto same_base = std::partition_point(
+      _index.begin(), _index.end(), [&overlay](const overlay_index_entry& e) {
+          return e.base_offset < overlay.base_offset;
       });
+    auto entry_it = _overlays.end();
+    for (; same_base != _index.end()
+           && same_base->base_offset == overlay.base_offset;
+         ++same_base) {
+        if (_overlays[same_base->pos].overlay == overlay) {
+            entry_it = _overlays.begin()
+                       + static_cast<std::ptrdiff_t>(same_base->pos);
+            break;
+        }
+    }
     if (entry_it != _overlays.end()) {
         // A duplicate push_overlay is tolerated if this is a retry. A retry can
         // only happen if the version is the same.
@@ -43,6 +51,7 @@ void dl_stm_state::push_overlay(dl_version version, dl_overlay overlay) {
           version));
     }
 
+    index_overlay(overlay, _overlays.size());
     _overlays.push_back(dl_overlay_entry{
       .overlay = std::move(overlay),
       // The overlay becomes visible starting with the current version.
@@ -50,26 +59,65 @@ void dl_stm_state::push_overlay(dl_version version, dl_overlay overlay) {
     });
 }
 
+void dl_stm_state::index_overlay(const dl_overlay& overlay, size_t pos) {
+    overlay_index_entry entry{
+      .base_offset = overlay.base_offset,
+      .last_offset = overlay.last_offset,
+      .max_last_offset = overlay.last_offset,
+      .pos = pos,
+    };
+    if (_index.empty() || _index.back().base_offset <= entry.base_offset) {
+        if (!_index.empty()) {
+            entry.max_last_offset = std::max(
+              entry.max_last_offset, _index.back().max_last_offset);
+        }
+        _index.push_back(entry);
+        return;
+    }
+
+    // Out of order, rebuild the index with the entry in place.
+    chunked_vector<overlay_index_entry> index;
+    index.reserve(_index.size() + 1);
+    auto max_last_offset = kafka::offset::min();
+    auto append = [&](overlay_index_entry e) {
+        max_last_offset = std::max(max_last_offset, e.last_offset);
+        e.max_last_offset = max_last_offset;
+        index.push_back(e);
+    };
+    bool inserted = false;
+    for (const auto& e : _index) {
+        if (!inserted && entry.base_offset < e.base_offset) {
+            append(entry);
+            inserted = true;
+        }
+        append(e);
+    }
+    _index = std::move(index);
+}
+
 std::optional<dl_overlay>
 dl_stm_state::lower_bound(kafka::offset offset) const {
-    std::optional<dl_overlay> best_match;
-
-    for (auto& entry : _overlays) {
+    // The first entry whose running max reaches the offset is the first
+    // overlay, in base offset order, which ends at or after the offset.
+    // Entries after it may still end before the offset if they are nested
+    // in an earlier overlay.
+    auto it = std::partition_point(
+      _index.begin(), _index.end(), [offset](const overlay_index_entry& e) {
+          return e.max_last_offset < offset;
+      });
+    for (; it != _index.end(); ++it) {
+        if (it->last_offset < offset) {
+            continue;
+        }
+        const auto& entry = _overlays[it->pos];
         // Skip over removed overlays.
         if (entry.removed_at != dl_version{}) {
             continue;
         }
-
-        if (entry.overlay.last_offset >= offset) {
-            if (
-              !best_match.has_value()
-              || entry.overlay.base_offset < best_match->base_offset) {
-                best_match = entry.overlay;
-            }
-        }
+        return entry.overlay;
     }
 
-    return best_match;
+    return std::nullopt;
 }
 
 dl_snapshot_id dl_stm_state::start_snapshot(dl_version version) noexcept {
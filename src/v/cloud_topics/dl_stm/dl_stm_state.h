@@ -73,6 +73,9 @@ public:
     /// Find an overlay that contains the given offset. If no overlay
     /// contains the offset, find the overlay covering the next closest
     /// available offset.
+    ///
+    /// Logarithmic in the number of overlays, plus the number of removed or
+    /// nested overlays which are skipped.
     std::optional<dl_overlay> lower_bound(kafka::offset offset) const;
 
     /// Create a handle to a snapshot of the state at the current version.
@@ -88,10 +91,28 @@ public:
     void remove_snapshots_before(dl_version last_version_to_keep);
 
 private:
+    struct overlay_index_entry {
+        kafka::offset base_offset;
+        kafka::offset last_offset;
+        // The largest last offset of this entry and all entries before it.
+        // It never decreases along the index, which makes the index
+        // searchable by the last offset.
+        kafka::offset max_last_offset;
+        // Position of the overlay in `_overlays`.
+        size_t pos;
+    };
+
+    void index_overlay(const dl_overlay&, size_t pos);
+
     // A list of overlays that are stored in the cloud storage.
     // The order of elements is undefined.
     std::deque<dl_overlay_entry> _overlays;
 
+    // All overlays ordered by base offset. Overlays are mostly pushed in
+    // offset order, which appends to the index. An overlay pushed out of
+    // order rebuilds the index.
+    chunked_vector<overlay_index_entry> _index;
+
     // A list of snapshot handles that are currently open.
     // The list is ordered by version in ascending order to efficiently find the
     // oldest snapshot when running state garbage collection and to remove
@@ -170,6 +170,53 @@ TEST(dl_stm_state, lower_bound) {
       push_order.begin(), push_order.end(), base_offset_less_cmp));
 }
 
+TEST(dl_stm_state, lower_bound_random) {
+    // Overlays are mostly pushed in offset order, with some nested and out
+    // of order ones. Compare against a linear scan.
+    ct::dl_stm_state state;
+    std::vector<ct::dl_overlay> overlays;
+    int64_t next_base = 0;
+    for (int i = 0; i < 200; i++) {
+        auto base = next_base;
+        if (random_generators::get_int(0, 9) == 0 && base > 0) {
+            base = random_generators::get_int<int64_t>(0, base);
+        }
+        auto last = base + random_generators::get_int<int64_t>(0, 20);
+        next_base = std::max(next_base, last + 1);
+        overlays.push_back(
+          make_overlay(kafka::offset(base), kafka::offset(last)));
+        state.push_overlay(ct::dl_version(1), overlays.back());
+    }
+    // Remove some of them.
+    for (auto& entry : q::overlays(state)) {
+        if (random_generators::get_int(0, 4) == 0) {
+            entry.removed_at = ct::dl_version(2);
+        }
+    }
+
+    for (int64_t o = 0; o <= next_base; o++) {
+        std::optional<ct::dl_overlay> expected;
+        for (const auto& entry : q::overlays(state)) {
+            if (
+              entry.removed_at != ct::dl_version{}
+              || entry.overlay.last_offset < kafka::offset(o)) {
+                continue;
+            }
+            if (
+              !expected.has_value()
+              || entry.overlay.base_offset < expected->base_offset) {
+                expected = entry.overlay;
+            }
+        }
+        auto actual = state.lower_bound(kafka::offset(o));
+        ASSERT_EQ(actual.has_value(), expected.has_value()) << o;
+        if (actual.has_value()) {
+            ASSERT_EQ(actual->base_offset, expected->base_offset) << o;
+            ASSERT_GE(actual->last_offset, kafka::offset(o));
+        }
+    }
+}
+
 TEST(dl_stm_state_death, start_snapshot) {
     ct::dl_stm_state state;
 
@@ -16,13 +16,14 @@ namespace experimental::cloud_topics {
 enum class errc : int16_t {
     success,
     timeout,
-    upload_failure,     // Generic upload error
-    shutting_down,      // Umbrella shutdown error
-    cache_read_error,   // Failed to read data from cache
-    cache_write_error,  // Failed to write data to the cache
-    download_not_found, // 404 response during the download
-    download_failure,   // Generic download failure
-    slow_down,          // Cloud-storage throttling response
+    upload_failure,       // Generic upload error
+    shutting_down,        // Umbrella shutdown error
+    cache_read_error,     // Failed to read data from cache
+    cache_write_error,    // Failed to write data to the cache
+    download_not_found,   // 404 response during the download
+    download_failure,     // Generic download failure
+    slow_down,            // Cloud-storage throttling response
+    circuit_breaker_open, // Requests fail fast after repeated errors
     unexpected_failure,
 };
 
@@ -49,6 +50,8 @@ struct errc_category final : public std::error_category {
             return "download_failure";
         case errc::slow_down:
             return "slow_down";
+        case errc::circuit_breaker_open:
+            return "circuit_breaker_open";
         case errc::unexpected_failure:
             return "unexpected_failure";
         }
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_topics/reader/l0_object_cache.h"
+
+#include "cloud_topics/logger.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/as_future.hh>
+
+#include <algorithm>
+
+namespace experimental::cloud_topics {
+
+L0_object_cache::L0_object_cache(size_t capacity_bytes)
+  : _capacity(capacity_bytes)
+  , _cache(utils::chunked_kv_cache<uuid_t, iobuf>::config{
+      .cache_size = std::max<size_t>(capacity_bytes, 2),
+      .small_size = std::max<size_t>(capacity_bytes / 10, 1)}) {}
+
+ss::future<result<iobuf>>
+L0_object_cache::get_or_fetch(object_id id, fetch_func fetch) {
+    auto holder = _gate.hold();
+
+    if (auto cached = _cache.get_value(id()); cached) {
+        ++_hit_count;
+        co_return share(**cached);
+    }
+
+    if (auto it = _inflight.find(id()); it != _inflight.end()) {
+        ++_coalesced_count;
+        auto inflight = it->second;
+        auto res = co_await inflight->get_shared_future();
+        if (res.has_error()) {
+            co_return res.error();
+        }
+        co_return share(*res.value());
+    }
+
+    auto inflight = ss::make_lw_shared<ss::shared_promise<result<payload_t>>>();
+    _inflight.emplace(id(), inflight);
+    ++_fetch_count;
+
+    auto fut = co_await ss::coroutine::as_future(fetch());
+    _inflight.erase(id());
+
+    if (fut.failed()) {
+        auto e = fut.get_exception();
+        inflight->set_exception(e);
+        std::rethrow_exception(e);
+    }
+    auto res = fut.get();
+    if (res.has_error()) {
+        inflight->set_value(res.error());
+        co_return res.error();
+    }
+
+    auto payload = ss::make_shared<iobuf>(std::move(res.value()));
+    try_insert(id, payload);
+    inflight->set_value(payload);
+    co_return share(*payload);
+}
+
+void L0_object_cache::insert(object_id id, iobuf payload) {
+    try_insert(id, ss::make_shared<iobuf>(std::move(payload)));
+}
+
+void L0_object_cache::try_insert(object_id id, const payload_t& payload) {
+    const auto size = payload->size_bytes();
+    if (size > _capacity) {
+        vlog(
+          cd_log.debug,
+          "L0 object {} of {} bytes exceeds the object cache capacity of {} "
+          "bytes and will not be cached",
+          id,
+          size,
+          _capacity);
+        return;
+    }
+    _cache.try_insert(id(), payload, size);
+}
+
+ss::future<> L0_object_cache::stop() { return _gate.close(); }
+
+L0_object_cache::stat L0_object_cache::get_stat() const noexcept {
+    const auto s = _cache.stat();
+    return {
+      .size_bytes = s.small_queue_size + s.main_queue_size,
+      .hit_count = _hit_count,
+      .coalesced_count = _coalesced_count,
+      .fetch_count = _fetch_count,
+    };
+}
+
+} // namespace experimental::cloud_topics
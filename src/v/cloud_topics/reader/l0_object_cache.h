@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/outcome.h"
+#include "bytes/iobuf.h"
+#include "cloud_topics/types.h"
+#include "utils/chunked_kv_cache.h"
+#include "utils/uuid.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+namespace experimental::cloud_topics {
+
+/// Shard local, memory bounded cache of L0 object payloads.
+///
+/// An L0 object contains data of many NTPs, and every placeholder extent
+/// that references the object needs the payload to be materialized. The
+/// cache retains recently used payloads so that extents of other NTPs in
+/// the same object are materialized from memory, and coalesces concurrent
+/// misses for the same object into a single fetch.
+///
+/// Eviction uses the s3-fifo algorithm and the cost of an entry is the size
+/// of its payload. The cache may exceed its capacity by at most one object.
+/// Objects larger than the capacity are returned but not cached.
+class L0_object_cache {
+public:
+    using fetch_func = ss::noncopyable_function<ss::future<result<iobuf>>()>;
+
+    explicit L0_object_cache(size_t capacity_bytes);
+
+    L0_object_cache(const L0_object_cache&) = delete;
+    L0_object_cache& operator=(const L0_object_cache&) = delete;
+    L0_object_cache(L0_object_cache&&) noexcept = delete;
+    L0_object_cache& operator=(L0_object_cache&&) noexcept = delete;
+    ~L0_object_cache() = default;
+
+    /// Return the payload of the object \p id.
+    ///
+    /// If the payload isn't cached it's fetched by invoking \p fetch. If
+    /// another fiber is already fetching the same object the result of that
+    /// fetch is shared and \p fetch is not invoked.
+    ss::future<result<iobuf>> get_or_fetch(object_id id, fetch_func fetch);
+
+    /// Add the payload of a newly written object \p id, so that the first
+    /// reads of the object are served from memory.
+    void insert(object_id id, iobuf payload);
+
+    /// Wait for all in-flight fetches to complete.
+    ss::future<> stop();
+
+    struct stat {
+        /// Number of payload bytes held by the cache
+        size_t size_bytes;
+        /// Number of lookups served from memory
+        size_t hit_count;
+        /// Number of lookups that waited for a fetch of another fiber
+        size_t coalesced_count;
+        /// Number of fetches
+        size_t fetch_count;
+    };
+
+    stat get_stat() const noexcept;
+
+private:
+    using payload_t = ss::shared_ptr<iobuf>;
+    using inflight_t = ss::lw_shared_ptr<ss::shared_promise<result<payload_t>>>;
+
+    void try_insert(object_id id, const payload_t& payload);
+
+    static iobuf share(iobuf& payload) {
+        return payload.share(0, payload.size_bytes());
+    }
+
+    size_t _capacity;
+    utils::chunked_kv_cache<uuid_t, iobuf> _cache;
+    absl::flat_hash_map<uuid_t, inflight_t> _inflight;
+    ss::gate _gate;
+
+    size_t _hit_count{0};
+    size_t _coalesced_count{0};
+    size_t _fetch_count{0};
+};
+
+} // namespace experimental::cloud_topics
@@ -133,29 +133,18 @@ ss::future<result<iobuf>> materialize_from_cloud_storage(
   cloud_storage_clients::bucket_name bucket,
   cloud_io::remote_api<>* api,
   cloud_io::basic_cache_service_api<>* cache,
-  basic_retry_chain_node<>* rtc);
+  basic_retry_chain_node<>* rtc,
+  resource_governor<>* governor);
 
-ss::future<result<bool>> materialize(
-  placeholder_extent* ext,
+/// Read the L0 object from the cloud storage cache, or download it from the
+/// cloud storage and populate the cache.
+ss::future<result<iobuf>> hydrate_L0_object(
+  std::filesystem::path cache_file_name,
   cloud_storage_clients::bucket_name bucket,
   cloud_io::remote_api<>* api,
   cloud_io::basic_cache_service_api<>* cache,
-  basic_retry_chain_node<>* rtc) {
-    bool hydrated = false;
-    // This iobuf contains the record batch replaced by the placeholder. It
-    // might potentially contain data that belongs to other placeholder
-    // batches and in order to get the extent of the record batch
-    // placeholder we need to use byte offset and size.
-    iobuf L0_object_content;
-
-    // 2. download object from S3
-    auto cache_file_name = std::filesystem::path(
-      ssx::sformat("{}", ext->placeholder.id()));
-    // TODO: replace this with proper object name
-    // currently this value is used as both cloud storage name
-    // and cache name. This shouldn't necessary be the case in the
-    // future.
-
+  basic_retry_chain_node<>* rtc,
+  resource_governor<>* governor) {
     std::optional<cloud_io::cache_element_status> status = std::nullopt;
     basic_retry_chain_node<> is_cached_rtc(retry_strategy::backoff, rtc);
     retry_permit rp = is_cached_rtc.retry();
@@ -197,15 +186,54 @@ ss::future<result<bool>> materialize(
         if (res.has_error()) {
             co_return res.error();
         }
-        ext->L0_object->payload = std::move(res.value());
+        co_return std::move(res.value());
     } else {
         auto res = co_await materialize_from_cloud_storage(
-          cache_file_name, bucket, api, cache, rtc);
+          cache_file_name, bucket, api, cache, rtc, governor);
         if (res.has_error()) {
             co_return res.error();
         }
-        ext->L0_object->payload = std::move(res.value());
+        co_return std::move(res.value());
+    }
+}
+
+ss::future<result<bool>> materialize(
+  placeholder_extent* ext,
+  cloud_storage_clients::bucket_name bucket,
+  cloud_io::remote_api<>* api,
+  cloud_io::basic_cache_service_api<>* cache,
+  basic_retry_chain_node<>* rtc,
+  L0_object_cache* L0_cache,
+  resource_governor<>* governor) {
+    bool hydrated = false;
+
+    // 2. download object from S3
+    auto cache_file_name = std::filesystem::path(
+      ssx::sformat("{}", ext->placeholder.id()));
+    // TODO: replace this with proper object name
+    // currently this value is used as both cloud storage name
+    // and cache name. This shouldn't necessary be the case in the
+    // future.
+
+    // This iobuf contains the record batch replaced by the placeholder. It
+    // might potentially contain data that belongs to other placeholder
+    // batches and in order to get the extent of the record batch
+    // placeholder we need to use byte offset and size.
+    result<iobuf> L0_object_content = errc::unexpected_failure;
+    if (L0_cache != nullptr) {
+        L0_object_content = co_await L0_cache->get_or_fetch(
+          ext->placeholder.id, [&] {
+              return hydrate_L0_object(
+                cache_file_name, bucket, api, cache, rtc, governor);
+          });
+    } else {
+        L0_object_content = co_await hydrate_L0_object(
+          cache_file_name, bucket, api, cache, rtc, governor);
+    }
+    if (L0_object_content.has_error()) {
+        co_return L0_object_content.error();
     }
+    ext->L0_object->payload = std::move(L0_object_content.value());
     co_return hydrated;
 }
 
@@ -240,7 +268,15 @@ ss::future<result<iobuf>> materialize_from_cloud_storage(
   cloud_storage_clients::bucket_name bucket,
   cloud_io::remote_api<>* api,
   cloud_io::basic_cache_service_api<>* cache,
-  basic_retry_chain_node<>* rtc) {
+  basic_retry_chain_node<>* rtc,
+  resource_governor<>* governor) {
+    if (governor != nullptr) {
+        auto admitted = co_await governor->acquire_download(
+          rtc->root_abort_source());
+        if (admitted.has_error()) {
+            co_return admitted.error();
+        }
+    }
     // Populate the cache
     iobuf payload;
     cloud_io::download_request req{
@@ -258,6 +294,20 @@ ss::future<result<iobuf>> materialize_from_cloud_storage(
           vlog(cd_log.error, "Unexpected error during L0 download: {}", e);
       });
 
+    if (governor != nullptr) {
+        if (dl_result.has_error()) {
+            if (dl_result.error() != errc::shutting_down) {
+                governor->record_failure();
+            }
+        } else if (
+          dl_result.value() == cloud_io::download_result::success
+          || dl_result.value() == cloud_io::download_result::notfound) {
+            governor->record_success();
+        } else {
+            governor->record_failure();
+        }
+    }
+
     if (dl_result.has_error()) {
         co_return dl_result.error();
     }
@@ -267,6 +317,14 @@ ss::future<result<iobuf>> materialize_from_cloud_storage(
         co_return conv(dl_result.value());
     }
 
+    if (governor != nullptr) {
+        auto charged = co_await governor->charge_download(
+          payload.size_bytes(), rtc->root_abort_source());
+        if (charged.has_error()) {
+            co_return charged.error();
+        }
+    }
+
     auto buf_str = make_iobuf_input_stream(payload.copy());
     // TODO: use circuit-breaker here, if the operation fails
     // repeatedly it can be temporarily short-circuited to avoid
@@ -17,6 +17,8 @@
 #include "cloud_topics/dl_placeholder.h"
 #include "cloud_topics/errc.h"
 #include "cloud_topics/logger.h"
+#include "cloud_topics/reader/l0_object_cache.h"
+#include "cloud_topics/throttler/resource_governor.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "model/record_batch_types.h"
@@ -61,6 +63,10 @@ placeholder_extent make_placeholder_extent(model::record_batch batch);
 
 /// Fetch data referenced by the placeholder batch and the content of the
 /// dl_placeholder.
+/// If \p L0_cache is provided the L0 object is looked up in it first, and a
+/// downloaded object is added to it.
+/// If \p governor is provided downloads from the cloud storage are admitted
+/// by it.
 /// Return 'true' if the object was downloaded from the cloud storage.
 /// Otherwise, if the object was populated from the cache, return 'false'.
 ss::future<result<bool>> materialize(
@@ -68,7 +74,9 @@ ss::future<result<bool>> materialize(
   cloud_storage_clients::bucket_name bucket,
   cloud_io::remote_api<>* api,
   cloud_io::basic_cache_service_api<>* cache,
-  basic_retry_chain_node<>* rtc);
+  basic_retry_chain_node<>* rtc,
+  L0_object_cache* L0_cache = nullptr,
+  resource_governor<>* governor = nullptr);
 
 // Get dl_placeholder and the payload of the object and generate a record
 // batch
@@ -20,6 +20,7 @@
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "model/record_batch_types.h"
+#include "storage/batch_cache.h"
 
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
@@ -57,7 +58,9 @@ materialize_sorted_run(
   cloud_storage_clients::bucket_name bucket,
   cloud_io::remote_api<>* api,
   cloud_io::basic_cache_service_api<>* cache,
-  retry_chain_node* rtc) {
+  retry_chain_node* rtc,
+  L0_object_cache* L0_cache,
+  resource_governor<>* governor) {
     absl::node_hash_map<uuid_t, ss::lw_shared_ptr<hydrated_L0_object>> hydrated;
     ss::circular_buffer<placeholder_extent> extents;
     for (auto&& p : placeholders) {
@@ -71,7 +74,8 @@ materialize_sorted_run(
             // TODO: check that id of the payload matches
             extent.L0_object->payload = payload.share(0, payload.size_bytes());
         } else {
-            auto res = co_await materialize(&extent, bucket, api, cache, rtc);
+            auto res = co_await materialize(
+              &extent, bucket, api, cache, rtc, L0_cache, governor);
             if (res.has_error()) {
                 co_return res.error();
             }
@@ -91,13 +95,19 @@ public:
       cloud_storage_clients::bucket_name bucket,
       cloud_io::remote_api<>& api,
       cloud_io::basic_cache_service_api<>& cache,
-      retry_chain_node* rtc)
+      retry_chain_node* rtc,
+      L0_object_cache* L0_cache,
+      resource_governor<>* governor,
+      storage::batch_cache_index* batch_cache)
       : _underlying(std::move(rdr))
       , _config(cfg)
       , _bucket(std::move(bucket))
       , _api(api)
       , _cache(cache)
-      , _rtc(rtc) {}
+      , _rtc(rtc)
+      , _L0_cache(L0_cache)
+      , _governor(governor)
+      , _batch_cache(batch_cache) {}
 
     bool is_end_of_stream() const override {
         bool is_eos = _config.start_offset >= _config.max_offset
@@ -107,6 +117,13 @@ public:
 
     ss::future<model::record_batch_reader::storage_t>
     do_load_slice(model::timeout_clock::time_point tm) override {
+        if (_batch_cache != nullptr) {
+            auto cached = read_from_batch_cache();
+            if (!cached.empty()) {
+                co_return std::move(cached);
+            }
+        }
+
         struct consumer {
             consumer(
               storage::log_reader_config* config,
@@ -148,7 +165,13 @@ public:
         co_await _underlying.consume(cons, tm);
 
         auto extents = co_await materialize_sorted_run(
-          std::move(read_buffer), _bucket, &_api, &_cache, &_rtc);
+          std::move(read_buffer),
+          _bucket,
+          &_api,
+          &_cache,
+          &_rtc,
+          _L0_cache,
+          _governor);
         if (extents.has_error()) {
             vlog(
               cd_log.error,
@@ -160,6 +183,10 @@ public:
         ss::circular_buffer<model::record_batch> slice;
         for (auto& e : extents.value()) {
             slice.push_back(make_raft_data_batch(std::move(e)));
+            if (_batch_cache != nullptr) {
+                _batch_cache->put(
+                  slice.back(), storage::batch_cache::is_dirty_entry::no);
+            }
         }
 
         co_return std::move(slice);
@@ -170,6 +197,30 @@ public:
     ss::future<> finally() noexcept override { return ss::now(); }
 
 private:
+    /// Return the cached batches which continue the read. The placeholders
+    /// of the returned batches are skipped by the underlying reader.
+    ss::circular_buffer<model::record_batch> read_from_batch_cache() {
+        auto res = _batch_cache->read(
+          _config.start_offset,
+          _config.max_offset,
+          std::nullopt,
+          std::nullopt,
+          _config.max_bytes,
+          false);
+        ss::circular_buffer<model::record_batch> slice;
+        for (auto& rb : res.batches) {
+            if (rb.base_offset() < _config.start_offset) {
+                continue;
+            }
+            if (rb.last_offset() > _config.max_offset) {
+                break;
+            }
+            _config.start_offset = model::next_offset(rb.last_offset());
+            slice.push_back(std::move(rb));
+        }
+        return slice;
+    }
+
     // Underlying storage partition reader
     model::record_batch_reader _underlying;
     storage::log_reader_config _config;
@@ -179,6 +230,12 @@ private:
     cloud_io::remote_api<>& _api;
     cloud_io::basic_cache_service_api<>& _cache;
     retry_chain_node _rtc;
+    // Shard local L0 object cache, optional
+    L0_object_cache* _L0_cache;
+    // Shard local resource governor, optional
+    resource_governor<>* _governor;
+    // Materialized batches of the partition, optional
+    storage::batch_cache_index* _batch_cache;
 };
 
 model::record_batch_reader make_placeholder_extent_reader(
@@ -187,9 +244,20 @@ model::record_batch_reader make_placeholder_extent_reader(
   model::record_batch_reader underlying,
   cloud_io::remote_api<ss::lowres_clock>& api,
   cloud_io::basic_cache_service_api<ss::lowres_clock>& cache,
-  retry_chain_node& rtc) {
+  retry_chain_node& rtc,
+  L0_object_cache* L0_cache,
+  resource_governor<>* governor,
+  storage::batch_cache_index* batch_cache) {
     auto impl = std::make_unique<joining_record_batch_reader_impl>(
-      std::move(underlying), cfg, std::move(bucket), api, cache, &rtc);
+      std::move(underlying),
+      cfg,
+      std::move(bucket),
+      api,
+      cache,
+      &rtc,
+      L0_cache,
+      governor,
+      batch_cache);
     return model::record_batch_reader(std::move(impl));
 }
 
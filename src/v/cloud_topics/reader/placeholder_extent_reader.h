@@ -12,13 +12,20 @@
 
 #include "cloud_io/basic_cache_service_api.h"
 #include "cloud_io/remote.h"
+#include "cloud_topics/throttler/resource_governor.h"
 #include "model/record_batch_reader.h"
 #include "storage/log_reader.h"
 
 #include <seastar/core/lowres_clock.hh>
 
+namespace storage {
+class batch_cache_index;
+}
+
 namespace experimental::cloud_topics {
 
+class L0_object_cache;
+
 /// Create placeholder_extent_reader instance.
 ///
 /// The reader consumes another reader which returns dl_placeholder
@@ -29,12 +36,22 @@ namespace experimental::cloud_topics {
 /// \param api is a cloud_io::remote instance
 /// \param cache is a cloud storage cache instance
 /// \param rtc is a top level retry chain node
+/// \param L0_cache is an optional shard local L0 object cache
+/// \param governor optionally admits downloads from the cloud storage
+/// \param batch_cache optionally caches materialized batches by their
+///        placeholder offsets. Reads are served from it when possible, which
+///        lets repeated reads of the same range skip materialization. The
+///        index should only be used for materialized batches of a single
+///        partition and has to be truncated together with the partition.
 model::record_batch_reader make_placeholder_extent_reader(
   storage::log_reader_config cfg,
   cloud_storage_clients::bucket_name bucket,
   model::record_batch_reader underlying,
   cloud_io::remote_api<ss::lowres_clock>& api,
   cloud_io::basic_cache_service_api<ss::lowres_clock>& cache,
-  retry_chain_node& rtc);
+  retry_chain_node& rtc,
+  L0_object_cache* L0_cache = nullptr,
+  resource_governor<>* governor = nullptr,
+  storage::batch_cache_index* batch_cache = nullptr);
 
 } // namespace experimental::cloud_topics
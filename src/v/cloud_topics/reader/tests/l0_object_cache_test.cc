@@ -0,0 +1,132 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "cloud_topics/errc.h"
+#include "cloud_topics/reader/l0_object_cache.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/when_all.hh>
+
+namespace cloud_topics = experimental::cloud_topics;
+
+namespace {
+iobuf make_payload(size_t size) {
+    iobuf b;
+    b.append(ss::temporary_buffer<char>(size));
+    return b;
+}
+
+cloud_topics::object_id make_id() {
+    return cloud_topics::object_id(uuid_t::create());
+}
+} // namespace
+
+TEST_CORO(L0_object_cache_test, hit_after_fetch) {
+    cloud_topics::L0_object_cache cache(1_MiB);
+    auto id = make_id();
+    int fetches = 0;
+    auto fetch = [&]() -> ss::future<result<iobuf>> {
+        ++fetches;
+        co_return make_payload(1_KiB);
+    };
+
+    auto first = co_await cache.get_or_fetch(id, fetch);
+    ASSERT_TRUE_CORO(first.has_value());
+    auto second = co_await cache.get_or_fetch(id, fetch);
+    ASSERT_TRUE_CORO(second.has_value());
+
+    ASSERT_EQ_CORO(fetches, 1);
+    ASSERT_EQ_CORO(second.value().size_bytes(), 1_KiB);
+    auto stat = cache.get_stat();
+    ASSERT_EQ_CORO(stat.hit_count, 1);
+    ASSERT_EQ_CORO(stat.fetch_count, 1);
+    ASSERT_EQ_CORO(stat.size_bytes, 1_KiB);
+    co_await cache.stop();
+}
+
+TEST_CORO(L0_object_cache_test, concurrent_misses_are_coalesced) {
+    cloud_topics::L0_object_cache cache(1_MiB);
+    auto id = make_id();
+    int fetches = 0;
+    ss::promise<> release;
+    auto fetch = [&]() -> ss::future<result<iobuf>> {
+        ++fetches;
+        co_await release.get_future();
+        co_return make_payload(1_KiB);
+    };
+
+    auto f1 = cache.get_or_fetch(id, fetch);
+    auto f2 = cache.get_or_fetch(id, fetch);
+    release.set_value();
+    auto [r1, r2] = co_await ss::when_all_succeed(std::move(f1), std::move(f2));
+
+    ASSERT_TRUE_CORO(r1.has_value());
+    ASSERT_TRUE_CORO(r2.has_value());
+    ASSERT_EQ_CORO(fetches, 1);
+    ASSERT_EQ_CORO(cache.get_stat().coalesced_count, 1);
+    co_await cache.stop();
+}
+
+TEST_CORO(L0_object_cache_test, errors_are_not_cached) {
+    cloud_topics::L0_object_cache cache(1_MiB);
+    auto id = make_id();
+    int fetches = 0;
+    auto fail = [&]() -> ss::future<result<iobuf>> {
+        ++fetches;
+        co_return cloud_topics::errc::download_failure;
+    };
+
+    auto res = co_await cache.get_or_fetch(id, fail);
+    ASSERT_TRUE_CORO(res.has_error());
+    ASSERT_EQ_CORO(res.error(), cloud_topics::errc::download_failure);
+    res = co_await cache.get_or_fetch(id, fail);
+    ASSERT_TRUE_CORO(res.has_error());
+    ASSERT_EQ_CORO(fetches, 2);
+    co_await cache.stop();
+}
+
+TEST_CORO(L0_object_cache_test, large_objects_are_not_cached) {
+    cloud_topics::L0_object_cache cache(1_KiB);
+    auto id = make_id();
+    int fetches = 0;
+    auto fetch = [&]() -> ss::future<result<iobuf>> {
+        ++fetches;
+        co_return make_payload(2_KiB);
+    };
+
+    for (int i = 0; i < 2; ++i) {
+        auto res = co_await cache.get_or_fetch(id, fetch);
+        ASSERT_TRUE_CORO(res.has_value());
+        ASSERT_EQ_CORO(res.value().size_bytes(), 2_KiB);
+    }
+    ASSERT_EQ_CORO(fetches, 2);
+    ASSERT_EQ_CORO(cache.get_stat().size_bytes, 0);
+    co_await cache.stop();
+}
+
+TEST_CORO(L0_object_cache_test, inserted_objects_are_not_fetched) {
+    cloud_topics::L0_object_cache cache(1_MiB);
+    auto id = make_id();
+    int fetches = 0;
+    auto fetch = [&]() -> ss::future<result<iobuf>> {
+        ++fetches;
+        co_return make_payload(1_KiB);
+    };
+
+    cache.insert(id, make_payload(1_KiB));
+    auto res = co_await cache.get_or_fetch(id, fetch);
+    ASSERT_TRUE_CORO(res.has_value());
+    ASSERT_EQ_CORO(res.value().size_bytes(), 1_KiB);
+    ASSERT_EQ_CORO(fetches, 0);
+    ASSERT_EQ_CORO(cache.get_stat().hit_count, 1);
+    co_await cache.stop();
+}
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "base/vlog.h"
 #include "cloud_topics/reader/placeholder_extent_reader.h"
 #include "cloud_topics/reader/tests/placeholder_extent_fixture.h"
@@ -14,6 +15,7 @@
 #include "model/namespace.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
+#include "storage/batch_cache.h"
 #include "test_utils/test.h"
 
 #include <seastar/core/abort_source.hh>
@@ -76,6 +78,48 @@ TEST_F_CORO(placeholder_extent_fixture, full_scan_test) {
     ASSERT_TRUE_CORO(actual == expected);
 }
 
+TEST_F_CORO(placeholder_extent_fixture, batch_cache_read_through) {
+    const int num_batches = 10;
+    co_await add_random_batches(num_batches);
+    // The mocks expect every L0 object to be fetched exactly once
+    produce_placeholders(true, 1);
+    storage::batch_cache batch_cache(storage::batch_cache::reclaim_options{
+      .growth_window = 3s,
+      .stable_window = 10s,
+      .min_size = 128_KiB,
+      .max_size = 4_MiB,
+    });
+    storage::batch_cache_index index(batch_cache);
+    storage::log_reader_config config(
+      model::offset(0),
+      get_expected_committed_offset(),
+      ss::default_priority_class());
+    ss::abort_source as;
+    retry_chain_node rtc(as, 1s, 100ms);
+
+    for (int i = 0; i < 2; i++) {
+        auto reader = cloud_topics::make_placeholder_extent_reader(
+          config,
+          cloud_storage_clients::bucket_name("test-bucket-name"),
+          make_log_reader(),
+          remote,
+          cache,
+          rtc,
+          nullptr,
+          nullptr,
+          &index);
+        fragmented_vector<model::record_batch> actual;
+        fragmented_vector_consumer consumer{
+          .target = &actual,
+        };
+        co_await reader.consume(consumer, model::timeout_clock::now() + 10s);
+        ASSERT_EQ_CORO(actual.size(), expected.size());
+        ASSERT_TRUE_CORO(actual == expected);
+    }
+    co_await index.clear_async();
+    co_await batch_cache.stop();
+}
+
 // Same as 'full_scan_test' but the range can be arbitrary
 ss::future<> test_aggregated_log_partial_scan(
   placeholder_extent_fixture* fx, int num_batches, int begin, int end) {
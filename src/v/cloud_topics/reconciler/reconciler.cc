@@ -18,9 +18,12 @@
 #include "model/namespace.h"
 #include "random/generators.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/util/log.hh>
 
+#include <algorithm>
+
 namespace {
 ss::logger lg("reconciler");
 
@@ -39,9 +42,11 @@ namespace experimental::cloud_topics::reconciler {
 reconciler::reconciler(
   ss::sharded<cluster::partition_manager>* pm,
   ss::sharded<cloud_io::remote>* cloud_io,
-  std::optional<cloud_storage_clients::bucket_name> bucket)
+  std::optional<cloud_storage_clients::bucket_name> bucket,
+  resource_governor<>* governor)
   : _partition_manager(pm)
-  , _cloud_io(cloud_io) {
+  , _cloud_io(cloud_io)
+  , _governor(governor) {
     if (bucket.has_value()) {
         _bucket = std::move(bucket.value());
     } else {
@@ -150,24 +155,35 @@ ss::future<> reconciler::reconciliation_loop() {
 }
 
 ss::future<> reconciler::reconcile() {
-    auto object = co_await build_object();
-    if (!object.has_value()) {
+    auto objects = co_await build_objects();
+    if (objects.empty()) {
         co_return;
     }
 
-    auto result = co_await upload_object(std::move(object->data));
+    /*
+     * objects contain disjoint sets of partitions, so they are committed
+     * independently as soon as their upload completes.
+     */
+    co_await ss::parallel_for_each(
+      std::make_move_iterator(objects.begin()),
+      std::make_move_iterator(objects.end()),
+      [this](object object) { return upload_and_commit(std::move(object)); });
+}
+
+ss::future<> reconciler::upload_and_commit(object object) {
+    auto result = co_await upload_object(std::move(object.data));
     if (result != cloud_io::upload_result::success) {
         vlog(lg.info, "Failed to upload L1 object: {}", result);
         co_return;
     }
 
     // commit for each partition represented in the uploaded object
-    for (const auto& range : object->ranges) {
+    for (const auto& range : object.ranges) {
         co_await commit_object(range);
     }
 }
 
-ss::future<std::optional<reconciler::object>> reconciler::build_object() {
+ss::future<chunked_vector<reconciler::object>> reconciler::build_objects() {
     // light-weight copy for stable iteration
     std::vector<attached_partition> partitions;
     for (const auto& p : _partitions) {
@@ -180,26 +196,55 @@ ss::future<std::optional<reconciler::object>> reconciler::build_object() {
     std::shuffle(
       partitions.begin(), partitions.end(), random_generators::internal::gen);
 
-    object object;
-    auto size_budget = max_object_size;
+    chunked_vector<object> objects;
+    auto size_budget = max_object_size * max_objects_per_round;
     for (const auto& partition : partitions) {
-        auto reader = co_await make_reader(partition, size_budget);
+        if (size_budget == 0) {
+            break;
+        }
+        auto reader = co_await make_reader(
+          partition, std::min(size_budget, max_object_size));
         auto range = co_await std::move(reader).consume(
           range_batch_consumer{}, model::no_timeout);
-        if (range.has_value()) {
-            object.add(std::move(*range), partition);
-            size_budget -= std::min(object.data.size_bytes(), size_budget);
+        if (!range.has_value()) {
+            continue;
         }
+        const auto range_size = range->data.size_bytes();
+        auto it = std::find_if(
+          objects.begin(), objects.end(), [range_size](const object& o) {
+              return o.data.size_bytes() + range_size <= max_object_size;
+          });
+        if (it != objects.end()) {
+            it->add(std::move(*range), partition);
+        } else if (objects.size() < max_objects_per_round) {
+            objects.emplace_back().add(std::move(*range), partition);
+        } else {
+            // the range is read again in the next round
+            continue;
+        }
+        size_budget -= std::min(range_size, size_budget);
     }
 
-    if (object.data.empty()) {
-        co_return std::nullopt;
-    }
-
-    co_return object;
+    co_return objects;
 }
 
 ss::future<cloud_io::upload_result> reconciler::upload_object(iobuf payload) {
+    ssx::semaphore_units governor_units;
+    if (_governor != nullptr) {
+        auto admitted = co_await _governor->acquire_upload(
+          payload.size_bytes(), _as);
+        if (admitted.has_error()) {
+            vlog(
+              lg.info,
+              "L1 upload is not admitted: {}",
+              admitted.error().message());
+            co_return admitted.error() == errc::shutting_down
+              ? cloud_io::upload_result::cancelled
+              : cloud_io::upload_result::failed;
+        }
+        governor_units = std::move(admitted.value());
+    }
+
     const cloud_storage_clients::object_key key(
       fmt::format("l1_{}", uuid_t::create()));
 
@@ -208,7 +253,7 @@ ss::future<cloud_io::upload_result> reconciler::upload_object(iobuf payload) {
       ss::lowres_clock::now() + std::chrono::seconds(20),
       std::chrono::seconds(1));
 
-    co_return co_await _cloud_io->local().upload_object({
+    auto result = co_await _cloud_io->local().upload_object({
       .transfer_details = {
         .bucket = _bucket,
         .key = key,
@@ -217,6 +262,21 @@ ss::future<cloud_io::upload_result> reconciler::upload_object(iobuf payload) {
       .display_str = "l1_object",
       .payload = std::move(payload),
     });
+
+    if (_governor != nullptr) {
+        switch (result) {
+        case cloud_io::upload_result::success:
+            _governor->record_success();
+            break;
+        case cloud_io::upload_result::timedout:
+        case cloud_io::upload_result::failed:
+            _governor->record_failure();
+            break;
+        case cloud_io::upload_result::cancelled:
+            break;
+        }
+    }
+    co_return result;
 }
 
 ss::future<> reconciler::commit_object(const object_range_info& range) {
@@ -13,6 +13,7 @@
 #include "base/seastarx.h"
 #include "cloud_io/remote.h"
 #include "cloud_topics/reconciler/range_batch_consumer.h"
+#include "cloud_topics/throttler/resource_governor.h"
 #include "cluster/notification.h"
 #include "cluster/partition.h"
 #include "cluster/partition_manager.h"
@@ -36,10 +37,14 @@ namespace experimental::cloud_topics::reconciler {
  */
 class reconciler {
 public:
+    /*
+     * if a resource governor is provided every L1 upload is admitted by it.
+     */
     reconciler(
       ss::sharded<cluster::partition_manager>*,
       ss::sharded<cloud_io::remote>*,
-      std::optional<cloud_storage_clients::bucket_name> = std::nullopt);
+      std::optional<cloud_storage_clients::bucket_name> = std::nullopt,
+      resource_governor<>* = nullptr);
 
     reconciler(const reconciler&) = delete;
     reconciler& operator=(const reconciler&) = delete;
@@ -85,6 +90,12 @@ private:
 
 private:
     static constexpr size_t max_object_size = 4_MiB;
+    /*
+     * upper bound on the number of L1 objects built in one round. the objects
+     * of a round are uploaded concurrently, which hides the per-request
+     * latency of the object store when many partitions have data.
+     */
+    static constexpr size_t max_objects_per_round = 4;
 
     /*
      * metadata about a materialized range of batches stored in an L1 object.
@@ -122,16 +133,19 @@ private:
 
     /*
      * one round of reconciliation in which data from one or more partitions may
-     * be reconciled into an L1 object. operates on the set of currently
-     * attached partitions.
+     * be reconciled into up to max_objects_per_round L1 objects. operates on
+     * the set of currently attached partitions.
      */
     ss::future<> reconcile();
 
     /*
-     * reconciliation is a three step process. first an L1 object is built, then
-     * it is uploaded to cloud storage, and finally its committed.
+     * reconciliation is a three step process. first L1 objects are built, then
+     * they are uploaded to cloud storage, and finally they are committed. each
+     * partition is read once per round and its range is placed in the first
+     * object with enough room left.
      */
-    ss::future<std::optional<object>> build_object();
+    ss::future<chunked_vector<object>> build_objects();
+    ss::future<> upload_and_commit(object);
     ss::future<cloud_io::upload_result> upload_object(iobuf);
     ss::future<> commit_object(const object_range_info&);
 
@@ -147,6 +161,7 @@ private:
     ss::sharded<cluster::partition_manager>* _partition_manager;
     ss::sharded<cloud_io::remote>* _cloud_io;
     cloud_storage_clients::bucket_name _bucket;
+    resource_governor<>* _governor;
     ss::gate _gate;
     ss::abort_source _as;
 };
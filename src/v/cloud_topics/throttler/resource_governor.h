@@ -0,0 +1,248 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/outcome.h"
+#include "base/seastarx.h"
+#include "base/unreachable.h"
+#include "cloud_topics/errc.h"
+#include "ssx/future-util.h"
+#include "ssx/semaphore.h"
+#include "utils/token_bucket.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/coroutine/as_future.hh>
+
+#include <algorithm>
+#include <optional>
+
+namespace experimental::cloud_topics {
+
+/// Resource governor
+///
+/// Per-shard limits on the object storage traffic of cloud topics. Every
+/// request takes a token from the request rate bucket and its payload is
+/// charged to the upload or download bandwidth bucket. Upload payloads also
+/// hold memory units until the upload completes, which bounds the data
+/// queued behind a slow object store.
+///
+/// Consecutive storage errors open a circuit breaker. While it is open
+/// requests fail fast with errc::circuit_breaker_open instead of queueing.
+/// After the cooldown a single request is let through, its outcome closes
+/// or re-opens the breaker. Because of that every successful acquire_upload
+/// or acquire_download has to be followed by record_success() or
+/// record_failure().
+template<class Clock = ss::lowres_clock>
+class resource_governor {
+public:
+    struct limits {
+        /// Limits which are not set are not enforced
+        std::optional<size_t> upload_bytes_per_sec;
+        std::optional<size_t> download_bytes_per_sec;
+        std::optional<size_t> requests_per_sec;
+        std::optional<size_t> memory_bytes;
+        /// Number of consecutive errors which open the circuit breaker
+        size_t error_threshold{10};
+        typename Clock::duration breaker_cooldown{std::chrono::seconds(5)};
+    };
+
+    explicit resource_governor(limits l)
+      : _error_threshold(std::max<size_t>(l.error_threshold, 1))
+      , _breaker_cooldown(l.breaker_cooldown)
+      , _memory(l.memory_bytes.value_or(0), "ct:governor:memory")
+      , _memory_limit(l.memory_bytes) {
+        if (l.upload_bytes_per_sec.has_value()) {
+            _upload_tb.emplace(*l.upload_bytes_per_sec, "ct:governor:upload");
+        }
+        if (l.download_bytes_per_sec.has_value()) {
+            _download_tb.emplace(
+              *l.download_bytes_per_sec, "ct:governor:download");
+        }
+        if (l.requests_per_sec.has_value()) {
+            _requests_tb.emplace(*l.requests_per_sec, "ct:governor:requests");
+        }
+    }
+
+    resource_governor(const resource_governor&) = delete;
+    resource_governor& operator=(const resource_governor&) = delete;
+    resource_governor(resource_governor&&) = delete;
+    resource_governor& operator=(resource_governor&&) = delete;
+    ~resource_governor() = default;
+
+    /// Fail all waiters, the governor can't be used afterwards
+    void stop() {
+        for (auto* tb : {&_upload_tb, &_download_tb, &_requests_tb}) {
+            if (tb->has_value()) {
+                tb->value().shutdown();
+            }
+        }
+        _memory.broken();
+    }
+
+    /// Wait until an upload of \p bytes fits in the limits
+    ///
+    /// The returned units hold the memory of the payload (capped by the
+    /// memory limit) and should be kept until the upload completes.
+    ss::future<result<ssx::semaphore_units>>
+    acquire_upload(size_t bytes, ss::abort_source& as) {
+        if (auto err = admit(); err != errc::success) {
+            co_return err;
+        }
+        ssx::semaphore_units units;
+        if (_memory_limit.has_value()) {
+            auto fut = co_await ss::coroutine::as_future(
+              ss::get_units(_memory, std::min(bytes, *_memory_limit), as));
+            if (fut.failed()) {
+                abandon_probe();
+                co_return to_errc(fut.get_exception());
+            }
+            units = fut.get();
+        }
+        auto err = co_await throttle(_requests_tb, 1, as);
+        if (err == errc::success) {
+            err = co_await throttle(_upload_tb, bytes, as);
+        }
+        if (err != errc::success) {
+            abandon_probe();
+            co_return err;
+        }
+        co_return std::move(units);
+    }
+
+    /// Wait until a download request fits in the limits
+    ///
+    /// The size of the object is not known upfront, the downloaded bytes are
+    /// charged with charge_download() once they are received.
+    ss::future<result<void>> acquire_download(ss::abort_source& as) {
+        if (auto err = admit(); err != errc::success) {
+            co_return err;
+        }
+        if (auto err = co_await throttle(_requests_tb, 1, as);
+            err != errc::success) {
+            abandon_probe();
+            co_return err;
+        }
+        co_return outcome::success();
+    }
+
+    /// Charge downloaded bytes to the download bandwidth
+    ///
+    /// Resolves once the bytes fit in the rate, which delays the next
+    /// download of the caller.
+    ss::future<result<void>>
+    charge_download(size_t bytes, ss::abort_source& as) {
+        if (auto err = co_await throttle(_download_tb, bytes, as);
+            err != errc::success) {
+            co_return err;
+        }
+        co_return outcome::success();
+    }
+
+    /// Report a successful storage request
+    void record_success() noexcept {
+        _consecutive_errors = 0;
+        _state = breaker_state::closed;
+    }
+
+    /// Report a failed storage request, shutdown errors should not be
+    /// reported
+    void record_failure() noexcept {
+        ++_consecutive_errors;
+        if (
+          _state == breaker_state::half_open
+          || _consecutive_errors >= _error_threshold) {
+            _state = breaker_state::open;
+            _opened_at = Clock::now();
+        }
+    }
+
+    /// Returns true if requests currently fail fast
+    bool is_circuit_open() const noexcept {
+        switch (_state) {
+        case breaker_state::closed:
+            return false;
+        case breaker_state::half_open:
+            return true;
+        case breaker_state::open:
+            return Clock::now() - _opened_at < _breaker_cooldown;
+        }
+        unreachable();
+    }
+
+private:
+    enum class breaker_state {
+        closed,
+        open,
+        /// A single request is in flight after the cooldown
+        half_open,
+    };
+
+    errc admit() noexcept {
+        switch (_state) {
+        case breaker_state::closed:
+            return errc::success;
+        case breaker_state::half_open:
+            return errc::circuit_breaker_open;
+        case breaker_state::open:
+            if (Clock::now() - _opened_at < _breaker_cooldown) {
+                return errc::circuit_breaker_open;
+            }
+            _state = breaker_state::half_open;
+            return errc::success;
+        }
+        unreachable();
+    }
+
+    /// The request admitted after the cooldown never reached the object
+    /// store, let the next one probe it
+    void abandon_probe() noexcept {
+        if (_state == breaker_state::half_open) {
+            _state = breaker_state::open;
+        }
+    }
+
+    static ss::future<errc> throttle(
+      std::optional<token_bucket<Clock>>& tb,
+      size_t size,
+      ss::abort_source& as) {
+        if (!tb.has_value() || size == 0) {
+            co_return errc::success;
+        }
+        auto fut = co_await ss::coroutine::as_future(tb->throttle(size, as));
+        if (fut.failed()) {
+            co_return to_errc(fut.get_exception());
+        }
+        co_return errc::success;
+    }
+
+    static errc to_errc(const std::exception_ptr& e) {
+        if (ssx::is_shutdown_exception(e)) {
+            return errc::shutting_down;
+        }
+        return errc::unexpected_failure;
+    }
+
+    size_t _error_threshold;
+    typename Clock::duration _breaker_cooldown;
+    breaker_state _state{breaker_state::closed};
+    size_t _consecutive_errors{0};
+    typename Clock::time_point _opened_at;
+
+    ssx::semaphore _memory;
+    std::optional<size_t> _memory_limit;
+    std::optional<token_bucket<Clock>> _upload_tb;
+    std::optional<token_bucket<Clock>> _download_tb;
+    std::optional<token_bucket<Clock>> _requests_tb;
+};
+
+} // namespace experimental::cloud_topics
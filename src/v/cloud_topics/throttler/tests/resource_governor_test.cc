@@ -0,0 +1,108 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "cloud_topics/errc.h"
+#include "cloud_topics/throttler/resource_governor.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/manual_clock.hh>
+#include <seastar/util/later.hh>
+
+#include <chrono>
+
+namespace cloud_topics = experimental::cloud_topics;
+using namespace std::chrono_literals;
+
+using governor_t = cloud_topics::resource_governor<ss::manual_clock>;
+
+TEST_CORO(resource_governor_test, no_limits) {
+    governor_t governor({});
+    ss::abort_source as;
+    auto units = co_await governor.acquire_upload(10_MiB, as);
+    ASSERT_TRUE_CORO(units.has_value());
+    auto download = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(download.has_value());
+    governor.stop();
+}
+
+TEST_CORO(resource_governor_test, circuit_breaker) {
+    governor_t governor({
+      .error_threshold = 3,
+      .breaker_cooldown = 1s,
+    });
+    ss::abort_source as;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_FALSE_CORO(governor.is_circuit_open());
+        auto units = co_await governor.acquire_upload(1, as);
+        ASSERT_TRUE_CORO(units.has_value());
+        governor.record_failure();
+    }
+    ASSERT_TRUE_CORO(governor.is_circuit_open());
+    auto rejected = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(rejected.has_error());
+    ASSERT_EQ_CORO(rejected.error(), cloud_topics::errc::circuit_breaker_open);
+
+    // After the cooldown a single request is admitted
+    ss::manual_clock::advance(1s);
+    ASSERT_FALSE_CORO(governor.is_circuit_open());
+    auto probe = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(probe.has_value());
+    auto concurrent = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(concurrent.has_error());
+
+    // Failed probe re-opens the breaker
+    governor.record_failure();
+    ASSERT_TRUE_CORO(governor.is_circuit_open());
+
+    ss::manual_clock::advance(1s);
+    probe = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(probe.has_value());
+    governor.record_success();
+    ASSERT_FALSE_CORO(governor.is_circuit_open());
+    auto admitted = co_await governor.acquire_download(as);
+    ASSERT_TRUE_CORO(admitted.has_value());
+    governor.stop();
+}
+
+TEST_CORO(resource_governor_test, memory_limit) {
+    governor_t governor({.memory_bytes = 100});
+    ss::abort_source as;
+    auto first = co_await governor.acquire_upload(80, as);
+    ASSERT_TRUE_CORO(first.has_value());
+
+    auto second_fut = governor.acquire_upload(80, as);
+    co_await ss::yield();
+    ASSERT_FALSE_CORO(second_fut.available());
+
+    // Release the memory of the first upload
+    first.value().return_all();
+    auto second = co_await std::move(second_fut);
+    ASSERT_TRUE_CORO(second.has_value());
+
+    // Payloads larger than the limit are admitted alone
+    second.value().return_all();
+    auto large = co_await governor.acquire_upload(1_MiB, as);
+    ASSERT_TRUE_CORO(large.has_value());
+    governor.stop();
+}
+
+TEST_CORO(resource_governor_test, stop_fails_waiters) {
+    governor_t governor({.memory_bytes = 100});
+    ss::abort_source as;
+    auto first = co_await governor.acquire_upload(100, as);
+    ASSERT_TRUE_CORO(first.has_value());
+
+    auto waiter = governor.acquire_upload(1, as);
+    co_await ss::yield();
+    governor.stop();
+    auto res = co_await std::move(waiter);
+    ASSERT_TRUE_CORO(res.has_error());
+    ASSERT_EQ_CORO(res.error(), cloud_topics::errc::shutting_down);
+}
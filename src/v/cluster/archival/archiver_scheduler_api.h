@@ -39,10 +39,14 @@ struct upload_resource_usage {
     std::optional<typename Clock::time_point> next_housekeeping;
     // Time of the next manifest upload
     std::optional<typename Clock::time_point> next_manifest_upload;
+    // Number of uploads which failed, most likely because the object store
+    // throttled the requests
+    size_t failed_uploads{0};
 
     bool operator==(const upload_resource_usage& o) const noexcept {
         return ntp == o.ntp && put_requests_used == o.put_requests_used
                && uploaded_bytes == o.uploaded_bytes && errc == o.errc
+               && failed_uploads == o.failed_uploads
                && archiver_rtc.get().same_root(o.archiver_rtc.get());
     }
 };
@@ -101,11 +105,12 @@ operator<<(std::ostream& o, const upload_resource_usage<Clock>& s) {
     fmt::print(
       o,
       "upload_resource_usage(ntp={}, put_requests_used={}, uploaded_bytes={}, "
-      "errc={})",
+      "errc={}, failed_uploads={})",
       s.ntp,
       s.put_requests_used,
       s.uploaded_bytes,
-      s.errc);
+      s.errc,
+      s.failed_uploads);
     return o;
 }
 
@@ -14,17 +14,31 @@
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/sleep.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 
 using namespace std::chrono_literals;
 
+namespace {
+/// Throttling shows up as failures of many partitions at once, they are
+/// treated as a single signal.
+constexpr auto rate_decrease_interval = 1s;
+/// Fraction of the configured rate by which the rate grows on success
+constexpr size_t rate_increase_divisor = 20;
+/// The rate never goes below this fraction of the configured rate
+constexpr size_t min_rate_divisor = 10;
+} // namespace
+
 namespace archival {
 
 template<class Clock>
 archiver_scheduler<Clock>::archiver_scheduler(
   size_t upload_tput_rate, size_t upload_requests_rate)
-  : _shard_tput_limit(upload_tput_rate, "archiver_upload_tput_rate")
+  : _max_tput_rate(upload_tput_rate)
+  , _max_requests_rate(upload_requests_rate)
+  , _requests_rate(upload_requests_rate)
+  , _shard_tput_limit(upload_tput_rate, "archiver_upload_tput_rate")
   , _put_requests(upload_requests_rate, "archiver_upload_requests_rate")
   , _initial_backoff(config::shard_local_cfg()
                        .cloud_storage_upload_loop_initial_backoff_ms.bind())
@@ -44,6 +58,7 @@ archiver_scheduler<Clock>::maybe_suspend_upload(
     }
     auto& v = it->second;
     auto ntp_holder = v->gate.hold();
+    govern_upload_rate(arg);
     if (arg.errc) {
         // The error has occurred. We need to apply exponential backoff
         // to avoid consuming requests.
@@ -115,6 +130,49 @@ archiver_scheduler<Clock>::maybe_suspend_upload(
     co_return res;
 }
 
+template<class Clock>
+void archiver_scheduler<Clock>::govern_upload_rate(
+  const upload_resource_usage<Clock>& arg) {
+    if (_max_requests_rate == 0) {
+        return;
+    }
+    auto rate = _requests_rate;
+    if (arg.failed_uploads > 0) {
+        auto now = Clock::now();
+        if (
+          _last_rate_decrease.has_value()
+          && now - _last_rate_decrease.value() < rate_decrease_interval) {
+            return;
+        }
+        _last_rate_decrease = now;
+        const auto min_rate = std::max<size_t>(
+          1, _max_requests_rate / min_rate_divisor);
+        rate = std::max(min_rate, rate / 2);
+        vlog(
+          archival_log.info,
+          "{} uploads of {} failed, upload rate limit changes from {} to {} "
+          "requests/s",
+          arg.failed_uploads,
+          arg.ntp,
+          _requests_rate,
+          rate);
+    } else if (arg.put_requests_used > 0 && !arg.errc) {
+        const auto step = std::max<size_t>(
+          1, _max_requests_rate / rate_increase_divisor);
+        rate = std::min(_max_requests_rate, rate + step);
+    }
+    if (rate == _requests_rate) {
+        return;
+    }
+    _requests_rate = rate;
+    _put_requests.update_rate(rate);
+    // scale the throughput limit by the same factor, avoiding the overflow
+    // of _max_tput_rate * rate
+    _shard_tput_limit.update_rate(
+      _max_tput_rate / _max_requests_rate * rate
+      + _max_tput_rate % _max_requests_rate * rate / _max_requests_rate);
+}
+
 template<class Clock>
 ss::future<> archiver_scheduler<Clock>::create_ntp_state(model::ntp ntp) {
     auto it = _partitions.find(ntp);
@@ -20,6 +20,7 @@
 #include <absl/container/btree_map.h>
 
 #include <chrono>
+#include <optional>
 
 namespace archival {
 
@@ -50,6 +51,19 @@ public:
     ss::future<> stop() override;
 
 private:
+    /// Halves the shard's upload limits when uploads fail, which happens
+    /// mostly when the object store throttles requests (503 SlowDown), and
+    /// raises them back step by step while uploads succeed. All partitions
+    /// of the shard share the limits, so a throttled store sees fewer
+    /// requests instead of every partition retrying on its own schedule.
+    void govern_upload_rate(const upload_resource_usage<Clock>& arg);
+
+    const size_t _max_tput_rate;
+    const size_t _max_requests_rate;
+    /// Current PUT request rate set by the governor
+    size_t _requests_rate;
+    std::optional<typename Clock::time_point> _last_rate_decrease;
+
     // Global shard throughput limit
     token_bucket<Clock> _shard_tput_limit;
     /// Global limit on PUT request rate
@@ -18,6 +18,7 @@
 #include "cloud_storage/remote_path_provider.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_frames.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
@@ -940,6 +941,7 @@ ss::future<> ntp_archiver::upload_until_term_change() {
         usage.errc = {};
         usage.uploaded_bytes = 0;
         usage.put_requests_used = 0;
+        usage.failed_uploads = 0;
 
         // Hold semaphore units to enable other code to know that we are in
         // the process of doing uploads + wait for us to drop out if they
@@ -1029,6 +1031,13 @@ ss::future<> ntp_archiver::upload_until_term_change() {
         }
 
         const auto& upl_results = upload_list.value().results;
+        usage.failed_uploads = static_cast<size_t>(std::count_if(
+          upl_results.begin(),
+          upl_results.end(),
+          [](cloud_storage::upload_result r) {
+              return r != cloud_storage::upload_result::success
+                     && r != cloud_storage::upload_result::cancelled;
+          }));
         const auto all_failed = std::all_of(
           upl_results.begin(),
           upl_results.end(),
@@ -1080,6 +1089,8 @@ ss::future<> ntp_archiver::upload_until_term_change() {
 }
 
 ss::future<> ntp_archiver::sync_manifest_until_term_change() {
+    // The manifest may have been replaced by another leader in the meantime
+    _read_replica_manifest_etag.reset();
     while (can_update_archival_metadata()) {
         if (!_feature_table.local().is_active(
               features::feature::cloud_storage_manifest_format_v2)) {
@@ -1118,7 +1129,39 @@ ss::future<> ntp_archiver::sync_manifest_until_term_change() {
     }
 }
 
+ss::future<std::optional<ss::sstring>> ntp_archiver::fetch_manifest_etag() {
+    retry_chain_node fib(
+      _conf->manifest_upload_timeout(),
+      _conf->cloud_storage_initial_backoff(),
+      &_rtcnode);
+    auto path = remote_path_provider().partition_manifest_path(_ntp, _rev);
+    auto res = co_await _remote.head_object(
+      get_bucket_name(),
+      cloud_storage_clients::object_key{path},
+      fib,
+      cloud_storage::existence_check_type::manifest);
+    if (
+      res.result != cloud_storage::download_result::success
+      || !res.metadata.has_value() || res.metadata->etag.empty()) {
+        co_return std::nullopt;
+    }
+    co_return std::move(res.metadata->etag);
+}
+
 ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
+    // The manifest is only downloaded if its etag changed since the last
+    // sync. A HEAD request is much cheaper than downloading and decoding a
+    // large manifest just to find out that it is the same. If the etag is
+    // not available the manifest is downloaded and compared as before.
+    auto etag = co_await fetch_manifest_etag();
+    if (etag.has_value() && etag == _read_replica_manifest_etag) {
+        vlog(
+          _rtclog.debug,
+          "Manifest etag {} has not changed, no sync required",
+          *etag);
+        co_return cloud_storage::download_result::success;
+    }
+
     vlog(_rtclog.debug, "Downloading manifest in read-replica mode");
     auto [m, res] = co_await download_manifest();
     if (res != cloud_storage::download_result::success) {
@@ -1128,13 +1171,11 @@ ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
         co_return res;
     } else {
         if (m == _parent.archival_meta_stm()->manifest()) {
-            // TODO: This can be made more efficient by using a conditional GET:
-            // https://github.com/redpanda-data/redpanda/issues/11776
-            //
-            // Then, the GET can be adapted to return the raw buffer, so that we
-            // don't go through a deserialize/serialize cycle before writing the
-            // manifest back into a raft batch.
+            // TODO: the GET can be adapted to return the raw buffer, so that
+            // we don't go through a deserialize/serialize cycle before writing
+            // the manifest back into a raft batch.
             vlog(_rtclog.debug, "Manifest has not changed, no sync required");
+            _read_replica_manifest_etag = std::move(etag);
             co_return res;
         }
 
@@ -1169,6 +1210,9 @@ ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
               errc.message());
             co_return cloud_storage::download_result::failed;
         }
+        // The etag was taken before the download, if the manifest changed in
+        // between the next sync sees a new etag and downloads it again
+        _read_replica_manifest_etag = std::move(etag);
     }
 
     _last_sync_time = ss::lowres_clock::now();
@@ -1471,7 +1515,8 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
   const remote_segment_path& path,
   upload_candidate candidate,
   ss::input_stream<char> stream,
-  std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
+  std::optional<std::reference_wrapper<retry_chain_node>> source_rtc,
+  std::optional<cloud_storage::segment_frame_index> frames) {
     auto rtc = source_rtc.value_or(std::ref(_rtcnode));
     retry_chain_node fib(
       _conf->segment_upload_timeout(),
@@ -1481,6 +1526,10 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
 
     vlog(ctxlog.debug, "Uploading segment {} to {}", candidate, path);
 
+    const auto content_length = frames.has_value()
+                                  ? frames->compressed_size()
+                                  : candidate.content_length;
+
     auto lazy_abort = lazy_abort_source{
       [this]() { return upload_should_abort(); },
     };
@@ -1516,7 +1565,7 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
     };
 
     std::optional<ss::input_stream<char>> stream_state = std::move(stream);
-    auto reset_func = [this, candidate, &stream_state] {
+    auto reset_func = [this, candidate, &stream_state, &frames] {
         using provider_t = std::unique_ptr<stream_provider>;
         // On first attempt to upload, the stream-ref passed in is used.
         if (stream_state.has_value()) {
@@ -1525,6 +1574,19 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
                 std::move(stream_state.value())));
             stream_state = std::nullopt;
             return f;
+        } else if (frames.has_value()) {
+            // The segment is compressed again for the known frame layout,
+            // the stream fails if the output doesn't match it.
+            return ss::make_ready_future<provider_t>(
+              std::make_unique<stream_wrapper>(
+                cloud_storage::make_frame_compression_stream(
+                  storage::concat_segment_reader_view{
+                    candidate.sources,
+                    candidate.file_offset,
+                    candidate.final_file_offset,
+                    _conf->upload_io_priority}
+                    .take_stream(),
+                  frames.value())));
         } else {
             // On subsequent uploads, the segment is read again from disk
             return ss::make_ready_future<provider_t>(
@@ -1541,7 +1603,7 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
         response = co_await _remote.upload_segment(
           get_bucket_name(),
           path,
-          candidate.content_length,
+          content_length,
           std::move(reset_func),
           fib,
           lazy_abort);
@@ -1589,11 +1651,16 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
       candidate.remote_sources.empty(),
       "This method can only work with local segments");
 
+    auto path = segment_path_for_candidate(archiver_term, candidate);
+
+    if (config::shard_local_cfg().cloud_storage_compress_segment_uploads()) {
+        co_return co_await upload_compressed_segment(
+          path, std::move(candidate), source_rtc);
+    }
+
     auto [stream_upload, stream_index] = split_segment_stream(
       candidate, _conf->upload_io_priority);
 
-    auto path = segment_path_for_candidate(archiver_term, candidate);
-
     auto upload_fut = do_upload_segment(
       path, candidate, std::move(stream_upload), source_rtc);
 
@@ -1673,6 +1740,115 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
     // manifest.
 }
 
+namespace {
+ss::future<> drain_stream(ss::input_stream<char> stream) {
+    std::exception_ptr ex;
+    try {
+        while (!(co_await stream.read()).empty()) {
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await stream.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+} // namespace
+
+ss::future<ntp_archiver_upload_result> ntp_archiver::upload_compressed_segment(
+  const remote_segment_path& path,
+  upload_candidate candidate,
+  std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
+    auto [stream_frames, stream_index] = split_segment_stream(
+      candidate, _conf->upload_io_priority);
+
+    // The object size has to be known before the upload starts, so the
+    // frames are compressed once to measure them and once more during the
+    // upload.
+    cloud_storage::segment_frame_index frames;
+    auto measure_fut = drain_stream(cloud_storage::make_frame_compression_stream(
+      std::move(stream_frames), frames));
+
+    auto index_path = make_index_path(path);
+    auto make_idx_fut = make_segment_index(
+      candidate.starting_offset,
+      candidate.base_timestamp,
+      _rtclog,
+      index_path,
+      std::move(stream_index));
+
+    auto [measure_res, idx_res] = co_await ss::when_all(
+      std::move(measure_fut), std::move(make_idx_fut));
+    if (measure_res.failed()) {
+        auto ex = measure_res.get_exception();
+        if (ssx::is_shutdown_exception(ex)) {
+            co_return cloud_storage::upload_result::cancelled;
+        }
+        vlog(_rtclog.error, "failed to compress segment {}: {}", path, ex);
+        co_return cloud_storage::upload_result::failed;
+    }
+    auto index = idx_res.get();
+    if (!index.has_value()) {
+        vlog(
+          _rtclog.warn,
+          "skipping compressed upload of segment {}, index could not be "
+          "generated",
+          path);
+        co_return cloud_storage::upload_result::failed;
+    }
+    vlog(
+      _rtclog.debug,
+      "Segment {} of {} bytes is compressed to {} bytes in {} frames",
+      path,
+      frames.uncompressed_size,
+      frames.compressed_size(),
+      frames.num_frames());
+
+    auto upload_res = co_await do_upload_segment(
+      path,
+      candidate,
+      cloud_storage::make_frame_compression_stream(
+        storage::concat_segment_reader_view{
+          candidate.sources,
+          candidate.file_offset,
+          candidate.final_file_offset,
+          _conf->upload_io_priority}
+          .take_stream(),
+        frames),
+      source_rtc,
+      frames);
+    if (upload_res != cloud_storage::upload_result::success) {
+        co_return upload_res;
+    }
+
+    auto rtc = source_rtc.value_or(std::ref(_rtcnode));
+    retry_chain_node fib(
+      _conf->segment_upload_timeout(),
+      _conf->cloud_storage_initial_backoff(),
+      &rtc.get());
+
+    // Unlike uncompressed segments, the read path can't rebuild the index of
+    // a compressed segment because the frame layout is stored in it, so the
+    // upload only succeeds together with the index.
+    index->index.set_frame_index(std::move(frames));
+    auto idx_upload_res = co_await _remote.upload_index(
+      _conf->bucket_name,
+      cloud_storage_clients::object_key{index_path},
+      index->index,
+      fib);
+    if (idx_upload_res != cloud_storage::upload_result::success) {
+        vlog(
+          _rtclog.warn,
+          "failed to upload index {} of compressed segment {}: {}",
+          index_path,
+          path,
+          idx_upload_res);
+        co_return idx_upload_res;
+    }
+    co_return ntp_archiver_upload_result(index->stats);
+}
+
 std::optional<ss::sstring> ntp_archiver::upload_should_abort() const {
     if (unlikely(lost_leadership())) {
         return fmt::format(
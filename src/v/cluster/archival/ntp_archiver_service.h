@@ -528,15 +528,27 @@ private:
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
+    /// Uploads a local segment compressed in independent frames. The first
+    /// pass over the segment builds its index and the frame layout, the
+    /// second one uploads the compressed data.
+    ss::future<ntp_archiver_upload_result> upload_compressed_segment(
+      const remote_segment_path& path,
+      upload_candidate candidate,
+      std::optional<std::reference_wrapper<retry_chain_node>> source_rtc);
+
     /// Isolates segment upload and accepts a stream reference, so that if the
     /// upload fails the exception can be handled in the caller and the stream
     /// can be closed.
+    ///
+    /// If \p frames is set the stream contains the compressed segment with
+    /// this frame layout.
     ss::future<cloud_storage::upload_result> do_upload_segment(
       const remote_segment_path& path,
       upload_candidate candidate,
       ss::input_stream<char> stream,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
-      = std::nullopt);
+      = std::nullopt,
+      std::optional<cloud_storage::segment_frame_index> frames = std::nullopt);
 
     /// Get aborted transactions for upload
     ///
@@ -602,6 +614,9 @@ private:
     /// our term changes or abort source fires
     ss::future<> sync_manifest_until_term_change();
 
+    /// Etag of the partition manifest in the bucket, if it can be fetched
+    ss::future<std::optional<ss::sstring>> fetch_manifest_etag();
+
     /// Outer loop to keep invoking sync_manifest_until_term_change until our
     /// abort source fires.
     ss::future<> sync_manifest_until_abort();
@@ -708,6 +723,8 @@ private:
 
     // When we last synced the manifest of the read replica
     std::optional<ss::lowres_clock::time_point> _last_sync_time;
+    // Etag of the read replica manifest which is replicated in this term
+    std::optional<ss::sstring> _read_replica_manifest_etag;
 
     // Used during leadership transfer: instructs the archiver to
     // not proceed with uploads, even if it has leadership.
@@ -27,10 +27,18 @@
 #include "config/node_config.h"
 #include "hashing/xx.h"
 
+#include <seastar/core/loop.hh>
+
+#include <ranges>
+
 namespace {
 static constexpr std::string_view json_extension = ".json";
 
 static constexpr auto partition_purge_timeout = 20s;
+
+// Manifests of a partition are purged concurrently so that the keys of their
+// segments end up in the same DeleteObjects requests.
+static constexpr size_t max_concurrent_manifest_purges = 4;
 } // namespace
 
 namespace archival {
@@ -98,47 +106,53 @@ ss::future<purger::purge_result> purger::purge_partition(
 
     size_t ops_performed = 0;
     size_t permanent_failure = 0;
-    for (auto rit = manifests_to_purge.rbegin();
-         rit != manifests_to_purge.rend();
-         ++rit) {
-        auto format = cloud_storage::manifest_format::serde;
-        if (std::string_view{*rit}.ends_with(json_extension)) {
-            format = cloud_storage::manifest_format::json;
-        }
-
-        const auto local_res = co_await purge_manifest(
-          bucket,
-          path_provider,
-          ntp,
-          remote_revision,
-          remote_manifest_path{*rit},
-          format,
-          partition_purge_rtc);
-
-        ops_performed += local_res.ops;
-
-        switch (local_res.status) {
-        case purge_status::retryable_failure:
-            // Drop out when encountering a retry-able failure. These are often
-            // back-offs from cloud storage, so it's wise to terminate the scrub
-            // and retry later.
-            vlog(
-              ctxlog.info,
-              "Retryable failures encountered while purging partition {}. Will "
-              "retry ...",
-              ntp);
+    size_t retryable_failure = 0;
+    co_await ss::max_concurrent_for_each(
+      std::views::reverse(manifests_to_purge),
+      max_concurrent_manifest_purges,
+      [&](const ss::sstring& path) -> ss::future<> {
+          auto format = cloud_storage::manifest_format::serde;
+          if (std::string_view{path}.ends_with(json_extension)) {
+              format = cloud_storage::manifest_format::json;
+          }
+
+          const auto local_res = co_await purge_manifest(
+            bucket,
+            path_provider,
+            ntp,
+            remote_revision,
+            remote_manifest_path{path},
+            format,
+            partition_purge_rtc);
+
+          ops_performed += local_res.ops;
+
+          switch (local_res.status) {
+          case purge_status::retryable_failure:
+              ++retryable_failure;
+              break;
+          case purge_status::permanent_failure:
+              // Keep going when encountering a permanent failure. We might
+              // still be able to purge subsequent manifests.
+              ++permanent_failure;
+              break;
+          case purge_status::success:
+              break;
+          }
+      });
+
+    if (retryable_failure > 0) {
+        // Drop out when encountering a retry-able failure. These are often
+        // back-offs from cloud storage, so it's wise to terminate the scrub
+        // and retry later.
+        vlog(
+          ctxlog.info,
+          "Retryable failures encountered while purging partition {}. Will "
+          "retry ...",
+          ntp);
 
-            co_return purge_result{
-              .status = purge_status::retryable_failure, .ops = ops_performed};
-            break;
-        case purge_status::permanent_failure:
-            // Keep going when encountering a permanent failure. We might still
-            // be able to purge subsequent manifests.
-            ++permanent_failure;
-            break;
-        case purge_status::success:
-            break;
-        }
+        co_return purge_result{
+          .status = purge_status::retryable_failure, .ops = ops_performed};
     }
 
     if (legacy_manifest_path) {
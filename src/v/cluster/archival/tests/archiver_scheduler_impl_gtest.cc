@@ -343,4 +343,60 @@ TEST_CORO(archiver_scheduler_impl_test, test_abort_requested_while_throttling) {
     co_return;
 }
 
+TEST_CORO(archiver_scheduler_impl_test, test_failed_uploads_reduce_rate) {
+    // Check the following behavior:
+    // - failed uploads halve the request and throughput limits
+    // - failures which follow shortly after don't reduce them again
+    // - successful uploads raise the limits again
+    model::ntp expected_ntp(
+      model::kafka_namespace,
+      model::topic("panda-topic"),
+      model::partition_id(137));
+    ss::abort_source as;
+    basic_retry_chain_node<ss::manual_clock> rtcnode(as);
+
+    archiver_scheduler<ss::manual_clock> scheduler(100, 10);
+
+    co_await scheduler.start();
+
+    co_await scheduler.create_ntp_state(expected_ntp);
+
+    auto suspend = [&](size_t failed_uploads) {
+        return scheduler.maybe_suspend_upload(
+          upload_resource_usage<ss::manual_clock>{
+            .ntp = expected_ntp,
+            .put_requests_used = 1,
+            .uploaded_bytes = 10,
+            .errc = {},
+            .archiver_rtc = std::ref(rtcnode),
+            .failed_uploads = failed_uploads,
+          });
+    };
+
+    // rate is halved to 5 rps and 50 bytes/s
+    auto quota1 = co_await suspend(1);
+    ASSERT_TRUE_CORO(quota1.has_value());
+    ASSERT_EQ_CORO(quota1.value().requests_quota, 4);
+    ASSERT_EQ_CORO(quota1.value().upload_size_quota, 40);
+
+    // the second failure is a part of the same throttling episode
+    auto quota2 = co_await suspend(2);
+    ASSERT_TRUE_CORO(quota2.has_value());
+    ASSERT_EQ_CORO(quota2.value().requests_quota, 3);
+    ASSERT_EQ_CORO(quota2.value().upload_size_quota, 30);
+
+    // success raises the rate to 6 rps and 60 bytes/s, the extra tokens
+    // cover the usage
+    auto quota3 = co_await suspend(0);
+    ASSERT_TRUE_CORO(quota3.has_value());
+    ASSERT_EQ_CORO(quota3.value().requests_quota, 3);
+    ASSERT_EQ_CORO(quota3.value().upload_size_quota, 30);
+
+    co_await scheduler.dispose_ntp_state(expected_ntp);
+
+    co_await scheduler.stop();
+
+    co_return;
+}
+
 } // namespace archival
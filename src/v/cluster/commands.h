@@ -102,6 +102,7 @@ inline constexpr int8_t force_partition_reconfiguration_type = 11;
 inline constexpr int8_t update_partition_replicas_cmd_type = 12;
 inline constexpr int8_t set_topic_partitions_disabled_cmd_type = 13;
 inline constexpr int8_t bulk_force_reconfiguration_cmd_type = 14;
+inline constexpr int8_t bulk_create_topics_cmd_type = 15;
 
 inline constexpr int8_t create_user_cmd_type = 5;
 inline constexpr int8_t delete_user_cmd_type = 6;
@@ -252,6 +253,17 @@ using bulk_force_reconfiguration_cmd = controller_command<
   model::record_batch_type::topic_management_cmd,
   serde_opts::serde_only>;
 
+/**
+ * Used to create multiple topics at once. The topics are created atomically,
+ * either all of them or none.
+ */
+using bulk_create_topics_cmd = controller_command<
+  int8_t, // unused
+  bulk_create_topics_cmd_data,
+  bulk_create_topics_cmd_type,
+  model::record_batch_type::topic_management_cmd,
+  serde_opts::serde_only>;
+
 using create_user_cmd = controller_command<
   security::credential_user,
   security::scram_credential,
@@ -364,6 +364,7 @@ ss::future<> controller::start(
           std::move(limiter_conf),
           std::ref(_feature_table),
           config::shard_local_cfg().controller_snapshot_max_age_sec.bind(),
+          config::shard_local_cfg().controller_snapshot_max_log_entries.bind(),
           std::ref(clusterlog),
           _raft0.get(),
           raft::persistent_last_applied::yes,
@@ -508,10 +509,12 @@ ss::future<> controller::start(
       std::ref(_storage),
       std::ref(_tp_state),
       std::ref(_backend),
+      std::ref(_partition_manager),
       config::shard_local_cfg().core_balancing_on_core_count_change.bind(),
       config::shard_local_cfg().core_balancing_debounce_timeout.bind(),
       config::shard_local_cfg().topic_partitions_per_shard.bind(),
-      config::shard_local_cfg().topic_partitions_reserve_shard0.bind());
+      config::shard_local_cfg().topic_partitions_reserve_shard0.bind(),
+      config::shard_local_cfg().core_balancing_by_load.bind());
 
     co_await _drain_manager.invoke_on_all(&drain_manager::start);
 
@@ -45,6 +45,7 @@
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/switch_to.hh>
@@ -299,6 +300,10 @@ controller_backend::controller_backend(
       std::move(retention_local_target_ms_default))
   , _retention_local_strict(std::move(retention_local_strict))
   , _as(as) {
+    _data_directories.push_back(_data_directory);
+    for (const auto& dir : config::node().additional_data_directories()) {
+        _data_directories.push_back(dir);
+    }
     _housekeeping_interval.watch([this] {
         _housekeeping_jitter = simple_time_jitter<ss::lowres_clock>(
           _housekeeping_interval());
@@ -496,6 +501,21 @@ controller_backend::calculate_learner_initial_offset(
         return std::nullopt;
     }
 
+    /**
+     * >>> min local retention move <<<
+     * Everything already uploaded is served from the cloud, only the tail
+     * which is not yet uploaded is delivered to the learner.
+     */
+    if (policy == reconfiguration_policy::min_local_retention) {
+        const auto uploaded = p->archival_meta_stm()->max_collectible_offset();
+        vlog(
+          clusterlog.info,
+          "[{}] min local retention move requested, last uploaded offset: {}",
+          p->ntp(),
+          uploaded);
+        return model::next_offset(uploaded);
+    }
+
     auto log = p->log();
     /**
      * Calculate retention targets based on cluster and topic configuration
@@ -607,6 +627,17 @@ void controller_backend::process_delta(const topic_table::ntp_delta& d) {
         _partition_leaders_table.local().remove_leader(d.ntp, d.revision);
     }
 
+    // Every shard receives the deltas of all partitions but only the shards
+    // with a placement of the partition have anything to reconcile. If the
+    // partition is placed on this shard later on, the shard_balancer notifies
+    // the reconciliation then.
+    const bool placed_here = _states.contains(d.ntp)
+                             || _shard_placement.state_on_this_shard(d.ntp);
+    if (!placed_here) {
+        vlog(clusterlog.trace, "[{}] not placed on this shard, skipping", d.ntp);
+        return;
+    }
+
     // notify reconciliation fiber
 
     auto [rs_it, inserted] = _states.try_emplace(d.ntp);
@@ -764,15 +795,60 @@ ss::future<> controller_backend::clear_orphan_topic_files(
         namespaces.emplace(t.ns);
     }
 
-    return _storage.local().log_mgr().remove_orphan_files(
-      _data_directory,
-      std::move(namespaces),
-      [bootstrap_revision,
-       topic_table_snapshot = std::move(topic_table_snapshot)](
-        model::ntp ntp, storage::partition_path::metadata p) {
-          return topic_files_are_orphan(
-            ntp, p, topic_table_snapshot, bootstrap_revision);
-      });
+    for (const auto& dir : _data_directories) {
+        co_await _storage.local().log_mgr().remove_orphan_files(
+          dir,
+          namespaces,
+          [bootstrap_revision, &topic_table_snapshot](
+            model::ntp ntp, storage::partition_path::metadata p) {
+              return topic_files_are_orphan(
+                ntp, p, topic_table_snapshot, bootstrap_revision);
+          });
+    }
+}
+
+ss::future<ss::sstring> controller_backend::select_data_directory(
+  const model::ntp& ntp, model::revision_id log_revision) {
+    if (_data_directories.size() == 1) {
+        co_return _data_directory;
+    }
+    // A partition which already has data on this node, e.g. after a restart
+    // or a cross shard move, stays where it is
+    for (const auto& dir : _data_directories) {
+        if (co_await ss::file_exists(
+              storage::ntp_config(ntp, dir, nullptr, log_revision)
+                .work_directory())) {
+            co_return dir;
+        }
+    }
+
+    absl::flat_hash_map<ss::sstring, size_t> partitions;
+    for (const auto& [_, p] : _partition_manager.local().partitions()) {
+        ++partitions[p->get_ntp_config().base_directory()];
+    }
+    const ss::sstring* selected = nullptr;
+    size_t selected_partitions = 0;
+    uint64_t selected_avail = 0;
+    for (const auto& dir : _data_directories) {
+        auto count = partitions[dir];
+        auto avail = co_await ss::fs_avail(dir);
+        if (
+          selected == nullptr || count < selected_partitions
+          || (count == selected_partitions && avail > selected_avail)) {
+            selected = &dir;
+            selected_partitions = count;
+            selected_avail = avail;
+        }
+    }
+    vlog(
+      clusterlog.debug,
+      "[{}] placing partition data in {}, it holds {} partitions of this "
+      "shard and has {} bytes available",
+      ntp,
+      *selected,
+      selected_partitions,
+      selected_avail);
+    co_return *selected;
 }
 
 ss::future<> controller_backend::reconcile_ntp_fiber(
@@ -1341,7 +1417,7 @@ ss::future<std::error_code> controller_backend::create_partition(
         }
 
         auto ntp_config = cfg.make_ntp_config(
-          _data_directory,
+          co_await select_data_directory(ntp, log_revision),
           ntp.tp.partition,
           log_revision,
           topic_rev,
@@ -297,6 +297,11 @@ private:
       const replicas_revision_map& replicas_revisions,
       force_reconfiguration is_force_reconfigured);
 
+    /// Directory to store the log of a partition in, see
+    /// config::node_config::additional_data_directories
+    ss::future<ss::sstring>
+    select_data_directory(const model::ntp&, model::revision_id log_revision);
+
     ss::future<> add_to_shard_table(
       model::ntp,
       raft::group_id,
@@ -391,6 +396,8 @@ private:
     ss::sharded<features::feature_table>& _features;
     model::node_id _self;
     ss::sstring _data_directory;
+    // _data_directory followed by the additional data directories
+    std::vector<ss::sstring> _data_directories;
     config::binding<std::chrono::milliseconds> _housekeeping_interval;
     simple_time_jitter<ss::lowres_clock> _housekeeping_jitter;
     config::binding<std::optional<size_t>>
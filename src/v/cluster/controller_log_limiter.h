@@ -73,6 +73,7 @@ public:
         }
         if constexpr (
           std::is_same_v<Cmd, create_topic_cmd> ||            //
+          std::is_same_v<Cmd, bulk_create_topics_cmd> ||      //
           std::is_same_v<Cmd, delete_topic_cmd> ||            //
           std::is_same_v<Cmd, update_topic_properties_cmd> || //
           std::is_same_v<Cmd, create_partition_cmd> ||        //
@@ -279,7 +279,8 @@ struct client_quotas_t
     friend bool operator==(const client_quotas_t&, const client_quotas_t&)
       = default;
 
-    auto serde_fields() { return std::tie(quotas); }
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, const serde::header);
 };
 
 struct data_migrations_t
@@ -293,7 +294,8 @@ struct data_migrations_t
     friend bool operator==(const data_migrations_t&, const data_migrations_t&)
       = default;
 
-    auto serde_fields() { return std::tie(next_id, migrations); }
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, const serde::header);
 };
 
 } // namespace controller_snapshot_parts
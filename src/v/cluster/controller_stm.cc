@@ -33,10 +33,33 @@ ss::future<> controller_stm::on_batch_applied() {
 
     auto current_offset = model::next_offset(last_applied_offset());
     if (
-      current_offset > _raft->last_snapshot_index()
-      && !_snapshot_debounce_timer.armed()) {
+      current_offset <= _raft->last_snapshot_index() || _snapshot_in_progress) {
+        co_return;
+    }
+
+    // With a steady stream of commands the snapshot is created once it gets
+    // old, busy clusters may accumulate a long log to replay on restart in
+    // the meantime.
+    const auto max_entries = _snapshot_max_log_entries();
+    // last_snapshot_index is the default, minimal offset without a snapshot
+    const auto snapshot_index = std::max(
+      _raft->last_snapshot_index(), model::offset{-1});
+    const auto entries = static_cast<size_t>(
+      current_offset() - snapshot_index());
+    if (max_entries && entries >= *max_entries && ready_to_snapshot()) {
+        vlog(
+          clusterlog.debug,
+          "{} controller log entries since the last snapshot, creating a new "
+          "one",
+          entries);
+        _snapshot_debounce_timer.cancel();
+        snapshot_timer_callback();
+        co_return;
+    }
+
+    if (!_snapshot_debounce_timer.armed()) {
         _snapshot_debounce_timer.arm(_snapshot_max_age());
-    };
+    }
 }
 void controller_stm::shutdown_apply_loop() { _as.request_abort(); }
 
@@ -48,6 +71,7 @@ ss::future<> controller_stm::shutdown() {
 ss::future<> controller_stm::stop() { co_return; }
 
 void controller_stm::snapshot_timer_callback() {
+    _snapshot_in_progress = true;
     ssx::background
       = ssx::spawn_with_gate_then(_gate, [this] {
             return maybe_write_snapshot().then([](bool written) {
@@ -55,9 +79,11 @@ void controller_stm::snapshot_timer_callback() {
                     vlog(clusterlog.info, "skipped writing snapshot");
                 }
             });
-        }).handle_exception([](const std::exception_ptr& e) {
-            vlog(clusterlog.warn, "failed to write snapshot: {}", e);
-        });
+        })
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(clusterlog.warn, "failed to write snapshot: {}", e);
+          })
+          .finally([this] { _snapshot_in_progress = false; });
 }
 
 bool controller_stm::ready_to_snapshot() const {
@@ -48,11 +48,13 @@ public:
       limiter_configuration limiter_conf,
       ss::sharded<features::feature_table>& feature_table,
       config::binding<std::chrono::seconds>&& snapshot_max_age,
+      config::binding<std::optional<size_t>>&& snapshot_max_log_entries,
       Args&&... stm_args)
       : mux_state_machine(std::forward<Args>(stm_args)...)
       , _limiter(std::move(limiter_conf))
       , _feature_table(feature_table)
       , _snapshot_max_age(std::move(snapshot_max_age))
+      , _snapshot_max_log_entries(std::move(snapshot_max_log_entries))
       , _snapshot_debounce_timer([this] { snapshot_timer_callback(); }) {}
 
     controller_stm(controller_stm&&) = delete;
@@ -94,10 +96,12 @@ private:
     controller_log_limiter _limiter;
     ss::sharded<features::feature_table>& _feature_table;
     config::binding<std::chrono::seconds> _snapshot_max_age;
+    config::binding<std::optional<size_t>> _snapshot_max_log_entries;
 
     metrics_reporter_cluster_info _metrics_reporter_cluster_info;
 
     ss::timer<ss::lowres_clock> _snapshot_debounce_timer;
+    bool _snapshot_in_progress{false};
 };
 
 inline constexpr ss::shard_id controller_stm_shard = 0;
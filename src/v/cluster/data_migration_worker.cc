@@ -51,6 +51,7 @@ ss::future<> worker::stop() {
     while (!_managed_ntps.empty()) {
         unmanage_ntp(_managed_ntps.end() - 1, errc::shutting_down);
     }
+    _block_sem.broken();
     if (!_gate.is_closed()) {
         co_await _gate.close();
     }
@@ -194,6 +195,12 @@ void worker::unmanage_ntp(managed_ntp_cit it, errc result) {
     it->second.promise->set_value(result);
     it->second.as->request_abort();
     _managed_ntps.erase(it);
+    vlog(
+      dm_log.debug,
+      "partition work done with result {}, {} ntps still managed on this "
+      "shard",
+      result,
+      _managed_ntps.size());
 }
 
 ss::future<errc> worker::do_work(managed_ntp_cit it) noexcept {
@@ -212,6 +219,8 @@ ss::future<errc> worker::do_work(managed_ntp_cit it) noexcept {
               return do_work(ntp, sought_state, info);
           },
           it->second.work.info);
+    } catch (const ss::broken_semaphore&) {
+        co_return errc::shutting_down;
     } catch (...) {
         vlog(
           dm_log.warn,
@@ -269,9 +278,10 @@ ss::future<errc> worker::do_work(
 
 ss::future<errc>
 worker::block(ss::lw_shared_ptr<partition> partition, bool block) {
+    auto units = co_await ss::get_units(_block_sem, 1);
     auto res = co_await partition->set_writes_disabled(
       partition_properties_stm::writes_disabled{block},
-      model::timeout_clock::now() + 5s);
+      model::timeout_clock::now() + _operation_timeout);
     co_return map_update_interruption_error_code(res);
 }
 
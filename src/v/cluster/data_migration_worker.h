@@ -17,6 +17,7 @@
 #include "container/chunked_hash_map.h"
 #include "errc.h"
 #include "model/fundamental.h"
+#include "ssx/semaphore.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
@@ -84,6 +85,15 @@ private:
       state sought_state,
       const outbound_partition_work_info&);
 
+    /*
+     * Writes are disabled with a replicated command. Migrating a topic with
+     * thousands of partitions would otherwise replicate them all at once on
+     * this shard, they'd time out and be retried after a delay. The
+     * semaphore bounds the number of commands in flight, the units are only
+     * held until the command is replicated, not while waiting for uploads.
+     */
+    static constexpr size_t max_concurrent_block_operations = 64;
+
     ss::future<errc> block(ss::lw_shared_ptr<partition> partition, bool block);
     ss::future<errc> flush(ss::lw_shared_ptr<partition> partition);
 
@@ -94,6 +104,8 @@ private:
     std::chrono::milliseconds _operation_timeout;
 
     managed_ntps_map_t _managed_ntps;
+    ssx::semaphore _block_sem{
+      max_concurrent_block_operations, "dm/worker-block"};
     ss::gate _gate;
 };
 
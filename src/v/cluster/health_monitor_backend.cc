@@ -27,6 +27,7 @@
 #include "model/metadata.h"
 #include "raft/fwd.h"
 #include "rpc/connection_cache.h"
+#include "ssx/task_slice.h"
 #include "storage/types.h"
 
 #include <seastar/core/chunked_fifo.hh>
@@ -351,8 +352,9 @@ health_monitor_backend::maybe_refresh_cluster_health(
     co_return errc::success;
 }
 
-ss::future<result<node_health_report>>
-health_monitor_backend::collect_remote_node_health(model::node_id id) {
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::request_node_health(
+  model::node_id id, std::optional<node_health_report_version> acked) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
     return _connections.local()
       .with_node_client<controller_client_protocol>(
@@ -360,33 +362,72 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout, id](controller_client_protocol client) mutable {
+        [timeout, id, acked](controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request(id), rpc::client_opts(timeout));
+              get_node_health_request(id, acked), rpc::client_opts(timeout));
         })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
-      });
+      .then(&rpc::get_ctx_data<get_node_health_reply>);
+}
+
+ss::future<result<node_health_report>>
+health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    std::optional<node_health_report_version> acked;
+    if (auto it = _reports.find(id); it != _reports.end()) {
+        acked = it->second->report_version;
+    }
+    auto reply = co_await request_node_health(id, acked);
+    if (
+      reply && reply.value().report.has_value()
+      && reply.value().report->is_delta()) {
+        auto it = _reports.find(id);
+        if (
+          it == _reports.end()
+          || it->second->report_version != reply.value().report->delta_base) {
+            // the report the delta is based on was replaced in the meantime
+            vlog(
+              clusterlog.debug,
+              "requesting full health report from {}, delta based on {} "
+              "doesn't match the cached report",
+              id,
+              reply.value().report->delta_base);
+            reply = co_await request_node_health(id, std::nullopt);
+        }
+    }
+    co_return process_node_reply(id, std::move(reply));
 }
 
+namespace {
 result<node_health_report> map_reply_result(
-  model::node_id target_node_id, result<get_node_health_reply> reply) {
+  model::node_id target_node_id,
+  result<get_node_health_reply> reply,
+  const node_health_report* base) {
     if (!reply) {
         return {reply.error()};
     }
     if (!reply.value().report.has_value()) {
         return {reply.value().error};
     }
-    if (reply.value().report->id != target_node_id) {
+    auto& report = reply.value().report.value();
+    if (report.id != target_node_id) {
         return {errc::invalid_target_node_id};
     }
-    return {std::move(*reply.value().report).to_in_memory()};
+    if (report.is_delta()) {
+        if (base == nullptr || base->report_version != report.delta_base) {
+            return {errc::error_collecting_health_report};
+        }
+        return {apply_node_health_delta(*base, std::move(report))};
+    }
+    return {std::move(report).to_in_memory()};
 }
+} // namespace
 
 result<node_health_report> health_monitor_backend::process_node_reply(
   model::node_id id, result<get_node_health_reply> reply) {
-    auto res = map_reply_result(id, std::move(reply));
+    auto base_it = _reports.find(id);
+    auto res = map_reply_result(
+      id,
+      std::move(reply),
+      base_it == _reports.end() ? nullptr : base_it->second.get());
     auto [status_it, _] = _status.try_emplace(id);
     if (!res) {
         vlog(
@@ -574,6 +615,16 @@ health_monitor_backend::get_current_node_health() {
     co_return it->second;
 }
 
+ss::future<result<node_health_report_serde>>
+health_monitor_backend::get_current_node_health_since(
+  std::optional<node_health_report_version> acked) {
+    auto res = co_await get_current_node_health();
+    if (res.has_error()) {
+        co_return res.error();
+    }
+    co_return _report_tracker.make_report(*res.value(), acked);
+}
+
 namespace {
 
 struct ntp_report {
@@ -582,14 +633,19 @@ struct ntp_report {
 };
 
 chunked_vector<ntp_report> collect_shard_local_reports(partition_manager& pm) {
+    ssx::task_slice slice("health_report_collect");
     chunked_vector<ntp_report> reports;
 
     reports.reserve(pm.partitions().size());
+    const auto now = ss::lowres_clock::now();
     std::transform(
       pm.partitions().begin(),
       pm.partitions().end(),
       std::back_inserter(reports),
-      [](auto& p) {
+      [now](auto& p) {
+          // sampled on every collection so that the rate of a new leader
+          // covers only the time since the previous report
+          auto throughput = p.second->probe().sample_throughput(now);
           return ntp_report {
                   .tp_ns = model::topic_namespace(p.first.ns, p.first.tp.topic),
                   .status = partition_status{
@@ -604,6 +660,9 @@ chunked_vector<ntp_report> collect_shard_local_reports(partition_manager& pm) {
                     .reclaimable_size_bytes
                     = p.second->reclaimable_size_bytes(),
                     .shard = ss::this_shard_id(),
+                    .leader_throughput = p.second->is_leader()
+                                           ? std::make_optional(throughput)
+                                           : std::nullopt,
                   },
               };
       });
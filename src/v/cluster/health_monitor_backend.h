@@ -12,6 +12,7 @@
 #pragma once
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_tracker.h"
 #include "cluster/node/local_monitor.h"
 #include "cluster/notification.h"
 #include "features/feature_table.h"
@@ -75,6 +76,14 @@ public:
      */
     ss::future<result<node_health_report_ptr>> get_current_node_health();
 
+    /**
+     * Return the current node health report for a node which already has the
+     * report of version \p acked. The reply contains only the partitions
+     * which changed since then if possible.
+     */
+    ss::future<result<node_health_report_serde>> get_current_node_health_since(
+      std::optional<node_health_report_version> acked);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -121,6 +130,8 @@ private:
     ss::future<std::error_code> collect_cluster_health();
     ss::future<result<node_health_report>>
       collect_remote_node_health(model::node_id);
+    ss::future<result<get_node_health_reply>> request_node_health(
+      model::node_id, std::optional<node_health_report_version>);
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
@@ -196,6 +207,7 @@ private:
     cluster::notification_id_type _next_callback_id{0};
 
     mutex _report_collection_mutex{"health_report_collection"};
+    health_report_tracker _report_tracker;
 
     friend struct health_report_accessor;
 };
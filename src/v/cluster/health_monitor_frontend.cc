@@ -74,6 +74,14 @@ health_monitor_frontend::get_current_node_health() {
         return be.get_current_node_health();
     });
 }
+
+ss::future<result<node_health_report_serde>>
+health_monitor_frontend::get_current_node_health_since(
+  std::optional<node_health_report_version> acked) {
+    return dispatch_to_backend([acked](health_monitor_backend& be) mutable {
+        return be.get_current_node_health_since(acked);
+    });
+}
 std::optional<alive>
 health_monitor_frontend::is_alive(model::node_id id) const {
     auto status = _node_status_table.local().get_node_status(id);
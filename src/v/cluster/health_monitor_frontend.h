@@ -62,6 +62,10 @@ public:
     // Collects or return cached version of current node health report.
     ss::future<result<node_health_report_ptr>> get_current_node_health();
 
+    // Current node health report with the changes since the acked version.
+    ss::future<result<node_health_report_serde>> get_current_node_health_since(
+      std::optional<node_health_report_version> acked);
+
     /**
      * Return drain status for a given node.
      */
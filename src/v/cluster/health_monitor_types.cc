@@ -90,6 +90,7 @@ node_health_report::node_health_report(
 
 node_health_report node_health_report::copy() const {
     node_health_report ret{id, local_state, {}, drain_status};
+    ret.report_version = report_version;
     ret.topics.reserve(topics.bucket_count());
     for (const auto& [tp_ns, partitions] : topics) {
         ret.topics.emplace(tp_ns, partitions.copy());
@@ -103,6 +104,7 @@ std::ostream& operator<<(std::ostream& o, const node_health_report& r) {
 
 node_health_report_serde::node_health_report_serde(const node_health_report& hr)
   : node_health_report_serde(hr.id, hr.local_state, {}, hr.drain_status) {
+    report_version = hr.report_version;
     topics.reserve(hr.topics.size());
     for (const auto& [tp_ns, partitions] : hr.topics) {
         topics.emplace_back(tp_ns, partitions.copy());
@@ -112,11 +114,20 @@ node_health_report_serde::node_health_report_serde(const node_health_report& hr)
 std::ostream& operator<<(std::ostream& o, const node_health_report_serde& r) {
     fmt::print(
       o,
-      "{{id: {}, topics: {}, local_state: {}, drain_status: {}}}",
+      "{{id: {}, topics: {}, local_state: {}, drain_status: {}, "
+      "report_version: {}, delta_base: {}, removed_partitions: {}}}",
       r.id,
       r.topics,
       r.local_state,
-      r.drain_status);
+      r.drain_status,
+      r.report_version,
+      r.delta_base,
+      r.removed_partitions);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const node_health_report_version& v) {
+    fmt::print(o, "{{epoch: {}, version: {}}}", v.epoch, v.version);
     return o;
 }
 
@@ -124,6 +135,9 @@ bool operator==(
   const node_health_report_serde& a, const node_health_report_serde& b) {
     return a.id == b.id && a.local_state == b.local_state
            && a.drain_status == b.drain_status
+           && a.report_version == b.report_version
+           && a.delta_base == b.delta_base
+           && a.removed_partitions == b.removed_partitions
            && a.topics.size() == b.topics.size()
            && std::equal(
              a.topics.cbegin(),
@@ -148,7 +162,8 @@ std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
     fmt::print(
       o,
       "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}, "
-      "reclaimable_size_bytes: {}, under_replicated: {}, shard: {}}}",
+      "reclaimable_size_bytes: {}, under_replicated: {}, shard: {}, "
+      "leader_throughput: {}}}",
       ps.id,
       ps.term,
       ps.leader_id,
@@ -156,7 +171,8 @@ std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
       ps.size_bytes,
       ps.reclaimable_size_bytes,
       ps.under_replicated_replicas,
-      ps.shard);
+      ps.shard,
+      ps.leader_throughput);
     return o;
 }
 
@@ -260,7 +276,11 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
-    fmt::print(o, "{{target_node_id: {}}}", r.get_target_node_id());
+    fmt::print(
+      o,
+      "{{target_node_id: {}, acked_version: {}}}",
+      r.get_target_node_id(),
+      r.get_acked_version());
     return o;
 }
 
@@ -17,6 +17,7 @@
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "serde/async.h"
+#include "serde/async_containers.h"
 #include "serde/rw/bool_class.h"
 #include "serde/rw/envelope.h"
 #include "serde/rw/optional.h"
@@ -88,7 +89,7 @@ private:
 
 struct partition_status
   : serde::
-      envelope<partition_status, serde::version<3>, serde::compat_version<0>> {
+      envelope<partition_status, serde::version<4>, serde::compat_version<0>> {
     static constexpr size_t invalid_size_bytes = size_t(-1);
     static constexpr uint32_t invalid_shard_id = uint32_t(-1);
 
@@ -116,6 +117,13 @@ struct partition_status
 
     uint32_t shard = invalid_shard_id;
 
+    /*
+     * bytes produced and fetched per second, rounded down to a power of two.
+     * reported by the leader only, used by the leader balancer to spread the
+     * load of busy partitions across shards.
+     */
+    std::optional<uint64_t> leader_throughput;
+
     auto serde_fields() {
         return std::tie(
           id,
@@ -125,7 +133,8 @@ struct partition_status
           size_bytes,
           under_replicated_replicas,
           reclaimable_size_bytes,
-          shard);
+          shard,
+          leader_throughput);
     }
 
     friend std::ostream& operator<<(std::ostream&, const partition_status&);
@@ -155,6 +164,30 @@ struct topic_status
     auto serde_fields() { return std::tie(tp_ns, partitions); }
 };
 
+/**
+ * Identifies the state of partitions a node health report was built from. The
+ * version grows every time a partition status on the reporting node changes,
+ * the epoch changes when the node restarts, versions with different epochs
+ * are unrelated.
+ */
+struct node_health_report_version
+  : serde::envelope<
+      node_health_report_version,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    uint64_t epoch{0};
+    uint64_t version{0};
+
+    auto serde_fields() { return std::tie(epoch, version); }
+
+    friend bool operator==(
+      const node_health_report_version&, const node_health_report_version&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const node_health_report_version&);
+};
+
 /**
  * Node health report is collected built based on node local state at given
  * instance of time
@@ -170,6 +203,8 @@ struct node_health_report {
     node::local_state local_state;
     topics_t topics;
     std::optional<drain_manager::drain_status> drain_status;
+    // set when the report was received from a node able to send deltas
+    std::optional<node_health_report_version> report_version;
 
     node_health_report(
       model::node_id,
@@ -193,15 +228,67 @@ using node_health_report_ptr
 struct node_health_report_serde
   : serde::envelope<
       node_health_report_serde,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::node_id id;
     node::local_state local_state;
     chunked_vector<topic_status> topics;
     std::optional<drain_manager::drain_status> drain_status;
+    // version of the partition statuses in the report
+    std::optional<node_health_report_version> report_version;
+    /**
+     * If set, the report is a delta: `topics` contains only the partitions
+     * which changed since `delta_base` and `removed_partitions` the ones
+     * which are no longer present on the node.
+     */
+    std::optional<node_health_report_version> delta_base;
+    chunked_vector<model::ntp> removed_partitions;
 
     auto serde_fields() {
-        return std::tie(id, local_state, topics, drain_status);
+        return std::tie(
+          id,
+          local_state,
+          topics,
+          drain_status,
+          report_version,
+          delta_base,
+          removed_partitions);
+    }
+
+    // reports of nodes with many partitions are big, they are encoded as by
+    // serde_fields() but yielding between the topics
+    ss::future<> serde_async_write(iobuf& out) {
+        using serde::write;
+        write(out, id);
+        write(out, std::move(local_state));
+        co_await serde::write_vector_async(out, std::move(topics));
+        write(out, drain_status);
+        write(out, report_version);
+        write(out, delta_base);
+        co_await serde::write_vector_async(out, std::move(removed_partitions));
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, const serde::header& h) {
+        using serde::read_nested;
+        id = read_nested<model::node_id>(in, h._bytes_left_limit);
+        local_state = read_nested<node::local_state>(in, h._bytes_left_limit);
+        topics = co_await serde::read_vector_async_nested<
+          chunked_vector<topic_status>>(in, h._bytes_left_limit);
+        drain_status = read_nested<decltype(drain_status)>(
+          in, h._bytes_left_limit);
+        // fields added in version 1
+        if (in.bytes_left() > h._bytes_left_limit) {
+            report_version = read_nested<decltype(report_version)>(
+              in, h._bytes_left_limit);
+            delta_base = read_nested<decltype(delta_base)>(
+              in, h._bytes_left_limit);
+            removed_partitions = co_await serde::read_vector_async_nested<
+              chunked_vector<model::ntp>>(in, h._bytes_left_limit);
+        }
+
+        if (in.bytes_left() > h._bytes_left_limit) {
+            in.skip(in.bytes_left() - h._bytes_left_limit);
+        }
     }
 
     node_health_report_serde() = default;
@@ -217,17 +304,27 @@ struct node_health_report_serde
       , drain_status(drain_status) {}
 
     node_health_report_serde copy() const {
-        return {id, local_state, topics.copy(), drain_status};
+        node_health_report_serde ret{
+          id, local_state, topics.copy(), drain_status};
+        ret.report_version = report_version;
+        ret.delta_base = delta_base;
+        ret.removed_partitions = removed_partitions.copy();
+        return ret;
     }
 
     explicit node_health_report_serde(const node_health_report& hr);
 
+    bool is_delta() const { return delta_base.has_value(); }
+
+    /// \pre the report is not a delta
     node_health_report to_in_memory() && {
-        return node_health_report{
+        node_health_report ret{
           id,
           std::move(local_state),
           std::move(topics),
           std::move(drain_status)};
+        ret.report_version = report_version;
+        return ret;
     }
 
     friend std::ostream&
@@ -451,13 +548,16 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 class get_node_health_request
   : public serde::envelope<
       get_node_health_request,
-      serde::version<1>,
+      serde::version<2>,
       serde::compat_version<0>> {
 public:
     using rpc_adl_exempt = std::true_type;
     get_node_health_request() = default;
-    explicit get_node_health_request(model::node_id target_node_id)
-      : _target_node_id(target_node_id) {}
+    explicit get_node_health_request(
+      model::node_id target_node_id,
+      std::optional<node_health_report_version> acked_version = std::nullopt)
+      : _target_node_id(target_node_id)
+      , _acked_version(acked_version) {}
 
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
@@ -466,11 +566,20 @@ public:
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(_filter, _target_node_id); }
+    auto serde_fields() {
+        return std::tie(_filter, _target_node_id, _acked_version);
+    }
     static constexpr model::node_id node_id_not_set{-1};
 
     model::node_id get_target_node_id() const { return _target_node_id; }
 
+    /// Version of the report the requester already has, the reply may only
+    /// contain the changes since this version.
+    const std::optional<node_health_report_version>&
+    get_acked_version() const {
+        return _acked_version;
+    }
+
 private:
     // default value for backward compatibility
     model::node_id _target_node_id = node_id_not_set;
@@ -479,6 +588,7 @@ private:
      * purpose
      */
     node_report_filter _filter;
+    std::optional<node_health_report_version> _acked_version;
 };
 
 struct get_node_health_reply
@@ -506,6 +616,21 @@ struct get_node_health_reply
     operator<<(std::ostream&, const get_node_health_reply&);
 
     auto serde_fields() { return std::tie(error, report); }
+
+    ss::future<> serde_async_write(iobuf& out) {
+        serde::write(out, error);
+        co_await serde::write_optional_async(out, std::move(report));
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, const serde::header& h) {
+        error = serde::read_nested<errc>(in, h._bytes_left_limit);
+        report = co_await serde::read_optional_async_nested<
+          node_health_report_serde>(in, h._bytes_left_limit);
+
+        if (in.bytes_left() > h._bytes_left_limit) {
+            in.skip(in.bytes_left() - h._bytes_left_limit);
+        }
+    }
 };
 
 struct get_cluster_health_request
@@ -574,6 +699,21 @@ struct get_cluster_health_reply
     get_cluster_health_reply copy() const;
 
     auto serde_fields() { return std::tie(error, report); }
+
+    ss::future<> serde_async_write(iobuf& out) {
+        serde::write(out, error);
+        co_await serde::write_optional_async(out, std::move(report));
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, const serde::header& h) {
+        error = serde::read_nested<errc>(in, h._bytes_left_limit);
+        report = co_await serde::read_optional_async_nested<
+          cluster_health_report>(in, h._bytes_left_limit);
+
+        if (in.bytes_left() > h._bytes_left_limit) {
+            in.skip(in.bytes_left() - h._bytes_left_limit);
+        }
+    }
 };
 
 } // namespace cluster
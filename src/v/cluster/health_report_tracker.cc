@@ -0,0 +1,175 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "cluster/health_report_tracker.h"
+
+#include "base/vassert.h"
+#include "random/generators.h"
+#include "utils/to_string.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <algorithm>
+
+namespace cluster {
+
+namespace {
+// Number of removals remembered even if the node has fewer partitions.
+constexpr size_t min_removed_partitions = 128;
+} // namespace
+
+health_report_tracker::health_report_tracker()
+  : _epoch(random_generators::get_int<uint64_t>()) {}
+
+void health_report_tracker::update(const node_health_report& report) {
+    const auto next = _version + 1;
+    ++_update;
+    bool changed = false;
+    for (const auto& [tp_ns, partitions] : report.topics) {
+        for (const auto& status : partitions) {
+            auto [it, inserted] = _partitions.try_emplace(
+              model::ntp(tp_ns.ns, tp_ns.tp, status.id),
+              tracked_partition{
+                .status = status,
+                .changed_in = next,
+                .seen_in_update = _update,
+              });
+            if (inserted) {
+                changed = true;
+                continue;
+            }
+            it->second.seen_in_update = _update;
+            if (it->second.status != status) {
+                it->second.status = status;
+                it->second.changed_in = next;
+                changed = true;
+            }
+        }
+    }
+
+    absl::erase_if(_partitions, [this, next, &changed](const auto& p) {
+        if (p.second.seen_in_update == _update) {
+            return false;
+        }
+        _removed.emplace_back(next, p.first);
+        changed = true;
+        return true;
+    });
+
+    const auto max_removed = std::max(
+      _partitions.size(), min_removed_partitions);
+    while (_removed.size() > max_removed) {
+        _min_delta_base = std::max(_min_delta_base, _removed.front().first);
+        _removed.pop_front();
+    }
+
+    if (changed) {
+        _version = next;
+    }
+}
+
+bool health_report_tracker::can_build_delta(
+  const node_health_report_version& base) const {
+    return base.epoch == _epoch && base.version >= _min_delta_base
+           && base.version <= _version;
+}
+
+node_health_report_serde health_report_tracker::make_report(
+  const node_health_report& report,
+  const std::optional<node_health_report_version>& acked) {
+    update(report);
+
+    if (!acked || !can_build_delta(*acked)) {
+        node_health_report_serde ret{report};
+        ret.report_version = current_version();
+        return ret;
+    }
+
+    node_health_report_serde ret{
+      report.id, report.local_state, {}, report.drain_status};
+    ret.report_version = current_version();
+    ret.delta_base = acked;
+
+    absl::node_hash_map<model::topic_namespace, partition_statuses_t> changed;
+    for (const auto& [ntp, p] : _partitions) {
+        if (p.changed_in > acked->version) {
+            changed[model::topic_namespace(ntp.ns, ntp.tp.topic)].push_back(
+              p.status);
+        }
+    }
+    ret.topics.reserve(changed.size());
+    for (auto& [tp_ns, partitions] : changed) {
+        ret.topics.emplace_back(tp_ns, std::move(partitions));
+    }
+
+    // removals are ordered by version
+    auto it = std::find_if(
+      _removed.begin(), _removed.end(), [&acked](const auto& r) {
+          return r.first > acked->version;
+      });
+    for (; it != _removed.end(); ++it) {
+        ret.removed_partitions.push_back(it->second);
+    }
+    return ret;
+}
+
+node_health_report apply_node_health_delta(
+  const node_health_report& base, node_health_report_serde delta) {
+    vassert(
+      delta.is_delta() && base.report_version == delta.delta_base,
+      "Delta based on {} can't be applied to the report of version {}",
+      delta.delta_base,
+      base.report_version);
+
+    node_health_report ret{
+      delta.id, std::move(delta.local_state), {}, delta.drain_status};
+    ret.report_version = delta.report_version;
+    ret.topics.reserve(base.topics.bucket_count());
+    for (const auto& [tp_ns, partitions] : base.topics) {
+        ret.topics.emplace(tp_ns, partitions.copy());
+    }
+
+    for (const auto& ntp : delta.removed_partitions) {
+        auto it = ret.topics.find(model::topic_namespace_view(ntp));
+        if (it == ret.topics.end()) {
+            continue;
+        }
+        auto& partitions = it->second;
+        partitions.erase_to_end(std::remove_if(
+          partitions.begin(), partitions.end(), [&ntp](const auto& p) {
+              return p.id == ntp.tp.partition;
+          }));
+        if (partitions.empty()) {
+            ret.topics.erase(it);
+        }
+    }
+
+    for (auto& topic : delta.topics) {
+        auto& partitions = ret.topics[topic.tp_ns];
+        absl::flat_hash_map<model::partition_id, size_t> positions;
+        positions.reserve(partitions.size());
+        for (size_t i = 0; i < partitions.size(); ++i) {
+            positions.emplace(partitions[i].id, i);
+        }
+        for (auto& status : topic.partitions) {
+            auto pos = positions.find(status.id);
+            if (pos != positions.end()) {
+                partitions[pos->second] = status;
+            } else {
+                positions.emplace(status.id, partitions.size());
+                partitions.push_back(status);
+            }
+        }
+    }
+    return ret;
+}
+
+} // namespace cluster
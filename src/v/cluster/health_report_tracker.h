@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/health_monitor_types.h"
+#include "model/fundamental.h"
+
+#include <absl/container/node_hash_map.h>
+
+#include <deque>
+
+namespace cluster {
+
+/**
+ * Tracks the partition statuses of the local node health report, so that the
+ * node can reply to a health report request with the partitions that changed
+ * since the version the requester already has instead of the whole report.
+ *
+ * Partitions which are no longer reported are remembered for a while. Once a
+ * removal is forgotten, requests based on an older version get a full report.
+ */
+class health_report_tracker {
+public:
+    health_report_tracker();
+
+    /**
+     * Records the statuses of \p report and builds a reply with the changes
+     * since \p acked. The reply contains the full report if the delta can't be
+     * computed, e.g. because \p acked comes from before a restart.
+     */
+    node_health_report_serde make_report(
+      const node_health_report& report,
+      const std::optional<node_health_report_version>& acked);
+
+    node_health_report_version current_version() const {
+        return {.epoch = _epoch, .version = _version};
+    }
+
+private:
+    struct tracked_partition {
+        partition_status status;
+        // version in which the status changed last time
+        uint64_t changed_in;
+        uint64_t seen_in_update;
+    };
+
+    void update(const node_health_report& report);
+    bool can_build_delta(const node_health_report_version&) const;
+
+    uint64_t _epoch;
+    uint64_t _version{0};
+    // versions older than this one miss some of the forgotten removals
+    uint64_t _min_delta_base{0};
+    uint64_t _update{0};
+    absl::node_hash_map<model::ntp, tracked_partition> _partitions;
+    std::deque<std::pair<uint64_t, model::ntp>> _removed;
+};
+
+/**
+ * Applies a delta report to the report of the same node it's based on.
+ *
+ * \pre base.report_version == delta.delta_base
+ */
+node_health_report apply_node_health_delta(
+  const node_health_report& base, node_health_report_serde delta);
+
+} // namespace cluster
@@ -220,6 +220,14 @@ metadata_cache::get_leaders() const {
     return _leaders.local().get_leaders();
 }
 
+const topic_change_log& metadata_cache::topic_changes() const {
+    return _topics_state.local().topic_changes();
+}
+
+const topic_change_log& metadata_cache::leadership_changes() const {
+    return _leaders.local().leadership_changes();
+}
+
 void metadata_cache::set_is_node_isolated_status(bool is_node_isolated) {
     _is_node_isolated = is_node_isolated;
 }
@@ -175,6 +175,11 @@ public:
     ss::future<cluster::partition_leaders_table::leaders_info_t>
     get_leaders() const;
 
+    /// Topics with changed metadata in the topic table
+    const topic_change_log& topic_changes() const;
+    /// Topics with changed leadership metadata
+    const topic_change_log& leadership_changes() const;
+
     void set_is_node_isolated_status(bool is_node_isolated);
     bool is_node_isolated();
 
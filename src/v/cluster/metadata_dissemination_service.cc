@@ -45,6 +45,7 @@
 #include <chrono>
 #include <exception>
 #include <optional>
+#include <tuple>
 
 namespace cluster {
 metadata_dissemination_service::metadata_dissemination_service(
@@ -292,11 +293,34 @@ metadata_dissemination_service::dispatch_get_metadata_update(
       });
 }
 
+namespace {
+/// Adds \p update to \p updates unless there is a newer one for the same
+/// partition
+void coalesce_update(
+  chunked_hash_map<model::ntp, ntp_leader_revision>& updates,
+  const ntp_leader_revision& update) {
+    auto [it, inserted] = updates.try_emplace(update.ntp, update);
+    if (
+      !inserted
+      && std::tie(update.revision, update.term)
+           >= std::tie(it->second.revision, it->second.term)) {
+        it->second = update;
+    }
+}
+} // namespace
+
 void metadata_dissemination_service::collect_pending_updates() {
-    auto brokers = _members_table.local().node_ids();
+    // a partition may have changed leadership several times since the last
+    // tick
+    chunked_hash_map<model::ntp, ntp_leader_revision> requests;
     for (auto& ntp_leader : _requests) {
-        auto assignment = _topics.local().get_partition_assignment(
-          ntp_leader.ntp);
+        coalesce_update(requests, ntp_leader);
+    }
+    _requests.clear();
+
+    auto brokers = _members_table.local().node_ids();
+    for (auto& [ntp, ntp_leader] : requests) {
+        auto assignment = _topics.local().get_partition_assignment(ntp);
 
         if (!assignment) {
             // Partition was removed, skip dissemination
@@ -307,20 +331,14 @@ void metadata_dissemination_service::collect_pending_updates() {
             if (id == _self.id()) {
                 continue;
             }
-            if (!_pending_updates.contains(id)) {
-                _pending_updates.emplace(
-                  id,
-                  update_retry_meta{ss::chunked_fifo<ntp_leader_revision>{}});
-            }
             vlog(
               clusterlog.trace,
               "new metadata update {} for {}",
               ntp_leader,
               id);
-            _pending_updates[id].updates.push_back(ntp_leader);
+            coalesce_update(_pending_updates[id].updates, ntp_leader);
         }
     }
-    _requests.clear();
 }
 
 void metadata_dissemination_service::cleanup_finished_updates() {
@@ -397,8 +415,9 @@ ss::future<> metadata_dissemination_service::dispatch_one_update(
     // copy updates to make retries possible
     chunked_vector<ntp_leader_revision> updates;
     updates.reserve(meta.updates.size());
-    std::copy(
-      meta.updates.begin(), meta.updates.end(), std::back_inserter(updates));
+    for (const auto& [_, update] : meta.updates) {
+        updates.push_back(update);
+    }
 
     return _clients.local()
       .with_node_client<metadata_dissemination_rpc_client_protocol>(
@@ -15,6 +15,7 @@
 #include "cluster/health_monitor_types.h"
 #include "cluster/metadata_dissemination_types.h"
 #include "config/tls_config.h"
+#include "container/chunked_hash_map.h"
 #include "features/fwd.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -99,7 +100,11 @@ private:
     // When update was delivered successfully the finished flag is set to true
     // and object is removed from pending updates map
     struct update_retry_meta {
-        ss::chunked_fifo<ntp_leader_revision> updates;
+        // Only the latest update of each partition is kept, the receiver
+        // ignores updates with older terms anyway. During mass leadership
+        // transfers a peer which fails to ack is then sent one update per
+        // partition instead of every change that happened in the meantime.
+        chunked_hash_map<model::ntp, ntp_leader_revision> updates;
         bool finished = false;
     };
     // Used to track the process of requesting update when redpanda starts
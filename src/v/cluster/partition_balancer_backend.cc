@@ -393,7 +393,8 @@ ss::future<> partition_balancer_backend::do_tick() {
         .topic_aware = _topic_aware(),
       },
       _state,
-      _partition_allocator);
+      _partition_allocator,
+      _cur_term->planner_cache);
 
     auto plan_data = co_await planner.plan_actions(
       health_report.value(), _tick_in_progress.value());
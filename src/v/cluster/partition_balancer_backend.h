@@ -13,6 +13,7 @@
 #include "base/seastarx.h"
 #include "cluster/fwd.h"
 #include "cluster/notification.h"
+#include "cluster/partition_balancer_planner.h"
 #include "cluster/partition_balancer_types.h"
 #include "cluster/types.h"
 #include "config/property.h"
@@ -144,6 +145,8 @@ private:
 
         bool _ondemand_rebalance_requested = false;
         bool _force_health_report_refresh = false;
+
+        partition_balancer_planner_cache planner_cache;
     };
     std::optional<per_term_state> _cur_term;
 
@@ -68,13 +68,210 @@ distinct_from(const absl::flat_hash_set<model::node_id>& nodes) {
 
 } // namespace
 
+std::ostream& operator<<(
+  std::ostream& o,
+  const partition_balancer_planner_cache::partition_sizes& ps) {
+    fmt::print(o, "{{current: {{");
+    bool first = true;
+    for (const auto& [id, size] : ps.replicas) {
+        fmt::print(o, "{}{}: {}", first ? "" : ", ", id, size.current);
+        first = false;
+    }
+    fmt::print(o, "}}, non_reclaimable: {}}}", ps.non_reclaimable);
+    return o;
+}
+
+bool partition_balancer_planner_cache::is_unchanged(
+  const node_health_report_ptr& cached,
+  const node_health_report_ptr& current) const {
+    if (cached.get() == current.get()) {
+        return true;
+    }
+    return cached->report_version.has_value()
+           && cached->report_version == current->report_version;
+}
+
+void partition_balancer_planner_cache::add_report(
+  const node_health_report& report) {
+    for (const auto& [tp_ns, partitions] : report.topics) {
+        for (const auto& partition : partitions) {
+            const size_t reclaimable = partition.reclaimable_size_bytes.value_or(
+              0);
+            vlog(
+              clusterlog.trace,
+              "ntp {}/{} on node {}: size {}, reclaimable: {}",
+              tp_ns,
+              partition.id,
+              report.id,
+              human::bytes(partition.size_bytes),
+              human::bytes(reclaimable));
+
+            size_t non_reclaimable = 0;
+            if (reclaimable < partition.size_bytes) {
+                non_reclaimable = partition.size_bytes - reclaimable;
+            } else {
+                // This is a bit weird, assume that the partition can be
+                // reduced to 1 empty segment.
+                non_reclaimable = _segment_fallocation_step;
+            }
+
+            auto& sizes
+              = _ntp2sizes[model::ntp(tp_ns.ns, tp_ns.tp, partition.id)];
+            sizes.replicas[report.id] = replica_size{
+              .current = partition.size_bytes,
+              .non_reclaimable = non_reclaimable};
+            // assume that the "true" non-reclaimable size is the max of all
+            // replicas.
+            sizes.non_reclaimable = std::max(
+              sizes.non_reclaimable, non_reclaimable);
+        }
+    }
+}
+
+void partition_balancer_planner_cache::remove_report(
+  const node_health_report& report) {
+    for (const auto& [tp_ns, partitions] : report.topics) {
+        for (const auto& partition : partitions) {
+            auto it = _ntp2sizes.find(
+              model::ntp(tp_ns.ns, tp_ns.tp, partition.id));
+            if (it == _ntp2sizes.end()) {
+                continue;
+            }
+            auto& sizes = it->second;
+            sizes.replicas.erase(report.id);
+            if (sizes.replicas.empty()) {
+                _ntp2sizes.erase(it);
+                continue;
+            }
+            sizes.non_reclaimable = 0;
+            for (const auto& [_, replica] : sizes.replicas) {
+                sizes.non_reclaimable = std::max(
+                  sizes.non_reclaimable, replica.non_reclaimable);
+            }
+        }
+    }
+}
+
+ss::future<> partition_balancer_planner_cache::update_sizes(
+  const cluster_health_report& health_report,
+  size_t segment_fallocation_step,
+  ss::abort_source& as) {
+    if (!_sizes_valid || segment_fallocation_step != _segment_fallocation_step) {
+        _reports.clear();
+        _ntp2sizes.clear();
+        _segment_fallocation_step = segment_fallocation_step;
+    }
+    _sizes_valid = false;
+
+    absl::flat_hash_set<model::node_id> reported;
+    for (const auto& node_report : health_report.node_reports) {
+        reported.insert(node_report->id);
+        auto it = _reports.find(node_report->id);
+        if (it != _reports.end()) {
+            if (is_unchanged(it->second, node_report)) {
+                continue;
+            }
+            remove_report(*it->second);
+            _reports.erase(it);
+        }
+        add_report(*node_report);
+        _reports.emplace(node_report->id, co_await node_report.copy());
+        co_await ss::coroutine::maybe_yield();
+        as.check();
+    }
+
+    // nodes missing in the health report don't contribute to the sizes
+    for (auto it = _reports.begin(); it != _reports.end();) {
+        if (reported.contains(it->first)) {
+            ++it;
+            continue;
+        }
+        remove_report(*it->second);
+        _reports.erase(it++);
+    }
+    _sizes_valid = true;
+}
+
+void partition_balancer_planner_cache::count_topic(
+  model::topic_namespace_view tp_ns, const topic_metadata& md) {
+    auto& counts = _topic2node_counts[model::topic_namespace(tp_ns)];
+    for (const auto& [_, p_as] : md.get_assignments()) {
+        for (const auto& bs : p_as.replicas) {
+            counts[bs.node_id] += 1;
+        }
+    }
+}
+
+ss::future<> partition_balancer_planner_cache::update_topic_node_counts(
+  const topic_table& topics, ss::abort_source& as) {
+    const auto revision = topics.topic_changes().revision();
+    absl::flat_hash_set<
+      model::topic_namespace,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      changed;
+    const bool tracked = _topics_revision.has_value()
+                         && topics.topic_changes().for_each_change_since(
+                           *_topics_revision,
+                           [&changed](model::topic_namespace_view tp_ns) {
+                               changed.emplace(tp_ns);
+                           });
+    // reset until the update completes
+    _topics_revision.reset();
+
+    if (tracked) {
+        for (const auto& tp_ns : changed) {
+            if (auto it = _topic2node_counts.find(tp_ns);
+                it != _topic2node_counts.end()) {
+                _topic2node_counts.erase(it);
+            }
+            if (auto md = topics.get_topic_metadata_ref(tp_ns); md) {
+                count_topic(tp_ns, md->get());
+            }
+            co_await ss::coroutine::maybe_yield();
+            as.check();
+        }
+        _topics_revision = revision;
+        co_return;
+    }
+
+    _topic2node_counts.clear();
+    for (auto it = topics.topics_iterator_begin();
+         it != topics.topics_iterator_end();
+         ++it) {
+        count_topic(it->first, it->second.metadata);
+        // NOTE: we can't use ssx::async_for_each_counter here, as there
+        // would be no way to call it.check() immediately after maybe_yield
+        // (and before we check the range bounds).
+        co_await ss::coroutine::maybe_yield();
+        as.check();
+        it.check();
+    }
+    _topics_revision = revision;
+}
+
 partition_balancer_planner::partition_balancer_planner(
   planner_config config,
   partition_balancer_state& state,
   partition_allocator& partition_allocator)
   : _config(config)
   , _state(state)
-  , _partition_allocator(partition_allocator) {
+  , _partition_allocator(partition_allocator)
+  , _owned_cache(std::make_unique<partition_balancer_planner_cache>())
+  , _cache(*_owned_cache) {
+    _config.soft_max_disk_usage_ratio = std::min(
+      _config.soft_max_disk_usage_ratio, _config.hard_max_disk_usage_ratio);
+}
+
+partition_balancer_planner::partition_balancer_planner(
+  planner_config config,
+  partition_balancer_state& state,
+  partition_allocator& partition_allocator,
+  partition_balancer_planner_cache& cache)
+  : _config(config)
+  , _state(state)
+  , _partition_allocator(partition_allocator)
+  , _cache(cache) {
     _config.soft_max_disk_usage_ratio = std::min(
       _config.soft_max_disk_usage_ratio, _config.hard_max_disk_usage_ratio);
 }
@@ -172,6 +369,7 @@ private:
 
     request_context(partition_balancer_planner& parent, ss::abort_source& as)
       : _parent(parent)
+      , _ntp2sizes(parent._cache.ntp_sizes())
       , _as(as) {}
 
     bool all_reports_received() const;
@@ -199,41 +397,12 @@ private:
           fmt::format("Topic {} not found in topic2node_counts map", tp_ns));
     }
 
-    struct partition_sizes {
-        absl::flat_hash_map<model::node_id, size_t> current;
-
-        // Max non-reclaimable size of all replicas. This will be used as a size
-        // assigned to new replicas (we assume that in the worst case the target
-        // replica will be able to reduce the partition size up to this size).
-        size_t non_reclaimable = 0;
-
-        size_t get_current(model::node_id id) const {
-            auto it = current.find(id);
-            if (it != current.end()) {
-                return it->second;
-            }
-            return 0;
-        }
-
-        friend std::ostream&
-        operator<<(std::ostream& o, const partition_sizes& ps) {
-            fmt::print(
-              o,
-              "{{current: {}, non_reclaimable: {}}}",
-              ps.current,
-              ps.non_reclaimable);
-            return o;
-        }
-    };
+    using partition_sizes = partition_balancer_planner_cache::partition_sizes;
 
     partition_balancer_planner& _parent;
-    chunked_hash_map<model::ntp, partition_sizes> _ntp2sizes;
-    chunked_hash_map<
-      model::topic_namespace,
-      node2count_t,
-      model::topic_namespace_hash,
-      model::topic_namespace_eq>
-      _topic2node_counts;
+    const partition_balancer_planner_cache::ntp2sizes_t& _ntp2sizes;
+    // copied from the cache, planned moves update the counts
+    partition_balancer_planner_cache::topic2node_counts_t _topic2node_counts;
     absl::node_hash_map<model::ntp, reassignment_info> _reassignments;
     absl::node_hash_map<model::ntp, allocated_partition> _force_reassignments;
     size_t _failed_actions_count = 0;
@@ -396,40 +565,8 @@ void partition_balancer_planner::init_per_node_state(
 
 ss::future<> partition_balancer_planner::init_ntp_sizes_from_health_report(
   const cluster_health_report& health_report, request_context& ctx) {
-    for (const auto& node_report : health_report.node_reports) {
-        for (const auto& [tp_ns, partitions] : node_report->topics) {
-            for (const auto& partition : partitions) {
-                model::ntp ntp{tp_ns.ns, tp_ns.tp, partition.id};
-                size_t reclaimable = partition.reclaimable_size_bytes.value_or(
-                  0);
-                vlog(
-                  clusterlog.trace,
-                  "ntp {} on node {}: size {}, reclaimable: {}",
-                  ntp,
-                  node_report->id,
-                  human::bytes(partition.size_bytes),
-                  human::bytes(reclaimable));
-
-                auto& sizes = ctx._ntp2sizes[ntp];
-                sizes.current[node_report->id] = partition.size_bytes;
-
-                size_t non_reclaimable = 0;
-                if (reclaimable < partition.size_bytes) {
-                    non_reclaimable = partition.size_bytes - reclaimable;
-                } else {
-                    // This is a bit weird, assume that the partition can be
-                    // reduced to 1 empty segment.
-                    non_reclaimable = ctx.config().segment_fallocation_step;
-                }
-
-                // assume that the "true" non-reclaimable size is the max of all
-                // replicas.
-                sizes.non_reclaimable = std::max(
-                  sizes.non_reclaimable, non_reclaimable);
-            }
-            co_await ctx.maybe_yield();
-        }
-    }
+    co_await _cache.update_sizes(
+      health_report, ctx.config().segment_fallocation_step, ctx._as);
 
     // Add moving partitions contribution to batch size and node disk sizes.
     const auto& in_progress_updates = _state.topics().updates_in_progress();
@@ -488,27 +625,6 @@ ss::future<> partition_balancer_planner::init_ntp_sizes_from_health_report(
     }
 }
 
-ss::future<>
-partition_balancer_planner::init_topic_node_counts(request_context& ctx) {
-    const auto& topics = _state.topics();
-    for (auto it = topics.topics_iterator_begin();
-         it != topics.topics_iterator_end();
-         ++it) {
-        auto& counts = ctx._topic2node_counts[it->first];
-        const auto& assignments = it->second.get_assignments();
-        for (const auto& [_, p_as] : assignments) {
-            for (const auto& bs : p_as.replicas) {
-                counts[bs.node_id] += 1;
-            }
-            // NOTE: we can't use ssx::async_for_each_counter here, as there
-            // would be no way to call it.check() immediately after maybe_yield
-            // (and before we check the range bounds).
-            co_await ss::coroutine::maybe_yield();
-            it.check();
-        }
-    }
-}
-
 bool partition_balancer_planner::request_context::all_reports_received() const {
     for (auto id : all_nodes) {
         if (
@@ -2079,7 +2195,8 @@ partition_balancer_planner::plan_actions(
     }
 
     co_await init_ntp_sizes_from_health_report(health_report, ctx);
-    co_await init_topic_node_counts(ctx);
+    co_await _cache.update_topic_node_counts(_state.topics(), as);
+    ctx._topic2node_counts = _cache.topic_node_counts();
 
     co_await get_node_drain_actions(
       ctx, ctx.decommissioning_nodes, change_reason::node_decommissioning);
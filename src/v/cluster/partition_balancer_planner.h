@@ -15,6 +15,7 @@
 #include "cluster/partition_balancer_types.h"
 #include "cluster/scheduling/types.h"
 #include "cluster/types.h"
+#include "container/chunked_hash_map.h"
 #include "model/metadata.h"
 
 #include <absl/container/flat_hash_map.h>
@@ -32,6 +33,83 @@ struct ntp_reassignment {
     ntp_reassignment_type type;
 };
 
+/**
+ * Partition sizes and per topic replica counts the planner derives from the
+ * health report and the topic table. The cache is kept between the planning
+ * ticks (as long as the term doesn't change), so that a tick only processes
+ * the node reports and the topics which changed since the previous one
+ * instead of all the replicas in the cluster.
+ */
+class partition_balancer_planner_cache {
+public:
+    struct replica_size {
+        size_t current = 0;
+        size_t non_reclaimable = 0;
+    };
+
+    struct partition_sizes {
+        absl::flat_hash_map<model::node_id, replica_size> replicas;
+
+        // Max non-reclaimable size of all replicas. This will be used as a size
+        // assigned to new replicas (we assume that in the worst case the target
+        // replica will be able to reduce the partition size up to this size).
+        size_t non_reclaimable = 0;
+
+        size_t get_current(model::node_id id) const {
+            auto it = replicas.find(id);
+            if (it != replicas.end()) {
+                return it->second.current;
+            }
+            return 0;
+        }
+
+        friend std::ostream& operator<<(std::ostream&, const partition_sizes&);
+    };
+
+    using ntp2sizes_t = chunked_hash_map<model::ntp, partition_sizes>;
+    using topic2node_counts_t = chunked_hash_map<
+      model::topic_namespace,
+      node2count_t,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>;
+
+    /**
+     * Updates the partition sizes with the node reports which changed since
+     * the previous update. The reports are compared by their version or, in
+     * absence of it, by identity.
+     */
+    ss::future<> update_sizes(
+      const cluster_health_report&,
+      size_t segment_fallocation_step,
+      ss::abort_source&);
+
+    /// Recounts the replicas of the topics changed since the previous update.
+    ss::future<> update_topic_node_counts(const topic_table&, ss::abort_source&);
+
+    const ntp2sizes_t& ntp_sizes() const { return _ntp2sizes; }
+    const topic2node_counts_t& topic_node_counts() const {
+        return _topic2node_counts;
+    }
+
+private:
+    void add_report(const node_health_report&);
+    void remove_report(const node_health_report&);
+    void count_topic(model::topic_namespace_view, const topic_metadata&);
+
+    bool is_unchanged(
+      const node_health_report_ptr& cached,
+      const node_health_report_ptr& current) const;
+
+    size_t _segment_fallocation_step = 0;
+    // false if an update was interrupted and the sizes have to be rebuilt
+    bool _sizes_valid = false;
+    absl::flat_hash_map<model::node_id, node_health_report_ptr> _reports;
+    ntp2sizes_t _ntp2sizes;
+    // topic table change log revision the counts are up to date with
+    std::optional<uint64_t> _topics_revision;
+    topic2node_counts_t _topic2node_counts;
+};
+
 struct planner_config {
     model::partition_autobalancing_mode mode;
     // If node disk usage goes over this ratio planner will actively move
@@ -69,6 +147,13 @@ public:
       partition_balancer_state& state,
       partition_allocator& partition_allocator);
 
+    /// Planner reusing the state cached by the previous ticks
+    partition_balancer_planner(
+      planner_config config,
+      partition_balancer_state& state,
+      partition_allocator& partition_allocator,
+      partition_balancer_planner_cache& cache);
+
     enum class status {
         empty,
         actions_planned,
@@ -113,7 +198,6 @@ private:
 
     ss::future<> init_ntp_sizes_from_health_report(
       const cluster_health_report& health_report, request_context&);
-    ss::future<> init_topic_node_counts(request_context&);
 
     /// Returns a pair of (total, free) bytes on a given node.
     std::pair<uint64_t, uint64_t> get_node_bytes_info(const node::local_state&);
@@ -134,6 +218,9 @@ private:
     planner_config _config;
     partition_balancer_state& _state;
     partition_allocator& _partition_allocator;
+    // used when the planner isn't given a cache from the previous ticks
+    std::unique_ptr<partition_balancer_planner_cache> _owned_cache;
+    partition_balancer_planner_cache& _cache;
 
     friend std::ostream& operator<<(std::ostream&, change_reason);
 };
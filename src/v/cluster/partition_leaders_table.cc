@@ -154,6 +154,7 @@ void partition_leaders_table::do_update_partition_leader(
         .current_leader = leader_id,
         .update_term = term,
         .partition_revision = revision_id});
+    const auto previous_meta = p_it->second;
 
     if (!new_entry) [[likely]] {
         /**
@@ -240,6 +241,10 @@ void partition_leaders_table::do_update_partition_leader(
          */
         ++_version;
     }
+    // periodic updates from the health reports mostly repeat what we know
+    if (new_entry || p_it->second != previous_meta) {
+        _leadership_changes.record(t_it->first);
+    }
 
     vlog(
       clusterlog.trace,
@@ -355,6 +360,7 @@ void partition_leaders_table::remove_leader(
             _leaderless_partition_count--;
         }
 
+        _leadership_changes.record(t_it->first);
         t_it->second.erase(p_it);
         if (t_it->second.empty()) {
             _topic_leaders.erase(t_it);
@@ -370,6 +376,7 @@ void partition_leaders_table::reset() {
     _leaderless_partition_count = 0;
     ++_version;
     ++_topic_map_version;
+    _leadership_changes.record_all();
 }
 
 ss::future<partition_leaders_table::leaders_info_t>
@@ -14,6 +14,7 @@
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
 #include "cluster/ntp_callbacks.h"
+#include "cluster/topic_change_log.h"
 #include "cluster/types.h"
 #include "container/chunked_hash_map.h"
 #include "container/contiguous_range_map.h"
@@ -161,6 +162,15 @@ public:
         return _leaderless_partition_count;
     }
 
+    /**
+     * Topics with modified leadership metadata. Unlike leadership change
+     * notifications this also covers leaders being lost, partitions being
+     * removed and updates of the previous leader.
+     */
+    const topic_change_log& leadership_changes() const {
+        return _leadership_changes;
+    }
+
     using leader_change_cb_t = ss::noncopyable_function<void(
       model::ntp, model::term_id, model::node_id)>;
 
@@ -194,6 +204,9 @@ private:
         model::term_id last_stable_leader_term;
         model::term_id update_term;
         model::revision_id partition_revision;
+
+        friend bool operator==(const leader_meta&, const leader_meta&)
+          = default;
     };
 
     using partition_leaders
@@ -234,6 +247,7 @@ private:
      */
     version _version{0};
     version _topic_map_version{0};
+    topic_change_log _leadership_changes;
     ss::gate _gate;
     ss::abort_source _as;
 };
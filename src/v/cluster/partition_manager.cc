@@ -251,8 +251,17 @@ ss::future<consensus_ptr> partition_manager::manage(
     }
     auto translator_batch_types = raft::offset_translator_batch_types(
       ntp_cfg.ntp());
+    // partitions this node was leading before a restart are recovered ahead
+    // of the others so that they can serve traffic sooner
+    auto prioritized = storage::prioritized_recovery(
+      config::node().node_id().has_value()
+      && raft::consensus::persisted_vote_for(
+        _storage.kvs(), group, *config::node().node_id()));
     auto log = co_await _storage.log_mgr().manage(
-      std::move(ntp_cfg), group, std::move(translator_batch_types));
+      std::move(ntp_cfg),
+      group,
+      std::move(translator_batch_types),
+      prioritized);
     vlog(
       clusterlog.debug,
       "Log created manage completed, ntp: {}, rev: {}, {} "
@@ -19,6 +19,8 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <bit>
+
 namespace cluster {
 
 static const ss::sstring cluster_metrics_name
@@ -26,6 +28,23 @@ static const ss::sstring cluster_metrics_name
 
 static constexpr int64_t follower_iceberg_lag_metric = 0;
 
+uint64_t partition_probe::sample_throughput(ss::lowres_clock::time_point now) {
+    const auto bytes = _impl->bytes_transferred();
+    const auto prev_bytes = std::exchange(_sampled_bytes, bytes);
+    const auto prev_at = std::exchange(_sampled_at, now);
+    if (!prev_at || now <= *prev_at || bytes < prev_bytes) {
+        return 0;
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      now - *prev_at);
+    if (elapsed.count() <= 0) {
+        return 0;
+    }
+    const uint64_t rate = (bytes - prev_bytes) * 1000
+                          / static_cast<uint64_t>(elapsed.count());
+    return std::bit_floor(rate);
+}
+
 replicated_partition_probe::replicated_partition_probe(
   const partition& p) noexcept
   : _partition(p) {
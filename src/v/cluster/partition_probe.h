@@ -13,10 +13,12 @@
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/shared_ptr.hh>
 
 #include <cstdint>
+#include <optional>
 
 namespace cluster {
 
@@ -35,6 +37,8 @@ public:
         virtual void update_iceberg_commit_offset_lag(int64_t) = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual void clear_metrics() = 0;
+        /// bytes produced to and fetched from the partition so far
+        virtual uint64_t bytes_transferred() const = 0;
         virtual ~impl() noexcept = default;
     };
 
@@ -78,8 +82,19 @@ public:
 
     void clear_metrics() { _impl->clear_metrics(); }
 
+    uint64_t bytes_transferred() const { return _impl->bytes_transferred(); }
+
+    /**
+     * Bytes produced and fetched per second since the previous sample,
+     * rounded down to a power of two so that the value changes only when the
+     * throughput roughly doubles or halves. The first sample returns 0.
+     */
+    uint64_t sample_throughput(ss::lowres_clock::time_point now);
+
 private:
     std::unique_ptr<impl> _impl;
+    uint64_t _sampled_bytes{0};
+    std::optional<ss::lowres_clock::time_point> _sampled_at;
 };
 class replicated_partition_probe : public partition_probe::impl {
 public:
@@ -108,6 +123,10 @@ public:
 
     void clear_metrics() final;
 
+    uint64_t bytes_transferred() const final {
+        return _bytes_produced + _bytes_fetched;
+    }
+
 private:
     int64_t iceberg_translation_offset_lag() const;
     int64_t iceberg_commit_offset_lag() const;
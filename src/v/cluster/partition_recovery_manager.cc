@@ -19,6 +19,7 @@
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/topic_recovery_status_frontend.h"
+#include "config/configuration.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -42,6 +43,7 @@
 
 #include <absl/container/btree_map.h>
 #include <boost/algorithm/string/detail/sequence.hpp>
+#include <boost/range/irange.hpp>
 
 #include <chrono>
 #include <exception>
@@ -454,7 +456,6 @@ partition_downloader::download_log_with_capped_size(
         }
     }
 
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart{
@@ -477,26 +478,7 @@ partition_downloader::download_log_with_capped_size(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base-offset: {}, term: {}, size: {}, fs "
-          "prefix: {}, "
-          "destination: {}",
-          s.base_offset,
-          s.segment_term,
-          s.size_bytes,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back(offset_range{
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
-            });
-        }
-    }
-
+    auto dloffsets = co_await download_segment_files(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     co_return dlpart;
 }
@@ -558,7 +540,6 @@ partition_downloader::download_log_with_capped_time(
       "start_delta: {}",
       start_offset,
       start_delta);
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart = {
@@ -581,25 +562,58 @@ partition_downloader::download_log_with_capped_time(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base_offset: {}, term: {}, fs prefix: {}, "
-          "dest: {}",
-          s.base_offset,
-          s.segment_term,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back({
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
+    auto dloffsets = co_await download_segment_files(staged_downloads, dlpart);
+    update_downloaded_offsets(std::move(dloffsets), dlpart);
+    co_return dlpart;
+}
+
+ss::future<std::vector<partition_downloader::offset_range>>
+partition_downloader::download_segment_files(
+  const std::deque<segment_meta>& staged_downloads,
+  const download_part& part) {
+    // Each segment is retrieved with a single GET, so recovery of a partition
+    // with many small segments is dominated by the request latency unless
+    // several downloads are in flight. The bandwidth is capped by the
+    // throughput limit of the remote.
+    const auto concurrency
+      = config::shard_local_cfg()
+          .cloud_storage_recovery_segment_download_concurrency();
+    std::vector<std::optional<stream_stats>> results(staged_downloads.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, staged_downloads.size()),
+      concurrency,
+      [this, &staged_downloads, &part, &results](size_t i) {
+          const auto& s = staged_downloads[i];
+          vlog(
+            _ctxlog.debug,
+            "Starting download, base_offset: {}, term: {}, size: {}, fs "
+            "prefix: {}, dest: {}",
+            s.base_offset,
+            s.segment_term,
+            s.size_bytes,
+            part.part_prefix,
+            part.dest_prefix);
+          return download_segment_file(s, part).then(
+            [&results, i](std::optional<stream_stats> r) {
+                results[i] = std::move(r);
             });
+      });
+
+    // The offset translator state has to be built in offset order
+    std::vector<offset_range> dloffsets;
+    for (auto& r : results) {
+        if (!r.has_value()) {
+            continue;
+        }
+        for (const auto& gap : r->gaps) {
+            part.ot_state->add_gap(gap.base_offset, gap.last_offset);
         }
+        dloffsets.push_back(offset_range{
+          .min_offset = r->min_offset,
+          .max_offset = r->max_offset,
+        });
     }
-    update_downloaded_offsets(std::move(dloffsets), dlpart);
-    co_return dlpart;
+    co_return dloffsets;
 }
 
 ss::future<partition_downloader::recovery_material>
@@ -693,7 +707,9 @@ partition_downloader::download_segment_file(
       part.part_prefix.string(),
       localpath);
 
-    offset_translator otl{segm.delta_offset, part.ot_state, _as};
+    // Segments are downloaded concurrently, their gaps are added to the
+    // offset translator state by the caller
+    offset_translator otl{segm.delta_offset, nullptr, _as};
 
     if (co_await ss::file_exists(localpath.string())) {
         vlog(
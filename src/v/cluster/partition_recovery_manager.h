@@ -25,6 +25,7 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <deque>
 #include <vector>
 
 namespace cluster {
@@ -108,8 +109,6 @@ private:
 /// Topic downloader is used to download topic segments from S3 (or compatible
 /// storage) during topic re-creation
 class partition_downloader {
-    static constexpr size_t max_concurrency = 1;
-
 public:
     partition_downloader(
       const storage::ntp_config& ntpc,
@@ -189,6 +188,15 @@ private:
     ss::future<std::optional<cloud_storage::stream_stats>>
     download_segment_file(const segment_meta& segm, const download_part& part);
 
+    /// Download the staged segments, several at a time
+    ///
+    /// The gaps of the downloaded segments are added to the offset translator
+    /// state of the part in offset order once all downloads are done.
+    /// \return offset ranges of the successfully downloaded segments
+    ss::future<std::vector<offset_range>> download_segment_files(
+      const std::deque<segment_meta>& staged_downloads,
+      const download_part& part);
+
     /// Helper for download_segment_file
     ss::future<uint64_t> download_segment_file_stream(
       uint64_t,
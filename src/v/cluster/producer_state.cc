@@ -536,6 +536,37 @@ producer_state::snapshot(kafka::offset log_start_offset) const {
     return snapshot;
 }
 
+std::optional<spilled_producer_state> producer_state::spill() const {
+    if (_transaction_state) {
+        return std::nullopt;
+    }
+    auto snapshot = this->snapshot(kafka::offset::min());
+    if (snapshot.finished_requests.empty()) {
+        return std::nullopt;
+    }
+    const auto& last = snapshot.finished_requests.back();
+    return spilled_producer_state{
+      .epoch = _id.get_epoch(),
+      .first_sequence = last.first_sequence,
+      .last_sequence = last.last_sequence,
+      .last_offset = last.last_offset,
+      .last_update = _last_updated_ts,
+    };
+}
+
+producer_state_snapshot spilled_producer_state::to_snapshot(
+  model::producer_id id, raft::group_id group) const {
+    producer_state_snapshot snapshot;
+    snapshot.id = model::producer_identity(id(), epoch());
+    snapshot.group = group;
+    snapshot.finished_requests.emplace_back(
+      first_sequence, last_sequence, last_offset);
+    snapshot.ms_since_last_update
+      = std::chrono::duration_cast<std::chrono::milliseconds>(
+        ss::lowres_system_clock::now() - last_update);
+    return snapshot;
+}
+
 std::optional<model::tx_seq> producer_state::get_transaction_sequence() const {
     if (has_transaction_in_progress()) {
         return _transaction_state->sequence;
@@ -148,6 +148,20 @@ private:
     friend producer_state;
 };
 
+/// Compact state of an idempotent producer evicted from memory because of the
+/// producer limits. It is enough to keep checking the sequence numbers of the
+/// producer if it produces again, see producer_state::spill().
+struct spilled_producer_state {
+    model::producer_epoch epoch;
+    seq_t first_sequence;
+    seq_t last_sequence;
+    kafka::offset last_offset;
+    ss::lowres_system_clock::time_point last_update;
+
+    producer_state_snapshot
+    to_snapshot(model::producer_id, raft::group_id) const;
+};
+
 /// Encapsulates all the state of a producer producing batches to
 /// a single raft group. The state mainly comprises of the following
 /// - Idempotency state: last 5 requests using this producer
@@ -226,6 +240,10 @@ public:
 
     producer_state_snapshot snapshot(kafka::offset log_start_offset) const;
 
+    // Returns the compact state of an idempotent producer with a completed
+    // request, a disengaged optional for transactional producers.
+    std::optional<spilled_producer_state> spill() const;
+
     ss::lowres_system_clock::time_point get_last_update_timestamp() const {
         return _last_updated_ts;
     }
@@ -11,6 +11,7 @@
 
 #include "producer_state_manager.h"
 
+#include "base/vassert.h"
 #include "cluster/logger.h"
 #include "cluster/producer_state.h"
 #include "cluster/types.h"
@@ -26,11 +27,13 @@ namespace cluster::tx {
 producer_state_manager::producer_state_manager(
   config::binding<uint64_t> max_producer_ids,
   config::binding<std::chrono::milliseconds> producer_expiration_ms,
-  config::binding<size_t> virtual_cluster_min_producer_ids)
+  config::binding<size_t> virtual_cluster_min_producer_ids,
+  config::binding<uint64_t> max_spilled_producer_ids)
   : _producer_expiration_ms(std::move(producer_expiration_ms))
   , _max_ids(std::move(max_producer_ids))
   , _virtual_cluster_min_producer_ids(
       std::move(virtual_cluster_min_producer_ids))
+  , _max_spilled_ids(std::move(max_spilled_producer_ids))
   , _cache(
       _max_ids,
       _virtual_cluster_min_producer_ids,
@@ -66,7 +69,12 @@ void producer_state_manager::setup_metrics() {
        sm::make_counter(
          "evicted_producers",
          [this] { return _eviction_counter; },
-         sm::description("Number of evicted producers so far."))});
+         sm::description("Number of evicted producers so far.")),
+       sm::make_gauge(
+         "spilled_producers",
+         [this] { return _spilled_producers; },
+         sm::description("Number of evicted idempotent producers for which "
+                         "the last sequence is kept."))});
 }
 
 void producer_state_manager::rearm_eviction_timer_for_testing(
@@ -99,6 +107,24 @@ void producer_state_manager::touch(
     vlog(clusterlog.trace, "Touched producer: {}", state);
     _cache.touch(vcluster.value_or(no_vcluster), state);
 }
+
+bool producer_state_manager::try_spill_producer() {
+    if (_spilled_producers >= _max_spilled_ids()) {
+        return false;
+    }
+    ++_spilled_producers;
+    return true;
+}
+
+void producer_state_manager::release_spilled_producers(size_t n) {
+    vassert(
+      n <= _spilled_producers,
+      "Releasing {} spilled producers out of {}",
+      n,
+      _spilled_producers);
+    _spilled_producers -= n;
+}
+
 void producer_state_manager::evict_excess_producers() {
     _cache.evict_older_than<ss::lowres_system_clock>(
       ss::lowres_system_clock::now() - _producer_expiration_ms());
@@ -26,7 +26,8 @@ public:
 
       config::binding<uint64_t> max_producer_ids,
       config::binding<std::chrono::milliseconds> producer_expiration_ms,
-      config::binding<size_t> virtual_cluster_min_producer_ids);
+      config::binding<size_t> virtual_cluster_min_producer_ids,
+      config::binding<uint64_t> max_spilled_producer_ids);
 
     ss::future<> start();
     ss::future<> stop();
@@ -45,6 +46,23 @@ public:
      */
     void touch(producer_state&, std::optional<model::vcluster_id>);
 
+    /**
+     * Accounts for the compact state of a producer evicted because of the
+     * producer limits. Returns false if the shard already keeps as many
+     * spilled producers as allowed, the producer state is then dropped.
+     */
+    bool try_spill_producer();
+    /**
+     * Releases the accounting of spilled producers revived or dropped by a
+     * partition.
+     */
+    void release_spilled_producers(size_t);
+
+    /// Producers inactive for longer than this are forgotten
+    std::chrono::milliseconds producer_expiration() const {
+        return _producer_expiration_ms();
+    }
+
     void rearm_eviction_timer_for_testing(std::chrono::milliseconds);
 
 private:
@@ -83,6 +101,10 @@ private:
     // LRU basis.
     config::binding<uint64_t> _max_ids;
     config::binding<size_t> _virtual_cluster_min_producer_ids;
+    // maximum number of evicted idempotent producers on this shard for which
+    // the partitions keep the last sequence
+    config::binding<uint64_t> _max_spilled_ids;
+    size_t _spilled_producers{0};
     // cache of all producers on this shard
     cache_t _cache;
     ss::timer<ss::lowres_clock> _reaper;
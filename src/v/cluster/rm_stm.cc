@@ -153,14 +153,58 @@ rm_stm::maybe_create_producer(model::producer_identity pid) {
     if (it != _producers.end()) {
         return std::make_pair(it->second, producer_previously_known::yes);
     }
-    auto producer = ss::make_lw_shared<producer_state>(
-      _ctx_log, pid, _raft->group(), [pid, this] {
-          cleanup_producer_state(pid);
-      });
+    auto known = producer_previously_known::no;
+    producer_ptr producer;
+    if (auto s_it = _spilled_producers.find(pid.get_id());
+        s_it != _spilled_producers.end()) {
+        auto spilled = s_it->second;
+        _spilled_producers.erase(s_it);
+        _producer_state_manager.local().release_spilled_producers(1);
+        // a bumped epoch resets the sequences anyway
+        if (spilled.epoch == pid.get_epoch() && !is_expired(spilled)) {
+            vlog(_ctx_log.trace, "reviving spilled producer: {}", pid);
+            producer = ss::make_lw_shared<producer_state>(
+              _ctx_log,
+              [pid, this] { cleanup_producer_state(pid); },
+              spilled.to_snapshot(pid.get_id(), _raft->group()));
+            producer->touch();
+            known = producer_previously_known::yes;
+        }
+    }
+    if (!producer) {
+        producer = ss::make_lw_shared<producer_state>(
+          _ctx_log, pid, _raft->group(), [pid, this] {
+              cleanup_producer_state(pid);
+          });
+    }
     _producer_state_manager.local().register_producer(*producer, _vcluster_id);
     _producers.emplace(pid.get_id(), producer);
 
-    return std::make_pair(producer, producer_previously_known::no);
+    return std::make_pair(producer, known);
+}
+
+void rm_stm::maybe_spill_producer(const producer_state& producer) {
+    auto spilled = producer.spill();
+    if (!spilled || is_expired(*spilled)) {
+        return;
+    }
+    if (!_producer_state_manager.local().try_spill_producer()) {
+        return;
+    }
+    vlog(_ctx_log.trace, "spilled producer: {}", producer.id());
+    _spilled_producers.insert_or_assign(producer.id().get_id(), *spilled);
+}
+
+bool rm_stm::is_expired(const spilled_producer_state& spilled) const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+             ss::lowres_system_clock::now() - spilled.last_update)
+           >= _producer_state_manager.local().producer_expiration();
+}
+
+void rm_stm::clear_spilled_producers() {
+    _producer_state_manager.local().release_spilled_producers(
+      _spilled_producers.size());
+    _spilled_producers.clear();
 }
 
 ss::future<> rm_stm::cleanup_evicted_producers() {
@@ -185,6 +229,7 @@ ss::future<> rm_stm::cleanup_evicted_producers() {
                   producer);
                 continue;
             }
+            maybe_spill_producer(producer);
             _producers.erase(it);
             vlog(_ctx_log.trace, "removed producer: {}", pid);
         } else {
@@ -217,6 +262,7 @@ ss::future<> rm_stm::reset_producers() {
       });
     _active_tx_producers.clear();
     _producers.clear();
+    clear_spilled_producers();
 }
 
 ss::future<checked<model::term_id, tx::errc>> rm_stm::begin_tx(
@@ -1285,6 +1331,50 @@ static void filter_intersecting(
     }
 }
 
+void rm_stm::aborted_tx_state::add_aborted(const tx::tx_range& range) {
+    aborted.push_back(range);
+    aborted_max_last.push_back(
+      aborted_max_last.empty() ? range.last
+                               : std::max(aborted_max_last.back(), range.last));
+}
+
+void rm_stm::aborted_tx_state::set_aborted(
+  fragmented_vector<tx::tx_range> ranges) {
+    aborted = std::move(ranges);
+    reindex_aborted();
+}
+
+void rm_stm::aborted_tx_state::reindex_aborted() {
+    aborted_max_last.clear();
+    aborted_max_last.reserve(aborted.size());
+    auto max_last = model::offset::min();
+    for (const auto& range : aborted) {
+        max_last = std::max(max_last, range.last);
+        aborted_max_last.push_back(max_last);
+    }
+}
+
+/// Ranges are kept in the order their abort markers were applied. All the
+/// ranges before the first one whose running maximum reaches `from` end
+/// before it, so only the remaining suffix is scanned. Fetches close to the
+/// end of the log only look at the most recent aborts.
+static void filter_intersecting(
+  fragmented_vector<tx_range>& target,
+  const fragmented_vector<tx_range>& source,
+  const fragmented_vector<model::offset>& source_max_last,
+  model::offset from,
+  model::offset to) {
+    const auto first_idx = static_cast<size_t>(
+      source_max_last.lower_bound(from) - source_max_last.begin());
+    for (auto i = first_idx; i < source.size(); ++i) {
+        const auto& range = source[i];
+        if (range.last < from || range.first > to) {
+            continue;
+        }
+        target.push_back(range);
+    }
+}
+
 ss::future<fragmented_vector<tx_range>>
 rm_stm::aborted_transactions(model::offset from, model::offset to) {
     return _state_lock.hold_read_lock().then(
@@ -1320,7 +1410,12 @@ rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
         }
     }
 
-    filter_intersecting(result, _aborted_tx_state.aborted, from, to);
+    filter_intersecting(
+      result,
+      _aborted_tx_state.aborted,
+      _aborted_tx_state.aborted_max_last,
+      from,
+      to);
 
     for (const auto& idx : intersecting_idxes) {
         auto opt = co_await load_abort_snapshot(idx);
@@ -1668,7 +1763,7 @@ void rm_stm::apply_control(
           _ctx_log.trace,
           "Adding aborted transaction range: {}",
           tx_range.value());
-        _aborted_tx_state.aborted.push_back(tx_range.value());
+        _aborted_tx_state.add_aborted(tx_range.value());
         if (
           _aborted_tx_state.aborted.size() > _abort_index_segment_size
           && !_is_abort_idx_reduction_requested) {
@@ -1765,7 +1860,7 @@ rm_stm::apply_local_snapshot(raft::stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
 
     _highest_producer_id = std::max(
       data.highest_producer_id, _highest_producer_id);
-    _aborted_tx_state.aborted = std::move(data.aborted);
+    _aborted_tx_state.set_aborted(std::move(data.aborted));
     co_await ss::max_concurrent_for_each(
       data.abort_indexes, 32, [this](const abort_index& idx) -> ss::future<> {
           auto f_name = abort_idx_name(idx.first, idx.last);
@@ -1904,7 +1999,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(
           return range.last >= start_offset;
       });
 
-    _aborted_tx_state.aborted = std::move(preserved_aborted_ranges);
+    _aborted_tx_state.set_aborted(std::move(preserved_aborted_ranges));
     // check if any of the aborted ranges have to be offloaded to the snapshots.
     chunked_vector<abort_snapshot> aborted_snapshots;
     // store ranges that are going to be included in aborted transaction
@@ -1920,6 +2015,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(
           [](const tx_range& a, const tx_range& b) {
               return a.first < b.first;
           });
+        _aborted_tx_state.reindex_aborted();
 
         model::offset first = model::offset::max();
         model::offset last = model::offset::min();
@@ -1962,6 +2058,22 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(
             stm_snapshot.producers.push_back(std::move(snapshot));
         }
     }
+    size_t expired_spilled_producers = 0;
+    for (auto it = _spilled_producers.begin();
+         it != _spilled_producers.end();) {
+        if (is_expired(it->second)) {
+            it = _spilled_producers.erase(it);
+            ++expired_spilled_producers;
+            continue;
+        }
+        if (it->second.last_offset >= start_kafka_offset) {
+            stm_snapshot.producers.push_back(
+              it->second.to_snapshot(it->first, _raft->group()));
+        }
+        ++it;
+    }
+    _producer_state_manager.local().release_spilled_producers(
+      expired_spilled_producers);
 
     apply_units.return_all();
 
@@ -1986,7 +2098,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(
       _ctx_log.debug,
       "Preserved {} aborted transaction ranges",
       cleaned_aborted_ranges.size());
-    _aborted_tx_state.aborted = std::move(cleaned_aborted_ranges);
+    _aborted_tx_state.set_aborted(std::move(cleaned_aborted_ranges));
 
     if (!expired_abort_indexes.empty()) {
         vlog(
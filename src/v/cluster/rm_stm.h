@@ -243,6 +243,9 @@ private:
     std::pair<tx::producer_ptr, producer_previously_known>
       maybe_create_producer(model::producer_identity);
     void cleanup_producer_state(model::producer_identity) noexcept;
+    void maybe_spill_producer(const tx::producer_state&);
+    bool is_expired(const tx::spilled_producer_state&) const;
+    void clear_spilled_producers();
     ss::future<> cleanup_evicted_producers();
     ss::future<> reset_producers();
     ss::future<checked<model::term_id, tx::errc>> do_begin_tx(
@@ -350,8 +353,17 @@ private:
     // Populated from state machine up calls.
     struct aborted_tx_state {
         fragmented_vector<tx::tx_range> aborted;
+        // Running maximum of the last offsets of `aborted`, in the same
+        // order. It is non decreasing, so lookups can binary search past the
+        // ranges which end before the requested offset.
+        fragmented_vector<model::offset> aborted_max_last;
         fragmented_vector<tx::abort_index> abort_indexes;
         tx::abort_snapshot last_abort_snapshot{.last = model::offset(-1)};
+
+        void add_aborted(const tx::tx_range&);
+        void set_aborted(fragmented_vector<tx::tx_range>);
+        // Rebuilds aborted_max_last after `aborted` was reordered
+        void reindex_aborted();
     };
 
     kafka::offset from_log_offset(model::offset old_offset) const;
@@ -415,6 +427,13 @@ private:
     // producers because epoch is unused.
     producers_t _producers;
 
+    // Idempotent producers evicted from memory because of the producer limits.
+    // Only their last request is kept, they are revived from it if they
+    // produce again and they are persisted in the snapshots with the other
+    // producers.
+    chunked_hash_map<model::producer_id, tx::spilled_producer_state>
+      _spilled_producers;
+
     ss::queue<model::producer_identity> _producers_pending_cleanup;
 
     // All the producers with open transactions in this partition.
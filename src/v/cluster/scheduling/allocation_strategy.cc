@@ -30,156 +30,136 @@ namespace cluster {
 
 namespace {
 
-std::vector<model::node_id> solve_hard_constraints(
-  const allocation_state::underlying_t& nodes,
+std::vector<model::node_id>
+candidate_ids(const std::vector<const allocation_node*>& candidates) {
+    std::vector<model::node_id> ids;
+    ids.reserve(candidates.size());
+    for (const auto* node : candidates) {
+        ids.push_back(node->id());
+    }
+    return ids;
+}
+
+} // namespace
+
+void allocation_strategy::solve_hard_constraints(
+  const allocation_state& state,
   const std::vector<hard_constraint_ptr>& constraints,
   const allocated_partition& partition,
   std::optional<model::node_id> prev) {
     vlog(clusterlog.trace, "applying hard constraints: {}", constraints);
 
-    std::vector<hard_constraint_evaluator> evaluators;
-    evaluators.reserve(constraints.size());
-    for (auto& c : constraints) {
-        evaluators.push_back(c->make_evaluator(partition, prev));
-    }
-
-    // empty hard constraints, all nodes are eligible
-    std::vector<model::node_id> possible_nodes;
-    if (unlikely(constraints.empty())) {
-        possible_nodes.reserve(nodes.size());
-        std::transform(
-          nodes.begin(),
-          nodes.end(),
-          std::back_inserter(possible_nodes),
-          [](const allocation_state::underlying_t::value_type& v) {
-              return v.first;
-          });
-        return possible_nodes;
+    const auto& nodes = state.allocation_nodes();
+    _candidates.clear();
+    _candidates.reserve(nodes.size());
+    for (const auto& [id, node] : nodes) {
+        _candidates.push_back(node.get());
     }
 
-    for (auto& p : nodes) {
-        auto& node = p.second;
-        bool result = true;
-        for (size_t i = 0; i < constraints.size(); ++i) {
-            auto res = evaluators[i](*node);
+    // Evaluate one constraint over all the remaining candidates before moving
+    // to the next one, dropping the candidates that don't satisfy it. The order
+    // of the candidates is preserved.
+    for (const auto& c : constraints) {
+        if (_candidates.empty()) {
+            break;
+        }
+        auto evaluator = c->make_evaluator(partition, prev);
+        std::erase_if(_candidates, [&](const allocation_node* node) {
+            auto res = evaluator(*node);
             if (clusterlog.is_enabled(ss::log_level::trace)) {
                 vlog(
                   clusterlog.trace,
                   "{}(node: {}) = {}",
-                  constraints[i]->name(),
+                  c->name(),
                   node->id(),
                   res);
             }
-            if (!res) {
-                result = false;
-                break;
-            }
-        }
-
-        if (result) {
-            possible_nodes.push_back(p.first);
-        }
+            return !res;
+        });
     }
-    return possible_nodes;
 }
+
 /**
  * Optimize a single level of constraints, i.e. it finds a best fit set of nodes
  * for a given level of constraints
  */
-std::vector<model::node_id> optimize_constraints(
-  const allocation_state::underlying_t& allocation_nodes,
-  std::vector<model::node_id> possible_nodes,
+void allocation_strategy::optimize_constraints(
   const soft_constraints_level& constraints,
   const allocated_partition& partition,
   std::optional<model::node_id> prev) {
     vlog(
       clusterlog.trace, "optimizing soft constraints level: {}", constraints);
 
-    if (possible_nodes.size() <= 1) {
+    if (_candidates.size() <= 1 || constraints.empty()) {
         // nothing to optimize, choose the only node available after solving
         // hard constraints.
-        return possible_nodes;
+        return;
     }
 
-    std::vector<soft_constraint_evaluator> evaluators;
-    evaluators.reserve(constraints.size());
-    for (auto& c : constraints) {
-        evaluators.push_back(c->make_evaluator(partition, prev));
-    }
-
-    uint32_t best_score = 0;
-    std::vector<model::node_id> best_fits;
-
-    for (const auto& id : possible_nodes) {
-        auto it = allocation_nodes.find(id);
-        if (it == allocation_nodes.end()) {
-            continue;
-        }
-        const auto& node = *it->second;
-
-        uint32_t score = 0;
-        for (size_t i = 0; i < constraints.size(); ++i) {
-            const auto current_score = evaluators[i](node);
+    _scores.assign(_candidates.size(), 0);
+    for (const auto& c : constraints) {
+        auto evaluator = c->make_evaluator(partition, prev);
+        for (size_t i = 0; i < _candidates.size(); ++i) {
+            const auto current_score = evaluator(*_candidates[i]);
             if (clusterlog.is_enabled(ss::log_level::trace)) {
                 vlog(
                   clusterlog.trace,
                   "{}(node: {}) = {} ({})",
-                  constraints[i]->name(),
-                  node.id(),
+                  c->name(),
+                  _candidates[i]->id(),
                   current_score,
                   (double)current_score / soft_constraint::max_score);
             }
-            score += current_score;
+            _scores[i] += current_score;
         }
+    }
 
-        /**
-         * Score is normalized so that it is always in range [0, max_score_size]
-         */
+    /**
+     * Score is normalized so that it is always in range [0, max_score_size]
+     */
+    uint32_t best_score = 0;
+    for (auto& score : _scores) {
         score /= constraints.size();
+        best_score = std::max(best_score, score);
+    }
 
+    // Keep only the nodes with the highest score, we break ties randomly, by
+    // selecting a random node out of them.
+    size_t best_fits = 0;
+    for (size_t i = 0; i < _candidates.size(); ++i) {
         vlog(
           clusterlog.trace,
           "node: {}, total normalized score: {} ({})",
-          id,
-          score,
-          (double)score / soft_constraint::max_score);
-        if (score >= best_score) {
-            if (score > best_score) {
-                // untied, winner clear out existing winners
-                best_score = score;
-                best_fits.clear();
-            }
-            best_fits.push_back(it->first);
+          _candidates[i]->id(),
+          _scores[i],
+          (double)_scores[i] / soft_constraint::max_score);
+        if (_scores[i] == best_score) {
+            _candidates[best_fits++] = _candidates[i];
         }
     }
+    _candidates.resize(best_fits);
 
-    vassert(!best_fits.empty(), "best_fits empty");
-
-    // we break ties randomly, by selecting a random node out of those
-    // with the highest score
-    return best_fits;
+    vassert(!_candidates.empty(), "best_fits empty");
 }
 
-} // namespace
-
 result<model::node_id> allocation_strategy::choose_node(
   const allocation_state& state,
   const allocation_constraints& request,
   const allocated_partition& partition,
   std::optional<model::node_id> prev) {
-    const auto& allocation_nodes = state.allocation_nodes();
     /**
      * evaluate hard constraints
      */
-    std::vector<model::node_id> possible_nodes = solve_hard_constraints(
-      allocation_nodes, request.hard_constraints, partition, prev);
+    solve_hard_constraints(state, request.hard_constraints, partition, prev);
 
-    vlog(
-      clusterlog.trace,
-      "after applying hard constraints, eligible nodes: {}",
-      possible_nodes);
+    if (clusterlog.is_enabled(ss::log_level::trace)) {
+        vlog(
+          clusterlog.trace,
+          "after applying hard constraints, eligible nodes: {}",
+          candidate_ids(_candidates));
+    }
 
-    if (possible_nodes.empty()) {
+    if (_candidates.empty()) {
         return errc::no_eligible_allocation_nodes;
     }
 
@@ -190,15 +170,16 @@ result<model::node_id> allocation_strategy::choose_node(
     // this loop optimizes each level of constrains and then move on to the next
     // one leaving the previous error at the minimum
     for (const auto& lvl : request.soft_constraints) {
-        possible_nodes = optimize_constraints(
-          allocation_nodes, std::move(possible_nodes), lvl, partition, prev);
-        vlog(
-          clusterlog.trace,
-          "after optimizing soft constraints level, eligible nodes: {}",
-          possible_nodes);
+        optimize_constraints(lvl, partition, prev);
+        if (clusterlog.is_enabled(ss::log_level::trace)) {
+            vlog(
+              clusterlog.trace,
+              "after optimizing soft constraints level, eligible nodes: {}",
+              candidate_ids(_candidates));
+        }
     }
 
-    return random_generators::random_choice(possible_nodes);
+    return random_generators::random_choice(_candidates)->id();
 }
 
 } // namespace cluster
@@ -15,9 +15,13 @@
 #include "cluster/scheduling/types.h"
 #include "model/metadata.h"
 
+#include <vector>
+
 namespace cluster {
 class allocation_state;
 
+class allocation_node;
+
 class allocation_strategy {
 public:
     result<model::node_id> choose_node(
@@ -25,6 +29,25 @@ public:
       const allocation_constraints&,
       const allocated_partition&,
       std::optional<model::node_id> prev);
+
+private:
+    void solve_hard_constraints(
+      const allocation_state&,
+      const std::vector<hard_constraint_ptr>&,
+      const allocated_partition&,
+      std::optional<model::node_id> prev);
+
+    void optimize_constraints(
+      const soft_constraints_level&,
+      const allocated_partition&,
+      std::optional<model::node_id> prev);
+
+    // Candidate nodes and their scores, every constraint is evaluated over all
+    // the candidates at once. The buffers are reused by the subsequent calls
+    // so that allocating the replicas of a large topic doesn't allocate memory
+    // for every replica.
+    std::vector<const allocation_node*> _candidates;
+    std::vector<uint32_t> _scores;
 };
 
 } // namespace cluster
@@ -73,6 +73,8 @@ leader_balancer::leader_balancer(
   , _node_mute_timeout(std::move(node_mute_timeout))
   , _transfer_limit_per_shard(std::move(transfer_limit_per_shard))
   , _enable_rack_awareness(std::move(enable_rack_awareness))
+  , _throughput_balancing(
+      config::shard_local_cfg().leader_balancer_throughput_balancing.bind())
   , _default_preference(
       features::make_sanctioning_binding<
         features::license_required_feature::leadership_pinning>())
@@ -606,12 +608,19 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
 
     auto muted_nodes = collect_muted_nodes(health_report.value());
 
+    std::optional<leader_balancer_types::group_load_t> group_load;
+    if (_throughput_balancing()) {
+        group_load = co_await collect_group_load_from_health_report(
+          health_report.value());
+    }
+
     std::unique_ptr<leader_balancer_strategy> strategy
       = std::make_unique<leader_balancer_types::random_hill_climbing_strategy>(
         std::move(index),
         std::move(group_id_to_topic),
         leader_balancer_types::muted_index{std::move(muted_nodes), {}},
-        std::move(preference_index));
+        std::move(preference_index),
+        std::move(group_load));
 
     auto cores = strategy->stats();
 
@@ -924,6 +933,42 @@ leader_balancer::collect_group_replicas_from_health_report(
     co_return group_replicas;
 }
 
+ss::future<leader_balancer_types::group_load_t>
+leader_balancer::collect_group_load_from_health_report(
+  const cluster_health_report& hr) {
+    leader_balancer_types::group_load_t group_load;
+    ssx::async_counter counter;
+    for (const auto& node : hr.node_reports) {
+        for (const auto& [tp_ns, partitions] : node->topics) {
+            auto maybe_meta = _topics.get_topic_metadata_ref(tp_ns);
+            if (!maybe_meta) {
+                continue;
+            }
+            const auto& meta = maybe_meta->get();
+
+            co_await ssx::async_for_each_counter(
+              counter,
+              partitions.begin(),
+              partitions.end(),
+              [&](const partition_status& partition) {
+                  // only the leaders report the throughput
+                  if (
+                    !partition.leader_throughput
+                    || partition.leader_id != node->id) {
+                      return;
+                  }
+                  auto as_it = meta.get_assignments().find(partition.id);
+                  if (as_it != meta.get_assignments().end()) {
+                      group_load[as_it->second.group]
+                        = *partition.leader_throughput;
+                  }
+              });
+        }
+    }
+
+    co_return group_load;
+}
+
 /*
  * builds an index that maps each core in the cluster to the set of replica
  * groups such that the leader of each mapped replica group is on the given
@@ -106,6 +106,9 @@ private:
     ss::future<std::optional<group_replicas_t>>
     collect_group_replicas_from_health_report(const cluster_health_report&);
 
+    ss::future<leader_balancer_types::group_load_t>
+    collect_group_load_from_health_report(const cluster_health_report&);
+
     leader_balancer_types::group_id_to_topic_id
     build_group_id_to_topic_id() const;
 
@@ -200,6 +203,7 @@ private:
     config::binding<size_t> _transfer_limit_per_shard;
 
     config::binding<bool> _enable_rack_awareness;
+    config::binding<bool> _throughput_balancing;
     features::sanctioning_binding<config::property<config::leaders_preference>>
       _default_preference;
 
@@ -13,6 +13,8 @@
 #include "base/vassert.h"
 #include "model/metadata.h"
 
+#include <cmath>
+
 namespace cluster::leader_balancer_types {
 
 even_topic_distribution_constraint::even_topic_distribution_constraint(
@@ -283,4 +285,70 @@ double even_node_load_constraint::evaluate_internal(const reassignment& r) {
            - to_info.shards;
 }
 
+even_shard_throughput_constraint::even_shard_throughput_constraint(
+  const shard_index& si, group_load_t group_load, double hysteresis)
+  : _group_load(std::move(group_load)) {
+    double total = 0;
+    for (const auto& [bs, leaders] : si.shards()) {
+        auto& load = _shard_load[bs];
+        for (const auto& [group, _] : leaders) {
+            load += this->group_load(group);
+        }
+        total += load;
+    }
+    if (!_shard_load.empty()) {
+        _threshold = hysteresis * total / double(_shard_load.size());
+    }
+}
+
+void even_shard_throughput_constraint::update_index(const reassignment& r) {
+    const auto load = group_load(r.group);
+    _shard_load[r.from] -= load;
+    _shard_load[r.to] += load;
+}
+
+double even_shard_throughput_constraint::error() const {
+    if (_shard_load.empty()) {
+        return 0;
+    }
+    double total = 0;
+    for (const auto& [_, load] : _shard_load) {
+        total += load;
+    }
+    const auto mean = total / double(_shard_load.size());
+    double error = 0;
+    for (const auto& [_, load] : _shard_load) {
+        error += std::pow(load - mean, 2);
+    }
+    return error;
+}
+
+double even_shard_throughput_constraint::evaluate_internal(
+  const reassignment& r) {
+    const auto load = group_load(r.group);
+    if (load == 0) {
+        return 0;
+    }
+    // The squared error decreases by 2 * load * gap when moving the leader,
+    // gap being positive iff the target shard ends up less loaded than the
+    // source shard was.
+    const auto gap = shard_load(r.from) - shard_load(r.to) - load;
+    if (std::abs(gap) <= _threshold) {
+        return 0;
+    }
+    return 2 * load * gap;
+}
+
+double
+even_shard_throughput_constraint::group_load(raft::group_id group) const {
+    auto it = _group_load.find(group);
+    return it == _group_load.end() ? 0 : double(it->second);
+}
+
+double even_shard_throughput_constraint::shard_load(
+  const model::broker_shard& bs) const {
+    auto it = _shard_load.find(bs);
+    return it == _shard_load.end() ? 0 : it->second;
+}
+
 } // namespace cluster::leader_balancer_types
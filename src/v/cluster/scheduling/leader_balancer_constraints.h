@@ -310,4 +310,37 @@ private:
     absl::flat_hash_map<model::node_id, node_info> _node2info;
 };
 
+// Constraint balancing the observed throughput of the leaders on each shard.
+// Moves whose effect is within the hysteresis band (a fraction of the mean
+// shard load) are considered neutral. A move considered improving leaves
+// the reverse move worsening by the same margin, so leaders don't flap
+// between shards while their throughput stays the same.
+class even_shard_throughput_constraint final
+  : public soft_constraint
+  , public index {
+public:
+    even_shard_throughput_constraint(
+      const shard_index& si, group_load_t group_load, double hysteresis);
+
+    void update_index(const reassignment& r) override;
+
+    double error() const;
+
+    const absl::flat_hash_map<model::broker_shard, double>&
+    shard_loads() const {
+        return _shard_load;
+    }
+
+private:
+    double evaluate_internal(const reassignment& r) override;
+
+    double group_load(raft::group_id) const;
+    double shard_load(const model::broker_shard&) const;
+
+private:
+    group_load_t _group_load;
+    absl::flat_hash_map<model::broker_shard, double> _shard_load;
+    double _threshold{0};
+};
+
 } // namespace cluster::leader_balancer_types
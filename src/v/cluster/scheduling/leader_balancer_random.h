@@ -105,7 +105,8 @@ public:
       index_type index,
       group_id_to_topic_id g_to_topic,
       muted_index mi,
-      std::optional<preference_index> preference_idx)
+      std::optional<preference_index> preference_idx,
+      std::optional<group_load_t> group_load = std::nullopt)
       : _mi(std::make_unique<muted_index>(std::move(mi)))
       , _group2topic(
           std::make_unique<group_id_to_topic_id>(std::move(g_to_topic)))
@@ -118,6 +119,10 @@ public:
             _pinning_constr.emplace(
               *_group2topic, std::move(preference_idx.value()));
         }
+        if (group_load) {
+            _throughput_constr.emplace(
+              *_si, std::move(group_load.value()), throughput_hysteresis);
+        }
     }
 
     double error() const override { return _eslc.error() + _etdc.error(); }
@@ -157,6 +162,18 @@ public:
                 }
             }
 
+            // Observed throughput takes precedence over the leader counts,
+            // moves it considers neutral are left to the counts.
+            if (_throughput_constr) {
+                auto throughput_diff = _throughput_constr->evaluate(
+                  reassignment);
+                if (throughput_diff < -error_jitter) {
+                    continue;
+                } else if (throughput_diff > error_jitter) {
+                    return reassignment_opt;
+                }
+            }
+
             auto shard_load_diff = _etdc.evaluate(reassignment)
                                    + _eslc.evaluate(reassignment);
             if (shard_load_diff < -error_jitter) {
@@ -180,6 +197,9 @@ public:
         _etdc.update_index(reassignment);
         _eslc.update_index(reassignment);
         _enlc.update_index(reassignment);
+        if (_throughput_constr) {
+            _throughput_constr->update_index(reassignment);
+        }
         _mi->update_index(reassignment);
         _si->update_index(reassignment);
         _reassignments.update_index(reassignment);
@@ -190,8 +210,21 @@ public:
      */
     std::vector<shard_load> stats() const override { return _eslc.stats(); }
 
+    /*
+     * Observed throughput per shard, empty if the throughput is not balanced.
+     */
+    absl::flat_hash_map<model::broker_shard, double> throughput_stats() const {
+        if (!_throughput_constr) {
+            return {};
+        }
+        return _throughput_constr->shard_loads();
+    }
+
 private:
     static constexpr double error_jitter = 0.000001;
+    // Fraction of the mean shard throughput within which leadership moves are
+    // considered neutral.
+    static constexpr double throughput_hysteresis = 0.1;
 
     std::unique_ptr<muted_index> _mi;
     std::unique_ptr<group_id_to_topic_id> _group2topic;
@@ -199,6 +232,7 @@ private:
     random_reassignments _reassignments;
 
     std::optional<pinning_constraint> _pinning_constr;
+    std::optional<even_shard_throughput_constraint> _throughput_constr;
     even_topic_distribution_constraint _etdc;
     even_shard_load_constraint _eslc;
     even_node_load_constraint _enlc;
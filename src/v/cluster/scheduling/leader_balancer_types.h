@@ -47,6 +47,9 @@ using topic_id_t
 
 using group_id_to_topic_id = chunked_hash_map<raft::group_id, topic_id_t>;
 
+// Observed throughput (bytes per second) of the groups, keyed by group.
+using group_load_t = chunked_hash_map<raft::group_id, uint64_t>;
+
 template<typename ValueType>
 using topic_map = chunked_hash_map<topic_id_t, ValueType>;
 
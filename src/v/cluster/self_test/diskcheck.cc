@@ -20,6 +20,7 @@
 
 #include <seastar/core/seastar.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/when_all.hh>
 
 namespace cluster::self_test {
 
@@ -39,6 +40,10 @@ void diskcheck::validate_options(const diskcheck_opts& opts) {
         throw diskcheck_option_out_of_range(
           "IO Queue depth (parallelism) out of range, min is 1, max 256");
     }
+    if (opts.mixed && (opts.skip_write || opts.skip_read)) {
+        throw diskcheck_option_out_of_range(
+          "A mixed run needs both the write and the read portion");
+    }
 }
 
 diskcheck::diskcheck(ss::sharded<node::local_monitor>& nlm)
@@ -89,6 +94,7 @@ ss::future<std::vector<self_test_result>> diskcheck::run(diskcheck_opts opts) {
     _cancelled = false;
     _opts = opts;
     _last_pos = 0;
+    _written_up_to = 0;
     if (std::filesystem::exists(_opts.dir)) {
         /// Ensure no leftover large files in the event there was a
         /// crash mid run and cleanup didn't get a chance to occur
@@ -141,6 +147,27 @@ diskcheck::initialize_benchmark(ss::sstring fname) {
 ss::future<std::vector<self_test_result>>
 diskcheck::run_configured_benchmarks(ss::file& file) {
     std::vector<self_test_result> r;
+    if (_opts.mixed) {
+        auto [write_metrics, read_metrics] = co_await do_run_mixed_benchmark(
+          file);
+        auto add_result = [this, &r](const metrics& m, std::string_view kind) {
+            auto result = m.to_st_result();
+            result.name = _opts.name;
+            result.info = fmt::format(
+              "mixed {} run (iodepth: {}, dsync: {})",
+              kind,
+              _opts.parallelism,
+              _opts.dsync);
+            result.test_type = "disk";
+            if (_cancelled) {
+                result.warning = "Run was manually cancelled";
+            }
+            r.push_back(std::move(result));
+        };
+        add_result(write_metrics, "write");
+        add_result(read_metrics, "read");
+        co_return r;
+    }
     auto write_metrics = co_await do_run_benchmark<read_or_write::write>(file);
     auto result = write_metrics.to_st_result();
     result.name = _opts.name;
@@ -193,6 +220,42 @@ ss::future<metrics> diskcheck::do_run_benchmark(ss::file& file) {
     co_return m;
 }
 
+ss::future<std::pair<metrics, metrics>>
+diskcheck::do_run_mixed_benchmark(ss::file& file) {
+    auto irange = boost::irange<uint16_t>(0, _opts.parallelism);
+    auto start = ss::lowres_clock::now();
+    auto start_highres = ss::lowres_system_clock::now();
+    static const auto five_seconds_us = 500000;
+    metrics write_m{five_seconds_us};
+    metrics read_m{five_seconds_us};
+    ss::timer<ss::lowres_clock> timer;
+    timer.set_callback([this] { _intent.cancel(); });
+    timer.rearm(start + _opts.duration);
+    try {
+        // Each unit of parallelism is a writer and a reader, which share the
+        // disk the way a partition's produce and fetch traffic does
+        co_await ss::parallel_for_each(
+          irange, [this, &start, &file, &write_m, &read_m](auto) {
+              return ss::when_all_succeed(
+                       run_benchmark_fiber<read_or_write::write>(
+                         start, file, write_m),
+                       run_benchmark_fiber<read_or_write::read>(
+                         start, file, read_m))
+                .discard_result();
+          });
+    } catch (const ss::cancelled_error&) {
+        vlog(clusterlog.debug, "Benchmark completed (duration reached)");
+    }
+    timer.cancel();
+    auto end = ss::lowres_system_clock::now();
+    for (auto* m : {&write_m, &read_m}) {
+        m->set_start_end_time(start_highres, end);
+        m->set_total_time(end - start_highres);
+    }
+    _last_pos = 0;
+    co_return std::make_pair(std::move(write_m), std::move(read_m));
+}
+
 template<diskcheck::read_or_write mode>
 ss::future<> diskcheck::run_benchmark_fiber(
   ss::lowres_clock::time_point start, ss::file& file, metrics& m) {
@@ -214,9 +277,13 @@ ss::future<> diskcheck::run_benchmark_fiber(
         }
         co_await m.measure([this, &iov, &file] {
             if constexpr (mode == read_or_write::write) {
-                return file.dma_write(get_pos(), iov, &_intent);
+                auto pos = get_pos();
+                _written_up_to = std::max(
+                  _written_up_to, pos + _opts.request_size);
+                return file.dma_write(pos, iov, &_intent);
             } else {
-                return file.dma_read(get_pos(), iov, &_intent);
+                auto pos = _opts.mixed ? get_random_written_pos() : get_pos();
+                return file.dma_read(pos, iov, &_intent);
             }
         });
     }
@@ -238,4 +305,13 @@ uint64_t diskcheck::get_pos() {
     return pos;
 }
 
+uint64_t diskcheck::get_random_written_pos() {
+    const auto written_requests = _written_up_to / _opts.request_size;
+    if (written_requests == 0) {
+        return 0;
+    }
+    return random_generators::get_int<uint64_t>(0, written_requests - 1)
+           * _opts.request_size;
+}
+
 } // namespace cluster::self_test
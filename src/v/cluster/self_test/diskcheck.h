@@ -82,7 +82,8 @@ public:
     ///
     /// Runs sequential write then read benchmarks (unless otherwise either
     /// marked as skip in configuration options). Note that each sub-benchmark
-    /// will run for at least the total run time desired.
+    /// will run for at least the total run time desired. In mixed mode the
+    /// writes and reads run at the same time instead.
     ss::future<std::vector<self_test_result>> run(diskcheck_opts);
 
     /// Signal to stop all work as soon as possible
@@ -103,11 +104,16 @@ private:
     template<read_or_write mode>
     ss::future<metrics> do_run_benchmark(ss::file&);
 
+    /// Runs write and read fibers together, returns write and read metrics
+    ss::future<std::pair<metrics, metrics>> do_run_mixed_benchmark(ss::file&);
+
     template<read_or_write mode>
     ss::future<> run_benchmark_fiber(
       ss::lowres_clock::time_point start, ss::file& file, metrics& m);
 
     uint64_t get_pos();
+    /// Random offset below the highest offset written so far
+    uint64_t get_random_written_pos();
 
 private:
     /// To ensure test doesn't attempt to take all available disk space
@@ -117,6 +123,8 @@ private:
     bool _cancelled{false};
     /// Next read/write offset in file
     uint64_t _last_pos{0};
+    /// End of the highest write issued, reads in mixed runs stay below it
+    uint64_t _written_up_to{0};
     /// For shutting down service
     ss::abort_source _as;
     ss::gate _gate;
@@ -11,17 +11,53 @@
 
 #include "cluster/self_test/netcheck.h"
 
+#include "base/units.h"
 #include "base/vassert.h"
 #include "base/vlog.h"
 #include "cluster/logger.h"
+#include "random/generators.h"
 
 #include <seastar/core/coroutine.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <boost/range/irange.hpp>
 
+#include <array>
+#include <iterator>
+
 namespace cluster::self_test {
 
+namespace {
+
+struct raft_message_kind {
+    std::string_view name;
+    size_t size;
+    /// Out of 100 requests
+    int weight;
+};
+
+/// Rough shape of the traffic between two brokers replicating partitions:
+/// mostly heartbeats, small appends from produce requests and the occasional
+/// batch of a follower catching up.
+constexpr std::array<raft_message_kind, 3> raft_mix{{
+  {.name = "heartbeat", .size = 256, .weight = 60},
+  {.name = "append_entries", .size = 16_KiB, .weight = 35},
+  {.name = "recovery", .size = 512_KiB, .weight = 5},
+}};
+
+size_t pick_raft_message_kind() {
+    auto n = random_generators::get_int(0, 99);
+    for (size_t i = 0; i < raft_mix.size(); ++i) {
+        n -= raft_mix[i].weight;
+        if (n < 0) {
+            return i;
+        }
+    }
+    return raft_mix.size() - 1;
+}
+
+} // namespace
+
 class netcheck_unreachable_peer_exception final : public netcheck_exception {
 public:
     explicit netcheck_unreachable_peer_exception(model::node_id peer)
@@ -90,12 +126,21 @@ ss::future<std::vector<self_test_result>> netcheck::run(netcheck_opts opts) {
           clusterlog.info,
           "Starting redpanda self-test network benchmark, with options: {}",
           opts);
-        co_return co_await ss::with_scheduling_group(opts.sg, [this]() {
-            return ssx::async_transform(
-              _opts.peers, [this](model::node_id peer) {
-                  return run_individual_benchmark(peer);
-              });
-        });
+        auto per_peer = co_await ss::with_scheduling_group(
+          opts.sg, [this]() {
+              return ssx::async_transform(
+                _opts.peers, [this](model::node_id peer) {
+                    return run_individual_benchmark(peer);
+                });
+          });
+        std::vector<self_test_result> results;
+        for (auto& peer_results : per_peer) {
+            std::move(
+              peer_results.begin(),
+              peer_results.end(),
+              std::back_inserter(results));
+        }
+        co_return results;
     } catch (const netcheck_aborted_exception& ex) {
         vlog(clusterlog.debug, "netcheck stopped due to call of stop()");
     } catch (const ss::gate_closed_exception&) {
@@ -104,47 +149,68 @@ ss::future<std::vector<self_test_result>> netcheck::run(netcheck_opts opts) {
     co_return std::vector<self_test_result>{};
 }
 
-ss::future<self_test_result>
+ss::future<std::vector<self_test_result>>
 netcheck::run_individual_benchmark(model::node_id peer) {
     auto irange = boost::irange<uint16_t>(0, _opts.parallelism);
     static const auto two_seconds_us = 200000;
-    metrics m{two_seconds_us};
+    std::vector<metrics> ms;
+    const auto kinds = _opts.raft_mix ? raft_mix.size() : 1;
+    ms.reserve(kinds);
+    for (size_t i = 0; i < kinds; ++i) {
+        ms.emplace_back(two_seconds_us);
+    }
     vassert(
       _opts.max_duration >= _opts.duration, "Misconfigured self_test plan");
     const auto max_deadline = ss::lowres_clock::now() + _opts.max_duration;
-    self_test_result result;
+    std::vector<self_test_result> results(kinds);
     try {
         auto begin_t = ss::lowres_system_clock::now();
         auto durations = co_await ssx::parallel_transform(
-          irange, [this, max_deadline, peer, &m](auto) {
+          irange, [this, max_deadline, peer, &ms](auto) {
               return run_benchmark_fiber(
-                run_fiber_opts(max_deadline, _opts.duration), peer, m);
+                run_fiber_opts(max_deadline, _opts.duration), peer, ms);
           });
 
         /// Total time will be the average time all fibers took to complete
         const auto total_duration = std::accumulate(
           durations.begin(), durations.end(), ss::lowres_clock::duration{0});
-        m.set_total_time(total_duration / _opts.parallelism);
-        m.set_start_end_time(begin_t, ss::lowres_system_clock::now());
-        result = m.to_st_result();
+        const auto end_t = ss::lowres_system_clock::now();
+        for (size_t i = 0; i < kinds; ++i) {
+            ms[i].set_total_time(total_duration / _opts.parallelism);
+            ms[i].set_start_end_time(begin_t, end_t);
+            results[i] = ms[i].to_st_result();
+        }
         if (total_duration == 0ms) {
             /// Constant timeouts prevented test from any successful work
             throw netcheck_unreachable_peer_exception(peer);
         }
         if (_cancelled) {
-            result.warning = "Run was manually cancelled";
+            for (auto& result : results) {
+                result.warning = "Run was manually cancelled";
+            }
         }
     } catch (const netcheck_unreachable_peer_exception& ex) {
-        result.error = ex.what();
+        for (auto& result : results) {
+            result.error = ex.what();
+        }
+    }
+    for (size_t i = 0; i < kinds; ++i) {
+        auto& result = results[i];
+        result.name = _opts.name;
+        result.info = fmt::format("Test performed against node: {}", peer);
+        if (_opts.raft_mix) {
+            result.info += fmt::format(
+              ", {} requests of {} bytes", raft_mix[i].name, raft_mix[i].size);
+        }
+        result.test_type = "network";
     }
-    result.name = _opts.name;
-    result.info = fmt::format("Test performed against node: {}", peer);
-    result.test_type = "network";
-    co_return result;
+    co_return results;
 }
 
 ss::future<ss::lowres_clock::duration> netcheck::run_benchmark_fiber(
-  run_fiber_opts fiber_state, model::node_id peer, metrics& m) {
+  run_fiber_opts fiber_state,
+  model::node_id peer,
+  std::vector<metrics>& ms) {
     /// run_fiber_opts manages the the RPC request timeouts to ensure that
     /// the maximum amount of time for an individual RPC never exceeds the
     /// remaining time of the test
@@ -152,9 +218,12 @@ ss::future<ss::lowres_clock::duration> netcheck::run_benchmark_fiber(
         if (unlikely(_as.abort_requested())) {
             throw netcheck_aborted_exception();
         }
-        auto req = co_await make_netcheck_request(_self, _opts.request_size);
-        co_await m.measure(
-          [this, req = std::move(req), peer, &fiber_state, &m]() mutable {
+        const auto kind = _opts.raft_mix ? pick_raft_message_kind() : 0;
+        const auto size = _opts.raft_mix ? raft_mix[kind].size
+                                         : _opts.request_size;
+        auto req = co_await make_netcheck_request(_self, size);
+        co_await ms[kind].measure(
+          [this, req = std::move(req), peer, &fiber_state, size]() mutable {
               return _connections.local()
                 .with_node_client<self_test_rpc_client_protocol>(
                   _self,
@@ -166,9 +235,9 @@ ss::future<ss::lowres_clock::duration> netcheck::run_benchmark_fiber(
                       return c.netcheck(
                         std::move(req), rpc::client_opts(200ms));
                   })
-                .then([this, peer, &fiber_state, &m](auto reply) {
+                .then([this, peer, &fiber_state, size](auto reply) {
                     return process_netcheck_reply(
-                      std::move(reply), fiber_state, peer, m);
+                      std::move(reply), fiber_state, peer, size);
                 });
           });
     }
@@ -179,7 +248,7 @@ ss::future<size_t> netcheck::process_netcheck_reply(
   result<rpc::client_context<netcheck_response>> reply,
   run_fiber_opts& fiber_state,
   model::node_id peer,
-  metrics&) {
+  size_t request_size) {
     if (!reply) {
         if (
           reply.error() == rpc::errc::client_request_timeout
@@ -215,7 +284,7 @@ ss::future<size_t> netcheck::process_netcheck_reply(
         fiber_state.start();
     }
     vassert(
-      reply.value().data.bytes_read == _opts.request_size,
+      reply.value().data.bytes_read == request_size,
       "Benchmark expected different value in response");
 
     /// Return number of bytes moved through current send/recv.
@@ -120,16 +120,21 @@ private:
         void clear() { nstatus = netcheck_status::not_started; }
     };
 
-    ss::future<self_test_result> run_individual_benchmark(model::node_id peer);
+    /// One result, or one per kind of request in a raft_mix run
+    ss::future<std::vector<self_test_result>>
+    run_individual_benchmark(model::node_id peer);
 
+    /// \p ms holds one metrics per kind of request, see netcheck_opts
     ss::future<ss::lowres_clock::duration> run_benchmark_fiber(
-      run_fiber_opts fiber_state, model::node_id peer, metrics& m);
+      run_fiber_opts fiber_state,
+      model::node_id peer,
+      std::vector<metrics>& ms);
 
     ss::future<size_t> process_netcheck_reply(
       result<rpc::client_context<netcheck_response>> reply,
       run_fiber_opts& fiber_state,
       model::node_id peer,
-      metrics& m);
+      size_t request_size);
 
 private:
     model::node_id _self;
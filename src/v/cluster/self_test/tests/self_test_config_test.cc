@@ -43,12 +43,19 @@ BOOST_AUTO_TEST_CASE(test_diskcheck_validation) {
         cluster::diskcheck_opts{.parallelism = 266}),
       cft::diskcheck_option_out_of_range);
 
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(
+        cluster::diskcheck_opts{.skip_read = true, .mixed = true}),
+      cft::diskcheck_option_out_of_range);
+
     BOOST_CHECK_NO_THROW(
       cft::diskcheck::validate_options(cluster::diskcheck_opts{
         .skip_write = true,
         .skip_read = false,
         .duration = 5000ms,
         .parallelism = 50}));
+    BOOST_CHECK_NO_THROW(cft::diskcheck::validate_options(
+      cluster::diskcheck_opts{.mixed = true}));
 }
 
 BOOST_AUTO_TEST_CASE(test_netcheck_validation) {
@@ -112,6 +119,7 @@ static const std::string sample_self_test_config = R"(
             "request_size": 54321,
             "duration_ms": 7100,
             "parallelism": 25,
+            "raft_mix": true,
             "type" : "network"
         }
     ]
@@ -156,6 +164,8 @@ BOOST_AUTO_TEST_CASE(test_self_test_json_serde) {
     BOOST_CHECK_EQUAL(net_opts.request_size, 54321);
     BOOST_CHECK_EQUAL(net_opts.duration, 7100ms);
     BOOST_CHECK_EQUAL(net_opts.parallelism, 25);
+    BOOST_CHECK(cluster::netcheck_opts::from_json(net_json_obj).raft_mix);
+    BOOST_CHECK(!cluster::netcheck_opts::from_json(dsk_json_obj).raft_mix);
 }
 
 BOOST_AUTO_TEST_CASE(test_self_test_network_plan) {
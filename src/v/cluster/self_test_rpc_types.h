@@ -44,7 +44,7 @@ std::ostream& operator<<(std::ostream& o, self_test_stage sts);
 
 struct diskcheck_opts
   : serde::
-      envelope<diskcheck_opts, serde::version<0>, serde::compat_version<0>> {
+      envelope<diskcheck_opts, serde::version<1>, serde::compat_version<0>> {
     /// Descriptive name given to test run
     ss::sstring name{"unspecified"};
     /// Where files this benchmark will read/write to exist
@@ -55,6 +55,10 @@ struct diskcheck_opts
     bool skip_write{false};
     /// Set to true to disable the read portion of the benchmark
     bool skip_read{false};
+    /// Run the reads concurrently with the writes, reading back random ranges
+    /// which were already written, like consumers fetching while producers
+    /// append. Requires both reads and writes.
+    bool mixed{false};
     /// Total size of all benchmark files to exist on disk
     uint64_t data_size{10ULL << 30}; // 10GiB
     /// Size of individual read and/or write requests
@@ -86,6 +90,9 @@ struct diskcheck_opts
         if (obj.HasMember("skip_read")) {
             opts.skip_read = obj["skip_read"].GetBool();
         }
+        if (obj.HasMember("mixed")) {
+            opts.mixed = obj["mixed"].GetBool();
+        }
         if (obj.HasMember("data_size")) {
             opts.data_size = obj["data_size"].GetUint64();
         }
@@ -111,19 +118,21 @@ struct diskcheck_opts
           data_size,
           request_size,
           duration,
-          parallelism);
+          parallelism,
+          mixed);
     }
 
     friend std::ostream&
     operator<<(std::ostream& o, const diskcheck_opts& opts) {
         fmt::print(
           o,
-          "{{name: {} dsync: {} skip_write: {} skip_read: {} data_size: {} "
-          "request_size: {} duration: {} parallelism: {}}}",
+          "{{name: {} dsync: {} skip_write: {} skip_read: {} mixed: {} "
+          "data_size: {} request_size: {} duration: {} parallelism: {}}}",
           opts.name,
           opts.dsync,
           opts.skip_write,
           opts.skip_read,
+          opts.mixed,
           opts.data_size,
           opts.request_size,
           opts.duration,
@@ -134,7 +143,7 @@ struct diskcheck_opts
 
 struct netcheck_opts
   : serde::
-      envelope<netcheck_opts, serde::version<0>, serde::compat_version<0>> {
+      envelope<netcheck_opts, serde::version<1>, serde::compat_version<0>> {
     /// Descriptive name given to test run
     ss::sstring name{"Network Test 8192b packet size"};
     /// Node ids of servers to run the test against
@@ -150,6 +159,10 @@ struct netcheck_opts
     ss::lowres_clock::duration max_duration;
     /// Number of fibers per shard used to make network requests
     uint16_t parallelism{10};
+    /// Send a mix of heartbeat, append_entries and recovery sized requests,
+    /// shaped like raft traffic, instead of requests of request_size. Each
+    /// kind of request gets its own result.
+    bool raft_mix{false};
     /// Scheduling group that the benchmark will operate under
     ss::scheduling_group sg;
 
@@ -169,12 +182,21 @@ struct netcheck_opts
         if (obj.HasMember("parallelism")) {
             opts.parallelism = obj["parallelism"].GetInt();
         }
+        if (obj.HasMember("raft_mix")) {
+            opts.raft_mix = obj["raft_mix"].GetBool();
+        }
         return opts;
     }
 
     auto serde_fields() {
         return std::tie(
-          name, peers, request_size, duration, max_duration, parallelism);
+          name,
+          peers,
+          request_size,
+          duration,
+          max_duration,
+          parallelism,
+          raft_mix);
     }
 
     friend std::ostream&
@@ -182,13 +204,14 @@ struct netcheck_opts
         fmt::print(
           o,
           "{{name: {} peers: {} request_size: {} duration: "
-          "{} max_duration: {} parallelism: {}}}",
+          "{} max_duration: {} parallelism: {} raft_mix: {}}}",
           opts.name,
           opts.peers,
           opts.request_size,
           opts.duration.count(),
           opts.max_duration.count(),
-          opts.parallelism);
+          opts.parallelism,
+          opts.raft_mix);
         return o;
     }
 };
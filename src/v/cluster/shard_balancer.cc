@@ -13,6 +13,7 @@
 
 #include "cluster/cluster_utils.h"
 #include "cluster/logger.h"
+#include "cluster/partition_manager.h"
 #include "config/node_config.h"
 #include "features/enterprise_feature_messages.h"
 #include "features/enterprise_features.h"
@@ -20,6 +21,8 @@
 #include "ssx/async_algorithm.h"
 #include "types.h"
 
+#include <numeric>
+
 namespace cluster {
 
 namespace {
@@ -42,6 +45,18 @@ struct persisted_state
     auto serde_fields() { return std::tie(last_rebalance_core_count); }
 };
 
+// How often the partition byte rates are sampled for load-aware balancing.
+constexpr auto load_balancing_interval = 1min;
+// Max number of partitions moved by one round of load-aware balancing.
+constexpr size_t max_load_moves_per_round = 2;
+// Moves must improve the load balance between the two shards by more than
+// this fraction of the mean shard load, so that partitions don't bounce
+// between shards as their load fluctuates.
+constexpr double load_hysteresis = 0.1;
+// How long counts balancing leaves the partitions moved because of their
+// load on their new shard.
+constexpr auto moved_by_load_expiry = 30min;
+
 } // namespace
 
 shard_balancer::shard_balancer(
@@ -50,15 +65,18 @@ shard_balancer::shard_balancer(
   ss::sharded<storage::api>& storage,
   ss::sharded<topic_table>& topics,
   ss::sharded<controller_backend>& cb,
+  ss::sharded<partition_manager>& pm,
   config::binding<bool> balancing_on_core_count_change,
   config::binding<std::chrono::milliseconds> debounce_timeout,
   config::binding<uint32_t> partitions_per_shard,
-  config::binding<uint32_t> partitions_reserve_shard0)
+  config::binding<uint32_t> partitions_reserve_shard0,
+  config::binding<bool> balancing_by_load)
   : _shard_placement(spt.local())
   , _features(features.local())
   , _storage(storage.local())
   , _topics(topics)
   , _controller_backend(cb)
+  , _partition_manager(pm)
   , _self(*config::node().node_id())
   , _balancing_on_core_count_change(std::move(balancing_on_core_count_change))
   , _balancing_continuous(
@@ -68,14 +86,17 @@ shard_balancer::shard_balancer(
   , _debounce_jitter(_debounce_timeout())
   , _partitions_per_shard(std::move(partitions_per_shard))
   , _partitions_reserve_shard0(std::move(partitions_reserve_shard0))
+  , _balancing_by_load(std::move(balancing_by_load))
   , _balance_timer([this] { balance_timer_callback(); })
-  , _total_counts(ss::smp::count, 0) {
+  , _total_counts(ss::smp::count, 0)
+  , _load_balance_timer([this] { load_balance_timer_callback(); }) {
     _total_counts.at(0) += 1; // controller partition
 
     _debounce_timeout.watch([this] {
         _debounce_jitter = simple_time_jitter<ss::lowres_clock>(
           _debounce_timeout());
     });
+    _balancing_by_load.watch([this] { arm_load_balance_timer(); });
 }
 
 ss::future<> shard_balancer::start(size_t kvstore_shard_count) {
@@ -207,6 +228,7 @@ ss::future<> shard_balancer::start(size_t kvstore_shard_count) {
       "topic_table unexpectedly changed");
 
     ssx::background = assign_fiber();
+    arm_load_balance_timer();
 }
 
 ss::future<> shard_balancer::init_shard_placement(
@@ -299,6 +321,7 @@ ss::future<> shard_balancer::stop() {
     _topics.local().unregister_ntp_delta_notification(
       _topic_table_notify_handle);
     _balance_timer.cancel();
+    _load_balance_timer.cancel();
     _wakeup_event.set();
     return _gate.close();
 }
@@ -555,11 +578,22 @@ void shard_balancer::balance_timer_callback() {
 
 ss::future<> shard_balancer::do_balance(mutex::units& lock) {
     // Go over all node-local ntps in random order and try to find a more
-    // optimal core for them.
+    // optimal core for them. Partitions recently moved because of their load
+    // stay where they are.
+    const auto now = ss::lowres_clock::now();
+    for (auto it = _moved_by_load.begin(); it != _moved_by_load.end();) {
+        if (it->second + moved_by_load_expiry < now) {
+            it = _moved_by_load.erase(it);
+        } else {
+            ++it;
+        }
+    }
     chunked_vector<model::ntp> ntps;
     co_await _shard_placement.for_each_ntp(
       [&](const model::ntp& ntp, const shard_placement_target&) {
-          ntps.push_back(ntp);
+          if (!_moved_by_load.contains(ntp)) {
+              ntps.push_back(ntp);
+          }
       });
     std::shuffle(ntps.begin(), ntps.end(), random_generators::internal::gen);
 
@@ -590,6 +624,171 @@ ss::future<> shard_balancer::do_balance(mutex::units& lock) {
       }));
 }
 
+void shard_balancer::arm_load_balance_timer() {
+    if (_gate.is_closed()) {
+        return;
+    }
+    if (!_balancing_by_load()) {
+        _load_balance_timer.cancel();
+        _load_samples.clear();
+        _load_sampled_at.reset();
+        return;
+    }
+    if (!_load_balance_timer.armed()) {
+        _load_balance_timer.arm(load_balancing_interval);
+    }
+}
+
+void shard_balancer::load_balance_timer_callback() {
+    ssx::spawn_with_gate(_gate, [this] {
+        return _mtx.get_units()
+          .then([this](mutex::units lock) {
+              return ss::do_with(std::move(lock), [this](mutex::units& lock) {
+                  return do_balance_by_load(lock);
+              });
+          })
+          .handle_exception([](const std::exception_ptr& e) {
+              if (!ssx::is_shutdown_exception(e)) {
+                  vlog(clusterlog.warn, "failed to balance by load: {}", e);
+              }
+          })
+          .finally([this] { arm_load_balance_timer(); });
+    });
+}
+
+ss::future<> shard_balancer::do_balance_by_load(mutex::units& lock) {
+    if (
+      !_balancing_by_load()
+      || !_features.is_active(features::feature::node_local_core_assignment)) {
+        co_return;
+    }
+    const auto [balancing_continuous, is_sanctioned] = _balancing_continuous(
+      _features.should_sanction());
+    if (!balancing_continuous) {
+        if (is_sanctioned) {
+            vlog(
+              clusterlog.warn,
+              "{}",
+              features::enterprise_error_message::core_balancing_continuous());
+        }
+        co_return;
+    }
+
+    struct partition_bytes {
+        model::ntp ntp;
+        uint64_t bytes;
+    };
+    auto shard_partitions = co_await _partition_manager.map(
+      [](partition_manager& pm) {
+          chunked_vector<partition_bytes> ret;
+          ret.reserve(pm.partitions().size());
+          for (const auto& [ntp, p] : pm.partitions()) {
+              ret.push_back({ntp, p->probe().bytes_transferred()});
+          }
+          return ret;
+      });
+
+    const auto now = ss::lowres_clock::now();
+    const auto prev_sampled_at = std::exchange(_load_sampled_at, now);
+    auto prev_samples = std::exchange(_load_samples, {});
+
+    struct partition_load {
+        model::ntp ntp;
+        ss::shard_id shard;
+        double rate;
+    };
+    std::vector<partition_load> loads;
+    std::vector<double> shard_loads(ss::smp::count, 0);
+    double elapsed_s = prev_sampled_at
+                         ? std::chrono::duration<double>(now - *prev_sampled_at)
+                             .count()
+                         : 0;
+    ssx::async_counter counter;
+    for (ss::shard_id shard = 0; shard < shard_partitions.size(); ++shard) {
+        co_await ssx::async_for_each_counter(
+          counter,
+          shard_partitions[shard].begin(),
+          shard_partitions[shard].end(),
+          [&](partition_bytes& pb) {
+              auto prev = prev_samples.find(pb.ntp);
+              if (
+                elapsed_s > 0 && prev != prev_samples.end()
+                && pb.bytes >= prev->second) {
+                  // only partitions settled on their shard can be moved
+                  auto target = _shard_placement.get_target(pb.ntp);
+                  double rate = double(pb.bytes - prev->second) / elapsed_s;
+                  shard_loads[shard] += rate;
+                  if (target && target->shard == shard && rate > 0) {
+                      loads.push_back({pb.ntp, shard, rate});
+                  }
+              }
+              _load_samples.emplace(std::move(pb.ntp), pb.bytes);
+          });
+    }
+
+    const double mean = std::accumulate(
+                          shard_loads.begin(), shard_loads.end(), 0.0)
+                        / double(shard_loads.size());
+    if (loads.empty() || mean == 0) {
+        co_return;
+    }
+
+    // hottest partitions first
+    std::sort(loads.begin(), loads.end(), [](const auto& l, const auto& r) {
+        return l.rate > r.rate;
+    });
+
+    size_t moves = 0;
+    while (moves < max_load_moves_per_round) {
+        auto [min_it, max_it] = std::minmax_element(
+          shard_loads.begin(), shard_loads.end());
+        const auto from = ss::shard_id(max_it - shard_loads.begin());
+        const auto to = ss::shard_id(min_it - shard_loads.begin());
+
+        // Move the hottest partition of the most loaded shard that still
+        // leaves the target shard less loaded than the source shard was.
+        auto it = std::find_if(
+          loads.begin(), loads.end(), [&](const partition_load& l) {
+              return l.shard == from
+                     && *max_it - *min_it - l.rate > load_hysteresis * mean;
+          });
+        if (it == loads.end()) {
+            break;
+        }
+
+        auto target = _shard_placement.get_target(it->ntp);
+        if (!target) {
+            loads.erase(it);
+            continue;
+        }
+        auto prev_target = target;
+        target->shard = to;
+        vlog(
+          clusterlog.info,
+          "[{}] moving from shard {} ({} bytes/s) to shard {} ({} bytes/s) "
+          "because of its load: {} bytes/s",
+          it->ntp,
+          from,
+          static_cast<uint64_t>(*max_it),
+          to,
+          static_cast<uint64_t>(*min_it),
+          static_cast<uint64_t>(it->rate));
+
+        shard_loads[from] -= it->rate;
+        shard_loads[to] += it->rate;
+        update_counts(
+          it->ntp,
+          _topic2data[model::topic_namespace_view{it->ntp}],
+          prev_target,
+          target);
+        _moved_by_load[it->ntp] = now;
+        auto ntp = it->ntp;
+        loads.erase(it);
+        ++moves;
+        co_await set_target(ntp, target, lock);
+    }
+}
+
 ss::future<> shard_balancer::set_target(
   const model::ntp& ntp,
   const std::optional<shard_placement_target>& target,
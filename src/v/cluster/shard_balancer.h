@@ -42,10 +42,12 @@ public:
       ss::sharded<storage::api>&,
       ss::sharded<topic_table>&,
       ss::sharded<controller_backend>&,
+      ss::sharded<partition_manager>&,
       config::binding<bool> balancing_on_core_count_change,
       config::binding<std::chrono::milliseconds> debounce_timeout,
       config::binding<uint32_t> partitions_per_shard,
-      config::binding<uint32_t> partitions_reserve_shard0);
+      config::binding<uint32_t> partitions_reserve_shard0,
+      config::binding<bool> balancing_by_load);
 
     ss::future<> start(size_t kvstore_shard_count);
     ss::future<> stop();
@@ -78,6 +80,10 @@ private:
     void balance_timer_callback();
     ss::future<> do_balance(mutex::units& lock);
 
+    void load_balance_timer_callback();
+    void arm_load_balance_timer();
+    ss::future<> do_balance_by_load(mutex::units& lock);
+
     void maybe_assign(
       const model::ntp&,
       bool can_reassign,
@@ -114,6 +120,7 @@ private:
     storage::api& _storage;
     ss::sharded<topic_table>& _topics;
     ss::sharded<controller_backend>& _controller_backend;
+    ss::sharded<partition_manager>& _partition_manager;
     model::node_id _self;
 
     config::binding<bool> _balancing_on_core_count_change;
@@ -122,6 +129,7 @@ private:
     simple_time_jitter<ss::lowres_clock> _debounce_jitter;
     config::binding<uint32_t> _partitions_per_shard;
     config::binding<uint32_t> _partitions_reserve_shard0;
+    config::binding<bool> _balancing_by_load;
 
     cluster::notification_id_type _topic_table_notify_handle;
     ss::timer<ss::lowres_clock> _balance_timer;
@@ -138,6 +146,15 @@ private:
       model::topic_namespace_eq>
       _topic2data;
     shard2count_t _total_counts;
+
+    // Load-aware balancing: bytes transferred by each local partition at the
+    // previous sample, used to compute the byte rates.
+    ss::timer<ss::lowres_clock> _load_balance_timer;
+    chunked_hash_map<model::ntp, uint64_t> _load_samples;
+    std::optional<ss::lowres_clock::time_point> _load_sampled_at;
+    // Partitions moved because of their load and when. Counts balancing leaves
+    // them where they are for a while so that it doesn't undo the move.
+    chunked_hash_map<model::ntp, ss::lowres_clock::time_point> _moved_by_load;
 };
 
 } // namespace cluster
@@ -76,6 +76,7 @@ public:
           log_rev);
         _ntp_idx.insert_or_assign(ntp, shard_revision{shard, log_rev});
         _group_idx.insert_or_assign(g, shard_revision{shard, log_rev});
+        ++_version;
 
         _notification_list.notify(ntp, g, shard);
     }
@@ -108,10 +109,17 @@ public:
           log_rev);
         _ntp_idx.erase(ntp);
         _group_idx.erase(g);
+        ++_version;
 
         _notification_list.notify(ntp, g, std::nullopt);
     }
 
+    /**
+     * Incremented on every change of the table. Shard lookups cached by the
+     * callers are valid as long as the version didn't change.
+     */
+    uint64_t version() const { return _version; }
+
     using change_cb_t = ss::noncopyable_function<void(
       const model::ntp& ntp,
       raft::group_id g,
@@ -152,5 +160,6 @@ private:
     chunked_hash_map<raft::group_id, shard_revision> _group_idx;
 
     notification_list<change_cb_t, notification_id_type> _notification_list;
+    uint64_t _version{0};
 };
 } // namespace cluster
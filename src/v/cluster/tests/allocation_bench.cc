@@ -86,3 +86,38 @@ PERF_TEST_F(partition_allocator_fixture, recovery) {
       replicas, raft::group_id(replicas.size() / 3));
     perf_tests::stop_measuring_time();
 }
+
+namespace {
+
+ss::future<size_t> allocate_large_topic(
+  partition_allocator_fixture& f, int nodes, int partitions) {
+    // every benchmark has its own fixture, register the nodes on the first run
+    if (f.allocator().state().allocation_nodes().empty()) {
+        for (int i = 0; i < nodes; ++i) {
+            f.register_node(i, 8);
+        }
+    }
+
+    auto req = f.make_allocation_request(partitions, 3);
+
+    perf_tests::start_measuring_time();
+    return f.allocator().allocate(std::move(req)).then([partitions](auto vals) {
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(vals);
+        return size_t(partitions);
+    });
+}
+
+} // namespace
+
+PERF_TEST_F(partition_allocator_fixture, allocation_1k_partitions_9_nodes) {
+    return allocate_large_topic(*this, 9, 1000);
+}
+
+PERF_TEST_F(partition_allocator_fixture, allocation_10k_partitions_9_nodes) {
+    return allocate_large_topic(*this, 9, 10000);
+}
+
+PERF_TEST_F(partition_allocator_fixture, allocation_10k_partitions_30_nodes) {
+    return allocate_large_topic(*this, 30, 10000);
+}
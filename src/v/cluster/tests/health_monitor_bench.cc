@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_tracker.h"
 
 #include <seastar/testing/perf_tests.hh>
 
@@ -109,3 +110,41 @@ PERF_TEST(node_health_report, deserialize_many_topics) {
 PERF_TEST(node_health_report, deserialize_many_topics_replicated_partitions) {
     bench_deserialize_node_health_report(50000, 3);
 }
+
+/// Serialize the reply to a request for the changes since the previous
+/// report, when every `changed_every`-th partition changed in the meantime.
+void bench_serialize_node_health_delta(
+  size_t num_topics, size_t partitions_per_topic, size_t changed_every) {
+    auto report = make_node_health_report(num_topics, partitions_per_topic)
+                    .to_in_memory();
+    cluster::health_report_tracker tracker;
+    auto acked = tracker.make_report(report, std::nullopt).report_version;
+
+    size_t i = 0;
+    for (auto& [_, partitions] : report.topics) {
+        for (auto& p : partitions) {
+            if (i++ % changed_every == 0) {
+                p.size_bytes += 1;
+            }
+        }
+    }
+
+    perf_tests::start_measuring_time();
+    auto delta = tracker.make_report(report, acked);
+    auto buf = iobuf();
+    do_bench_serialize_node_health_report(buf, delta);
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(node_health_report, serialize_delta_many_partitions) {
+    bench_serialize_node_health_delta(10, 5000, 100);
+}
+
+PERF_TEST(node_health_report, serialize_delta_many_topics) {
+    bench_serialize_node_health_delta(50000, 1, 100);
+}
+
+PERF_TEST(node_health_report, serialize_delta_many_topics_no_changes) {
+    bench_serialize_node_health_delta(50000, 1, 50001);
+}
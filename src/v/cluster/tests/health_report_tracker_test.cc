@@ -0,0 +1,188 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/health_monitor_types.h"
+#include "cluster/health_report_tracker.h"
+#include "model/metadata.h"
+
+#include <gtest/gtest.h>
+
+namespace cluster {
+namespace {
+
+model::topic_namespace topic(int i) {
+    return {model::ns("kafka"), model::topic(fmt::format("topic-{}", i))};
+}
+
+partition_status make_status(int id, size_t size = 100) {
+    return partition_status{
+      .id = model::partition_id(id),
+      .term = model::term_id(1),
+      .leader_id = model::node_id(1),
+      .revision_id = model::revision_id(1),
+      .size_bytes = size,
+      .under_replicated_replicas = 0,
+    };
+}
+
+node_health_report make_report(int topics, int partitions, size_t size = 100) {
+    chunked_vector<topic_status> statuses;
+    for (int t = 0; t < topics; ++t) {
+        partition_statuses_t parts;
+        for (int p = 0; p < partitions; ++p) {
+            parts.push_back(make_status(p, size));
+        }
+        statuses.emplace_back(topic(t), std::move(parts));
+    }
+    return {model::node_id(1), {}, std::move(statuses), std::nullopt};
+}
+
+partition_status& find_status(node_health_report& r, int t, int p) {
+    auto& parts = r.topics.find(topic(t))->second;
+    return *std::find_if(parts.begin(), parts.end(), [p](const auto& s) {
+        return s.id == model::partition_id(p);
+    });
+}
+
+size_t num_partitions(const chunked_vector<topic_status>& topics) {
+    size_t n = 0;
+    for (const auto& t : topics) {
+        n += t.partitions.size();
+    }
+    return n;
+}
+
+void expect_same(const node_health_report& a, const node_health_report& b) {
+    EXPECT_EQ(a.id, b.id);
+    EXPECT_EQ(a.local_state, b.local_state);
+    EXPECT_EQ(a.report_version, b.report_version);
+    ASSERT_EQ(a.topics.size(), b.topics.size());
+    for (const auto& [tp_ns, parts] : a.topics) {
+        auto it = b.topics.find(tp_ns);
+        ASSERT_NE(it, b.topics.end());
+        ASSERT_EQ(parts.size(), it->second.size());
+        for (const auto& status : parts) {
+            EXPECT_NE(
+              std::find(it->second.begin(), it->second.end(), status),
+              it->second.end());
+        }
+    }
+}
+
+} // namespace
+
+TEST(HealthReportTrackerTest, FullReportWithoutAckedVersion) {
+    health_report_tracker tracker;
+    auto report = make_report(3, 10);
+    auto reply = tracker.make_report(report, std::nullopt);
+    EXPECT_FALSE(reply.is_delta());
+    EXPECT_EQ(num_partitions(reply.topics), 30);
+    EXPECT_EQ(reply.report_version, tracker.current_version());
+}
+
+TEST(HealthReportTrackerTest, DeltaContainsOnlyChanges) {
+    health_report_tracker tracker;
+    auto report = make_report(3, 10);
+    auto base = std::move(tracker.make_report(report, std::nullopt))
+                  .to_in_memory();
+
+    // nothing changed
+    auto reply = tracker.make_report(report, base.report_version);
+    EXPECT_TRUE(reply.is_delta());
+    EXPECT_TRUE(reply.topics.empty());
+    EXPECT_TRUE(reply.removed_partitions.empty());
+    EXPECT_EQ(reply.report_version, base.report_version);
+
+    find_status(report, 0, 1).leader_id = model::node_id(2);
+    find_status(report, 1, 2).size_bytes = 200;
+    find_status(report, 2, 3).under_replicated_replicas = 1;
+
+    reply = tracker.make_report(report, base.report_version);
+    ASSERT_TRUE(reply.is_delta());
+    EXPECT_EQ(num_partitions(reply.topics), 3);
+    EXPECT_NE(reply.report_version, base.report_version);
+
+    auto applied = apply_node_health_delta(base, std::move(reply));
+    report.report_version = applied.report_version;
+    expect_same(applied, report);
+}
+
+TEST(HealthReportTrackerTest, DeltaContainsRemovedPartitions) {
+    health_report_tracker tracker;
+    auto report = make_report(2, 4);
+    auto base = std::move(tracker.make_report(report, std::nullopt))
+                  .to_in_memory();
+
+    auto changed = make_report(1, 2);
+    changed.topics.find(topic(0))->second.push_back(make_status(7));
+
+    auto reply = tracker.make_report(changed, base.report_version);
+    ASSERT_TRUE(reply.is_delta());
+    EXPECT_EQ(reply.removed_partitions.size(), 6);
+    EXPECT_EQ(num_partitions(reply.topics), 1);
+
+    auto applied = apply_node_health_delta(base, std::move(reply));
+    changed.report_version = applied.report_version;
+    expect_same(applied, changed);
+}
+
+TEST(HealthReportTrackerTest, DeltasAreCumulative) {
+    health_report_tracker tracker;
+    auto report = make_report(1, 10);
+    auto base = std::move(tracker.make_report(report, std::nullopt))
+                  .to_in_memory();
+
+    // the requester didn't ack the replies in between
+    for (int i = 0; i < 5; ++i) {
+        find_status(report, 0, i).size_bytes = 1000 + i;
+        tracker.make_report(report, base.report_version);
+    }
+    auto reply = tracker.make_report(report, base.report_version);
+    ASSERT_TRUE(reply.is_delta());
+    EXPECT_EQ(num_partitions(reply.topics), 5);
+
+    auto applied = apply_node_health_delta(base, std::move(reply));
+    report.report_version = applied.report_version;
+    expect_same(applied, report);
+}
+
+TEST(HealthReportTrackerTest, FullReportForUnknownVersion) {
+    health_report_tracker tracker;
+    health_report_tracker restarted;
+    auto report = make_report(1, 10);
+    auto base = std::move(tracker.make_report(report, std::nullopt))
+                  .to_in_memory();
+
+    // different epoch
+    auto reply = restarted.make_report(report, base.report_version);
+    EXPECT_FALSE(reply.is_delta());
+    EXPECT_EQ(num_partitions(reply.topics), 10);
+
+    // version from the future
+    auto future = base.report_version.value();
+    future.version += 10;
+    reply = tracker.make_report(report, future);
+    EXPECT_FALSE(reply.is_delta());
+}
+
+TEST(HealthReportTrackerTest, FullReportWhenRemovalsAreForgotten) {
+    health_report_tracker tracker;
+    auto report = make_report(1, 1000);
+    auto base = std::move(tracker.make_report(report, std::nullopt))
+                  .to_in_memory();
+
+    // more partitions are removed than the tracker remembers
+    auto reply = tracker.make_report(make_report(1, 1), base.report_version);
+    EXPECT_FALSE(reply.is_delta());
+    EXPECT_EQ(num_partitions(reply.topics), 1);
+}
+
+} // namespace cluster
@@ -102,8 +102,100 @@ void random_bench() {
     perf_tests::stop_measuring_time();
 }
 
+/*
+ * Cluster where every group has a unique id and the first groups led by the
+ * first shard of each node carry all the throughput, as with a few busy topics
+ * whose leaders ended up on the same cores.
+ */
+std::pair<
+  cluster::leader_balancer_strategy::index_type,
+  cluster::leader_balancer_types::group_load_t>
+make_skewed_cluster(int busy_groups_per_node) {
+    cluster::leader_balancer_strategy::index_type index;
+    cluster::leader_balancer_types::group_load_t group_load;
+
+    std::vector<model::broker_shard> shards;
+    for (auto n = 0; n < node_count; n++) {
+        for (auto s = 0; s < shards_per_node; s++) {
+            shards.push_back(
+              model::broker_shard{model::node_id(n), static_cast<uint32_t>(s)});
+        }
+    }
+
+    size_t replica = 0;
+    int64_t group = 0;
+    for (auto shard : shards) {
+        for (auto g = 0; g < groups_per_shard; g++, group++) {
+            std::vector<model::broker_shard> group_replicas{shard};
+            while (group_replicas.size() != static_cast<size_t>(replicas)) {
+                const auto& candidate = shards[replica++ % shards.size()];
+                if (candidate.node_id != shard.node_id) {
+                    group_replicas.push_back(candidate);
+                }
+            }
+            index[shard][raft::group_id(group)] = std::move(group_replicas);
+            if (shard.shard == 0 && g < busy_groups_per_node) {
+                group_load[raft::group_id(group)] = uint64_t(1) << 24;
+            } else {
+                group_load[raft::group_id(group)] = uint64_t(1) << 10;
+            }
+        }
+    }
+    return {std::move(index), std::move(group_load)};
+}
+
+/*
+ * Measures the time it takes the strategy balancing the observed throughput to
+ * spread the busy leaders of a skewed cluster.
+ */
+void skewed_throughput_bench(int busy_groups_per_node) {
+    auto [index, group_load] = make_skewed_cluster(busy_groups_per_node);
+    auto gid_topic = leader_balancer_test_utils::make_gid_to_topic_index(index);
+
+    perf_tests::start_measuring_time();
+    cluster::leader_balancer_types::random_hill_climbing_strategy strategy(
+      std::move(index),
+      std::move(gid_topic),
+      cluster::leader_balancer_types::muted_index{{}, {}},
+      std::nullopt,
+      std::move(group_load));
+
+    auto max_load = [&strategy] {
+        double ret = 0;
+        for (const auto& [_, load] : strategy.throughput_stats()) {
+            ret = std::max(ret, load);
+        }
+        return ret;
+    };
+    const auto initial_max_load = max_load();
+
+    size_t moves = 0;
+    cluster::leader_balancer_types::muted_groups_t skip;
+    while (auto movement = strategy.find_movement(skip)) {
+        strategy.apply_movement(*movement);
+        skip.add(static_cast<uint64_t>(movement->group));
+        ++moves;
+    }
+    perf_tests::stop_measuring_time();
+
+    vassert(
+      max_load() < initial_max_load,
+      "max shard load not reduced: {} -> {}",
+      initial_max_load,
+      max_load());
+    perf_tests::do_not_optimize(moves);
+}
+
 } // namespace
 
+PERF_TEST(lb, skewed_throughput_one_busy_group_per_node) {
+    skewed_throughput_bench(1);
+}
+
+PERF_TEST(lb, skewed_throughput_many_busy_groups_per_node) {
+    skewed_throughput_bench(shards_per_node * 2);
+}
+
 PERF_TEST(lb, random_eval_movement) {
     random_search_eval_bench<
       cluster::leader_balancer_types::random_reassignments>(false);
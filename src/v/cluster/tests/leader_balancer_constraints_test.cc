@@ -230,6 +230,61 @@ BOOST_AUTO_TEST_CASE(even_topic_no_error_even_shard_error) {
     BOOST_REQUIRE(even_shard_con.error() > 0);
 }
 
+BOOST_AUTO_TEST_CASE(even_shard_throughput_constraint_moves) {
+    // node 0 leads the two busy groups, node 1 only an idle one
+    auto [shard_index, muted_index] = from_spec(
+      {
+        {{1, 2}, {3}},
+        {{3}, {1, 2}},
+      },
+      {});
+
+    lbt::group_load_t group_load;
+    group_load[raft::group_id(1)] = 1000;
+    group_load[raft::group_id(2)] = 1000;
+
+    auto throughput_con = lbt::even_shard_throughput_constraint(
+      shard_index, std::move(group_load), 0.1);
+    BOOST_REQUIRE(throughput_con.error() > 0);
+
+    // moving an idle leader doesn't change the throughput balance
+    BOOST_REQUIRE(throughput_con.evaluate(re(3, 1, 0)) == 0);
+
+    // moving one of the busy leaders balances the throughput
+    auto rea = re(1, 0, 1);
+    BOOST_REQUIRE(throughput_con.evaluate(rea) > 0);
+    throughput_con.update_index(rea);
+    BOOST_REQUIRE(throughput_con.error() == 0);
+
+    // moving either busy leader now makes it worse, including moving back the
+    // leader that was just moved
+    BOOST_REQUIRE(throughput_con.evaluate(re(1, 1, 0)) < 0);
+    BOOST_REQUIRE(throughput_con.evaluate(re(2, 0, 1)) < 0);
+}
+
+BOOST_AUTO_TEST_CASE(even_shard_throughput_constraint_hysteresis) {
+    auto [shard_index, muted_index] = from_spec(
+      {
+        {{1, 2}, {}},
+        {{3}, {1, 2}},
+      },
+      {});
+
+    lbt::group_load_t group_load;
+    group_load[raft::group_id(1)] = 100;
+    group_load[raft::group_id(2)] = 1000;
+    group_load[raft::group_id(3)] = 700;
+
+    // moving group 1 improves the balance (1100/700 to 1000/800) but by less
+    // than the hysteresis band (half of the mean shard load), so it is
+    // neutral, as is moving it back
+    auto throughput_con = lbt::even_shard_throughput_constraint(
+      shard_index, std::move(group_load), 0.5);
+    BOOST_REQUIRE(throughput_con.evaluate(re(1, 0, 1)) == 0);
+    throughput_con.update_index(re(1, 0, 1));
+    BOOST_REQUIRE(throughput_con.evaluate(re(1, 1, 0)) == 0);
+}
+
 #include "cluster/scheduling/leader_balancer_random.h"
 
 BOOST_AUTO_TEST_CASE(random_reassignments_generation) {
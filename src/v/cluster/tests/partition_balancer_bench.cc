@@ -101,3 +101,61 @@ PERF_TEST_C(partition_balancer_planner_fixture, counts_rebalancing) {
       reassignments.size(),
       imbalances);
 }
+
+namespace {
+// The same node reports as if the nodes replied with an unchanged version
+cluster::cluster_health_report
+with_unchanged_versions(const cluster::cluster_health_report& hr) {
+    cluster::cluster_health_report ret;
+    for (const auto& report : hr.node_reports) {
+        auto copy = ss::make_lw_shared<cluster::node_health_report>(
+          report->copy());
+        copy->report_version = cluster::node_health_report_version{
+          .epoch = 1, .version = 1};
+        ret.node_reports.emplace_back(std::move(copy));
+    }
+    return ret;
+}
+} // namespace
+
+PERF_TEST_C(partition_balancer_planner_fixture, cached_state_replanning) {
+    static bool initialized = false;
+    // ~500k replicas
+    constexpr int partitions = 170000;
+    const size_t max_concurrent_actions = 50;
+    uint64_t local_partition_size = 10_KiB;
+    if (!initialized) {
+        ss::thread_attributes thread_attr;
+        co_await ss::async(thread_attr, [this] {
+            allocator_register_nodes(3);
+            create_topic("topic-1", partitions, 3);
+            allocator_register_nodes(2);
+        });
+
+        std::set<size_t> unavailable_nodes = {0};
+        co_await populate_node_status_table(unavailable_nodes);
+
+        // the first tick fills the cache
+        auto hr = with_unchanged_versions(
+          create_health_report({}, {}, local_partition_size));
+        abort_source as;
+        co_await make_planner(planner_cache, max_concurrent_actions)
+          .plan_actions(hr, as);
+        initialized = true;
+    }
+
+    auto hr = with_unchanged_versions(
+      create_health_report({}, {}, local_partition_size));
+    auto planner = make_planner(planner_cache, max_concurrent_actions);
+
+    abort_source as;
+    perf_tests::start_measuring_time();
+    auto plan_data = co_await planner.plan_actions(hr, as);
+    perf_tests::stop_measuring_time();
+
+    const auto& reassignments = plan_data.reassignments;
+    vassert(
+      reassignments.size() == max_concurrent_actions,
+      "unexpected reassignments size: {}",
+      reassignments.size());
+}
@@ -176,27 +176,48 @@ public:
 };
 
 struct partition_balancer_planner_fixture {
+    cluster::planner_config make_planner_config(
+      model::partition_autobalancing_mode mode
+      = model::partition_autobalancing_mode::continuous,
+      size_t max_concurrent_actions = 2,
+      bool request_ondemand_rebalance = false) {
+        return cluster::planner_config{
+          .mode = mode,
+          .soft_max_disk_usage_ratio = 0.8,
+          .hard_max_disk_usage_ratio = 0.95,
+          .max_concurrent_actions = max_concurrent_actions,
+          .node_availability_timeout_sec = std::chrono::minutes(1),
+          .ondemand_rebalance_requested = request_ondemand_rebalance,
+          .segment_fallocation_step = 16,
+          .node_responsiveness_timeout = std::chrono::seconds(10),
+          .topic_aware = true,
+        };
+    }
+
     cluster::partition_balancer_planner make_planner(
       model::partition_autobalancing_mode mode
       = model::partition_autobalancing_mode::continuous,
       size_t max_concurrent_actions = 2,
       bool request_ondemand_rebalance = false) {
         return cluster::partition_balancer_planner(
-          cluster::planner_config{
-            .mode = mode,
-            .soft_max_disk_usage_ratio = 0.8,
-            .hard_max_disk_usage_ratio = 0.95,
-            .max_concurrent_actions = max_concurrent_actions,
-            .node_availability_timeout_sec = std::chrono::minutes(1),
-            .ondemand_rebalance_requested = request_ondemand_rebalance,
-            .segment_fallocation_step = 16,
-            .node_responsiveness_timeout = std::chrono::seconds(10),
-            .topic_aware = true,
-          },
+          make_planner_config(
+            mode, max_concurrent_actions, request_ondemand_rebalance),
           workers.state.local(),
           workers.allocator.local());
     }
 
+    cluster::partition_balancer_planner make_planner(
+      cluster::partition_balancer_planner_cache& cache,
+      size_t max_concurrent_actions = 2) {
+        return cluster::partition_balancer_planner(
+          make_planner_config(
+            model::partition_autobalancing_mode::continuous,
+            max_concurrent_actions),
+          workers.state.local(),
+          workers.allocator.local(),
+          cache);
+    }
+
     model::topic_namespace make_tp_ns(const ss::sstring& tp) {
         return {test_ns, model::topic(tp)};
     }
@@ -412,4 +433,6 @@ struct partition_balancer_planner_fixture {
     controller_workers workers;
     int last_node_idx{};
     ss::abort_source as;
+    // planner state kept between the ticks
+    cluster::partition_balancer_planner_cache planner_cache;
 };
@@ -120,6 +120,57 @@ FIXTURE_TEST(test_node_down, partition_balancer_planner_fixture) {
     check_expected_assignments(new_replicas, expected_nodes);
 }
 
+/*
+ * Planning with the sizes and counts cached by the previous ticks gives the
+ * same results as planning from scratch after the topics and the health report
+ * change.
+ */
+FIXTURE_TEST(test_cached_planning_state, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_cached_planning_state");
+    allocator_register_nodes(3);
+    create_topic("topic-1", 2, 3);
+    allocator_register_nodes(1);
+
+    std::set<size_t> unavailable_nodes = {0};
+    populate_node_status_table(unavailable_nodes).get();
+
+    const size_t max_concurrent_actions = 10;
+    cluster::partition_balancer_planner_cache cache;
+    auto planned_ntps = [](const auto& plan_data) {
+        std::set<model::ntp> ntps;
+        for (const auto& r : plan_data.reassignments) {
+            ntps.insert(r.ntp);
+        }
+        return ntps;
+    };
+    auto check_plan = [&](
+                        const cluster::cluster_health_report& hr,
+                        size_t expected) {
+        auto cached = make_planner(cache, max_concurrent_actions)
+                        .plan_actions(hr, as)
+                        .get();
+        auto fresh = make_planner(
+                       model::partition_autobalancing_mode::continuous,
+                       max_concurrent_actions)
+                       .plan_actions(hr, as)
+                       .get();
+        BOOST_REQUIRE_EQUAL(cached.reassignments.size(), expected);
+        BOOST_REQUIRE(planned_ntps(cached) == planned_ntps(fresh));
+    };
+
+    auto hr = create_health_report();
+    check_plan(hr, 2);
+    // nothing changed
+    check_plan(hr, 2);
+
+    create_topic("topic-2", {{n(0), n(1), n(2)}, {n(1), n(2), n(3)}});
+    // sizes of topic-2 aren't reported yet
+    check_plan(hr, 2);
+
+    hr = create_health_report();
+    check_plan(hr, 3);
+}
+
 /*
  * 4 nodes; 1 topic; 2 nodes down
  * Actual
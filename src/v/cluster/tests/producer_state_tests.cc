@@ -56,7 +56,8 @@ struct test_fixture {
         _psm = std::make_unique<producer_state_manager>(
           config::mock_binding<size_t>(max_producers),
           config::mock_binding(std::chrono::milliseconds::max()),
-          config::mock_binding<size_t>(min_producers_per_vcluster));
+          config::mock_binding<size_t>(min_producers_per_vcluster),
+          config::mock_binding<uint64_t>(0));
         _psm->start().get();
         validate_producer_count(0);
         validate_namespace_count(0);
@@ -31,6 +31,7 @@ struct rm_stm_test_fixture : simple_raft_fixture {
               [this] { return max_concurent_producers.local().bind(); }),
             ss::sharded_parameter(
               [this] { return producer_expiration_ms.local().bind(); }),
+            config::mock_binding(std::numeric_limits<uint64_t>::max()),
             config::mock_binding(std::numeric_limits<uint64_t>::max()))
           .get();
         producer_state_manager
@@ -256,6 +256,80 @@ FIXTURE_TEST(test_tx_aborted_tx_1, rm_stm_test_fixture) {
     check_snapshot_sizes(stm, _raft.get());
 }
 
+// tests:
+//   - aborted_transactions only returns the ranges intersecting the
+//     requested offsets
+FIXTURE_TEST(test_tx_aborted_tx_range_lookup, rm_stm_test_fixture) {
+    create_stm_and_start_raft();
+    auto& stm = *_stm;
+    stm.testing_only_disable_auto_abort();
+
+    stm.start().get();
+
+    wait_for_confirmed_leader();
+    wait_for_meta_initialized();
+
+    auto abort_tx = [&](model::producer_identity pid) {
+        auto tx_seq = model::tx_seq(0);
+        auto term_op = stm
+                         .begin_tx(
+                           pid,
+                           tx_seq,
+                           std::chrono::milliseconds(
+                             std::numeric_limits<int32_t>::max()),
+                           model::partition_id(0))
+                         .get();
+        BOOST_REQUIRE((bool)term_op);
+        auto rreader = make_rreader(pid, 0, 5, true);
+        auto offset_r = stm
+                          .replicate(
+                            rreader.id,
+                            std::move(rreader.batches),
+                            raft::replicate_options(
+                              raft::consistency_level::quorum_ack))
+                          .get();
+        BOOST_REQUIRE((bool)offset_r);
+        auto op = stm.abort_tx(pid, tx_seq, 2'000ms).get();
+        BOOST_REQUIRE_EQUAL(op, cluster::tx::errc::none);
+        BOOST_REQUIRE(stm
+                        .wait_no_throw(
+                          _raft.get()->committed_offset(),
+                          model::timeout_clock::now() + 2'000ms)
+                        .get());
+        return offset_r.value().last_offset();
+    };
+
+    auto pid1 = model::producer_identity{1, 0};
+    auto pid2 = model::producer_identity{2, 0};
+    auto first_tx_last = abort_tx(pid1);
+    auto second_tx_last = abort_tx(pid2);
+
+    auto all = stm.aborted_transactions(
+                    model::offset(0), model::offset::max())
+                 .get();
+    BOOST_REQUIRE_EQUAL(all.size(), 2);
+
+    auto after_first = stm
+                         .aborted_transactions(
+                           model::next_offset(first_tx_last),
+                           model::offset::max())
+                         .get();
+    BOOST_REQUIRE_EQUAL(after_first.size(), 1);
+    BOOST_REQUIRE_EQUAL(after_first[0].pid, pid2);
+
+    auto up_to_first = stm.aborted_transactions(model::offset(0), first_tx_last)
+                         .get();
+    BOOST_REQUIRE_EQUAL(up_to_first.size(), 1);
+    BOOST_REQUIRE_EQUAL(up_to_first[0].pid, pid1);
+
+    auto after_all = stm
+                       .aborted_transactions(
+                         model::next_offset(second_tx_last),
+                         model::offset::max())
+                       .get();
+    BOOST_REQUIRE_EQUAL(after_all.size(), 0);
+}
+
 // tests:
 //   - a simple tx aborting after prepare succeeds
 //   - an aborted tx is reflected in aborted_transactions
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/topic_change_log.h"
+#include "model/metadata.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+namespace cluster {
+namespace {
+
+model::topic_namespace topic(int i) {
+    return {model::ns("kafka"), model::topic(fmt::format("topic-{}", i))};
+}
+
+std::optional<std::set<model::topic_namespace>>
+changes_since(const topic_change_log& log, uint64_t since) {
+    std::set<model::topic_namespace> ret;
+    if (!log.for_each_change_since(since, [&ret](auto tp_ns) {
+            ret.emplace(tp_ns);
+        })) {
+        return std::nullopt;
+    }
+    return ret;
+}
+
+} // namespace
+
+TEST(TopicChangeLogTest, ChangesSinceRevision) {
+    topic_change_log log;
+    EXPECT_EQ(log.revision(), 0);
+    EXPECT_EQ(changes_since(log, 0)->size(), 0);
+
+    log.record(topic(0));
+    const auto first = log.revision();
+    log.record(topic(1));
+    log.record(topic(1));
+    log.record(topic(2));
+
+    using set_t = std::set<model::topic_namespace>;
+    EXPECT_EQ(changes_since(log, 0), (set_t{topic(0), topic(1), topic(2)}));
+    EXPECT_EQ(changes_since(log, first), (set_t{topic(1), topic(2)}));
+    EXPECT_EQ(changes_since(log, log.revision()), set_t{});
+    // revision from the future
+    EXPECT_FALSE(changes_since(log, log.revision() + 1));
+}
+
+TEST(TopicChangeLogTest, TruncatedLog) {
+    topic_change_log log(3);
+    for (int i = 0; i < 5; ++i) {
+        log.record(topic(i));
+    }
+    EXPECT_FALSE(changes_since(log, 0));
+    EXPECT_FALSE(changes_since(log, 1));
+    EXPECT_EQ(changes_since(log, 2)->size(), 3);
+}
+
+TEST(TopicChangeLogTest, RecordAll) {
+    topic_change_log log;
+    log.record(topic(0));
+    const auto before = log.revision();
+    log.record_all();
+    EXPECT_FALSE(changes_since(log, before));
+    EXPECT_EQ(changes_since(log, log.revision())->size(), 0);
+}
+
+} // namespace cluster
@@ -147,6 +147,73 @@ FIXTURE_TEST(test_conflicts, topic_table_fixture) {
     BOOST_REQUIRE_EQUAL(deltas.size(), 0);
 }
 
+FIXTURE_TEST(test_bulk_create, topic_table_fixture) {
+    std::vector<cluster::topic_table_topic_delta> topic_deltas;
+    table.local().register_topic_delta_notification([&](const auto& d) {
+        topic_deltas.insert(topic_deltas.end(), d.begin(), d.end());
+    });
+
+    std::vector<cluster::topic_table_ntp_delta> deltas;
+    table.local().register_ntp_delta_notification(
+      [&](const auto& d) { deltas.insert(deltas.end(), d.begin(), d.end()); });
+
+    cluster::bulk_create_topics_cmd_data data;
+    data.topics.push_back(make_tp_configuration("bulk_1", 3, 3));
+    data.topics.push_back(make_tp_configuration("bulk_2", 5, 1));
+    auto res = table.local()
+                 .apply(
+                   cluster::bulk_create_topics_cmd(0, std::move(data)),
+                   model::offset(10))
+                 .get();
+    BOOST_REQUIRE_EQUAL(res, cluster::errc::success);
+
+    auto& md = table.local().all_topics_metadata();
+    BOOST_REQUIRE_EQUAL(md.size(), 2);
+    BOOST_REQUIRE_EQUAL(
+      md.find(make_tp_ns("bulk_1"))->second.get_assignments().size(), 3);
+    BOOST_REQUIRE_EQUAL(
+      md.find(make_tp_ns("bulk_2"))->second.get_assignments().size(), 5);
+    BOOST_REQUIRE_EQUAL(
+      md.find(make_tp_ns("bulk_2"))->second.get_revision(),
+      model::revision_id(10));
+
+    validate_topic_deltas(topic_deltas, 2, 0);
+    validate_ntp_deltas(deltas, 8, 0);
+}
+
+FIXTURE_TEST(test_bulk_create_conflicts, topic_table_fixture) {
+    create_topics();
+
+    std::vector<cluster::topic_table_ntp_delta> deltas;
+    table.local().register_ntp_delta_notification(
+      [&](const auto& d) { deltas.insert(deltas.end(), d.begin(), d.end()); });
+
+    // one of the topics exists, none of them is created
+    cluster::bulk_create_topics_cmd_data data;
+    data.topics.push_back(make_tp_configuration("bulk_1", 3, 3));
+    data.topics.push_back(make_tp_configuration("test_tp_1", 2, 3));
+    auto res = table.local()
+                 .apply(
+                   cluster::bulk_create_topics_cmd(0, std::move(data)),
+                   model::offset(10))
+                 .get();
+    BOOST_REQUIRE_EQUAL(res, cluster::errc::topic_already_exists);
+
+    // the same topic twice in a single command
+    cluster::bulk_create_topics_cmd_data duplicated;
+    duplicated.topics.push_back(make_tp_configuration("bulk_2", 1, 1));
+    duplicated.topics.push_back(make_tp_configuration("bulk_2", 1, 1));
+    res = table.local()
+            .apply(
+              cluster::bulk_create_topics_cmd(0, std::move(duplicated)),
+              model::offset(11))
+            .get();
+    BOOST_REQUIRE_EQUAL(res, cluster::errc::topic_already_exists);
+
+    BOOST_REQUIRE_EQUAL(table.local().all_topics_metadata().size(), 3);
+    BOOST_REQUIRE_EQUAL(deltas.size(), 0);
+}
+
 FIXTURE_TEST(get_getting_config, topic_table_fixture) {
     create_topics();
     auto cfg = table.local().get_topic_cfg(make_tp_ns("test_tp_1"));
@@ -15,10 +15,12 @@
 #include "kafka/protocol/types.h"
 #include "model/record.h"
 #include "raft/errc.h"
+#include "ssx/future-util.h"
 #include "storage/record_batch_builder.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/bool_class.hh>
 
 #include <absl/container/btree_set.h>
@@ -35,6 +37,92 @@ tm_stm::replicate_quorum_ack(model::term_id term, model::record_batch&& batch) {
     return _raft->replicate(term, std::move(batch), opts);
 }
 
+ss::future<result<raft::replicate_result>>
+tm_stm::replicate_tx_batch(model::term_id term, model::record_batch batch) {
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<result<raft::replicate_result>>(
+          make_error_code(raft::errc::shutting_down));
+    }
+    auto& pending = _pending_tx_batches.emplace_back(
+      pending_tx_batch{.term = term, .batch = std::move(batch)});
+    auto f = pending.result.get_future();
+    if (!_replicating_tx_batches) {
+        _replicating_tx_batches = true;
+        ssx::spawn_with_gate(
+          _gate, [this] { return replicate_pending_tx_batches(); });
+    }
+    return f;
+}
+
+ss::future<> tm_stm::replicate_pending_tx_batches() {
+    using ret_t = result<raft::replicate_result>;
+    while (!_pending_tx_batches.empty()) {
+        auto pending = std::exchange(_pending_tx_batches, {});
+        auto it = pending.begin();
+        while (it != pending.end()) {
+            // batches of a single term are replicated together
+            auto run_end = std::find_if(it, pending.end(), [it](const auto& p) {
+                return p.term != it->term;
+            });
+            chunked_vector<model::record_batch> batches;
+            chunked_vector<std::pair<ss::promise<ret_t>, int32_t>> waiters;
+            for (auto b_it = it; b_it != run_end; ++b_it) {
+                waiters.emplace_back(
+                  std::move(b_it->result), b_it->batch.record_count());
+                batches.push_back(std::move(b_it->batch));
+            }
+            vlog(
+              _ctx_log.trace,
+              "replicating {} transaction updates in term {}",
+              batches.size(),
+              it->term);
+            auto opts = raft::replicate_options{
+              raft::consistency_level::quorum_ack};
+            opts.set_force_flush();
+            auto stages = _raft->replicate_in_stages(
+              it->term, std::move(batches), opts);
+            it = run_end;
+
+            // waiting for the request to be enqueued keeps the updates in
+            // order while the next group accumulates, a failure is reported
+            // by the finished stage as well
+            auto enqueued = co_await ss::coroutine::as_future(
+              std::move(stages.request_enqueued));
+            enqueued.ignore_ready_future();
+            ssx::background
+              = std::move(stages.replicate_finished)
+                  .then_wrapped(
+                    [waiters = std::move(waiters)](
+                      ss::future<ret_t> f) mutable {
+                        if (f.failed()) {
+                            auto e = f.get_exception();
+                            for (auto& [promise, _] : waiters) {
+                                promise.set_exception(e);
+                            }
+                            return;
+                        }
+                        auto r = f.get();
+                        if (!r) {
+                            for (auto& [promise, _] : waiters) {
+                                promise.set_value(r.error());
+                            }
+                            return;
+                        }
+                        // the batches are contiguous, walk back from the
+                        // end to find the last offset of each one
+                        auto last_offset = r.value().last_offset;
+                        for (size_t i = waiters.size(); i-- > 0;) {
+                            auto& [promise, records] = waiters[i];
+                            promise.set_value(
+                              raft::replicate_result{last_offset});
+                            last_offset = last_offset - model::offset(records);
+                        }
+                    });
+        }
+    }
+    _replicating_tx_batches = false;
+}
+
 model::record_batch tm_stm::serialize_tx(tx_metadata tx) {
     iobuf key;
     reflection::serialize(key, model::record_batch_type::tm_update);
@@ -231,7 +319,7 @@ tm_stm::replicate_tx_update(tx_metadata tx, model::term_id term) {
       term);
     auto batch = serialize_tx(tx);
 
-    auto r = co_await replicate_quorum_ack(term, std::move(batch));
+    auto r = co_await replicate_tx_batch(term, std::move(batch));
     if (!r) {
         vlog(
           _ctx_log.info,
@@ -27,6 +27,7 @@
 #include "storage/ntp_config.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/future.hh>
 #include <seastar/core/sharded.hh>
 
 #include <absl/container/btree_set.h>
@@ -390,6 +391,10 @@ private:
     ss::future<result<raft::replicate_result>>
     replicate_quorum_ack(model::term_id term, model::record_batch&& batch);
 
+    ss::future<result<raft::replicate_result>>
+      replicate_tx_batch(model::term_id, model::record_batch);
+    ss::future<> replicate_pending_tx_batches();
+
     model::record_batch serialize_tx(tx_metadata tx);
 
     void upsert_transaction(tx_metadata);
@@ -443,6 +448,17 @@ private:
 
     chunked_hash_map<kafka::transactional_id, tx_wrapper> _transactions;
 
+    struct pending_tx_batch {
+        model::term_id term;
+        model::record_batch batch;
+        ss::promise<result<raft::replicate_result>> result;
+    };
+    // Transaction updates are replicated in groups, the updates requested
+    // while the previous group is being enqueued in raft are replicated
+    // together with a single raft request and a single flush.
+    chunked_vector<pending_tx_batch> _pending_tx_batches;
+    bool _replicating_tx_batches{false};
+
     mutex _tx_thrashing_lock{"tm_stm::tx_thrashing_lock"};
     prefix_logger _ctx_log;
 };
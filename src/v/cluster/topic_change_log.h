@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/metadata.h"
+
+#include <deque>
+
+namespace cluster {
+
+/**
+ * Bounded log of the topics modified in a metadata table. Readers caching data
+ * derived from the table remember the revision they are up to date with and
+ * refresh only the topics changed since then.
+ *
+ * Once the log is full the oldest entries are dropped, readers based on a
+ * revision from before the dropped entries have to refresh everything.
+ */
+class topic_change_log {
+public:
+    static constexpr size_t default_max_entries = 10'000;
+
+    explicit topic_change_log(size_t max_entries = default_max_entries)
+      : _max_entries(max_entries) {}
+
+    /// Revision of the last change, starts at 0
+    uint64_t revision() const { return _revision; }
+
+    void record(model::topic_namespace_view tp_ns) {
+        // consecutive changes of the same topic are common, e.g. leadership
+        // of all the partitions of a topic moving at once
+        if (!_entries.empty() && _entries.back().second == tp_ns) {
+            _entries.back().first = ++_revision;
+            return;
+        }
+        _entries.emplace_back(++_revision, model::topic_namespace(tp_ns));
+        if (_entries.size() > _max_entries) {
+            _floor = _entries.front().first;
+            _entries.pop_front();
+        }
+    }
+
+    /// Records a change of every topic
+    void record_all() {
+        _entries.clear();
+        _floor = ++_revision;
+    }
+
+    /**
+     * Calls \p f with every topic changed after revision \p since, a topic may
+     * be passed more than once. Returns false without calling \p f if the
+     * changes are no longer known and the caller must assume that everything
+     * changed.
+     */
+    template<typename Func>
+    bool for_each_change_since(uint64_t since, Func&& f) const {
+        if (since < _floor || since > _revision) {
+            return false;
+        }
+        // entries are ordered by revision, most readers are close to the end
+        for (auto it = _entries.rbegin();
+             it != _entries.rend() && it->first > since;
+             ++it) {
+            f(model::topic_namespace_view(it->second));
+        }
+        return true;
+    }
+
+private:
+    size_t _max_entries;
+    uint64_t _revision{0};
+    // changes up to and including this revision are no longer in the log
+    uint64_t _floor{0};
+    std::deque<std::pair<uint64_t, model::topic_namespace>> _entries;
+};
+
+} // namespace cluster
@@ -26,6 +26,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <algorithm>
 #include <optional>
 #include <span>
@@ -39,52 +41,58 @@ topic_table::topic_table(
   : _probe(*this)
   , _migrated_resources(migrated_resources) {}
 
-ss::future<std::error_code>
-topic_table::apply(create_topic_cmd cmd, model::offset offset) {
-    _last_applied_revision_id = model::revision_id(offset);
-    if (_topics.contains(cmd.key)) {
+std::error_code topic_table::validate_new_topic(
+  const model::topic_namespace& tp_ns,
+  const topic_configuration_assignment& cfg) const {
+    if (_topics.contains(tp_ns)) {
         // topic already exists
-        co_return errc::topic_already_exists;
+        return errc::topic_already_exists;
     }
 
-    const auto migration_state = _migrated_resources.get_topic_state(cmd.key);
+    const auto migration_state = _migrated_resources.get_topic_state(tp_ns);
     if (
-      !cmd.value.cfg.is_migrated
+      !cfg.cfg.is_migrated
       && migration_state
            != data_migrations::migrated_resource_state::non_restricted) {
-        vlog(clusterlog.debug, "topic {} already migrated", cmd.key);
-        co_return errc::topic_already_exists;
+        vlog(clusterlog.debug, "topic {} already migrated", tp_ns);
+        return errc::topic_already_exists;
     }
 
-    if (!schema_id_validation_validator::is_valid(cmd.value.cfg.properties)) {
-        co_return schema_id_validation_validator::ec;
+    if (!schema_id_validation_validator::is_valid(cfg.cfg.properties)) {
+        return schema_id_validation_validator::ec;
     }
 
-    if (!topic_multi_property_validation(cmd.value.cfg.properties)) {
-        co_return errc::topic_invalid_config;
+    if (!topic_multi_property_validation(cfg.cfg.properties)) {
+        return errc::topic_invalid_config;
     }
+    return errc::success;
+}
 
+void topic_table::add_topic(
+  model::topic_namespace tp_ns,
+  topic_configuration_assignment cfg,
+  model::offset offset) {
     std::optional<model::initial_revision_id> remote_revision
-      = cmd.value.cfg.properties.remote_topic_properties
+      = cfg.cfg.properties.remote_topic_properties
           ? std::make_optional(
-              cmd.value.cfg.properties.remote_topic_properties->remote_revision)
+              cfg.cfg.properties.remote_topic_properties->remote_revision)
           : std::nullopt;
     auto md = topic_metadata_item{
       .metadata = topic_metadata(
-        std::move(cmd.value), model::revision_id(offset()), remote_revision)};
+        std::move(cfg), model::revision_id(offset()), remote_revision)};
 
     // generate deltas
 
     _pending_topic_deltas.emplace_back(
       md.get_revision(),
-      cmd.key,
+      tp_ns,
       model::revision_id{offset},
       topic_table_topic_delta_type::added);
 
-    md.partitions.reserve(cmd.value.assignments.size());
+    md.partitions.reserve(md.get_assignments().size());
     auto rev_id = model::revision_id{offset};
     for (auto& pas : md.get_assignments()) {
-        auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, pas.second.id);
+        auto ntp = model::ntp(tp_ns.ns, tp_ns.tp, pas.second.id);
         replicas_revision_map replica_revisions;
         _partition_count++;
         for (auto& r : pas.second.replicas) {
@@ -103,11 +111,51 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
     }
 
     _topics.insert({
-      cmd.key,
+      tp_ns,
       std::move(md),
     });
     _topics_map_revision++;
-    _probe.handle_topic_creation(std::move(cmd.key));
+    _probe.handle_topic_creation(std::move(tp_ns));
+}
+
+ss::future<std::error_code>
+topic_table::apply(create_topic_cmd cmd, model::offset offset) {
+    _last_applied_revision_id = model::revision_id(offset);
+    if (auto ec = validate_new_topic(cmd.key, cmd.value); ec) {
+        co_return ec;
+    }
+
+    add_topic(std::move(cmd.key), std::move(cmd.value), offset);
+
+    co_await notify_waiters();
+
+    co_return errc::success;
+}
+
+ss::future<std::error_code>
+topic_table::apply(bulk_create_topics_cmd cmd, model::offset offset) {
+    _last_applied_revision_id = model::revision_id(offset);
+
+    // validate all the topics first so that either all or none of them are
+    // created
+    absl::flat_hash_set<model::topic_namespace_view> names;
+    names.reserve(cmd.value.topics.size());
+    for (const auto& t : cmd.value.topics) {
+        if (!names.insert(model::topic_namespace_view(t.cfg.tp_ns)).second) {
+            co_return errc::topic_already_exists;
+        }
+        if (auto ec = validate_new_topic(t.cfg.tp_ns, t); ec) {
+            co_return ec;
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    names.clear();
+
+    for (auto& t : cmd.value.topics) {
+        auto tp_ns = t.cfg.tp_ns;
+        add_topic(std::move(tp_ns), std::move(t), offset);
+        co_await ss::coroutine::maybe_yield();
+    }
 
     co_await notify_waiters();
 
@@ -1631,6 +1679,13 @@ void topic_table::reset_partitions_to_force_reconfigure(
 }
 
 ss::future<> topic_table::notify_waiters() {
+    for (const auto& d : _pending_topic_deltas) {
+        _topic_changes.record(d.ns_tp);
+    }
+    for (const auto& d : _pending_ntp_deltas) {
+        _topic_changes.record(model::topic_namespace_view(d.ntp));
+    }
+
     if (!_pending_topic_deltas.empty()) {
         for (auto& cb : _topic_notifications) {
             cb.second(_pending_topic_deltas);
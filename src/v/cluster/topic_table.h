@@ -14,6 +14,7 @@
 #include "cluster/commands.h"
 #include "cluster/fwd.h"
 #include "cluster/notification.h"
+#include "cluster/topic_change_log.h"
 #include "cluster/topic_table_probe.h"
 #include "container/chunked_hash_map.h"
 #include "container/contiguous_range_map.h"
@@ -397,6 +398,7 @@ public:
       apply(set_topic_partitions_disabled_cmd, model::offset);
     ss::future<std::error_code>
       apply(bulk_force_reconfiguration_cmd, model::offset);
+    ss::future<std::error_code> apply(bulk_create_topics_cmd, model::offset);
 
     ss::future<> fill_snapshot(controller_snapshot&) const;
     ss::future<>
@@ -556,6 +558,10 @@ public:
         return _last_applied_revision_id;
     }
 
+    /// Topics whose metadata changed, recorded when the deltas are delivered
+    /// to the notification subscribers.
+    const topic_change_log& topic_changes() const { return _topic_changes; }
+
     // does not include non-replicable partitions
     size_t partition_count() const { return _partition_count; }
 
@@ -684,6 +690,12 @@ private:
 
     class snapshot_applier;
 
+    std::error_code validate_new_topic(
+      const model::topic_namespace&,
+      const topic_configuration_assignment&) const;
+    void add_topic(
+      model::topic_namespace, topic_configuration_assignment, model::offset);
+
     ss::future<std::error_code> do_local_delete(
       model::topic_namespace nt, model::offset offset, bool ignore_migration);
     ss::future<std::error_code>
@@ -732,6 +744,7 @@ private:
       _topic_notifications;
 
     fragmented_vector<ntp_delta> _pending_ntp_deltas;
+    topic_change_log _topic_changes;
     cluster::notification_id_type _ntp_notification_id{0};
     cluster::notification_id_type _lw_ntp_notification_id{0};
     std::vector<std::pair<cluster::notification_id_type, ntp_delta_cb_t>>
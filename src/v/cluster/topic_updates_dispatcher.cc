@@ -133,6 +133,40 @@ ss::future<std::error_code> topic_updates_dispatcher::apply(
     co_return ec;
 }
 
+ss::future<std::error_code> topic_updates_dispatcher::apply(
+  bulk_create_topics_cmd command, model::offset offset) {
+    chunked_vector<model::topic_namespace> topics;
+    topics.reserve(command.value.topics.size());
+    for (const auto& t : command.value.topics) {
+        topics.push_back(t.cfg.tp_ns);
+    }
+
+    auto ec = co_await dispatch_updates_to_cores(std::move(command), offset);
+    if (ec != errc::success) {
+        co_return ec;
+    }
+
+    // use the assignments from the topic table rather than keeping a copy of
+    // the whole command around
+    for (const auto& tp_ns : topics) {
+        auto md = _topic_table.local().get_topic_metadata_ref(tp_ns);
+        vassert(md, "topic {} created by the bulk command not found", tp_ns);
+        co_await handle_created_topic(tp_ns, md->get().get_assignments());
+    }
+    co_return errc::success;
+}
+
+ss::future<> topic_updates_dispatcher::handle_created_topic(
+  const model::topic_namespace& tp_ns, const assignments_set& assignments) {
+    for (const auto& [_, p_as] : assignments) {
+        _partition_allocator.local().add_allocations_for_new_partition(
+          p_as.replicas, p_as.group);
+        _partition_balancer_state.local().handle_ntp_move_begin_or_cancel(
+          tp_ns.ns, tp_ns.tp, p_as.id, {}, p_as.replicas);
+        co_await ss::coroutine::maybe_yield();
+    }
+}
+
 ss::future<std::error_code>
 topic_updates_dispatcher::apply(delete_topic_cmd cmd, model::offset offset) {
     // Legacy delete commands never create tombstones, so revision
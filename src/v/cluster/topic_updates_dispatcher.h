@@ -75,7 +75,8 @@ public:
       force_partition_reconfiguration_cmd,
       update_partition_replicas_cmd,
       set_topic_partitions_disabled_cmd,
-      bulk_force_reconfiguration_cmd>();
+      bulk_force_reconfiguration_cmd,
+      bulk_create_topics_cmd>();
 
     bool is_batch_applicable(const model::record_batch& batch) const {
         return batch.header().type
@@ -112,12 +113,16 @@ private:
       apply(set_topic_partitions_disabled_cmd, model::offset);
     ss::future<std::error_code>
       apply(bulk_force_reconfiguration_cmd, model::offset);
+    ss::future<std::error_code> apply(bulk_create_topics_cmd, model::offset);
 
     using ntp_leader = std::pair<model::ntp, model::node_id>;
 
     template<typename T>
     void add_allocations_for_new_partitions(const T&);
 
+    ss::future<> handle_created_topic(
+      const model::topic_namespace&, const assignments_set&);
+
     void update_allocations_for_reconfiguration(
       const std::vector<model::broker_shard>& previous,
       const std::vector<model::broker_shard>& target);
@@ -353,6 +353,12 @@ ss::future<std::vector<topic_result>> topics_frontend::create_topics(
               return ss::make_ready_future<std::vector<topic_result>>(
                 make_error_topic_results(topics, errc::not_leader_controller));
           }
+          if (
+            topics.size() > 1
+            && _features.local().is_active(
+              features::feature::bulk_create_topics)) {
+              return do_create_topics_in_bulk(std::move(topics), timeout);
+          }
           std::vector<ss::future<topic_result>> futures;
           futures.reserve(topics.size());
 
@@ -642,6 +648,21 @@ topic_result topics_frontend::validate_topic_configuration(
 ss::future<topic_result> topics_frontend::do_create_topic(
   custom_assignable_topic_configuration assignable_config,
   model::timeout_clock::time_point timeout) {
+    auto result = co_await prepare_create_topic(assignable_config);
+    if (result.ec != errc::success) {
+        co_return result;
+    }
+
+    auto units = co_await allocate_topic(assignable_config);
+    if (!units) {
+        co_return make_error_result(assignable_config.cfg.tp_ns, units.error());
+    }
+    co_return co_await replicate_create_topic(
+      std::move(assignable_config.cfg), std::move(units.value()), timeout);
+}
+
+ss::future<topic_result> topics_frontend::prepare_create_topic(
+  custom_assignable_topic_configuration& assignable_config) {
     auto& tp_ns = assignable_config.cfg.tp_ns;
     if (_topics.local().contains(tp_ns)) {
         vlog(
@@ -808,9 +829,15 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           remote_label);
     }
 
-    auto units = co_await _allocator.invoke_on(
+    co_return topic_result(tp_ns);
+}
+
+ss::future<result<allocation_units::pointer>> topics_frontend::allocate_topic(
+  custom_assignable_topic_configuration assignable_config) {
+    return _allocator.invoke_on(
       partition_allocator::shard,
-      [assignable_config, topic_aware = _partition_autobalancing_topic_aware()](
+      [assignable_config = std::move(assignable_config),
+       topic_aware = _partition_autobalancing_topic_aware()](
         partition_allocator& al) {
           if (assignable_config.has_custom_assignment()) {
               return al.allocate(
@@ -819,12 +846,93 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           return al.allocate(
             make_simple_allocation_request(assignable_config, topic_aware));
       });
+}
 
-    if (!units) {
-        co_return make_error_result(assignable_config.cfg.tp_ns, units.error());
+ss::future<std::vector<topic_result>> topics_frontend::do_create_topics_in_bulk(
+  custom_assignable_topic_configuration_vector topics,
+  model::timeout_clock::time_point timeout) {
+    // Bound the size of a single controller command, larger requests are
+    // split into several commands replicated concurrently.
+    static constexpr size_t max_partitions_per_command = 10'000;
+
+    std::vector<ss::future<topic_result>> prepare_futures;
+    prepare_futures.reserve(topics.size());
+    for (auto& t : topics) {
+        prepare_futures.push_back(prepare_create_topic(t));
+    }
+    auto results = co_await ss::when_all_succeed(
+      prepare_futures.begin(), prepare_futures.end());
+
+    struct pending_command {
+        bulk_create_topics_cmd_data data;
+        std::vector<size_t> topic_indices;
+        std::vector<allocation_units::pointer> units;
+        size_t partitions = 0;
+    };
+    std::vector<pending_command> commands;
+
+    // Allocate the topics one after another so that every allocation takes
+    // into account the replicas allocated for the previous topics. The units
+    // are held until the commands are replicated.
+    for (size_t i = 0; i < topics.size(); ++i) {
+        if (results[i].ec != errc::success) {
+            continue;
+        }
+        auto units = co_await allocate_topic(topics[i]);
+        if (!units) {
+            results[i] = make_error_result(topics[i].cfg.tp_ns, units.error());
+            continue;
+        }
+
+        if (
+          commands.empty()
+          || commands.back().partitions >= max_partitions_per_command) {
+            commands.emplace_back();
+        }
+        auto& cmd = commands.back();
+        topic_configuration_assignment assignment(
+          std::move(topics[i].cfg), units.value()->copy_assignments());
+        for (auto& p_as : assignment.assignments) {
+            std::shuffle(
+              p_as.replicas.begin(),
+              p_as.replicas.end(),
+              random_generators::internal::gen);
+        }
+        cmd.partitions += assignment.assignments.size();
+        cmd.data.topics.push_back(std::move(assignment));
+        cmd.topic_indices.push_back(i);
+        cmd.units.push_back(std::move(units.value()));
     }
-    co_return co_await replicate_create_topic(
-      std::move(assignable_config.cfg), std::move(units.value()), timeout);
+
+    co_await ss::parallel_for_each(commands, [&](pending_command& cmd) {
+        vlog(
+          clusterlog.debug,
+          "replicating creation of {} topics with {} partitions",
+          cmd.topic_indices.size(),
+          cmd.partitions);
+        return replicate_and_wait(
+                 _stm,
+                 _as,
+                 bulk_create_topics_cmd{0, std::move(cmd.data)},
+                 timeout)
+          .then_wrapped([&](ss::future<std::error_code> f) {
+              errc ec = errc::replication_error;
+              try {
+                  ec = map_errc(f.get());
+              } catch (...) {
+                  vlog(
+                    clusterlog.warn,
+                    "Unable to create topics - {}",
+                    std::current_exception());
+              }
+              for (auto idx : cmd.topic_indices) {
+                  results[idx].ec = ec;
+              }
+              cmd.units.clear();
+          });
+    });
+
+    co_return results;
 }
 
 ss::future<topic_result> topics_frontend::replicate_create_topic(
@@ -234,6 +234,20 @@ private:
     ss::future<topic_result> do_create_topic(
       custom_assignable_topic_configuration, model::timeout_clock::time_point);
 
+    // Validates the topic and fills in the configuration (e.g. downloaded
+    // remote properties) before the partitions are allocated.
+    ss::future<topic_result>
+      prepare_create_topic(custom_assignable_topic_configuration&);
+
+    ss::future<result<allocation_units::pointer>>
+      allocate_topic(custom_assignable_topic_configuration);
+
+    // Creates all the topics with a single controller command (or a few for
+    // very large requests) rather than with a command per topic.
+    ss::future<std::vector<topic_result>> do_create_topics_in_bulk(
+      custom_assignable_topic_configuration_vector,
+      model::timeout_clock::time_point);
+
     ss::future<topic_result> replicate_create_topic(
       topic_configuration,
       allocation_units::pointer,
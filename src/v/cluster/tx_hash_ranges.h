@@ -36,8 +36,7 @@ static tx_id_hash get_default_tx_hash_range_size(int32_t tm_partitions_amount) {
 
 // Return hash of tx_id in range [0, tx_tm_hash_max]
 inline tx_id_hash get_tx_id_hash(const kafka::transactional_id& tx_id) {
-    auto copy = ss::sstring(tx_id);
-    return tx_id_hash(murmur2(copy.data(), copy.size()));
+    return tx_id_hash(murmur2(tx_id().data(), tx_id().size()));
 }
 
 enum class tx_hash_ranges_errc {
@@ -851,6 +851,18 @@ bulk_force_reconfiguration_cmd_data::bulk_force_reconfiguration_cmd_data(
     user_approved_force_recovery_partitions
       = other.user_approved_force_recovery_partitions.copy();
 }
+
+bulk_create_topics_cmd_data& bulk_create_topics_cmd_data::operator=(
+  const bulk_create_topics_cmd_data& other) {
+    if (this != &other) {
+        topics = other.topics.copy();
+    }
+    return *this;
+}
+
+bulk_create_topics_cmd_data::bulk_create_topics_cmd_data(
+  const bulk_create_topics_cmd_data& other)
+  : topics(other.topics.copy()) {}
 } // namespace cluster
 
 namespace reflection {
@@ -1229,14 +1229,12 @@ enum class reconfiguration_policy {
      */
     target_initial_retention = 1,
     /*
-     * The min local retention policy, before requesting partition
-     * reconfiguration in the Raft layer will request log to be uploaded to the
-     * Object Store up to the active segment boundary. After all data are update
-     * the controller backend will request partition move setting learner
-     * initial offset to the active segment start offset, allowing all the data
-     * from not active segments to be skiped while recovering learners.
-     *
-     * (NOTE: not yet implemented)
+     * With min local retention policy the controller backend sets the learner
+     * initial offset right after the last offset uploaded to the Object Store
+     * (partition max collectible offset). Learners only receive the data which
+     * is not yet uploaded and the stm snapshot, everything below is served
+     * from the cloud. If tiered storage is disabled for a partition the move
+     * is executed with full local retention.
      */
     min_local_retention = 2
 };
@@ -2090,6 +2088,29 @@ struct bulk_force_reconfiguration_cmd_data
     }
 };
 
+struct bulk_create_topics_cmd_data
+  : serde::envelope<
+      bulk_create_topics_cmd_data,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    bulk_create_topics_cmd_data() = default;
+    ~bulk_create_topics_cmd_data() noexcept = default;
+    bulk_create_topics_cmd_data(bulk_create_topics_cmd_data&&) = default;
+    bulk_create_topics_cmd_data(const bulk_create_topics_cmd_data&);
+    bulk_create_topics_cmd_data& operator=(bulk_create_topics_cmd_data&&)
+      = default;
+    bulk_create_topics_cmd_data& operator=(const bulk_create_topics_cmd_data&);
+    friend bool operator==(
+      const bulk_create_topics_cmd_data&, const bulk_create_topics_cmd_data&)
+      = default;
+
+    fragmented_vector<topic_configuration_assignment> topics;
+
+    auto serde_fields() { return std::tie(topics); }
+};
+
 using force_recoverable_partitions_t
   = absl::btree_map<model::ntp, std::vector<ntp_with_majority_loss>>;
 
@@ -17,6 +17,10 @@
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
+#include "compression/stream_zstd.h"
+#include "ssx/thread_worker.h"
+
+#include <seastar/core/coroutine.hh>
 
 namespace compression {
 
@@ -72,7 +76,70 @@ iobuf compressor::uncompress(const iobuf& io, type t) {
     }
 }
 
+namespace {
+
+struct offload_config {
+    ssx::sharded_thread_worker* worker;
+    size_t min_bytes;
+};
+
+thread_local std::optional<offload_config> offload;
+
+bool should_offload(const iobuf& io) {
+    return offload.has_value() && io.size_bytes() >= offload->min_bytes;
+}
+
+} // namespace
+
+ss::future<> enable_offload(
+  ssx::sharded_thread_worker& worker,
+  size_t min_bytes,
+  size_t zstd_decompression_size) {
+    // The worker thread has its own zstd decompression workspace, size it like
+    // the reactor's one rather than lazily with the default size.
+    co_await worker.submit([zstd_decompression_size] {
+        stream_zstd::init_workspace(zstd_decompression_size);
+    });
+    offload = offload_config{.worker = &worker, .min_bytes = min_bytes};
+}
+
+void disable_offload() { offload.reset(); }
+
+// The worker only reads the input, which stays owned by the shard. The output
+// is allocated on the worker thread and handed over to the shard as a whole.
+ss::future<iobuf> offloading_compressor::compress(const iobuf& io, type t) {
+    if (!should_offload(io)) {
+        return ss::futurize_invoke(
+          [&io, t] { return compressor::compress(io, t); });
+    }
+    return offload->worker->submit(
+      [&io, t] { return compressor::compress(io, t); });
+}
+
+ss::future<iobuf> offloading_compressor::uncompress(const iobuf& io, type t) {
+    if (!should_offload(io)) {
+        return ss::futurize_invoke(
+          [&io, t] { return compressor::uncompress(io, t); });
+    }
+    return offload->worker->submit(
+      [&io, t] { return compressor::uncompress(io, t); });
+}
+
 ss::future<iobuf> stream_compressor::compress(iobuf io, type t) {
+    if (t != type::none && should_offload(io)) {
+        co_return co_await offloading_compressor::compress(io, t);
+    }
+    co_return co_await do_compress(std::move(io), t);
+}
+
+ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
+    if (!io.empty() && should_offload(io)) {
+        co_return co_await offloading_compressor::uncompress(io, t);
+    }
+    co_return co_await do_uncompress(std::move(io), t);
+}
+
+ss::future<iobuf> stream_compressor::do_compress(iobuf io, type t) {
     switch (t) {
     case type::none:
         return ss::make_exception_future<iobuf>(
@@ -84,7 +151,7 @@ ss::future<iobuf> stream_compressor::compress(iobuf io, type t) {
         return ss::make_ready_future<iobuf>(compressor::compress(io, t));
     }
 }
-ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
+ss::future<iobuf> stream_compressor::do_uncompress(iobuf io, type t) {
     if (io.empty()) {
         return ss::make_exception_future<iobuf>(std::runtime_error(fmt::format(
           "Asked to decompress:{} an empty buffer:{}", (int)t, io)));
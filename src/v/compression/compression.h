@@ -12,6 +12,11 @@
 #pragma once
 #include "bytes/iobuf.h"
 #include "model/compression.h"
+
+namespace ssx {
+class sharded_thread_worker;
+} // namespace ssx
+
 namespace compression {
 
 using type = model::compression;
@@ -29,6 +34,31 @@ struct compressor {
 struct stream_compressor {
     static ss::future<iobuf> compress(iobuf, type);
     static ss::future<iobuf> uncompress(iobuf, type);
+
+private:
+    static ss::future<iobuf> do_compress(iobuf, type);
+    static ss::future<iobuf> do_uncompress(iobuf, type);
+};
+
+// Runs the compression and decompression of buffers of at least `min_bytes`
+// requested on the calling shard on `worker` rather than on the reactor, so
+// that large batches don't stall the shard. The worker must outlive the
+// offloading, call `disable_offload` on every shard before stopping it.
+//
+// `zstd_decompression_size` sizes the zstd decompression workspace of the
+// worker thread, as `stream_zstd::init_workspace` does for the shard.
+ss::future<> enable_offload(
+  ssx::sharded_thread_worker& worker,
+  size_t min_bytes,
+  size_t zstd_decompression_size);
+void disable_offload();
+
+// Like compressor, but runs on the offload thread worker when it is enabled
+// and the input is large enough. The input must be kept alive until the
+// returned future resolves.
+struct offloading_compressor {
+    static ss::future<iobuf> compress(const iobuf&, type);
+    static ss::future<iobuf> uncompress(const iobuf&, type);
 };
 
 } // namespace compression
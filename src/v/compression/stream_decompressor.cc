@@ -0,0 +1,249 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "compression/stream_decompressor.h"
+
+#include "base/likely.h"
+#include "compression/compression.h"
+#include "thirdparty/lz4/lz4frame.h"
+#include "utils/static_deleter_fn.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+#include <fmt/format.h>
+
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace compression {
+
+class stream_decompressor::impl {
+public:
+    impl() = default;
+    impl(const impl&) = delete;
+    impl& operator=(const impl&) = delete;
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+    virtual ~impl() = default;
+
+    virtual size_t next(iobuf& out, size_t max_bytes) = 0;
+};
+
+namespace {
+
+// Walks the fragments of the compressed input.
+class input_cursor {
+public:
+    explicit input_cursor(const iobuf& input)
+      : _it(input.begin())
+      , _end(input.end()) {
+        skip_empty();
+    }
+
+    bool at_end() const { return _it == _end; }
+
+    const char* data() const { return _it->get() + _pos; }
+    size_t size() const { return _it->size() - _pos; }
+
+    void consume(size_t n) {
+        _pos += n;
+        if (_pos == _it->size()) {
+            ++_it;
+            _pos = 0;
+            skip_empty();
+        }
+    }
+
+private:
+    void skip_empty() {
+        while (_it != _end && _it->size() == 0) {
+            ++_it;
+        }
+    }
+
+    iobuf::const_iterator _it;
+    iobuf::const_iterator _end;
+    size_t _pos{0};
+};
+
+class zstd_stream_decompressor final : public stream_decompressor::impl {
+public:
+    explicit zstd_stream_decompressor(const iobuf& input)
+      : _input(input)
+      , _ctx(ZSTD_createDCtx()) {
+        if (!_ctx) {
+            throw std::bad_alloc{};
+        }
+    }
+
+    size_t next(iobuf& out, size_t max_bytes) final {
+        ss::temporary_buffer<char> buf(max_bytes);
+        ZSTD_outBuffer zout = {.dst = buf.get_write(), .size = max_bytes};
+        while (zout.pos < zout.size) {
+            ZSTD_inBuffer zin = {
+              .src = _input.at_end() ? nullptr : _input.data(),
+              .size = _input.at_end() ? 0 : _input.size(),
+            };
+            auto prev_pos = zout.pos;
+            auto rc = ZSTD_decompressStream(_ctx.get(), &zout, &zin);
+            if (unlikely(ZSTD_isError(rc))) {
+                if (ZSTD_getErrorCode(rc) == ZSTD_error_memory_allocation) {
+                    throw std::bad_alloc{};
+                }
+                throw std::runtime_error(
+                  fmt::format("ZSTD error:{}", ZSTD_getErrorName(rc)));
+            }
+            _frame_done = rc == 0;
+            if (zin.pos > 0) {
+                _input.consume(zin.pos);
+            } else if (_input.at_end() && zout.pos == prev_pos) {
+                // No input left and nothing more to flush.
+                break;
+            }
+        }
+        if (zout.pos == 0 && _input.at_end() && !_frame_done) {
+            throw std::runtime_error("ZSTD error:truncated input");
+        }
+        buf.trim(zout.pos);
+        if (!buf.empty()) {
+            out.append(std::move(buf));
+        }
+        return zout.pos;
+    }
+
+private:
+    using dctx_ptr = std::unique_ptr<
+      ZSTD_DCtx,
+      static_retval_deleter_fn<ZSTD_DCtx, size_t, &ZSTD_freeDCtx>>;
+
+    input_cursor _input;
+    dctx_ptr _ctx;
+    bool _frame_done{false};
+};
+
+class lz4_stream_decompressor final : public stream_decompressor::impl {
+public:
+    explicit lz4_stream_decompressor(const iobuf& input)
+      : _input(input) {
+        // The shard's reusable lz4 buffers only serve one decompression at a
+        // time, a stream may be interleaved with others so it uses malloc.
+        LZ4F_dctx* ctx = nullptr;
+        check(
+          LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION),
+          "LZ4F_createDecompressionContext error: {}");
+        _ctx.reset(ctx);
+    }
+
+    size_t next(iobuf& out, size_t max_bytes) final {
+        ss::temporary_buffer<char> buf(max_bytes);
+        size_t written = 0;
+        while (written < max_bytes && !_frame_done && !_input.at_end()) {
+            size_t consumed = _input.size();
+            size_t produced = max_bytes - written;
+            auto rc = LZ4F_decompress(
+              _ctx.get(),
+              buf.get_write() + written,
+              &produced,
+              _input.data(),
+              &consumed,
+              nullptr);
+            check(rc, "lz4f_decompress error: {}");
+            written += produced;
+            _input.consume(consumed);
+            _frame_done = rc == 0;
+            if (consumed == 0 && produced == 0) {
+                break;
+            }
+        }
+        if (written == 0 && !_frame_done) {
+            throw std::runtime_error("lz4f_decompress error: truncated input");
+        }
+        buf.trim(written);
+        if (!buf.empty()) {
+            out.append(std::move(buf));
+        }
+        return written;
+    }
+
+private:
+    static void check(LZ4F_errorCode_t code, const char* fmt) {
+        if (unlikely(LZ4F_isError(code))) {
+            throw std::runtime_error(
+              fmt::format(fmt::runtime(fmt), LZ4F_getErrorName(code)));
+        }
+    }
+
+    using dctx_ptr = std::unique_ptr<
+      LZ4F_dctx,
+      static_retval_deleter_fn<
+        LZ4F_dctx,
+        LZ4F_errorCode_t,
+        &LZ4F_freeDecompressionContext>>;
+
+    input_cursor _input;
+    dctx_ptr _ctx;
+    bool _frame_done{false};
+};
+
+// Codecs without a streaming implementation are decompressed at once and
+// handed out in one go.
+class oneshot_decompressor final : public stream_decompressor::impl {
+public:
+    oneshot_decompressor(const iobuf& input, model::compression type)
+      : _input(input)
+      , _type(type) {}
+
+    size_t next(iobuf& out, size_t) final {
+        if (_done) {
+            return 0;
+        }
+        _done = true;
+        auto decompressed = compressor::uncompress(_input, _type);
+        auto n = decompressed.size_bytes();
+        out.append(std::move(decompressed));
+        return n;
+    }
+
+private:
+    const iobuf& _input;
+    model::compression _type;
+    bool _done{false};
+};
+
+} // namespace
+
+stream_decompressor::stream_decompressor(
+  const iobuf& input, model::compression type) {
+    switch (type) {
+    case model::compression::zstd:
+        _impl = std::make_unique<zstd_stream_decompressor>(input);
+        break;
+    case model::compression::lz4:
+        _impl = std::make_unique<lz4_stream_decompressor>(input);
+        break;
+    default:
+        _impl = std::make_unique<oneshot_decompressor>(input, type);
+        break;
+    }
+}
+
+stream_decompressor::stream_decompressor(stream_decompressor&&) noexcept
+  = default;
+stream_decompressor&
+stream_decompressor::operator=(stream_decompressor&&) noexcept
+  = default;
+stream_decompressor::~stream_decompressor() = default;
+
+size_t stream_decompressor::next(iobuf& out, size_t max_bytes) {
+    return _impl->next(out, max_bytes);
+}
+
+} // namespace compression
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "model/compression.h"
+
+#include <memory>
+
+namespace compression {
+
+/*
+ * Decompresses a buffer incrementally, a bounded chunk at a time.
+ *
+ * Unlike compressor::uncompress, which produces the whole decompressed buffer
+ * at once, callers that consume the decompressed data front to back (e.g.
+ * iterating over the records of a batch) only need to hold the decompressed
+ * data they haven't consumed yet. zstd and lz4 frames are decompressed as a
+ * stream, other codecs are decompressed in one go on the first call.
+ *
+ * The compressed input is not copied and must outlive the decompressor.
+ */
+class stream_decompressor {
+public:
+    static constexpr size_t default_chunk_size = 64_KiB;
+
+    stream_decompressor(const iobuf& input, model::compression type);
+    stream_decompressor(stream_decompressor&&) noexcept;
+    stream_decompressor& operator=(stream_decompressor&&) noexcept;
+    ~stream_decompressor();
+
+    // Appends up to `max_bytes` of decompressed data to `out`. Returns the
+    // number of bytes appended, zero once all of the input is decompressed.
+    //
+    // Throws if the input is corrupted or truncated.
+    size_t next(iobuf& out, size_t max_bytes = default_chunk_size);
+
+    class impl;
+
+private:
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace compression
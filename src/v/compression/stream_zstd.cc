@@ -15,6 +15,7 @@
 #include "base/vlog.h"
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "compression/zstd_dictionary.h"
 
 #include <seastar/core/aligned_buffer.hh>
 
@@ -85,9 +86,20 @@ ZSTD_DCtx* stream_zstd::decompressor() {
     return ctx;
 }
 
-iobuf stream_zstd::do_compress(const iobuf& x) {
+iobuf stream_zstd::compress(const iobuf& b, const zstd_dictionary& dict) {
+    return do_compress(b, dict.cdict());
+}
+
+iobuf stream_zstd::uncompress(const iobuf& b, const zstd_dictionary& dict) {
+    return do_uncompress(b, dict.ddict());
+}
+
+iobuf stream_zstd::do_compress(const iobuf& x, const ZSTD_CDict* cdict) {
     reset_compressor();
     ZSTD_CCtx* ctx = compressor().get();
+    if (cdict) {
+        throw_if_error(ZSTD_CCtx_refCDict(ctx, cdict));
+    }
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
 
@@ -194,12 +206,15 @@ size_t decompression_step(const iobuf& x) {
     return std::min(64_KiB, ret);
 }
 
-iobuf stream_zstd::do_uncompress(const iobuf& x) {
+iobuf stream_zstd::do_uncompress(const iobuf& x, const ZSTD_DDict* ddict) {
     if (unlikely(x.empty())) {
         throw std::runtime_error(
           "Asked to stream_zstd::uncompress empty buffer");
     }
     ZSTD_DCtx* dctx = decompressor();
+    if (ddict) {
+        throw_if_error(ZSTD_DCtx_refDDict(dctx, ddict));
+    }
     iobuf ret;
     ss::temporary_buffer<char>& obuf = d_buffer;
     ZSTD_outBuffer out = {
@@ -17,6 +17,8 @@
 #include <zstd.h>
 
 namespace compression {
+class zstd_dictionary;
+
 class stream_zstd {
 public:
     using zstd_compress_ctx = std::unique_ptr<
@@ -29,11 +31,15 @@ public:
     iobuf compress(iobuf&& b) { return do_compress(b); }
     iobuf uncompress(iobuf&& b) { return do_uncompress(b); }
 
+    /// Frames compressed with a dictionary can only be uncompressed with it
+    iobuf compress(const iobuf& b, const zstd_dictionary& dict);
+    iobuf uncompress(const iobuf& b, const zstd_dictionary& dict);
+
     static void init_workspace(size_t);
 
 private:
-    iobuf do_compress(const iobuf&);
-    iobuf do_uncompress(const iobuf&);
+    iobuf do_compress(const iobuf&, const ZSTD_CDict* = nullptr);
+    iobuf do_uncompress(const iobuf&, const ZSTD_DDict* = nullptr);
 
     void reset_compressor();
     zstd_compress_ctx& compressor();
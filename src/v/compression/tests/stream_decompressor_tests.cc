@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "compression/compression.h"
+#include "compression/stream_decompressor.h"
+#include "random/generators.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+iobuf make_input(size_t size) {
+    // compressible but not trivially so
+    iobuf buf;
+    while (buf.size_bytes() < size) {
+        auto chunk = random_generators::gen_alphanum_string(
+          std::min<size_t>(size - buf.size_bytes(), 100));
+        for (int i = 0; i < 4; ++i) {
+            buf.append(chunk.data(), chunk.size());
+        }
+    }
+    buf.trim_back(buf.size_bytes() - size);
+    return buf;
+}
+
+class StreamDecompressorTest
+  : public testing::TestWithParam<model::compression> {};
+
+} // namespace
+
+TEST_P(StreamDecompressorTest, RoundTrip) {
+    for (size_t size : {size_t{0}, size_t{1}, 4_KiB, 300_KiB, 2_MiB}) {
+        auto input = make_input(size);
+        auto compressed = compression::compressor::compress(input, GetParam());
+        compression::stream_decompressor d(compressed, GetParam());
+        iobuf out;
+        while (auto n = d.next(out, 16_KiB)) {
+            if (GetParam() == model::compression::zstd
+                || GetParam() == model::compression::lz4) {
+                EXPECT_LE(n, 16_KiB);
+            }
+        }
+        EXPECT_EQ(d.next(out), 0);
+        EXPECT_EQ(out, input) << "size " << size;
+    }
+}
+
+TEST_P(StreamDecompressorTest, TruncatedInput) {
+    auto compressed = compression::compressor::compress(
+      make_input(64_KiB), GetParam());
+    compressed.trim_back(compressed.size_bytes() / 2);
+    EXPECT_ANY_THROW({
+        compression::stream_decompressor d(compressed, GetParam());
+        iobuf out;
+        while (d.next(out) > 0) {
+        }
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Codecs,
+  StreamDecompressorTest,
+  testing::Values(
+    model::compression::zstd,
+    model::compression::lz4,
+    model::compression::snappy,
+    model::compression::gzip));
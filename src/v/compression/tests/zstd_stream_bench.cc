@@ -10,10 +10,12 @@
 #include "base/units.h"
 #include "base/vassert.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
+#include "ssx/thread_worker.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -157,3 +159,52 @@ PERF_TEST_C(async_stream_zstd, 10mb_compress) {
 PERF_TEST_C(async_stream_zstd, 10mb_uncompress) {
     co_return co_await async_uncompress_test(10 << 20);
 }
+
+// Compression offloaded to a thread worker, this measures the latency of a
+// single (de)compression including the hops to and from the worker thread.
+inline ss::future<> offloaded_compress_test(size_t data_size) {
+    ssx::sharded_thread_worker w;
+    co_await w.start({.name = "compress"});
+    co_await compression::enable_offload(w, 0, 2_MiB);
+    auto o = gen(data_size);
+
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(
+      co_await compression::stream_compressor::compress(
+        std::move(o), compression::type::zstd));
+    perf_tests::stop_measuring_time();
+
+    compression::disable_offload();
+    co_await w.stop();
+}
+
+inline ss::future<> offloaded_uncompress_test(size_t data_size) {
+    ssx::sharded_thread_worker w;
+    co_await w.start({.name = "compress"});
+    co_await compression::enable_offload(w, 0, 2_MiB);
+    auto o = co_await compression::stream_compressor::compress(
+      gen(data_size), compression::type::zstd);
+
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(
+      co_await compression::stream_compressor::uncompress(
+        std::move(o), compression::type::zstd));
+    perf_tests::stop_measuring_time();
+
+    compression::disable_offload();
+    co_await w.stop();
+}
+
+struct offloaded_zstd {};
+PERF_TEST_C(offloaded_zstd, 1mb_compress) {
+    co_await offloaded_compress_test(1 << 20);
+}
+PERF_TEST_C(offloaded_zstd, 1mb_uncompress) {
+    co_await offloaded_uncompress_test(1 << 20);
+}
+PERF_TEST_C(offloaded_zstd, 10mb_compress) {
+    co_await offloaded_compress_test(10 << 20);
+}
+PERF_TEST_C(offloaded_zstd, 10mb_uncompress) {
+    co_await offloaded_uncompress_test(10 << 20);
+}
@@ -16,10 +16,13 @@
 #include "compression/internal/zstd_compressor.h"
 #include "compression/snappy_standard_compressor.h"
 #include "compression/stream_zstd.h"
+#include "compression/zstd_dictionary.h"
 #include "random/generators.h"
 
 #include <seastar/testing/thread_test_case.hh>
 
+#include <fmt/format.h>
+
 static inline constexpr std::array<size_t, 16> sizes{{
   0,
   1,
@@ -186,3 +189,53 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_test) {
+    auto record = [](int i) {
+        iobuf buf;
+        buf.append(fmt::format(
+          R"({{"user_id": {}, "name": "{}", "event": "page_view", )"
+          R"("url": "/products/{}", "ts": {}}})",
+          i,
+          random_generators::gen_alphanum_string(8),
+          i % 97,
+          1700000000 + i));
+        return buf;
+    };
+    std::vector<iobuf> samples;
+    for (int i = 0; i < 2000; ++i) {
+        samples.push_back(record(i));
+    }
+    const auto dict = compression::zstd_dictionary::train(samples);
+    BOOST_REQUIRE_NE(dict.id(), 0);
+    BOOST_REQUIRE_LE(
+      dict.content().size(), compression::zstd_dictionary::default_max_size);
+
+    // a batch of a few records compresses better with the dictionary
+    iobuf batch;
+    for (int i = 5000; i < 5004; ++i) {
+        batch.append(record(i));
+    }
+    compression::stream_zstd fn;
+    auto plain = fn.compress(batch);
+    auto with_dict = fn.compress(batch, dict);
+    BOOST_CHECK_LT(with_dict.size_bytes(), plain.size_bytes());
+
+    BOOST_CHECK_EQUAL(compression::zstd_dictionary::id_of_frame(plain), 0);
+    BOOST_CHECK_EQUAL(
+      compression::zstd_dictionary::id_of_frame(with_dict), dict.id());
+    BOOST_CHECK_EQUAL(fn.uncompress(with_dict, dict), batch);
+    BOOST_CHECK_THROW(fn.uncompress(with_dict), std::runtime_error);
+
+    // a dictionary loaded from its content decompresses the same frames
+    compression::zstd_dictionary loaded(dict.content());
+    BOOST_CHECK_EQUAL(loaded.id(), dict.id());
+    BOOST_CHECK_EQUAL(fn.uncompress(with_dict, loaded), batch);
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_too_few_samples_test) {
+    std::vector<iobuf> samples;
+    samples.push_back(iobuf::from("single sample"));
+    BOOST_CHECK_THROW(
+      compression::zstd_dictionary::train(samples), std::runtime_error);
+}
@@ -0,0 +1,76 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/zstd_dictionary.h"
+
+#include <seastar/util/backtrace.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <zdict.h>
+
+namespace compression {
+
+zstd_dictionary zstd_dictionary::train(
+  const std::vector<iobuf>& samples, size_t max_size, int level) {
+    bytes buffer;
+    std::vector<size_t> sizes;
+    sizes.reserve(samples.size());
+    for (const auto& s : samples) {
+        sizes.push_back(s.size_bytes());
+    }
+    buffer.resize(std::reduce(sizes.begin(), sizes.end()));
+    size_t pos = 0;
+    for (const auto& s : samples) {
+        for (const auto& frag : s) {
+            std::copy_n(frag.get(), frag.size(), buffer.data() + pos);
+            pos += frag.size();
+        }
+    }
+
+    bytes content;
+    content.resize(max_size);
+    auto rc = ZDICT_trainFromBuffer(
+      content.data(),
+      content.size(),
+      buffer.data(),
+      sizes.data(),
+      static_cast<unsigned>(sizes.size()));
+    if (ZDICT_isError(rc)) {
+        ss::throw_with_backtrace<std::runtime_error>(fmt::format(
+          "Cannot train zstd dictionary from {} samples: {}",
+          samples.size(),
+          ZDICT_getErrorName(rc)));
+    }
+    content.resize(rc);
+    return zstd_dictionary(std::move(content), level);
+}
+
+zstd_dictionary::zstd_dictionary(bytes content, int level)
+  : _content(std::move(content))
+  , _id(ZSTD_getDictID_fromDict(_content.data(), _content.size()))
+  , _cdict(ZSTD_createCDict(_content.data(), _content.size(), level))
+  , _ddict(ZSTD_createDDict(_content.data(), _content.size())) {
+    if (!_cdict || !_ddict) {
+        ss::throw_with_backtrace<std::bad_alloc>();
+    }
+}
+
+uint32_t zstd_dictionary::id_of_frame(const iobuf& x) {
+    auto consumer = iobuf::iterator_consumer(x.cbegin(), x.cend());
+    std::array<char, ZSTD_FRAMEHEADERSIZE_MAX> header{};
+    auto size = std::min(header.size(), x.size_bytes());
+    consumer.consume_to(size, header.data());
+    return ZSTD_getDictID_fromFrame(header.data(), size);
+}
+
+} // namespace compression
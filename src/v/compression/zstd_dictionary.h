@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "base/units.h"
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "utils/static_deleter_fn.h"
+
+#include <memory>
+#include <vector>
+#include <zstd.h>
+
+namespace compression {
+
+/*
+ * A zstd dictionary trained from sample records.
+ *
+ * Small batches, e.g. a handful of JSON messages, compress poorly because
+ * zstd has nothing to learn the repeated structure from. A dictionary
+ * trained on records of the same topic primes the compressor with that
+ * structure. The digested compression and decompression dictionaries are
+ * created once and shared by all the frames using the dictionary.
+ *
+ * Frames compressed with a dictionary record its id in the frame header,
+ * see id_of_frame, they can only be decompressed with the same dictionary.
+ */
+class zstd_dictionary {
+public:
+    static constexpr size_t default_max_size = 16_KiB;
+
+    /*
+     * Trains a dictionary of at most \p max_size bytes from \p samples.
+     * Throws std::runtime_error if zstd can't train a dictionary from them,
+     * e.g. when there are too few samples.
+     */
+    static zstd_dictionary train(
+      const std::vector<iobuf>& samples,
+      size_t max_size = default_max_size,
+      int level = ZSTD_CLEVEL_DEFAULT);
+
+    /// Loads a dictionary previously returned by content()
+    explicit zstd_dictionary(bytes content, int level = ZSTD_CLEVEL_DEFAULT);
+
+    /// Id recorded in the frames compressed with this dictionary
+    uint32_t id() const { return _id; }
+    const bytes& content() const { return _content; }
+
+    const ZSTD_CDict* cdict() const { return _cdict.get(); }
+    const ZSTD_DDict* ddict() const { return _ddict.get(); }
+
+    /// Id of the dictionary a frame was compressed with, 0 if none
+    static uint32_t id_of_frame(const iobuf&);
+
+private:
+    bytes _content;
+    uint32_t _id;
+    std::unique_ptr<
+      ZSTD_CDict,
+      static_sized_deleter_fn<ZSTD_CDict, &ZSTD_freeCDict>>
+      _cdict;
+    std::unique_ptr<
+      ZSTD_DDict,
+      static_sized_deleter_fn<ZSTD_DDict, &ZSTD_freeDDict>>
+      _ddict;
+};
+
+} // namespace compression
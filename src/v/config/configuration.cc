@@ -71,6 +71,18 @@ configuration::configuration()
        .visibility = visibility::tunable},
       5,
       {.min = 0, .max = 99})
+  , log_segment_target_count(
+      *this,
+      "log_segment_target_count",
+      "When set, partitions without a topic `segment.bytes` override size "
+      "their segments so that their retained data spans roughly this many "
+      "segments. The size is derived from the retention settings and the "
+      "observed ingest rate of each partition, and clamped to "
+      "`log_segment_size_min` and `log_segment_size_max`.",
+      {.needs_restart = needs_restart::no,
+       .example = "16",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , compacted_log_segment_size(
       *this,
       "compacted_log_segment_size",
@@ -428,6 +440,17 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       64,
       {.min = 1, .max = 16384})
+  , raft_recovery_max_inflight_requests(
+      *this,
+      "raft_recovery_max_inflight_requests",
+      "Maximum number of append entries requests a recovering follower may "
+      "have in flight. Each request carries up to "
+      "raft_recovery_default_read_size bytes and is accounted in the recovery "
+      "memory quota. Higher values pipeline the recovery of followers that "
+      "are far behind the leader.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
   , raft_replica_max_pending_flush_bytes(
       *this,
       "raft_replica_max_pending_flush_bytes",
@@ -582,6 +605,16 @@ configuration::configuration()
       "sense by the shard and/or partition labels.",
       {.needs_restart = needs_restart::no},
       false)
+  , storage_metrics_topic_rollup(
+      *this,
+      "storage_metrics_topic_rollup",
+      "Export the `storage_log` metrics per topic instead of per partition. "
+      "The values of the partitions of a topic on each shard are summed when "
+      "scraped, reducing the number of series and the cost of scrapes on "
+      "brokers with many partitions.",
+      {.needs_restart = needs_restart::yes,
+       .visibility = visibility::tunable},
+      false)
   , group_min_session_timeout_ms(
       *this,
       "group_min_session_timeout_ms",
@@ -624,6 +657,15 @@ configuration::configuration()
       "offsets.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , group_offset_commit_coalescing_window_ms(
+      *this,
+      "group_offset_commit_coalescing_window_ms",
+      "Time for which offset commits of the groups coordinated by a consumer "
+      "offsets partition are accumulated before being replicated in a single "
+      "batch. With 0 only the commits received at the same time are "
+      "coalesced.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , legacy_group_offset_retention_enabled(
       *this,
       "legacy_group_offset_retention_enabled",
@@ -905,6 +947,16 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::numeric_limits<uint64_t>::max(),
       {.min = 1})
+  , max_spilled_producer_ids(
+      *this,
+      "max_spilled_producer_ids",
+      "Maximum number of idempotent producers terminated because of "
+      "max_concurrent_producer_ids for which each shard keeps the last "
+      "sequence number. Such a producer can resume producing without an out "
+      "of order sequence error until it expires. Set to 0 to drop the state "
+      "of terminated producers.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100'000)
   , max_transactions_per_coordinator(
       *this,
       "max_transactions_per_coordinator",
@@ -1111,6 +1163,15 @@ configuration::configuration()
       "Kafka group recovery timeout.",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       30'000ms)
+  , kafka_group_recovery_snapshot_interval_ms(
+      *this,
+      "kafka_group_recovery_snapshot_interval_ms",
+      "Interval at which followers of consumer offsets partitions replay the "
+      "committed log into an in-memory snapshot of the group state. A broker "
+      "becoming the leader of a partition then only replays the log written "
+      "since the last snapshot. Snapshots are not kept if not set.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      60s)
   , replicate_append_timeout_ms(
       *this,
       "replicate_append_timeout_ms",
@@ -1317,6 +1378,16 @@ configuration::configuration()
       {.example = "32768", .visibility = visibility::tunable},
       16_KiB,
       {.min = 4096, .max = 32_MiB, .align = 4096})
+  , append_chunk_arena_enabled(
+      *this,
+      "append_chunk_arena_enabled",
+      "Reserve the memory of the segment appender chunk pool at startup as a "
+      "single pre-faulted arena that is never returned to the allocator. The "
+      "arena is aligned to huge pages and the kernel is asked to back it with "
+      "transparent huge pages, which avoids page faults and reduces TLB "
+      "misses on the write path.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , storage_read_buffer_size(
       *this,
       "storage_read_buffer_size",
@@ -1333,6 +1404,39 @@ configuration::configuration()
        .example = "1",
        .visibility = visibility::tunable},
       1)
+  , storage_read_max_readahead_count(
+      *this,
+      "storage_read_max_readahead_count",
+      "Upper bound of the number of reads to issue ahead of the current read "
+      "location of sequential readers. When set, the read-ahead and the read "
+      "buffer size of a segment are adjusted within this bound based on how "
+      "much of the previously read ahead data was consumed, so that fast "
+      "sequential consumers read further ahead while random access readers "
+      "don't waste memory. If not set, `storage_read_readahead_count` is "
+      "always used.",
+      {.needs_restart = needs_restart::no,
+       .example = "4",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_cache_memory_budget(
+      *this,
+      "storage_cache_memory_budget",
+      "Per shard memory budget, in bytes, shared by the batch cache, the "
+      "segment appender chunk cache and the readers cache. When set, the "
+      "budget is periodically moved towards the caches that get the most "
+      "hits per MiB of memory. If not set, each cache manages its memory "
+      "independently.",
+      {.needs_restart = needs_restart::no,
+       .example = "1073741824",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_cache_rebalance_interval_ms(
+      *this,
+      "storage_cache_rebalance_interval_ms",
+      "How often the cache memory budget set by `storage_cache_memory_budget` "
+      "is rebalanced between the storage caches.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      10s)
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -1396,6 +1500,30 @@ configuration::configuration()
        .visibility = visibility::tunable},
       12.0,
       {.min = 1.0, .max = 100.0})
+  , storage_compaction_key_map_digest(
+      *this,
+      "storage_compaction_key_map_digest",
+      "Digest used to represent keys in compaction key-offset maps. `sha256` "
+      "uses 32 byte cryptographic digests. `xxhash3` uses 16 byte "
+      "non-cryptographic digests which are cheaper to compute and fit more "
+      "keys in `storage_compaction_key_map_memory`. Only applies when "
+      "`log_compaction_use_sliding_window` is set to `true`.",
+      {.needs_restart = needs_restart::yes,
+       .example = "xxhash3",
+       .visibility = visibility::tunable},
+      model::compaction_key_digest::sha256,
+      {model::compaction_key_digest::sha256,
+       model::compaction_key_digest::xxhash3})
+  , storage_compaction_key_map_spill_to_disk(
+      *this,
+      "storage_compaction_key_map_spill_to_disk",
+      "When enabled, compaction key-offset maps spill sorted runs of keys to "
+      "disk once they reach `storage_compaction_key_map_memory`, so that "
+      "partitions with more keys than fit in memory are deduplicated in a "
+      "single sliding window pass. Only applies when "
+      "`log_compaction_use_sliding_window` is set to `true`.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
@@ -1456,6 +1584,18 @@ configuration::configuration()
        .visibility = visibility::tunable},
       2,
       {.min = 1})
+  , storage_file_removal_truncate_step(
+      *this,
+      "storage_file_removal_truncate_step",
+      "When set, segment files larger than this many bytes are truncated in "
+      "steps of this size before they are removed. Releasing the extents of "
+      "a large file gradually avoids the latency spike some file systems "
+      "cause when a large file is unlinked at once. If not set, files are "
+      "removed directly.",
+      {.needs_restart = needs_restart::no,
+       .example = "134217728",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , debug_load_slice_warning_depth(
       *this,
       "debug_load_slice_warning_depth",
@@ -1711,6 +1851,17 @@ configuration::configuration()
       // permit setting a max below the min).  The maximum is set to forbid
       // contiguous allocations beyond that size.
       {.min = 512, .max = 512_KiB, .align = 4_KiB})
+  , kafka_connection_shard_by_client_port(
+      *this,
+      "kafka_connection_shard_by_client_port",
+      "Assign Kafka connections to the shard given by the client source port "
+      "modulo the number of shards, instead of balancing connection counts. "
+      "Clients working with a few partitions can pick a source port mapping "
+      "to the shard that hosts them (the `core` reported by the admin API) "
+      "to avoid cross shard hops on every request.",
+      {.needs_restart = needs_restart::yes,
+       .visibility = visibility::tunable},
+      false)
   , kafka_enable_describe_log_dirs_remote_storage(
       *this,
       "kafka_enable_describe_log_dirs_remote_storage",
@@ -2018,6 +2169,21 @@ configuration::configuration()
       "Timeout for running the cloud storage garbage collection (ms).",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_delete_batch_concurrency(
+      *this,
+      "cloud_storage_delete_batch_concurrency",
+      "Maximum number of DeleteObjects requests that a shard sends "
+      "concurrently. Deletions requested by all partitions on the shard are "
+      "queued and coalesced into the largest batches the backend accepts.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
+  , cloud_storage_delete_batch_timeout_ms(
+      *this,
+      "cloud_storage_delete_batch_timeout_ms",
+      "Time budget for retrying a single DeleteObjects request before the "
+      "deletion of its keys is reported as failed.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      60s)
   , cloud_storage_max_connection_idle_time_ms(
       *this,
       "cloud_storage_max_connection_idle_time_ms",
@@ -2153,6 +2319,17 @@ configuration::configuration()
       "Jitter applied to the cloud storage scrubbing interval.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , cloud_storage_scrubbing_sample_percent(
+      *this,
+      "cloud_storage_scrubbing_sample_percent",
+      "Percentage of segments whose existence the scrubber checks with a "
+      "request to cloud storage when no inventory report is used. Every run "
+      "samples a different subset, so all segments are eventually covered "
+      "at a fraction of the request cost. Segment metadata is always checked "
+      "in full.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100,
+      {.min = 1, .max = 100})
   , cloud_storage_disable_upload_loop_for_tests(
       *this,
       "cloud_storage_disable_upload_loop_for_tests",
@@ -2197,6 +2374,15 @@ configuration::configuration()
       "Enable re-uploading data for compacted topics",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , cloud_storage_compress_segment_uploads(
+      *this,
+      "cloud_storage_compress_segment_uploads",
+      "Upload segments compressed in independent zstd frames. The frame "
+      "layout is stored in the segment index, so that chunks of the segment "
+      "can still be downloaded with ranged reads. Compressed segments can "
+      "only be read by nodes which support this format.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , cloud_storage_recovery_temporary_retention_bytes_default(
       *this,
       "cloud_storage_recovery_temporary_retention_bytes_default",
@@ -2233,6 +2419,15 @@ configuration::configuration()
       "`check_manifest_and_segment_metadata`.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10)
+  , cloud_storage_recovery_segment_download_concurrency(
+      *this,
+      "cloud_storage_recovery_segment_download_concurrency",
+      "Number of segments of a partition downloaded concurrently during topic "
+      "recovery. Downloads are still subject to "
+      "`cloud_storage_max_throughput_per_shard`.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
   , cloud_storage_segment_size_target(
       *this,
       "cloud_storage_segment_size_target",
@@ -2274,6 +2469,27 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       50,
       {.min = 0, .max = 100})
+  , cloud_storage_hedged_download_percentile(
+      *this,
+      "cloud_storage_hedged_download_percentile",
+      "Percentile of recent object download latencies after which a second "
+      "request for the same object is sent on another connection. The first "
+      "response is used and the other request is cancelled. Only applies to "
+      "objects which are downloaded into memory, like manifests and indices. "
+      "At most a tenth of `cloud_storage_max_connections` are used for "
+      "hedged requests. If unset, requests are not hedged.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 50, .max = 99})
+  , cloud_topics_produce_latency_target_ms(
+      *this,
+      "cloud_topics_produce_latency_target_ms",
+      "Target latency of produce requests to cloud topics. Data is uploaded "
+      "to object storage as often as needed to stay within the target, "
+      "given the observed upload latency. Shorter targets result in more and "
+      "smaller objects.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      250ms)
   , cloud_storage_graceful_transfer_timeout_ms(
       *this,
       "cloud_storage_graceful_transfer_timeout_ms",
@@ -2357,6 +2573,15 @@ configuration::configuration()
       "contention.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , cloud_storage_spillover_manifest_prefetch(
+      *this,
+      "cloud_storage_spillover_manifest_prefetch",
+      "Number of spillover manifests that a cursor moving through the archive "
+      "materializes ahead of time in parallel. Prefetching only uses free "
+      "space of the manifest cache and never evicts manifests. Set to 0 to "
+      "disable.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
   , cloud_storage_topic_purge_grace_period_ms(
       *this,
       "cloud_storage_topic_purge_grace_period_ms",
@@ -2811,6 +3036,35 @@ configuration::configuration()
       "Number of chunks to prefetch ahead of every downloaded chunk",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       0)
+  , cloud_storage_chunk_prefetch_max(
+      *this,
+      "cloud_storage_chunk_prefetch_max",
+      "Maximum number of chunks to prefetch ahead of a reader. The number of "
+      "prefetched chunks is sized from the rate at which the reader consumes "
+      "data and the chunk download latency, and is never lower than "
+      "`cloud_storage_chunk_prefetch`. A value of 0 disables adaptive "
+      "prefetching.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16)
+  , cloud_storage_chunk_memory_cache_size(
+      *this,
+      "cloud_storage_chunk_memory_cache_size",
+      "Per shard size, in bytes, of the in-memory tier of segment chunks in "
+      "front of the object storage cache. Chunks read repeatedly are served "
+      "from memory instead of the local disk. Chunks larger than a tenth of "
+      "this size are not kept in memory. A value of 0 disables the memory "
+      "tier.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_hydration_parallel_ranges(
+      *this,
+      "cloud_storage_hydration_parallel_ranges",
+      "Number of byte ranges of `cloud_storage_cache_chunk_size` bytes "
+      "downloaded concurrently when a full segment is hydrated into the "
+      "object storage cache. A value of 1 downloads the segment as a single "
+      "stream.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
   , cloud_storage_cache_num_buckets(
       *this,
       "cloud_storage_cache_num_buckets",
@@ -2963,6 +3217,18 @@ configuration::configuration()
       "Disable reusable preallocated buffers for LZ4 decompression.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       false)
+  , compression_offload_min_bytes(
+      *this,
+      "compression_offload_min_bytes",
+      "Minimum size, in bytes, of the buffers compressed or decompressed on a "
+      "per shard worker thread instead of the reactor thread, e.g. when "
+      "compacting, reading or recompressing batches. Offloading keeps large "
+      "batches from stalling the shard at the cost of a thread hop. If not "
+      "set, all compression runs on the reactor thread.",
+      {.needs_restart = needs_restart::yes,
+       .example = "1048576",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , full_raft_configuration_recovery_pattern(
       *this, "full_raft_configuration_recovery_pattern")
   , enable_auto_rebalance_on_node_add(
@@ -3097,6 +3363,14 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , leader_balancer_throughput_balancing(
+      *this,
+      "leader_balancer_throughput_balancing",
+      "Balance the produce and fetch throughput of the partition leaders "
+      "across shards, as observed by the partition leaders. Leader counts are "
+      "then balanced only where it doesn't affect the throughput balance.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , default_leaders_preference(
       *this,
       [](const config::leaders_preference& v) {
@@ -3138,6 +3412,14 @@ configuration::configuration()
       "balancing.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , core_balancing_by_load(
+      *this,
+      "core_balancing_by_load",
+      "If set to `true`, periodically move the partitions with the highest "
+      "throughput off the most loaded cores. Requires "
+      "`core_balancing_continuous`.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -3267,6 +3549,15 @@ configuration::configuration()
       "Enable rack-aware replica assignment.",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       false)
+  , kafka_follower_fetch_max_lag(
+      *this,
+      "kafka_follower_fetch_max_lag",
+      "Consumers with a rack id are only redirected to a follower in their "
+      "rack if its high watermark is at most this many offsets behind the "
+      "leader. Followers lagging further can't serve recent data, consumers "
+      "fetch from the leader instead.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1000)
   , node_status_interval(
       *this,
       "node_status_interval",
@@ -3386,6 +3677,19 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt,
       {.min = 1})
+  , kafka_quota_shard_sync_interval_ms(
+      *this,
+      "kafka_quota_shard_sync_interval_ms",
+      "When set, each shard accounts client quota usage locally and only "
+      "applies it to the quota shared by all shards once this interval "
+      "elapsed or once the shard used its share of the quota for the "
+      "interval. This avoids contention on the shared quota when one client "
+      "is connected to many shards, at the cost of letting usage exceed the "
+      "limit by up to one interval's worth of quota before throttling.",
+      {.needs_restart = needs_restart::no,
+       .example = "10",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , kafka_quota_balancer_window(*this, "kafka_quota_balancer_window_ms")
   , kafka_quota_balancer_node_period(
       *this, "kafka_quota_balancer_node_period_ms")
@@ -3419,6 +3723,26 @@ configuration::configuration()
       [](auto& v) {
           return validate_throughput_control_groups(v.cbegin(), v.cend());
       })
+  , kafka_produce_cpu_throttle_target_utilization(
+      *this,
+      "kafka_produce_cpu_throttle_target_utilization",
+      "Reactor utilization, as a fraction between 0.5 and 0.99, above which "
+      "produce requests are throttled. The throttle delay grows in proportion "
+      "to the utilization above the target and is reported to clients in the "
+      "produce response throttle time. When unset produce requests are not "
+      "throttled on CPU utilization.",
+      {.needs_restart = needs_restart::no,
+       .example = "0.9",
+       .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 0.5, .max = 0.99})
+  , kafka_produce_cpu_throttle_max_delay_ms(
+      *this,
+      "kafka_produce_cpu_throttle_max_delay_ms",
+      "The throttle delay applied to produce requests when the reactor is "
+      "fully utilized, see `kafka_produce_cpu_throttle_target_utilization`.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100ms)
   , node_isolation_heartbeat_timeout(
       *this,
       "node_isolation_heartbeat_timeout",
@@ -3434,6 +3758,16 @@ configuration::configuration()
       "snapshot after a new controller command appears.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       60s)
+  , controller_snapshot_max_log_entries(
+      *this,
+      "controller_snapshot_max_log_entries",
+      "Maximum number of controller log entries applied since the last "
+      "controller snapshot before Redpanda attempts to create a new snapshot "
+      "without waiting for `controller_snapshot_max_age_sec`. Bounds the "
+      "number of commands replayed when a node restarts. If null, snapshots "
+      "are only created based on their age.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100'000)
   , legacy_permit_unsafe_log_operation(
       *this,
       "legacy_permit_unsafe_log_operation",
@@ -3550,6 +3884,17 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       100ms,
       {.min = 1ms})
+  , task_slice_tracking_threshold_ms(
+      *this,
+      "task_slice_tracking_threshold_ms",
+      "Enables tracking of the task slices of instrumented operations, such as "
+      "compaction or manifest serialization. Slices at least this long are "
+      "logged with the name of the operation, and the longest slice of each "
+      "operation is exported as a metric. Disabled when unset.",
+      {.needs_restart = needs_restart::no,
+       .example = "20",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , rpk_path(
       *this,
       "rpk_path",
@@ -3668,6 +4013,15 @@ configuration::configuration()
       "connections as client-initiated renegotiation was removed.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       false)
+  , tls_enable_session_resumption(
+      *this,
+      "tls_enable_session_resumption",
+      "Enables TLSv1.3 session ticket resumption on TLS-enabled listeners. "
+      "Reconnecting clients which present a ticket skip the full handshake. "
+      "Tickets are issued per core and are invalidated when certificates are "
+      "reloaded.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , iceberg_enabled(
       *this,
       "iceberg_enabled",
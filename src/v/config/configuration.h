@@ -113,6 +113,7 @@ struct configuration final : public config_store {
     property<std::optional<uint64_t>> log_segment_size_min;
     property<std::optional<uint64_t>> log_segment_size_max;
     bounded_property<uint16_t> log_segment_size_jitter_percent;
+    property<std::optional<uint32_t>> log_segment_target_count;
     bounded_property<uint64_t> compacted_log_segment_size;
     property<std::chrono::milliseconds> readers_cache_eviction_timeout_ms;
     bounded_property<size_t> readers_cache_target_max_size;
@@ -171,6 +172,7 @@ struct configuration final : public config_store {
     bounded_property<size_t> raft_recovery_default_read_size;
     property<bool> raft_enable_lw_heartbeat;
     bounded_property<size_t> raft_recovery_concurrency_per_shard;
+    bounded_property<size_t> raft_recovery_max_inflight_requests;
     property<std::optional<size_t>> raft_replica_max_pending_flush_bytes;
     property<std::chrono::milliseconds> raft_flush_timer_interval_ms;
     property<std::chrono::milliseconds> raft_replica_max_flush_delay_ms;
@@ -196,12 +198,15 @@ struct configuration final : public config_store {
     property<bool> disable_metrics;
     property<bool> disable_public_metrics;
     property<bool> aggregate_metrics;
+    property<bool> storage_metrics_topic_rollup;
     property<std::chrono::milliseconds> group_min_session_timeout_ms;
     property<std::chrono::milliseconds> group_max_session_timeout_ms;
     property<std::chrono::milliseconds> group_initial_rebalance_delay;
     property<std::chrono::milliseconds> group_new_member_join_timeout;
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
+    property<std::chrono::milliseconds>
+      group_offset_commit_coalescing_window_ms;
     property<bool> legacy_group_offset_retention_enabled;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
@@ -241,6 +246,7 @@ struct configuration final : public config_store {
     // same as transactional.id.expiration.ms in kafka
     property<std::chrono::milliseconds> transactional_id_expiration_ms;
     bounded_property<uint64_t> max_concurrent_producer_ids;
+    property<uint64_t> max_spilled_producer_ids;
     bounded_property<uint64_t> max_transactions_per_coordinator;
     property<bool> enable_idempotence;
     property<bool> enable_transactions;
@@ -276,6 +282,8 @@ struct configuration final : public config_store {
     property<bool> disable_batch_cache;
     property<std::chrono::milliseconds> raft_election_timeout_ms;
     property<std::chrono::milliseconds> kafka_group_recovery_timeout_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_group_recovery_snapshot_interval_ms;
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
@@ -305,8 +313,12 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> segment_appender_flush_timeout_ms;
     property<std::chrono::milliseconds> fetch_session_eviction_timeout_ms;
     bounded_property<size_t> append_chunk_size;
+    property<bool> append_chunk_arena_enabled;
     property<size_t> storage_read_buffer_size;
     property<int16_t> storage_read_readahead_count;
+    property<std::optional<int16_t>> storage_read_max_readahead_count;
+    property<std::optional<size_t>> storage_cache_memory_budget;
+    property<std::chrono::milliseconds> storage_cache_rebalance_interval_ms;
     property<size_t> segment_fallocation_step;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
@@ -314,11 +326,15 @@ struct configuration final : public config_store {
     bounded_property<uint64_t> storage_compaction_key_map_memory;
     bounded_property<double, numeric_bounds>
       storage_compaction_key_map_memory_limit_percent;
+    enum_property<model::compaction_key_digest>
+      storage_compaction_key_map_digest;
+    property<bool> storage_compaction_key_map_spill_to_disk;
     property<size_t> max_compacted_log_segment_size;
     property<std::optional<std::chrono::seconds>>
       storage_ignore_timestamps_in_future_sec;
     property<bool> storage_ignore_cstore_hints;
     bounded_property<int16_t> storage_reserve_min_segments;
+    property<std::optional<size_t>> storage_file_removal_truncate_step;
     property<std::optional<uint32_t>> debug_load_slice_warning_depth;
 
     deprecated_property tx_registry_log_capacity;
@@ -361,6 +377,7 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_send_buf;
     bounded_property<std::optional<size_t>> kafka_rpc_server_stream_recv_buf;
+    property<bool> kafka_connection_shard_by_client_port;
     property<bool> kafka_enable_describe_log_dirs_remote_storage;
 
     // Audit logging
@@ -407,6 +424,8 @@ struct configuration final : public config_store {
       cloud_storage_manifest_upload_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_garbage_collect_timeout_ms;
+    property<size_t> cloud_storage_delete_batch_concurrency;
+    property<std::chrono::milliseconds> cloud_storage_delete_batch_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_max_connection_idle_time_ms;
     property<std::optional<std::chrono::seconds>>
@@ -434,23 +453,30 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> cloud_storage_full_scrub_interval_ms;
     property<std::chrono::milliseconds>
       cloud_storage_scrubbing_interval_jitter_ms;
+    bounded_property<uint32_t> cloud_storage_scrubbing_sample_percent;
     property<bool> cloud_storage_disable_upload_loop_for_tests;
     property<bool> cloud_storage_disable_read_replica_loop_for_tests;
     property<bool> disable_cluster_recovery_loop_for_tests;
     property<bool> enable_cluster_metadata_upload_loop;
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
+    property<bool> cloud_storage_compress_segment_uploads;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
     // validation of topic manifest during recovery
     enum_property<model::recovery_validation_mode>
       cloud_storage_recovery_topic_validation_mode;
     property<uint32_t> cloud_storage_recovery_topic_validation_depth;
+    bounded_property<size_t>
+      cloud_storage_recovery_segment_download_concurrency;
 
     property<std::optional<size_t>> cloud_storage_segment_size_target;
     property<std::optional<size_t>> cloud_storage_segment_size_min;
     property<std::optional<size_t>> cloud_storage_max_throughput_per_shard;
     bounded_property<std::optional<size_t>>
       cloud_storage_throughput_limit_percent;
+    bounded_property<std::optional<size_t>>
+      cloud_storage_hedged_download_percentile;
+    property<std::chrono::milliseconds> cloud_topics_produce_latency_target_ms;
     property<std::optional<std::chrono::milliseconds>>
       cloud_storage_graceful_transfer_timeout_ms;
     enum_property<model::cloud_storage_backend> cloud_storage_backend;
@@ -461,6 +487,7 @@ struct configuration final : public config_store {
       cloud_storage_spillover_manifest_max_segments;
     bounded_property<size_t> cloud_storage_manifest_cache_size;
     property<std::chrono::milliseconds> cloud_storage_manifest_cache_ttl_ms;
+    property<uint16_t> cloud_storage_spillover_manifest_prefetch;
     property<std::chrono::milliseconds>
       cloud_storage_topic_purge_grace_period_ms;
     property<bool> cloud_storage_disable_upload_consistency_checks;
@@ -529,6 +556,9 @@ struct configuration final : public config_store {
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_chunk_prefetch_max;
+    property<size_t> cloud_storage_chunk_memory_cache_size;
+    property<uint16_t> cloud_storage_hydration_parallel_ranges;
     bounded_property<uint32_t> cloud_storage_cache_num_buckets;
     bounded_property<std::optional<double>, numeric_bounds>
       cloud_storage_cache_trim_threshold_percent_size;
@@ -560,6 +590,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
     property<size_t> zstd_decompress_workspace_bytes;
     property<bool> lz4_decompress_reusable_buffers_disabled;
+    property<std::optional<size_t>> compression_offload_min_bytes;
     deprecated_property full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
 
@@ -582,11 +613,13 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    property<bool> leader_balancer_throughput_balancing;
     enterprise<property<config::leaders_preference>> default_leaders_preference;
 
     property<bool> core_balancing_on_core_count_change;
     enterprise<property<bool>> core_balancing_continuous;
     property<std::chrono::milliseconds> core_balancing_debounce_timeout;
+    property<bool> core_balancing_by_load;
 
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
@@ -614,6 +647,8 @@ struct configuration final : public config_store {
 
     // enables rack aware replica assignment
     property<bool> enable_rack_awareness;
+    // max high watermark lag of a follower consumers are redirected to
+    property<int64_t> kafka_follower_fetch_max_lag;
 
     property<std::chrono::milliseconds> node_status_interval;
     property<std::chrono::milliseconds> node_status_reconnect_max_backoff_ms;
@@ -642,16 +677,22 @@ struct configuration final : public config_store {
     deprecated_property kafka_throughput_throttling_v2;
     bounded_property<std::optional<int64_t>>
       kafka_throughput_replenish_threshold;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_quota_shard_sync_interval_ms;
     deprecated_property kafka_quota_balancer_window;
     deprecated_property kafka_quota_balancer_node_period;
     deprecated_property kafka_quota_balancer_min_shard_throughput_ratio;
     deprecated_property kafka_quota_balancer_min_shard_throughput_bps;
     property<std::vector<ss::sstring>> kafka_throughput_controlled_api_keys;
     property<std::vector<throughput_control_group>> kafka_throughput_control;
+    bounded_property<std::optional<double>, numeric_bounds>
+      kafka_produce_cpu_throttle_target_utilization;
+    property<std::chrono::milliseconds> kafka_produce_cpu_throttle_max_delay_ms;
 
     bounded_property<int64_t> node_isolation_heartbeat_timeout;
 
     property<std::chrono::seconds> controller_snapshot_max_age_sec;
+    property<std::optional<size_t>> controller_snapshot_max_log_entries;
     // security controls
     property<bool> legacy_permit_unsafe_log_operation;
     property<std::chrono::seconds> legacy_unsafe_log_warning_interval_sec;
@@ -673,6 +714,8 @@ struct configuration final : public config_store {
     // debug controls
     property<bool> cpu_profiler_enabled;
     bounded_property<std::chrono::milliseconds> cpu_profiler_sample_period_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      task_slice_tracking_threshold_ms;
     property<std::filesystem::path> rpk_path;
     property<std::optional<std::filesystem::path>> debug_bundle_storage_dir;
     property<std::optional<std::chrono::seconds>>
@@ -697,6 +740,7 @@ struct configuration final : public config_store {
 
     enum_property<tls_version> tls_min_version;
     property<bool> tls_enable_renegotiation;
+    property<bool> tls_enable_session_resumption;
 
     // datalake configurations
     property<bool> iceberg_enabled;
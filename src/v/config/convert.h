@@ -559,6 +559,26 @@ struct convert<model::recovery_validation_mode> {
     }
 };
 
+template<>
+struct convert<model::compaction_key_digest> {
+    using type = model::compaction_key_digest;
+    constexpr static auto acceptable_values = std::to_array(
+      {"sha256", "xxhash3"});
+    static Node encode(const type& rhs) {
+        return Node{boost::lexical_cast<std::string>(rhs)};
+    }
+    static bool decode(const Node& node, type& rhs) {
+        auto node_str = node.as<std::string>();
+        if (
+          std::ranges::find(acceptable_values, node_str)
+          == acceptable_values.end()) {
+            return false;
+        }
+        rhs = boost::lexical_cast<type>(node_str);
+        return true;
+    }
+};
+
 template<>
 struct convert<config::fips_mode_flag> {
     using type = config::fips_mode_flag;
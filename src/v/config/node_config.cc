@@ -28,6 +28,16 @@ node_config::node_config() noexcept
       "data_directory",
       "Path to the directory for storing Redpanda's streaming data files.",
       {.required = required::yes, .visibility = visibility::user})
+  , additional_data_directories(
+      *this,
+      "additional_data_directories",
+      "Paths to additional directories, e.g. on separate drives, for storing "
+      "partition data. New partitions are placed in the directory which holds "
+      "the fewest partitions of their shard, preferring more free space. The "
+      "controller log, the kvstore and caches stay in `data_directory`. A "
+      "directory must not be removed while it holds partitions.",
+      {.visibility = visibility::user},
+      {})
   , node_id(
       *this,
       "node_id",
@@ -29,6 +29,8 @@ struct node_config final : public config_store {
 public:
     property<bool> developer_mode;
     property<data_directory_path> data_directory;
+    // Extra directories for partition data, e.g. one per drive
+    property<std::vector<ss::sstring>> additional_data_directories;
 
     // NOTE: during the normal runtime of a cluster, it is safe to assume that
     // the value of the node ID has been determined, and that there is a value
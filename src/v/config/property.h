@@ -674,6 +674,8 @@ consteval std::string_view property_type_name() {
     } else if constexpr (std::
                            is_same_v<type, model::recovery_validation_mode>) {
         return "recovery_validation_mode";
+    } else if constexpr (std::is_same_v<type, model::compaction_key_digest>) {
+        return "string";
     } else if constexpr (std::is_same_v<type, config::fips_mode_flag>) {
         return "string";
     } else if constexpr (std::is_same_v<type, config::tls_version>) {
@@ -115,6 +115,9 @@ void rjson_serialize(
 void rjson_serialize(
   json::Writer<json::StringBuffer>&, const model::recovery_validation_mode&);
 
+void rjson_serialize(
+  json::Writer<json::StringBuffer>&, const model::compaction_key_digest&);
+
 void rjson_serialize(
   json::Writer<json::StringBuffer>&, const config::fips_mode_flag& f);
 
@@ -41,6 +41,10 @@ tls_config::get_credentials_builder() const& {
               if (config::shard_local_cfg().tls_enable_renegotiation()) {
                   builder.enable_tls_renegotiation();
               }
+              if (config::shard_local_cfg().tls_enable_session_resumption()) {
+                  builder.set_session_resume_mode(
+                    ss::tls::session_resume_mode::TLS13_SESSION_TICKET);
+              }
 
               auto f = _truststore_file
                          ? builder.set_x509_trust_file(
@@ -12,6 +12,9 @@
 
 #include "container/fragmented_vector.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/future.hh>
+
 #include <absl/hash/hash.h>
 #include <ankerl/unordered_dense.h>
 
@@ -91,6 +94,20 @@ using chunked_hash_set = ankerl::unordered_dense::segmented_set<
   ankerl::unordered_dense::bucket_type::standard,
   chunked_vector<ankerl::unordered_dense::bucket_type::standard>>;
 
+/**
+ * A futurized version of clear() for chunked_hash_map and chunked_hash_set
+ * that allows destroying a large map without incurring a reactor stall.
+ *
+ * The elements are moved out of the map, which is empty once the returned
+ * future is created, and destroyed a fragment at a time.
+ */
+template<typename Map>
+seastar::future<> chunked_hash_map_clear_async(Map& map) {
+    auto values = std::move(map).extract();
+    map.clear();
+    co_await fragmented_vector_clear_async(values);
+}
+
 template<typename K, typename V>
 std::ostream& operator<<(std::ostream& o, const chunked_hash_map<K, V>& r) {
     o << "{";
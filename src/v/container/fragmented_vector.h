@@ -16,6 +16,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/util/later.hh>
 
+#include <algorithm>
 #include <bit>
 #include <climits>
 #include <compare>
@@ -491,6 +492,58 @@ public:
      */
     void erase_to_end(const_iterator begin) { pop_back_n(cend() - begin); }
 
+    /**
+     * @brief Appends copies of the elements of a range.
+     *
+     * Equivalent to a push_back of each element, but a fragment is filled at
+     * a time, which for trivially copyable types amounts to a memcpy per
+     * fragment.
+     */
+    template<std::ranges::input_range R>
+    void append_range(R&& range) {
+        if constexpr (
+          std::ranges::forward_range<R> && std::ranges::sized_range<R>
+          && std::ranges::common_range<R>) {
+            auto first = std::ranges::begin(range);
+            auto remaining = static_cast<size_t>(std::ranges::size(range));
+            reserve(_size + remaining);
+            while (remaining > 0) {
+                maybe_add_capacity();
+                auto& frag = _frags.back();
+                const auto n = std::min(remaining, _capacity - _size);
+                auto last = std::ranges::next(first, n);
+                frag.insert(frag.end(), first, last);
+                first = last;
+                remaining -= n;
+                _size += n;
+            }
+            update_generation();
+        } else {
+            for (auto&& e : range) {
+                push_back(std::forward<decltype(e)>(e));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is not ordered
+     * before `value`. The vector must be sorted with respect to `comp`.
+     *
+     * Equivalent to std::lower_bound(begin(), end(), value, comp), but the
+     * fragments are searched first by their last element and then the
+     * contiguous memory of a single fragment is searched. This avoids the
+     * per element index arithmetic of the iterators.
+     */
+    template<typename U, typename Compare = std::less<>>
+    const_iterator lower_bound(const U& value, Compare comp = {}) const {
+        return const_iterator(this, lower_bound_index(value, comp));
+    }
+
+    template<typename U, typename Compare = std::less<>>
+    iterator lower_bound(const U& value, Compare comp = {}) {
+        return iterator(this, lower_bound_index(value, comp));
+    }
+
     template<typename... Args>
     static fragmented_vector single(Args&&... args) {
         fragmented_vector v;
@@ -509,6 +562,23 @@ public:
     }
 
 private:
+    template<typename U, typename Compare>
+    size_t lower_bound_index(const U& value, Compare& comp) const {
+        static constexpr size_t elems_per_frag = calc_elems_per_frag();
+        // only the last fragment can be empty, e.g. after reserve()
+        auto frag_it = std::partition_point(
+          _frags.begin(), _frags.end(), [&value, &comp](const auto& frag) {
+              return !frag.empty() && comp(frag.back(), value);
+          });
+        if (frag_it == _frags.end()) {
+            return _size;
+        }
+        auto it = std::lower_bound(
+          frag_it->begin(), frag_it->end(), value, comp);
+        return static_cast<size_t>(frag_it - _frags.begin()) * elems_per_frag
+               + static_cast<size_t>(it - frag_it->begin());
+    }
+
     [[gnu::always_inline]] void maybe_add_capacity() {
         if (_size == _capacity) [[unlikely]] {
             add_capacity();
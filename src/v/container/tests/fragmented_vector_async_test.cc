@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "base/seastarx.h"
+#include "container/chunked_hash_map.h"
 #include "container/fragmented_vector.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -56,3 +57,30 @@ SEASTAR_THREAD_TEST_CASE(fragmented_vector_clear_async_test) {
     fragmented_vector_clear_async(v).get();
     BOOST_REQUIRE(v.size() == 0);
 }
+
+SEASTAR_THREAD_TEST_CASE(chunked_hash_map_clear_async_test) {
+    chunked_hash_map<size_t, size_t> map;
+    chunked_hash_map_clear_async(map).get();
+    BOOST_REQUIRE(map.empty());
+
+    // many fragments
+    constexpr size_t count = 100000;
+    for (size_t i = 0; i < count; ++i) {
+        map.emplace(i, i);
+    }
+    BOOST_REQUIRE_EQUAL(map.size(), count);
+    chunked_hash_map_clear_async(map).get();
+    BOOST_REQUIRE(map.empty());
+    BOOST_REQUIRE(map.find(1) == map.end());
+
+    // the map is usable afterwards
+    map.emplace(1, 2);
+    BOOST_REQUIRE_EQUAL(map.at(1), 2);
+
+    chunked_hash_set<size_t> set;
+    for (size_t i = 0; i < count; ++i) {
+        set.emplace(i);
+    }
+    chunked_hash_map_clear_async(set).get();
+    BOOST_REQUIRE(set.empty());
+}
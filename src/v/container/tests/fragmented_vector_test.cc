@@ -22,8 +22,10 @@
 #include <cstdint>
 #include <initializer_list>
 #include <limits>
+#include <list>
 #include <memory>
 #include <numeric>
+#include <ranges>
 #include <span>
 #include <stdexcept>
 #include <type_traits>
@@ -569,4 +571,65 @@ TEST(ChunkedVector, InPlaceSingleElement) {
     ASSERT_THAT(v, ElementsAre(std::make_pair("a2", 3)));
 }
 
+TEST(Vector, AppendRange) {
+    std::vector<int> vals(25);
+    std::iota(vals.begin(), vals.end(), 0);
+
+    // small fragment size to stress multiple fragments
+    fragmented_vector<int, 8> v;
+    v.append_range(std::vector<int>{});
+    EXPECT_THAT(v, IsValid());
+    EXPECT_THAT(v, IsEmpty());
+    v.push_back(-1);
+    v.append_range(vals);
+    EXPECT_THAT(v, IsValid());
+    std::vector<int> expected{-1};
+    expected.insert(expected.end(), vals.begin(), vals.end());
+    EXPECT_THAT(v, ElementsAreArray(expected));
+
+    chunked_vector<int> cv;
+    cv.append_range(vals);
+    cv.append_range(vals);
+    EXPECT_THAT(cv, IsValid());
+    expected.assign(vals.begin(), vals.end());
+    expected.insert(expected.end(), vals.begin(), vals.end());
+    EXPECT_THAT(cv, ElementsAreArray(expected));
+
+    // ranges which are not sized are appended element by element
+    std::list<int> list{1, 2, 3};
+    cv.clear();
+    cv.append_range(list | std::views::filter([](int i) { return i != 2; }));
+    EXPECT_THAT(cv, IsValid());
+    EXPECT_THAT(cv, ElementsAre(1, 3));
+}
+
+TEST(Vector, LowerBound) {
+    auto check = [](auto& v) {
+        for (int i = -1; i <= 2 * static_cast<int>(v.size()) + 1; ++i) {
+            auto expected = std::lower_bound(v.begin(), v.end(), i);
+            EXPECT_EQ(v.lower_bound(i), expected) << "value " << i;
+            const auto& cv = v;
+            EXPECT_EQ(cv.lower_bound(i), expected) << "value " << i;
+        }
+    };
+
+    fragmented_vector<int, 8> v;
+    check(v);
+    chunked_vector<int> cv;
+    cv.reserve(4);
+    check(cv);
+    // even values with duplicates, spanning several fragments
+    for (int i = 0; i < 20; ++i) {
+        v.push_back(i - (i % 2));
+        cv.push_back(i - (i % 2));
+    }
+    check(v);
+    check(cv);
+
+    auto it = v.lower_bound(10, std::less<>{});
+    ASSERT_NE(it, v.end());
+    EXPECT_EQ(*it, 10);
+    EXPECT_EQ(it - v.begin(), 10);
+}
+
 } // namespace
@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 
+#include "container/chunked_hash_map.h"
 #include "container/contiguous_range_map.h"
 #include "container/tests/bench_utils.h"
 #include "random/generators.h"
@@ -16,6 +17,7 @@
 #include <seastar/testing/perf_tests.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <boost/range/irange.hpp>
 
 template<typename MapT, size_t KeySetSize, size_t FillPercent>
@@ -137,6 +139,8 @@ template<typename K, typename V>
 using std_map = std::map<K, V>;
 template<typename K, typename V>
 using absl_btree_map = absl::btree_map<K, V>;
+template<typename K, typename V>
+using absl_flat_hash_map = absl::flat_hash_map<K, V>;
 
 INT_KEY_MAP_PERF_TEST(std_map, uint64_t, large_struct, full, 1000);
 INT_KEY_MAP_PERF_TEST(std_map, uint64_t, large_struct, full, 100000);
@@ -156,3 +160,18 @@ INT_KEY_MAP_PERF_TEST(
   contiguous_range_map, uint64_t, large_struct, half_full, 1000);
 INT_KEY_MAP_PERF_TEST(
   contiguous_range_map, uint64_t, large_struct, half_full, 100000);
+
+INT_KEY_MAP_PERF_TEST(absl_flat_hash_map, uint64_t, large_struct, full, 1000);
+INT_KEY_MAP_PERF_TEST(
+  absl_flat_hash_map, uint64_t, large_struct, full, 100000);
+INT_KEY_MAP_PERF_TEST(
+  absl_flat_hash_map, uint64_t, large_struct, half_full, 1000);
+INT_KEY_MAP_PERF_TEST(
+  absl_flat_hash_map, uint64_t, large_struct, half_full, 100000);
+
+INT_KEY_MAP_PERF_TEST(chunked_hash_map, uint64_t, large_struct, full, 1000);
+INT_KEY_MAP_PERF_TEST(chunked_hash_map, uint64_t, large_struct, full, 100000);
+INT_KEY_MAP_PERF_TEST(
+  chunked_hash_map, uint64_t, large_struct, half_full, 1000);
+INT_KEY_MAP_PERF_TEST(
+  chunked_hash_map, uint64_t, large_struct, half_full, 100000);
@@ -73,6 +73,39 @@ public:
         perf_tests::stop_measuring_time();
     }
 
+    void run_append_range_test() {
+        std::vector<typename Vector::value_type> src;
+        std::generate_n(std::back_inserter(src), Size, make_value);
+        Vector v;
+        perf_tests::start_measuring_time();
+        if constexpr (requires { v.append_range(src); }) {
+            v.append_range(src);
+        } else {
+            v.insert(v.end(), src.begin(), src.end());
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(v.back());
+    }
+
+    void run_lower_bound_test() {
+        auto v = make_filled();
+        std::sort(v.begin(), v.end());
+        std::vector<typename Vector::value_type> needles;
+        std::generate_n(std::back_inserter(needles), 1000, [&v]() {
+            return v[random_generators::get_int<size_t>(0, v.size() - 1)];
+        });
+        perf_tests::start_measuring_time();
+        for (const auto& needle : needles) {
+            if constexpr (requires { v.lower_bound(needle); }) {
+                perf_tests::do_not_optimize(v.lower_bound(needle));
+            } else {
+                perf_tests::do_not_optimize(
+                  std::lower_bound(v.begin(), v.end(), needle));
+            }
+        }
+        perf_tests::stop_measuring_time();
+    }
+
     void run_random_access_test() {
         auto v = make_filled();
         std::vector<size_t> indexes;
@@ -110,6 +143,14 @@ public:
     PERF_TEST_F(                                                               \
       VectorBenchTest_##container##_##element##_##size, RandomAccess) {        \
         run_random_access_test();                                              \
+    }                                                                          \
+    PERF_TEST_F(                                                               \
+      VectorBenchTest_##container##_##element##_##size, AppendRange) {         \
+        run_append_range_test();                                               \
+    }                                                                          \
+    PERF_TEST_F(                                                               \
+      VectorBenchTest_##container##_##element##_##size, LowerBound) {          \
+        run_lower_bound_test();                                                \
     }
 // NOLINTEND(*-macro-*)
 
@@ -44,7 +44,7 @@ coordinator_manager::coordinator_manager(
   , topics_(topics.local())
   , topics_fe_(topics_fe)
   , schema_registry_(schema::registry::make_default(sr_api))
-  , manifest_io_(io.local(), bucket)
+  , manifest_io_(io.local(), bucket, manifest_cache_size_bytes)
   , catalog_factory_(std::move(catalog_factory))
   , type_resolver_(
       std::make_unique<record_schema_resolver>(*schema_registry_)) {}
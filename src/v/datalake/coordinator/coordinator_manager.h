@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include "base/units.h"
 #include "cloud_io/remote.h"
 #include "cluster/fwd.h"
 #include "cluster/notification.h"
@@ -71,6 +72,11 @@ private:
     ss::sharded<cluster::topics_frontend>& topics_fe_;
     std::unique_ptr<schema::registry> schema_registry_;
 
+    // Serialized size of the Iceberg metadata kept in memory across commits,
+    // so that appends don't download the manifest list and recent manifests
+    // they just wrote.
+    static constexpr size_t manifest_cache_size_bytes = 16_MiB;
+
     // Underlying IO is expected to outlive this class.
     iceberg::manifest_io manifest_io_;
     std::unique_ptr<catalog_factory> catalog_factory_;
@@ -206,6 +206,13 @@ std::chrono::milliseconds datalake_manager::translation_interval_ms() const {
     return std::max(min_translation_interval, _iceberg_commit_interval() / 3);
 }
 
+std::chrono::milliseconds datalake_manager::max_translation_delay_ms() const {
+    // Small translations of slow moving partitions are deferred to avoid tiny
+    // parquet files, but every partition still has its data translated at
+    // least once per commit interval.
+    return std::max(translation_interval_ms(), _iceberg_commit_interval());
+}
+
 void datalake_manager::on_group_notification(const model::ntp& ntp) {
     auto partition = _partition_mgr->local().get(ntp);
     if (!partition || !model::is_user_topic(ntp)) {
@@ -236,6 +243,10 @@ void datalake_manager::on_group_notification(const model::ntp& ntp) {
         if (it->second->translation_interval() != target_interval) {
             it->second->reset_translation_interval(target_interval);
         }
+        auto target_delay = max_translation_delay_ms();
+        if (it->second->max_translation_delay() != target_delay) {
+            it->second->reset_max_translation_delay(target_delay);
+        }
     }
 }
 
@@ -257,6 +268,7 @@ void datalake_manager::start_translator(
       make_type_resolver(mode, *_schema_registry, *_schema_cache),
       make_record_translator(mode),
       translation_interval_ms(),
+      max_translation_delay_ms(),
       _sg,
       _effective_max_translator_buffered_data,
       &_parallel_translations);
@@ -73,6 +73,7 @@ private:
     using translator_map = chunked_hash_map<model::ntp, translator>;
 
     std::chrono::milliseconds translation_interval_ms() const;
+    std::chrono::milliseconds max_translation_delay_ms() const;
     void on_group_notification(const model::ntp&);
     void start_translator(
       ss::lw_shared_ptr<cluster::partition>, model::iceberg_mode);
@@ -51,7 +51,10 @@ checked<resolved_type, type_resolver::errc> translate_avro_schema(
         }
 
         return resolved_type{
-                .schema = resolved_schema(std::cref(avro_schema), std::move(schema)),
+                .schema = resolved_schema(
+                  std::cref(avro_schema),
+                  std::move(schema),
+                  ss::make_lw_shared<const avro_value_plan>(avro_schema)),
                 .id = { .schema_id = id, .protobuf_offsets = std::nullopt, },
                 .type = std::move(result.value()),
                 .type_name = avro_schema.root()->name().fullname(),
@@ -70,7 +73,6 @@ checked<resolved_type, type_resolver::errc> translate_protobuf_schema(
   ppsr::schema_id id,
   std::vector<int32_t> protobuf_offsets,
   shared_schema_t schema) {
-    // TODO: maybe there's another caching opportunity here.
     auto d_res = descriptor(pb_def, protobuf_offsets);
     if (d_res.has_error()) {
         return type_resolver::errc::bad_input;
@@ -79,7 +81,10 @@ checked<resolved_type, type_resolver::errc> translate_protobuf_schema(
     try {
         auto type = type_to_iceberg(*d).value();
         return resolved_type{
-          .schema = resolved_schema(*d, std::move(schema)),
+          .schema = resolved_schema(
+            *d,
+            std::move(schema),
+            ss::make_lw_shared<const protobuf_value_plan>(*d)),
           .id
           = {.schema_id = id, .protobuf_offsets = std::move(protobuf_offsets)},
           .type = std::move(type),
@@ -94,6 +99,15 @@ checked<resolved_type, type_resolver::errc> translate_protobuf_schema(
     }
 }
 
+resolved_type copy_resolved_type(const resolved_type& t) {
+    return resolved_type{
+      .schema = t.schema,
+      .id = t.id,
+      .type = iceberg::make_copy(t.type),
+      .type_name = t.type_name,
+    };
+}
+
 struct schema_translating_visitor {
     schema_translating_visitor(
       iobuf b, ppsr::schema_id id, shared_schema_t schema)
@@ -308,14 +322,48 @@ record_schema_resolver::resolve_buf_type(std::optional<iobuf> b) const {
     auto schema_id = schema_id_res.schema_id;
     auto buf_no_id = std::move(schema_id_res.shared_message_data);
 
+    if (
+      last_resolved_.has_value()
+      && last_resolved_->id.schema_id == schema_id) {
+        if (auto reused = reuse_last_resolved(buf_no_id); reused.has_value()) {
+            co_return std::move(reused).value();
+        }
+    }
+
     auto schema_res = co_await get_schema(schema_id);
     if (schema_res.has_error()) {
         co_return schema_res.error();
     }
 
     auto shared_schema = schema_res.value();
-    co_return shared_schema->visit(schema_translating_visitor{
+    auto res = shared_schema->visit(schema_translating_visitor{
       std::move(buf_no_id), schema_id, shared_schema});
+    if (res.has_value() && res.value().type.has_value()) {
+        last_resolved_ = copy_resolved_type(res.value().type.value());
+    }
+    co_return res;
+}
+
+std::optional<checked<type_and_buf, type_resolver::errc>>
+record_schema_resolver::reuse_last_resolved(iobuf& buf_no_id) const {
+    const auto& last = last_resolved_.value();
+    if (!last.id.protobuf_offsets.has_value()) {
+        return type_and_buf{
+          .type = copy_resolved_type(last),
+          .parsable_buf = std::move(buf_no_id)};
+    }
+    auto offsets_res = get_proto_offsets(buf_no_id);
+    if (offsets_res.has_error()) {
+        return type_resolver::errc::bad_input;
+    }
+    auto& offsets = offsets_res.value();
+    if (offsets.protobuf_offsets != last.id.protobuf_offsets.value()) {
+        // Same file descriptor but a different message, translate it
+        return std::nullopt;
+    }
+    return type_and_buf{
+      .type = copy_resolved_type(last),
+      .parsable_buf = std::move(offsets.shared_message_data)};
 }
 
 ss::future<checked<resolved_type, type_resolver::errc>>
@@ -11,6 +11,8 @@
 
 #include "base/seastarx.h"
 #include "datalake/schema_identifier.h"
+#include "datalake/values_avro.h"
+#include "datalake/values_protobuf.h"
 #include "iceberg/datatypes.h"
 #include "metrics/metrics.h"
 #include "pandaproxy/schema_registry/types.h"
@@ -76,17 +78,28 @@ public:
     using resolved_schema_t = std::variant<
       std::reference_wrapper<const google::protobuf::Descriptor>,
       std::reference_wrapper<const avro::ValidSchema>>;
-
-    resolved_schema(resolved_schema_t schema, shared_schema_t shared_schema)
+    // Decoding of record values, compiled once when the schema is resolved
+    using value_plan_t = std::variant<
+      ss::lw_shared_ptr<const protobuf_value_plan>,
+      ss::lw_shared_ptr<const avro_value_plan>>;
+
+    resolved_schema(
+      resolved_schema_t schema,
+      shared_schema_t shared_schema,
+      value_plan_t value_plan)
       : schema_(schema)
-      , shared_schema_(std::move(shared_schema)) {}
+      , shared_schema_(std::move(shared_schema))
+      , value_plan_(std::move(value_plan)) {}
 
     resolved_schema_t get_schema_ref() const noexcept { return schema_; }
+    const value_plan_t& get_value_plan() const noexcept { return value_plan_; }
 
 private:
-    // Note that `schema_` is a reference to data owned by `shared_schema_`.
+    // Note that `schema_` and the plan refer to data owned by
+    // `shared_schema_`.
     resolved_schema_t schema_;
     shared_schema_t shared_schema_;
+    value_plan_t value_plan_;
 };
 
 struct resolved_type {
@@ -158,9 +171,20 @@ public:
 private:
     schema::registry& sr_;
     std::optional<std::reference_wrapper<schema_cache>> cache_;
+    // The type of the previously resolved record. Records of a partition
+    // usually share a single schema, reusing the last translation skips the
+    // cache lookup and the conversion to an Iceberg type for every run of
+    // records with the same schema id (and message index path, for
+    // protobuf).
+    mutable std::optional<resolved_type> last_resolved_;
 
     ss::future<checked<shared_schema_t, type_resolver::errc>>
       get_schema(pandaproxy::schema_registry::schema_id) const;
+
+    // Returns std::nullopt if the record doesn't match the last resolved
+    // type.
+    std::optional<checked<type_and_buf, type_resolver::errc>>
+    reuse_last_resolved(iobuf& buf_no_id) const;
 };
 
 } // namespace datalake
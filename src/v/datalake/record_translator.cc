@@ -34,11 +34,12 @@ struct value_translating_visitor {
     const iceberg::field_type& type;
 
     ss::future<optional_value_outcome>
-    operator()(const google::protobuf::Descriptor& d) {
-        return deserialize_protobuf(std::move(parsable_buf), d);
+    operator()(const ss::lw_shared_ptr<const protobuf_value_plan>& plan) {
+        return deserialize_protobuf(std::move(parsable_buf), *plan);
     }
-    ss::future<optional_value_outcome> operator()(const avro::ValidSchema& s) {
-        auto value = co_await deserialize_avro(std::move(parsable_buf), s);
+    ss::future<optional_value_outcome>
+    operator()(const ss::lw_shared_ptr<const avro_value_plan>& plan) {
+        auto value = co_await deserialize_avro(std::move(parsable_buf), *plan);
         if (value.has_error()) {
             co_return optional_value_outcome(value.error());
         }
@@ -239,7 +240,7 @@ structured_data_translator::translate_data(
 
     auto translated_val = co_await std::visit(
       value_translating_visitor{std::move(*parsable_val), val_type->type},
-      val_type->schema.get_schema_ref());
+      val_type->schema.get_value_plan());
     if (translated_val.has_error()) {
         vlog(
           datalake_log.error,
@@ -3,22 +3,24 @@
 #include "base/vlog.h"
 #include "datalake/logger.h"
 #include "datalake/schema_parquet.h"
+#include "datalake/table_definition.h"
 #include "datalake/values_parquet.h"
 
 namespace datalake {
 
 ss::future<writer_error>
 serde_parquet_writer::add_data_struct(iceberg::struct_value value, size_t) {
-    auto conversion_result = co_await to_parquet_value(
-      std::make_unique<iceberg::struct_value>(std::move(value)));
-    if (conversion_result.has_error()) {
+    // The row is shredded straight into the column values, the buffer is
+    // reused across rows.
+    _shredded.clear();
+    auto shredding_result = shred_parquet_value(
+      _writer.schema(), std::move(value), _shredded);
+    if (shredding_result.has_error()) {
         co_return writer_error::parquet_conversion_error;
     }
 
-    auto group = std::get<serde::parquet::group_value>(
-      std::move(conversion_result.value()));
     try {
-        co_await _writer.write_row(std::move(group));
+        _writer.write_shredded_row(_shredded);
     } catch (...) {
         vlog(
           datalake_log.warn,
@@ -37,7 +39,16 @@ ss::future<writer_error> serde_parquet_writer::finish() {
 ss::future<std::unique_ptr<parquet_ostream>>
 serde_parquet_writer_factory::create_writer(
   const iceberg::struct_type& schema, ss::output_stream<char> out) {
-    serde::parquet::writer::options opts{.schema = schema_to_parquet(schema)};
+    serde::parquet::writer::options opts{
+      .schema = schema_to_parquet(schema),
+      .dictionary_encoding = true,
+      .type_specific_encoding = true,
+      // Lookups by key are the most common point queries, min/max stats can't
+      // prune them as keys are rarely ordered within a file.
+      .page_index = true,
+      .bloom_filter_columns = chunked_vector<ss::sstring>::single(
+        fmt::format("{}.key", rp_struct_name)),
+    };
     serde::parquet::writer writer(std::move(opts), std::move(out));
     co_await writer.init();
     co_return std::make_unique<serde_parquet_writer>(std::move(writer));
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "container/fragmented_vector.h"
 #include "datalake/data_writer_interface.h"
 #include "iceberg/datatypes.h"
 #include "serde/parquet/writer.h"
@@ -16,6 +17,7 @@ public:
 
 private:
     serde::parquet::writer _writer;
+    chunked_vector<serde::parquet::shredded_value> _shredded;
 };
 
 class serde_parquet_writer_factory : public parquet_ostream_factory {
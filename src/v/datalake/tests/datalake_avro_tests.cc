@@ -1185,3 +1185,37 @@ INSTANTIATE_TEST_SUITE_P(
     "tl_union",
     "big_record",
     "logical_types"));
+
+TEST(AvroValuePlan, TestPlanReusedForManyMessages) {
+    auto valid_schema = avro::compileJsonSchemaFromString(
+      std::string(big_record));
+    datalake::avro_value_plan plan(valid_schema);
+    avro_generator gen({});
+    for (int i = 0; i < 100; ++i) {
+        auto datum = gen.generate_datum(valid_schema.root());
+        auto buffer = serialize_with_avro(datum, valid_schema);
+
+        auto planned = datalake::deserialize_avro(buffer.copy(), plan).get();
+        ASSERT_TRUE(planned.has_value());
+        ASSERT_TRUE(value_matches(datum, planned.value(), false));
+    }
+}
+
+TEST(AvroValuePlan, TestRecursiveSchema) {
+    // Recursive types can't be represented in iceberg, but building the plan
+    // must terminate and the messages themselves are finite.
+    auto valid_schema = avro::compileJsonSchemaFromString(
+      std::string(tree_node));
+    datalake::avro_value_plan plan(valid_schema);
+
+    // payload = 1, no edges
+    iobuf buffer;
+    buffer.append("\x02\x00", 2);
+    auto value = datalake::deserialize_avro(std::move(buffer), plan).get();
+    ASSERT_TRUE(value.has_value());
+
+    auto expected = std::make_unique<iceberg::struct_value>();
+    expected->fields.emplace_back(iceberg::int_value{1});
+    expected->fields.emplace_back(std::make_unique<iceberg::map_value>());
+    ASSERT_EQ(value.value(), iceberg::value{std::move(expected)});
+}
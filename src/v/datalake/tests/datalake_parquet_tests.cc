@@ -13,6 +13,7 @@
 #include "datalake/values_parquet.h"
 #include "gtest/gtest.h"
 #include "iceberg/tests/value_generator.h"
+#include "serde/parquet/shredder.h"
 #include "test_utils/randoms.h"
 using namespace testing;
 namespace {
@@ -905,3 +906,76 @@ TEST(DataParquetValues, TestNestedStruct) {
     ASSERT_FALSE(result.has_error());
     ASSERT_TRUE(validate_value(test_value, result.value()));
 }
+
+namespace {
+
+chunked_vector<serde::parquet::shredded_value> shred_value_tree(
+  const serde::parquet::schema_element& schema, iceberg::value value) {
+    auto result = datalake::to_parquet_value(std::move(value)).get();
+    chunked_vector<serde::parquet::shredded_value> out;
+    serde::parquet::shred_record(
+      schema,
+      std::get<serde::parquet::group_value>(std::move(result.value())),
+      [&out](serde::parquet::shredded_value sv) {
+          out.push_back(std::move(sv));
+          return ss::now();
+      })
+      .get();
+    return out;
+}
+
+} // namespace
+
+TEST(DataParquetValues, DirectShreddingMatchesValueTree) {
+    iceberg::struct_type type;
+    type.fields.push_back(iceberg::nested_field::create(
+      0, "primitives", iceberg::field_required::no, primitive_types()));
+    type.fields.push_back(iceberg::nested_field::create(
+      1, "lists", iceberg::field_required::no, list_types()));
+    type.fields.push_back(iceberg::nested_field::create(
+      2, "maps", iceberg::field_required::yes, map_types()));
+    auto schema = datalake::schema_to_parquet(type);
+    serde::parquet::index_schema(schema);
+    auto schema_field = iceberg::field_type{std::move(type)};
+
+    chunked_vector<serde::parquet::shredded_value> direct;
+    for (int i = 0; i < 50; ++i) {
+        auto value = iceberg::tests::make_value(
+          {.pattern = iceberg::tests::value_pattern::random, .null_pct = 25},
+          schema_field);
+        auto expected = shred_value_tree(schema, iceberg::make_copy(value));
+
+        direct.clear();
+        auto result = datalake::shred_parquet_value(
+          schema,
+          std::move(*std::get<std::unique_ptr<iceberg::struct_value>>(value)),
+          direct);
+        ASSERT_FALSE(result.has_error());
+        ASSERT_EQ(direct.size(), expected.size());
+        for (size_t j = 0; j < direct.size(); ++j) {
+            EXPECT_EQ(
+              direct[j].schema_element_position,
+              expected[j].schema_element_position);
+            EXPECT_EQ(direct[j].val, expected[j].val);
+            EXPECT_EQ(direct[j].rep_level, expected[j].rep_level);
+            EXPECT_EQ(direct[j].def_level, expected[j].def_level);
+        }
+    }
+}
+
+TEST(DataParquetValues, DirectShreddingRejectsRequiredNulls) {
+    auto type = primitive_types();
+    auto schema = datalake::schema_to_parquet(type);
+    serde::parquet::index_schema(schema);
+    auto value = iceberg::tests::make_struct_value(
+      {}, iceberg::field_type{std::move(type)});
+    // All the primitive fields are required, the values shredded for the
+    // preceding fields must not be left behind.
+    value.fields.back() = std::nullopt;
+
+    chunked_vector<serde::parquet::shredded_value> out;
+    auto result = datalake::shred_parquet_value(
+      schema, std::move(value), out);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_TRUE(out.empty());
+}
@@ -572,6 +572,59 @@ TEST_CORO(values_protobuf, TestNotSupportedMessageType) {
     }
 }
 
+TEST_CORO(values_protobuf, TestUnsetRecursiveMessage) {
+    // Recursion is detected when the plan is built, but it is only an error
+    // if the recursive field is present.
+    RecursiveMessage recursive;
+    recursive.set_field(10);
+    datalake::protobuf_value_plan plan(*recursive.GetDescriptor());
+
+    auto result = co_await datalake::deserialize_protobuf(
+      iobuf::from(recursive.SerializeAsString()), plan);
+    ASSERT_TRUE_CORO(result.has_value());
+    auto opt_value = std::move(result.value());
+    ASSERT_TRUE_CORO(opt_value.has_value());
+    auto result_value = std::get<std::unique_ptr<struct_value>>(
+      std::move(opt_value.value()));
+    EXPECT_THAT(
+      result_value->fields,
+      ElementsAre(OptionalIcebergPrimitive<int_value>(10), Eq(std::nullopt)));
+
+    recursive.mutable_recursive()->set_field(12);
+    result = co_await datalake::deserialize_protobuf(
+      iobuf::from(recursive.SerializeAsString()), plan);
+    ASSERT_TRUE_CORO(result.has_error());
+}
+
+TEST_CORO(values_protobuf, TestPlanReusedForManyMessages) {
+    datalake::protobuf_value_plan plan(*Person::GetDescriptor());
+    for (int i = 0; i < 10; ++i) {
+        Person message;
+        message.set_id(i);
+        message.set_name(fmt::format("person {}", i));
+        message.mutable_dept()->set_id(1024 + i);
+
+        auto result = co_await datalake::deserialize_protobuf(
+          iobuf::from(message.SerializeAsString()), plan);
+        ASSERT_TRUE_CORO(result.has_value());
+        auto opt_value = std::move(result.value());
+        ASSERT_TRUE_CORO(opt_value.has_value());
+        auto result_value = std::get<std::unique_ptr<struct_value>>(
+          std::move(opt_value.value()));
+        EXPECT_THAT(
+          result_value->fields,
+          ElementsAre(
+            OptionalIcebergPrimitive<string_value>(
+              fmt::format("person {}", i)),
+            OptionalIcebergPrimitive<int_value>(i),
+            OptionalIcebergPrimitive<string_value>(""),
+            IcebergStruct(
+              OptionalIcebergPrimitive<int_value>(1024 + i),
+              OptionalIcebergPrimitive<string_value>("")),
+            OptionalIcebergPrimitive<string_value>("")));
+    }
+}
+
 //  syntax = "proto2";
 // message MessageWithOptionalFields {
 //     message Nested {
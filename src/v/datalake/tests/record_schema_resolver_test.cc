@@ -231,6 +231,50 @@ TEST_F(RecordSchemaResolverTest, TestProtobufSchemaBadOffsets) {
     ASSERT_EQ(res.error(), type_resolver::errc::bad_input);
 }
 
+TEST_F(RecordSchemaResolverTest, TestProtobufSchemaMessageChanges) {
+    auto make_buf = [](const std::vector<int32_t>& pb_offsets) {
+        iobuf buf;
+        buf.append("\0\0\0\0\2", 5);
+        buf.append(encode_pb_offsets(pb_offsets));
+        buf.append(generate_dummy_body());
+        return buf;
+    };
+    const auto simple_type = field_type{[] {
+        auto expected_struct = struct_type{};
+        expected_struct.fields.emplace_back(nested_field::create(
+          1, "inner_label_1", field_required::no, string_type{}));
+        expected_struct.fields.emplace_back(nested_field::create(
+          2, "inner_number_1", field_required::no, int_type{}));
+        return expected_struct;
+    }()};
+    const auto empty_type = field_type{struct_type{}};
+
+    // Consecutive records of the same schema id may point at different
+    // messages of the file descriptor, each needs its own type.
+    auto resolver = record_schema_resolver(*sr);
+    for (const auto& [offsets, expected] :
+         std::vector<std::pair<std::vector<int32_t>, const field_type*>>{
+           {{2, 0}, &simple_type},
+           {{2, 0}, &simple_type},
+           {{0}, &empty_type},
+           {{2, 0}, &simple_type},
+         }) {
+        auto res = resolver.resolve_buf_type(make_buf(offsets)).get();
+        ASSERT_FALSE(res.has_error());
+        auto& resolved_buf = res.value();
+        ASSERT_TRUE(resolved_buf.type.has_value());
+        EXPECT_EQ(resolved_buf.type->id.protobuf_offsets.value(), offsets);
+        EXPECT_EQ(resolved_buf.type->type, *expected);
+        ASSERT_TRUE(resolved_buf.parsable_buf.has_value());
+        EXPECT_EQ(*resolved_buf.parsable_buf, generate_dummy_body());
+    }
+
+    // Bad offsets are still rejected after a successful resolution.
+    auto res = resolver.resolve_buf_type(make_buf({100})).get();
+    ASSERT_TRUE(res.has_error());
+    ASSERT_EQ(res.error(), type_resolver::errc::bad_input);
+}
+
 TEST_F(RecordSchemaResolverTest, TestMissingMagic) {
     iobuf buf;
     // Write body but no magic.
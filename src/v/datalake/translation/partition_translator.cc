@@ -10,6 +10,7 @@
 
 #include "datalake/translation/partition_translator.h"
 
+#include "base/units.h"
 #include "cluster/archival/types.h"
 #include "cluster/partition.h"
 #include "datalake/coordinator/frontend.h"
@@ -110,6 +111,7 @@ private:
 } // namespace
 
 static constexpr std::chrono::milliseconds translation_jitter{500};
+static constexpr size_t default_min_bytes_per_translation = 32_MiB;
 constexpr ::model::timeout_clock::duration wait_timeout = 5s;
 
 partition_translator::~partition_translator() = default;
@@ -122,6 +124,7 @@ partition_translator::partition_translator(
   std::unique_ptr<type_resolver> type_resolver,
   std::unique_ptr<record_translator> record_translator,
   std::chrono::milliseconds translation_interval,
+  std::chrono::milliseconds max_translation_delay,
   ss::scheduling_group sg,
   size_t reader_max_bytes,
   std::unique_ptr<ssx::semaphore>* parallel_translations)
@@ -142,6 +145,11 @@ partition_translator::partition_translator(
       kafka::make_partition_proxy(_partition)))
   , _jitter{translation_interval, translation_jitter}
   , _max_bytes_per_reader(reader_max_bytes)
+  , _min_bytes_per_translation(
+      std::min(reader_max_bytes, default_min_bytes_per_translation))
+  , _max_translation_delay(max_translation_delay)
+  , _translated_log_size(_partition->size_bytes())
+  , _last_translation(ss::lowres_clock::now())
   , _parallel_translations(parallel_translations)
   , _writer_scratch_space(std::filesystem::temp_directory_path())
   , _logger(prefix_logger{
@@ -181,6 +189,27 @@ void partition_translator::reset_translation_interval(
       _jitter.base_duration());
 }
 
+std::chrono::milliseconds partition_translator::max_translation_delay() const {
+    return _max_translation_delay;
+}
+
+void partition_translator::reset_max_translation_delay(
+  std::chrono::milliseconds delay) {
+    _max_translation_delay = delay;
+    vlog(_logger.info, "Iceberg max translation delay reset to: {}", delay);
+}
+
+bool partition_translator::should_defer_translation() const {
+    // Retention may shrink the log in the meantime, which only underestimates
+    // the pending data and is bounded by the delay.
+    auto log_size = _partition->size_bytes();
+    auto pending_bytes = log_size - std::min(log_size, _translated_log_size);
+    if (pending_bytes >= _min_bytes_per_translation) {
+        return false;
+    }
+    return ss::lowres_clock::now() - _last_translation < _max_translation_delay;
+}
+
 ss::future<> partition_translator::stop() {
     vlog(_logger.debug, "stopping partition translator in term {}", _term);
     auto f = _gate.close();
@@ -306,21 +335,27 @@ partition_translator::do_translate_once(retry_chain_node& parent_rcn) {
         _partition->probe().update_iceberg_translation_offset_lag(0);
         co_return translation_success::yes;
     }
+    // The resulting parquet files are only performant if there is a big chunk
+    // of data in them, let a slow moving partition accumulate more data.
+    if (should_defer_translation()) {
+        vlog(
+          _logger.debug,
+          "deferring translation of kafka range: [{}, {}], too little new "
+          "data since the last translation",
+          read_begin_offset,
+          read_end_offset);
+        update_translation_lag(kafka::prev_offset(read_begin_offset));
+        co_return translation_success::yes;
+    }
     // We have some data to translate, make a reader
     // and dispatch to the iceberg translator
-    //
-    // todo: what if we have too little to read, eg: slow moving topic.
-    // Currently we rely on user setting the translation interval
-    // appropriately to ensure each attempt has something substantial
-    // to read. We can add some heuristics to estimate the size and
-    // backoff if it is too small and wait for enough data to
-    // accumulate. The resulting parquet files are only performant
-    // if there is a big chunk of data in them. Smaller parquet files
-    // are an overhead for iceberg metadata.
     auto units = co_await ss::get_units(**_parallel_translations, 1, _as);
 
+    auto log_size = _partition->size_bytes();
     auto translation_result = co_await do_translation_for_range(
       parent_rcn, read_begin_offset, read_end_offset);
+    _translated_log_size = log_size;
+    _last_translation = ss::lowres_clock::now();
 
     // release units and checkpoint outside of the lock.
     units.return_all();
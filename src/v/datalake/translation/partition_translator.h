@@ -59,9 +59,16 @@ namespace datalake::translation {
  * while (!aborted && !term_changed):
  *    sleep(interval)
  *    reconcile_with_coordinator()
+ *    if too_little_new_data() && !waited_max_translation_delay():
+ *        continue
  *    md = translate_newly_arrived_data_since_last_checkpoint()
  *    checkpoint_with_coordinator(md)
  *    sync_stm_with_coordinator(md)
+ *
+ * Translating a slow moving partition on every interval produces many tiny
+ * parquet files, each of which is an overhead for iceberg metadata and for
+ * the catalog commits. Small translations are deferred for up to the max
+ * translation delay so the data accumulates into fewer, larger files.
  */
 
 class partition_translator {
@@ -75,6 +82,7 @@ public:
       std::unique_ptr<type_resolver> type_resolver,
       std::unique_ptr<record_translator> record_translator,
       std::chrono::milliseconds translation_interval,
+      std::chrono::milliseconds max_translation_delay,
       ss::scheduling_group sg,
       size_t reader_max_bytes,
       std::unique_ptr<ssx::semaphore>* parallel_translations);
@@ -87,6 +95,9 @@ public:
     std::chrono::milliseconds translation_interval() const;
     void reset_translation_interval(std::chrono::milliseconds new_base);
 
+    std::chrono::milliseconds max_translation_delay() const;
+    void reset_max_translation_delay(std::chrono::milliseconds);
+
 private:
     bool can_continue() const;
 
@@ -114,6 +125,10 @@ private:
       kafka::offset reader_begin_offset,
       coordinator::translated_offset_range task_result);
 
+    // True if too little data arrived since the last translation to be worth
+    // its own files and the pending data may wait some more.
+    bool should_defer_translation() const;
+
     kafka::offset min_offset_for_translation() const;
     // Returns max consumable offset for translation.
     std::optional<kafka::offset> max_offset_for_translation() const;
@@ -139,6 +154,14 @@ private:
     // how many parallel translations can run at one point as we operate under
     // a memory budget for all translations (semaphore below).
     size_t _max_bytes_per_reader;
+    // Translations of less data than this are deferred, up to the max
+    // translation delay since the last translation.
+    size_t _min_bytes_per_translation;
+    std::chrono::milliseconds _max_translation_delay;
+    // Log size and time of the last translation, the growth of the log since
+    // is an estimate of the data pending translation.
+    size_t _translated_log_size{0};
+    ss::lowres_clock::time_point _last_translation;
     std::unique_ptr<ssx::semaphore>* _parallel_translations;
     std::filesystem::path _writer_scratch_space;
     ss::gate _gate;
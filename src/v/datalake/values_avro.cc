@@ -14,257 +14,372 @@
 #include "iceberg/avro_decimal.h"
 #include "serde/avro/parser.h"
 
+#include <optional>
+#include <span>
+
 namespace datalake {
 
 namespace {
 
-ss::future<value_outcome> avro_parsed_to_value(
-  std::unique_ptr<serde::avro::parsed::message> parsed_msg, avro::NodePtr node);
+namespace parsed = serde::avro::parsed;
+
+value_conversion_exception null_conversion_error() {
+    return value_conversion_exception(
+      "Conversion of NULL type is not supported. This type should be "
+      "explicitly skipped");
+}
 
-template<typename T, typename ValueT>
-value_outcome
-convert_primitive(T v, avro::Type expected_type, const avro::NodePtr& node) {
-    if (node->type() != expected_type) {
-        return value_conversion_exception(fmt::format(
-          "Schema mismatch detected expected type {} got {}, current node: {}",
-          expected_type,
-          node->type(),
-          node));
+value_conversion_exception schema_mismatch_error(std::string_view expected) {
+    return value_conversion_exception(fmt::format(
+      "Schema mismatch detected, expected parsed value of type {}", expected));
+}
+
+template<typename T, typename F>
+value_outcome convert_as(parsed::primitive& p, std::string_view name, F f) {
+    auto* v = std::get_if<T>(&p);
+    if (v == nullptr) {
+        return schema_mismatch_error(name);
     }
-    return ValueT{std::move(v)};
+    return f(std::move(*v));
+}
+
+} // namespace
+
+avro_value_plan::avro_value_plan(const avro::ValidSchema& schema)
+  : _schema(&schema) {
+    compiled_nodes compiled;
+    compile(schema.root(), compiled);
 }
 
-struct primitive_visitor {
-    using ret_t = value_outcome;
-    ret_t operator()(int32_t v) {
-        if (node->logicalType().type() == avro::LogicalType::DATE) {
-            return convert_primitive<int32_t, iceberg::date_value>(
-              v, avro::AVRO_INT, node);
+avro_value_plan::op avro_value_plan::node_op(const avro::Node& node) {
+    const auto logical = node.logicalType().type();
+    switch (node.type()) {
+    case avro::AVRO_RECORD:
+        return op::record;
+    case avro::AVRO_MAP:
+        return op::map;
+    case avro::AVRO_ARRAY:
+        return op::list;
+    case avro::AVRO_UNION:
+        return op::avro_union;
+    case avro::AVRO_INT:
+        if (logical == avro::LogicalType::DATE) {
+            return op::date;
         }
-        if (node->logicalType().type() == avro::LogicalType::TIME_MILLIS) {
-            std::chrono::milliseconds ms(v);
-            return convert_primitive<int64_t, iceberg::time_value>(
-              std::chrono::duration_cast<std::chrono::microseconds>(ms).count(),
-              avro::AVRO_INT,
-              node);
+        if (logical == avro::LogicalType::TIME_MILLIS) {
+            return op::time_millis;
         }
-        return convert_primitive<int32_t, iceberg::int_value>(
-          v, avro::AVRO_INT, node);
-    }
-    ret_t operator()(int64_t v) {
-        if (node->type() == avro::AVRO_ENUM) {
-            return convert_primitive<int64_t, iceberg::long_value>(
-              v, avro::AVRO_ENUM, node);
+        return op::int_value;
+    case avro::AVRO_LONG:
+        if (logical == avro::LogicalType::TIME_MICROS) {
+            return op::time_micros;
         }
-        if (node->logicalType().type() == avro::LogicalType::TIME_MICROS) {
-            return convert_primitive<int64_t, iceberg::time_value>(
-              v, avro::AVRO_LONG, node);
+        if (logical == avro::LogicalType::TIMESTAMP_MILLIS) {
+            return op::timestamp_millis;
         }
-        if (node->logicalType().type() == avro::LogicalType::TIMESTAMP_MILLIS) {
-            // times 1000 to convert from milliseconds to microseconds that
-            // iceberg requires
-            return convert_primitive<int64_t, iceberg::timestamp_value>(
-              v * 1000, avro::AVRO_LONG, node);
+        if (logical == avro::LogicalType::TIMESTAMP_MICROS) {
+            return op::timestamp_micros;
         }
-        if (node->logicalType().type() == avro::LogicalType::TIMESTAMP_MICROS) {
-            return convert_primitive<int64_t, iceberg::timestamp_value>(
-              v, avro::AVRO_LONG, node);
+        return op::long_value;
+    case avro::AVRO_ENUM:
+        return op::enum_value;
+    case avro::AVRO_BOOL:
+        return op::boolean;
+    case avro::AVRO_FLOAT:
+        return op::float_value;
+    case avro::AVRO_DOUBLE:
+        return op::double_value;
+    case avro::AVRO_STRING:
+        if (logical == avro::LogicalType::DECIMAL) {
+            return op::decimal;
         }
-        return convert_primitive<int64_t, iceberg::long_value>(
-          v, avro::AVRO_LONG, node);
-    }
-    ret_t operator()(bool v) {
-        return convert_primitive<bool, iceberg::boolean_value>(
-          v, avro::AVRO_BOOL, node);
-    }
-    ret_t operator()(serde::avro::parsed::avro_null) {
-        return value_conversion_exception(
-          "Conversion of NULL type is not supported. This type should be "
-          "explicitly skipped");
-    }
-    ret_t operator()(double v) {
-        return convert_primitive<double, iceberg::double_value>(
-          v, avro::AVRO_DOUBLE, node);
+        if (logical == avro::LogicalType::UUID) {
+            return op::uuid;
+        }
+        return op::string;
+    case avro::AVRO_BYTES:
+        if (logical == avro::LogicalType::DECIMAL) {
+            return op::decimal;
+        }
+        return op::binary;
+    case avro::AVRO_FIXED:
+        if (logical == avro::LogicalType::DECIMAL) {
+            return op::decimal;
+        }
+        return op::fixed;
+    case avro::AVRO_NULL:
+        return op::null;
+    default:
+        return op::unsupported;
     }
-    ret_t operator()(float v) {
-        return convert_primitive<float, iceberg::float_value>(
-          v, avro::AVRO_FLOAT, node);
+}
+
+uint32_t
+avro_value_plan::compile(const avro::NodePtr& n, compiled_nodes& compiled) {
+    const auto node = n->type() == avro::AVRO_SYMBOLIC ? avro::resolveSymbol(n)
+                                                       : n;
+    if (auto it = compiled.find(node.get()); it != compiled.end()) {
+        return it->second;
     }
-    ret_t operator()(iobuf buffer) {
-        if (node->logicalType().type() == avro::LogicalType::DECIMAL) {
-            return iceberg::decimal_value{
-              .val = iceberg::iobuf_to_avro_decimal(std::move(buffer))};
-        }
+    const auto idx = static_cast<uint32_t>(_steps.size());
+    const auto code = node_op(*node);
+    _steps.push_back(step{.code = code});
+    compiled.emplace(node.get(), idx);
 
-        if (node->type() == avro::AVRO_FIXED) {
-            return convert_primitive<iobuf, iceberg::fixed_value>(
-              std::move(buffer), avro::AVRO_FIXED, node);
+    std::vector<uint32_t> children;
+    switch (code) {
+    case op::record:
+    case op::avro_union:
+        // null fields and branches are not represented in the iceberg schema
+        children.reserve(node->leaves());
+        for (size_t i = 0; i < node->leaves(); ++i) {
+            const auto& leaf = node->leafAt(i);
+            children.push_back(
+              leaf->type() == avro::AVRO_NULL ? skipped
+                                              : compile(leaf, compiled));
         }
+        break;
+    case op::list:
+        children.push_back(compile(node->leafAt(0), compiled));
+        break;
+    case op::map:
+        children.push_back(compile(node->leafAt(0), compiled));
+        children.push_back(compile(node->leafAt(1), compiled));
+        break;
+    default:
+        break;
+    }
+    // children are compiled first, the steps of their own children are
+    // already in place
+    _steps[idx].children_begin = static_cast<uint32_t>(_children.size());
+    _children.insert(_children.end(), children.begin(), children.end());
+    _steps[idx].children_end = static_cast<uint32_t>(_children.size());
+    return idx;
+}
 
-        if (node->type() == avro::AVRO_STRING) {
-            if (node->logicalType().type() == avro::LogicalType::UUID) {
-                auto sz = buffer.size_bytes();
-                iobuf_parser p(std::move(buffer));
-                return convert_primitive<uuid_t, iceberg::uuid_value>(
-                  uuid_t::from_string(p.read_string(sz)),
-                  avro::AVRO_STRING,
-                  node);
-            }
-            return convert_primitive<iobuf, iceberg::string_value>(
-              std::move(buffer), avro::AVRO_STRING, node);
+value_outcome avro_value_plan::to_value(
+  std::unique_ptr<serde::avro::parsed::message> parsed_msg) const {
+    // Avro parser handles max recursion depth, it is safe not to track it
+    // when converting parsed to avro values as the traversal is based on
+    // the parsed messages, in contrast to protobuf avro values are always
+    // serialized even if set to default.
+    //
+    // The same way we do with the schema. Top level type is always encoded
+    // as struct value with one field to match iceberg schema.
+    if (_schema->root()->type() != avro::AVRO_RECORD) {
+        auto root_field = convert(0, std::move(parsed_msg));
+        if (root_field.has_error()) {
+            return root_field.error();
         }
-        return convert_primitive<iobuf, iceberg::binary_value>(
-          std::move(buffer), avro::AVRO_BYTES, node);
+        auto ret = std::make_unique<iceberg::struct_value>();
+        ret->fields.push_back(std::move(root_field.value()));
+        return ret;
     }
-    avro::NodePtr node;
-};
+    return convert(0, std::move(parsed_msg));
+}
 
-struct parsed_msg_visitor {
-    ss::future<value_outcome> operator()(serde::avro::parsed::record record) {
+value_outcome avro_value_plan::convert(
+  uint32_t idx, std::unique_ptr<serde::avro::parsed::message> msg) const {
+    const auto& s = _steps[idx];
+    const auto children = std::span(_children).subspan(
+      s.children_begin, s.children_end - s.children_begin);
+    switch (s.code) {
+    case op::record: {
+        auto* record = std::get_if<parsed::record>(msg.get());
+        if (record == nullptr || record->fields.size() != children.size()) {
+            return schema_mismatch_error("record");
+        }
         auto ret = std::make_unique<iceberg::struct_value>();
-        ret->fields.reserve(node->leaves());
-        for (size_t i = 0; i < node->leaves(); ++i) {
-            const auto& field_node = node->leafAt(i);
-            if (field_node->type() == avro::AVRO_NULL) {
+        ret->fields.reserve(children.size());
+        for (size_t i = 0; i < children.size(); ++i) {
+            if (children[i] == skipped) {
                 continue;
             }
-            auto result = co_await avro_parsed_to_value(
-              std::move(record.fields[i]), field_node);
+            auto result = convert(children[i], std::move(record->fields[i]));
             if (result.has_error()) {
-                co_return result.error();
+                return result.error();
             }
             ret->fields.push_back(std::move(result.value()));
         }
-        co_return ret;
+        return ret;
     }
-    ss::future<value_outcome> operator()(serde::avro::parsed::map parsed_map) {
+    case op::map: {
+        auto* parsed_map = std::get_if<parsed::map>(msg.get());
+        if (parsed_map == nullptr) {
+            return schema_mismatch_error("map");
+        }
+        const auto& key_step = _steps[children[0]];
         auto ret = std::make_unique<iceberg::map_value>();
-        ret->kvs.reserve(parsed_map.entries.size());
-        const auto key_node = node->leafAt(0);
-        const auto value_node = node->leafAt(1);
-        for (auto& [k, v] : parsed_map.entries) {
-            if (key_node->type() != avro::AVRO_STRING) {
-                co_return value_conversion_exception(fmt::format(
-                  "Map key type mismatch. Expected string, got {}",
-                  key_node->type()));
+        ret->kvs.reserve(parsed_map->entries.size());
+        for (auto& [k, v] : parsed_map->entries) {
+            if (key_step.code != op::string) {
+                return value_conversion_exception(
+                  "Map key type mismatch. Expected string");
             }
-            // Avro map keys are always stings, use primitive visitor directly
-            auto key_result = primitive_visitor{key_node}(std::move(k));
+            // Avro map keys are always stings
+            auto key_result = convert_primitive(key_step, std::move(k));
             if (key_result.has_error()) {
-                co_return key_result.error();
+                return key_result.error();
             }
-            auto value_result = co_await avro_parsed_to_value(
-              std::move(v), value_node);
+            auto value_result = convert(children[1], std::move(v));
             if (value_result.has_error()) {
-                co_return value_result.error();
+                return value_result.error();
             }
             ret->kvs.emplace_back(
               std::move(key_result.value()), std::move(value_result.value()));
         }
-        co_return ret;
+        return ret;
     }
-    ss::future<value_outcome> operator()(serde::avro::parsed::list v) {
+    case op::list: {
+        auto* list = std::get_if<parsed::list>(msg.get());
+        if (list == nullptr) {
+            return schema_mismatch_error("list");
+        }
         auto ret = std::make_unique<iceberg::list_value>();
-        ret->elements.reserve(v.elements.size());
-        auto element_node = node->leafAt(0);
-        for (auto& e : v.elements) {
-            auto result = co_await avro_parsed_to_value(
-              std::move(e), element_node);
+        ret->elements.reserve(list->elements.size());
+        for (auto& e : list->elements) {
+            auto result = convert(children[0], std::move(e));
             if (result.has_error()) {
-                co_return result.error();
+                return result.error();
             }
             ret->elements.push_back(std::move(result.value()));
         }
-        co_return ret;
+        return ret;
     }
-    ss::future<value_outcome> operator()(serde::avro::parsed::avro_union v) {
-        // union is represented as a struct with all possible types but only one
-        // present
+    case op::avro_union: {
+        auto* u = std::get_if<parsed::avro_union>(msg.get());
+        if (u == nullptr) {
+            return schema_mismatch_error("union");
+        }
+        // union is represented as a struct with all possible types but only
+        // one present
         auto ret = std::make_unique<iceberg::struct_value>();
-        ret->fields.reserve(node->leaves());
-        for (size_t i = 0; i < node->leaves(); ++i) {
-            // handle branch that wasn't selected
-            const auto& field_node = node->leafAt(i);
-            // if it is null, do nothing as it is not represented in iceberg
-            // schema
-            if (field_node->type() == avro::AVRO_NULL) {
+        ret->fields.reserve(children.size());
+        for (size_t i = 0; i < children.size(); ++i) {
+            if (children[i] == skipped) {
                 continue;
             }
-
-            if (i != v.branch) {
+            if (i != u->branch) {
                 ret->fields.push_back(std::nullopt);
                 continue;
             }
-            // parse the selected branch
-            auto result = co_await avro_parsed_to_value(
-              std::move(v.message), field_node);
+            auto result = convert(children[i], std::move(u->message));
             if (result.has_error()) {
-                co_return result.error();
+                return result.error();
             }
             ret->fields.push_back(std::move(result.value()));
         }
-        co_return ret;
+        return ret;
     }
-    ss::future<value_outcome> operator()(serde::avro::parsed::primitive v) {
-        co_return std::visit(primitive_visitor{node}, std::move(v));
+    case op::null:
+        return null_conversion_error();
+    case op::unsupported:
+        return value_conversion_exception(
+          "AVRO_UNKNOWN type conversion is not supported");
+    default: {
+        auto* p = std::get_if<parsed::primitive>(msg.get());
+        if (p == nullptr) {
+            return schema_mismatch_error("primitive");
+        }
+        return convert_primitive(s, std::move(*p));
     }
-    avro::NodePtr node;
-};
-
-ss::future<value_outcome> avro_parsed_to_value(
-  std::unique_ptr<serde::avro::parsed::message> parsed_msg,
-  avro::NodePtr node) {
-    if (node->type() == avro::AVRO_NULL) {
-        co_return value_conversion_exception(
-          "Conversion of NULL type is not supported. This type should be "
-          "explicitly skipped");
     }
+}
 
-    if (node->type() == avro::AVRO_UNKNOWN) {
-        co_return value_conversion_exception(
-          "AVRO_UNKNOWN type conversion is not supported");
+value_outcome avro_value_plan::convert_primitive(
+  const step& s, serde::avro::parsed::primitive p) const {
+    switch (s.code) {
+    case op::int_value:
+        return convert_as<int32_t>(
+          p, "int", [](int32_t v) { return iceberg::int_value{v}; });
+    case op::date:
+        return convert_as<int32_t>(
+          p, "int", [](int32_t v) { return iceberg::date_value{v}; });
+    case op::time_millis:
+        return convert_as<int32_t>(p, "int", [](int32_t v) {
+            std::chrono::milliseconds ms(v);
+            return iceberg::time_value{
+              std::chrono::duration_cast<std::chrono::microseconds>(ms)
+                .count()};
+        });
+    case op::long_value:
+    case op::enum_value:
+        return convert_as<int64_t>(
+          p, "long", [](int64_t v) { return iceberg::long_value{v}; });
+    case op::time_micros:
+        return convert_as<int64_t>(
+          p, "long", [](int64_t v) { return iceberg::time_value{v}; });
+    case op::timestamp_millis:
+        // times 1000 to convert from milliseconds to microseconds that
+        // iceberg requires
+        return convert_as<int64_t>(p, "long", [](int64_t v) {
+            return iceberg::timestamp_value{v * 1000};
+        });
+    case op::timestamp_micros:
+        return convert_as<int64_t>(
+          p, "long", [](int64_t v) { return iceberg::timestamp_value{v}; });
+    case op::boolean:
+        return convert_as<bool>(
+          p, "boolean", [](bool v) { return iceberg::boolean_value{v}; });
+    case op::float_value:
+        return convert_as<float>(
+          p, "float", [](float v) { return iceberg::float_value{v}; });
+    case op::double_value:
+        return convert_as<double>(
+          p, "double", [](double v) { return iceberg::double_value{v}; });
+    case op::decimal:
+        return convert_as<iobuf>(p, "bytes", [](iobuf b) {
+            return iceberg::decimal_value{
+              .val = iceberg::iobuf_to_avro_decimal(std::move(b))};
+        });
+    case op::fixed:
+        return convert_as<iobuf>(p, "fixed", [](iobuf b) {
+            return iceberg::fixed_value{std::move(b)};
+        });
+    case op::uuid:
+        return convert_as<iobuf>(p, "string", [](iobuf b) {
+            auto sz = b.size_bytes();
+            iobuf_parser parser(std::move(b));
+            return iceberg::uuid_value{
+              uuid_t::from_string(parser.read_string(sz))};
+        });
+    case op::string:
+        return convert_as<iobuf>(p, "string", [](iobuf b) {
+            return iceberg::string_value{std::move(b)};
+        });
+    case op::binary:
+        return convert_as<iobuf>(p, "bytes", [](iobuf b) {
+            return iceberg::binary_value{std::move(b)};
+        });
+    case op::null:
+        return null_conversion_error();
+    default:
+        return schema_mismatch_error("primitive");
     }
+}
 
-    if (node->type() == avro::AVRO_SYMBOLIC) {
-        co_return co_await avro_parsed_to_value(
-          std::move(parsed_msg), avro::resolveSymbol(node));
+ss::future<value_outcome>
+deserialize_avro(iobuf buffer, const avro_value_plan& plan) {
+    try {
+        auto parsed = co_await serde::avro::parse(
+          std::move(buffer), plan.schema());
+        co_return plan.to_value(std::move(parsed));
+    } catch (...) {
+        co_return value_outcome{value_conversion_exception(fmt::format(
+          "Error parsing avro message - {}", std::current_exception()))};
     }
-
-    co_return co_await std::visit(
-      parsed_msg_visitor{node}, std::move(*parsed_msg));
 }
 
-} // namespace
-
 ss::future<value_outcome>
 deserialize_avro(iobuf buffer, avro::ValidSchema schema) {
+    std::optional<avro_value_plan> plan;
     try {
-        // Avro parser handles max recursion depth, it is safe not to track it
-        // when converting parsed to avro values as the traversal is based on
-        // the parsed messages, in contrast to protobuf avro values are always
-        // serialized even if set to default.
-        auto parsed = co_await serde::avro::parse(std::move(buffer), schema);
-        /**
-         * The same way we do with the schema. Top level type is always encoded
-         * as struct value with one field to
-         * match iceberg schema.
-         */
-        if (schema.root()->type() != avro::AVRO_RECORD) {
-            auto root_field = co_await avro_parsed_to_value(
-              std::move(parsed), schema.root());
-            if (root_field.has_error()) {
-                co_return root_field.error();
-            }
-            auto ret = std::make_unique<iceberg::struct_value>();
-            ret->fields.push_back(std::move(root_field.value()));
-            co_return ret;
-        }
-        co_return co_await avro_parsed_to_value(
-          std::move(parsed), schema.root());
+        plan.emplace(schema);
     } catch (...) {
         co_return value_outcome{value_conversion_exception(fmt::format(
-          "Error parsing avro message - {}", std::current_exception()))};
+          "Error compiling avro schema - {}", std::current_exception()))};
     }
+    co_return co_await deserialize_avro(std::move(buffer), *plan);
 }
 
 } // namespace datalake
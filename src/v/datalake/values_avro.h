@@ -10,15 +10,100 @@
 #pragma once
 
 #include "datalake/conversion_outcome.h"
+#include "serde/avro/parser.h"
 
 #include <avro/ValidSchema.hh>
 
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
 namespace datalake {
 
+/**
+ * Conversion of parsed Avro messages into iceberg values, compiled once per
+ * schema.
+ *
+ * Symbolic references, logical types and null fields or branches are
+ * resolved when the plan is built. Converting a message walks a flat array
+ * of steps, one per schema node, dispatched with a single switch instead of
+ * inspecting the schema node of every field of every record.
+ *
+ * The plan refers to the schema it was built from, it must not outlive it.
+ */
+class avro_value_plan {
+public:
+    explicit avro_value_plan(const avro::ValidSchema&);
+
+    const avro::ValidSchema& schema() const noexcept { return *_schema; }
+
+    value_outcome
+      to_value(std::unique_ptr<serde::avro::parsed::message>) const;
+
+private:
+    enum class op : uint8_t {
+        record,
+        map,
+        list,
+        avro_union,
+        int_value,
+        date,
+        time_millis,
+        long_value,
+        enum_value,
+        time_micros,
+        timestamp_millis,
+        timestamp_micros,
+        boolean,
+        float_value,
+        double_value,
+        decimal,
+        fixed,
+        uuid,
+        string,
+        binary,
+        null,
+        unsupported,
+    };
+
+    // Marks a record field or union branch which is not represented in the
+    // iceberg value
+    static constexpr uint32_t skipped = std::numeric_limits<uint32_t>::max();
+
+    struct step {
+        op code;
+        // Range in `_children` with the steps of the record fields, union
+        // branches, list element or map key and value
+        uint32_t children_begin{0};
+        uint32_t children_end{0};
+    };
+
+    // Steps of the nodes compiled so far, named types which refer to
+    // themselves point back at their own step
+    using compiled_nodes = std::unordered_map<const avro::Node*, uint32_t>;
+    uint32_t compile(const avro::NodePtr&, compiled_nodes&);
+    static op node_op(const avro::Node&);
+
+    value_outcome
+      convert(uint32_t, std::unique_ptr<serde::avro::parsed::message>) const;
+    value_outcome convert_primitive(
+      const step&, serde::avro::parsed::primitive) const;
+
+    const avro::ValidSchema* _schema;
+    std::vector<step> _steps;
+    std::vector<uint32_t> _children;
+};
+
 /**
  * Deserialize an Avro serialized message into an iceberg value.
  */
 ss::future<value_outcome>
 deserialize_avro(iobuf buffer, avro::ValidSchema schema);
 
+/**
+ * Deserialize an Avro serialized message with a precompiled plan.
+ */
+ss::future<value_outcome>
+deserialize_avro(iobuf buffer, const avro_value_plan& plan);
+
 } // namespace datalake
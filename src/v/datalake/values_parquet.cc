@@ -140,10 +140,208 @@ struct value_converting_visitor {
         co_return map_wrapper;
     }
 };
+
+using serde::parquet::def_level;
+using serde::parquet::field_repetition_type;
+using serde::parquet::rep_level;
+using serde::parquet::schema_element;
+using serde::parquet::shredded_value;
+
+struct shredding_levels {
+    rep_level repetition_level = rep_level(0);
+    def_level definition_level = def_level(0);
+};
+
+/**
+ * Walks an iceberg value alongside the parquet schema created for its type,
+ * following the same rules as the record shredder in serde/parquet. Lists and
+ * maps are wrapped in a group with a single repeated child, see
+ * schema_parquet.cc.
+ */
+class value_shredder {
+public:
+    explicit value_shredder(chunked_vector<shredded_value>& out)
+      : _out(out) {}
+
+    void shred_fields(
+      const schema_element& element,
+      iceberg::struct_value& value,
+      shredding_levels levels) {
+        if (value.fields.size() != element.children.size()) {
+            throw value_conversion_exception(fmt::format(
+              "schema/struct mismatch, schema had {} children, struct had {} "
+              "fields. At column {}",
+              element.children.size(),
+              value.fields.size(),
+              element.position));
+        }
+        for (size_t i = 0; i < value.fields.size(); ++i) {
+            shred_field(element.children[i], value.fields[i], levels);
+        }
+    }
+
+private:
+    void shred_field(
+      const schema_element& element,
+      std::optional<iceberg::value>& value,
+      shredding_levels levels) {
+        if (!value.has_value()) {
+            if (element.repetition_type == field_repetition_type::required) {
+                throw value_conversion_exception(fmt::format(
+                  "detected null value for required schema element {}",
+                  element.name()));
+            }
+            // The parent levels are used so that assembly can determine where
+            // the null started.
+            shred_null(element, levels);
+            return;
+        }
+        shred_field(element, *value, levels);
+    }
+
+    void shred_field(
+      const schema_element& element,
+      iceberg::value& value,
+      shredding_levels levels) {
+        if (element.repetition_type != field_repetition_type::required) {
+            ++levels.definition_level;
+        }
+        std::visit(
+          [this, &element, levels](auto& v) { shred(element, v, levels); },
+          value);
+    }
+
+    void shred(
+      const schema_element& element,
+      iceberg::primitive_value& value,
+      shredding_levels levels) {
+        if (!element.is_leaf()) {
+            throw value_conversion_exception(fmt::format(
+              "unexpected primitive value for group schema element {}",
+              element.name()));
+        }
+        _out.push_back({
+          .schema_element_position = element.position,
+          .val = std::visit(
+                   primitive_value_converting_visitor{}, std::move(value))
+                   .value(),
+          .rep_level = levels.repetition_level,
+          .def_level = levels.definition_level,
+        });
+    }
+
+    void shred(
+      const schema_element& element,
+      std::unique_ptr<iceberg::struct_value>& value,
+      shredding_levels levels) {
+        if (element.is_leaf()) {
+            throw value_conversion_exception(fmt::format(
+              "unexpected struct value for leaf schema element {}",
+              element.name()));
+        }
+        shred_fields(element, *value, levels);
+    }
+
+    void shred(
+      const schema_element& element,
+      std::unique_ptr<iceberg::list_value>& list,
+      shredding_levels levels) {
+        const auto& repeated = repeated_child(element, 1);
+        shred_repeated(
+          repeated,
+          list->elements,
+          levels,
+          [this, &repeated](auto& e, shredding_levels element_levels) {
+              shred_field(repeated.children[0], e, element_levels);
+          });
+    }
+
+    void shred(
+      const schema_element& element,
+      std::unique_ptr<iceberg::map_value>& map,
+      shredding_levels levels) {
+        const auto& repeated = repeated_child(element, 2);
+        shred_repeated(
+          repeated,
+          map->kvs,
+          levels,
+          [this, &repeated](auto& kv, shredding_levels kv_levels) {
+              shred_field(repeated.children[0], kv.key, kv_levels);
+              shred_field(repeated.children[1], kv.val, kv_levels);
+          });
+    }
+
+    const schema_element&
+    repeated_child(const schema_element& element, size_t fields) {
+        if (
+          element.children.size() != 1
+          || element.children[0].repetition_type
+               != field_repetition_type::repeated
+          || element.children[0].children.size() != fields) {
+            throw value_conversion_exception(fmt::format(
+              "unexpected repeated value for schema element {}",
+              element.name()));
+        }
+        return element.children[0];
+    }
+
+    template<typename Items, typename Func>
+    void shred_repeated(
+      const schema_element& repeated,
+      Items& items,
+      shredding_levels levels,
+      Func shred_item) {
+        // Empty lists are equivalent to a `null` value.
+        if (items.empty()) {
+            shred_null(repeated, levels);
+            return;
+        }
+        // Every item of the repeated group is defined, the first one uses the
+        // parent repetition level to mark the start of a new list, the others
+        // that they are repeated at this level within the tree.
+        shredding_levels item_levels = levels;
+        ++item_levels.definition_level;
+        for (auto& item : items) {
+            shred_item(item, item_levels);
+            item_levels.repetition_level = repeated.max_repetition_level;
+        }
+    }
+
+    void shred_null(const schema_element& element, shredding_levels levels) {
+        if (element.is_leaf()) {
+            _out.push_back({
+              .schema_element_position = element.position,
+              .val = serde::parquet::null_value(),
+              .rep_level = levels.repetition_level,
+              .def_level = levels.definition_level,
+            });
+            return;
+        }
+        for (const auto& child : element.children) {
+            shred_null(child, levels);
+        }
+    }
+
+    chunked_vector<shredded_value>& _out;
+};
 } // namespace
 
 ss::future<parquet_conversion_outcome> to_parquet_value(iceberg::value value) {
     return std::visit(value_converting_visitor{}, std::move(value));
 }
 
+parquet_shredding_outcome shred_parquet_value(
+  const serde::parquet::schema_element& schema,
+  iceberg::struct_value value,
+  chunked_vector<serde::parquet::shredded_value>& out) {
+    const auto initial_size = out.size();
+    try {
+        value_shredder(out).shred_fields(schema, value, {});
+    } catch (const value_conversion_exception& e) {
+        out.pop_back_n(out.size() - initial_size);
+        return e;
+    }
+    return outcome::success();
+}
+
 } // namespace datalake
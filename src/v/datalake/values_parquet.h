@@ -9,8 +9,11 @@
  */
 #pragma once
 
+#include "container/fragmented_vector.h"
 #include "datalake/conversion_outcome.h"
 
+#include <serde/parquet/schema.h>
+#include <serde/parquet/shredder.h>
 #include <serde/parquet/value.h>
 
 namespace datalake {
@@ -24,4 +27,20 @@ using parquet_conversion_outcome
  */
 ss::future<parquet_conversion_outcome> to_parquet_value(iceberg::value);
 
+using parquet_shredding_outcome = checked<void, value_conversion_exception>;
+
+/**
+ * Shreds an iceberg struct directly into the values of the leaf columns of
+ * \p schema, which must be the indexed parquet schema of the struct type (see
+ * `schema_to_parquet`). The values are appended to \p out, nothing is appended
+ * when the conversion fails.
+ *
+ * This produces the same values as shredding the result of `to_parquet_value`
+ * without building the intermediate parquet value tree.
+ */
+parquet_shredding_outcome shred_parquet_value(
+  const serde::parquet::schema_element& schema,
+  iceberg::struct_value,
+  chunked_vector<serde::parquet::shredded_value>& out);
+
 } // namespace datalake
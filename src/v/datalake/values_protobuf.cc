@@ -72,82 +72,143 @@ std::optional<iceberg::string_value> convert_u64_as_string(
       iobuf::from(std::to_string(std::invoke(get_default, &fd))));
 }
 
+} // namespace
+
+protobuf_value_plan::protobuf_value_plan(const pb::Descriptor& descriptor)
+  : _descriptor(&descriptor) {
+    proto_descriptors_stack stack;
+    compile(descriptor, stack);
+}
+
+uint32_t protobuf_value_plan::compile(
+  const pb::Descriptor& descriptor, proto_descriptors_stack& stack) {
+    const auto idx = static_cast<uint32_t>(_messages.size());
+    _messages.emplace_back();
+    if (is_recursive_type(descriptor, stack)) {
+        _messages[idx].error = fmt::format(
+          "Recursive message types are not supported. Descriptor: {}",
+          descriptor.DebugString());
+        return idx;
+    }
+    if (stack.size() >= max_recursion_depth) {
+        _messages[idx].error = fmt::format(
+          "Reached maximum recursion depth. Descriptor: {}",
+          descriptor.DebugString());
+        return idx;
+    }
+    stack.push_back(&descriptor);
+    /**
+     * The conversion is driven by walking through the message descriptor as
+     * some field with default values are skipped in parsed result.
+     */
+    std::vector<field_step> fields;
+    fields.reserve(descriptor.field_count());
+    for (int i = 0; i < descriptor.field_count(); ++i) {
+        const auto* fd = descriptor.field(i);
+        const auto* value_fd = fd->is_map() ? fd->message_type()->map_value()
+                                            : fd;
+        auto& f = fields.emplace_back(field_step{.descriptor = fd});
+        if (value_fd->type() == pb::FieldDescriptor::TYPE_MESSAGE) {
+            f.message = compile(*value_fd->message_type(), stack);
+        }
+    }
+    stack.pop_back();
+    // nested messages are compiled first, their fields are already in place
+    _messages[idx].fields_begin = static_cast<uint32_t>(_fields.size());
+    _fields.insert(_fields.end(), fields.begin(), fields.end());
+    _messages[idx].fields_end = static_cast<uint32_t>(_fields.size());
+    return idx;
+}
+
+optional_value_outcome protobuf_value_plan::to_value(
+  std::unique_ptr<parsed::message> message) const {
+    return convert_message(0, std::move(message));
+}
+
 // converts a struct to an iceberg value
-ss::future<optional_value_outcome> message_to_value(
-  std::unique_ptr<parsed::message> message,
-  const pb::Descriptor& descriptor,
-  proto_descriptors_stack& stack);
+optional_value_outcome protobuf_value_plan::convert_message(
+  uint32_t idx, std::unique_ptr<parsed::message> message) const {
+    if (message == nullptr) {
+        return std::nullopt;
+    }
+    const auto& m = _messages[idx];
+    if (m.error.has_value()) {
+        return value_conversion_exception(m.error.value());
+    }
+    auto ret = std::make_unique<iceberg::struct_value>();
+    ret->fields.reserve(m.fields_end - m.fields_begin);
+    for (auto i = m.fields_begin; i < m.fields_end; ++i) {
+        const auto& f = _fields[i];
+        auto it = message->fields.find(f.descriptor->number());
+        auto field = it == message->fields.end()
+                       ? std::nullopt
+                       : std::make_optional<parsed::message::field>(
+                           std::move(it->second));
+
+        auto result = convert_field(f, std::move(field));
+        if (result.has_error()) {
+            return result.error();
+        }
+        ret->fields.push_back(std::move(result.value()));
+    }
+    return ret;
+}
 
 // converts a struct field to an iceberg value, it supports maps and repeated
 // fields
-ss::future<optional_value_outcome> message_field_to_value(
-  std::optional<parsed::message::field> field,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack);
+optional_value_outcome protobuf_value_plan::convert_field(
+  const field_step& f, std::optional<parsed::message::field> field) const {
+    if (f.descriptor->is_map()) {
+        return convert_map(f, std::move(field));
+    }
 
-// converts a single element to iceberg value
-ss::future<optional_value_outcome> single_field_to_value(
-  std::optional<parsed::message::field> field,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack);
+    if (f.descriptor->is_repeated()) {
+        return convert_repeated(f, std::move(field));
+    }
 
-template<typename SourceT>
-ss::future<value_outcome> convert_repeated_elements(
-  chunked_vector<SourceT> elements,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack) {
-    auto ret = std::make_unique<iceberg::list_value>();
-    ret->elements.reserve(elements.size());
-    for (typename decltype(elements)::reference element : elements) {
-        auto result = co_await single_field_to_value(
-          std::move(element), field_descriptor, stack);
-        if (result.has_error()) {
-            co_return result.error();
-        }
-        ret->elements.push_back(std::move(result.value()));
-    };
-    co_return value_outcome{std::move(ret)};
+    return convert_single(*f.descriptor, f.message, std::move(field));
 }
 
-ss::future<optional_value_outcome> convert_repeated(
-  std::optional<serde::pb::parsed::message::field> list_field,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack) {
+optional_value_outcome protobuf_value_plan::convert_repeated(
+  const field_step& f,
+  std::optional<serde::pb::parsed::message::field> list_field) const {
     if (!list_field.has_value()) {
-        if (field_descriptor.has_presence()) {
-            return ssx::now<optional_value_outcome>(std::nullopt);
+        if (f.descriptor->has_presence()) {
+            return std::nullopt;
         }
-        return ssx::now<optional_value_outcome>(
-          std::make_unique<iceberg::list_value>());
+        return std::make_unique<iceberg::list_value>();
     }
     auto list_variant
       = std::get<parsed::repeated>(std::move(list_field.value())).elements;
 
     return ss::visit(
-             std::move(list_variant),
-             [&field_descriptor, &stack](auto& list) {
-                 return convert_repeated_elements(
-                   std::move(list), field_descriptor, stack);
-             })
-      .then([](value_outcome vo) {
-          if (vo.has_error()) {
-              return optional_value_outcome(vo.error());
+      list_variant, [this, &f](auto& elements) -> optional_value_outcome {
+          auto ret = std::make_unique<iceberg::list_value>();
+          ret->elements.reserve(elements.size());
+          for (typename std::remove_reference_t<decltype(elements)>::reference
+                 element : elements) {
+              auto result = convert_single(
+                *f.descriptor, f.message, std::move(element));
+              if (result.has_error()) {
+                  return result.error();
+              }
+              ret->elements.push_back(std::move(result.value()));
           }
-
-          return optional_value_outcome(std::move(vo.value()));
+          return ret;
       });
 }
-ss::future<optional_value_outcome> convert_map(
-  std::optional<parsed::message::field> field,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack) {
+
+optional_value_outcome protobuf_value_plan::convert_map(
+  const field_step& f, std::optional<parsed::message::field> field) const {
     if (!field.has_value()) {
-        if (field_descriptor.has_presence()) {
-            co_return std::nullopt;
+        if (f.descriptor->has_presence()) {
+            return std::nullopt;
         }
         // if no presence is tracked return an empty map
-        co_return std::make_unique<iceberg::map_value>();
+        return std::make_unique<iceberg::map_value>();
     }
+    const auto& key_descriptor = *f.descriptor->message_type()->map_key();
+    const auto& value_descriptor = *f.descriptor->message_type()->map_value();
     auto ret = std::make_unique<iceberg::map_value>();
     auto parsed_map = std::get<parsed::map>(std::move(field.value()));
     ret->kvs.reserve(parsed_map.entries.size());
@@ -157,46 +218,36 @@ ss::future<optional_value_outcome> convert_map(
          * Convert key, if a parsed key is represented by a monostate we assume
          * it has a default value
          */
-        auto key_result = co_await ss::visit(
-          std::move(entry_k),
-          [&field_descriptor, &stack](std::monostate) {
+        auto key_result = ss::visit(
+          entry_k,
+          [this, &key_descriptor](std::monostate) {
               // default value
-              return single_field_to_value(
-                std::nullopt,
-                *field_descriptor.message_type()->map_key(),
-                stack);
+              return convert_single(key_descriptor, no_message, std::nullopt);
           },
-          [&field_descriptor, &stack](auto& value) {
-              return single_field_to_value(
-                std::move(value),
-                *field_descriptor.message_type()->map_key(),
-                stack);
+          [this, &key_descriptor](auto& value) {
+              return convert_single(
+                key_descriptor, no_message, std::move(value));
           });
 
         if (key_result.has_error()) {
-            co_return key_result.error();
+            return key_result.error();
         }
 
         if (!key_result.value().has_value()) {
-            co_return value_conversion_exception(fmt::format(
-              "Map key must exist. Map field {}",
-              field_descriptor.DebugString()));
+            return value_conversion_exception(fmt::format(
+              "Map key must exist. Map field {}", f.descriptor->DebugString()));
         }
 
-        optional_value_outcome value_result = co_await ss::visit(
-          std::move(entry_v),
-          [](std::monostate) {
-              return ssx::now<optional_value_outcome>(std::nullopt);
-          },
-          [&field_descriptor, &stack](auto& value) {
-              return single_field_to_value(
-                std::move(value),
-                *field_descriptor.message_type()->map_value(),
-                stack);
+        auto value_result = ss::visit(
+          entry_v,
+          [](std::monostate) -> optional_value_outcome { return std::nullopt; },
+          [this, &f, &value_descriptor](auto& value) {
+              return convert_single(
+                value_descriptor, f.message, std::move(value));
           });
 
         if (value_result.has_error()) {
-            co_return value_result.error();
+            return value_result.error();
         }
 
         ret->kvs.push_back(iceberg::kv_value{
@@ -204,36 +255,22 @@ ss::future<optional_value_outcome> convert_map(
           .val = std::move(value_result.value())});
     }
 
-    co_return ret;
+    return ret;
 }
 
-ss::future<optional_value_outcome> message_field_to_value(
-  std::optional<parsed::message::field> field,
-  const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack) {
-    if (field_descriptor.is_map()) {
-        return convert_map(std::move(field), field_descriptor, stack);
-    }
-
-    if (field_descriptor.is_repeated()) {
-        return convert_repeated(std::move(field), field_descriptor, stack);
-    }
-
-    return single_field_to_value(std::move(field), field_descriptor, stack);
-}
-
-ss::future<optional_value_outcome> single_field_to_value(
-  std::optional<parsed::message::field> field,
+// converts a single element to iceberg value
+optional_value_outcome protobuf_value_plan::convert_single(
   const pb::FieldDescriptor& field_descriptor,
-  proto_descriptors_stack& stack) {
+  uint32_t message,
+  std::optional<parsed::message::field> field) const {
     switch (field_descriptor.type()) {
     case pb::FieldDescriptor::TYPE_DOUBLE:
-        co_return convert<double, iceberg::double_value>(
+        return convert<double, iceberg::double_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_double);
     case pb::FieldDescriptor::TYPE_FLOAT:
-        co_return convert<float, iceberg::float_value>(
+        return convert<float, iceberg::float_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_float);
@@ -243,46 +280,45 @@ ss::future<optional_value_outcome> single_field_to_value(
     case pb::FieldDescriptor::TYPE_SFIXED64:
     case pb::FieldDescriptor::TYPE_INT64:
     case pb::FieldDescriptor::TYPE_SINT64:
-        co_return convert<int64_t, iceberg::long_value>(
+        return convert<int64_t, iceberg::long_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_int64);
     // unsigned 64 bit integers fallback to strings
     case pb::FieldDescriptor::TYPE_UINT64:
     case pb::FieldDescriptor::TYPE_FIXED64:
-        co_return convert_u64_as_string(
+        return convert_u64_as_string(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_uint64);
     case pb::FieldDescriptor::TYPE_INT32:
     case pb::FieldDescriptor::TYPE_SFIXED32:
     case pb::FieldDescriptor::TYPE_SINT32:
-        co_return convert<int32_t, iceberg::int_value>(
+        return convert<int32_t, iceberg::int_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_int32);
     case pb::FieldDescriptor::TYPE_ENUM:
         if (!field.has_value()) {
             if (field_descriptor.has_presence()) {
-                co_return std::nullopt;
+                return std::nullopt;
             }
-            co_return iceberg::int_value(
+            return iceberg::int_value(
               field_descriptor.default_value_enum()->number());
         }
-        co_return iceberg::int_value(
-          std::get<int32_t>(std::move(field.value())));
+        return iceberg::int_value(std::get<int32_t>(std::move(field.value())));
     case pb::FieldDescriptor::TYPE_BOOL:
-        co_return convert<bool, iceberg::boolean_value>(
+        return convert<bool, iceberg::boolean_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_bool);
     case pb::FieldDescriptor::TYPE_STRING:
-        co_return convert<iobuf, iceberg::string_value>(
+        return convert<iobuf, iceberg::string_value>(
           std::move(field),
           field_descriptor,
           &pb::FieldDescriptor::default_value_string);
     case pb::FieldDescriptor::TYPE_GROUP:
-        co_return type_conversion_error(field_descriptor);
+        return type_conversion_error(field_descriptor);
     case pb::FieldDescriptor::TYPE_MESSAGE: {
         std::unique_ptr<parsed::message> msg_field = nullptr;
         if (field.has_value()) {
@@ -290,80 +326,32 @@ ss::future<optional_value_outcome> single_field_to_value(
               std::move(field.value()));
         }
 
-        co_return co_await message_to_value(
-          std::move(msg_field), *field_descriptor.message_type(), stack);
+        return convert_message(message, std::move(msg_field));
     }
     case pb::FieldDescriptor::TYPE_BYTES:
         if (!field.has_value()) {
             if (field_descriptor.has_presence()) {
-                co_return std::nullopt;
+                return std::nullopt;
             }
-            co_return iceberg::binary_value{};
+            return iceberg::binary_value{};
         }
-        co_return iceberg::binary_value(
-          std::get<iobuf>(std::move(field.value())));
+        return iceberg::binary_value(std::get<iobuf>(std::move(field.value())));
     }
 }
 
-ss::future<optional_value_outcome> message_to_value(
-  std::unique_ptr<parsed::message> message,
-  const pb::Descriptor& descriptor,
-  proto_descriptors_stack& stack) {
-    if (message == nullptr) {
-        co_return std::nullopt;
-    }
-
-    if (is_recursive_type(descriptor, stack)) {
-        co_return value_conversion_exception(fmt::format(
-          "Recursive message types are not supported. Descriptor: {}",
-          descriptor.DebugString()));
-    }
-    if (stack.size() >= max_recursion_depth) {
-        co_return value_conversion_exception(fmt::format(
-          "Reached maximum recursion depth. Descriptor: {}",
-          descriptor.DebugString()));
-    }
-    stack.push_back(&descriptor);
-    auto ret = std::make_unique<iceberg::struct_value>();
-    ret->fields.reserve(descriptor.field_count());
-    /**
-     * The conversion is driven by walking through the message descriptor as
-     * some field with default values are skipped in parsed result.
-     */
-    for (int i = 0; i < descriptor.field_count(); ++i) {
-        auto field_descriptor = descriptor.field(i);
-        auto it = message->fields.find(field_descriptor->number());
-        auto field = it == message->fields.end()
-                       ? std::nullopt
-                       : std::make_optional<parsed::message::field>(
-                           std::move(it->second));
-
-        auto result = co_await message_field_to_value(
-          std::move(field), *field_descriptor, stack);
-
-        if (result.has_error()) {
-            co_return result.error();
-        }
-        ret->fields.push_back(std::move(result.value()));
-    }
-    stack.pop_back();
-    co_return ret;
-}
-} // namespace
 ss::future<optional_value_outcome> proto_parsed_message_to_value(
   std::unique_ptr<parsed::message> message, const pb::Descriptor& descriptor) {
-    proto_descriptors_stack stack;
-    co_return co_await message_to_value(std::move(message), descriptor, stack);
+    protobuf_value_plan plan(descriptor);
+    return ssx::now(plan.to_value(std::move(message)));
 }
 
 ss::future<optional_value_outcome>
-deserialize_protobuf(iobuf buffer, const pb::Descriptor& type_descriptor) {
+deserialize_protobuf(iobuf buffer, const protobuf_value_plan& plan) {
     try {
         auto msg_ptr = co_await serde::pb::parse(
-          std::move(buffer), type_descriptor);
+          std::move(buffer), plan.descriptor());
 
-        co_return co_await proto_parsed_message_to_value(
-          std::move(msg_ptr), type_descriptor);
+        co_return plan.to_value(std::move(msg_ptr));
     } catch (...) {
         co_return value_outcome(value_conversion_exception(fmt::format(
           "exception thrown while parsing protobuf - {}",
@@ -371,4 +359,17 @@ deserialize_protobuf(iobuf buffer, const pb::Descriptor& type_descriptor) {
     }
 }
 
+ss::future<optional_value_outcome>
+deserialize_protobuf(iobuf buffer, const pb::Descriptor& type_descriptor) {
+    std::optional<protobuf_value_plan> plan;
+    try {
+        plan.emplace(type_descriptor);
+    } catch (...) {
+        co_return value_outcome(value_conversion_exception(fmt::format(
+          "exception thrown while compiling protobuf descriptor - {}",
+          std::current_exception())));
+    }
+    co_return co_await deserialize_protobuf(std::move(buffer), *plan);
+}
+
 } // namespace datalake
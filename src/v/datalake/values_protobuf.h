@@ -10,17 +10,94 @@
 #pragma once
 
 #include "datalake/conversion_outcome.h"
+#include "datalake/protobuf_utils.h"
 #include "google/protobuf/descriptor.h"
 #include "serde/protobuf/parser.h"
 
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace datalake {
 
+/**
+ * Conversion of parsed protobuf messages into iceberg values, compiled once
+ * per message descriptor.
+ *
+ * Every message type reachable from the descriptor gets a step listing the
+ * fields to convert. Nested message types are linked to their steps, and
+ * recursive or too deeply nested types are detected, when the plan is built
+ * rather than for every message.
+ *
+ * The plan refers to the descriptor it was built from, it must not outlive
+ * it.
+ */
+class protobuf_value_plan {
+public:
+    explicit protobuf_value_plan(const google::protobuf::Descriptor&);
+
+    const google::protobuf::Descriptor& descriptor() const noexcept {
+        return *_descriptor;
+    }
+
+    optional_value_outcome
+      to_value(std::unique_ptr<serde::pb::parsed::message>) const;
+
+private:
+    static constexpr uint32_t no_message = std::numeric_limits<uint32_t>::max();
+
+    struct field_step {
+        const google::protobuf::FieldDescriptor* descriptor;
+        // Step of the message type of a message field, or of the map value
+        // of a map field
+        uint32_t message{no_message};
+    };
+
+    struct message_step {
+        // Range in `_fields`
+        uint32_t fields_begin{0};
+        uint32_t fields_end{0};
+        // Set if messages of this type can't be converted. It is only
+        // reported for messages which are present.
+        std::optional<std::string> error;
+    };
+
+    uint32_t compile(
+      const google::protobuf::Descriptor&, proto_descriptors_stack&);
+
+    optional_value_outcome convert_message(
+      uint32_t, std::unique_ptr<serde::pb::parsed::message>) const;
+    optional_value_outcome convert_field(
+      const field_step&,
+      std::optional<serde::pb::parsed::message::field>) const;
+    optional_value_outcome convert_single(
+      const google::protobuf::FieldDescriptor&,
+      uint32_t message,
+      std::optional<serde::pb::parsed::message::field>) const;
+    optional_value_outcome convert_repeated(
+      const field_step&,
+      std::optional<serde::pb::parsed::message::field>) const;
+    optional_value_outcome convert_map(
+      const field_step&,
+      std::optional<serde::pb::parsed::message::field>) const;
+
+    const google::protobuf::Descriptor* _descriptor;
+    std::vector<message_step> _messages;
+    std::vector<field_step> _fields;
+};
+
 /**
  * Deserializes a protobuf message using serde::pb::parser and converts it to
  * iceberg::value
  */
 ss::future<optional_value_outcome> deserialize_protobuf(
   iobuf buffer, const google::protobuf::Descriptor& type_descriptor);
+/**
+ * Deserializes a protobuf message with a precompiled plan
+ */
+ss::future<optional_value_outcome>
+deserialize_protobuf(iobuf buffer, const protobuf_value_plan& plan);
 /**
  * Converts protocol serde::pb::parsed_message to an iceberg::value
  */
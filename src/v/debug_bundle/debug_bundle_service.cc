@@ -127,6 +127,34 @@ ss::future<> write_file(std::string_view path, iobuf buf) {
     co_await ostrm.flush();
 }
 
+constexpr std::string_view nice_path = "/usr/bin/nice";
+constexpr std::string_view ionice_path = "/usr/bin/ionice";
+
+/// rpk inherits the CPU affinity of the reactor which spawned it, so the
+/// collection competes with the broker for that core and for the disk.
+/// Prefixes \p args so that rpk runs with the lowest CPU priority and the
+/// lowest best-effort IO priority, if the tools to do so are present.
+ss::future<std::vector<ss::sstring>>
+run_at_low_priority(std::vector<ss::sstring> args) {
+    std::vector<ss::sstring> prefix;
+    if (co_await ss::file_exists(nice_path)) {
+        prefix.insert(prefix.end(), {ss::sstring{nice_path}, "-n", "19"});
+    }
+    if (co_await ss::file_exists(ionice_path)) {
+        // -t: run rpk anyway if the IO priority can't be set
+        prefix.insert(
+          prefix.end(), {ss::sstring{ionice_path}, "-c", "2", "-n", "7", "-t"});
+    }
+    if (prefix.empty()) {
+        co_return args;
+    }
+    prefix.insert(
+      prefix.end(),
+      std::make_move_iterator(args.begin()),
+      std::make_move_iterator(args.end()));
+    co_return prefix;
+}
+
 bool was_run_successful(ss::experimental::process::wait_status wait_status) {
     auto* exited = std::get_if<ss::experimental::process::wait_exited>(
       &wait_status);
@@ -411,7 +439,8 @@ ss::future<result<void>> service::initiate_rpk_debug_bundle_collection(
     if (!args_res.has_value()) {
         co_return args_res.assume_error();
     }
-    auto args = std::move(args_res.assume_value());
+    auto args = co_await run_at_low_priority(
+      std::move(args_res.assume_value()));
     if (lg.is_enabled(ss::log_level::debug)) {
         print_arguments(args);
     }
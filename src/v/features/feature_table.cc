@@ -100,6 +100,12 @@ std::string_view to_string_view(feature f) {
         return "raft_symmetric_reconfiguration_cancel";
     case feature::datalake_iceberg_ga:
         return "datalake_iceberg_ga";
+    case feature::rpc_lz4_compression:
+        return "rpc_lz4_compression";
+    case feature::bulk_create_topics:
+        return "bulk_create_topics";
+    case feature::offset_translator_compact_checkpoints:
+        return "offset_translator_compact_checkpoints";
 
     /*
      * testing features
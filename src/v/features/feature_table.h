@@ -70,6 +70,9 @@ enum class feature : std::uint64_t {
     datalake_iceberg = 1ULL << 54U,
     raft_symmetric_reconfiguration_cancel = 1ULL << 55U,
     datalake_iceberg_ga = 1ULL << 56U,
+    rpc_lz4_compression = 1ULL << 57U,
+    bulk_create_topics = 1ULL << 58U,
+    offset_translator_compact_checkpoints = 1ULL << 59U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -422,6 +425,24 @@ inline constexpr std::array feature_schema{
     feature::datalake_iceberg_ga,
     feature_spec::available_policy::always,
     feature_spec::prepare_policy::always},
+  feature_spec{
+    release_version::v25_1_1,
+    "rpc_lz4_compression",
+    feature::rpc_lz4_compression,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    release_version::v25_1_1,
+    "bulk_create_topics",
+    feature::bulk_create_topics,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    release_version::v25_1_1,
+    "offset_translator_compact_checkpoints",
+    feature::offset_translator_compact_checkpoints,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
 };
 
 std::string_view to_string_view(feature);
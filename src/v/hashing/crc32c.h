@@ -14,6 +14,8 @@
 
 #include <crc32c/crc32c.h>
 
+#include <algorithm>
+#include <array>
 #include <type_traits>
 
 namespace crc {
@@ -43,11 +45,34 @@ private:
 
 } // namespace crc
 
+/// Extends the checksum with the contents of the buffer. Runs of small
+/// fragments are gathered into a staging buffer and checksummed together, the
+/// hardware kernel interleaves several streams and only gets to do so over
+/// long enough inputs.
 inline void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf) {
-    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
-    (void)in.consume(buf.size_bytes(), [&crc](const char* src, size_t sz) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), sz);
-        return ss::stop_iteration::no;
-    });
+    static constexpr size_t small_fragment_bytes = 256;
+    static constexpr size_t staging_bytes = 4096;
+    std::array<uint8_t, staging_bytes> staging; // NOLINT
+    size_t staged = 0;
+    for (const auto& frag : buf) {
+        const auto* src = frag.get();
+        const auto sz = frag.size();
+        if (sz >= small_fragment_bytes) {
+            if (staged > 0) {
+                crc.extend(staging.data(), staged);
+                staged = 0;
+            }
+            crc.extend(src, sz);
+            continue;
+        }
+        if (staged + sz > staging.size()) {
+            crc.extend(staging.data(), staged);
+            staged = 0;
+        }
+        std::copy_n(src, sz, staging.data() + staged);
+        staged += sz;
+    }
+    if (staged > 0) {
+        crc.extend(staging.data(), staged);
+    }
 }
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "hashing/crc32c.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
@@ -127,6 +128,70 @@ PERF_TEST(header_hash, xx32_fn) {
       [](auto& buffer) { return xxhash_32(buffer.data(), buffer.size()); });
 }
 
+namespace {
+
+constexpr size_t fragmented_bytes = 64_KiB;
+
+// A buffer of the given fragment size, e.g. the records of a batch parsed out
+// of a request made of small writes.
+iobuf make_fragmented(size_t fragment_bytes) {
+    auto data = random_generators::gen_alphanum_string(fragmented_bytes);
+    iobuf buf;
+    for (size_t pos = 0; pos < data.size(); pos += fragment_bytes) {
+        iobuf frag;
+        frag.append(
+          data.data() + pos, std::min(fragment_bytes, data.size() - pos));
+        buf.append_fragments(std::move(frag));
+    }
+    return buf;
+}
+
+template<typename F>
+size_t fragmented_body(size_t fragment_bytes, F f) {
+    auto buf = make_fragmented(fragment_bytes);
+    perf_tests::start_measuring_time();
+    for (auto i = inner_iters / 10; i--;) {
+        auto s = f(buf);
+        perf_tests::do_not_optimize(s);
+    }
+    perf_tests::stop_measuring_time();
+    return (inner_iters / 10) * fragmented_bytes;
+}
+
+uint32_t crc_per_fragment(const iobuf& buf) {
+    crc::crc32c crc;
+    for (const auto& frag : buf) {
+        crc.extend(frag.get(), frag.size());
+    }
+    return crc.value();
+}
+
+uint32_t crc_iobuf(const iobuf& buf) {
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, buf);
+    return crc.value();
+}
+
+} // namespace
+
+PERF_TEST(iobuf_crc, per_fragment_64b) {
+    return fragmented_body(64, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc, staged_64b) { return fragmented_body(64, crc_iobuf); }
+
+PERF_TEST(iobuf_crc, per_fragment_200b) {
+    return fragmented_body(200, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc, staged_200b) { return fragmented_body(200, crc_iobuf); }
+
+PERF_TEST(iobuf_crc, per_fragment_16k) {
+    return fragmented_body(16_KiB, crc_per_fragment);
+}
+
+PERF_TEST(iobuf_crc, staged_16k) { return fragmented_body(16_KiB, crc_iobuf); }
+
 using model::ktp;
 using model::ktp_with_hash;
 using model::ntp;
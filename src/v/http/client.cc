@@ -92,12 +92,25 @@ void client::check() const {
     }
 }
 
+ss::lowres_clock::duration
+client::connection_age(ss::lowres_clock::time_point now) const {
+    return _last_response == ss::lowres_clock::time_point::min()
+             ? ss::lowres_clock::duration::max()
+             : now - _last_response;
+}
+
 ss::future<client::request_response_t> client::make_request(
   client::request_header&& header, ss::lowres_clock::duration timeout) {
     if (unlikely(_stopped)) {
         std::runtime_error err("client is stopped");
         return ss::make_exception_future<client::request_response_t>(err);
     }
+    if (_warm_up && !_warm_up->available()) {
+        return _warm_up->get_future().then(
+          [this, header = std::move(header), timeout]() mutable {
+              return make_request(std::move(header), timeout);
+          });
+    }
     // Set request HTTP-version to 1.1
     constexpr unsigned http_version = 11;
     header.version(http_version);
@@ -117,9 +130,7 @@ ss::future<client::request_response_t> client::make_request(
     auto res = ss::make_shared<response_stream>(this, verb, target_str);
 
     auto now = ss::lowres_clock::now();
-    auto age = _last_response == ss::lowres_clock::time_point::min()
-                 ? ss::lowres_clock::duration::max()
-                 : now - _last_response;
+    auto age = connection_age(now);
     if (is_valid()) {
         if (age < _max_idle_time) {
             // Reuse connection
@@ -218,6 +229,38 @@ ss::future<reconnect_result_t> client::get_connected(
                          : reconnect_result_t::timed_out;
 }
 
+ss::future<> client::warm_up(ss::lowres_clock::duration timeout) {
+    if (_stopped || (_warm_up && !_warm_up->available())) {
+        co_return;
+    }
+    auto now = ss::lowres_clock::now();
+    if (is_valid() && connection_age(now) < _max_idle_time) {
+        co_return;
+    }
+    ss::promise<> done;
+    _warm_up = ss::shared_future<>(done.get_future());
+    auto signal = ss::defer([&done]() noexcept { done.set_value(); });
+
+    prefix_logger ctxlog(http_log, ssx::sformat("[{}]", _host_with_port));
+    if (is_valid()) {
+        vlog(ctxlog.debug, "warm up replaces idle connection");
+        shutdown();
+    }
+    try {
+        auto r = co_await get_connected(timeout, ctxlog);
+        if (r == reconnect_result_t::connected) {
+            // A fresh connection counts as used, otherwise the next request
+            // would consider it idle and reconnect.
+            _last_response = ss::lowres_clock::now();
+        }
+    } catch (...) {
+        vlog(
+          ctxlog.debug,
+          "connection warm up failed: {}",
+          std::current_exception());
+    }
+}
+
 ss::future<> client::stop() {
     if (_stopped) {
         // Prevent double call to stop() as constructs such as with_client()
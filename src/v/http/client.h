@@ -22,6 +22,7 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/core/weak_ptr.hh>
@@ -35,6 +36,7 @@
 
 #include <chrono>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
 
@@ -142,6 +144,13 @@ public:
     ss::future<reconnect_result_t>
     get_connected(ss::lowres_clock::duration timeout, prefix_logger ctxlog);
 
+    /// Establish the connection ahead of the next request so that it doesn't
+    /// pay for the TCP and TLS handshakes. Does nothing if the client already
+    /// has a connection which can be reused. Never fails, a request which is
+    /// made while the warm up is in progress waits for it and connects on its
+    /// own if the warm up didn't succeed.
+    ss::future<> warm_up(ss::lowres_clock::duration timeout);
+
     void fail_outstanding_futures() noexcept override;
 
     // Response state machine
@@ -306,6 +315,10 @@ private:
     /// Throw exception if _as is aborted
     void check() const;
 
+    /// Time since the last response was received
+    ss::lowres_clock::duration
+    connection_age(ss::lowres_clock::time_point now) const;
+
     bool _stopped{false};
     bool _shutdown_now{false};
     std::string _host_with_port;
@@ -317,6 +330,9 @@ private:
     ss::lowres_clock::time_point _last_response{
       ss::lowres_clock::time_point::min()};
     ss::lowres_clock::duration _max_idle_time;
+    // Set while a warm up is connecting the transport, requests wait for it
+    // instead of making a concurrent connection attempt.
+    std::optional<ss::shared_future<>> _warm_up;
 };
 
 /// Utility function for producing a copy of the request header with some
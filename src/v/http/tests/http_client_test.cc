@@ -361,6 +361,30 @@ SEASTAR_THREAD_TEST_CASE(test_http_GET_roundtrip) {
       });
 }
 
+SEASTAR_THREAD_TEST_CASE(test_http_GET_during_warm_up) {
+    auto config = transport_configuration();
+    auto [server, client] = started_client_and_server(config);
+    auto warm_up = client->warm_up(5s);
+
+    // the request is made while the connection is being established and
+    // has to reuse it rather than connecting on its own
+    http::client::request_header header;
+    header.method(boost::beast::http::verb::get);
+    header.target("/get");
+    header_set_host(header, config.server_addr);
+    auto resp = client->request_and_collect_response(std::move(header)).get();
+    warm_up.get();
+    BOOST_REQUIRE_EQUAL(resp.status, boost::beast::http::status::ok);
+    iobuf_parser parser(std::move(resp.body));
+    std::string actual = parser.read_string(parser.bytes_left());
+    BOOST_REQUIRE_EQUAL(
+      actual, "\"" + std::string(httpd_server_reply) + "\"");
+
+    // warming up a connection which is already usable is a no-op
+    client->warm_up(5s).get();
+    server->stop().get();
+}
+
 SEASTAR_THREAD_TEST_CASE(test_http_PUT_roundtrip) {
     // Send data and recv empty response
     auto config = transport_configuration();
@@ -128,69 +128,141 @@ metadata_from_reader(avro::DataFileReader<avro::GenericDatum>& rdr) {
 
 } // anonymous namespace
 
-iobuf serialize_avro(const manifest& m) {
-    size_t bytes_streamed = 0;
-    avro_iobuf_ostream::buf_container_t bufs;
-    static constexpr size_t avro_default_sync_bytes = 16_KiB;
-    auto meta = metadata_to_map(m.metadata);
-    auto pk_type = partition_key_type::create(
-      m.metadata.partition_spec, m.metadata.schema);
-    auto entry_type = manifest_entry_type(std::move(pk_type));
-    auto entry_schema = avro::ValidSchema(
-      struct_type_to_avro(entry_type, "manifest_entry"));
-    {
+class manifest_avro_writer::impl {
+public:
+    explicit impl(const manifest_metadata& meta)
+      : entry_schema_(make_entry_schema(meta)) {
+        static constexpr size_t avro_default_sync_bytes = 16_KiB;
         auto out = std::make_unique<avro_iobuf_ostream>(
-          4_KiB, &bufs, &bytes_streamed);
-        avro::DataFileWriter<avro::GenericDatum> writer(
+          4_KiB, &bufs_, &bytes_streamed_);
+        writer_ = std::make_unique<avro::DataFileWriter<avro::GenericDatum>>(
           std::move(out),
-          entry_schema,
+          entry_schema_,
           avro_default_sync_bytes,
           avro::NULL_CODEC,
-          meta);
+          metadata_to_map(meta));
+    }
 
-        for (auto& e : m.entries) {
-            auto entry_struct = manifest_entry_to_value(e);
-            auto entry_datum = struct_to_avro(
-              entry_struct, entry_schema.root());
-            writer.write(entry_datum);
-        }
-        writer.flush();
-        writer.close();
+    void write(const manifest_entry& e) {
+        auto entry_struct = manifest_entry_to_value(e);
+        auto entry_datum = struct_to_avro(entry_struct, entry_schema_.root());
+        writer_->write(entry_datum);
+        ++num_entries_;
+    }
 
+    size_t num_entries() const { return num_entries_; }
+
+    iobuf finish() && {
+        writer_->flush();
+        writer_->close();
         // NOTE: ~DataFileWriter does a final sync which may write to the
         // chunks. Destruct the writer before moving ownership of the chunks.
+        writer_.reset();
+        iobuf buf;
+        for (auto& b : bufs_) {
+            buf.append(std::move(b));
+        }
+        bufs_.clear();
+        buf.trim_back(buf.size_bytes() - bytes_streamed_);
+        return buf;
     }
-    iobuf buf;
-    for (auto& b : bufs) {
-        buf.append(std::move(b));
+
+private:
+    static avro::ValidSchema make_entry_schema(const manifest_metadata& meta) {
+        auto pk_type = partition_key_type::create(
+          meta.partition_spec, meta.schema);
+        auto entry_type = manifest_entry_type(std::move(pk_type));
+        return avro::ValidSchema(
+          struct_type_to_avro(entry_type, "manifest_entry"));
     }
-    buf.trim_back(buf.size_bytes() - bytes_streamed);
-    return buf;
+
+    avro::ValidSchema entry_schema_;
+    // The writer's output stream points at these, the impl must not move.
+    avro_iobuf_ostream::buf_container_t bufs_;
+    size_t bytes_streamed_{0};
+    std::unique_ptr<avro::DataFileWriter<avro::GenericDatum>> writer_;
+    size_t num_entries_{0};
+};
+
+manifest_avro_writer::manifest_avro_writer(const manifest_metadata& meta)
+  : impl_(std::make_unique<impl>(meta)) {}
+manifest_avro_writer::manifest_avro_writer(manifest_avro_writer&&) noexcept
+  = default;
+manifest_avro_writer&
+manifest_avro_writer::operator=(manifest_avro_writer&&) noexcept
+  = default;
+manifest_avro_writer::~manifest_avro_writer() = default;
+
+void manifest_avro_writer::write(const manifest_entry& e) { impl_->write(e); }
+
+size_t manifest_avro_writer::num_entries() const {
+    return impl_->num_entries();
 }
 
-manifest parse_manifest(const partition_key_type& pk_type, iobuf buf) {
-    auto entry_type = field_type{manifest_entry_type(pk_type.copy())};
-    auto entry_schema = avro::ValidSchema(
-      struct_type_to_avro(std::get<struct_type>(entry_type), "manifest_entry"));
-    auto in = std::make_unique<avro_iobuf_istream>(std::move(buf));
-    avro::DataFileReader<avro::GenericDatum> reader(
-      std::move(in), entry_schema);
-    auto meta = metadata_from_reader(reader);
-    chunked_vector<manifest_entry> entries;
-    while (true) {
-        avro::GenericDatum d(entry_schema);
-        auto did_read = reader.read(d);
-        if (!did_read) {
-            break;
+iobuf manifest_avro_writer::finish() && { return std::move(*impl_).finish(); }
+
+class manifest_avro_reader::impl {
+public:
+    impl(const partition_key_type& pk_type, iobuf buf)
+      : entry_type_(manifest_entry_type(pk_type.copy()))
+      , entry_schema_(struct_type_to_avro(
+          std::get<struct_type>(entry_type_), "manifest_entry"))
+      , reader_(
+          std::make_unique<avro_iobuf_istream>(std::move(buf)), entry_schema_)
+      , metadata_(metadata_from_reader(reader_)) {}
+
+    const manifest_metadata& metadata() const { return metadata_; }
+
+    std::optional<manifest_entry> next() {
+        avro::GenericDatum d(entry_schema_);
+        if (!reader_.read(d)) {
+            return std::nullopt;
         }
         auto parsed_struct = std::get<std::unique_ptr<struct_value>>(
-          *val_from_avro(d, entry_type, field_required::yes));
-        entries.emplace_back(
-          manifest_entry_from_value(std::move(*parsed_struct)));
+          *val_from_avro(d, entry_type_, field_required::yes));
+        return manifest_entry_from_value(std::move(*parsed_struct));
     }
+
+private:
+    field_type entry_type_;
+    avro::ValidSchema entry_schema_;
+    avro::DataFileReader<avro::GenericDatum> reader_;
+    manifest_metadata metadata_;
+};
+
+manifest_avro_reader::manifest_avro_reader(
+  const partition_key_type& pk_type, iobuf buf)
+  : impl_(std::make_unique<impl>(pk_type, std::move(buf))) {}
+manifest_avro_reader::manifest_avro_reader(manifest_avro_reader&&) noexcept
+  = default;
+manifest_avro_reader&
+manifest_avro_reader::operator=(manifest_avro_reader&&) noexcept
+  = default;
+manifest_avro_reader::~manifest_avro_reader() = default;
+
+const manifest_metadata& manifest_avro_reader::metadata() const {
+    return impl_->metadata();
+}
+
+std::optional<manifest_entry> manifest_avro_reader::next() {
+    return impl_->next();
+}
+
+iobuf serialize_avro(const manifest& m) {
+    manifest_avro_writer writer(m.metadata);
+    for (const auto& e : m.entries) {
+        writer.write(e);
+    }
+    return std::move(writer).finish();
+}
+
+manifest parse_manifest(const partition_key_type& pk_type, iobuf buf) {
+    manifest_avro_reader reader(pk_type, std::move(buf));
     manifest m;
-    m.metadata = std::move(meta);
-    m.entries = std::move(entries);
+    m.metadata = reader.metadata().copy();
+    while (auto e = reader.next()) {
+        m.entries.emplace_back(std::move(*e));
+    }
     return m;
 }
 
@@ -12,9 +12,56 @@
 #include "iceberg/manifest.h"
 #include "iceberg/partition_key_type.h"
 
+#include <memory>
+#include <optional>
+
 namespace iceberg {
 
 iobuf serialize_avro(const manifest&);
 manifest parse_manifest(const partition_key_type&, iobuf);
 
+// Serializes a manifest one entry at a time, so that callers building large
+// manifests (e.g. merging many manifests into one) only need to keep the
+// serialized form of the entries in memory rather than the entries themselves.
+class manifest_avro_writer {
+public:
+    explicit manifest_avro_writer(const manifest_metadata&);
+    manifest_avro_writer(manifest_avro_writer&&) noexcept;
+    manifest_avro_writer& operator=(manifest_avro_writer&&) noexcept;
+    ~manifest_avro_writer();
+
+    void write(const manifest_entry&);
+
+    // The number of entries written so far.
+    size_t num_entries() const;
+
+    // Flushes the remaining entries and returns the serialized manifest.
+    iobuf finish() &&;
+
+private:
+    class impl;
+    std::unique_ptr<impl> impl_;
+};
+
+// Parses the entries of a serialized manifest one at a time, so that callers
+// iterating over a manifest don't need to hold all of its entries at once.
+class manifest_avro_reader {
+public:
+    // Throws if the manifest header can't be parsed.
+    manifest_avro_reader(const partition_key_type&, iobuf);
+    manifest_avro_reader(manifest_avro_reader&&) noexcept;
+    manifest_avro_reader& operator=(manifest_avro_reader&&) noexcept;
+    ~manifest_avro_reader();
+
+    const manifest_metadata& metadata() const;
+
+    // Returns the next entry, or std::nullopt once all of the entries have
+    // been read. Throws if an entry can't be parsed.
+    std::optional<manifest_entry> next();
+
+private:
+    class impl;
+    std::unique_ptr<impl> impl_;
+};
+
 } // namespace iceberg
@@ -10,10 +10,10 @@
 
 #include "bytes/iobuf.h"
 #include "iceberg/manifest.h"
+#include "iceberg/logger.h"
 #include "iceberg/manifest_avro.h"
 #include "iceberg/manifest_list.h"
 #include "iceberg/manifest_list_avro.h"
-#include "ssx/future-util.h"
 
 #include <seastar/coroutine/as_future.hh>
 #include <seastar/util/noncopyable_function.hh>
@@ -23,6 +23,60 @@
 using namespace std::chrono_literals;
 
 namespace iceberg {
+
+namespace {
+
+template<typename T>
+auto make_cache(size_t cache_size_bytes) {
+    using cache_t = utils::chunked_kv_cache<std::string, T>;
+    if (cache_size_bytes == 0) {
+        return std::unique_ptr<cache_t>{};
+    }
+    return std::make_unique<cache_t>(typename cache_t::config{
+      .cache_size = cache_size_bytes,
+      .small_size = cache_size_bytes / 10,
+    });
+}
+
+template<typename T>
+void maybe_cache(
+  utils::chunked_kv_cache<std::string, T>* cache,
+  const std::filesystem::path& path,
+  const T& t,
+  size_t size_bytes) {
+    if (cache != nullptr) {
+        cache->try_insert(
+          path.native(), ss::make_shared<T>(t.copy()), size_bytes);
+    }
+}
+
+template<typename T>
+std::optional<T> maybe_get_cached(
+  utils::chunked_kv_cache<std::string, T>* cache,
+  const std::filesystem::path& path) {
+    if (cache == nullptr) {
+        return std::nullopt;
+    }
+    auto cached = cache->get_value(path.native());
+    if (!cached) {
+        return std::nullopt;
+    }
+    // The caller owns what it gets back, e.g. appends move the entries out.
+    return (*cached)->copy();
+}
+
+} // namespace
+
+manifest_io::manifest_io(
+  cloud_io::remote& io,
+  cloud_storage_clients::bucket_name b,
+  size_t cache_size_bytes)
+  : metadata_io(io, std::move(b))
+  , manifest_cache_(make_cache<manifest>(cache_size_bytes))
+  , manifest_list_cache_(make_cache<manifest_list>(cache_size_bytes)) {}
+
+manifest_io::~manifest_io() = default;
+
 ss::future<checked<manifest, metadata_io::errc>> manifest_io::download_manifest(
   const uri& uri, const partition_key_type& pk_type) {
     auto path_res = from_uri(uri);
@@ -47,51 +101,147 @@ manifest_io::download_manifest_list(const uri& uri) {
 
 ss::future<checked<manifest, metadata_io::errc>> manifest_io::download_manifest(
   const manifest_path& path, const partition_key_type& pk_type) {
-    co_return co_await download_object<manifest>(
-      path(), "iceberg::manifest", [&pk_type](iobuf b) {
+    if (auto cached = maybe_get_cached(manifest_cache_.get(), path())) {
+        co_return std::move(*cached);
+    }
+    size_t size_bytes = 0;
+    auto res = co_await download_object<manifest>(
+      path(), "iceberg::manifest", [&pk_type, &size_bytes](iobuf b) {
+          size_bytes = b.size_bytes();
           return parse_manifest(pk_type, std::move(b));
       });
+    if (res.has_value()) {
+        maybe_cache(manifest_cache_.get(), path(), res.value(), size_bytes);
+    }
+    co_return res;
 }
 
 ss::future<checked<manifest_list, metadata_io::errc>>
 manifest_io::download_manifest_list(const manifest_list_path& path) {
-    return download_object<manifest_list>(
-      path(), "iceberg::manifest_list", parse_manifest_list);
+    if (auto cached = maybe_get_cached(manifest_list_cache_.get(), path())) {
+        co_return std::move(*cached);
+    }
+    size_t size_bytes = 0;
+    auto res = co_await download_object<manifest_list>(
+      path(), "iceberg::manifest_list", [&size_bytes](iobuf b) {
+          size_bytes = b.size_bytes();
+          return parse_manifest_list(std::move(b));
+      });
+    if (res.has_value()) {
+        maybe_cache(
+          manifest_list_cache_.get(), path(), res.value(), size_bytes);
+    }
+    co_return res;
 }
 
 ss::future<checked<size_t, metadata_io::errc>>
 manifest_io::upload_manifest(const manifest_path& path, const manifest& m) {
-    return upload_object<manifest>(
+    auto res = co_await upload_object<manifest>(
       path().string(), m, "iceberg::manifest", [](const manifest& m) {
           return serialize_avro(m);
       });
+    if (res.has_value()) {
+        maybe_cache(manifest_cache_.get(), path(), m, res.value());
+    }
+    co_return res;
+}
+
+ss::future<checked<size_t, metadata_io::errc>>
+manifest_io::download_manifest_entries(
+  const manifest_path& path,
+  const partition_key_type& pk_type,
+  ss::noncopyable_function<void(manifest_entry)> consume) {
+    if (manifest_cache_) {
+        if (auto cached = manifest_cache_->get_value(path().native())) {
+            // Hold on to the cached manifest in case it gets evicted while
+            // its entries are being consumed.
+            auto m = *cached;
+            try {
+                for (const auto& e : m->entries) {
+                    consume(e.copy());
+                }
+            } catch (...) {
+                vlog(
+                  log.error,
+                  "Exception while consuming iceberg::manifest (path: {}): {}",
+                  path(),
+                  std::current_exception());
+                co_return errc::failed;
+            }
+            co_return m->entries.size();
+        }
+    }
+    co_return co_await download_object<size_t>(
+      path(), "iceberg::manifest", [&pk_type, &consume](iobuf b) {
+          manifest_avro_reader reader(pk_type, std::move(b));
+          size_t num_entries = 0;
+          while (auto e = reader.next()) {
+              consume(std::move(*e));
+              ++num_entries;
+          }
+          return num_entries;
+      });
+}
+
+ss::future<checked<size_t, metadata_io::errc>>
+manifest_io::download_manifest_entries(
+  const uri& uri,
+  const partition_key_type& pk_type,
+  ss::noncopyable_function<void(manifest_entry)> consume) {
+    auto path_res = from_uri(uri);
+    if (path_res.has_error()) {
+        co_return path_res.error();
+    }
+    co_return co_await download_manifest_entries(
+      manifest_path(path_res.value()), pk_type, std::move(consume));
+}
+
+ss::future<checked<size_t, metadata_io::errc>> manifest_io::upload_manifest(
+  const manifest_path& path, manifest_avro_writer writer) {
+    return upload_serialized(
+      path(), std::move(writer).finish(), "iceberg::manifest");
+}
+
+ss::future<checked<size_t, metadata_io::errc>>
+manifest_io::upload_manifest(const uri& uri, manifest_avro_writer writer) {
+    auto path_res = from_uri(uri);
+    if (path_res.has_error()) {
+        co_return path_res.error();
+    }
+    co_return co_await upload_manifest(
+      manifest_path(path_res.value()), std::move(writer));
 }
 
 ss::future<checked<size_t, metadata_io::errc>>
 manifest_io::upload_manifest(const uri& uri, const manifest& m) {
     auto path_res = from_uri(uri);
     if (path_res.has_error()) {
-        return ssx::now<checked<size_t, metadata_io::errc>>(path_res.error());
+        co_return path_res.error();
     }
-    return upload_manifest(manifest_path(path_res.value()), m);
+    co_return co_await upload_manifest(manifest_path(path_res.value()), m);
 }
 
 ss::future<checked<size_t, metadata_io::errc>>
 manifest_io::upload_manifest_list(
   const manifest_list_path& path, const manifest_list& m) {
-    return upload_object<manifest_list>(
+    auto res = co_await upload_object<manifest_list>(
       path().string(), m, "iceberg::manifest_list", [](const manifest_list& m) {
           return serialize_avro(m);
       });
+    if (res.has_value()) {
+        maybe_cache(manifest_list_cache_.get(), path(), m, res.value());
+    }
+    co_return res;
 }
 
 ss::future<checked<size_t, metadata_io::errc>>
 manifest_io::upload_manifest_list(const uri& uri, const manifest_list& m) {
     auto path_res = from_uri(uri);
     if (path_res.has_error()) {
-        return ssx::now<checked<size_t, metadata_io::errc>>(path_res.error());
+        co_return path_res.error();
     }
-    return upload_manifest_list(manifest_list_path(path_res.value()), m);
+    co_return co_await upload_manifest_list(
+      manifest_list_path(path_res.value()), m);
 }
 
 } // namespace iceberg
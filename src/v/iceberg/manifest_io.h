@@ -12,9 +12,11 @@
 #include "cloud_io/remote.h"
 #include "cloud_storage_clients/types.h"
 #include "iceberg/manifest.h"
+#include "iceberg/manifest_avro.h"
 #include "iceberg/manifest_list.h"
 #include "iceberg/metadata_io.h"
 #include "iceberg/partition_key_type.h"
+#include "utils/chunked_kv_cache.h"
 #include "utils/named_type.h"
 
 #include <seastar/core/future.hh>
@@ -29,10 +31,16 @@ using manifest_list_path
 
 class manifest_io : public metadata_io {
 public:
+    // With a non-zero cache size, the manifests and manifest lists uploaded or
+    // downloaded by this instance are kept in memory until their total
+    // serialized size exceeds it. Metadata files are never modified once
+    // written, so e.g. each append can reuse the manifest list and the recent
+    // manifests written by the previous append instead of downloading them.
     explicit manifest_io(
-      cloud_io::remote& io, cloud_storage_clients::bucket_name b)
-      : metadata_io(io, std::move(b)) {}
-    ~manifest_io() = default;
+      cloud_io::remote& io,
+      cloud_storage_clients::bucket_name b,
+      size_t cache_size_bytes = 0);
+    ~manifest_io();
 
     ss::future<checked<manifest, metadata_io::errc>> download_manifest(
       const manifest_path& path, const partition_key_type& pk_type);
@@ -53,6 +61,35 @@ public:
 
     ss::future<checked<size_t, metadata_io::errc>>
     upload_manifest_list(const uri& path, const manifest_list&);
+
+    // Streaming counterparts of download_manifest and upload_manifest, for
+    // manifests too large to hold all of their entries in memory at once.
+    //
+    // The entries are handed to `consume` one at a time as they are parsed,
+    // an exception thrown by `consume` fails the download. Returns the number
+    // of entries consumed.
+    ss::future<checked<size_t, metadata_io::errc>> download_manifest_entries(
+      const manifest_path& path,
+      const partition_key_type& pk_type,
+      ss::noncopyable_function<void(manifest_entry)> consume);
+    ss::future<checked<size_t, metadata_io::errc>> download_manifest_entries(
+      const uri& uri,
+      const partition_key_type& pk_type,
+      ss::noncopyable_function<void(manifest_entry)> consume);
+    // Uploads the entries written to the writer. Unlike upload_manifest,
+    // the uploaded manifest isn't cached as that would require holding all of
+    // its entries.
+    ss::future<checked<size_t, metadata_io::errc>>
+    upload_manifest(const manifest_path& path, manifest_avro_writer);
+    ss::future<checked<size_t, metadata_io::errc>>
+    upload_manifest(const uri& uri, manifest_avro_writer);
+
+private:
+    template<typename T>
+    using cache_t = utils::chunked_kv_cache<std::string, T>;
+
+    std::unique_ptr<cache_t<manifest>> manifest_cache_;
+    std::unique_ptr<cache_t<manifest_list>> manifest_list_cache_;
 };
 
 } // namespace iceberg
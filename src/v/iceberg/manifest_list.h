@@ -80,6 +80,15 @@ struct manifest_file {
 
 struct manifest_list {
     chunked_vector<manifest_file> files;
+
+    manifest_list copy() const {
+        manifest_list ret;
+        ret.files.reserve(files.size());
+        for (const auto& f : files) {
+            ret.files.push_back(f.copy());
+        }
+        return ret;
+    }
     friend bool operator==(const manifest_list&, const manifest_list&)
       = default;
 };
@@ -12,6 +12,7 @@
 #include "base/vlog.h"
 #include "iceberg/logger.h"
 #include "iceberg/manifest.h"
+#include "iceberg/manifest_avro.h"
 #include "iceberg/manifest_file_packer.h"
 #include "iceberg/manifest_list.h"
 #include "iceberg/snapshot.h"
@@ -433,7 +434,6 @@ merge_append_action::merge_mfiles(
       to_merge.size(),
       added_entries.size());
     auto added_files = added_entries.size();
-    auto merged_entries = std::move(added_entries);
     size_t existing_rows = 0;
     size_t existing_files = 0;
     auto min_seq_num = ctx.seq_num;
@@ -441,41 +441,55 @@ merge_append_action::merge_mfiles(
                                  ? field_summary_val::empty_summaries(
                                      ctx.pk_type)
                                  : std::move(added_summaries);
+    // The merged manifest is serialized as the entries are downloaded, so
+    // only the entries of one of the manifests being merged are parsed at any
+    // given time.
+    manifest_avro_writer writer(manifest_metadata{
+      .schema = ctx.schema.copy(),
+      .partition_spec = ctx.pspec.copy(),
+      .format_version = format_version::v2,
+      .manifest_content_type = manifest_content_type::data,
+    });
+    for (const auto& e : added_entries) {
+        writer.write(e);
+    }
+    added_entries = {};
     for (const auto& mfile : to_merge) {
-        // Download the manifest file and collect the entries into the merged
-        // container.
-        auto mfile_res = co_await io_.download_manifest(
-          mfile.manifest_path, ctx.pk_type);
+        // Download the manifest file and write its entries into the merged
+        // manifest.
+        auto mfile_res = co_await io_.download_manifest_entries(
+          mfile.manifest_path, ctx.pk_type, [&](manifest_entry e) {
+              update_partition_summaries(e.data_file, partition_summaries);
+              existing_rows += e.data_file.record_count;
+              // Rewrite sequence numbers for previously added entries.
+              // These entries refer to files committed prior to this action.
+              if (e.status == manifest_entry_status::added) {
+                  e.status = manifest_entry_status::existing;
+                  e.sequence_number = e.sequence_number.value_or(
+                    mfile.seq_number);
+                  e.file_sequence_number = e.file_sequence_number.value_or(
+                    file_sequence_number{mfile.seq_number()});
+              }
+              if (e.sequence_number.has_value()) {
+                  min_seq_num = std::min(
+                    min_seq_num, e.sequence_number.value());
+              }
+              writer.write(e);
+          });
         if (mfile_res.has_error()) {
             co_return mfile_res.error();
         }
-        auto m = std::move(mfile_res).value();
-        existing_files += m.entries.size();
-        for (auto& e : m.entries) {
-            update_partition_summaries(e.data_file, partition_summaries);
-            existing_rows += e.data_file.record_count;
-            // Rewrite sequence numbers for previously added entries.
-            // These entries refer to files committed prior to this action.
-            if (e.status == manifest_entry_status::added) {
-                e.status = manifest_entry_status::existing;
-                e.sequence_number = e.sequence_number.value_or(
-                  mfile.seq_number);
-                e.file_sequence_number = e.file_sequence_number.value_or(
-                  file_sequence_number{mfile.seq_number()});
-            }
-            if (e.sequence_number.has_value()) {
-                min_seq_num = std::min(min_seq_num, e.sequence_number.value());
-            }
-        }
-        std::move(
-          m.entries.begin(),
-          m.entries.end(),
-          std::back_inserter(merged_entries));
+        existing_files += mfile_res.value();
     }
     const auto merged_manifest_path = get_manifest_path(
       table_.location, ctx.commit_uuid, generate_manifest_num());
-    const auto mfile_up_res = co_await upload_as_manifest(
-      merged_manifest_path, ctx.schema, ctx.pspec, std::move(merged_entries));
+    vlog(
+      log.info,
+      "Uploading merged manifest with {} entries to {}",
+      writer.num_entries(),
+      merged_manifest_path);
+    const auto mfile_up_res = co_await io_.upload_manifest(
+      merged_manifest_path, std::move(writer));
     if (mfile_up_res.has_error()) {
         co_return mfile_up_res.error();
     }
@@ -135,7 +135,13 @@ protected:
       const T& t,
       std::string_view display_str,
       ss::noncopyable_function<iobuf(const T&)> serialize) {
-        auto buf = serialize(t);
+        return upload_serialized(path, serialize(t), display_str);
+    }
+
+    ss::future<checked<size_t, errc>> upload_serialized(
+      const std::filesystem::path& path,
+      iobuf buf,
+      std::string_view display_str) {
         auto uploaded_size_bytes = buf.size_bytes();
         retry_chain_node retry(
           io_.as(),
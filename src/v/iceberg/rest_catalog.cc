@@ -81,6 +81,9 @@ rest_catalog::load_table(const table_identifier& t_id) {
     vlog(log.trace, "load table {} requested", t_id);
     auto rtc = create_rtc();
     auto h = co_await lock_.get_units();
+    if (auto committed = take_committed(t_id); committed.has_value()) {
+        co_return std::move(committed.value());
+    }
 
     co_return (co_await client_->load_table(t_id.ns, t_id.table, rtc))
       .transform(get_metadata)
@@ -143,6 +146,7 @@ rest_catalog::drop_table(const table_identifier& table_ident, bool purge) {
     auto rtc = create_rtc();
     vlog(log.trace, "drop table {} requested, purge: {}", table_ident, purge);
     auto h = co_await lock_.get_units();
+    committed_.erase(table_ident);
 
     auto res = co_await client_->drop_table(
       table_ident.ns, table_ident.table, purge, rtc);
@@ -174,11 +178,40 @@ rest_catalog::commit_txn(const table_identifier& t_id, transaction txn) {
         req.updates.push_back(copy(u));
     }
     auto h = co_await lock_.get_units();
-    co_return (co_await client_->commit_table_update(std::move(req), rtc))
-      .transform([](commit_table_response&&) { return std::nullopt; })
-      .transform_error([](const rest_client::domain_error& err) {
-          return map_error("commit_txn", err);
+    committed_.erase(t_id);
+    auto res = co_await client_->commit_table_update(std::move(req), rtc);
+    if (!res.has_value()) {
+        co_return map_error("commit_txn", res.error());
+    }
+    committed_.insert_or_assign(
+      t_id.copy(),
+      committed_metadata{
+        .metadata = std::move(res.value().table_metadata),
+        .metadata_location = std::move(res.value().metadata_location),
+        .committed_at = ss::lowres_clock::now(),
       });
+    co_return std::nullopt;
+}
+
+std::optional<table_metadata>
+rest_catalog::take_committed(const table_identifier& t_id) {
+    auto it = committed_.find(t_id);
+    if (it == committed_.end()) {
+        return std::nullopt;
+    }
+    auto entry = std::move(it->second);
+    committed_.erase(it);
+    if (
+      ss::lowres_clock::now() - entry.committed_at
+      > committed_metadata_max_age) {
+        return std::nullopt;
+    }
+    vlog(
+      log.trace,
+      "using metadata {} of the last commit to table {}",
+      entry.metadata_location,
+      t_id);
+    return std::move(entry.metadata);
 }
 
 retry_chain_node rest_catalog::create_rtc() {
@@ -10,9 +10,12 @@
 
 #pragma once
 
+#include "container/chunked_hash_map.h"
 #include "iceberg/catalog.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/lowres_clock.hh>
+
 namespace iceberg {
 namespace rest_client {
 class catalog_client;
@@ -51,12 +54,30 @@ public:
     ss::future<> stop();
 
 private:
+    /// Metadata returned by the catalog in response to a successful commit.
+    ///
+    /// The coordinator loads a table right before every commit to it, the
+    /// metadata of the previous commit saves that round trip. An entry is
+    /// handed out at most once and only if it is recent, a commit based on
+    /// metadata which turns out to be stale fails on the table requirements
+    /// and the next load goes to the catalog.
+    struct committed_metadata {
+        table_metadata metadata;
+        ss::sstring metadata_location;
+        ss::lowres_clock::time_point committed_at;
+    };
+    static constexpr auto committed_metadata_max_age = std::chrono::seconds(
+      30);
+
+    std::optional<table_metadata> take_committed(const table_identifier&);
+
     retry_chain_node create_rtc();
     std::unique_ptr<rest_client::catalog_client> client_;
     config::binding<std::chrono::milliseconds> request_timeout_;
     // currently we use very simple concurrency control i.e. we only allow one
     // REST request at a time
     mutex lock_;
+    chunked_hash_map<table_identifier, committed_metadata> committed_;
     ss::abort_source as_;
 };
 }; // namespace iceberg
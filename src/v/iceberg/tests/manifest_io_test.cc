@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "cloud_io/remote.h"
 #include "cloud_io/tests/scoped_remote.h"
 #include "cloud_io/transfer_details.h"
@@ -217,3 +218,38 @@ TEST_F(ManifestIOTest, TestCorruptedDownload) {
         ASSERT_EQ(dl_res.error(), metadata_io::errc::failed);
     }
 }
+
+TEST_F(ManifestIOTest, TestCachedMetadata) {
+    auto num_gets = [this] {
+        return get_requests([](const http_test_utils::request_info& r) {
+                   return r.method == "GET";
+               })
+          .size();
+    };
+    auto m = make_manifest();
+    auto mlist = make_manifest_list();
+    auto io = manifest_io(remote(), bucket_name, 10_MiB);
+    auto m_path = manifest_path{"foo/bar/manifest"};
+    auto mlist_path = manifest_list_path{"foo/bar/mlist"};
+    ASSERT_FALSE(io.upload_manifest(m_path, m).get().has_error());
+    ASSERT_FALSE(io.upload_manifest_list(mlist_path, mlist).get().has_error());
+
+    // What was just uploaded is served from memory.
+    const auto gets_before = num_gets();
+    for (int i = 0; i < 2; ++i) {
+        auto dl_res = io.download_manifest(m_path, empty_pk_type()).get();
+        ASSERT_FALSE(dl_res.has_error());
+        ASSERT_EQ(m, dl_res.value());
+        auto mlist_res = io.download_manifest_list(mlist_path).get();
+        ASSERT_FALSE(mlist_res.has_error());
+        ASSERT_EQ(mlist, mlist_res.value());
+    }
+    ASSERT_EQ(gets_before, num_gets());
+
+    // Without a cache every download goes to the object store.
+    auto uncached_io = manifest_io(remote(), bucket_name);
+    auto dl_res = uncached_io.download_manifest(m_path, empty_pk_type()).get();
+    ASSERT_FALSE(dl_res.has_error());
+    ASSERT_EQ(m, dl_res.value());
+    ASSERT_EQ(gets_before + 1, num_gets());
+}
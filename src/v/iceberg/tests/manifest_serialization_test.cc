@@ -347,3 +347,38 @@ TEST(ManifestSerializationTest, TestSerializeManifestData) {
         serialized_buf = serialize_avro(m_roundtrip);
     }
 }
+
+TEST(ManifestSerializationTest, TestStreamingManifestData) {
+    // File may not be on mount that supports O_DIRECT.
+    ss::engine().set_strict_dma(false);
+    auto manifest_path = test_utils::get_runfile_path(
+      "src/v/iceberg/tests/testdata/nested_manifest.avro");
+    if (!manifest_path.has_value()) {
+        manifest_path = "nested_manifest.avro";
+    }
+    auto orig_buf = iobuf{
+      ss::util::read_entire_file(manifest_path.value()).get()};
+    auto m = parse_manifest({struct_type{}}, orig_buf.copy());
+    ASSERT_EQ(100, m.entries.size());
+
+    // Entries come out of the reader one at a time, in order.
+    manifest_avro_reader reader({struct_type{}}, orig_buf.copy());
+    ASSERT_EQ(m.metadata, reader.metadata());
+    manifest_avro_writer writer(reader.metadata());
+    size_t num_read = 0;
+    while (auto e = reader.next()) {
+        ASSERT_LT(num_read, m.entries.size());
+        ASSERT_EQ(m.entries[num_read], *e);
+        writer.write(*e);
+        ++num_read;
+    }
+    ASSERT_EQ(100, num_read);
+    ASSERT_FALSE(reader.next().has_value());
+
+    // Writing the entries one at a time is equivalent to serializing the
+    // whole manifest.
+    ASSERT_EQ(100, writer.num_entries());
+    auto m_roundtrip = parse_manifest(
+      {struct_type{}}, std::move(writer).finish());
+    ASSERT_EQ(m, m_roundtrip);
+}
@@ -460,6 +460,65 @@ TEST_F(RestCatalogTest, CommitTxnHappyPath) {
     ASSERT_FALSE(result.has_error());
 }
 
+TEST_F(RestCatalogTest, LoadAfterCommitUsesCommittedMetadata) {
+    auto client = make_catalog_client({[](client_mock& m) {
+        setup_token_request_expectations(m);
+
+        EXPECT_CALL(
+          m,
+          request_and_collect_response(
+            AllOf(
+              Property(
+                &boost::beast::http::request_header<>::target,
+                EndsWith("/tables/panda_table")),
+              Property(
+                &boost::beast::http::request_header<>::method,
+                Eq(boost::beast::http::verb::post))),
+            _,
+            _))
+          .WillOnce(handle_commit_table_txn);
+        // only the second load goes to the catalog
+        EXPECT_CALL(
+          m,
+          request_and_collect_response(
+            AllOf(
+              Property(
+                &boost::beast::http::request_header<>::target,
+                EndsWith("/tables/panda_table")),
+              Property(
+                &boost::beast::http::request_header<>::method,
+                Eq(boost::beast::http::verb::get))),
+            _,
+            _))
+          .WillOnce(handle_load_table);
+    }});
+
+    iceberg::rest_catalog catalog(
+      std::move(client), config::mock_binding<std::chrono::milliseconds>(10s));
+    const iceberg::table_identifier t_id{
+      .ns = {"foo", "bar", "baz"}, .table = "panda_table"};
+
+    chunked_vector<iceberg::data_file> files;
+    auto partition_key_val = std::make_unique<iceberg::struct_value>();
+    partition_key_val->fields.push_back(iceberg::int_value{0});
+    files.push_back(iceberg::data_file{
+      .content_type = iceberg::data_file_content_type::data,
+      .file_format = iceberg::data_file_format::parquet,
+      .partition = iceberg::partition_key{.val = std::move(partition_key_val)},
+    });
+    iceberg::transaction txn(create_empty_table_metadata(bucket_name));
+    ASSERT_FALSE(txn.merge_append(io, std::move(files)).get().has_error());
+    ASSERT_FALSE(catalog.commit_txn(t_id, std::move(txn)).get().has_error());
+
+    auto committed = catalog.load_table(t_id).get();
+    ASSERT_TRUE(committed.has_value());
+    ASSERT_EQ(committed.value().location, iceberg::uri("some-location"));
+
+    auto loaded = catalog.load_table(t_id).get();
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded.value(), create_table_metadata());
+}
+
 ss::future<http::downloaded_response> handle_load_table_check_concurrency(
   boost::beast::http::request_header<>&& r,
   std::optional<iobuf>,
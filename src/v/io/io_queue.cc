@@ -18,6 +18,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/sleep.hh>
 
+#include <algorithm>
+
 namespace experimental::io {
 
 io_queue::io_queue(
@@ -140,16 +142,13 @@ seastar::future<> io_queue::dispatch() noexcept {
         }
 
         auto& page = pending_.front();
-        pending_.pop_front();
-        assert(page.test_flag(page::flags::queued));
-        page.clear_flag(page::flags::queued);
-        running_.push_back(page);
+        auto pages = take_coalesced(page);
 
         if (page.test_flag(page::flags::read)) {
-            dispatch_read(page, std::move(units));
+            dispatch_read(std::move(pages), std::move(units));
 
         } else if (page.test_flag(page::flags::write)) {
-            dispatch_write(page, std::move(units));
+            dispatch_write(std::move(pages), std::move(units));
 
         } else {
             vassert(false, "Expected a read or write flag");
@@ -157,29 +156,110 @@ seastar::future<> io_queue::dispatch() noexcept {
     }
 }
 
+std::vector<page*> io_queue::take_coalesced(page& first) noexcept {
+    const auto is_read = [](const page& p) {
+        return p.test_flag(page::flags::read);
+    };
+    const bool read = is_read(first);
+
+    std::vector<page*> pages;
+    auto take = [this, &pages](page& p) {
+        pending_.erase(request_list_type::s_iterator_to(p));
+        assert(p.test_flag(page::flags::queued));
+        p.clear_flag(page::flags::queued);
+        running_.push_back(p);
+        pages.push_back(&p);
+    };
+    take(first);
+
+    /*
+     * pending requests are unordered, so look for the page starting where the
+     * coalesced range ends. the pending list is expected to be short.
+     */
+    auto end = first.offset() + first.data().size();
+    auto size = first.data().size();
+    while (size < max_coalesced_bytes) {
+        auto it = std::find_if(
+          pending_.begin(), pending_.end(), [&](const page& p) {
+              return p.offset() == end && is_read(p) == read
+                     && size + p.data().size() <= max_coalesced_bytes;
+          });
+        if (it == pending_.end()) {
+            break;
+        }
+        end += it->data().size();
+        size += it->data().size();
+        take(*it);
+    }
+    return pages;
+}
+
+namespace {
+size_t total_size(const std::vector<page*>& pages) {
+    size_t size = 0;
+    for (const auto* p : pages) {
+        size += p->data().size();
+    }
+    return size;
+}
+} // namespace
+
 void io_queue::dispatch_read(
-  page& page, seastar::semaphore_units<> units) noexcept {
+  std::vector<page*> pages, seastar::semaphore_units<> units) noexcept {
+    const auto offset = pages.front()->offset();
+    const auto size = total_size(pages);
     vlog(
       log.debug,
-      "Reading {} at {}~{}",
+      "Reading {} at {}~{} ({} pages)",
       path_,
-      page.offset(),
-      page.data().size());
+      offset,
+      size,
+      pages.size());
+
+    /*
+     * a coalesced read lands in a bounce buffer which is then copied into the
+     * pages. a single page is read in place.
+     */
+    seastar::temporary_buffer<char> buf;
+    if (pages.size() > 1) {
+        buf = storage_->allocate(file_->memory_dma_alignment(), size);
+    }
 
     ssx::background = seastar::with_gate(
-      gate_, [this, &page, units = std::move(units)]() mutable {
-          return file_
-            ->dma_read(
-              page.offset(), page.data().get_write(), page.data().size())
-            .then([this, &page, units = std::move(units)](auto) mutable {
-                /*
-                 * unlike writes, reads are not requeued. the caller should
-                 * handle read/write coherency.
-                 */
-                running_.erase(request_list_type::s_iterator_to(page));
+      gate_,
+      [this,
+       offset,
+       size,
+       pages = std::move(pages),
+       buf = std::move(buf),
+       units = std::move(units)]() mutable {
+          char* dst = buf.empty() ? pages.front()->data().get_write()
+                                  : buf.get_write();
+          return file_->dma_read(offset, dst, size)
+            .then([this,
+                   pages = std::move(pages),
+                   buf = std::move(buf),
+                   units = std::move(units)](auto) mutable {
+                size_t pos = 0;
+                for (auto* page : pages) {
+                    if (!buf.empty()) {
+                        std::copy_n(
+                          buf.get() + pos,
+                          page->data().size(),
+                          page->data().get_write());
+                        pos += page->data().size();
+                    }
+                    /*
+                     * unlike writes, reads are not requeued. the caller should
+                     * handle read/write coherency.
+                     */
+                    running_.erase(request_list_type::s_iterator_to(*page));
+                }
                 if (complete_) {
                     units.return_all();
-                    complete_(page);
+                    for (auto* page : pages) {
+                        complete_(*page);
+                    }
                 }
             })
             .handle_exception([this](std::exception_ptr eptr) {
@@ -189,20 +269,50 @@ void io_queue::dispatch_read(
 }
 
 void io_queue::dispatch_write(
-  page& page, seastar::semaphore_units<> units) noexcept {
+  std::vector<page*> pages, seastar::semaphore_units<> units) noexcept {
+    const auto offset = pages.front()->offset();
+    const auto size = total_size(pages);
     vlog(
       log.debug,
-      "Writing {} at {}~{}",
+      "Writing {} at {}~{} ({} pages)",
       path_,
-      page.offset(),
-      page.data().size());
+      offset,
+      size,
+      pages.size());
+
+    /*
+     * a coalesced write is staged in a bounce buffer. a page modified after
+     * being copied here is marked queued by submit_write and written again.
+     */
+    seastar::temporary_buffer<char> buf;
+    if (pages.size() > 1) {
+        buf = storage_->allocate(file_->memory_dma_alignment(), size);
+        size_t pos = 0;
+        for (const auto* page : pages) {
+            std::copy_n(
+              page->data().get(), page->data().size(), buf.get_write() + pos);
+            pos += page->data().size();
+        }
+    }
 
     ssx::background = seastar::with_gate(
-      gate_, [this, &page, units = std::move(units)]() mutable {
-          return file_
-            ->dma_write(page.offset(), page.data().get(), page.data().size())
-            .then([this, &page, units = std::move(units)](auto) mutable {
-                running_.erase(request_list_type::s_iterator_to(page));
+      gate_,
+      [this,
+       offset,
+       size,
+       pages = std::move(pages),
+       buf = std::move(buf),
+       units = std::move(units)]() mutable {
+          const char* src = buf.empty() ? pages.front()->data().get()
+                                        : buf.get();
+          return file_->dma_write(offset, src, size)
+            .then([this,
+                   pages = std::move(pages),
+                   buf = std::move(buf),
+                   units = std::move(units)](auto) mutable {
+                for (auto* page : pages) {
+                    running_.erase(request_list_type::s_iterator_to(*page));
+                }
                 units.return_all();
                 /*
                  * the queued flag is cleared before dispatch_write is invoked,
@@ -213,11 +323,13 @@ void io_queue::dispatch_write(
                  * completion callback is invoked only after the write completes
                  * without being requeued.
                  */
-                if (page.test_flag(page::flags::queued)) {
-                    pending_.push_back(page);
-                    cond_.signal();
-                } else if (complete_) {
-                    complete_(page);
+                for (auto* page : pages) {
+                    if (page->test_flag(page::flags::queued)) {
+                        pending_.push_back(*page);
+                        cond_.signal();
+                    } else if (complete_) {
+                        complete_(*page);
+                    }
                 }
             })
             .handle_exception([this](std::exception_ptr eptr) {
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include "base/units.h"
 #include "io/page.h"
 #include "io/persistence.h"
 
@@ -17,6 +18,8 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/semaphore.hh>
 
+#include <vector>
+
 namespace experimental::io {
 
 namespace testing_details {
@@ -31,6 +34,8 @@ class io_queue_accessor;
  * either `submit_read` or `submit_write`.
  *
  * There is no guarantee of the order in which I/O requests are processed.
+ * Pending requests of the same type for adjacent pages are coalesced into a
+ * single I/O of up to `max_coalesced_bytes`.
  *
  * Submission of I/O requests can be made at any time, but pending I/O requests
  * are processed only when the queue is in the open state. A new I/O queue is in
@@ -42,6 +47,11 @@ class io_queue_accessor;
  */
 class io_queue {
 public:
+    /**
+     * Maximum size of an I/O built from adjacent page requests.
+     */
+    static constexpr size_t max_coalesced_bytes = 128_KiB;
+
     /**
      * Callback invoked when the scheduler completes an operation.
      *
@@ -161,8 +171,15 @@ private:
     seastar::gate gate_;
     seastar::future<> dispatcher_{seastar::make_ready_future<>()};
     seastar::future<> dispatch() noexcept;
-    void dispatch_read(page&, seastar::semaphore_units<>) noexcept;
-    void dispatch_write(page&, seastar::semaphore_units<>) noexcept;
+
+    /*
+     * moves the given page and pending pages of the same type that extend it
+     * contiguously to the running list.
+     */
+    std::vector<page*> take_coalesced(page&) noexcept;
+    void dispatch_read(std::vector<page*>, seastar::semaphore_units<>) noexcept;
+    void
+    dispatch_write(std::vector<page*>, seastar::semaphore_units<>) noexcept;
 };
 
 } // namespace experimental::io
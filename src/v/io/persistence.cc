@@ -79,6 +79,13 @@ void persistence::file::fail_next_close(std::exception_ptr eptr) noexcept {
     close_ex_ = std::move(eptr);
 }
 
+seastar::future<size_t> persistence::file::dma_write_and_flush(
+  uint64_t offset, const char* buf, size_t size) noexcept {
+    return dma_write(offset, buf, size).then([this](size_t written) {
+        return flush().then([written] { return written; });
+    });
+}
+
 seastar::future<> persistence::file::maybe_fail_read() {
     if (read_ex_) [[unlikely]] {
         return seastar::make_exception_future(std::exchange(read_ex_, {}));
@@ -137,6 +144,10 @@ seastar::future<size_t> disk_persistence::disk_file::dma_write(
       [this, pos, buf, len] { return file_.dma_write(pos, buf, len); });
 }
 
+seastar::future<> disk_persistence::disk_file::flush() noexcept {
+    return file_.flush();
+}
+
 seastar::future<> disk_persistence::disk_file::close() noexcept {
     return maybe_fail_close().then([this] { return file_.close(); });
 }
@@ -288,6 +299,10 @@ seastar::future<size_t> memory_persistence::memory_file::dma_write(
     });
 }
 
+seastar::future<> memory_persistence::memory_file::flush() noexcept {
+    return seastar::make_ready_future<>();
+}
+
 seastar::future<> memory_persistence::memory_file::close() noexcept {
     return maybe_fail_close();
 }
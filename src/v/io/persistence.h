@@ -66,6 +66,20 @@ public:
         virtual seastar::future<size_t>
         dma_write(uint64_t offset, const char* buf, size_t size) noexcept = 0;
 
+        /**
+         * Flush written data to stable storage.
+         */
+        virtual seastar::future<> flush() noexcept = 0;
+
+        /**
+         * Write \p size bytes from \p buf to \p offset and flush the file
+         * once the write completes. Backends may submit both operations
+         * together, the default implementation issues them one after the
+         * other.
+         */
+        virtual seastar::future<size_t> dma_write_and_flush(
+          uint64_t offset, const char* buf, size_t size) noexcept;
+
         /**
          * Close the file.
          */
@@ -227,6 +241,8 @@ public:
         seastar::future<size_t>
         dma_write(uint64_t pos, const char* buf, size_t len) noexcept override;
 
+        seastar::future<> flush() noexcept override;
+
         seastar::future<> close() noexcept override;
 
         [[nodiscard]] uint64_t
@@ -305,6 +321,8 @@ public:
         seastar::future<size_t>
         dma_write(uint64_t pos, const char* buf, size_t len) noexcept override;
 
+        seastar::future<> flush() noexcept override;
+
         seastar::future<> close() noexcept override;
 
         [[nodiscard]] uint64_t
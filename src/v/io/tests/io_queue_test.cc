@@ -13,6 +13,7 @@
 #include "io/tests/common.h"
 #include "random/generators.h"
 
+#include <seastar/core/later.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/thread.hh>
 
@@ -129,3 +130,64 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Bool(),                 // disk backend?
     ::testing::Values(16_KiB, 10_MiB), // backing file size
     ::testing::Values(10, 3000)));     // number of io operations
+
+class IOQueueCoalesceTest
+  : public StorageTest
+  , public ::testing::WithParamInterface<bool> {
+private:
+    [[nodiscard]] bool disk_persistence() const override { return GetParam(); }
+};
+
+/*
+ * requests submitted while the queue is closed are dispatched together once
+ * it opens, which coalesces adjacent pages.
+ */
+TEST_P(IOQueueCoalesceTest, AdjacentPages) {
+    constexpr size_t num_pages = 40;
+    std::vector<io::page*> completed;
+    io::io_queue queue(storage(), "foo", [&](io::page& page) noexcept {
+        completed.push_back(&page);
+    });
+    storage()->create(queue.path()).get();
+    queue.start();
+
+    std::vector<seastar::lw_shared_ptr<io::page>> writes;
+    for (size_t i = 0; i < num_pages; ++i) {
+        // every fourth page is left out to split the coalesced ranges
+        if (i % 4 == 3) {
+            continue;
+        }
+        writes.push_back(make_page(i * 4096, i));
+        queue.submit_write(*writes.back());
+    }
+    queue.open().get();
+    while (completed.size() < writes.size()) {
+        seastar::yield().get();
+    }
+
+    completed.clear();
+    std::vector<seastar::lw_shared_ptr<io::page>> reads;
+    for (const auto& write : writes) {
+        reads.push_back(seastar::make_lw_shared<io::page>(
+          write->offset(), make_random_data(4096, 4096).get()));
+        queue.submit_read(*reads.back());
+    }
+    while (completed.size() < reads.size()) {
+        seastar::yield().get();
+    }
+
+    for (size_t i = 0; i < writes.size(); ++i) {
+        EXPECT_EQ(reads[i]->data(), writes[i]->data());
+    }
+
+    queue.close().get();
+    queue.stop().get();
+    try {
+        seastar::remove_file(queue.path().string()).get();
+    } catch (const std::exception& ex) {
+        std::ignore = ex;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  IOQueueCoalesce, IOQueueCoalesceTest, ::testing::Bool());
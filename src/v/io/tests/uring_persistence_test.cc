@@ -0,0 +1,143 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "base/units.h"
+#include "io/tests/common.h"
+#include "io/uring_persistence.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/when_all.hh>
+#include <seastar/util/tmp_file.hh>
+
+#include <cstring>
+
+namespace io = experimental::io;
+
+class UringPersistenceTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        if (!io::uring_persistence::is_supported()) {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        fs = std::make_unique<io::uring_persistence>();
+        dir = seastar::make_tmp_dir(".").get();
+    }
+
+    void TearDown() override {
+        if (!fs) {
+            return;
+        }
+        for (auto& file : open_files) {
+            file->close().get();
+        }
+        open_files.clear();
+        fs->stop().get();
+        fs.reset();
+        dir.remove().get();
+    }
+
+    std::filesystem::path make_filename() {
+        return dir.get_path() / fmt::format("file.{}", count++);
+    }
+
+    auto create() {
+        auto f = fs->create(make_filename()).get();
+        open_files.push_back(f);
+        return f;
+    }
+
+    seastar::temporary_buffer<char> make_buffer(size_t size, char c) {
+        auto buf = fs->allocate(4_KiB, size);
+        std::memset(buf.get_write(), c, buf.size());
+        return buf;
+    }
+
+    std::unique_ptr<io::uring_persistence> fs;
+    seastar::tmp_dir dir;
+    int count{0};
+    std::vector<seastar::shared_ptr<io::persistence::file>> open_files;
+};
+
+TEST_F(UringPersistenceTest, ReadWrite) {
+    auto f = create();
+    auto wbuf = make_buffer(16_KiB, 'x');
+    EXPECT_EQ(f->dma_write(4_KiB, wbuf.get(), wbuf.size()).get(), 16_KiB);
+
+    auto rbuf = fs->allocate(4_KiB, 16_KiB);
+    EXPECT_EQ(f->dma_read(4_KiB, rbuf.get_write(), rbuf.size()).get(), 16_KiB);
+    EXPECT_EQ(rbuf, wbuf);
+
+    // both buffers came from the registered arena
+    EXPECT_EQ(fs->get_stats().fixed_buffer_ops, 2);
+}
+
+TEST_F(UringPersistenceTest, UnregisteredBuffer) {
+    auto f = create();
+    auto wbuf = seastar::temporary_buffer<char>::aligned(4_KiB, 4_KiB);
+    std::memset(wbuf.get_write(), 'y', wbuf.size());
+    EXPECT_EQ(f->dma_write(0, wbuf.get(), wbuf.size()).get(), 4_KiB);
+
+    auto rbuf = seastar::temporary_buffer<char>::aligned(4_KiB, 4_KiB);
+    EXPECT_EQ(f->dma_read(0, rbuf.get_write(), rbuf.size()).get(), 4_KiB);
+    EXPECT_EQ(rbuf, wbuf);
+    EXPECT_EQ(fs->get_stats().fixed_buffer_ops, 0);
+}
+
+TEST_F(UringPersistenceTest, WriteAndFlush) {
+    auto f = create();
+    auto wbuf = make_buffer(8_KiB, 'z');
+    EXPECT_EQ(f->dma_write_and_flush(0, wbuf.get(), wbuf.size()).get(), 8_KiB);
+    f->flush().get();
+
+    auto rbuf = fs->allocate(4_KiB, 8_KiB);
+    EXPECT_EQ(f->dma_read(0, rbuf.get_write(), rbuf.size()).get(), 8_KiB);
+    EXPECT_EQ(rbuf, wbuf);
+}
+
+TEST_F(UringPersistenceTest, SubmissionsAreBatched) {
+    constexpr auto num_files = 8;
+    constexpr auto writes_per_file = 4;
+
+    std::vector<seastar::shared_ptr<io::persistence::file>> files;
+    for (int i = 0; i < num_files; ++i) {
+        files.push_back(create());
+    }
+
+    const auto before = fs->get_stats();
+    std::vector<seastar::temporary_buffer<char>> bufs;
+    std::vector<seastar::future<size_t>> writes;
+    for (auto& f : files) {
+        for (int i = 0; i < writes_per_file; ++i) {
+            bufs.push_back(make_buffer(4_KiB, static_cast<char>('a' + i)));
+            writes.push_back(
+              f->dma_write(i * 4_KiB, bufs.back().get(), bufs.back().size()));
+        }
+    }
+    for (auto& size : seastar::when_all_succeed(writes.begin(), writes.end())
+                        .get()) {
+        EXPECT_EQ(size, 4_KiB);
+    }
+
+    const auto& after = fs->get_stats();
+    const auto entries = after.submitted_entries - before.submitted_entries;
+    EXPECT_EQ(entries, num_files * writes_per_file);
+    EXPECT_LT(after.submit_calls - before.submit_calls, entries);
+}
+
+TEST_F(UringPersistenceTest, CreateAlreadyExists) {
+    auto path = make_filename();
+    open_files.push_back(fs->create(path).get());
+    EXPECT_THROW(fs->create(path).get(), std::filesystem::filesystem_error);
+}
+
+TEST_F(UringPersistenceTest, OpenDoesNotExist) {
+    EXPECT_THROW(
+      fs->open(make_filename()).get(), std::filesystem::filesystem_error);
+}
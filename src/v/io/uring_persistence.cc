@@ -0,0 +1,413 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/uring_persistence.h"
+
+#include "io/logger.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/posix.hh>
+#include <seastar/util/later.hh>
+
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+
+#include <cassert>
+#include <fcntl.h>
+#include <system_error>
+
+namespace {
+std::system_error make_uring_error(int res, std::string_view op) {
+    return {
+      std::error_code(-res, std::system_category()),
+      fmt::format("io_uring {}", op)};
+}
+} // namespace
+
+namespace experimental::io {
+
+uring_persistence::uring_persistence()
+  : uring_persistence(config{}) {}
+
+uring_persistence::uring_persistence(config config)
+  : config_(config)
+  , eventfd_(seastar::file_desc::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    assert(config_.registered_buffer_size % dma_alignment == 0);
+
+    if (auto ret = io_uring_queue_init(config_.queue_depth, &ring_, 0);
+        ret < 0) {
+        throw make_uring_error(ret, "queue_init");
+    }
+
+    if (auto ret = io_uring_register_eventfd(
+          &ring_, eventfd_.get_file_desc().get());
+        ret < 0) {
+        io_uring_queue_exit(&ring_);
+        throw make_uring_error(ret, "register_eventfd");
+    }
+
+    // Registered files and buffers are optimizations, the backend falls back
+    // to regular file descriptors and buffers if they can't be registered.
+    if (auto ret = io_uring_register_files_sparse(&ring_, config_.max_files);
+        ret < 0) {
+        log.info(
+          "Unable to register io_uring file table: {}",
+          std::system_category().message(-ret));
+    } else {
+        free_slots_.reserve(config_.max_files);
+        for (auto slot = config_.max_files; slot > 0; --slot) {
+            free_slots_.push_back(slot - 1);
+        }
+    }
+
+    if (config_.registered_buffers > 0) {
+        buffers_ = seastar::allocate_aligned_buffer<char>(
+          config_.registered_buffers * config_.registered_buffer_size,
+          dma_alignment);
+        std::vector<iovec> iovecs;
+        iovecs.reserve(config_.registered_buffers);
+        for (size_t i = 0; i < config_.registered_buffers; ++i) {
+            iovecs.push_back(
+              {buffers_.get() + (i * config_.registered_buffer_size),
+               config_.registered_buffer_size});
+        }
+        if (auto ret = io_uring_register_buffers(
+              &ring_, iovecs.data(), iovecs.size());
+            ret < 0) {
+            log.info(
+              "Unable to register io_uring buffers: {}",
+              std::system_category().message(-ret));
+            buffers_.reset();
+        } else {
+            free_buffers_.reserve(config_.registered_buffers);
+            for (auto i = config_.registered_buffers; i > 0; --i) {
+                free_buffers_.push_back(i - 1);
+            }
+        }
+    }
+
+    reaper_ = reap_loop();
+}
+
+uring_persistence::~uring_persistence() {
+    assert(stopping_ && inflight_ == 0);
+    assert(
+      !buffers_ || free_buffers_.size() == config_.registered_buffers);
+    io_uring_queue_exit(&ring_);
+}
+
+bool uring_persistence::is_supported() noexcept {
+    io_uring ring{};
+    if (io_uring_queue_init(1, &ring, 0) < 0) {
+        return false;
+    }
+    io_uring_queue_exit(&ring);
+    return true;
+}
+
+seastar::future<> uring_persistence::stop() {
+    co_await gate_.close();
+    stopping_ = true;
+    // wake up the reaper, which exits once there is nothing in flight
+    uint64_t one = 1;
+    eventfd_.get_file_desc().write(&one, sizeof(one));
+    co_await std::exchange(reaper_, seastar::make_ready_future<>());
+}
+
+io_uring_sqe* uring_persistence::get_sqe(unsigned needed) {
+    if (io_uring_sq_space_left(&ring_) < needed) {
+        submit_now();
+    }
+    auto* sqe = io_uring_get_sqe(&ring_);
+    if (sqe == nullptr) [[unlikely]] {
+        throw make_uring_error(-EBUSY, "get_sqe");
+    }
+    return sqe;
+}
+
+seastar::future<int>
+uring_persistence::enqueue(io_uring_sqe* sqe, request& req) {
+    io_uring_sqe_set_data(sqe, &req);
+    ++inflight_;
+    schedule_submit();
+    return req.done.get_future();
+}
+
+void uring_persistence::schedule_submit() {
+    if (submit_scheduled_) {
+        return;
+    }
+    submit_scheduled_ = true;
+    // entries queued by tasks that run before this one are submitted together
+    ssx::spawn_with_gate(gate_, [this] {
+        return seastar::yield().then([this] {
+            submit_scheduled_ = false;
+            submit_now();
+        });
+    });
+}
+
+void uring_persistence::submit_now() {
+    const auto queued = io_uring_sq_ready(&ring_);
+    if (queued == 0) {
+        return;
+    }
+    auto ret = io_uring_submit(&ring_);
+    ++stats_.submit_calls;
+    if (ret < 0) [[unlikely]] {
+        // entries stay in the submission queue and are retried with the
+        // next submission
+        log.warn(
+          "io_uring submission of {} entries failed: {}",
+          queued,
+          std::system_category().message(-ret));
+        return;
+    }
+    stats_.submitted_entries += ret;
+}
+
+seastar::future<> uring_persistence::reap_loop() {
+    while (true) {
+        co_await eventfd_.readable();
+        uint64_t count = 0;
+        // the counter only signals, completions are found in the ring
+        std::ignore = eventfd_.get_file_desc().read(&count, sizeof(count));
+        reap();
+        if (stopping_ && inflight_ == 0) {
+            co_return;
+        }
+    }
+}
+
+void uring_persistence::reap() {
+    io_uring_cqe* cqe = nullptr;
+    unsigned head = 0;
+    unsigned seen = 0;
+    io_uring_for_each_cqe(&ring_, head, cqe) {
+        auto* req = static_cast<request*>(io_uring_cqe_get_data(cqe));
+        req->done.set_value(cqe->res);
+        ++seen;
+    }
+    io_uring_cq_advance(&ring_, seen);
+    inflight_ -= seen;
+}
+
+std::optional<unsigned>
+uring_persistence::buffer_index(const char* buf, size_t len) const {
+    if (!buffers_) {
+        return std::nullopt;
+    }
+    const auto* base = buffers_.get();
+    const auto total = config_.registered_buffers
+                       * config_.registered_buffer_size;
+    if (buf < base || buf >= base + total) {
+        return std::nullopt;
+    }
+    const auto index = static_cast<size_t>(buf - base)
+                       / config_.registered_buffer_size;
+    const auto* end = base + ((index + 1) * config_.registered_buffer_size);
+    if (len > static_cast<size_t>(end - buf)) {
+        return std::nullopt;
+    }
+    return index;
+}
+
+seastar::temporary_buffer<char>
+uring_persistence::allocate(uint64_t alignment, size_t size) noexcept {
+    if (
+      !free_buffers_.empty() && size <= config_.registered_buffer_size
+      && dma_alignment % alignment == 0) {
+        auto index = free_buffers_.back();
+        free_buffers_.pop_back();
+        auto* buf = buffers_.get() + (index * config_.registered_buffer_size);
+        return {buf, size, seastar::make_deleter([this, index] {
+                    free_buffers_.push_back(index);
+                })};
+    }
+    return seastar::temporary_buffer<char>::aligned(alignment, size);
+}
+
+seastar::future<seastar::shared_ptr<persistence::file>>
+uring_persistence::create(std::filesystem::path path) noexcept {
+    co_await maybe_fail_create();
+    co_return co_await do_open(std::move(path), O_CREAT | O_EXCL | O_RDWR);
+}
+
+seastar::future<seastar::shared_ptr<persistence::file>>
+uring_persistence::open(std::filesystem::path path) noexcept {
+    co_await maybe_fail_open();
+    co_return co_await do_open(std::move(path), O_RDWR);
+}
+
+seastar::future<seastar::shared_ptr<persistence::file>>
+uring_persistence::do_open(std::filesystem::path path, int flags) {
+    auto holder = gate_.hold();
+    request req;
+    // NOLINTNEXTLINE(hicpp-signed-bitwise)
+    flags |= O_DIRECT | O_CLOEXEC;
+    auto* sqe = get_sqe();
+    io_uring_prep_openat(sqe, AT_FDCWD, path.c_str(), flags, 0644);
+    int fd = co_await enqueue(sqe, req);
+    if (fd < 0) {
+        throw std::filesystem::filesystem_error(
+          "io_uring open",
+          path,
+          std::error_code(-fd, std::system_category()));
+    }
+
+    std::optional<unsigned> slot;
+    if (!free_slots_.empty()) {
+        const auto candidate = free_slots_.back();
+        if (io_uring_register_files_update(&ring_, candidate, &fd, 1) == 1) {
+            free_slots_.pop_back();
+            slot = candidate;
+        }
+    }
+    co_return seastar::make_shared<uring_file>(this, fd, slot);
+}
+
+seastar::future<>
+uring_persistence::do_close(int fd, std::optional<unsigned> slot) {
+    auto holder = gate_.hold();
+    if (slot.has_value()) {
+        int unregister = -1;
+        io_uring_register_files_update(&ring_, *slot, &unregister, 1);
+        free_slots_.push_back(*slot);
+    }
+    request req;
+    auto* sqe = get_sqe();
+    io_uring_prep_close(sqe, fd);
+    if (auto res = co_await enqueue(sqe, req); res < 0) {
+        throw make_uring_error(res, "close");
+    }
+}
+
+uring_persistence::uring_file::uring_file(
+  uring_persistence* persistence, int fd, std::optional<unsigned> slot)
+  : persistence_(persistence)
+  , fd_(fd)
+  , slot_(slot) {}
+
+void uring_persistence::uring_file::set_file(io_uring_sqe* sqe) const {
+    if (slot_.has_value()) {
+        sqe->fd = static_cast<int>(*slot_);
+        io_uring_sqe_set_flags(sqe, sqe->flags | IOSQE_FIXED_FILE);
+        ++persistence_->stats_.fixed_file_ops;
+    }
+}
+
+seastar::future<size_t> uring_persistence::uring_file::dma_read(
+  uint64_t pos, char* buf, size_t len) noexcept {
+    co_await maybe_fail_read();
+    auto holder = persistence_->gate_.hold();
+    request req;
+    auto* sqe = persistence_->get_sqe();
+    if (auto index = persistence_->buffer_index(buf, len); index.has_value()) {
+        io_uring_prep_read_fixed(sqe, fd_, buf, len, pos, *index);
+        ++persistence_->stats_.fixed_buffer_ops;
+    } else {
+        io_uring_prep_read(sqe, fd_, buf, len, pos);
+    }
+    set_file(sqe);
+    auto res = co_await persistence_->enqueue(sqe, req);
+    if (res < 0) {
+        throw make_uring_error(res, "read");
+    }
+    co_return res;
+}
+
+seastar::future<size_t> uring_persistence::uring_file::dma_write(
+  uint64_t pos, const char* buf, size_t len) noexcept {
+    co_await maybe_fail_write();
+    auto holder = persistence_->gate_.hold();
+    request req;
+    auto* sqe = persistence_->get_sqe();
+    if (auto index = persistence_->buffer_index(buf, len); index.has_value()) {
+        io_uring_prep_write_fixed(sqe, fd_, buf, len, pos, *index);
+        ++persistence_->stats_.fixed_buffer_ops;
+    } else {
+        io_uring_prep_write(sqe, fd_, buf, len, pos);
+    }
+    set_file(sqe);
+    auto res = co_await persistence_->enqueue(sqe, req);
+    if (res < 0) {
+        throw make_uring_error(res, "write");
+    }
+    co_return res;
+}
+
+seastar::future<> uring_persistence::uring_file::flush() noexcept {
+    auto holder = persistence_->gate_.hold();
+    request req;
+    auto* sqe = persistence_->get_sqe();
+    io_uring_prep_fsync(sqe, fd_, IORING_FSYNC_DATASYNC);
+    set_file(sqe);
+    if (auto res = co_await persistence_->enqueue(sqe, req); res < 0) {
+        throw make_uring_error(res, "fdatasync");
+    }
+}
+
+seastar::future<size_t> uring_persistence::uring_file::dma_write_and_flush(
+  uint64_t pos, const char* buf, size_t len) noexcept {
+    co_await maybe_fail_write();
+    auto holder = persistence_->gate_.hold();
+    request write_req;
+    request sync_req;
+
+    // both entries must be submitted together for the link to hold
+    auto* write_sqe = persistence_->get_sqe(2);
+    if (auto index = persistence_->buffer_index(buf, len); index.has_value()) {
+        io_uring_prep_write_fixed(write_sqe, fd_, buf, len, pos, *index);
+        ++persistence_->stats_.fixed_buffer_ops;
+    } else {
+        io_uring_prep_write(write_sqe, fd_, buf, len, pos);
+    }
+    set_file(write_sqe);
+    io_uring_sqe_set_flags(write_sqe, write_sqe->flags | IOSQE_IO_LINK);
+    auto write_fut = persistence_->enqueue(write_sqe, write_req);
+
+    auto* sync_sqe = persistence_->get_sqe();
+    io_uring_prep_fsync(sync_sqe, fd_, IORING_FSYNC_DATASYNC);
+    set_file(sync_sqe);
+    auto sync_fut = persistence_->enqueue(sync_sqe, sync_req);
+
+    // the kernel cancels the sync if the write fails or is short
+    auto written = co_await std::move(write_fut);
+    auto synced = co_await std::move(sync_fut);
+    if (written < 0) {
+        throw make_uring_error(written, "write");
+    }
+    if (synced < 0 && synced != -ECANCELED) {
+        throw make_uring_error(synced, "fdatasync");
+    }
+    co_return written;
+}
+
+seastar::future<> uring_persistence::uring_file::close() noexcept {
+    co_await maybe_fail_close();
+    co_await persistence_->do_close(fd_, std::exchange(slot_, std::nullopt));
+}
+
+uint64_t
+uring_persistence::uring_file::disk_read_dma_alignment() const noexcept {
+    return dma_alignment;
+}
+
+uint64_t
+uring_persistence::uring_file::disk_write_dma_alignment() const noexcept {
+    return dma_alignment;
+}
+
+uint64_t uring_persistence::uring_file::memory_dma_alignment() const noexcept {
+    return dma_alignment;
+}
+
+} // namespace experimental::io
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "io/persistence.h"
+
+#include <seastar/core/aligned_buffer.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/internal/pollable_fd.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <liburing.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace experimental::io {
+
+/**
+ * An implementation of \ref persistence that submits I/O through a shard
+ * local io_uring instance, bypassing the Seastar reactor backend.
+ *
+ * Files are installed in the registered file table of the ring and buffers
+ * returned by \ref allocate are carved out of a registered arena when
+ * possible, so that the kernel doesn't need to look up the file and map the
+ * memory on every request. Submissions are deferred until the current task
+ * yields, so I/O dispatched back to back by the scheduler across many files
+ * is submitted with a single system call. Completions are signaled through an
+ * eventfd polled by the reactor.
+ *
+ * \ref dma_write_and_flush links the write and an fdatasync, so that a flush
+ * costs a single submission and the sync only starts after the write
+ * finished.
+ *
+ * Construction throws std::system_error if io_uring is not available, e.g.
+ * in an old kernel or restricted by seccomp. \ref stop must be called before
+ * the instance is destroyed, and all buffers from \ref allocate must be
+ * released before that.
+ */
+class uring_persistence final : public persistence {
+    static constexpr uint64_t dma_alignment = 4096;
+
+public:
+    struct config {
+        /// Number of entries of the submission queue.
+        unsigned queue_depth{256};
+        /// Number of entries of the registered file table.
+        unsigned max_files{1024};
+        /// Number of registered buffers served by allocate().
+        size_t registered_buffers{64};
+        /// Size of each registered buffer, a multiple of 4KiB.
+        size_t registered_buffer_size{128UL * 1024};
+    };
+
+    /**
+     * Submission statistics.
+     */
+    struct stats {
+        /// Number of io_uring_submit calls.
+        uint64_t submit_calls{0};
+        /// Number of submitted entries.
+        uint64_t submitted_entries{0};
+        /// Number of reads and writes using a registered buffer.
+        uint64_t fixed_buffer_ops{0};
+        /// Number of operations on a registered file.
+        uint64_t fixed_file_ops{0};
+    };
+
+    uring_persistence();
+    explicit uring_persistence(config config);
+    uring_persistence(const uring_persistence&) = delete;
+    uring_persistence(uring_persistence&&) = delete;
+    uring_persistence& operator=(const uring_persistence&) = delete;
+    uring_persistence& operator=(uring_persistence&&) = delete;
+    ~uring_persistence() override;
+
+    /**
+     * Check if io_uring can be used in this process.
+     */
+    static bool is_supported() noexcept;
+
+    /**
+     * Wait for in-flight operations and stop polling for completions.
+     */
+    seastar::future<> stop();
+
+    /**
+     * An implementation of \ref persistence::file using io_uring.
+     */
+    class uring_file final : public file {
+    public:
+        uring_file(
+          uring_persistence* persistence,
+          int fd,
+          std::optional<unsigned> slot);
+
+        seastar::future<size_t>
+        dma_read(uint64_t pos, char* buf, size_t len) noexcept override;
+
+        seastar::future<size_t>
+        dma_write(uint64_t pos, const char* buf, size_t len) noexcept override;
+
+        seastar::future<> flush() noexcept override;
+
+        seastar::future<size_t> dma_write_and_flush(
+          uint64_t pos, const char* buf, size_t len) noexcept override;
+
+        seastar::future<> close() noexcept override;
+
+        [[nodiscard]] uint64_t
+        disk_read_dma_alignment() const noexcept override;
+        [[nodiscard]] uint64_t
+        disk_write_dma_alignment() const noexcept override;
+        [[nodiscard]] uint64_t memory_dma_alignment() const noexcept override;
+
+    private:
+        friend uring_persistence;
+
+        /*
+         * prepare the file descriptor of an entry, using the registered file
+         * table slot when the file has one.
+         */
+        void set_file(io_uring_sqe* sqe) const;
+
+        uring_persistence* persistence_;
+        int fd_;
+        std::optional<unsigned> slot_;
+    };
+
+    seastar::temporary_buffer<char>
+    allocate(uint64_t alignment, size_t size) noexcept override;
+
+    seastar::future<seastar::shared_ptr<file>>
+    create(std::filesystem::path path) noexcept override;
+
+    seastar::future<seastar::shared_ptr<file>>
+    open(std::filesystem::path path) noexcept override;
+
+    [[nodiscard]] const stats& get_stats() const noexcept { return stats_; }
+
+private:
+    /*
+     * state of a submitted entry, completed by the reaper
+     */
+    struct request {
+        seastar::promise<int> done;
+    };
+
+    seastar::future<seastar::shared_ptr<file>>
+    do_open(std::filesystem::path path, int flags);
+    seastar::future<> do_close(int fd, std::optional<unsigned> slot);
+
+    /*
+     * get a submission queue entry, submitting queued entries to make room
+     * if needed.
+     */
+    io_uring_sqe* get_sqe(unsigned needed = 1);
+
+    /*
+     * queue \p sqe tracked by \p req, submission is deferred until the
+     * current task yields.
+     */
+    seastar::future<int> enqueue(io_uring_sqe* sqe, request& req);
+
+    void schedule_submit();
+    void submit_now();
+    seastar::future<> reap_loop();
+    void reap();
+
+    /*
+     * index of the registered buffer which contains [buf, buf + len).
+     */
+    std::optional<unsigned> buffer_index(const char* buf, size_t len) const;
+
+    io_uring ring_{};
+    config config_;
+    seastar::pollable_fd eventfd_;
+    seastar::gate gate_;
+    seastar::future<> reaper_ = seastar::make_ready_future<>();
+    bool stopping_{false};
+    bool submit_scheduled_{false};
+    size_t inflight_{0};
+
+    std::vector<unsigned> free_slots_;
+
+    std::unique_ptr<char[], seastar::free_deleter> buffers_;
+    std::vector<unsigned> free_buffers_;
+
+    stats stats_;
+};
+
+} // namespace experimental::io
@@ -9,9 +9,10 @@
 
 #pragma once
 
-#include "bytes/streambuf.h"
+#include "bytes/iobuf.h"
 #include "json/encodings.h"
-#include "json/istreamwrapper.h"
+
+#include <cstddef>
 
 namespace json {
 
@@ -19,41 +20,111 @@ namespace impl {
 
 /**
  * \brief An in-memory input stream with non-contiguous memory allocation.
+ *
+ * Reads the fragments of the iobuf in place, the parser only pays for a
+ * branch per character instead of going through a std::istream.
  */
 template<typename Encoding = ::json::UTF8<>>
 class chunked_input_stream {
 public:
     using Ch = Encoding::Ch;
+    static_assert(sizeof(Ch) == 1, "iobuf fragments are read as bytes");
 
     explicit chunked_input_stream(iobuf&& buf)
       : _buf(std::move(buf))
-      , _is(_buf)
-      , _sis{&_is}
-      , _isw(_sis) {}
+      , _frag(_buf.cbegin()) {
+        load_fragment();
+    }
+
+    chunked_input_stream(const chunked_input_stream&) = delete;
+    chunked_input_stream& operator=(const chunked_input_stream&) = delete;
+    chunked_input_stream(chunked_input_stream&&) = delete;
+    chunked_input_stream& operator=(chunked_input_stream&&) = delete;
+    ~chunked_input_stream() = default;
 
     /**
      * \defgroup Implement rapidjson::Stream
      */
     /**@{*/
 
-    Ch Peek() const { return _isw.Peek(); }
-    Ch Peek4() const { return _isw.Peek4(); }
-    Ch Take() { return _isw.Take(); }
-    size_t Tell() const { return _isw.Tell(); }
-    void Put(Ch ch) { return _isw.Put(ch); }
-    Ch* PutBegin() { return _isw.PutBegin(); }
-    size_t PutEnd(Ch* ch) { return _isw.PutEnd(ch); }
-    void Flush() { return _isw.Flush(); }
+    Ch Peek() const { return _cur != _end ? *_cur : '\0'; }
+    const Ch* Peek4() const { return _end - _cur >= 4 ? _cur : nullptr; }
+    Ch Take() {
+        if (_cur == _end) {
+            return '\0';
+        }
+        auto c = *_cur++;
+        if (_cur == _end) {
+            next_fragment();
+        }
+        return c;
+    }
+    size_t Tell() const { return _consumed + (_cur - _begin); }
+
+    // Not an output stream
+    void Put(Ch) { RAPIDJSON_ASSERT(false); }
+    Ch* PutBegin() {
+        RAPIDJSON_ASSERT(false);
+        return nullptr;
+    }
+    size_t PutEnd(Ch*) {
+        RAPIDJSON_ASSERT(false);
+        return 0;
+    }
+    void Flush() { RAPIDJSON_ASSERT(false); }
 
     /**@}*/
 
+    /// Skip JSON whitespace a fragment at a time
+    void skip_whitespace() {
+        while (_cur != _end) {
+            while (_cur != _end
+                   && (*_cur == ' ' || *_cur == '\n' || *_cur == '\r'
+                       || *_cur == '\t')) {
+                ++_cur;
+            }
+            if (_cur != _end) {
+                return;
+            }
+            next_fragment();
+        }
+    }
+
 private:
+    void load_fragment() {
+        while (_frag != _buf.cend() && _frag->size() == 0) {
+            ++_frag;
+        }
+        if (_frag == _buf.cend()) {
+            _begin = _cur = _end = nullptr;
+            return;
+        }
+        _begin = _cur = _frag->get();
+        _end = _begin + _frag->size();
+    }
+
+    void next_fragment() {
+        _consumed += _end - _begin;
+        ++_frag;
+        load_fragment();
+    }
+
     iobuf _buf;
-    iobuf_istreambuf _is;
-    std::istream _sis;
-    ::json::IStreamWrapper _isw;
+    iobuf::const_iterator _frag;
+    const Ch* _begin{nullptr};
+    const Ch* _cur{nullptr};
+    const Ch* _end{nullptr};
+    // Bytes in the fragments before the current one
+    size_t _consumed{0};
 };
 
+/// Found by argument dependent lookup from rapidjson::GenericReader, it is
+/// more specialized than the generic rapidjson::SkipWhitespace
+template<typename Encoding>
+void SkipWhitespace(chunked_input_stream<Encoding>& is) { // NOLINT
+    is.skip_whitespace();
+}
+
 } // namespace impl
 
 template<typename Encoding>
@@ -46,6 +46,26 @@ public:
         }
     }
 
+    /// Write a string value from characters which need no escaping, e.g.
+    /// base64. A chunked_buffer appends \p buf without inspecting it.
+    bool RawString(iobuf buf) {
+        constexpr bool buffer_is_chunked
+          = std::same_as<OutputStream, json::chunked_buffer>;
+        this->Prefix(rapidjson::kStringType);
+        this->os_->Put('"');
+        if constexpr (buffer_is_chunked) {
+            this->os_->_impl.append(std::move(buf));
+        } else {
+            for (const auto& frag : buf) {
+                for (const char c : std::string_view{frag.get(), frag.size()}) {
+                    this->os_->Put(c);
+                }
+            }
+        }
+        this->os_->Put('"');
+        return this->EndValue(true);
+    }
+
 private:
     bool write_chunked_string(const iobuf& buf) {
         const auto last_frag = [this]() {
@@ -173,6 +173,37 @@ SEASTAR_THREAD_TEST_CASE(json_chunked_input_stream_test) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(json_chunked_input_stream_fragments_test) {
+    constexpr std::string_view input{R"( { "a" :	[1, "two",
+ null] }  )"};
+    constexpr auto split = [](std::string_view str, size_t frag_size) {
+        iobuf in;
+        in.append_fragments(iobuf{});
+        for (size_t i = 0; i < str.size(); i += frag_size) {
+            in.append_fragments(iobuf::from(str.substr(i, frag_size)));
+        }
+        return in;
+    };
+
+    for (size_t frag_size : {1, 2, 3, 7, 1024}) {
+        json::chunked_input_stream is{split(input, frag_size)};
+        json::Document doc;
+        doc.ParseStream(is);
+        BOOST_REQUIRE(!doc.HasParseError());
+        BOOST_REQUIRE_EQUAL(doc["a"].Size(), 3);
+        BOOST_REQUIRE_EQUAL(doc["a"][1].GetString(), std::string_view{"two"});
+        BOOST_REQUIRE_EQUAL(is.Tell(), input.size());
+    }
+
+    for (size_t frag_size : {1, 4, 1024}) {
+        json::chunked_input_stream is{split(R"({"a": x})", frag_size)};
+        json::Document doc;
+        doc.ParseStream(is);
+        BOOST_REQUIRE(doc.HasParseError());
+        BOOST_REQUIRE_EQUAL(doc.GetErrorOffset(), 6);
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(json_iobuf_writer_test) {
     constexpr auto to_string = [](const iobuf& buf) {
         iobuf_const_parser p{std::move(buf)};
@@ -34,6 +34,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/coroutine/exception.hh>
 
 #include <absl/container/node_hash_map.h>
@@ -44,10 +45,15 @@
 
 namespace kafka::client {
 
-client::client(const YAML::Node& cfg, external_mitigate mitigater)
+client::client(
+  const YAML::Node& cfg,
+  external_mitigate mitigater,
+  ss::lw_shared_ptr<shared_metadata> metadata)
   : _config{cfg}
   , _seeds{_config.brokers()}
-  , _topic_cache{}
+  , _metadata{
+      metadata ? std::move(metadata) : ss::make_lw_shared<shared_metadata>()}
+  , _topic_cache{_metadata->topics()}
   , _brokers{_config}
   , _wait_or_start_update_metadata{[this](wait_or_start::tag tag) {
       return update_metadata(tag);
@@ -58,7 +64,21 @@ client::client(const YAML::Node& cfg, external_mitigate mitigater)
   , _external_mitigate(std::move(mitigater)) {}
 
 ss::future<> client::do_connect(net::unresolved_address addr) {
-    return make_broker(unknown_node_id, addr, _config)
+    if (_metadata->is_shared() && !_metadata->brokers().empty()) {
+        // another client already knows the brokers, connect to them with
+        // this client's credentials and fall back to the seed otherwise
+        auto f = co_await ss::coroutine::as_future(apply_shared_brokers());
+        if (f.failed()) {
+            vlog(
+              kclog.debug,
+              "{}failed to connect to the shared brokers: {}",
+              *this,
+              f.get_exception());
+        } else if (!co_await _brokers.empty()) {
+            co_return;
+        }
+    }
+    co_await make_broker(unknown_node_id, addr, _config)
       .then([this](shared_broker_t broker) {
           return broker->dispatch(metadata_request{.list_all_topics = true})
             .then(
@@ -67,6 +87,11 @@ ss::future<> client::do_connect(net::unresolved_address addr) {
       });
 }
 
+ss::future<> client::apply_shared_brokers() {
+    co_await _brokers.apply(_metadata->brokers().copy());
+    _controller = _metadata->controller();
+}
+
 ss::future<> client::connect() {
     std::shuffle(
       _seeds.begin(), _seeds.end(), random_generators::internal::gen);
@@ -116,6 +141,20 @@ ss::future<> client::stop() noexcept {
 }
 
 ss::future<> client::update_metadata(wait_or_start::tag) {
+    return ss::try_with_gate(_gate, [this]() {
+        return _metadata->update([this] { return do_update_metadata(); })
+          .then([this](bool updated) {
+              if (updated) {
+                  return ss::now();
+              }
+              // another client updated the metadata meanwhile
+              vlog(kclog.debug, "{}using shared metadata", *this);
+              return apply_shared_brokers();
+          });
+    });
+}
+
+ss::future<> client::do_update_metadata() {
     return ss::try_with_gate(_gate, [this]() {
         vlog(kclog.debug, "{}updating metadata", *this);
         return _brokers.any()
@@ -145,9 +184,9 @@ ss::future<> client::update_metadata(wait_or_start::tag) {
 
 ss::future<> client::apply(metadata_response res) {
     try {
-        co_await _brokers.apply(std::move(res.data.brokers));
-        co_await _topic_cache.apply(std::move(res.data.topics));
+        co_await _brokers.apply(res.data.brokers.copy());
         _controller = res.data.controller_id;
+        co_await _metadata->apply(std::move(res));
     } catch (const std::exception& ex) {
         vlog(kclog.debug, "{}Failed to apply metadata request: {}", *this, ex);
         throw;
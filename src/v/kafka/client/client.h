@@ -19,6 +19,7 @@
 #include "kafka/client/consumer.h"
 #include "kafka/client/fetcher.h"
 #include "kafka/client/producer.h"
+#include "kafka/client/shared_metadata.h"
 #include "kafka/client/topic_cache.h"
 #include "kafka/client/transport.h"
 #include "kafka/client/types.h"
@@ -78,7 +79,8 @@ public:
       = ss::noncopyable_function<ss::future<>(std::exception_ptr)>;
     explicit client(
       const YAML::Node& cfg,
-      external_mitigate mitigater = impl::default_external_mitigate);
+      external_mitigate mitigater = impl::default_external_mitigate,
+      ss::lw_shared_ptr<shared_metadata> metadata = nullptr);
 
     /// \brief Connect to all brokers.
     ss::future<> connect();
@@ -189,9 +191,14 @@ private:
     /// the error
     ss::future<> mitigate_error(std::exception_ptr ex);
 
+    ss::future<> do_update_metadata();
+
     /// \brief Apply metadata update
     ss::future<> apply(metadata_response res);
 
+    /// \brief Connect to the brokers of the shared metadata
+    ss::future<> apply_shared_brokers();
+
     /// \brief Log the client ID if it exists, otherwise don't log
     friend std::ostream& operator<<(std::ostream& os, const client& c) {
         if (c._config.client_identifier().has_value()) {
@@ -204,8 +211,10 @@ private:
     configuration _config;
     /// \brief Seeds are used when no brokers are connected.
     std::vector<net::unresolved_address> _seeds;
+    /// \brief Cluster metadata, possibly shared with other clients.
+    ss::lw_shared_ptr<shared_metadata> _metadata;
     /// \brief Cache of topic information.
-    topic_cache _topic_cache;
+    topic_cache& _topic_cache;
     /// \brief Broker lookup from topic_partition.
     brokers _brokers;
     /// \brief The node id of the controller.
@@ -66,6 +66,14 @@ configuration::configuration()
       "Delay (in milliseconds) to wait before sending batch.",
       {},
       100ms)
+  , produce_batch_adaptive_delay(
+      *this,
+      "produce_batch_adaptive_delay",
+      "When enabled, a batch is sent without waiting for "
+      "`produce_batch_delay_ms` if records arrive less often than that "
+      "delay, as waiting would not add more records to the batch.",
+      {},
+      false)
   , produce_compression_type(
       *this,
       "produce_compression_type",
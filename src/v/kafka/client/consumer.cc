@@ -33,6 +33,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/coroutine/as_future.hh>
 
 #include <chrono>
 #include <exception>
@@ -404,10 +405,19 @@ ss::future<fetch_response>
 consumer::dispatch_fetch(broker_reqs_t::value_type br) {
     auto& [broker, req] = br;
     vlog(kclog.trace, "Consumer: {}, fetch_req: {}", *this, req);
-    auto res = co_await broker->dispatch(std::move(req));
+    auto fut = co_await ss::coroutine::as_future(
+      broker->dispatch(std::move(req)));
+    if (fut.failed()) {
+        // the broker may or may not have applied the request, the next
+        // request establishes a new session
+        _fetch_sessions[broker].reset_session();
+        std::rethrow_exception(fut.get_exception());
+    }
+    auto res = fut.get();
     vlog(kclog.trace, "Consumer: {}, fetch_res: {}", *this, res);
 
     if (res.data.error_code != error_code::none) {
+        _fetch_sessions[broker].reset_session();
         throw broker_error(broker->id(), res.data.error_code);
     }
 
@@ -444,16 +454,17 @@ ss::future<fetch_response> consumer::fetch(
                             }})
                           .first->second;
 
-            if (req.data.topics.empty() || req.data.topics.back().name != t) {
-                req.data.topics.push_back(fetch_request::topic{.name{t}});
-            }
-
-            req.data.topics.back().fetch_partitions.push_back(
-              fetch_request::partition{
-                .partition_index = p,
-                .fetch_offset = session.offset(tp),
-                .max_bytes = max_bytes.value_or(
-                  _config.consumer_request_max_bytes)});
+            session.add_partition(
+              req, tp, max_bytes.value_or(_config.consumer_request_max_bytes));
+        }
+    }
+    for (auto& [broker, session] : _fetch_sessions) {
+        if (auto it = broker_reqs.find(broker); it != broker_reqs.end()) {
+            session.add_forgotten(it->second);
+        } else {
+            // nothing is fetched from the broker anymore, let its session
+            // expire
+            session.reset_session();
         }
     }
 
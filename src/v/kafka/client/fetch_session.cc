@@ -30,13 +30,69 @@ model::offset fetch_session::offset(model::topic_partition_view tpv) const {
     return part_it->second;
 }
 
+void fetch_session::add_partition(
+  fetch_request& req, const model::topic_partition& tp, int32_t max_bytes) {
+    const session_partition sp{
+      .fetch_offset = offset(tp), .max_bytes = max_bytes};
+    _pending_partitions[tp.topic][tp.partition] = sp;
+
+    if (_id != invalid_fetch_session_id) {
+        auto topic_it = _session_partitions.find(tp.topic);
+        if (topic_it != _session_partitions.end()) {
+            auto part_it = topic_it->second.find(tp.partition);
+            if (part_it != topic_it->second.end() && part_it->second == sp) {
+                return;
+            }
+        }
+    }
+
+    if (req.data.topics.empty() || req.data.topics.back().name != tp.topic) {
+        req.data.topics.push_back(fetch_request::topic{.name{tp.topic}});
+    }
+    req.data.topics.back().fetch_partitions.push_back(fetch_request::partition{
+      .partition_index = tp.partition,
+      .fetch_offset = sp.fetch_offset,
+      .max_bytes = sp.max_bytes});
+}
+
+void fetch_session::add_forgotten(fetch_request& req) const {
+    if (_id == invalid_fetch_session_id) {
+        return;
+    }
+    for (const auto& [t, ps] : _session_partitions) {
+        auto pending_it = _pending_partitions.find(t);
+        fetch_request::forgotten_topic forgotten{.name = t};
+        for (const auto& [p_id, sp] : ps) {
+            if (
+              pending_it == _pending_partitions.end()
+              || !pending_it->second.contains(p_id)) {
+                forgotten.forgotten_partition_indexes.push_back(p_id());
+            }
+        }
+        if (!forgotten.forgotten_partition_indexes.empty()) {
+            req.data.forgotten.push_back(std::move(forgotten));
+        }
+    }
+}
+
+void fetch_session::reset_session() {
+    _id = invalid_fetch_session_id;
+    _epoch = initial_fetch_session_epoch;
+    _session_partitions.clear();
+    _pending_partitions.clear();
+}
+
 bool fetch_session::apply(fetch_response& res) {
     if (_id == invalid_fetch_session_id) {
         _id = fetch_session_id{res.data.session_id};
     }
     vassert(res.data.session_id == _id, "session mismatch: {}", *this);
 
-    ++_epoch;
+    _session_partitions = std::exchange(_pending_partitions, {});
+    // without a session every request is a full one
+    if (_id != invalid_fetch_session_id) {
+        ++_epoch;
+    }
     for (auto& part : res) {
         if (part.partition_response->error_code != error_code::none) {
             continue;
@@ -19,12 +19,17 @@
 #include <iosfwd>
 
 namespace kafka {
+struct fetch_request;
 struct fetch_response;
-}
+} // namespace kafka
 
 namespace kafka::client {
 
 /// \brief Maintain state for consumer group fetch session.
+///
+/// Once the broker has created the session, requests are incremental
+/// (KIP-227): a partition is only sent if the broker's view of it is stale,
+/// and partitions which are no longer fetched are sent as forgotten.
 class fetch_session {
 public:
     fetch_session() = default;
@@ -39,6 +44,18 @@ public:
     void id(kafka::fetch_session_id id) { _id = id; }
     kafka::fetch_session_epoch epoch() const { return _epoch; }
     model::offset offset(model::topic_partition_view tpv) const;
+
+    /// \brief Add the partition to the request, unless the session already
+    /// fetches it from the same offset.
+    void add_partition(
+      fetch_request& req, const model::topic_partition&, int32_t max_bytes);
+    /// \brief Forget the partitions of the session not added to the request
+    /// since the previous response.
+    void add_forgotten(fetch_request& req) const;
+    /// \brief Drop the broker side session, e.g. after a fetch error, so that
+    /// the next request is a full one.
+    void reset_session();
+
     bool apply(fetch_response& res);
     std::vector<kafka::offset_commit_request_topic>
     make_offset_commit_request() const;
@@ -46,12 +63,26 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const fetch_session&);
 
 private:
+    struct session_partition {
+        model::offset fetch_offset;
+        int32_t max_bytes;
+        bool operator==(const session_partition&) const = default;
+    };
+    using session_partitions = absl::node_hash_map<
+      model::topic,
+      absl::node_hash_map<model::partition_id, session_partition>>;
+
     kafka::fetch_session_id _id{kafka::invalid_fetch_session_id};
     kafka::fetch_session_epoch _epoch{kafka::initial_fetch_session_epoch};
     absl::node_hash_map<
       model::topic,
       absl::node_hash_map<model::partition_id, model::offset>>
       _offsets;
+    /// Partitions as the broker currently fetches them in the session
+    session_partitions _session_partitions;
+    /// Partitions of the request in flight, the session holds them once the
+    /// response is applied
+    session_partitions _pending_partitions;
 };
 
 } // namespace kafka::client
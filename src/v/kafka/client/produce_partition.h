@@ -23,6 +23,9 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <chrono>
+#include <optional>
+
 namespace kafka::client {
 
 /// \brief Batch multiple client requests, flush them based on size or time.
@@ -40,6 +43,7 @@ public:
       , _consumer{std::move(c)} {}
 
     ss::future<response> produce(model::record_batch&& batch) {
+        record_arrival();
         _record_count += batch.record_count();
         _size_bytes += batch.size_bytes();
         auto fut = _batcher.produce(std::move(batch));
@@ -111,7 +115,7 @@ private:
         // If the threshold is met, then use a delay of 0 so the timer fires
         // nearly immediately after this call.  Otherwise use the produce
         // batch delay when arming the timer.
-        if (!threshold_met()) {
+        if (!threshold_met() && !sparse_arrivals()) {
             rearm_timer_delay = _config.produce_batch_delay();
         }
         _timer.cancel();
@@ -127,12 +131,42 @@ private:
                || _size_bytes >= batch_size_bytes;
     }
 
+    /// \brief Updates the moving average of the time between produce calls
+    void record_arrival() {
+        auto now = clock::now();
+        if (_last_arrival) {
+            auto gap = static_cast<double>(
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - *_last_arrival)
+                .count());
+            if (!_arrival_gap_ms) {
+                _arrival_gap_ms = gap;
+            } else {
+                *_arrival_gap_ms += arrival_smoothing
+                                    * (gap - *_arrival_gap_ms);
+            }
+        }
+        _last_arrival = now;
+    }
+
+    /// \brief Checks whether the next record is expected only after the batch
+    /// delay, in which case lingering adds latency without adding records
+    bool sparse_arrivals() const {
+        return _config.produce_batch_adaptive_delay() && _arrival_gap_ms
+               && *_arrival_gap_ms >= static_cast<double>(
+                    _config.produce_batch_delay().count());
+    }
+
     /// \brief Checks to see if the consumer can run
     ///
     /// Consumer can only run if one is not already running and there are
     /// records available
     bool consumer_can_run() const { return !_in_flight && _record_count > 0; }
 
+    using clock = ss::timer<>::clock;
+    /// Weight of the newest sample in the arrival gap average
+    static constexpr double arrival_smoothing = 0.2;
+
     const configuration& _config;
     produce_batcher _batcher{};
     ss::timer<> _timer{};
@@ -142,6 +176,8 @@ private:
     bool _in_flight{};
     ss::gate _gate;
     std::optional<ss::promise<>> _await_in_flight;
+    std::optional<clock::time_point> _last_arrival;
+    std::optional<double> _arrival_gap_ms;
 };
 
 } // namespace kafka::client
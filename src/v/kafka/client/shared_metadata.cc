@@ -0,0 +1,41 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/shared_metadata.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/as_future.hh>
+
+namespace kafka::client {
+
+ss::future<> shared_metadata::apply(metadata_response res) {
+    if (is_shared()) {
+        co_await _topics.merge(std::move(res.data.topics));
+    } else {
+        co_await _topics.apply(std::move(res.data.topics));
+    }
+    _brokers = std::move(res.data.brokers);
+    _controller = res.data.controller_id;
+}
+
+ss::future<bool> shared_metadata::update(update_func update) {
+    if (!_update_lock.try_wait()) {
+        co_await _update_lock.wait();
+        co_return false;
+    }
+    auto f = co_await ss::coroutine::as_future(update());
+    // release the clients that waited on this update along with the next one
+    _update_lock.signal(_update_lock.waiters() + 1);
+    if (f.failed()) {
+        std::rethrow_exception(f.get_exception());
+    }
+    co_return true;
+}
+
+} // namespace kafka::client
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "container/fragmented_vector.h"
+#include "kafka/client/topic_cache.h"
+#include "kafka/protocol/metadata.h"
+#include "model/metadata.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+namespace kafka::client {
+
+/// \brief Cluster metadata of a client, possibly shared with other clients
+/// connecting to the same cluster with different credentials.
+///
+/// When shared, the metadata applied by any client is seen by all of them,
+/// and concurrent updates by several clients are coalesced into a single
+/// metadata request. Topics are merged rather than replaced, as the clients
+/// may be authorized to describe different topics. Connections are never
+/// shared, the brokers of the metadata are connected to by every client
+/// with its own credentials.
+class shared_metadata {
+public:
+    enum class mode { exclusive, shared };
+    using update_func = ss::noncopyable_function<ss::future<>()>;
+
+    explicit shared_metadata(mode m = mode::exclusive)
+      : _mode(m) {}
+
+    bool is_shared() const { return _mode == mode::shared; }
+
+    topic_cache& topics() { return _topics; }
+
+    /// \brief Brokers of the last applied metadata
+    const chunked_vector<metadata_response::broker>& brokers() const {
+        return _brokers;
+    }
+
+    model::node_id controller() const { return _controller; }
+
+    /// \brief Apply the metadata, the brokers are only recorded
+    ss::future<> apply(metadata_response res);
+
+    /// \brief Run \p update, or if an update is already in flight, possibly
+    /// from another client, wait for that one to finish instead.
+    ///
+    /// Returns true if \p update ran.
+    ss::future<bool> update(update_func update);
+
+private:
+    mode _mode;
+    topic_cache _topics;
+    chunked_vector<metadata_response::broker> _brokers;
+    model::node_id _controller{-1};
+    ssx::semaphore _update_lock{1, "k/client/metadata"};
+};
+
+} // namespace kafka::client
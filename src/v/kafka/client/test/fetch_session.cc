@@ -155,3 +155,62 @@ SEASTAR_THREAD_TEST_CASE(test_fetch_session_make_offset_commit_request_all) {
       partition.committed_leader_epoch, kafka::invalid_leader_epoch);
     BOOST_REQUIRE_EQUAL(partition.committed_offset, ctx.expected_offset - 1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_fetch_session_incremental_request) {
+    context ctx;
+    kc::fetch_session s;
+    const model::topic_partition other_tp{
+      ctx.tp.topic, model::partition_id{3}};
+    constexpr int32_t max_bytes = 1024;
+    auto request_partitions = [](const k::fetch_request& req) {
+        size_t count = 0;
+        for (const auto& t : req.data.topics) {
+            count += t.fetch_partitions.size();
+        }
+        return count;
+    };
+
+    // Without a session every partition is sent
+    k::fetch_request full;
+    s.add_partition(full, ctx.tp, max_bytes);
+    s.add_partition(full, other_tp, max_bytes);
+    s.add_forgotten(full);
+    BOOST_REQUIRE_EQUAL(request_partitions(full), 2);
+    BOOST_REQUIRE(full.data.forgotten.empty());
+    BOOST_REQUIRE(ctx.apply_fetch_response(s, 8));
+
+    // Only the partition which received records has a new fetch offset
+    k::fetch_request incremental;
+    s.add_partition(incremental, ctx.tp, max_bytes);
+    s.add_partition(incremental, other_tp, max_bytes);
+    s.add_forgotten(incremental);
+    BOOST_REQUIRE_EQUAL(request_partitions(incremental), 1);
+    const auto& sent = incremental.data.topics[0].fetch_partitions[0];
+    BOOST_REQUIRE_EQUAL(sent.partition_index, ctx.tp.partition);
+    BOOST_REQUIRE_EQUAL(sent.fetch_offset, ctx.expected_offset);
+    BOOST_REQUIRE(incremental.data.forgotten.empty());
+    BOOST_REQUIRE(ctx.apply_fetch_response(s, std::nullopt));
+
+    // A partition which is no longer fetched is forgotten
+    k::fetch_request forget;
+    s.add_partition(forget, ctx.tp, max_bytes);
+    s.add_forgotten(forget);
+    BOOST_REQUIRE_EQUAL(request_partitions(forget), 0);
+    BOOST_REQUIRE_EQUAL(forget.data.forgotten.size(), 1);
+    BOOST_REQUIRE_EQUAL(forget.data.forgotten[0].name, other_tp.topic);
+    BOOST_REQUIRE_EQUAL(
+      forget.data.forgotten[0].forgotten_partition_indexes.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      forget.data.forgotten[0].forgotten_partition_indexes[0],
+      other_tp.partition());
+    BOOST_REQUIRE(ctx.apply_fetch_response(s, std::nullopt));
+
+    // After a reset the next request is a full one again
+    s.reset_session();
+    BOOST_REQUIRE_EQUAL(s.id(), kafka::invalid_fetch_session_id);
+    BOOST_REQUIRE_EQUAL(s.epoch(), kafka::initial_fetch_session_epoch);
+    BOOST_REQUIRE_EQUAL(s.offset(ctx.tp), ctx.expected_offset);
+    k::fetch_request after_reset;
+    s.add_partition(after_reset, ctx.tp, max_bytes);
+    BOOST_REQUIRE_EQUAL(request_partitions(after_reset), 1);
+}
@@ -18,6 +18,7 @@
 #include "model/record.h"
 #include "test_utils/async.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/thread_test_case.hh>
 
 #include <boost/test/tools/old/interface.hpp>
@@ -75,3 +76,43 @@ SEASTAR_THREAD_TEST_CASE(test_produce_partition_record_count) {
     BOOST_REQUIRE_EQUAL(c_res2.base_offset, model::offset{3});
     producer.stop().get();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_adaptive_delay) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    cfg.produce_batch_size_bytes.set_value(1024);
+    cfg.produce_batch_record_count.set_value(1000);
+    cfg.produce_batch_delay.set_value(500ms);
+    // configuration under test
+    cfg.produce_batch_adaptive_delay.set_value(true);
+
+    kc::produce_partition producer(cfg, consumer);
+
+    // without an estimate of the arrival rate the batch waits for the delay
+    auto c_res0_fut = producer.produce(make_batch(model::offset(0), 1));
+    tests::cooperative_spin_wait_with_timeout(5s, [&consumed_batches]() {
+        return consumed_batches.size() > 0;
+    }).get();
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{0}}});
+    BOOST_REQUIRE_EQUAL(c_res0_fut.get().base_offset, model::offset{0});
+
+    // records arrive less often than the delay, the batch is sent right away
+    ss::sleep(600ms).get();
+    auto c_res1_fut = producer.produce(make_batch(model::offset(1), 1));
+    tests::cooperative_spin_wait_with_timeout(200ms, [&consumed_batches]() {
+        return consumed_batches.size() > 1;
+    }).get();
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{1}}});
+    BOOST_REQUIRE_EQUAL(c_res1_fut.get().base_offset, model::offset{1});
+    producer.stop().get();
+}
@@ -0,0 +1,85 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/exceptions.h"
+#include "kafka/client/shared_metadata.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <chrono>
+
+namespace kc = kafka::client;
+using namespace std::chrono_literals;
+
+namespace {
+
+kafka::metadata_response make_metadata(std::string_view topic, int leader) {
+    kafka::metadata_response res;
+    kafka::metadata_response::topic t{.name = model::topic(topic)};
+    t.partitions.push_back(
+      kafka::metadata_response::partition{
+        .partition_index = model::partition_id(0),
+        .leader_id = model::node_id(leader)});
+    res.data.topics.push_back(std::move(t));
+    res.data.brokers.push_back(
+      kafka::metadata_response::broker{
+        .node_id = model::node_id(leader), .host = "localhost", .port = 9092});
+    res.data.controller_id = model::node_id(leader);
+    return res;
+}
+
+model::topic_partition tp(std::string_view topic) {
+    return {model::topic(topic), model::partition_id(0)};
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_exclusive_metadata_replaces_topics) {
+    kc::shared_metadata md;
+    md.apply(make_metadata("a", 1)).get();
+    md.apply(make_metadata("b", 2)).get();
+    BOOST_REQUIRE_EQUAL(md.topics().leader(tp("b")).get(), model::node_id(2));
+    BOOST_REQUIRE_THROW(
+      md.topics().leader(tp("a")).get(), kc::partition_error);
+    BOOST_REQUIRE_EQUAL(md.brokers().size(), 1);
+    BOOST_REQUIRE_EQUAL(md.controller(), model::node_id(2));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_shared_metadata_merges_topics) {
+    kc::shared_metadata md{kc::shared_metadata::mode::shared};
+    md.apply(make_metadata("a", 1)).get();
+    md.apply(make_metadata("b", 2)).get();
+    md.apply(make_metadata("a", 3)).get();
+    BOOST_REQUIRE_EQUAL(md.topics().leader(tp("a")).get(), model::node_id(3));
+    BOOST_REQUIRE_EQUAL(md.topics().leader(tp("b")).get(), model::node_id(2));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_shared_metadata_coalesces_updates) {
+    kc::shared_metadata md{kc::shared_metadata::mode::shared};
+    size_t requests = 0;
+    auto update = [&requests] {
+        ++requests;
+        return ss::sleep(10ms);
+    };
+    auto first = md.update(update);
+    auto second = md.update(update);
+    auto third = md.update(update);
+    BOOST_REQUIRE(first.get());
+    BOOST_REQUIRE(!second.get());
+    BOOST_REQUIRE(!third.get());
+    BOOST_REQUIRE_EQUAL(requests, 1);
+
+    // a later update is not coalesced with the completed one
+    BOOST_REQUIRE(md.update(update).get());
+    BOOST_REQUIRE_EQUAL(requests, 2);
+}
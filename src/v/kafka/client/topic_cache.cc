@@ -20,30 +20,48 @@
 
 namespace kafka::client {
 
-ss::future<>
-topic_cache::apply(small_fragment_vector<metadata_response::topic>&& topics) {
-    topics_t cache;
-    cache.reserve(topics.size());
+namespace {
+
+template<typename Topics>
+void insert_topics(
+  Topics& cache, small_fragment_vector<metadata_response::topic>& topics) {
     for (const auto& t : topics) {
         const auto initial_partition_id = model::partition_id{
           random_generators::get_int<model::partition_id::type>(
             t.partitions.size())};
-        topic_data topic_data{
+        typename Topics::mapped_type topic_data{
           .partitioner_func = default_partitioner(initial_partition_id)};
         auto& cache_t
-          = cache.emplace(t.name, std::move(topic_data)).first->second;
+          = cache.insert_or_assign(t.name, std::move(topic_data)).first->second;
         cache_t.partitions.reserve(t.partitions.size());
         for (const auto& p : t.partitions) {
             cache_t.partitions.emplace(
-              p.partition_index, partition_data{.leader = p.leader_id});
+              p.partition_index,
+              typename decltype(cache_t.partitions)::mapped_type{
+                .leader = p.leader_id});
         }
         cache_t.partitions.rehash(0);
     }
+}
+
+} // namespace
+
+ss::future<>
+topic_cache::apply(small_fragment_vector<metadata_response::topic>&& topics) {
+    topics_t cache;
+    cache.reserve(topics.size());
+    insert_topics(cache, topics);
     cache.rehash(0);
     std::exchange(_topics, std::move(cache));
     return ss::now();
 }
 
+ss::future<>
+topic_cache::merge(small_fragment_vector<metadata_response::topic>&& topics) {
+    insert_topics(_topics, topics);
+    return ss::now();
+}
+
 ss::future<model::node_id>
 topic_cache::leader(model::topic_partition tp) const {
     if (auto topic_it = _topics.find(tp.topic); topic_it != _topics.end()) {
@@ -50,6 +50,11 @@ public:
     ss::future<>
     apply(small_fragment_vector<metadata_response::topic>&& topics);
 
+    /// \brief Update the given topics, keeping the ones missing from
+    /// \p topics.
+    ss::future<>
+    merge(small_fragment_vector<metadata_response::topic>&& topics);
+
     /// \brief Obtain the leader for the given topic-partition
     ss::future<model::node_id> leader(model::topic_partition tp) const;
 
@@ -173,15 +173,19 @@ ss::future<storage::translating_reader> replicated_partition::make_reader(
         // No need to translate the offsets in this case since all fetch
         // requestS in read replica are served via remote_partition which
         // does its own translation.
-        co_return co_await _partition->make_cloud_reader(cfg);
+        auto rdr = co_await _partition->make_cloud_reader(cfg);
+        rdr.from_cloud = true;
+        co_return rdr;
     }
 
     if (
       may_read_from_cloud(model::offset_cast(cfg.start_offset))
       && cfg.start_offset >= _partition->start_cloud_offset()) {
         cfg.type_filter = {model::record_batch_type::raft_data};
-        co_return co_await _partition->make_cloud_reader(
+        auto rdr = co_await _partition->make_cloud_reader(
           cfg, debounce_deadline);
+        rdr.from_cloud = true;
+        co_return rdr;
     }
 
     cfg.start_offset = _translator->to_log_offset(cfg.start_offset);
@@ -188,8 +188,36 @@ struct fetch_response final {
     // Used for usage/metering to relay this value back to the connection layer
     size_t internal_topic_bytes{0};
 
+    /*
+     * Upper bound of the encoded size of the response without the record
+     * sets. The response is encoded in two passes: this bound sizes a single
+     * buffer the fields are staged in, the record sets are then linked in
+     * between runs of fields without being copied.
+     */
+    size_t encoded_fields_size_bound() const {
+        // throttle time, error code, session id, topics count
+        size_t bound = 4 + 2 + 4 + 4;
+        for (const auto& t : data.topics) {
+            // name and partitions count
+            bound += 2 + t.name().size() + 4;
+            for (const auto& p : t.partitions) {
+                // partition index, error code, high watermark, last stable
+                // offset, log start offset, aborted transactions count,
+                // preferred read replica and records size
+                bound += 4 + 2 + 8 + 8 + 8 + 4 + 4 + 4;
+                if (p.aborted) {
+                    // producer id and first offset
+                    bound += p.aborted->size() * (8 + 8);
+                }
+            }
+        }
+        return bound;
+    }
+
     void encode(protocol::encoder& writer, api_version version) {
+        writer.stage_small_writes(encoded_fields_size_bound());
         data.encode(writer, version);
+        writer.flush_staged();
     }
 
     void decode(iobuf buf, api_version version) {
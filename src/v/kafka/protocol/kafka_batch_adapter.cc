@@ -18,6 +18,7 @@
 #include "kafka/protocol/wire.h"
 #include "model/fundamental.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "storage/parser_utils.h"
 
 #include <seastar/core/smp.hh>
@@ -189,12 +190,12 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
 
     /**
      * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * we make sure that the records can be parsed, walking over them in place
+     * in the request buffer rather than materializing every record.
      */
     if (!new_batch.compressed()) {
         try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
+            model::verify_records(new_batch);
         } catch (const std::exception& e) {
             vlog(klog.error, "Parsing uncompressed records: {}", e.what());
             return remainder;
@@ -12,6 +12,8 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/vassert.h"
+#include "container/fragmented_vector.h"
 #include "kafka/protocol/schemata/metadata_request.h"
 #include "kafka/protocol/schemata/metadata_response.h"
 #include "model/metadata.h"
@@ -54,6 +56,53 @@ struct metadata_request {
     }
 };
 
+/// First version of the metadata response using the flexible encoding
+inline constexpr api_version metadata_response_first_flexible_version{9};
+
+/**
+ * Encodes a single topic of the metadata response the same way the generated
+ * metadata_response_data::encode does it, so that the topics can be encoded
+ * independently of the rest of the response. Only the versions without the
+ * flexible encoding are supported.
+ */
+inline void encode_metadata_topic(
+  protocol::encoder& writer,
+  const metadata_response_topic& topic,
+  api_version version,
+  bool with_authorized_operations = true) {
+    vassert(
+      version < metadata_response_first_flexible_version,
+      "Unsupported metadata response version {}",
+      version);
+    const auto write_node = [](const auto& n, protocol::encoder& w) {
+        w.write(n);
+    };
+    writer.write(topic.error_code);
+    writer.write(topic.name);
+    if (version >= api_version(1)) {
+        writer.write(topic.is_internal);
+    }
+    writer.write_array(
+      topic.partitions,
+      [version, &write_node](
+        const metadata_response_partition& p, protocol::encoder& w) {
+          w.write(p.error_code);
+          w.write(p.partition_index);
+          w.write(p.leader_id);
+          if (version >= api_version(7)) {
+              w.write(p.leader_epoch);
+          }
+          w.write_array(p.replica_nodes, write_node);
+          w.write_array(p.isr_nodes, write_node);
+          if (version >= api_version(5)) {
+              w.write_array(p.offline_replicas, write_node);
+          }
+      });
+    if (with_authorized_operations && version >= api_version(8)) {
+        writer.write(topic.topic_authorized_operations);
+    }
+}
+
 struct metadata_response {
     using api_type = metadata_api;
     using topic = metadata_response_topic;
@@ -62,13 +111,54 @@ struct metadata_response {
 
     metadata_response_data data;
 
+    /**
+     * Topics encoded ahead of time with encode_metadata_topic(), written to
+     * the response after the topics in data.topics. Lets the handler share
+     * the encoding of a topic between the responses, the buffers are spliced
+     * into the response without copying.
+     */
+    chunked_vector<iobuf> encoded_topics;
+
     void encode(protocol::encoder& writer, api_version version) {
-        data.encode(writer, version);
+        if (encoded_topics.empty()) {
+            data.encode(writer, version);
+            return;
+        }
+        encode_with_encoded_topics(writer, version);
     }
 
     void decode(iobuf buf, api_version version) {
         data.decode(std::move(buf), version);
     }
+
+private:
+    void encode_with_encoded_topics(protocol::encoder& writer, api_version v) {
+        vassert(
+          v < metadata_response_first_flexible_version,
+          "Encoded topics can't be used with metadata response version {}",
+          v);
+        // Encode everything but the topics, in the non flexible versions the
+        // empty topics array is a 4 byte count followed only by the cluster
+        // authorized operations.
+        auto topics = std::exchange(data.topics, {});
+        iobuf envelope;
+        protocol::encoder envelope_writer(envelope);
+        data.encode(envelope_writer, v);
+        data.topics = std::move(topics);
+
+        const size_t suffix = v >= api_version(8) ? sizeof(int32_t) : 0;
+        const size_t prefix = envelope.size_bytes() - sizeof(int32_t) - suffix;
+        writer.write_direct(envelope.share(0, prefix));
+        writer.write(int32_t(data.topics.size() + encoded_topics.size()));
+        for (const auto& t : data.topics) {
+            encode_metadata_topic(writer, t, v);
+        }
+        for (auto& t : encoded_topics) {
+            writer.write_direct(std::move(t));
+        }
+        encoded_topics.clear();
+        writer.write_direct(envelope.share(prefix + sizeof(int32_t), suffix));
+    }
 };
 
 } // namespace kafka
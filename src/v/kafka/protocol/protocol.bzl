@@ -18,6 +18,8 @@ def generate_kafka_message_libs(name = "generate_kafka_messages_libs"):
             visibility = ["//visibility:public"],
             deps = [
                 ":protocol",
+                "//src/v/base",
+                "//src/v/container:fragmented_vector",
                 "//src/v/kafka/protocol/schemata:" + message + "_request",
                 "//src/v/kafka/protocol/schemata:" + message + "_response",
             ],
@@ -389,3 +389,68 @@ BOOST_AUTO_TEST_CASE(test_optional_tag_values) {
 }
 
 } // namespace kafka
+
+BOOST_AUTO_TEST_CASE(test_fetch_response_staged_encoding) {
+    auto make_response = [] {
+        kafka::fetch_response r;
+        for (int t = 0; t < 3; ++t) {
+            kafka::fetch_response::partition topic;
+            topic.name = model::topic(fmt::format("topic-{}", t));
+            for (int p = 0; p < 50; ++p) {
+                kafka::fetch_response::partition_response pr;
+                pr.partition_index = model::partition_id(p);
+                pr.high_watermark = model::offset(p * 10);
+                if (p % 3 == 0) {
+                    const ss::sstring data(100 + p, 'x');
+                    iobuf records;
+                    records.append(data.data(), data.size());
+                    pr.records = kafka::batch_reader(std::move(records));
+                } else {
+                    pr.records = kafka::batch_reader();
+                }
+                if (p % 7 == 0) {
+                    pr.aborted.emplace();
+                    pr.aborted->push_back(
+                      kafka::fetch_response::aborted_transaction{
+                        .producer_id = kafka::producer_id(p),
+                        .first_offset = model::offset(p)});
+                }
+                topic.partitions.push_back(std::move(pr));
+            }
+            r.data.topics.push_back(std::move(topic));
+        }
+        return r;
+    };
+
+    for (auto version : {api_version(4), api_version(11)}) {
+        iobuf plain;
+        {
+            kafka::protocol::encoder rw(plain);
+            make_response().data.encode(rw, version);
+        }
+
+        auto response = make_response();
+        const auto bound = response.encoded_fields_size_bound();
+        size_t records_bytes = 0;
+        size_t record_sets = 0;
+        for (const auto& topic : response.data.topics) {
+            for (const auto& p : topic.partitions) {
+                if (p.records && p.records->size_bytes() > 0) {
+                    records_bytes += p.records->size_bytes();
+                    ++record_sets;
+                }
+            }
+        }
+        iobuf staged;
+        {
+            kafka::protocol::encoder rw(staged);
+            response.encode(rw, version);
+        }
+
+        BOOST_REQUIRE_EQUAL(staged, plain);
+        BOOST_REQUIRE_LE(staged.size_bytes() - records_bytes, bound);
+        // one run of fields before and after every record set
+        const auto fragments = std::distance(staged.begin(), staged.end());
+        BOOST_REQUIRE_LE(fragments, 2 * record_sets + 1);
+    }
+}
@@ -22,9 +22,12 @@
 
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <fmt/format.h>
 
+#include <array>
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -358,26 +361,85 @@ class encoder {
     // clang-format on
     uint32_t serialize_int(IntegerType val) {
         auto nval = ss::cpu_to_be(ExplicitIntegerType(val));
-        _out->append(reinterpret_cast<const char*>(&nval), sizeof(nval));
+        append(reinterpret_cast<const char*>(&nval), sizeof(nval));
         return sizeof(nval);
     }
 
     uint32_t serialize_vint(int64_t val) {
         auto x = vint::to_bytes(val);
-        _out->append(x.data(), x.size());
+        append(x.data(), x.size());
         return x.size();
     }
 
     uint32_t serialize_unsigned_vint(uint32_t val) {
         auto x = unsigned_vint::to_bytes(val);
-        _out->append(x.data(), x.size());
+        append(x.data(), x.size());
         return x.size();
     }
 
+    void append(const char* data, size_t size) {
+        if (_staged.size() - _staged_end >= size) {
+            std::memcpy(_staged.get_write() + _staged_end, data, size);
+            _staged_end += size;
+            return;
+        }
+        if (!_staged.empty()) {
+            // the bound was off, stop staging rather than interleave the
+            // remaining space with regular fragments
+            flush_staged();
+            _staged = {};
+            _staged_begin = _staged_end = 0;
+        }
+        _out->append(data, size);
+    }
+
+    void append(iobuf&& buf) {
+        if (buf.empty()) {
+            return;
+        }
+        if (_staged.empty()) {
+            _out->append(std::move(buf));
+            return;
+        }
+        flush_staged();
+        _out->append_fragments(std::move(buf));
+    }
+
+    size_t size_bytes() const {
+        return _out->size_bytes() + (_staged_end - _staged_begin);
+    }
+
 public:
     explicit encoder(iobuf& out) noexcept
       : _out(&out) {}
 
+    /**
+     * Stages the next \p bound bytes of small fields in a single buffer
+     * instead of appending them to the output one at a time. Runs of staged
+     * fields are linked into the output as slices of that buffer whenever a
+     * payload is appended by reference, so a response interleaving many small
+     * fields with record sets costs one allocation for all of its fields and
+     * no copies of the payloads. Fields past the bound are appended to the
+     * output as usual.
+     *
+     * flush_staged() must be called before the output is used.
+     */
+    void stage_small_writes(size_t bound) {
+        flush_staged();
+        _staged = ss::temporary_buffer<char>(bound);
+        _staged_begin = _staged_end = 0;
+    }
+
+    /// Links the staged fields not yet in the output into it
+    void flush_staged() {
+        if (_staged_end == _staged_begin) {
+            return;
+        }
+        _out->append(std::make_unique<iobuf::fragment>(
+          _staged.share(_staged_begin, _staged_end - _staged_begin)));
+        _staged_begin = _staged_end;
+    }
+
     uint32_t write(bool v) { return serialize_int<int8_t>(v); }
 
     uint32_t write(int8_t v) { return serialize_int<int8_t>(v); }
@@ -408,13 +470,13 @@ public:
 
     uint32_t write(std::string_view v) {
         auto size = serialize_int<int16_t>(v.size()) + v.size();
-        _out->append(v.data(), v.size());
+        append(v.data(), v.size());
         return size;
     }
 
     uint32_t write_flex(std::string_view v) {
         auto size = serialize_unsigned_vint(v.size() + 1) + v.size();
-        _out->append(v.data(), v.size());
+        append(v.data(), v.size());
         return size;
     }
 
@@ -454,7 +516,7 @@ public:
 
     uint32_t write(uuid uuid) {
         /// This type is not prepended with its size
-        _out->append(uuid.view().data(), uuid::length);
+        append(uuid.view().data(), uuid::length);
         return uuid::length;
     }
 
@@ -467,13 +529,13 @@ public:
 
     uint32_t write(bytes_view bv) {
         auto size = serialize_int<int32_t>(bv.size()) + bv.size();
-        _out->append(reinterpret_cast<const char*>(bv.data()), bv.size());
+        append(reinterpret_cast<const char*>(bv.data()), bv.size());
         return size;
     }
 
     uint32_t write_flex(bytes_view bv) {
         auto size = write_unsigned_varint(bv.size() + 1) + bv.size();
-        _out->append(reinterpret_cast<const char*>(bv.data()), bv.size());
+        append(reinterpret_cast<const char*>(bv.data()), bv.size());
         return size;
     }
 
@@ -485,7 +547,7 @@ public:
         }
         auto size = serialize_int<int32_t>(data->size_bytes())
                     + data->size_bytes();
-        _out->append(std::move(*data));
+        append(std::move(*data));
         return size;
     }
 
@@ -495,7 +557,7 @@ public:
         }
         auto size = write_unsigned_varint(data->size_bytes() + 1)
                     + data->size_bytes();
-        _out->append(std::move(*data));
+        append(std::move(*data));
         return size;
     }
 
@@ -530,7 +592,13 @@ public:
     // write bytes directly to output without a length prefix
     uint32_t write_direct(iobuf&& f) {
         auto size = f.size_bytes();
-        _out->append(std::move(f));
+        append(std::move(f));
+        return size;
+    }
+
+    /// Appends already encoded bytes without a size prefix.
+    uint32_t write_direct(const char* data, size_t size) {
+        append(data, size);
         return size;
     }
 
@@ -555,12 +623,12 @@ public:
         { writer(elem, rw) } -> std::same_as<void>;
     }
     uint32_t write_array(const C& v, ElementWriter&& writer) {
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         write(int32_t(v.size()));
         for (auto& elem : v) {
             writer(elem, *this);
         }
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
     template<typename C, typename ElementWriter>
     requires requires(
@@ -568,12 +636,12 @@ public:
         { writer(elem, rw) } -> std::same_as<void>;
     }
     uint32_t write_array(C& v, ElementWriter&& writer) {
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         write(int32_t(v.size()));
         for (auto& elem : v) {
             writer(elem, *this);
         }
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
 
     template<typename C, typename ElementWriter>
@@ -595,12 +663,12 @@ public:
         { writer(elem, rw) } -> std::same_as<void>;
     }
     uint32_t write_flex_array(C& v, ElementWriter&& writer) {
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         write_unsigned_varint(v.size() + 1);
         for (auto& elem : v) {
             writer(elem, *this);
         }
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
 
     template<typename C, typename ElementWriter>
@@ -624,10 +692,11 @@ public:
         { writer(rw) } -> std::same_as<bool>;
     }
     uint32_t write_bytes_wrapped(ElementWriter&& writer) {
+        flush_staged();
         auto ph = _out->reserve(sizeof(int32_t));
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         auto zero_len_is_null = writer(*this);
-        int32_t real_size = _out->size_bytes() - start_size;
+        int32_t real_size = size_bytes() - start_size;
         // enc_size: the size prefix in the serialization
         int32_t enc_size = real_size > 0 ? real_size
                                          : (zero_len_is_null ? -1 : 0);
@@ -641,25 +710,25 @@ public:
         if (!data) {
             return write(int32_t(-1));
         }
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         write(data->adapter.batch->size_bytes());
         writer_serialize_batch(*this, std::move(data->adapter.batch.value()));
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
 
     uint32_t write_flex(std::optional<produce_request_record_data>& data) {
         if (!data) {
             return write_unsigned_varint(0);
         }
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         write_unsigned_varint(data->adapter.batch->size_bytes() + 1);
         writer_serialize_batch(*this, std::move(data->adapter.batch.value()));
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
 
     // Only relevent when writing flex responses
     uint32_t write_tags(tagged_fields&& tags) {
-        auto start_size = uint32_t(_out->size_bytes());
+        auto start_size = uint32_t(size_bytes());
         const auto n = tags().size();
         write_unsigned_varint(n); // write total number of tags
         for (auto& [id, tag] : tags()) {
@@ -667,7 +736,7 @@ public:
             write_unsigned_varint(id);
             write_size_prepended(bytes_to_iobuf(tag));
         }
-        return _out->size_bytes() - start_size;
+        return size_bytes() - start_size;
     }
 
     // Currently used within our generator where we don't support writing any
@@ -680,12 +749,15 @@ public:
     uint32_t write_size_prepended(iobuf&& buf) {
         const auto size = write_unsigned_varint(buf.size_bytes())
                           + buf.size_bytes();
-        _out->append(std::move(buf));
+        append(std::move(buf));
         return size;
     }
 
 private:
     iobuf* _out;
+    ss::temporary_buffer<char> _staged;
+    size_t _staged_begin{0};
+    size_t _staged_end{0};
 };
 
 inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
@@ -709,20 +781,30 @@ inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
                 + internal::kafka_header_size - sizeof(int64_t)
                 - sizeof(int32_t);
 
-    w.write(int64_t(batch.base_offset()));
-    w.write(int32_t(size)); // batch length
-    w.write(
-      int32_t(leader_epoch_from_term(batch.term()))); // partition leader epoch
-    w.write(int8_t(2));                               // magic
-    w.write(batch.header().crc);
-    w.write(int16_t(batch.header().attrs.value()));
-    w.write(int32_t(batch.header().last_offset_delta));
-    w.write(int64_t(batch.header().first_timestamp.value()));
-    w.write(int64_t(batch.header().max_timestamp.value()));
-    w.write(int64_t(batch.header().producer_id));
-    w.write(int16_t(batch.header().producer_epoch));
-    w.write(int32_t(batch.header().base_sequence));
-    w.write(int32_t(batch.record_count()));
+    // The header is encoded into a contiguous buffer and appended at once
+    // rather than field by field. The record data that follows is appended
+    // by reference, so the records read from the log are never copied.
+    std::array<char, internal::kafka_header_size> hdr;
+    size_t pos = 0;
+    auto put = [&hdr, &pos]<typename T>(T v) {
+        auto nv = ss::cpu_to_be(v);
+        std::memcpy(hdr.data() + pos, &nv, sizeof(nv));
+        pos += sizeof(nv);
+    };
+    put(int64_t(batch.base_offset()));
+    put(int32_t(size));                                  // batch length
+    put(int32_t(leader_epoch_from_term(batch.term()))); // leader epoch
+    put(int8_t(2));                                      // magic
+    put(batch.header().crc);
+    put(int16_t(batch.header().attrs.value()));
+    put(int32_t(batch.header().last_offset_delta));
+    put(int64_t(batch.header().first_timestamp.value()));
+    put(int64_t(batch.header().max_timestamp.value()));
+    put(int64_t(batch.header().producer_id));
+    put(int16_t(batch.header().producer_epoch));
+    put(int32_t(batch.header().base_sequence));
+    put(int32_t(batch.record_count()));
+    w.write_direct(hdr.data(), hdr.size());
     w.write_direct(std::move(batch).release_data());
 }
 
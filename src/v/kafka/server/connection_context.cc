@@ -583,24 +583,44 @@ connection_context::record_tp_and_calculate_throttle(
         };
     }
 
+    // Throttle produce while the shard is CPU saturated
+    connection_context::delay_t cpu_delay;
+    if (r_data.request_key == produce_api::key) {
+        auto produce_cpu_delay = _server.cpu_controller().current_delay();
+        auto cpu_enforced = _throttling_state.update_cpu_delay(
+          produce_cpu_delay, now);
+        cpu_delay = delay_t{
+          .request = produce_cpu_delay,
+          .enforce = cpu_enforced,
+        };
+    }
+
     // Sum up
     const clock::duration delay_enforce = std::max(
-      {snc_delay.enforce, client_quota_delay.enforce, clock::duration::zero()});
+      {snc_delay.enforce,
+       client_quota_delay.enforce,
+       cpu_delay.enforce,
+       clock::duration::zero()});
     const clock::duration delay_request = std::max(
-      {snc_delay.request, client_quota_delay.request, clock::duration::zero()});
+      {snc_delay.request,
+       client_quota_delay.request,
+       cpu_delay.request,
+       clock::duration::zero()});
     if (
       delay_enforce != clock::duration::zero()
       || delay_request != clock::duration::zero()) {
         vlog(
           client_quota_log.trace,
-          "[{}:{}] throttle request:{{snc:{}, client:{}}}, "
-          "enforce:{{snc:{}, client:{}}}, key:{}, request_size:{}",
+          "[{}:{}] throttle request:{{snc:{}, client:{}, cpu:{}}}, "
+          "enforce:{{snc:{}, client:{}, cpu:{}}}, key:{}, request_size:{}",
           _client_addr,
           client_port(),
           snc_delay.request,
           client_quota_delay.request,
+          cpu_delay.request,
           snc_delay.enforce,
           client_quota_delay.enforce,
+          cpu_delay.enforce,
           r_data.request_key,
           request_size);
     }
@@ -639,7 +659,8 @@ ss::future<session_resources> connection_context::throttle_request(
     auto track = track_latency(r_data.request_key);
     session_resources r{
       .backpressure_delay = delay.request,
-      .memlocks = std::move(mem_units),
+      .memlocks = std::move(mem_units.server),
+      .budget_memlocks = std::move(mem_units.budget),
       .queue_units = std::move(qd_units),
       .tracker = std::move(tracker),
       .request_data = std::move(r_data)};
@@ -650,8 +671,7 @@ ss::future<session_resources> connection_context::throttle_request(
     co_return r;
 }
 
-ss::future<ssx::semaphore_units>
-connection_context::reserve_request_units(api_key key, size_t size) {
+size_t connection_context::request_memory_estimate(api_key key, size_t size) {
     // Defer to the handler for the request type for the memory estimate, but
     // if the request isn't found, use the default estimate (although in that
     // case the request is likely for an API we don't support or malformed, so
@@ -667,11 +687,21 @@ connection_context::reserve_request_units(api_key key, size_t size) {
           mem_estimate,
           handler ? (*handler)->name() : "<bad key>"));
     }
+    return mem_estimate;
+}
+
+ss::future<request_memory_units>
+connection_context::reserve_request_units(api_key key, size_t size) {
+    auto mem_estimate = request_memory_estimate(key, size);
+    // The budget is reserved first, requests which wait for it don't hold
+    // any of the memory shared with the other request types
+    auto budget = co_await _server.memory_budgets().reserve(key, mem_estimate);
     auto fut = ss::get_units(_server.memory(), mem_estimate);
     if (_server.memory().waiters()) {
         _server.probe().waiting_for_available_memory();
     }
-    return fut;
+    co_return request_memory_units{
+      .budget = std::move(budget), .server = co_await std::move(fut)};
 }
 
 ss::future<>
@@ -749,18 +779,31 @@ ss::future<> connection_context::virtual_connection_state::process_request(
   ss::lw_shared_ptr<connection_context> connection_ctx,
   request_context rctx,
   ss::lw_shared_ptr<session_resources> sres) {
-    auto u = co_await _lock.get_units();
+    // a single request larger than the budget must still make progress
+    auto queued = co_await ss::get_units(
+      _queued_bytes, std::min(sres->memlocks.count(), queued_bytes_budget));
     ssx::spawn_with_gate(
       connection_ctx->_gate,
       [this,
        rctx = std::move(rctx),
        sres,
-       u = std::move(u),
+       queued = std::move(queued),
        connection_ctx]() mutable {
-          _last_request_timestamp = ss::lowres_clock::now();
-          return _state
-            .process_request(std::move(connection_ctx), std::move(rctx), sres)
-            .finally([u = std::move(u)] {});
+          // the mutex grants units in order, so requests of this client are
+          // still processed in the order they were read
+          return _lock.get_units().then(
+            [this,
+             rctx = std::move(rctx),
+             sres = std::move(sres),
+             queued = std::move(queued),
+             connection_ctx = std::move(connection_ctx)](auto u) mutable {
+                queued.return_all();
+                _last_request_timestamp = ss::lowres_clock::now();
+                return _state
+                  .process_request(
+                    std::move(connection_ctx), std::move(rctx), sres)
+                  .finally([u = std::move(u)] {});
+            });
       });
 }
 
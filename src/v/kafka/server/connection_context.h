@@ -10,6 +10,7 @@
  */
 #pragma once
 #include "base/seastarx.h"
+#include "base/units.h"
 #include "config/property.h"
 #include "container/chunked_hash_map.h"
 #include "kafka/server/fwd.h"
@@ -106,6 +107,11 @@ struct request_data {
     std::optional<ss::sstring> client_id;
 };
 
+struct request_memory_units {
+    ssx::semaphore_units budget;
+    ssx::semaphore_units server;
+};
+
 // Used to hold resources associated with a given request until
 // the response has been send, as well as to track some statistics
 // about the request.
@@ -118,6 +124,9 @@ struct session_resources {
 
     ss::lowres_clock::duration backpressure_delay;
     ssx::semaphore_units memlocks;
+    // units of the memory budget of the request type, see
+    // request_memory_budgets
+    ssx::semaphore_units budget_memlocks;
     ssx::semaphore_units queue_units;
     std::unique_ptr<log_hist_internal::measurement> method_latency;
     std::unique_ptr<handler_probe::hist_t::measurement> handler_latency;
@@ -217,10 +226,13 @@ private:
 
     bool is_finished_parsing() const;
 
-    // Reserve units from memory from the memory semaphore in proportion
-    // to the number of bytes the request procesisng is expected to
-    // take.
-    ss::future<ssx::semaphore_units>
+    // Number of bytes the processing of a request of \p size bytes is
+    // expected to take.
+    size_t request_memory_estimate(api_key key, size_t size);
+
+    // Reserve units of the memory estimate from the budget of the request
+    // type and then from the memory semaphore.
+    ss::future<request_memory_units>
     reserve_request_units(api_key key, size_t size);
 
     /// Calculated throttle delay pair.
@@ -406,11 +418,16 @@ private:
          * of order but for each client only one request may be processed at the
          * time.
          *
+         * Requests arriving while a previous one of the same client is still
+         * in its first phase are queued behind it in the background, so that a
+         * busy client doesn't stall the other clients multiplexed on the same
+         * connection.
+         *
          * NOTE: to propagate backpressure and being able to control the
-         * resource usage, only one first phase of a request at a time is
-         * allowed to be processed by a client. If a previously dispatched
-         * request first phase didn't finished the next request dispatch will
-         * block processing requests for the whole connection.
+         * resource usage, a client may only queue up to
+         * `queued_bytes_budget` of requests (as accounted by their
+         * session_resources). A request going over it blocks processing
+         * requests for the whole connection until the queue drains.
          */
         ss::future<> process_request(
           ss::lw_shared_ptr<connection_context>,
@@ -418,11 +435,18 @@ private:
           ss::lw_shared_ptr<session_resources>);
 
     private:
+        static constexpr size_t queued_bytes_budget = 4_MiB;
+
         client_protocol_state _state;
         /**
          * Mutex is used to control concurrency per virtual connection.
          */
         mutex _lock{"virtual_connection_state::lock"};
+        /**
+         * Memory of the requests waiting for _lock
+         */
+        ssx::semaphore _queued_bytes{
+          queued_bytes_budget, "virtual_connection_state::queued_bytes"};
         ss::lowres_clock::time_point _last_request_timestamp;
     };
 
@@ -452,7 +476,16 @@ private:
             return result_enforced;
         }
 
+        ss::lowres_clock::duration update_cpu_delay(
+          ss::lowres_clock::duration new_delay,
+          ss::lowres_clock::time_point now) {
+            auto result_enforced = cpu_throttled_until - now;
+            cpu_throttled_until = now + new_delay;
+            return result_enforced;
+        }
+
     private:
+        ss::lowres_clock::time_point cpu_throttled_until;
         ss::lowres_clock::time_point snc_throttled_until;
         ss::lowres_clock::time_point produce_throttled_until;
         ss::lowres_clock::time_point fetch_throttled_until;
@@ -15,6 +15,8 @@
 #include "model/ktp.h"
 #include "model/timeout_clock.h"
 
+#include <seastar/core/smp.hh>
+
 #include <absl/container/flat_hash_map.h>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/transform_iterator.hpp>
@@ -31,6 +33,17 @@ struct fetch_session_partition {
     model::offset last_stable_offset;
     kafka::leader_epoch current_leader_epoch = invalid_leader_epoch;
 
+    struct cached_shard {
+        ss::shard_id shard;
+        uint64_t shard_table_version;
+    };
+    /**
+     * Shard owning the partition, as resolved by the fetch planner. Session
+     * partitions outlive a single request, so incremental fetches reuse the
+     * lookup until the shard table changes.
+     */
+    mutable std::optional<cached_shard> shard;
+
     fetch_session_partition(
       const model::topic& tp, const fetch_request::partition& p)
       : topic_partition(tp, p.partition_index)
@@ -110,6 +110,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -124,6 +125,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -147,6 +149,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -167,6 +170,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -2134,8 +2138,7 @@ kafka::error_code map_store_offset_error_code(std::error_code ec) {
     return error_code::unknown_server_error;
 }
 
-void group::update_store_offset_builder(
-  cluster::simple_batch_builder& builder,
+group_metadata_serializer::key_value group::make_store_offset_kv(
   const model::topic& name,
   model::partition_id partition,
   model::offset committed_offset,
@@ -2157,14 +2160,12 @@ void group::update_store_offset_builder(
         value.expiry_timestamp = expiry_timestamp.value();
     }
 
-    auto kv = _md_serializer.to_kv(
+    return _md_serializer.to_kv(
       offset_metadata_kv{.key = std::move(key), .value = std::move(value)});
-    builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
 }
 
 group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
-    cluster::simple_batch_builder builder(
-      model::record_batch_type::raft_data, model::offset(0));
+    offset_commit_batcher::records_t records;
 
     std::vector<std::pair<model::topic_partition, offset_metadata>>
       offset_commits;
@@ -2188,15 +2189,14 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
     for (const auto& t : r.data.topics) {
         for (const auto& p : t.partitions) {
             const auto commit_timestamp = get_commit_timestamp(p);
-            update_store_offset_builder(
-              builder,
+            records.push_back(make_store_offset_kv(
               t.name,
               p.partition_index,
               p.committed_offset,
               p.committed_leader_epoch,
               p.committed_metadata.value_or(""),
               commit_timestamp,
-              expiry_timestamp);
+              expiry_timestamp));
 
             model::topic_partition tp(t.name, p.partition_index);
 
@@ -2223,16 +2223,15 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
             _pending_offset_commits[tp] = md;
         }
     }
-    if (builder.empty()) {
+    if (records.empty()) {
         vlog(_ctxlog.debug, "Empty offsets committed request");
         return offset_commit_stages(
           offset_commit_response(r, error_code::none));
     }
 
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      chunked_vector<model::record_batch>::single(std::move(builder).build()),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    // commits of all the groups of the partition are coalesced into shared
+    // batches, the result carries the offset of the last record of this commit
+    auto replicate_stages = _commit_batcher->append(_term, std::move(records));
 
     auto f = replicate_stages.replicate_finished.then(
       [this, req = std::move(r), commits = std::move(offset_commits)](
@@ -2456,32 +2455,36 @@ group::handle_offset_fetch(offset_fetch_request&& r) {
 
     // retrieve all topics available
     if (!r.data.topics) {
-        absl::flat_hash_map<
-          model::topic,
-          small_fragment_vector<offset_fetch_response_partition>>
-          tmp;
-        for (const auto& e : _offsets) {
-            offset_fetch_response_partition p = {
-              .partition_index = e.first.partition,
-              .committed_offset = model::offset(-1),
-              .metadata = "",
-              .error_code = error_code::none,
-            };
-
-            if (r.data.require_stable && has_pending_transaction(e.first)) {
-                p.error_code = error_code::unstable_offset_commit;
-            } else {
-                p.committed_offset = e.second->metadata.offset;
-                p.committed_leader_epoch
-                  = e.second->metadata.committed_leader_epoch;
-                p.metadata = e.second->metadata.metadata;
-            }
-            tmp[e.first.topic].push_back(std::move(p));
-        }
-
-        for (auto& e : tmp) {
-            resp.data.topics.push_back(
-              {.name = e.first, .partitions = std::move(e.second)});
+        resp.data.topics.reserve(_offsets.topics().size());
+        for (const auto& entry : _offsets.topics()) {
+            const auto& topic = entry.first;
+            const auto& partitions = entry.second;
+            offset_fetch_response_topic t{.name = topic};
+            t.partitions.reserve(partitions.size());
+            partitions.for_each([&](
+                                  model::partition_id id,
+                                  const offset_metadata_with_probe& o) {
+                offset_fetch_response_partition p = {
+                  .partition_index = id,
+                  .committed_offset = model::offset(-1),
+                  .metadata = "",
+                  .error_code = error_code::none,
+                };
+
+                if (
+                  r.data.require_stable
+                  && has_pending_transaction(
+                    model::topic_partition(topic, id))) {
+                    p.error_code = error_code::unstable_offset_commit;
+                } else {
+                    p.committed_offset = o.metadata.offset;
+                    p.committed_leader_epoch
+                      = o.metadata.committed_leader_epoch;
+                    p.metadata = o.metadata.metadata;
+                }
+                t.partitions.push_back(std::move(p));
+            });
+            resp.data.topics.push_back(std::move(t));
         }
 
         return ss::make_ready_future<offset_fetch_response>(std::move(resp));
@@ -2491,9 +2494,9 @@ group::handle_offset_fetch(offset_fetch_request&& r) {
     for (const auto& topic : *r.data.topics) {
         offset_fetch_response_topic t;
         t.name = topic.name;
+        // the topic is looked up once for all the requested partitions
+        const auto* partitions = _offsets.find(topic.name);
         for (auto id : topic.partition_indexes) {
-            model::topic_partition tp(topic.name, id);
-
             offset_fetch_response_partition p = {
               .partition_index = id,
               .committed_offset = model::offset(-1),
@@ -2501,16 +2504,17 @@ group::handle_offset_fetch(offset_fetch_request&& r) {
               .error_code = error_code::none,
             };
 
-            if (r.data.require_stable && has_pending_transaction(tp)) {
+            if (
+              r.data.require_stable
+              && has_pending_transaction(
+                model::topic_partition(topic.name, id))) {
                 p.error_code = error_code::unstable_offset_commit;
-            } else {
-                auto res = offset(tp);
-                if (res) {
-                    p.partition_index = id;
-                    p.committed_offset = res->offset;
-                    p.committed_leader_epoch = res->committed_leader_epoch;
-                    p.metadata = res->metadata;
-                    p.error_code = error_code::none;
+            } else if (partitions) {
+                if (const auto* o = partitions->find(id); o) {
+                    p.committed_offset = o->metadata.offset;
+                    p.committed_leader_epoch
+                      = o->metadata.committed_leader_epoch;
+                    p.metadata = o->metadata.metadata;
                 }
             }
             t.partitions.push_back(std::move(p));
@@ -2601,9 +2605,13 @@ ss::future<error_code> group::remove() {
     storage::record_batch_builder builder(
       model::record_batch_type::raft_data, model::offset(0));
 
-    for (auto& offset : _offsets) {
-        add_offset_tombstone_record(_id, offset.first, builder);
-    }
+    _offsets.for_each([this, &builder](
+                        const model::topic& topic,
+                        model::partition_id id,
+                        const offset_metadata_with_probe&) {
+        add_offset_tombstone_record(
+          _id, model::topic_partition(topic, id), builder);
+    });
 
     // build group tombstone
     add_group_tombstone_record(_id, builder);
@@ -2653,8 +2661,7 @@ ss::future<> group::remove_topic_partitions(
     for (const auto& tp : tps) {
         _pending_offset_commits.erase(tp);
         if (auto offset = _offsets.extract(tp); offset) {
-            removed.emplace_back(
-              std::move(offset->first), std::move(offset->second->metadata));
+            removed.emplace_back(tp, std::move(offset->metadata));
         }
     }
 
@@ -2675,7 +2682,7 @@ ss::future<> group::remove_topic_partitions(
         co_return;
     }
 
-    _offsets.rehash(0);
+    _offsets.shrink_to_fit();
     _pending_offset_commits.rehash(0);
 
     // build offset tombstones
@@ -3445,41 +3452,49 @@ std::vector<model::topic_partition> group::filter_expired_offsets(
 
     const auto now = model::timestamp::now();
     std::vector<model::topic_partition> offsets;
-    for (const auto& offset : _offsets) {
-        if (offset.second->metadata.non_reclaimable) {
-            continue;
-        }
-
+    for (const auto& entry : _offsets.topics()) {
+        const auto& topic = entry.first;
+        const auto& partitions = entry.second;
         /*
          * an offset won't be removed if its topic has an active subscription or
          * there are pending offset commits for the offset's topic.
          */
-        if (
-          subscribed(offset.first.topic)
-          || _pending_offset_commits.contains(offset.first)) {
+        if (subscribed(topic)) {
             continue;
         }
+        partitions.for_each([&](
+                              model::partition_id id,
+                              const offset_metadata_with_probe& o) {
+            const auto& md = o.metadata;
+            if (md.non_reclaimable) {
+                return;
+            }
 
-        if (offset.second->metadata.expiry_timestamp.has_value()) {
-            /*
-             * the old way is explicit expiration time point per offset
-             */
-            const auto& expires
-              = offset.second->metadata.expiry_timestamp.value();
-            if (expires > now) {
-                continue;
+            model::topic_partition tp(topic, id);
+            if (_pending_offset_commits.contains(tp)) {
+                return;
             }
-        } else {
-            /*
-             * the new way is a configurable global retention duration
-             */
-            const auto expires = effective_expires(offset.second->metadata);
-            if (model::timestamp(now() - expires()) < retain_for) {
-                continue;
+
+            if (md.expiry_timestamp.has_value()) {
+                /*
+                 * the old way is explicit expiration time point per offset
+                 */
+                const auto& expires = md.expiry_timestamp.value();
+                if (expires > now) {
+                    return;
+                }
+            } else {
+                /*
+                 * the new way is a configurable global retention duration
+                 */
+                const auto expires = effective_expires(md);
+                if (model::timestamp(now() - expires()) < retain_for) {
+                    return;
+                }
             }
-        }
 
-        offsets.push_back(offset.first);
+            offsets.push_back(std::move(tp));
+        });
     }
 
     return offsets;
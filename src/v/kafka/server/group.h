@@ -23,6 +23,8 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/group_probe.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
+#include "kafka/server/offset_table.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/timestamp.h"
@@ -254,6 +256,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -267,6 +270,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -578,8 +582,8 @@ public:
 
     std::optional<offset_metadata>
     offset(const model::topic_partition& tp) const {
-        if (auto it = _offsets.find(tp); it != _offsets.end()) {
-            return it->second->metadata;
+        if (auto o = _offsets.find(tp); o) {
+            return o->metadata;
         }
         return std::nullopt;
     }
@@ -627,26 +631,26 @@ public:
     handle_offset_fetch(offset_fetch_request&& r);
 
     void insert_offset(model::topic_partition tp, offset_metadata md) {
-        if (auto o_it = _offsets.find(tp); o_it != _offsets.end()) {
-            o_it->second->metadata = std::move(md);
+        if (auto o = _offsets.find(tp); o) {
+            o->metadata = std::move(md);
         } else {
-            _offsets.emplace(
-              std::move(tp),
+            _offsets.insert(
+              tp,
               std::make_unique<offset_metadata_with_probe>(
                 std::move(md), _id, tp, _enable_group_metrics));
         }
     }
 
     bool try_upsert_offset(model::topic_partition tp, offset_metadata md) {
-        if (auto o_it = _offsets.find(tp); o_it != _offsets.end()) {
-            if (o_it->second->metadata.log_offset < md.log_offset) {
-                o_it->second->metadata = std::move(md);
+        if (auto o = _offsets.find(tp); o) {
+            if (o->metadata.log_offset < md.log_offset) {
+                o->metadata = std::move(md);
                 return true;
             }
             return false;
         } else {
-            _offsets.emplace(
-              std::move(tp),
+            _offsets.insert(
+              tp,
               std::make_unique<offset_metadata_with_probe>(
                 std::move(md), _id, tp, _enable_group_metrics));
             return true;
@@ -866,8 +870,7 @@ private:
         return false;
     }
 
-    void update_store_offset_builder(
-      cluster::simple_batch_builder& builder,
+    group_metadata_serializer::key_value make_store_offset_kv(
       const model::topic& name,
       model::partition_id partition,
       model::offset commited_offset,
@@ -940,14 +943,9 @@ private:
     config::configuration& _conf;
     ss::lw_shared_ptr<ssx::rwlock> _catchup_lock;
     ss::lw_shared_ptr<cluster::partition> _partition;
-    chunked_hash_map<
-      model::topic_partition,
-      std::unique_ptr<offset_metadata_with_probe>>
-      _offsets;
-    group_probe<
-      model::topic_partition,
-      std::unique_ptr<offset_metadata_with_probe>>
-      _probe;
+    ss::lw_shared_ptr<offset_commit_batcher> _commit_batcher;
+    offset_table<offset_metadata_with_probe> _offsets;
+    group_probe<offset_table<offset_metadata_with_probe>> _probe;
     ctx_log _ctxlog;
     ctx_log _ctx_txlog;
     group_metadata_serializer _md_serializer;
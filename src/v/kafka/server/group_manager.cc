@@ -58,6 +58,10 @@ group_manager::attached_partition::attached_partition(
   : loading(true)
   , partition(std::move(p)) {
     catchup_lock = ss::make_lw_shared<ssx::rwlock>();
+    commit_batcher = ss::make_lw_shared<offset_commit_batcher>(
+      partition,
+      config::shard_local_cfg()
+        .group_offset_commit_coalescing_window_ms.bind());
 }
 
 group_manager::attached_partition::~attached_partition() noexcept = default;
@@ -81,7 +85,9 @@ group_manager::group_manager(
   , _conf(config::shard_local_cfg())
   , _self(cluster::make_self_broker(config::node()))
   , _enable_group_metrics(enable_metrics)
-  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind()) {}
+  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind())
+  , _recovery_snapshot_interval(
+      _conf.kafka_group_recovery_snapshot_interval_ms.bind()) {}
 
 ss::future<> group_manager::start() {
     /*
@@ -152,6 +158,40 @@ ss::future<> group_manager::start() {
         }
     });
 
+    /*
+     * periodically replay the committed log of the partitions this node
+     * follows, so that recovery after a leadership change only has to
+     * read the tail of the log.
+     */
+    _recovery_snapshot_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return update_recovery_snapshots().finally([this] {
+                if (!_gate.is_closed() && _recovery_snapshot_interval()) {
+                    _recovery_snapshot_timer.arm(
+                      *_recovery_snapshot_interval());
+                }
+            });
+        });
+    });
+    if (_recovery_snapshot_interval()) {
+        _recovery_snapshot_timer.arm(*_recovery_snapshot_interval());
+    }
+
+    _recovery_snapshot_interval.watch([this] {
+        if (!_recovery_snapshot_interval()) {
+            _recovery_snapshot_timer.cancel();
+            for (auto& [_, p] : _partitions) {
+                p->recovery_snapshot.reset();
+            }
+            return;
+        }
+        // an update in progress re-arms the timer once finished
+        if (_recovery_snapshot_timer.armed()) {
+            _recovery_snapshot_timer.cancel();
+        }
+        _recovery_snapshot_timer.arm(*_recovery_snapshot_interval());
+    });
+
     return ss::make_ready_future<>();
 }
 /*
@@ -404,13 +444,19 @@ ss::future<> group_manager::stop() {
     }
 
     _timer.cancel();
+    _recovery_snapshot_timer.cancel();
 
     return _gate.close().then([this]() {
         /**
          * cancel all pending group opeartions
          */
         return ss::do_for_each(
-                 _groups, [](auto& p) { return p.second->shutdown(); })
+                 _partitions,
+                 [](auto& p) { return p.second->commit_batcher->stop(); })
+          .then([this] {
+              return ss::do_for_each(
+                _groups, [](auto& p) { return p.second->shutdown(); });
+          })
           .then([this] { _partitions.clear(); });
     });
 }
@@ -447,6 +493,7 @@ ss::future<> group_manager::do_detach_partition(model::ntp ntp) {
     if (!p->as.abort_requested()) {
         p->as.request_abort();
     }
+    co_await p->commit_batcher->stop();
     _partitions.erase(ntp);
     _partitions.rehash(0);
 
@@ -616,6 +663,100 @@ group_manager::gc_partition_state(ss::lw_shared_ptr<attached_partition> p) {
     co_await shutdown_groups(std::move(groups_for_shutdown));
 }
 
+ss::future<> group_manager::update_recovery_snapshots() {
+    // a copy as partitions may be detached while we are working
+    fragmented_vector<ss::lw_shared_ptr<attached_partition>> partitions;
+    for (auto& [_, p] : _partitions) {
+        partitions.push_back(p);
+    }
+    for (auto& p : partitions) {
+        if (_gate.is_closed() || !_recovery_snapshot_interval()) {
+            break;
+        }
+        if (p->as.abort_requested()) {
+            continue;
+        }
+        try {
+            co_await update_recovery_snapshot(p);
+        } catch (...) {
+            auto e = std::current_exception();
+            if (!ssx::is_shutdown_exception(e)) {
+                vlog(
+                  klog.warn,
+                  "error updating group recovery snapshot of {} - {}",
+                  p->partition->ntp(),
+                  e);
+            }
+            p->recovery_snapshot.reset();
+        }
+    }
+}
+
+ss::future<> group_manager::update_recovery_snapshot(
+  ss::lw_shared_ptr<attached_partition> p) {
+    // serialized with the leadership changes of the partition
+    auto units = co_await ss::get_units(p->sem, 1, p->as);
+    if (p->partition->is_leader() || p->loading) {
+        // the state of the leader lives in the groups
+        co_return;
+    }
+
+    auto snapshot = take_recovery_snapshot(p);
+    // the committed prefix of the log is never truncated
+    const auto committed = p->partition->committed_offset();
+    const auto start = snapshot ? model::next_offset(snapshot->last_read_offset)
+                                : p->partition->raft_start_offset();
+    if (start > committed) {
+        p->recovery_snapshot = std::move(snapshot);
+        co_return;
+    }
+
+    storage::log_reader_config reader_config(
+      start,
+      committed,
+      0,
+      std::numeric_limits<size_t>::max(),
+      kafka_read_priority(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+    auto reader = co_await p->partition->make_reader(reader_config);
+    auto state = co_await std::move(reader).consume(
+      snapshot ? group_recovery_consumer(
+                   _serializer_factory(), p->as, std::move(*snapshot))
+               : group_recovery_consumer(_serializer_factory(), p->as),
+      model::no_timeout);
+    if (p->as.abort_requested() || state.last_read_offset < start) {
+        co_return;
+    }
+    vlog(
+      klog.debug,
+      "Updated group recovery snapshot of {} with {} groups up to {}",
+      p->partition->ntp(),
+      state.groups.size(),
+      state.last_read_offset);
+    p->recovery_snapshot = std::move(state);
+}
+
+std::optional<group_recovery_consumer_state>
+group_manager::take_recovery_snapshot(ss::lw_shared_ptr<attached_partition> p) {
+    auto snapshot = std::exchange(p->recovery_snapshot, std::nullopt);
+    if (
+      snapshot
+      && model::next_offset(snapshot->last_read_offset)
+           < p->partition->raft_start_offset()) {
+        // the log was prefix truncated past the snapshot, e.g. when the
+        // follower was recovered from a raft snapshot
+        vlog(
+          klog.debug,
+          "Dropping stale group recovery snapshot of {} at {}",
+          p->partition->ntp(),
+          snapshot->last_read_offset);
+        return std::nullopt;
+    }
+    return snapshot;
+}
+
 ss::future<> group_manager::reload_groups() {
     std::vector<ss::future<>> futures;
     for (auto& [ntp, attached] : _partitions) {
@@ -677,10 +818,14 @@ ss::future<group_offsets_snapshot_result> group_manager::snapshot_groups(
           model::topic,
           fragmented_vector<group_offsets::partition_offset>>
           offsets;
-        for (const auto& [tp, o] : group->offsets()) {
-            offsets[tp.topic].emplace_back(
-              tp.partition, model::offset_cast(o->metadata.offset));
-        }
+        group->offsets().for_each(
+          [&offsets](
+            const model::topic& topic,
+            model::partition_id id,
+            const auto& o) {
+              offsets[topic].emplace_back(
+                id, model::offset_cast(o.metadata.offset));
+          });
         for (auto& [t, ps] : offsets) {
             go.offsets.emplace_back(t, std::move(ps));
         }
@@ -839,10 +984,30 @@ ss::future<> group_manager::handle_partition_leader_change(
                  * the full log is read and deduplicated. the dedupe
                  * processing is based on the record keys, so this code
                  * should be ready to transparently take advantage of
-                 * key-based compaction in the future.
+                 * key-based compaction in the future. if the partition was
+                 * followed by this node the recovery resumes from the
+                 * snapshot of the committed prefix of the log.
                  */
+                auto snapshot = take_recovery_snapshot(p);
+                const auto start_offset
+                  = snapshot ? model::next_offset(snapshot->last_read_offset)
+                             : p->partition->raft_start_offset();
+                auto consumer
+                  = snapshot ? group_recovery_consumer(
+                                 _serializer_factory(),
+                                 p->as,
+                                 std::move(*snapshot))
+                             : group_recovery_consumer(
+                                 _serializer_factory(), p->as);
+                if (snapshot) {
+                    vlog(
+                      klog.info,
+                      "Recovering groups of {} from snapshot at {}",
+                      p->partition->ntp(),
+                      start_offset);
+                }
                 storage::log_reader_config reader_config(
-                  p->partition->raft_start_offset(),
+                  start_offset,
                   model::model_limits<model::offset>::max(),
                   0,
                   std::numeric_limits<size_t>::max(),
@@ -853,12 +1018,15 @@ ss::future<> group_manager::handle_partition_leader_change(
                 auto expected_to_read = model::prev_offset(
                   p->partition->high_watermark());
                 return p->partition->make_reader(reader_config)
-                  .then([this, term, p, timeout, expected_to_read](
-                          model::record_batch_reader reader) {
+                  .then([this,
+                         term,
+                         p,
+                         timeout,
+                         expected_to_read,
+                         consumer = std::move(consumer)](
+                          model::record_batch_reader reader) mutable {
                       return std::move(reader)
-                        .consume(
-                          group_recovery_consumer(_serializer_factory(), p->as),
-                          timeout)
+                        .consume(std::move(consumer), timeout)
                         .then([this, term, p, expected_to_read](
                                 group_recovery_consumer_state state) {
                             if (state.last_read_offset < expected_to_read) {
@@ -947,6 +1115,7 @@ ss::future<> group_manager::do_recover_group(
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               term,
               _tx_frontend,
               _feature_table,
@@ -1157,6 +1326,7 @@ group::join_group_stages group_manager::join_group(join_group_request&& r) {
           _conf,
           it->second->catchup_lock,
           p,
+          it->second->commit_batcher,
           it->second->term,
           _tx_frontend,
           _feature_table,
@@ -1310,6 +1480,7 @@ group_manager::txn_offset_commit(txn_offset_commit_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1406,6 +1577,7 @@ group_manager::begin_tx(cluster::begin_group_tx_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1481,6 +1653,7 @@ group_manager::offset_commit(offset_commit_request&& r) {
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               p->term,
               _tx_frontend,
               _feature_table,
@@ -238,7 +238,14 @@ private:
         ss::abort_source as;
         ss::lw_shared_ptr<cluster::partition> partition;
         ss::lw_shared_ptr<ssx::rwlock> catchup_lock;
+        ss::lw_shared_ptr<offset_commit_batcher> commit_batcher;
         model::term_id term{-1};
+        /*
+         * group state replayed from the committed prefix of the log while the
+         * partition is a follower. when the partition becomes a leader the
+         * recovery resumes from it and reads only the tail of the log.
+         */
+        std::optional<group_recovery_consumer_state> recovery_snapshot;
 
         explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p);
         ~attached_partition() noexcept;
@@ -281,6 +288,12 @@ private:
 
     ss::future<> gc_partition_state(ss::lw_shared_ptr<attached_partition>);
 
+    ss::future<> update_recovery_snapshots();
+    ss::future<>
+      update_recovery_snapshot(ss::lw_shared_ptr<attached_partition>);
+    std::optional<group_recovery_consumer_state>
+      take_recovery_snapshot(ss::lw_shared_ptr<attached_partition>);
+
     ss::future<std::error_code> inject_noop(
       ss::lw_shared_ptr<cluster::partition> p,
       ss::lowres_clock::time_point timeout);
@@ -303,6 +316,7 @@ private:
     std::optional<bool> _prev_offset_retention_enabled;
 
     ss::timer<> _timer;
+    ss::timer<> _recovery_snapshot_timer;
     ss::future<> handle_offset_expiration();
     ss::future<size_t> delete_expired_offsets(group_ptr, std::chrono::seconds);
     ss::sharded<raft::group_manager>& _gm;
@@ -320,6 +334,8 @@ private:
     model::broker _self;
     enable_group_metrics _enable_group_metrics;
     config::binding<std::chrono::milliseconds> _offset_retention_check;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _recovery_snapshot_interval;
 };
 
 } // namespace kafka
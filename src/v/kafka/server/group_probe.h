@@ -89,12 +89,12 @@ private:
     metrics::public_metric_groups _public_metrics;
 };
 
-template<typename KeyType, typename ValType>
+template<typename OffsetsTable>
 class group_probe {
     using member_map = absl::node_hash_map<kafka::member_id, member_ptr>;
     using static_member_map
       = chunked_hash_map<kafka::group_instance_id, kafka::member_id>;
-    using offsets_map = chunked_hash_map<KeyType, ValType>;
+    using offsets_map = OffsetsTable;
 
 public:
     explicit group_probe(
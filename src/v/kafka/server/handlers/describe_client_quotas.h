@@ -15,6 +15,6 @@
 namespace kafka {
 
 using describe_client_quotas_handler
-  = single_stage_handler<describe_client_quotas_api, 0, 1>;
+  = concurrent_handler<describe_client_quotas_api, 0, 1>;
 
 }
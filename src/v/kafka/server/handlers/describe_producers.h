@@ -16,6 +16,6 @@
 namespace kafka {
 
 using describe_producers_handler
-  = single_stage_handler<describe_producers_api, 0, 0>;
+  = concurrent_handler<describe_producers_api, 0, 0>;
 
 }
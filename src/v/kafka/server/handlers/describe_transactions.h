@@ -15,6 +15,6 @@
 namespace kafka {
 
 using describe_transactions_handler
-  = single_stage_handler<describe_transactions_api, 0, 0>;
+  = concurrent_handler<describe_transactions_api, 0, 0>;
 
 }
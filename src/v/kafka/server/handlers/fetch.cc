@@ -49,6 +49,7 @@
 #include <seastar/core/thread.hh>
 #include <seastar/core/timer.hh>
 #include <seastar/core/with_scheduling_group.hh>
+#include <seastar/util/later.hh>
 #include <seastar/util/log.hh>
 
 #include <boost/range/irange.hpp>
@@ -113,9 +114,13 @@ static ss::future<read_result> read_from_partition(
     std::unique_ptr<iobuf> data;
     std::vector<cluster::tx::tx_range> aborted_transactions;
     std::optional<std::chrono::milliseconds> delta_from_tip_ms;
+    const auto read_start = std::chrono::steady_clock::now();
+    std::chrono::microseconds read_time{0};
     try {
         auto result = co_await rdr.reader.consume(
           kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
+        read_time = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - read_start);
         data = std::make_unique<iobuf>(std::move(result.data));
         part.probe().add_records_fetched(result.record_count);
         part.probe().add_bytes_fetched(data->size_bytes());
@@ -167,23 +172,23 @@ static ss::future<read_result> read_from_partition(
         std::rethrow_exception(e);
     }
 
+    read_result::variant_t result_data;
     if (foreign_read) {
-        co_return read_result(
-          ss::make_foreign<read_result::data_t>(std::move(data)),
-          start_o,
-          hw,
-          lso,
-          delta_from_tip_ms,
-          std::move(aborted_transactions));
+        result_data = ss::make_foreign<read_result::data_t>(std::move(data));
+    } else {
+        result_data = std::move(data);
     }
 
-    co_return read_result(
-      std::move(data),
+    read_result res(
+      std::move(result_data),
       start_o,
       hw,
       lso,
       delta_from_tip_ms,
       std::move(aborted_transactions));
+    res.from_cloud = rdr.from_cloud;
+    res.read_time = read_time;
+    co_return res;
 }
 
 read_result::memory_units_t::memory_units_t(
@@ -623,6 +628,10 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
             read_probe.add_read_event_delta_from_tip(
               r.delta_from_tip_ms.value());
         }
+        if (r.error == error_code::none && r.has_data()) {
+            read_probe.add_read(
+              r.from_cloud, r.data_size_bytes(), r.read_time);
+        }
     }
     vlog(
       klog.trace,
@@ -865,6 +874,42 @@ private:
         };
     }
 
+    // A read_committed request never returns data at or above the LSO, so
+    // appends of a transaction which is still open don't make the request
+    // readable. Returns true if the request at `i` is parked behind such a
+    // transaction.
+    bool blocked_by_lso(const cluster::partition& part, size_t i) const {
+        const auto& cfg = _ctx.requests[i].cfg;
+        if (
+          cfg.isolation_level != model::isolation_level::read_committed
+          || !config::shard_local_cfg().enable_transactions.value()) {
+            return false;
+        }
+        auto lso = part.last_stable_offset();
+        return lso >= model::offset{0} && lso <= cfg.start_offset;
+    }
+
+    // Resolves once the last visible index of the partition reaches `offset`
+    // and, for read_committed requests, once the LSO moved past the fetch
+    // offset. Waking up and re-reading the partition on every append to an
+    // open transaction would only spin on data which can't be returned.
+    ss::future<> wait_for_readable(
+      ss::lw_shared_ptr<cluster::partition> part,
+      cluster::consensus_ptr consensus,
+      size_t i,
+      model::offset offset) {
+        for (;;) {
+            co_await consensus->visible_offset_monitor().wait(
+              offset, model::no_timeout, _as);
+            if (_as.abort_requested() || !blocked_by_lso(*part, i)) {
+                co_return;
+            }
+            // The LSO only advances when the transaction ends, the commit or
+            // abort marker bumps the last visible index and ends the wait.
+            offset = model::next_offset(consensus->last_visible_index());
+        }
+    }
+
     // Registers a `visible_offset_monitor` waiter for every index in
     // `request_indexes`
     //
@@ -887,8 +932,8 @@ private:
             }
 
             auto offset = model::next_offset(_last_visible_indexes[i]);
-            auto waiter = consensus->visible_offset_monitor()
-                            .wait(offset, model::no_timeout, _as)
+            auto waiter = wait_for_readable(
+                            std::move(part), std::move(consensus), i, offset)
                             // All exceptions are ignored here as this is only
                             // used to signal the worker that another attempt to
                             // read the partition should be made.
@@ -998,6 +1043,11 @@ private:
             }
 
             co_await _completed_waiter_count.wait();
+            // A single append usually completes waiters of several partitions
+            // of the fetch on this shard. Let the other ready waiters run
+            // before re-reading so they are served by one query instead of
+            // one query each.
+            co_await ss::yield();
 
             if (_as.abort_requested()) {
                 co_return worker_result{
@@ -1314,6 +1364,22 @@ void op_context::for_each_fetch_partition(Func&& f) const {
     }
 }
 
+namespace {
+std::optional<ss::shard_id>
+shard_for(cluster::shard_table& shards, const fetch_session_partition& fp) {
+    const auto version = shards.version();
+    if (fp.shard && fp.shard->shard_table_version == version) {
+        return fp.shard->shard;
+    }
+    auto shard = shards.shard_for(fp.topic_partition);
+    if (shard) {
+        fp.shard = fetch_session_partition::cached_shard{
+          .shard = *shard, .shard_table_version = version};
+    }
+    return shard;
+}
+} // namespace
+
 class simple_fetch_planner final : public fetch_planner::impl {
     fetch_plan create_plan(op_context& octx) final {
         fetch_plan plan(ss::smp::count);
@@ -1400,7 +1466,7 @@ class simple_fetch_planner final : public fetch_planner::impl {
                   return;
               }
 
-              auto shard = octx.rctx.shards().shard_for(tp);
+              auto shard = shard_for(octx.rctx.shards(), fp);
               if (unlikely(!shard)) {
                   // there is given partition in topic metadata, return
                   // unknown_topic_or_partition error
@@ -1843,7 +1909,8 @@ void op_context::response_placeholder::set(
 
 rack_aware_replica_selector::rack_aware_replica_selector(
   const cluster::metadata_cache& md_cache)
-  : _md_cache(md_cache) {}
+  : _md_cache(md_cache)
+  , _max_lag(config::shard_local_cfg().kafka_follower_fetch_max_lag.bind()) {}
 
 std::optional<model::node_id> rack_aware_replica_selector::select_replica(
   const consumer_info& c_info, const partition_info& p_info) const {
@@ -1854,6 +1921,13 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
         return std::nullopt;
     }
 
+    // the leader high watermark is the highest one reported
+    model::offset leader_hw;
+    for (auto& replica : p_info.replicas) {
+        leader_hw = std::max(leader_hw, replica.high_watermark);
+    }
+    const auto max_lag = std::max<int64_t>(_max_lag(), 0);
+
     std::vector<replica_info> rack_replicas;
     model::offset highest_hw;
     for (auto& replica : p_info.replicas) {
@@ -1861,6 +1935,10 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
         if (!replica.is_alive) {
             continue;
         }
+        // filter out replicas lagging too far behind the leader
+        if (leader_hw() - replica.high_watermark() > max_lag) {
+            continue;
+        }
 
         const auto node_it = _md_cache.nodes().find(replica.id);
         /**
@@ -1877,8 +1955,11 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
         if (
           node_it->second.broker.rack() == c_info.rack_id
           && replica.log_end_offset >= c_info.fetch_offset) {
-            if (replica.high_watermark >= highest_hw) {
+            if (replica.high_watermark > highest_hw) {
                 highest_hw = replica.high_watermark;
+                rack_replicas.clear();
+            }
+            if (replica.high_watermark == highest_hw) {
                 rack_replicas.push_back(replica);
             }
         }
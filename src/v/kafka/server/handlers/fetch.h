@@ -328,6 +328,9 @@ struct read_result {
     model::offset high_watermark;
     model::offset last_stable_offset;
     std::optional<std::chrono::milliseconds> delta_from_tip_ms;
+    // where the data was read from and how long consuming the reader took
+    bool from_cloud{false};
+    std::chrono::microseconds read_time{0};
     std::optional<model::node_id> preferred_replica;
     error_code error;
     model::partition_id partition;
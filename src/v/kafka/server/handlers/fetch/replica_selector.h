@@ -11,6 +11,7 @@
 #pragma once
 
 #include "cluster/fwd.h"
+#include "config/property.h"
 #include "kafka/data/partition_proxy.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -47,6 +48,12 @@ struct select_leader_replica : replica_selector {
     }
 };
 
+/**
+ * Selects a replica in the rack of the consumer. Only replicas with a high
+ * watermark at most kafka_follower_fetch_max_lag offsets behind the leader
+ * are considered, a lagging follower can't serve the recent data consumers
+ * usually fetch and they would end up waiting for it to catch up.
+ */
 class rack_aware_replica_selector : public replica_selector {
 public:
     explicit rack_aware_replica_selector(const cluster::metadata_cache&);
@@ -55,6 +62,7 @@ public:
 
 private:
     const cluster::metadata_cache& _md_cache;
+    config::binding<int64_t> _max_lag;
 };
 
 } // namespace kafka
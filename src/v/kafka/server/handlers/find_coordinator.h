@@ -15,6 +15,6 @@
 namespace kafka {
 
 using find_coordinator_handler
-  = single_stage_handler<find_coordinator_api, 0, 3>;
+  = concurrent_handler<find_coordinator_api, 0, 3>;
 
 } // namespace kafka
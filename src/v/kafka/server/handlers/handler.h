@@ -40,11 +40,14 @@ template<
   api_version::type MinSupported,
   api_version::type MaxSupported,
   typename HandleRetType,
-  memory_estimate_fn MemEstimator>
+  memory_estimate_fn MemEstimator,
+  bool Concurrent = false>
 struct handler_template {
     using api = RequestApi;
     static constexpr api_version min_supported = api_version(MinSupported);
     static constexpr api_version max_supported = api_version(MaxSupported);
+    /// see concurrent_handler
+    static constexpr bool concurrent = Concurrent;
 
     static HandleRetType handle(request_context, ss::smp_service_group);
 
@@ -85,6 +88,26 @@ using single_stage_handler = handler_template<
   ss::future<response_ptr>,
   MemEstimator>;
 
+/**
+ * A concurrent handler is a single-stage handler for requests which neither
+ * depend on nor change the state of the connection, like read-only metadata
+ * lookups. All of its handling happens in the background as if it was the
+ * second stage of a two-stage handler, so the next request on the connection
+ * may be dispatched while it runs. Responses are still sent in order.
+ */
+template<
+  typename RequestApi,
+  api_version::type MinSupported,
+  api_version::type MaxSupported,
+  memory_estimate_fn MemEstimator = default_estimate_adaptor>
+using concurrent_handler = handler_template<
+  RequestApi,
+  MinSupported,
+  MaxSupported,
+  ss::future<response_ptr>,
+  MemEstimator,
+  true>;
+
 /**
  * A two-stage handler has an initial stage which happens before any other
  * request can start processing (as in a single-stage handler) but then also has
@@ -128,4 +151,8 @@ concept KafkaApiTwoPhaseHandler
 template<typename T>
 concept KafkaApiHandlerAny = KafkaApiHandler<T> || KafkaApiTwoPhaseHandler<T>;
 
+template<typename T>
+concept KafkaApiConcurrentHandler = KafkaApiHandler<T>
+                                    && requires { requires T::concurrent; };
+
 } // namespace kafka
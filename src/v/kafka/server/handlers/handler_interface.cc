@@ -44,14 +44,16 @@ struct handler_info {
  * @brief Creates a type-erased handler implementation given info and a handle
  * method.
  *
- * There are only two variants of this handler, for one and two pass
- * implementations.
+ * There are only three variants of this handler, for one and two pass
+ * implementations and for concurrent one pass implementations.
  * This keeps the generated code duplication to a minimum, compared to
  * templating this on the handler type.
  *
  * @tparam is_two_pass true if the handler is two-pass
+ * @tparam is_concurrent true if the one pass handler may run concurrently with
+ * subsequent requests
  */
-template<bool is_two_pass>
+template<bool is_two_pass, bool is_concurrent>
 struct handler_base final : public handler_interface {
     using single_pass_handler
       = ss::future<response_ptr>(request_context, ss::smp_service_group);
@@ -76,12 +78,16 @@ struct handler_base final : public handler_interface {
     }
     /**
      * Only handle varies with one or two pass, since one pass handlers
-     * must pass through single_stage() to covert them to two-pass.
+     * must pass through single_stage() to covert them to two-pass. Concurrent
+     * one pass handlers have nothing to do in the first stage.
      */
     process_result_stages
     handle(request_context&& rc, ss::smp_service_group g) const override {
         if constexpr (is_two_pass) {
             return _handle_fn(std::move(rc), g);
+        } else if constexpr (is_concurrent) {
+            return process_result_stages(
+              ss::now(), _handle_fn(std::move(rc), g));
         } else {
             return process_result_stages::single_stage(
               _handle_fn(std::move(rc), g));
@@ -93,6 +99,12 @@ private:
     fn_type* _handle_fn;
 };
 
+// fetches advance their fetch session and offset fetches must observe earlier
+// offset commits, both have to keep being dispatched in order
+static_assert(KafkaApiConcurrentHandler<metadata_handler>);
+static_assert(!KafkaApiConcurrentHandler<fetch_handler>);
+static_assert(!KafkaApiConcurrentHandler<offset_fetch_handler>);
+
 /**
  * @brief Instance holder for the handler_base.
  *
@@ -103,14 +115,17 @@ private:
  */
 template<KafkaApiHandlerAny H>
 struct handler_holder {
-    static inline const handler_base<KafkaApiTwoPhaseHandler<H>> instance{
-      handler_info{
-        H::api::key,
-        H::api::name,
-        H::min_supported,
-        H::max_supported,
-        H::memory_estimate},
-      H::handle};
+    static inline const handler_base<
+      KafkaApiTwoPhaseHandler<H>,
+      KafkaApiConcurrentHandler<H>>
+      instance{
+        handler_info{
+          H::api::key,
+          H::api::name,
+          H::min_supported,
+          H::max_supported,
+          H::memory_estimate},
+        H::handle};
 };
 
 template<typename... Ts>
@@ -15,6 +15,6 @@
 namespace kafka {
 
 using list_partition_reassignments_handler
-  = single_stage_handler<list_partition_reassignments_api, 0, 0>;
+  = concurrent_handler<list_partition_reassignments_api, 0, 0>;
 
 }
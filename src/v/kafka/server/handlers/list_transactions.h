@@ -16,6 +16,6 @@
 namespace kafka {
 
 using list_transactions_handler
-  = single_stage_handler<list_transactions_api, 0, 0>;
+  = concurrent_handler<list_transactions_api, 0, 0>;
 
 }
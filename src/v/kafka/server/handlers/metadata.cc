@@ -22,6 +22,7 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_snapshot.h"
 #include "kafka/server/response.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
@@ -247,6 +248,20 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+static int32_t topic_authorized_operations(
+  request_context& ctx,
+  const metadata_request& rq,
+  const cluster::topic_metadata& md) {
+    /**
+     * if requested include topic authorized operations
+     */
+    if (rq.data.include_topic_authorized_operations) {
+        return details::to_bit_field(
+          details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
+    }
+    return metadata_response::topic{}.topic_authorized_operations;
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
@@ -254,24 +269,94 @@ static metadata_response::topic make_topic_response(
   const is_node_isolated_or_decommissioned is_node_isolated) {
     auto res = make_topic_response_from_topic_metadata(
       ctx.metadata_cache(), md, is_node_isolated, ctx.recovery_mode_enabled());
+    res.topic_authorized_operations = topic_authorized_operations(ctx, rq, md);
+    return res;
+}
 
-    /**
-     * if requested include topic authorized operations
-     */
-    if (rq.data.include_topic_authorized_operations) {
-        res.topic_authorized_operations = details::to_bit_field(
-          details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
+namespace {
+
+/**
+ * Topics of the response, the ones with shared encoding are encoded
+ * separately from the rest of the response.
+ */
+struct topics_response {
+    struct shared_topic {
+        metadata_snapshot::entry_ptr entry;
+        int32_t authorized_operations;
+    };
+
+    small_fragment_vector<metadata_response::topic> topics;
+    chunked_vector<shared_topic> shared;
+};
+
+/**
+ * When an isolated node doesn't know the current leader of a partition it
+ * responds with a random replica, see get_leader_term(). Such responses can't
+ * be shared.
+ */
+bool has_random_leaders(
+  const cluster::metadata_cache& md_cache, const cluster::topic_metadata& md) {
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    for (const auto& [_, p_as] : md.get_assignments()) {
+        auto lt = md_cache.get_leader_term(tp_ns, p_as.id);
+        if (
+          lt && !lt->leader
+          && md_cache.get_previous_leader_id(tp_ns, p_as.id)
+               == *config::node().node_id()) {
+            return true;
+        }
     }
+    return false;
+}
 
-    return res;
+/**
+ * Adds the metadata of the topic to the response, sharing the encoded topic
+ * from the metadata snapshot when possible.
+ */
+void add_topic_response(
+  request_context& ctx,
+  metadata_request& rq,
+  const cluster::topic_metadata& md,
+  const is_node_isolated_or_decommissioned is_node_isolated,
+  topics_response& res) {
+    if (is_node_isolated) {
+        res.topics.push_back(
+          make_topic_response(ctx, rq, md, is_node_isolated));
+        return;
+    }
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    auto& snapshot = ctx.get_metadata_snapshot();
+    auto entry = snapshot.find(tp_ns);
+    if (!entry) {
+        if (has_random_leaders(ctx.metadata_cache(), md)) {
+            res.topics.push_back(
+              make_topic_response(ctx, rq, md, is_node_isolated));
+            return;
+        }
+        entry = snapshot.insert(
+          tp_ns,
+          make_topic_response_from_topic_metadata(
+            ctx.metadata_cache(),
+            md,
+            is_node_isolated,
+            ctx.recovery_mode_enabled()));
+    }
+    res.shared.push_back(topics_response::shared_topic{
+      .entry = std::move(entry),
+      .authorized_operations = topic_authorized_operations(ctx, rq, md)});
 }
 
-static ss::future<small_fragment_vector<metadata_response::topic>>
-get_topic_metadata(
+} // namespace
+
+static ss::future<topics_response> get_topic_metadata(
   request_context& ctx,
   metadata_request& request,
   const is_node_isolated_or_decommissioned is_node_isolated) {
-    small_fragment_vector<metadata_response::topic> res;
+    topics_response res;
+    if (!is_node_isolated) {
+        ctx.get_metadata_snapshot().refresh(
+          ctx.metadata_cache(), ctx.recovery_mode_enabled());
+    }
 
     // request can be served from whatever happens to be in the cache
     if (request.list_all_topics) {
@@ -291,12 +376,11 @@ get_topic_metadata(
                   authz_quiet{true})) {
                 continue;
             }
-            res.push_back(
-              make_topic_response(ctx, request, md.metadata, is_node_isolated));
+            add_topic_response(
+              ctx, request, md.metadata, is_node_isolated, res);
         }
 
-        return ss::make_ready_future<
-          small_fragment_vector<metadata_response::topic>>(std::move(res));
+        return ss::make_ready_future<topics_response>(std::move(res));
     }
 
     std::vector<model::topic> topics_to_be_created;
@@ -308,24 +392,22 @@ get_topic_metadata(
          */
         if (!ctx.authorized(security::acl_operation::describe, topic.name)) {
             // not authorized, return authorization error
-            res.push_back(make_error_topic_response(
+            res.topics.push_back(make_error_topic_response(
               std::move(topic.name), error_code::topic_authorization_failed));
             continue;
         }
-        if (auto md = ctx.metadata_cache().get_topic_metadata(
+        if (auto md = ctx.metadata_cache().get_topic_metadata_ref(
               model::topic_namespace_view(model::kafka_namespace, topic.name));
             md) {
-            auto src_topic_response = make_topic_response(
-              ctx, request, *md, is_node_isolated);
-            src_topic_response.name = std::move(topic.name);
-            res.push_back(std::move(src_topic_response));
+            add_topic_response(
+              ctx, request, md->get(), is_node_isolated, res);
             continue;
         }
 
         if (
           !config::shard_local_cfg().auto_create_topics_enabled
           || !request.data.allow_auto_topic_creation) {
-            res.push_back(make_error_topic_response(
+            res.topics.push_back(make_error_topic_response(
               std::move(topic.name), error_code::unknown_topic_or_partition));
             continue;
         }
@@ -333,7 +415,7 @@ get_topic_metadata(
          * check if authorized to create
          */
         if (!ctx.authorized(security::acl_operation::create, topic.name)) {
-            res.push_back(make_error_topic_response(
+            res.topics.push_back(make_error_topic_response(
               std::move(topic.name), error_code::topic_authorization_failed));
             continue;
         }
@@ -341,22 +423,30 @@ get_topic_metadata(
     }
 
     if (!ctx.audit()) {
-        std::for_each(res.begin(), res.end(), [](metadata_response::topic& t) {
-            t.error_code = error_code::broker_not_available;
-        });
+        for (const auto& shared : res.shared) {
+            res.topics.push_back(
+              metadata_response::topic{.name = shared.entry->response().name});
+        }
+        res.shared.clear();
+
+        std::for_each(
+          res.topics.begin(),
+          res.topics.end(),
+          [](metadata_response::topic& t) {
+              t.error_code = error_code::broker_not_available;
+          });
 
         std::transform(
           topics_to_be_created.begin(),
           topics_to_be_created.end(),
-          std::back_inserter(res),
+          std::back_inserter(res.topics),
           [](model::topic& t) {
               return metadata_response::topic{
                 .error_code = error_code::broker_not_available,
                 .name = std::move(t)};
           });
 
-        return ss::make_ready_future<
-          small_fragment_vector<metadata_response::topic>>(std::move(res));
+        return ss::make_ready_future<topics_response>(std::move(res));
     }
 
     std::for_each(
@@ -370,7 +460,8 @@ get_topic_metadata(
     return ss::when_all_succeed(new_topics.begin(), new_topics.end())
       .then([res = std::move(res)](
               std::vector<metadata_response::topic> topics) mutable {
-          std::move(topics.begin(), topics.end(), std::back_inserter(res));
+          std::move(
+            topics.begin(), topics.end(), std::back_inserter(res.topics));
           return std::move(res);
       });
 }
@@ -532,8 +623,19 @@ ss::future<response_ptr> metadata_handler::handle(
     request.decode(ctx.reader(), ctx.header().version);
     log_request(ctx.header(), request);
 
-    reply.data.topics = co_await get_topic_metadata(
+    auto topics = co_await get_topic_metadata(
       ctx, request, isolated_or_decommissioned);
+    reply.data.topics = std::move(topics.topics);
+    const auto version = ctx.header().version;
+    reply.encoded_topics.reserve(topics.shared.size());
+    for (const auto& shared : topics.shared) {
+        auto encoded = shared.entry->encoded(version);
+        if (version >= api_version(8)) {
+            protocol::encoder writer(encoded);
+            writer.write(shared.authorized_operations);
+        }
+        reply.encoded_topics.push_back(std::move(encoded));
+    }
 
     if (
       request.data.include_cluster_authorized_operations
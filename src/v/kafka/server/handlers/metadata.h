@@ -30,6 +30,6 @@ memory_estimate_fn metadata_memory_estimator;
 // Keep this at v8.  Moving to v9 appears to cause issues with the Kafka Java
 // Client
 using metadata_handler
-  = single_stage_handler<metadata_api, 0, 8, metadata_memory_estimator>;
+  = concurrent_handler<metadata_api, 0, 8, metadata_memory_estimator>;
 
 } // namespace kafka
@@ -10,12 +10,14 @@
 #include "kafka/server/handlers/produce.h"
 
 #include "base/likely.h"
+#include "base/vassert.h"
 #include "base/vlog.h"
 #include "bytes/iobuf.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "config/configuration.h"
+#include "container/fragmented_vector.h"
 #include "kafka/data/replicated_partition.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
@@ -84,9 +86,9 @@ produce_response produce_request::make_full_disk_response() const {
     return resp;
 }
 
-struct topic_produce_stages {
-    ss::future<> dispatched;
-    ss::future<produce_response::topic> produced;
+struct request_produce_stages {
+    std::vector<ss::future<>> dispatched;
+    std::vector<ss::future<produce_response::topic>> produced;
 };
 
 partition_produce_stages make_ready_stage(produce_response::partition p) {
@@ -199,22 +201,6 @@ static partition_produce_stages partition_append(
     };
 }
 
-ss::future<produce_response::partition> finalize_request_with_error_code(
-  error_code ec,
-  std::unique_ptr<ss::promise<>> dispatch,
-  model::ntp ntp,
-  ss::shard_id source_shard) {
-    // submit back to promise source shard
-    ssx::background = ss::smp::submit_to(
-      source_shard, [dispatch = std::move(dispatch)]() mutable {
-          dispatch->set_value();
-          dispatch.reset();
-      });
-    return ss::make_ready_future<produce_response::partition>(
-      produce_response::partition{
-        .partition_index = ntp.tp.partition, .error_code = ec});
-}
-
 /**
  * @brief Validate the timestamps of the batch, they have to be within a window
  * to the broker's time. returns the new timestamp to set as max_timestamp to
@@ -294,10 +280,271 @@ static auto validate_batch_timestamps(
 }
 
 /**
- * \brief handle writing to a single topic partition.
+ * A single partition's produce work. It is prepared on the connection shard
+ * and executed on the shard that owns the partition.
+ */
+struct partition_produce_request {
+    model::ntp ntp;
+    model::record_batch batch;
+    std::optional<pandaproxy::schema_registry::schema_id_validator> validator;
+    model::batch_identity bid;
+    int32_t num_records;
+    int64_t batch_size;
+    uint32_t batch_max_bytes;
+};
+
+/**
+ * All of the produce work of a request destined for a single shard. The
+ * requests are handed over to the owning shard in a single cross core call,
+ * and the responses are fulfilled back on the connection shard once the
+ * owning shard has finished replicating all of them.
+ */
+struct shard_produce {
+    explicit shard_produce(ss::shard_id shard_id)
+      : shard(shard_id) {}
+
+    void push_back(
+      partition_produce_request req,
+      ss::promise<produce_response::partition> resp) {
+        requests.push_back(std::move(req));
+        responses.push_back(std::move(resp));
+    }
+
+    bool empty() const { return requests.empty(); }
+
+    ss::shard_id shard;
+    chunked_vector<partition_produce_request> requests;
+    chunked_vector<ss::promise<produce_response::partition>> responses;
+};
+
+/**
+ * Produce work of a request grouped by destination shard.
+ */
+struct produce_plan {
+    produce_plan() {
+        produces_per_shard.reserve(ss::smp::count);
+        for (ss::shard_id i = 0; i < ss::smp::count; ++i) {
+            produces_per_shard.emplace_back(i);
+        }
+    }
+
+    std::vector<shard_produce> produces_per_shard;
+};
+
+static std::chrono::milliseconds produce_timeout(const produce_ctx& octx) {
+    auto timeout = octx.request.data.timeout_ms;
+    if (timeout < 0ms) {
+        static constexpr std::chrono::milliseconds max_timeout{
+          std::numeric_limits<int32_t>::max()};
+        // negative timeout translates to no timeout
+        timeout = max_timeout;
+    }
+    return timeout;
+}
+
+/**
+ * \brief handle writing to a single topic partition on the shard that owns
+ * it. Both of the returned stages are resolved on the owning shard.
+ */
+static partition_produce_stages produce_partition_on_shard(
+  cluster::partition_manager& mgr,
+  partition_produce_request req,
+  int16_t acks,
+  std::chrono::milliseconds timeout) {
+    auto partition = mgr.get(req.ntp);
+    if (!partition) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = req.ntp.tp.partition,
+          .error_code = error_code::not_leader_for_partition});
+    }
+    if (unlikely(static_cast<uint32_t>(req.batch_size) > req.batch_max_bytes)) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = req.ntp.tp.partition,
+          .error_code = error_code::message_too_large});
+    }
+    if (unlikely(!partition->is_leader())) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = req.ntp.tp.partition,
+          .error_code = error_code::not_leader_for_partition});
+    }
+
+    auto dispatch = std::make_unique<ss::promise<>>();
+    auto dispatch_f = dispatch->get_future();
+    auto probe = std::addressof(partition->probe());
+    auto f
+      = pandaproxy::schema_registry::maybe_validate_schema_id(
+          std::move(req.validator), std::move(req.batch), probe)
+          .then([id = req.ntp.tp.partition,
+                 partition{std::move(partition)},
+                 dispatch = std::move(dispatch),
+                 bid = req.bid,
+                 acks,
+                 num_records = req.num_records,
+                 batch_size = req.batch_size,
+                 timeout](result<model::record_batch, kafka::error_code>
+                            batch) mutable {
+              if (batch.has_error()) {
+                  dispatch->set_value();
+                  return ss::make_ready_future<produce_response::partition>(
+                    produce_response::partition{
+                      .partition_index = id, .error_code = batch.error()});
+              }
+              auto stages = partition_append(
+                id,
+                ss::make_lw_shared<replicated_partition>(std::move(partition)),
+                bid,
+                std::move(batch).value(),
+                acks,
+                num_records,
+                batch_size,
+                timeout);
+              return stages.dispatched
+                .then_wrapped(
+                  [dispatch = std::move(dispatch)](ss::future<> f) mutable {
+                      if (f.failed()) {
+                          dispatch->set_exception(f.get_exception());
+                          return;
+                      }
+                      dispatch->set_value();
+                  })
+                .then([f = std::move(stages.produced)]() mutable {
+                    return std::move(f);
+                });
+          });
+    return partition_produce_stages{
+      .dispatched = std::move(dispatch_f),
+      .produced = std::move(f),
+    };
+}
+
+/**
+ * Top-level handler for producing to a single shard. All of the shard's
+ * partitions are handed over in one cross core call. The returned future is
+ * the dispatch stage of the whole shard, it is signalled back to the
+ * connection shard once every partition has been enqueued for replication.
+ * Partition responses are placed into their promises when the owning shard
+ * finishes.
+ */
+static ss::future<>
+handle_shard_produce(produce_ctx& octx, shard_produce produce) {
+    if (produce.empty()) {
+        return ss::now();
+    }
+
+    auto dispatch = std::make_unique<ss::promise<>>();
+    auto* probe = &octx.rctx.probe();
+    const auto start = std::chrono::steady_clock::now();
+    // set once the shard's dispatch stage resolves, the replicate stage is
+    // measured from there
+    auto dispatched_at = ss::make_lw_shared<
+      std::optional<std::chrono::steady_clock::time_point>>();
+    auto dispatch_f = dispatch->get_future().then(
+      [probe, start, dispatched_at] {
+          auto now = std::chrono::steady_clock::now();
+          *dispatched_at = now;
+          probe->record_produce_dispatch_latency(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+              now - start));
+      });
+
+    ssx::background
+      = octx.rctx.partition_manager()
+          .invoke_on(
+            produce.shard,
+            octx.ssg,
+            [requests = std::move(produce.requests),
+             dispatch = std::move(dispatch),
+             acks = octx.request.data.acks,
+             timeout = produce_timeout(octx),
+             source_shard = ss::this_shard_id()](
+              cluster::partition_manager& mgr) mutable {
+                std::vector<ss::future<>> dispatched;
+                std::vector<ss::future<produce_response::partition>> produced;
+                dispatched.reserve(requests.size());
+                produced.reserve(requests.size());
+                for (auto& req : requests) {
+                    auto stages = produce_partition_on_shard(
+                      mgr, std::move(req), acks, timeout);
+                    dispatched.push_back(std::move(stages.dispatched));
+                    produced.push_back(std::move(stages.produced));
+                }
+                // signal the dispatch of the whole shard back to the source
+                // shard with a single cross core call
+                ssx::background
+                  = ss::when_all_succeed(dispatched.begin(), dispatched.end())
+                      .then_wrapped([source_shard, dispatch = std::move(
+                                                     dispatch)](
+                                      ss::future<> f) mutable {
+                          std::exception_ptr e;
+                          if (f.failed()) {
+                              e = f.get_exception();
+                          }
+                          return ss::smp::submit_to(
+                            source_shard,
+                            [dispatch = std::move(dispatch), e]() mutable {
+                                if (e) {
+                                    dispatch->set_exception(e);
+                                } else {
+                                    dispatch->set_value();
+                                }
+                                dispatch.reset();
+                            });
+                      });
+                return ss::when_all_succeed(produced.begin(), produced.end());
+            })
+          .then_wrapped(
+            [responses = std::move(produce.responses), probe, dispatched_at](
+              ss::future<std::vector<produce_response::partition>> f) mutable {
+                if (dispatched_at->has_value()) {
+                    probe->record_produce_replicate_latency(
+                      std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - **dispatched_at));
+                }
+                if (f.failed()) {
+                    auto e = f.get_exception();
+                    for (auto& r : responses) {
+                        r.set_exception(e);
+                    }
+                    return;
+                }
+                auto parts = f.get();
+                vassert(
+                  parts.size() == responses.size(),
+                  "expected {} partition responses, got {}",
+                  responses.size(),
+                  parts.size());
+                for (size_t i = 0; i < parts.size(); ++i) {
+                    responses[i].set_value(std::move(parts[i]));
+                }
+            });
+
+    return dispatch_f;
+}
+
+/**
+ * \brief dispatch all of the planned produce work, one cross core call per
+ * shard. Returns the dispatch stages of the shards.
+ */
+static std::vector<ss::future<>>
+execute_produce_plan(produce_ctx& octx, produce_plan plan) {
+    std::vector<ss::future<>> dispatched;
+    dispatched.reserve(ss::smp::count);
+    for (auto& sp : plan.produces_per_shard) {
+        if (sp.empty()) {
+            continue;
+        }
+        dispatched.push_back(handle_shard_produce(octx, std::move(sp)));
+    }
+    return dispatched;
+}
+
+/**
+ * \brief prepare writing to a single topic partition. The write is added to
+ * the plan of the shard that owns the partition.
  */
-static partition_produce_stages produce_topic_partition(
+static ss::future<produce_response::partition> produce_topic_partition(
   produce_ctx& octx,
+  produce_plan& plan,
   produce_request::topic& topic,
   produce_request::partition& part) {
     auto ntp = model::ntp(
@@ -310,9 +557,10 @@ static partition_produce_stages produce_topic_partition(
     auto shard = octx.rctx.shards().shard_for(ntp);
 
     if (!shard) {
-        return make_ready_stage(produce_response::partition{
-          .partition_index = ntp.tp.partition,
-          .error_code = error_code::not_leader_for_partition});
+        return ss::make_ready_future<produce_response::partition>(
+          produce_response::partition{
+            .partition_index = ntp.tp.partition,
+            .error_code = error_code::not_leader_for_partition});
     }
 
     // steal the batch from the adapter
@@ -322,9 +570,10 @@ static partition_produce_stages produce_topic_partition(
       model::topic_namespace_view(model::kafka_namespace, topic.name));
 
     if (!topic_cfg) {
-        return make_ready_stage(produce_response::partition{
-          .partition_index = ntp.tp.partition,
-          .error_code = error_code::unknown_topic_or_partition});
+        return ss::make_ready_future<produce_response::partition>(
+          produce_response::partition{
+            .partition_index = ntp.tp.partition,
+            .error_code = error_code::unknown_topic_or_partition});
     }
 
     const auto timestamp_type = topic_cfg->properties.timestamp_type.value_or(
@@ -348,128 +597,33 @@ static partition_produce_stages produce_topic_partition(
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
         octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
     auto start = std::chrono::steady_clock::now();
-
-    auto dispatch = std::make_unique<ss::promise<>>();
-    auto dispatch_f = dispatch->get_future();
     auto m = octx.rctx.probe().auto_produce_measurement();
-    auto timeout = octx.request.data.timeout_ms;
-    if (timeout < 0ms) {
-        static constexpr std::chrono::milliseconds max_timeout{
-          std::numeric_limits<int32_t>::max()};
-        // negative timeout translates to no timeout
-        timeout = max_timeout;
-    }
-    auto f
-      = octx.rctx.partition_manager()
-          .invoke_on(
-            *shard,
-            octx.ssg,
-            [batch = std::move(batch),
-             validator = std::move(validator),
-             ntp = std::move(ntp),
-             dispatch = std::move(dispatch),
-             num_records,
-             batch_size,
-             bid,
-             acks = octx.request.data.acks,
-             batch_max_bytes,
-             timeout,
-             source_shard = ss::this_shard_id()](
-              cluster::partition_manager& mgr) mutable {
-                auto partition = mgr.get(ntp);
-                if (!partition) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(
-                      static_cast<uint32_t>(batch_size) > batch_max_bytes)) {
-                    return finalize_request_with_error_code(
-                      error_code::message_too_large,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(!partition->is_leader())) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
 
-                auto probe = std::addressof(partition->probe());
-                return pandaproxy::schema_registry::maybe_validate_schema_id(
-                         std::move(validator), std::move(batch), probe)
-                  .then([ntp{std::move(ntp)},
-                         partition{std::move(partition)},
-                         dispatch = std::move(dispatch),
-                         bid,
-                         acks,
-                         source_shard,
-                         num_records,
-                         batch_size,
-                         timeout](result<model::record_batch, kafka::error_code>
-                                    batch) mutable {
-                      if (batch.has_error()) {
-                          return finalize_request_with_error_code(
-                            batch.error(),
-                            std::move(dispatch),
-                            ntp,
-                            source_shard);
-                      }
-                      auto stages = partition_append(
-                        ntp.tp.partition,
-                        ss::make_lw_shared<replicated_partition>(
-                          std::move(partition)),
-                        bid,
-                        std::move(batch).value(),
-                        acks,
-                        num_records,
-                        batch_size,
-                        timeout);
-                      return stages.dispatched
-                        .then_wrapped(
-                          [source_shard, dispatch = std::move(dispatch)](
-                            ss::future<> f) mutable {
-                              if (f.failed()) {
-                                  (void)ss::smp::submit_to(
-                                    source_shard,
-                                    [dispatch = std::move(dispatch),
-                                     e = f.get_exception()]() mutable {
-                                        dispatch->set_exception(e);
-                                        dispatch.reset();
-                                    });
-                                  return;
-                              }
-                              (void)ss::smp::submit_to(
-                                source_shard,
-                                [dispatch = std::move(dispatch)]() mutable {
-                                    dispatch->set_value();
-                                    dispatch.reset();
-                                });
-                          })
-                        .then([f = std::move(stages.produced)]() mutable {
-                            return std::move(f);
-                        });
-                  });
-            })
-          .then([&octx, start, m = std::move(m)](
-                  produce_response::partition p) {
-              if (p.error_code == error_code::none) {
-                  auto dur = std::chrono::steady_clock::now() - start;
-                  octx.rctx.connection()->server().update_produce_latency(dur);
-              } else {
-                  m->cancel();
-              }
-              return p;
-          });
-    return partition_produce_stages{
-      .dispatched = std::move(dispatch_f),
-      .produced = std::move(f),
-    };
+    ss::promise<produce_response::partition> response;
+    auto f = response.get_future().then(
+      [&octx, start, m = std::move(m)](produce_response::partition p) {
+          if (p.error_code == error_code::none) {
+              auto dur = std::chrono::steady_clock::now() - start;
+              octx.rctx.connection()->server().update_produce_latency(dur);
+          } else {
+              m->cancel();
+          }
+          return p;
+      });
+
+    plan.produces_per_shard[*shard].push_back(
+      partition_produce_request{
+        .ntp = std::move(ntp),
+        .batch = std::move(batch),
+        .validator = std::move(validator),
+        .bid = bid,
+        .num_records = num_records,
+        .batch_size = batch_size,
+        .batch_max_bytes = batch_max_bytes,
+      },
+      std::move(response));
+
+    return f;
 }
 
 namespace testing {
@@ -477,19 +631,23 @@ partition_produce_stages produce_single_partition(
   produce_ctx& octx,
   produce_request::topic& topic,
   produce_request::partition& part) {
-    return produce_topic_partition(octx, topic, part);
+    produce_plan plan;
+    auto produced = produce_topic_partition(octx, plan, topic, part);
+    auto dispatched = execute_produce_plan(octx, std::move(plan));
+    return partition_produce_stages{
+      .dispatched = ss::when_all_succeed(dispatched.begin(), dispatched.end()),
+      .produced = std::move(produced),
+    };
 }
 } // namespace testing
 
 /**
- * \brief Dispatch and collect topic partition produce responses
+ * \brief Plan and collect topic partition produce responses
  */
-static topic_produce_stages
-produce_topic(produce_ctx& octx, produce_request::topic& topic) {
+static ss::future<produce_response::topic> produce_topic(
+  produce_ctx& octx, produce_plan& plan, produce_request::topic& topic) {
     std::vector<ss::future<produce_response::partition>> partitions_produced;
-    std::vector<ss::future<>> partitions_dispatched;
     partitions_produced.reserve(topic.partitions.size());
-    partitions_dispatched.reserve(topic.partitions.size());
 
     const auto* disabled_set
       = octx.rctx.metadata_cache().get_topic_disabled_set(
@@ -497,7 +655,6 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
 
     for (auto& part : topic.partitions) {
         auto push_error_response = [&](error_code errc) {
-            partitions_dispatched.push_back(ss::now());
             partitions_produced.push_back(
               ss::make_ready_future<produce_response::partition>(
                 produce_response::partition{
@@ -579,40 +736,40 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
             continue;
         }
 
-        auto pr = produce_topic_partition(octx, topic, part);
-        partitions_produced.push_back(std::move(pr.produced));
-        partitions_dispatched.push_back(std::move(pr.dispatched));
+        partitions_produced.push_back(
+          produce_topic_partition(octx, plan, topic, part));
     }
 
     // collect partition responses and build the topic response
-    return topic_produce_stages{
-      .dispatched = ss::when_all_succeed(
-        partitions_dispatched.begin(), partitions_dispatched.end()),
-      .produced
-      = ss::when_all_succeed(
-          partitions_produced.begin(), partitions_produced.end())
-          .then([name = std::move(topic.name)](
-                  std::vector<produce_response::partition> parts) mutable {
-              return produce_response::topic{
-                .name = std::move(name),
-                .partitions = std::move(parts),
-              };
-          }),
-    };
+    return ss::when_all_succeed(
+             partitions_produced.begin(), partitions_produced.end())
+      .then([name = std::move(topic.name)](
+              std::vector<produce_response::partition> parts) mutable {
+          return produce_response::topic{
+            .name = std::move(name),
+            .partitions = std::move(parts),
+          };
+      });
 }
 
 /**
  * \brief Dispatch and collect topic produce responses
+ *
+ * Partitions of all topics are first grouped by the shard that owns them and
+ * then dispatched with a single cross core call per shard, so that wide
+ * requests do not pay a cross core hop for every partition.
  */
-static std::vector<topic_produce_stages> produce_topics(produce_ctx& octx) {
-    std::vector<topic_produce_stages> topics;
-    topics.reserve(octx.request.data.topics.size());
+static request_produce_stages produce_topics(produce_ctx& octx) {
+    produce_plan plan;
+    request_produce_stages stages;
+    stages.produced.reserve(octx.request.data.topics.size());
 
     for (auto& topic : octx.request.data.topics) {
-        topics.push_back(produce_topic(octx, topic));
+        stages.produced.push_back(produce_topic(octx, plan, topic));
     }
 
-    return topics;
+    stages.dispatched = execute_produce_plan(octx, std::move(plan));
+    return stages;
 }
 
 template<>
@@ -763,16 +920,7 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
       [dispatched_promise = std::move(dispatched_promise)](
         produce_ctx& octx) mutable {
           // dispatch produce requests for each topic
-          auto stages = produce_topics(octx);
-          std::vector<ss::future<>> dispatched;
-          std::vector<ss::future<produce_response::topic>> produced;
-          dispatched.reserve(stages.size());
-          produced.reserve(stages.size());
-
-          for (auto& s : stages) {
-              dispatched.push_back(std::move(s.dispatched));
-              produced.push_back(std::move(s.produced));
-          }
+          auto [dispatched, produced] = produce_topics(octx);
           return seastar::when_all_succeed(dispatched.begin(), dispatched.end())
             .then_wrapped([&octx,
                            dispatched_promise = std::move(dispatched_promise),
@@ -55,6 +55,26 @@ public:
               sm::description("Produce Latency"),
               labels,
               [this] { return _produce_latency.internal_histogram_logform(); }),
+            sm::make_histogram(
+              "produce_dispatch_latency_us",
+              sm::description(
+                "Time from planning a produce until all partitions of a shard "
+                "are enqueued for replication, including the cross shard hop "
+                "and schema validation"),
+              labels,
+              [this] {
+                  return _produce_dispatch_latency.internal_histogram_logform();
+              }),
+            sm::make_histogram(
+              "produce_replicate_latency_us",
+              sm::description(
+                "Time from a shard's partitions being enqueued for "
+                "replication until all of them are replicated"),
+              labels,
+              [this] {
+                  return _produce_replicate_latency
+                    .internal_histogram_logform();
+              }),
           },
           {},
           {sm::shard_label});
@@ -92,8 +112,19 @@ public:
         _fetch_latency.record(micros.count());
     }
 
+    /// Stages of a produce to a single shard, see
+    /// produce_dispatch_latency_us and produce_replicate_latency_us
+    void record_produce_dispatch_latency(std::chrono::microseconds micros) {
+        _produce_dispatch_latency.record(micros.count());
+    }
+    void record_produce_replicate_latency(std::chrono::microseconds micros) {
+        _produce_replicate_latency.record(micros.count());
+    }
+
 private:
     hist_t _produce_latency;
+    hist_t _produce_dispatch_latency;
+    hist_t _produce_replicate_latency;
     hist_t _fetch_latency;
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/metadata_snapshot.h"
+
+#include "cluster/metadata_cache.h"
+#include "kafka/protocol/wire.h"
+
+namespace kafka {
+
+namespace {
+// The versions in a group encode a topic the same way (ignoring the topic
+// authorized operations): 0 | 1-4 (is_internal) | 5-6 (offline_replicas) |
+// 7-8 (leader_epoch)
+size_t layout_index(api_version v) {
+    if (v >= api_version(7)) {
+        return 3;
+    }
+    if (v >= api_version(5)) {
+        return 2;
+    }
+    if (v >= api_version(1)) {
+        return 1;
+    }
+    return 0;
+}
+} // namespace
+
+iobuf metadata_snapshot::topic_entry::encoded(api_version v) const {
+    auto& encoded = _encoded[layout_index(v)];
+    if (!encoded) {
+        encoded.emplace();
+        protocol::encoder writer(*encoded);
+        encode_metadata_topic(
+          writer, _response, v, /*with_authorized_operations=*/false);
+    }
+    return encoded->share(0, encoded->size_bytes());
+}
+
+void metadata_snapshot::refresh(
+  const cluster::metadata_cache& md_cache, bool recovery_mode_enabled) {
+    const auto& topic_changes = md_cache.topic_changes();
+    const auto& leadership_changes = md_cache.leadership_changes();
+    if (
+      _topics_revision == topic_changes.revision()
+      && _leaders_revision == leadership_changes.revision()
+      && _recovery_mode_enabled == recovery_mode_enabled) {
+        return;
+    }
+
+    auto drop = [this](model::topic_namespace_view tp_ns) {
+        if (auto it = _topics.find(tp_ns); it != _topics.end()) {
+            _topics.erase(it);
+        }
+    };
+    const bool tracked
+      = _recovery_mode_enabled == recovery_mode_enabled
+        && topic_changes.for_each_change_since(_topics_revision, drop)
+        && leadership_changes.for_each_change_since(_leaders_revision, drop);
+    if (!tracked) {
+        _topics.clear();
+    }
+
+    _topics_revision = topic_changes.revision();
+    _leaders_revision = leadership_changes.revision();
+    _recovery_mode_enabled = recovery_mode_enabled;
+}
+
+metadata_snapshot::entry_ptr
+metadata_snapshot::find(model::topic_namespace_view tp_ns) const {
+    if (auto it = _topics.find(tp_ns); it != _topics.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+metadata_snapshot::entry_ptr metadata_snapshot::insert(
+  model::topic_namespace tp_ns, metadata_response::topic response) {
+    auto entry = ss::make_lw_shared<const topic_entry>(std::move(response));
+    _topics.insert_or_assign(std::move(tp_ns), entry);
+    return entry;
+}
+
+} // namespace kafka
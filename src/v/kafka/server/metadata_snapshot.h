@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "cluster/fwd.h"
+#include "container/chunked_hash_map.h"
+#include "kafka/protocol/metadata.h"
+#include "model/metadata.h"
+
+#include <seastar/core/shared_ptr.hh>
+
+#include <array>
+
+namespace kafka {
+
+/**
+ * Per shard cache of the topics of the metadata responses. Every topic is
+ * encoded once per group of response versions sharing the topic layout and
+ * the encoding is shared by all the responses until the metadata of the topic
+ * changes, large all topics requests are then mostly a matter of splicing the
+ * shared buffers into the response.
+ *
+ * The cache follows the change logs of the topic table and the partition
+ * leaders table, on every refresh only the changed topics are dropped. The
+ * cached topics don't contain the per request topic authorized operations.
+ */
+class metadata_snapshot {
+public:
+    class topic_entry {
+    public:
+        explicit topic_entry(metadata_response::topic response)
+          : _response(std::move(response)) {}
+
+        const metadata_response::topic& response() const { return _response; }
+
+        /**
+         * Returns the encoding of the topic for the response version \p v,
+         * without the topic authorized operations. The buffer shares the
+         * memory of the cached encoding.
+         */
+        iobuf encoded(api_version v) const;
+
+    private:
+        metadata_response::topic _response;
+        mutable std::array<std::optional<iobuf>, 4> _encoded;
+    };
+
+    using entry_ptr = ss::lw_shared_ptr<const topic_entry>;
+
+    /**
+     * Drops the topics which changed since the last refresh. Everything is
+     * dropped if the change logs were truncated in the meantime or the
+     * recovery mode was toggled.
+     */
+    void refresh(const cluster::metadata_cache&, bool recovery_mode_enabled);
+
+    entry_ptr find(model::topic_namespace_view) const;
+
+    entry_ptr insert(model::topic_namespace, metadata_response::topic);
+
+    size_t size() const { return _topics.size(); }
+
+private:
+    chunked_hash_map<
+      model::topic_namespace,
+      entry_ptr,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topics;
+    uint64_t _topics_revision{0};
+    uint64_t _leaders_revision{0};
+    bool _recovery_mode_enabled{false};
+};
+
+} // namespace kafka
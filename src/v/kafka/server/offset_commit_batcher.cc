@@ -0,0 +1,151 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "cluster/partition.h"
+#include "kafka/server/logger.h"
+#include "raft/consensus.h"
+#include "ssx/future-util.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/coroutine/as_future.hh>
+
+namespace kafka {
+
+offset_commit_batcher::offset_commit_batcher(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  config::binding<std::chrono::milliseconds> window)
+  : _partition(std::move(partition))
+  , _window(std::move(window)) {
+    _timer.set_callback([this] { dispatch(); });
+}
+
+raft::replicate_stages
+offset_commit_batcher::append(model::term_id term, records_t records) {
+    if (_gate.is_closed()) {
+        return raft::replicate_stages(raft::errc::shutting_down);
+    }
+    if (!_pending.empty() && _pending_term != term) {
+        dispatch();
+    }
+    _pending_term = term;
+
+    for (const auto& r : records) {
+        _pending_bytes += r.key.size_bytes()
+                          + (r.value ? r.value->size_bytes() : 0);
+    }
+    auto& commit = _pending.emplace_back(pending_commit{
+      .records = std::move(records),
+    });
+    raft::replicate_stages stages(
+      commit.enqueued.get_future(), commit.finished.get_future());
+
+    if (_pending_bytes >= max_batch_bytes) {
+        dispatch();
+    } else if (!_timer.armed()) {
+        // with an empty window the commits appended before the reactor polls
+        // again are still coalesced
+        _timer.arm(_window());
+    }
+    return stages;
+}
+
+void offset_commit_batcher::dispatch() {
+    _timer.cancel();
+    if (_pending.empty()) {
+        return;
+    }
+    auto commits = std::exchange(_pending, {});
+    _pending_bytes = 0;
+    ssx::spawn_with_gate(
+      _gate,
+      [this, term = _pending_term, commits = std::move(commits)]() mutable {
+          return replicate(term, std::move(commits));
+      });
+}
+
+ss::future<> offset_commit_batcher::replicate(
+  model::term_id term, chunked_vector<pending_commit> commits) {
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    size_t records = 0;
+    for (auto& c : commits) {
+        records += c.records.size();
+        for (auto& r : c.records) {
+            builder.add_raw_kv(std::move(r.key), std::move(r.value));
+        }
+    }
+    vlog(
+      klog.trace,
+      "[{}] replicating {} offset commits with {} records",
+      _partition->ntp(),
+      commits.size(),
+      records);
+
+    // replication must be requested before the first suspension point to
+    // preserve the order of the dispatched batches
+    auto stages = _partition->raft()->replicate_in_stages(
+      term,
+      chunked_vector<model::record_batch>::single(std::move(builder).build()),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    auto enqueued = co_await ss::coroutine::as_future(
+      std::move(stages.request_enqueued));
+    if (enqueued.failed()) {
+        auto e = enqueued.get_exception();
+        for (auto& c : commits) {
+            c.enqueued.set_exception(e);
+        }
+    } else {
+        for (auto& c : commits) {
+            c.enqueued.set_value();
+        }
+    }
+
+    auto finished = co_await ss::coroutine::as_future(
+      std::move(stages.replicate_finished));
+    if (finished.failed()) {
+        auto e = finished.get_exception();
+        for (auto& c : commits) {
+            c.finished.set_exception(e);
+        }
+        co_return;
+    }
+    auto r = finished.get();
+    if (!r) {
+        for (auto& c : commits) {
+            c.finished.set_value(r.error());
+        }
+        co_return;
+    }
+    // the records of every commit are contiguous, walk back from the end of
+    // the batch to find the last offset of each commit
+    auto last_offset = r.value().last_offset;
+    for (size_t i = commits.size(); i-- > 0;) {
+        auto& c = commits[i];
+        c.finished.set_value(raft::replicate_result{last_offset});
+        last_offset = last_offset
+                      - model::offset(static_cast<int64_t>(c.records.size()));
+    }
+}
+
+ss::future<> offset_commit_batcher::stop() {
+    _timer.cancel();
+    for (auto& c : _pending) {
+        c.enqueued.set_value();
+        c.finished.set_value(make_error_code(raft::errc::shutting_down));
+    }
+    _pending.clear();
+    _pending_bytes = 0;
+    return _gate.close();
+}
+
+} // namespace kafka
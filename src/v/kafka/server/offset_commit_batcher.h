@@ -0,0 +1,78 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "base/units.h"
+#include "cluster/fwd.h"
+#include "config/property.h"
+#include "container/fragmented_vector.h"
+#include "kafka/server/group_metadata.h"
+#include "model/fundamental.h"
+#include "raft/replicate.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
+
+namespace kafka {
+
+/**
+ * Coalesces the offset commits of all the groups coordinated by a single
+ * consumer offsets partition. Commits arriving within the coalescing window
+ * are appended to one batch which is replicated with a single raft round trip,
+ * every committer is then notified individually with the offset of the last of
+ * its records.
+ *
+ * The commits are replicated in the order they were appended, a commit is
+ * considered enqueued as soon as it is accepted by the batcher.
+ */
+class offset_commit_batcher {
+public:
+    using records_t = chunked_vector<group_metadata_serializer::key_value>;
+
+    // a batch is dispatched right away once it grows past this size
+    static constexpr size_t max_batch_bytes = 512_KiB;
+
+    offset_commit_batcher(
+      ss::lw_shared_ptr<cluster::partition>,
+      config::binding<std::chrono::milliseconds> window);
+
+    /**
+     * Appends the records to the batch replicated in \p term. Records of
+     * different terms are never replicated together.
+     */
+    raft::replicate_stages append(model::term_id term, records_t records);
+
+    /// Fails the pending commits and waits for the in flight ones
+    ss::future<> stop();
+
+private:
+    struct pending_commit {
+        records_t records;
+        ss::promise<> enqueued;
+        ss::promise<result<raft::replicate_result>> finished;
+    };
+
+    void dispatch();
+    ss::future<> replicate(model::term_id, chunked_vector<pending_commit>);
+
+    ss::lw_shared_ptr<cluster::partition> _partition;
+    config::binding<std::chrono::milliseconds> _window;
+    ss::timer<ss::lowres_clock> _timer;
+    model::term_id _pending_term;
+    chunked_vector<pending_commit> _pending;
+    size_t _pending_bytes{0};
+    ss::gate _gate;
+};
+
+} // namespace kafka
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "container/chunked_hash_map.h"
+#include "container/fragmented_vector.h"
+#include "model/fundamental.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace kafka {
+
+/**
+ * Committed offsets of a group indexed by topic and partition. Every topic
+ * name is stored once and the partitions of a topic are kept in an array
+ * ordered by partition id. Partition ids are dense for most topics, the
+ * partition is then found at its own index without a search. Compared to a map
+ * keyed by topic partition this saves a copy of the topic name and a hash table
+ * slot per offset and lets requests for all the offsets of a group walk the
+ * topics without grouping the partitions first.
+ *
+ * The values are heap allocated so that their address doesn't change when the
+ * table is modified, the offset probes keep references into them.
+ */
+template<typename V>
+class offset_table {
+public:
+    using value_ptr = std::unique_ptr<V>;
+
+    class partitions {
+    public:
+        V* find(model::partition_id id) const {
+            auto it = lower_bound(id);
+            if (it == _entries.cend() || it->id != id) {
+                return nullptr;
+            }
+            return it->value.get();
+        }
+
+        size_t size() const { return _entries.size(); }
+
+        /// Calls \p f with the partition id and value in partition order
+        template<typename Func>
+        void for_each(Func&& f) const {
+            for (const auto& e : _entries) {
+                f(e.id, *e.value);
+            }
+        }
+
+    private:
+        friend class offset_table;
+
+        struct entry {
+            model::partition_id id;
+            value_ptr value;
+        };
+        using entries_t = chunked_vector<entry>;
+
+        typename entries_t::const_iterator
+        lower_bound(model::partition_id id) const {
+            const auto idx = static_cast<size_t>(id());
+            if (id() >= 0 && idx < _entries.size() && _entries[idx].id == id) {
+                return _entries.cbegin() + idx;
+            }
+            return std::lower_bound(
+              _entries.cbegin(),
+              _entries.cend(),
+              id,
+              [](const entry& e, model::partition_id p) { return e.id < p; });
+        }
+
+        typename entries_t::iterator lower_bound(model::partition_id id) {
+            auto it = std::as_const(*this).lower_bound(id);
+            return _entries.begin() + (it - _entries.cbegin());
+        }
+
+        entries_t _entries;
+    };
+
+    using topics_t = chunked_hash_map<model::topic, partitions>;
+
+    V* find(const model::topic_partition& tp) const {
+        auto it = _topics.find(tp.topic);
+        if (it == _topics.end()) {
+            return nullptr;
+        }
+        return it->second.find(tp.partition);
+    }
+
+    const partitions* find(const model::topic& topic) const {
+        auto it = _topics.find(topic);
+        return it == _topics.end() ? nullptr : &it->second;
+    }
+
+    bool contains(const model::topic_partition& tp) const {
+        return find(tp) != nullptr;
+    }
+
+    /// Inserts the value replacing the one of the partition if any
+    V& insert(const model::topic_partition& tp, value_ptr value) {
+        auto& ps = _topics[tp.topic];
+        auto it = ps.lower_bound(tp.partition);
+        if (it != ps._entries.end() && it->id == tp.partition) {
+            it->value = std::move(value);
+            return *it->value;
+        }
+        // commits are usually for new partitions at the end of the topic
+        const auto pos = it - ps._entries.begin();
+        ps._entries.push_back({.id = tp.partition, .value = std::move(value)});
+        std::rotate(
+          ps._entries.begin() + pos,
+          ps._entries.end() - 1,
+          ps._entries.end());
+        ++_size;
+        return *ps._entries[pos].value;
+    }
+
+    value_ptr extract(const model::topic_partition& tp) {
+        auto t_it = _topics.find(tp.topic);
+        if (t_it == _topics.end()) {
+            return nullptr;
+        }
+        auto& entries = t_it->second._entries;
+        auto it = t_it->second.lower_bound(tp.partition);
+        if (it == entries.end() || it->id != tp.partition) {
+            return nullptr;
+        }
+        auto value = std::move(it->value);
+        std::move(it + 1, entries.end(), it);
+        entries.pop_back();
+        if (entries.empty()) {
+            _topics.erase(t_it);
+        }
+        --_size;
+        return value;
+    }
+
+    bool erase(const model::topic_partition& tp) {
+        return extract(tp) != nullptr;
+    }
+
+    /// Number of partitions with an offset
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const topics_t& topics() const { return _topics; }
+
+    /// Calls \p f with the topic, partition id and value of every offset
+    template<typename Func>
+    void for_each(Func&& f) const {
+        for (const auto& [topic, ps] : _topics) {
+            ps.for_each(
+              [&f, &topic](model::partition_id id, V& v) { f(topic, id, v); });
+        }
+    }
+
+    void shrink_to_fit() { _topics.rehash(0); }
+
+private:
+    topics_t _topics;
+    size_t _size{0};
+};
+
+} // namespace kafka
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/produce_cpu_controller.h"
+
+#include "metrics/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/reactor.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace kafka {
+
+produce_cpu_controller::produce_cpu_controller()
+  : _target(config::shard_local_cfg()
+              .kafka_produce_cpu_throttle_target_utilization.bind())
+  , _max_delay(
+      config::shard_local_cfg().kafka_produce_cpu_throttle_max_delay_ms.bind())
+  , _last_total_busy_time(ss::engine().total_busy_time()) {
+    setup_metrics();
+}
+
+std::chrono::milliseconds produce_cpu_controller::current_delay() {
+    if (!_target().has_value()) {
+        return std::chrono::milliseconds{0};
+    }
+    sample();
+    if (_last_delay > std::chrono::milliseconds{0}) {
+        ++_throttled_requests;
+    }
+    return _last_delay;
+}
+
+std::chrono::milliseconds produce_cpu_controller::delay_for(
+  double utilization, double target, std::chrono::milliseconds max_delay) {
+    if (utilization <= target || target >= 1.0) {
+        return std::chrono::milliseconds{0};
+    }
+    auto excess = std::min(1.0, (utilization - target) / (1.0 - target));
+    return std::chrono::milliseconds(
+      std::lround(excess * static_cast<double>(max_delay.count())));
+}
+
+void produce_cpu_controller::sample() {
+    auto now = ss::sched_clock::now();
+    auto dt = now - _last_sampled_time;
+    if (dt < sample_interval) {
+        return;
+    }
+    auto total_busy_time = ss::engine().total_busy_time();
+    auto db = total_busy_time - _last_total_busy_time;
+    _last_total_busy_time = total_busy_time;
+    _last_sampled_time = now;
+
+    auto busy = std::clamp(
+      std::chrono::duration<double>(db) / std::chrono::duration<double>(dt),
+      0.0,
+      1.0);
+    _utilization += smoothing * (busy - _utilization);
+    _last_delay = delay_for(
+      _utilization, _target().value_or(1.0), _max_delay());
+}
+
+void produce_cpu_controller::setup_metrics() {
+    namespace sm = ss::metrics;
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka_produce_cpu_throttle"),
+      {
+        sm::make_gauge(
+          "utilization",
+          [this] { return _utilization; },
+          sm::description("Smoothed reactor utilization seen by the produce "
+                          "CPU throttle.")),
+        sm::make_gauge(
+          "delay_ms",
+          [this] { return _last_delay.count(); },
+          sm::description("Current produce throttle delay due to CPU "
+                          "utilization.")),
+        sm::make_counter(
+          "throttled_requests_total",
+          [this] { return _throttled_requests; },
+          sm::description("Number of produce requests throttled due to CPU "
+                          "utilization.")),
+      },
+      {},
+      {sm::shard_label});
+}
+
+} // namespace kafka
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/configuration.h"
+#include "metrics/metrics.h"
+
+#include <seastar/core/scheduling.hh>
+
+#include <chrono>
+#include <optional>
+
+namespace kafka {
+
+/*
+ * Throttles produce requests while the reactor of the shard is saturated.
+ *
+ * The byte based quotas don't see the CPU cost of a request. Compression,
+ * batch validation or compaction can saturate the shard at a throughput
+ * well below the configured limits, produce requests then keep queueing and
+ * latencies grow without bound. The controller samples the reactor
+ * utilization and, once the smoothed utilization is above
+ * kafka_produce_cpu_throttle_target_utilization, returns a delay in
+ * proportion to how far above the target it is. The delay is reported to
+ * clients as the produce throttle time, well behaved clients back off
+ * before the shard is overloaded.
+ */
+class produce_cpu_controller {
+    static constexpr auto sample_interval = std::chrono::milliseconds(100);
+    /// Weight of the newest sample in the smoothed utilization
+    static constexpr double smoothing = 0.5;
+
+public:
+    produce_cpu_controller();
+
+    /*
+     * Returns the delay that should be applied to a produce request, zero if
+     * the reactor is below the target utilization or throttling is disabled.
+     */
+    std::chrono::milliseconds current_delay();
+
+    /*
+     * The delay for a reactor \p utilization, grows linearly from zero at
+     * \p target to \p max_delay at full utilization.
+     */
+    static std::chrono::milliseconds delay_for(
+      double utilization, double target, std::chrono::milliseconds max_delay);
+
+private:
+    void sample();
+    void setup_metrics();
+
+    config::binding<std::optional<double>> _target;
+    config::binding<std::chrono::milliseconds> _max_delay;
+
+    double _utilization{0.0};
+    std::chrono::milliseconds _last_delay{0};
+    ss::sched_clock::duration _last_total_busy_time{0};
+    ss::sched_clock::time_point _last_sampled_time{ss::sched_clock::now()};
+    uint64_t _throttled_requests{0};
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace kafka
@@ -119,6 +119,11 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
 
     auto& buf = response->buf();
     buf.prepend(std::move(header));
+    // responses interleave tiny encoded fields with shared record batches,
+    // coalesce the former to keep the number of chunks handed to the socket
+    // down
+    static constexpr size_t small_fragment_bytes = 512;
+    buf.linearize_if_fragmented(small_fragment_bytes);
     ss::scattered_message<char> msg;
     auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
     int32_t chunk_no = 0;
@@ -36,6 +36,7 @@
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <utility>
 #include <variant>
 
 using namespace std::chrono_literals;
@@ -159,6 +160,8 @@ quota_manager::quota_manager(
   , _default_window_width(config::shard_local_cfg().default_window_sec.bind())
   , _replenish_threshold(
       config::shard_local_cfg().kafka_throughput_replenish_threshold.bind())
+  , _shard_sync_interval(
+      config::shard_local_cfg().kafka_quota_shard_sync_interval_ms.bind())
   , _translator{client_quota_store}
   , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
   , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {
@@ -388,6 +391,49 @@ clock::duration quota_manager::cap_to_max_delay(
     return delay;
 }
 
+uint64_t
+quota_manager::shard_allowance(const atomic_token_bucket& bucket) const {
+    const auto interval_ms = static_cast<uint64_t>(
+      _shard_sync_interval()->count());
+    return bucket.rate() * interval_ms / 1000 / ss::smp::count;
+}
+
+clock::duration quota_manager::update_and_calculate_delay(
+  atomic_token_bucket& bucket,
+  shard_usage& usage,
+  clock::time_point now,
+  uint64_t v) {
+    const auto interval = _shard_sync_interval();
+    if (!interval) {
+        return bucket.update_and_calculate_delay<clock::duration>(now, v);
+    }
+    usage.pending += v;
+    if (
+      usage.pending <= shard_allowance(bucket)
+      && now - usage.last_sync < *interval) {
+        // keep applying the delay of the last sync until it has passed
+        return usage.throttled_until > now ? usage.throttled_until - now
+                                           : clock::duration::zero();
+    }
+    auto delay = bucket.update_and_calculate_delay<clock::duration>(
+      now, std::exchange(usage.pending, 0));
+    usage.last_sync = now;
+    usage.throttled_until = now + delay;
+    return delay;
+}
+
+void quota_manager::record(
+  atomic_token_bucket& bucket, shard_usage& usage, uint64_t v) {
+    if (!_shard_sync_interval()) {
+        bucket.record(v);
+        return;
+    }
+    usage.pending += v;
+    if (usage.pending > shard_allowance(bucket)) {
+        bucket.record(std::exchange(usage.pending, 0));
+    }
+}
+
 // record a new observation and return <previous delay, new delay>
 ss::future<clock::duration> quota_manager::record_produce_tp_and_throttle(
   std::optional<std::string_view> client_id,
@@ -417,13 +463,12 @@ ss::future<clock::duration> quota_manager::record_produce_tp_and_throttle(
         co_return clock::duration::zero();
     }
     auto delay = co_await maybe_add_and_retrieve_quota(
-      key, now, [now, bytes](quota_manager::client_quota& cq) {
+      key, now, [this, now, bytes](quota_manager::client_quota& cq) {
           if (!cq.tp_produce_rate.has_value()) {
               return clock::duration::zero();
           }
-          auto& produce_tracker = cq.tp_produce_rate.value();
-          return produce_tracker.update_and_calculate_delay<clock::duration>(
-            now, bytes);
+          return update_and_calculate_delay(
+            cq.tp_produce_rate.value(), cq.produce_usage.local(), now, bytes);
       });
 
     auto capped_delay = cap_to_max_delay(key, delay);
@@ -465,12 +510,11 @@ ss::future<> quota_manager::record_fetch_tp(
         co_return;
     }
     auto delay [[maybe_unused]] = co_await maybe_add_and_retrieve_quota(
-      key, now, [bytes](quota_manager::client_quota& cq) {
+      key, now, [this, bytes](quota_manager::client_quota& cq) {
           if (!cq.tp_fetch_rate.has_value()) {
               return clock::duration::zero();
           }
-          auto& fetch_tracker = cq.tp_fetch_rate.value();
-          fetch_tracker.record(bytes);
+          record(cq.tp_fetch_rate.value(), cq.fetch_usage.local(), bytes);
           return clock::duration::zero();
       });
 }
@@ -500,12 +544,12 @@ ss::future<clock::duration> quota_manager::throttle_fetch_tp(
     }
 
     auto delay = co_await maybe_add_and_retrieve_quota(
-      key, now, [now](quota_manager::client_quota& cq) {
+      key, now, [this, now](quota_manager::client_quota& cq) {
           if (!cq.tp_fetch_rate.has_value()) {
               return clock::duration::zero();
           }
-          auto& fetch_tracker = cq.tp_fetch_rate.value();
-          return fetch_tracker.update_and_calculate_delay<clock::duration>(now);
+          return update_and_calculate_delay(
+            cq.tp_fetch_rate.value(), cq.fetch_usage.local(), now, 0);
       });
 
     auto capped_delay = cap_to_max_delay(key, delay);
@@ -56,16 +56,28 @@ class quota_manager : public ss::peering_sharded_service<quota_manager> {
 public:
     using clock = ss::lowres_clock;
 
+    // Usage recorded on a shard since it last synced with a token bucket,
+    // and the throttling delay that sync resulted in.
+    struct shard_usage {
+        uint64_t pending{0};
+        clock::time_point last_sync;
+        clock::time_point throttled_until;
+    };
+
     // Accounting for quota on per-client and per-client-group basis
     // last_seen_ms: used for gc keepalive
     // tp_produce_rate: produce throughput tracking
     // tp_fetch_rate: fetch throughput tracking
     // pm_rate: partition mutation quota tracking
+    // produce_usage, fetch_usage: shard local usage not yet applied to the
+    // token buckets (see kafka_quota_shard_sync_interval_ms)
     struct client_quota {
         ssx::sharded_value<clock::time_point> last_seen_ms;
         std::optional<atomic_token_bucket> tp_produce_rate;
         std::optional<atomic_token_bucket> tp_fetch_rate;
         std::optional<atomic_token_bucket> pm_rate;
+        ssx::sharded_value<shard_usage> produce_usage{shard_usage{}};
+        ssx::sharded_value<shard_usage> fetch_usage{shard_usage{}};
     };
 
     // Note: the use of std::shared_ptr<> is generally discouraged in the
@@ -131,6 +143,15 @@ private:
 
     clock::duration cap_to_max_delay(const tracker_key&, clock::duration);
 
+    // Token bucket accessors honouring kafka_quota_shard_sync_interval_ms.
+    // With the interval set, usage is accumulated in the shard local
+    // shard_usage and only applied to the shared bucket once the shard went
+    // over its share of the rate for the interval or the interval elapsed.
+    clock::duration update_and_calculate_delay(
+      atomic_token_bucket&, shard_usage&, clock::time_point now, uint64_t v);
+    void record(atomic_token_bucket&, shard_usage&, uint64_t v);
+    uint64_t shard_allowance(const atomic_token_bucket&) const;
+
     // erase inactive tracked quotas. windows are considered inactive if they
     // have not received any updates in ten window's worth of time.
     void gc();
@@ -149,6 +170,8 @@ private:
     config::binding<int16_t> _default_num_windows;
     config::binding<std::chrono::milliseconds> _default_window_width;
     config::binding<std::optional<int64_t>> _replenish_threshold;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _shard_sync_interval;
 
     local_map_t _local_map;
     std::optional<global_map_t> _global_map; // Only on shard 0
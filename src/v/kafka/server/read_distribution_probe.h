@@ -37,6 +37,13 @@ public:
         _read_distribution.record(delta_from_tip);
     };
 
+    /// Attributes a partition read to tiered storage or the local log
+    void add_read(bool from_cloud, size_t bytes, std::chrono::microseconds t) {
+        auto& src = from_cloud ? _cloud : _local;
+        src.bytes += bytes;
+        src.read_time.record(t.count());
+    }
+
     void setup_metrics() {
         namespace sm = ss::metrics;
 
@@ -57,10 +64,48 @@ public:
           },
           {},
           {sm::shard_label});
+
+        for (auto [name, src] : {
+               std::make_pair("local", &_local),
+               std::make_pair("cloud", &_cloud),
+             }) {
+            std::vector<sm::label_instance> labels{
+              sm::label("source")(name),
+              sm::label("latency_metric")("microseconds")};
+            _metrics.add_group(
+              prometheus_sanitize::metrics_name("kafka_fetch"),
+              {
+                sm::make_counter(
+                  "read_bytes",
+                  [src] { return src->bytes; },
+                  sm::description(
+                    "Bytes read by fetches, by whether they came from the "
+                    "local log or tiered storage"),
+                  labels),
+                sm::make_histogram(
+                  "read_time_us",
+                  sm::description(
+                    "Time spent reading a partition for a fetch, by whether "
+                    "it came from the local log or tiered storage"),
+                  labels,
+                  [src] {
+                      return src->read_time.internal_histogram_logform();
+                  }),
+              },
+              {},
+              {sm::shard_label});
+        }
     }
 
 private:
+    struct source_stats {
+        uint64_t bytes{0};
+        log_hist_internal read_time;
+    };
+
     hist_t _read_distribution;
+    source_stats _local;
+    source_stats _cloud;
     metrics::internal_metric_groups _metrics;
 };
 
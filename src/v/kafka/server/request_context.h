@@ -204,6 +204,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    metadata_snapshot& get_metadata_snapshot() {
+        return _conn->server().get_metadata_snapshot();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, protocol::encoder& writer, api_version version) {
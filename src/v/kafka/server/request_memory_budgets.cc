@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/request_memory_budgets.h"
+
+#include "base/unreachable.h"
+#include "config/configuration.h"
+#include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
+#include "kafka/protocol/schemata/produce_request.h"
+#include "metrics/prometheus_sanitize.h"
+#include "ssx/sformat.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+
+namespace kafka {
+
+request_memory_class request_memory_class_for(api_key key) noexcept {
+    switch (key) {
+    case produce_api::key:
+        return request_memory_class::produce;
+    case fetch_api::key:
+        return request_memory_class::fetch;
+    case metadata_api::key:
+        return request_memory_class::metadata;
+    default:
+        return request_memory_class::other;
+    }
+}
+
+std::string_view to_string_view(request_memory_class c) noexcept {
+    switch (c) {
+    case request_memory_class::produce:
+        return "produce";
+    case request_memory_class::fetch:
+        return "fetch";
+    case request_memory_class::metadata:
+        return "metadata";
+    case request_memory_class::other:
+        return "other";
+    }
+    unreachable();
+}
+
+namespace {
+size_t budget_capacity(size_t total_memory, request_memory_class c) {
+    auto share = request_memory_budgets::shares[static_cast<size_t>(c)];
+    // never zero, every request type has to be able to make progress
+    return std::max<size_t>(
+      1, static_cast<size_t>(static_cast<double>(total_memory) * share));
+}
+} // namespace
+
+request_memory_budgets::budget::budget(size_t capacity, std::string_view name)
+  : capacity(capacity)
+  , sem(capacity, ssx::sformat("kafka/request-mem-{}", name)) {}
+
+request_memory_budgets::request_memory_budgets(size_t total_memory)
+  : _budgets{
+      budget(
+        budget_capacity(total_memory, request_memory_class::produce),
+        to_string_view(request_memory_class::produce)),
+      budget(
+        budget_capacity(total_memory, request_memory_class::fetch),
+        to_string_view(request_memory_class::fetch)),
+      budget(
+        budget_capacity(total_memory, request_memory_class::metadata),
+        to_string_view(request_memory_class::metadata)),
+      budget(
+        budget_capacity(total_memory, request_memory_class::other),
+        to_string_view(request_memory_class::other)),
+    } {}
+
+ss::future<ssx::semaphore_units>
+request_memory_budgets::reserve(api_key key, size_t bytes) {
+    auto& b = get(request_memory_class_for(key));
+    auto units = std::min(bytes, b.capacity);
+    if (b.sem.waiters() == 0) {
+        if (auto u = ss::try_get_units(b.sem, units); u.has_value()) {
+            co_return std::move(*u);
+        }
+    }
+    ++b.waits;
+    auto start = clock::now();
+    auto u = co_await ss::get_units(b.sem, units);
+    b.wait_time += clock::now() - start;
+    co_return u;
+}
+
+void request_memory_budgets::setup_metrics(std::string_view group_name) {
+    namespace sm = ss::metrics;
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    std::vector<sm::metric_definition> defs;
+    for (size_t i = 0; i < num_classes; ++i) {
+        auto c = static_cast<request_memory_class>(i);
+        std::vector<sm::label_instance> labels{
+          sm::label("request_type")(ss::sstring(to_string_view(c)))};
+        defs.push_back(sm::make_gauge(
+          "request_memory_avail_bytes",
+          [this, c] { return available(c); },
+          sm::description(
+            "Memory available to in flight requests of this type"),
+          labels));
+        defs.push_back(sm::make_counter(
+          "request_memory_waits_total",
+          [this, c] { return waits(c); },
+          sm::description(
+            "Number of requests which waited for the memory budget of their "
+            "type"),
+          labels));
+        defs.push_back(sm::make_counter(
+          "request_memory_wait_seconds_total",
+          [this, c] {
+              return std::chrono::duration<double>(wait_time(c)).count();
+          },
+          sm::description(
+            "Total time requests of this type waited for their memory budget"),
+          labels));
+    }
+    _metrics.add_group(prometheus_sanitize::metrics_name(group_name), defs);
+}
+
+} // namespace kafka
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "kafka/protocol/types.h"
+#include "metrics/metrics.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace kafka {
+
+/// Request types which get their own share of the request memory
+enum class request_memory_class : uint8_t {
+    produce,
+    fetch,
+    metadata,
+    /// Everything else, mostly group coordination and admin requests
+    other,
+};
+
+request_memory_class request_memory_class_for(api_key) noexcept;
+std::string_view to_string_view(request_memory_class) noexcept;
+
+/// Per request type limits on the memory of in flight requests
+///
+/// All kafka requests reserve their memory estimate from the server memory
+/// semaphore, which is first come first served. A burst of large fetch
+/// requests can take all of it and produce requests then queue behind them.
+/// Before the server memory each request reserves the same amount from the
+/// budget of its request type. Every budget is capped at a share of the
+/// total and the shares leave headroom for the other types, e.g. fetches
+/// never hold more than 60% of the request memory, so at least 20% is left
+/// for produce requests even while metadata and other requests use all of
+/// theirs.
+///
+/// The time spent waiting for a budget is exposed per request type.
+class request_memory_budgets {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr size_t num_classes = 4;
+    /// Share of the total request memory each request type may use, indexed
+    /// by request_memory_class
+    static constexpr std::array<double, num_classes> shares{
+      0.6, 0.6, 0.2, 0.2};
+
+    explicit request_memory_budgets(size_t total_memory);
+
+    /// Wait until \p bytes fit in the budget of the request type of \p key
+    ///
+    /// A request larger than the whole budget only waits for the budget to
+    /// be unused, the server memory semaphore still accounts for all of it.
+    ss::future<ssx::semaphore_units> reserve(api_key key, size_t bytes);
+
+    size_t available(request_memory_class c) const noexcept {
+        return get(c).sem.current();
+    }
+    size_t capacity(request_memory_class c) const noexcept {
+        return get(c).capacity;
+    }
+    /// Number of reservations which had to wait
+    uint64_t waits(request_memory_class c) const noexcept {
+        return get(c).waits;
+    }
+    /// Total time spent waiting for the budget
+    clock::duration wait_time(request_memory_class c) const noexcept {
+        return get(c).wait_time;
+    }
+
+    void setup_metrics(std::string_view group_name);
+
+private:
+    struct budget {
+        budget(size_t capacity, std::string_view name);
+
+        size_t capacity;
+        ssx::semaphore sem;
+        uint64_t waits{0};
+        clock::duration wait_time{0};
+    };
+
+    budget& get(request_memory_class c) noexcept {
+        return _budgets[static_cast<size_t>(c)];
+    }
+    const budget& get(request_memory_class c) const noexcept {
+        return _budgets[static_cast<size_t>(c)];
+    }
+
+    std::array<budget, num_classes> _budgets;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace kafka
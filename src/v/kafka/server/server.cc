@@ -182,6 +182,8 @@ server::server(
         cfg->local().max_service_memory_per_core
         * config::shard_local_cfg().kafka_memory_share_for_fetch()),
       "kafka/server-mem-fetch")
+  , _memory_budgets(
+      static_cast<size_t>(cfg->local().max_service_memory_per_core))
   , _probe(std::make_unique<class latency_probe>())
   , _sasl_probe(std::make_unique<class sasl_probe>())
   , _read_dist_probe(std::make_unique<read_distribution_probe>())
@@ -219,6 +221,7 @@ void server::setup_metrics() {
           sm::description(ssx::sformat(
             "{}: Memory available for fetch request processing", cfg.name))),
       });
+    _memory_budgets.setup_metrics(cfg.name);
 }
 
 ss::scheduling_group server::fetch_scheduling_group() const {
@@ -17,6 +17,8 @@
 #include "kafka/protocol/types.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/fetch_metadata_cache.h"
+#include "kafka/server/metadata_snapshot.h"
+#include "kafka/server/produce_cpu_controller.h"
 #include "kafka/server/fetch_pid_controller.h"
 #include "kafka/server/fetch_session_cache.h"
 #include "kafka/server/fwd.h"
@@ -26,6 +28,7 @@
 #include "kafka/server/queue_depth_monitor.h"
 #include "kafka/server/queue_depth_monitor_config.h"
 #include "kafka/server/read_distribution_probe.h"
+#include "kafka/server/request_memory_budgets.h"
 #include "kafka/server/sasl_probe.h"
 #include "metrics/metrics.h"
 #include "net/server.h"
@@ -178,6 +181,10 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::metadata_snapshot& get_metadata_snapshot() {
+        return _metadata_snapshot;
+    }
+
     security::gssapi_principal_mapper& gssapi_principal_mapper() {
         return _gssapi_principal_mapper;
     }
@@ -219,8 +226,16 @@ public:
         return _fetch_pid_controller;
     }
 
+    produce_cpu_controller& cpu_controller() noexcept {
+        return _produce_cpu_controller;
+    }
+
     ssx::semaphore& memory_fetch_sem() noexcept { return _memory_fetch_sem; }
 
+    request_memory_budgets& memory_budgets() noexcept {
+        return _memory_budgets;
+    }
+
     ss::future<> revoke_credentials(std::string_view name);
 
 private:
@@ -241,6 +256,7 @@ private:
     ss::sharded<cluster::shard_table>& _shard_table;
     ss::sharded<cluster::partition_manager>& _partition_manager;
     kafka::fetch_pid_controller _fetch_pid_controller;
+    kafka::produce_cpu_controller _produce_cpu_controller;
     kafka::fetch_session_cache _fetch_session_cache;
     ss::sharded<cluster::id_allocator_frontend>& _id_allocator_frontend;
     bool _is_idempotence_enabled{false};
@@ -255,10 +271,12 @@ private:
     ss::sharded<cluster::tx_gateway_frontend>& _tx_gateway_frontend;
     std::optional<qdc_monitor> _qdc_mon;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    kafka::metadata_snapshot _metadata_snapshot;
     security::tls::principal_mapper _mtls_principal_mapper;
     security::gssapi_principal_mapper _gssapi_principal_mapper;
     security::krb5::configurator _krb_configurator;
     ssx::semaphore _memory_fetch_sem;
+    request_memory_budgets _memory_budgets;
 
     handler_probe_manager _handler_probes;
     metrics::internal_metric_groups _metrics;
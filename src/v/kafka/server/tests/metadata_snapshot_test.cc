@@ -0,0 +1,121 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/server/metadata_snapshot.h"
+#include "model/metadata.h"
+
+#include <gtest/gtest.h>
+
+namespace kafka {
+namespace {
+
+// the metadata handler supports versions 0-8
+constexpr int16_t max_supported_version = 8;
+
+metadata_response::topic make_topic(int i, int partitions) {
+    metadata_response::topic t;
+    t.error_code = error_code::none;
+    t.name = model::topic(fmt::format("topic-{}", i));
+    t.is_internal = i % 2 == 0;
+    for (int p = 0; p < partitions; ++p) {
+        metadata_response::partition part;
+        part.error_code = p == 1 ? error_code::replica_not_available
+                                 : error_code::none;
+        part.partition_index = model::partition_id(p);
+        part.leader_id = model::node_id(p % 3);
+        part.leader_epoch = leader_epoch(p + 10);
+        part.replica_nodes = {
+          model::node_id(0), model::node_id(1), model::node_id(2)};
+        part.isr_nodes = part.replica_nodes;
+        t.partitions.push_back(std::move(part));
+    }
+    return t;
+}
+
+metadata_response make_response(int topics) {
+    metadata_response r;
+    r.data.throttle_time_ms = std::chrono::milliseconds(5);
+    r.data.brokers.push_back(metadata_response::broker{
+      .node_id = model::node_id(0), .host = "localhost", .port = 9092});
+    r.data.cluster_id = "redpanda.test";
+    r.data.controller_id = model::node_id(0);
+    r.data.cluster_authorized_operations = 42;
+    for (int i = 0; i < topics; ++i) {
+        r.data.topics.push_back(make_topic(i, 4));
+    }
+    return r;
+}
+
+iobuf encode(metadata_response& r, api_version v) {
+    iobuf out;
+    protocol::encoder writer(out);
+    r.encode(writer, v);
+    return out;
+}
+
+} // namespace
+
+TEST(MetadataSnapshotTest, EncodedTopicsMatchGeneratedEncoding) {
+    for (int16_t ver = 0; ver <= max_supported_version; ++ver) {
+        const api_version v(ver);
+        auto expected_response = make_response(3);
+        const auto expected = encode(expected_response, v);
+
+        // every other topic encoded ahead of time
+        auto response = make_response(3);
+        small_fragment_vector<metadata_response::topic> topics;
+        for (size_t i = 0; i < response.data.topics.size(); ++i) {
+            auto& t = response.data.topics[i];
+            if (i % 2 == 0) {
+                topics.push_back(std::move(t));
+                continue;
+            }
+            iobuf encoded;
+            protocol::encoder writer(encoded);
+            encode_metadata_topic(writer, t, v);
+            response.encoded_topics.push_back(std::move(encoded));
+        }
+        response.data.topics = std::move(topics);
+
+        EXPECT_EQ(encode(response, v), expected) << "version " << v;
+        EXPECT_TRUE(response.encoded_topics.empty());
+    }
+}
+
+TEST(MetadataSnapshotTest, SharedEntryEncoding) {
+    auto topic = make_topic(1, 8);
+    topic.topic_authorized_operations = 7;
+    const metadata_snapshot::topic_entry entry(make_topic(1, 8));
+
+    for (int16_t ver = 0; ver <= max_supported_version; ++ver) {
+        const api_version v(ver);
+        iobuf expected;
+        protocol::encoder expected_writer(expected);
+        encode_metadata_topic(expected_writer, topic, v);
+
+        // the entry doesn't carry the authorized operations, they are
+        // appended per request
+        auto encoded = entry.encoded(v);
+        if (v >= api_version(8)) {
+            protocol::encoder writer(encoded);
+            writer.write(topic.topic_authorized_operations);
+        }
+        EXPECT_EQ(encoded, expected) << "version " << v;
+
+        // appending to the shared buffer doesn't modify the cached encoding
+        EXPECT_EQ(entry.encoded(v), entry.encoded(v));
+        ASSERT_EQ(
+          entry.encoded(v).size_bytes() + (v >= api_version(8) ? 4 : 0),
+          expected.size_bytes());
+    }
+}
+
+} // namespace kafka
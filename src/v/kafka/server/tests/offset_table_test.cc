@@ -0,0 +1,108 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/offset_table.h"
+#include "model/fundamental.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace kafka {
+namespace {
+
+using table_t = offset_table<int64_t>;
+
+model::topic_partition tp(std::string_view topic, int32_t partition) {
+    return {model::topic(topic), model::partition_id(partition)};
+}
+
+std::vector<int32_t> partitions_of(const table_t& t, std::string_view topic) {
+    std::vector<int32_t> ids;
+    if (const auto* ps = t.find(model::topic(topic)); ps) {
+        ps->for_each(
+          [&ids](model::partition_id id, int64_t&) { ids.push_back(id()); });
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(OffsetTableTest, InsertFindErase) {
+    table_t t;
+    EXPECT_TRUE(t.empty());
+    EXPECT_EQ(t.find(tp("a", 0)), nullptr);
+
+    t.insert(tp("a", 0), std::make_unique<int64_t>(10));
+    t.insert(tp("a", 1), std::make_unique<int64_t>(11));
+    t.insert(tp("b", 0), std::make_unique<int64_t>(20));
+    EXPECT_EQ(t.size(), 3);
+    EXPECT_EQ(t.topics().size(), 2);
+    ASSERT_NE(t.find(tp("a", 1)), nullptr);
+    EXPECT_EQ(*t.find(tp("a", 1)), 11);
+    EXPECT_FALSE(t.contains(tp("a", 2)));
+    EXPECT_FALSE(t.contains(tp("c", 0)));
+
+    // replacing keeps the size
+    t.insert(tp("a", 1), std::make_unique<int64_t>(12));
+    EXPECT_EQ(t.size(), 3);
+    EXPECT_EQ(*t.find(tp("a", 1)), 12);
+
+    auto v = t.extract(tp("a", 0));
+    ASSERT_NE(v, nullptr);
+    EXPECT_EQ(*v, 10);
+    EXPECT_EQ(t.size(), 2);
+    EXPECT_EQ(*t.find(tp("a", 1)), 12);
+    EXPECT_FALSE(t.erase(tp("a", 0)));
+
+    // the topic goes away with its last partition
+    EXPECT_TRUE(t.erase(tp("b", 0)));
+    EXPECT_EQ(t.find(model::topic("b")), nullptr);
+    EXPECT_EQ(t.topics().size(), 1);
+}
+
+TEST(OffsetTableTest, PartitionsStayOrdered) {
+    table_t t;
+    for (int32_t p : {5, 1, 1000, 3, 0, 4, 2}) {
+        t.insert(tp("a", p), std::make_unique<int64_t>(p));
+    }
+    EXPECT_EQ(
+      partitions_of(t, "a"), (std::vector<int32_t>{0, 1, 2, 3, 4, 5, 1000}));
+    for (int32_t p : {0, 1, 2, 3, 4, 5, 1000}) {
+        ASSERT_NE(t.find(tp("a", p)), nullptr);
+        EXPECT_EQ(*t.find(tp("a", p)), p);
+    }
+    EXPECT_FALSE(t.contains(tp("a", 6)));
+    EXPECT_FALSE(t.contains(tp("a", -1)));
+
+    // sparse after erasing from the middle
+    t.erase(tp("a", 2));
+    EXPECT_EQ(
+      partitions_of(t, "a"), (std::vector<int32_t>{0, 1, 3, 4, 5, 1000}));
+    EXPECT_EQ(*t.find(tp("a", 3)), 3);
+    EXPECT_EQ(*t.find(tp("a", 1000)), 1000);
+    EXPECT_FALSE(t.contains(tp("a", 2)));
+}
+
+TEST(OffsetTableTest, ValuesAreStable) {
+    table_t t;
+    auto* first = &t.insert(tp("a", 10), std::make_unique<int64_t>(10));
+    for (int32_t p = 0; p < 10; ++p) {
+        t.insert(tp("a", p), std::make_unique<int64_t>(p));
+    }
+    EXPECT_EQ(t.find(tp("a", 10)), first);
+
+    size_t visited = 0;
+    t.for_each([&visited](const model::topic&, model::partition_id, int64_t&) {
+        ++visited;
+    });
+    EXPECT_EQ(visited, t.size());
+}
+
+} // namespace kafka
@@ -0,0 +1,34 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/produce_cpu_controller.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace kafka {
+
+TEST(ProduceCpuControllerTest, NoDelayBelowTarget) {
+    EXPECT_EQ(produce_cpu_controller::delay_for(0.0, 0.8, 100ms), 0ms);
+    EXPECT_EQ(produce_cpu_controller::delay_for(0.8, 0.8, 100ms), 0ms);
+}
+
+TEST(ProduceCpuControllerTest, DelayProportionalToExcess) {
+    EXPECT_EQ(produce_cpu_controller::delay_for(0.85, 0.8, 100ms), 25ms);
+    EXPECT_EQ(produce_cpu_controller::delay_for(0.9, 0.8, 100ms), 50ms);
+    EXPECT_EQ(produce_cpu_controller::delay_for(1.0, 0.8, 100ms), 100ms);
+}
+
+TEST(ProduceCpuControllerTest, DelayCappedAtMax) {
+    EXPECT_EQ(produce_cpu_controller::delay_for(1.5, 0.8, 100ms), 100ms);
+    EXPECT_EQ(produce_cpu_controller::delay_for(1.0, 1.0, 100ms), 0ms);
+}
+
+} // namespace kafka
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "base/vassert.h"
+#include "container/fragmented_vector.h"
+#include "kafka/client/types.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/handlers/fetch.h"
+#include "kafka/server/handlers/produce.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "random/generators.h"
+#include "redpanda/tests/fixture.h"
+#include "test_utils/async.h"
+#include "test_utils/fixture.h"
+
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+using namespace std::chrono_literals; // NOLINT
+
+/*
+ * Round trips a batch through the whole broker side of the kafka path: the
+ * encoded produce request is decoded and handled by produce_handler, goes
+ * through raft and storage, and is read back with an encoded fetch
+ * response. Unlike produce_partition_bench and fetch_bench, which measure a
+ * single stage of one of the handlers, regressions in any layer show up
+ * here. perf_tests reports allocations, tasks and instructions per op.
+ */
+struct produce_fetch_fixture : redpanda_thread_fixture {
+    static constexpr size_t topic_name_length = 30;
+    static constexpr size_t records_per_batch = 10;
+
+    model::topic t;
+    model::offset next_offset{0};
+
+    produce_fetch_fixture() {
+        wait_for_controller_leadership().get();
+
+        t = model::topic(
+          random_generators::gen_alphanum_string(topic_name_length));
+        add_topic(model::topic_namespace_view(model::kafka_namespace, t), 1)
+          .get();
+        wait_for_leader(make_default_ntp(t, model::partition_id(0))).get();
+    }
+
+    kafka::request_context
+    make_produce_context(size_t record_size, conn_ptr conn) {
+        storage::record_batch_builder builder(
+          model::record_batch_type::raft_data, model::offset{0});
+        for (size_t i = 0; i < records_per_batch; ++i) {
+            builder.add_raw_kv(iobuf{}, rand_iobuf(record_size));
+        }
+
+        chunked_vector<kafka::produce_request::partition> partitions;
+        partitions.push_back(kafka::produce_request::partition{
+          .partition_index{model::partition_id(0)},
+          .records = kafka::produce_request_record_data(
+            std::move(builder).build())});
+
+        chunked_vector<kafka::produce_request::topic> topics;
+        topics.push_back(kafka::produce_request::topic{
+          .name{t}, .partitions{std::move(partitions)}});
+
+        kafka::request_header header{
+          .key = kafka::produce_handler::api::key,
+          .version = kafka::produce_handler::max_supported};
+        return make_request_context(
+          kafka::produce_request(std::nullopt, -1, std::move(topics)),
+          header,
+          std::move(conn));
+    }
+
+    kafka::request_context
+    make_fetch_context(model::offset offset, conn_ptr conn) {
+        kafka::fetch_partition fp;
+        fp.partition_index = model::partition_id(0);
+        fp.fetch_offset = offset;
+        fp.current_leader_epoch = kafka::leader_epoch(-1);
+        fp.log_start_offset = model::offset(-1);
+        fp.max_bytes = 1_MiB;
+
+        kafka::fetch_topic ft;
+        ft.name = t;
+        ft.fetch_partitions.push_back(std::move(fp));
+
+        kafka::fetch_request_data data;
+        data.replica_id = kafka::client::consumer_replica_id;
+        data.max_wait_ms = 0ms;
+        data.min_bytes = 1;
+        data.max_bytes = 1_MiB;
+        data.isolation_level = model::isolation_level::read_uncommitted;
+        data.session_id = kafka::invalid_fetch_session_id;
+        data.session_epoch = kafka::final_fetch_session_epoch;
+        data.topics.push_back(std::move(ft));
+
+        kafka::request_header header{
+          .key = kafka::fetch_handler::api::key,
+          .version = kafka::fetch_handler::max_supported};
+        return make_request_context(
+          kafka::fetch_request{.data = std::move(data)},
+          header,
+          std::move(conn));
+    }
+
+    ss::future<size_t> run_test(size_t record_size) {
+        auto conn = make_connection_context();
+        co_await conn->start();
+
+        // requests are encoded up front, decoding them is part of the
+        // measured path
+        auto produce_ctx = make_produce_context(record_size, conn);
+        auto fetch_ctx = make_fetch_context(next_offset, conn);
+        next_offset += model::offset(records_per_batch);
+
+        co_await tests::drain_task_queue();
+
+        perf_tests::start_measuring_time();
+        auto produced = kafka::produce_handler::handle(
+          std::move(produce_ctx), ss::default_smp_service_group());
+        co_await std::move(produced.dispatched);
+        auto produce_resp = co_await std::move(produced.response);
+
+        auto fetch_resp = co_await kafka::fetch_handler::handle(
+          std::move(fetch_ctx), ss::default_smp_service_group());
+        perf_tests::stop_measuring_time();
+
+        vassert(
+          produce_resp->buf().size_bytes() > 0
+            && fetch_resp->buf().size_bytes()
+                 > records_per_batch * record_size,
+          "expected the fetch to return the produced batch, got {} bytes",
+          fetch_resp->buf().size_bytes());
+        co_return 1;
+    }
+};
+
+PERF_TEST_C(produce_fetch_fixture, 16_B) {
+    co_return co_await this->run_test(16);
+}
+PERF_TEST_C(produce_fetch_fixture, 1_KiB) {
+    co_return co_await this->run_test(1_KiB);
+}
+PERF_TEST_C(produce_fetch_fixture, 16_KiB) {
+    co_return co_await this->run_test(16_KiB);
+}
+PERF_TEST_C(produce_fetch_fixture, 64_KiB) {
+    co_return co_await this->run_test(64_KiB);
+}
@@ -157,6 +157,53 @@ SEASTAR_THREAD_TEST_CASE(quota_manager_fetch_stress_test) {
       .get();
 }
 
+SEASTAR_THREAD_TEST_CASE(quota_manager_shard_local_accounting) {
+    fixture f;
+
+    set_config([](config::configuration& conf) {
+        conf.kafka_quota_shard_sync_interval_ms.set_value(
+          std::make_optional<std::chrono::milliseconds>(1s));
+    }).get();
+    auto reset = ss::defer([] {
+        set_config([](config::configuration& conf) {
+            conf.kafka_quota_shard_sync_interval_ms.reset();
+        }).get();
+    });
+
+    // each shard may use 1000 bytes per interval without syncing
+    const uint64_t shard_allowance = 1000;
+    auto default_values = entity_value{
+      .producer_byte_rate = shard_allowance * ss::smp::count,
+    };
+    f.quota_store.local().set_quota(default_key, default_values);
+
+    auto& qm = f.sqm.local();
+    auto now = kafka::quota_manager::clock::now();
+
+    // within the allowance only the shard local usage is updated
+    auto delay = qm.record_produce_tp_and_throttle(
+                     client_id, shard_allowance, now)
+                   .get();
+    BOOST_CHECK_EQUAL(delay, 0ms);
+
+    // going over it applies the pending usage to the shared bucket, which
+    // ends up over its limit by the allowance
+    delay = qm.record_produce_tp_and_throttle(
+                client_id, shard_allowance * ss::smp::count, now)
+              .get();
+    BOOST_CHECK_GT(delay, 0ms);
+
+    // until the next sync the delay from the last one is kept
+    auto local_delay = qm.record_produce_tp_and_throttle(client_id, 1, now)
+                         .get();
+    BOOST_CHECK_EQUAL(local_delay, delay);
+
+    // once the interval elapsed the bucket is synced and replenished
+    now += 2s;
+    delay = qm.record_produce_tp_and_throttle(client_id, 1, now).get();
+    BOOST_CHECK_EQUAL(delay, 0ms);
+}
+
 SEASTAR_THREAD_TEST_CASE(static_config_test) {
     using k_client_id = kafka::k_client_id;
     using k_group_name = kafka::k_group_name;
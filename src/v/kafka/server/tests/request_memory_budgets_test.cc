@@ -0,0 +1,79 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
+#include "kafka/protocol/schemata/produce_request.h"
+#include "kafka/server/request_memory_budgets.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/sleep.hh>
+
+#include <gtest/gtest.h>
+
+namespace kafka {
+namespace {
+
+constexpr size_t total_memory = 100_MiB;
+
+} // namespace
+
+TEST(RequestMemoryBudgetsTest, Classification) {
+    EXPECT_EQ(
+      request_memory_class_for(produce_api::key),
+      request_memory_class::produce);
+    EXPECT_EQ(
+      request_memory_class_for(fetch_api::key), request_memory_class::fetch);
+    EXPECT_EQ(
+      request_memory_class_for(metadata_api::key),
+      request_memory_class::metadata);
+    EXPECT_EQ(
+      request_memory_class_for(api_key(-1)), request_memory_class::other);
+}
+
+TEST_CORO(RequestMemoryBudgetsTest, FetchBurstDoesNotBlockProduce) {
+    request_memory_budgets budgets(total_memory);
+    const auto fetch_capacity = budgets.capacity(request_memory_class::fetch);
+    EXPECT_EQ(fetch_capacity, 60_MiB);
+
+    auto fetch = co_await budgets.reserve(fetch_api::key, fetch_capacity);
+    EXPECT_EQ(budgets.available(request_memory_class::fetch), 0);
+
+    // the next fetch has to wait for the first one
+    auto blocked = budgets.reserve(fetch_api::key, 1_MiB);
+    co_await ss::sleep(std::chrono::milliseconds(10));
+    EXPECT_FALSE(blocked.available());
+
+    // but produce requests are admitted right away
+    auto produce = co_await budgets.reserve(produce_api::key, 10_MiB);
+    EXPECT_EQ(produce.count(), 10_MiB);
+    EXPECT_EQ(budgets.waits(request_memory_class::produce), 0);
+
+    fetch.return_all();
+    auto units = co_await std::move(blocked);
+    EXPECT_EQ(units.count(), 1_MiB);
+    EXPECT_EQ(budgets.waits(request_memory_class::fetch), 1);
+    EXPECT_GE(
+      budgets.wait_time(request_memory_class::fetch),
+      std::chrono::milliseconds(10));
+}
+
+TEST_CORO(RequestMemoryBudgetsTest, OversizedRequestTakesWholeBudget) {
+    request_memory_budgets budgets(total_memory);
+    const auto capacity = budgets.capacity(request_memory_class::metadata);
+
+    auto units = co_await budgets.reserve(metadata_api::key, total_memory);
+    EXPECT_EQ(units.count(), capacity);
+    EXPECT_EQ(budgets.available(request_memory_class::metadata), 0);
+    units.return_all();
+    EXPECT_EQ(budgets.available(request_memory_class::metadata), capacity);
+}
+
+} // namespace kafka
@@ -607,6 +607,20 @@ enum class iceberg_mode : uint8_t {
 std::ostream& operator<<(std::ostream&, const iceberg_mode&);
 std::istream& operator>>(std::istream&, iceberg_mode&);
 
+/**
+ * Digest used by the sliding window compaction key-offset map to represent
+ * compaction keys.
+ */
+enum class compaction_key_digest : uint8_t {
+    // 32 byte cryptographic digest
+    sha256 = 0,
+    // 16 byte non-cryptographic xxh3 digest
+    xxhash3 = 1,
+};
+
+std::ostream& operator<<(std::ostream&, compaction_key_digest);
+std::istream& operator>>(std::istream&, compaction_key_digest&);
+
 } // namespace model
 
 template<>
@@ -582,6 +582,30 @@ std::istream& operator>>(std::istream& is, recovery_validation_mode& vm) {
     return is;
 }
 
+std::ostream& operator<<(std::ostream& os, compaction_key_digest d) {
+    using enum compaction_key_digest;
+    switch (d) {
+    case sha256:
+        return os << "sha256";
+    case xxhash3:
+        return os << "xxhash3";
+    }
+}
+
+std::istream& operator>>(std::istream& is, compaction_key_digest& d) {
+    using enum compaction_key_digest;
+    auto s = ss::sstring{};
+    is >> s;
+    try {
+        d = string_switch<compaction_key_digest>(s)
+              .match("sha256", sha256)
+              .match("xxhash3", xxhash3);
+    } catch (const std::runtime_error&) {
+        is.setstate(std::ios::failbit);
+    }
+    return is;
+}
+
 std::ostream& operator<<(std::ostream& os, const iceberg_mode& mode) {
     switch (mode) {
     case iceberg_mode::disabled:
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/vassert.h"
+#include "container/fragmented_vector.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "utils/named_type.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace model {
+
+/// Compact identifier of an ntp handed out by an ntp_interner
+using ntp_id = named_type<uint32_t, struct ntp_id_tag>;
+
+/**
+ * @brief Hands out compact integer ids for ntps.
+ *
+ * Per partition structures which are looked up on hot paths can be keyed by
+ * the id of the ntp rather than by the ntp itself: the id is hashed and
+ * compared as an integer and takes four bytes instead of three strings. Ids
+ * are dense, so they can also index a vector.
+ *
+ * The id of an ntp is stable until it is released, after which it may be
+ * handed out for another ntp. The interner is not thread safe, it is meant to
+ * be used as a per shard instance and ids must not cross shards.
+ */
+class ntp_interner {
+public:
+    /// Returns the id of \p ntp, assigning a new one if it has none.
+    ntp_id intern(const model::ntp& ntp) {
+        if (auto it = _ids.find(ntp); it != _ids.end()) {
+            return it->second;
+        }
+        ntp_id id;
+        if (_free.empty()) {
+            id = ntp_id(static_cast<uint32_t>(_ntps.size()));
+            _ntps.emplace_back(ntp);
+        } else {
+            id = _free.back();
+            _free.pop_back();
+            _ntps[id()] = ntp;
+        }
+        _ids.emplace(ntp, id);
+        return id;
+    }
+
+    /// Returns the id of an interned ntp, any ntp-alike can be looked up.
+    template<model::any_ntp T>
+    std::optional<ntp_id> find(const T& ntp) const {
+        if (auto it = _ids.find(ntp); it != _ids.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    /// Returns the ntp of an id which is currently interned.
+    const model::ntp& ntp(ntp_id id) const {
+        vassert(
+          id() < _ntps.size() && _ntps[id()].has_value(),
+          "ntp id {} is not interned",
+          id);
+        return *_ntps[id()];
+    }
+
+    /// Releases the id, lookups of its ntp fail afterwards.
+    void release(ntp_id id) {
+        if (id() >= _ntps.size() || !_ntps[id()].has_value()) {
+            return;
+        }
+        _ids.erase(*_ntps[id()]);
+        _ntps[id()].reset();
+        _free.push_back(id);
+    }
+
+    /// Number of interned ntps
+    size_t size() const { return _ids.size(); }
+
+private:
+    ntp_map_type<ntp_id> _ids;
+    // indexed by id, released ids are empty until they are reused
+    chunked_vector<std::optional<model::ntp>> _ntps;
+    chunked_vector<ntp_id> _free;
+};
+
+} // namespace model
@@ -13,19 +13,35 @@
 #include "model/record.h"
 #include "utils/vint.h"
 
+#include <fmt/format.h>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
 #include <type_traits>
 
 namespace model {
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_le(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_le(i);
-    crc.extend(j);
+// The fields are packed and checksummed at once rather than one at a time,
+// which would hand a few bytes at a time to the crc kernel.
+template<auto convert, typename... T>
+void crc_extend_all_packed(crc::crc32c& crc, T... t) {
+    static_assert((std::is_integral_v<T> && ...));
+    std::array<uint8_t, (sizeof(T) + ...)> packed; // NOLINT
+    size_t pos = 0;
+    (
+      [&packed, &pos](auto v) {
+          v = convert(v);
+          std::memcpy(packed.data() + pos, &v, sizeof(v));
+          pos += sizeof(v);
+      }(t),
+      ...);
+    crc.extend(packed.data(), packed.size());
 }
 
 template<typename... T>
 void crc_extend_all_cpu_to_le(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_le(crc, t)), ...);
+    crc_extend_all_packed<[](auto v) { return ss::cpu_to_le(v); }>(crc, t...);
 }
 
 /// \brief uint32_t because that's what crc32c uses
@@ -53,15 +69,9 @@ uint32_t internal_header_only_crc(const record_batch_header& header) {
     return c.value();
 }
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_be(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_be(i);
-    crc.extend(j);
-}
-
 template<typename... T>
 void crc_extend_all_cpu_to_be(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_be(crc, t)), ...);
+    crc_extend_all_packed<[](auto v) { return ss::cpu_to_be(v); }>(crc, t...);
 }
 
 void crc_record_batch_header(
@@ -175,6 +185,41 @@ model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser) {
       });
 }
 
+void skip_one_record_from_buffer(iobuf_parser_base& parser) {
+    auto skip_blob = [&parser] {
+        auto [length, _] = parser.read_varlong();
+        if (length > 0) {
+            parser.skip(length);
+        }
+    };
+    parse_record_meta_from_buffer(parser);
+    parser.read_varlong(); // timestamp delta
+    parser.read_varlong(); // offset delta
+    skip_blob();           // key
+    skip_blob();           // value
+    auto [header_count, _] = parser.read_varlong();
+    if (header_count < 0) {
+        throw std::out_of_range(
+          fmt::format("Invalid record header count: {}", header_count));
+    }
+    for (int i = 0; i < header_count; ++i) {
+        skip_blob(); // header key
+        skip_blob(); // header value
+    }
+}
+
+void verify_records(const record_batch& b) {
+    iobuf_const_parser parser(b.data());
+    for (int32_t i = 0; i < b.record_count(); ++i) {
+        skip_one_record_from_buffer(parser);
+    }
+    if (parser.bytes_left() && b.record_count() > 0) [[unlikely]] {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          parser.bytes_left()));
+    }
+}
+
 static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
     auto vb = vint::to_bytes(v);
     b.append(vb.data(), vb.size());
@@ -31,6 +31,15 @@ uint32_t internal_header_only_crc(const record_batch_header&);
 
 model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
+/// \brief walks over the record at the position of the parser checking that
+/// it can be parsed, without materializing the record
+/// \throw std::out_of_range If the record is truncated
+void skip_one_record_from_buffer(iobuf_parser_base& parser);
+/// \brief checks that the records of an uncompressed batch can be iterated
+/// over, without materializing them
+/// \throw std::out_of_range If the records are truncated or followed by extra
+/// bytes
+void verify_records(const record_batch& b);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
 } // namespace model
@@ -114,3 +114,17 @@ BOOST_AUTO_TEST_CASE(recovery_validation_mode_enum_roundtrip) {
         "this_mode_does_not_exists"),
       boost::bad_lexical_cast);
 }
+
+BOOST_AUTO_TEST_CASE(compaction_key_digest_enum_roundtrip) {
+    using enum model::compaction_key_digest;
+
+    for (auto d : {sha256, xxhash3}) {
+        BOOST_CHECK_EQUAL(
+          boost::lexical_cast<model::compaction_key_digest>(
+            fmt::format("{}", d)),
+          d);
+    }
+    BOOST_REQUIRE_THROW(
+      boost::lexical_cast<model::compaction_key_digest>("md5"),
+      boost::bad_lexical_cast);
+}
@@ -0,0 +1,67 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/namespace.h"
+#include "model/ntp_interner.h"
+
+#include <boost/test/tools/old/interface.hpp>
+#include <boost/test/unit_test.hpp>
+
+static model::ntp maken(const ss::sstring& t, int p) {
+    return model::ntp{
+      model::kafka_namespace, model::topic(t), model::partition_id(p)};
+}
+
+BOOST_AUTO_TEST_CASE(test_intern_is_idempotent) {
+    model::ntp_interner interner;
+    auto a = interner.intern(maken("a", 0));
+    auto b = interner.intern(maken("a", 1));
+    BOOST_REQUIRE_NE(a, b);
+    BOOST_REQUIRE_EQUAL(interner.intern(maken("a", 0)), a);
+    BOOST_REQUIRE_EQUAL(interner.size(), 2);
+    BOOST_REQUIRE_EQUAL(interner.ntp(a), maken("a", 0));
+    BOOST_REQUIRE_EQUAL(interner.ntp(b), maken("a", 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_find) {
+    model::ntp_interner interner;
+    auto a = interner.intern(maken("a", 0));
+    BOOST_REQUIRE(interner.find(maken("a", 0)) == a);
+    BOOST_REQUIRE(!interner.find(maken("b", 0)).has_value());
+    // lookup with ntp-alikes
+    BOOST_REQUIRE(
+      interner.find(model::ktp(model::topic("a"), model::partition_id(0)))
+      == a);
+    BOOST_REQUIRE(
+      interner.find(
+        model::ktp_with_hash(model::topic("a"), model::partition_id(0)))
+      == a);
+}
+
+BOOST_AUTO_TEST_CASE(test_release_reuses_ids) {
+    model::ntp_interner interner;
+    auto a = interner.intern(maken("a", 0));
+    auto b = interner.intern(maken("b", 0));
+
+    interner.release(a);
+    BOOST_REQUIRE_EQUAL(interner.size(), 1);
+    BOOST_REQUIRE(!interner.find(maken("a", 0)).has_value());
+    // releasing twice is a no-op
+    interner.release(a);
+    BOOST_REQUIRE_EQUAL(interner.size(), 1);
+
+    // ids stay dense
+    auto c = interner.intern(maken("c", 0));
+    BOOST_REQUIRE_EQUAL(c, a);
+    BOOST_REQUIRE_EQUAL(interner.ntp(c), maken("c", 0));
+    BOOST_REQUIRE_EQUAL(interner.ntp(b), maken("b", 0));
+    BOOST_REQUIRE(interner.find(maken("c", 0)) == c);
+}
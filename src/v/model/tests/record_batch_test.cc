@@ -106,3 +106,49 @@ SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     BOOST_TEST(it.has_next());
     BOOST_REQUIRE_THROW(it.next(), std::out_of_range);
 }
+
+SEASTAR_THREAD_TEST_CASE(verify_records) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    model::verify_records(b);
+
+    iobuf_const_parser parser(b.data());
+    auto it = model::record_batch_iterator::create(b);
+    while (it.has_next()) {
+        auto r = it.next();
+        const auto before = parser.bytes_consumed();
+        model::skip_one_record_from_buffer(parser);
+        BOOST_REQUIRE_EQUAL(
+          parser.bytes_consumed() - before,
+          static_cast<size_t>(r.size_bytes())
+            + vint::vint_size(r.size_bytes()));
+    }
+    BOOST_REQUIRE_EQUAL(parser.bytes_left(), 0);
+
+    // truncated in the middle of the value of an extra record
+    auto truncated = b.data().copy();
+    model::append_record_to_buffer(
+      truncated,
+      model::record(
+        {},
+        0,
+        b.record_count(),
+        iobuf::from("key"),
+        iobuf::from(std::string(100, 'x')),
+        {}));
+    truncated.trim_back(10);
+    auto header = b.header();
+    header.record_count += 1;
+    BOOST_REQUIRE_THROW(
+      model::verify_records(model::record_batch(
+        header, std::move(truncated), model::record_batch::tag_ctor_ng{})),
+      std::out_of_range);
+
+    // extra bytes
+    auto extra = b.data().copy();
+    constexpr std::string_view extra_data = "foobar";
+    extra.append(extra_data.data(), extra_data.size());
+    BOOST_REQUIRE_THROW(
+      model::verify_records(model::record_batch(
+        b.header(), std::move(extra), model::record_batch::tag_ctor_ng{})),
+      std::out_of_range);
+}
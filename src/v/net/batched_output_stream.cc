@@ -15,16 +15,25 @@
 
 #include <seastar/core/future.hh>
 #include <seastar/core/scattered_message.hh>
+#include <seastar/net/packet.hh>
+
+#include <algorithm>
 
 #include <fmt/format.h>
 
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o,
+  size_t cache,
+  size_t max_coalesced_message_bytes,
+  stats* out_stats)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _max_coalesced_message_bytes(
+      std::min(max_coalesced_message_bytes, coalescing_buffer_size))
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _stats(out_stats) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
@@ -46,7 +55,7 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
               return already_closed_error(v);
           }
           const size_t vbytes = v.size();
-          return _out.write(std::move(v)).then([this, vbytes] {
+          return do_write(std::move(v)).then([this, vbytes] {
               _unflushed_bytes += vbytes;
               if (
                 _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
@@ -56,12 +65,64 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
           });
       });
 }
+ss::future<> batched_output_stream::do_write(ss::scattered_message<char> msg) {
+    if (msg.size() > 0 && msg.size() <= _max_coalesced_message_bytes) {
+        if (_coalesced_bytes + msg.size() <= coalescing_buffer_size) {
+            coalesce(std::move(msg));
+            return ss::make_ready_future<>();
+        }
+        return write_coalesced().then([this, msg = std::move(msg)]() mutable {
+            coalesce(std::move(msg));
+        });
+    }
+    return write_coalesced().then([this, msg = std::move(msg)]() mutable {
+        auto p = std::move(msg).release();
+        _unflushed_fragments += p.nr_frags();
+        return _out.write(std::move(p));
+    });
+}
+
+void batched_output_stream::coalesce(ss::scattered_message<char> msg) {
+    if (_coalescing_buffer.empty()) {
+        _coalescing_buffer = ss::temporary_buffer<char>(coalescing_buffer_size);
+    }
+    auto p = std::move(msg).release();
+    for (const auto& f : p.fragments()) {
+        std::copy_n(
+          f.base, f.size, _coalescing_buffer.get_write() + _coalesced_bytes);
+        _coalesced_bytes += f.size;
+    }
+    if (_stats) {
+        ++_stats->coalesced_messages;
+    }
+}
+
+ss::future<> batched_output_stream::write_coalesced() {
+    if (_coalesced_bytes == 0) {
+        return ss::make_ready_future<>();
+    }
+    auto buf = std::exchange(_coalescing_buffer, {});
+    buf.trim(std::exchange(_coalesced_bytes, 0));
+    ++_unflushed_fragments;
+    ss::scattered_message<char> msg;
+    msg.append(std::move(buf));
+    return _out.write(std::move(msg));
+}
+
 ss::future<> batched_output_stream::do_flush() {
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
     }
-    _unflushed_bytes = 0;
-    return _out.flush();
+    return write_coalesced().then([this] {
+        if (_stats) {
+            ++_stats->flushes;
+            _stats->flushed_bytes += _unflushed_bytes;
+            _stats->flushed_fragments += _unflushed_fragments;
+        }
+        _unflushed_bytes = 0;
+        _unflushed_fragments = 0;
+        return _out.flush();
+    });
 }
 ss::future<> batched_output_stream::flush() {
     return ss::with_semaphore(*_write_sem, 1, [this] { return do_flush(); });
@@ -15,6 +15,7 @@
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <cstddef>
 #include <memory>
@@ -43,21 +44,47 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * Small messages are copied into a shared coalescing buffer instead of being
+ * handed to the stream as separate fragment sets, so that many small
+ * responses from concurrent writers are sent with fewer, larger iovecs.
  */
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
+    /// Messages up to this size are copied into the coalescing buffer
+    static constexpr size_t default_max_coalesced_message_bytes = 2048;
+    /// Size of the buffer small messages are coalesced into
+    static constexpr size_t coalescing_buffer_size = 16 * 1024;
+
+    /// Counters of the data handed to the underlying stream, shared by all
+    /// the streams of a server. Bytes per flush and fragments per flush are
+    /// the ratios of the counters.
+    struct stats {
+        uint64_t flushes{0};
+        uint64_t flushed_bytes{0};
+        uint64_t flushed_fragments{0};
+        uint64_t coalesced_messages{0};
+    };
 
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      size_t max_coalesced_message_bytes = default_max_coalesced_message_bytes,
+      stats* out_stats = nullptr);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
       : _out(std::move(o._out))
       , _cache_size(o._cache_size)
+      , _max_coalesced_message_bytes(o._max_coalesced_message_bytes)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
+      , _unflushed_fragments(o._unflushed_fragments)
+      , _coalescing_buffer(std::move(o._coalescing_buffer))
+      , _coalesced_bytes(o._coalesced_bytes)
+      , _stats(o._stats)
       , _closed(o._closed) {}
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
@@ -91,12 +118,20 @@ public:
     bool is_valid() const noexcept { return _cache_size != 0; }
 
 private:
+    ss::future<> do_write(ss::scattered_message<char>);
+    void coalesce(ss::scattered_message<char>);
+    ss::future<> write_coalesced();
     ss::future<> do_flush();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
+    size_t _max_coalesced_message_bytes{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
+    size_t _unflushed_fragments{0};
+    ss::temporary_buffer<char> _coalescing_buffer;
+    size_t _coalesced_bytes{0};
+    stats* _stats{nullptr};
     bool _closed = false;
 };
 } // namespace net
@@ -194,10 +194,18 @@ ss::future<bool> conn_quota::do_get(ss::net::inet_address addr) {
             allowance.borrowed -= 1;
             return ss::make_ready_future<bool>(true);
         } else {
-            // Slow path: call to the home core to request a token
-            return container().invoke_on(home_shard, [addr](conn_quota& cq) {
-                return cq.home_get_units(addr);
-            });
+            // Slow path: call to the home core to request a token, it may
+            // lend us a few more to keep for the next connections
+            return container()
+              .invoke_on(
+                home_shard,
+                [addr](conn_quota& cq) { return cq.home_borrow_units(addr); })
+              .then([this, addr, home_shard](uint32_t granted) {
+                  if (granted > 1) {
+                      keep_borrowed(addr, home_shard, granted - 1);
+                  }
+                  return granted > 0;
+              });
         }
     }
 }
@@ -403,6 +411,54 @@ ss::future<bool> conn_quota::home_get_units(ss::net::inet_address addr) {
     co_return result;
 }
 
+/**
+ * I am the home shard for this address, and another shard is asking
+ * for a token.  While there are plenty of tokens available, lend it a
+ * batch so that its next connections do not need to come here.
+ *
+ * Return the number of tokens granted, zero if none were available.
+ */
+ss::future<uint32_t>
+conn_quota::home_borrow_units(ss::net::inet_address addr) {
+    if (!co_await home_get_units(addr)) {
+        co_return 0;
+    }
+
+    auto allowance = get_home_allowance(addr);
+    uint32_t extra = 0;
+    // Keep at least half of the tokens at home, the same threshold which
+    // ends a reclaim (see should_leave_reclaim)
+    if (!allowance->reclaim && allowance->available > allowance->max / 2) {
+        extra = std::min(
+          allowance->available - allowance->max / 2,
+          allowance->max / (2 * ss::smp::count));
+        allowance->available -= extra;
+    }
+    vlog(_log->trace, "home_borrow_units({}) lending {} extra", addr, extra);
+    co_return 1 + extra;
+}
+
+/**
+ * Store tokens lent by the home shard.  If the home shard started a
+ * reclaim while they were in flight, give them back right away.
+ */
+void conn_quota::keep_borrowed(
+  ss::net::inet_address addr, ss::shard_id home_shard, uint32_t n) {
+    auto& allowance = get_remote_allowance(addr);
+    if (!allowance.reclaim) {
+        allowance.borrowed += n;
+        return;
+    }
+    vlog(_log->trace, "keep_borrowed: reclaim, returning {} to home", n);
+    ssx::spawn_with_gate(_gate, [this, addr, home_shard, n]() {
+        return container().invoke_on(home_shard, [addr, n](conn_quota& cq) {
+            for (uint32_t i = 0; i < n; ++i) {
+                cq.do_put(addr);
+            }
+        });
+    });
+}
+
 bool conn_quota::try_get_units(home_allowance& allowance) {
     if (allowance.available) {
         allowance.available -= 1;
@@ -575,4 +631,14 @@ bool conn_quota::test_only_is_in_reclaim(ss::net::inet_address addr) const {
     }
 }
 
+uint32_t conn_quota::test_only_borrowed(ss::net::inet_address addr) const {
+    if (addr_to_shard(addr) == ss::this_shard_id()) {
+        return 0;
+    }
+    if (addr == ss::net::inet_address{} || ip_remote.contains(addr)) {
+        return get_remote_allowance(addr).borrowed;
+    }
+    return 0;
+}
+
 } // namespace net
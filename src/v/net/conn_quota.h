@@ -40,6 +40,11 @@ struct conn_quota_config {
  * There are global quotas and per-IP quotas.  Many functions take
  * an inet_address argument, and if it is a default-initialized
  * object, that means we are acting on the global quota.
+ *
+ * Each allowance lives on a home shard.  Other shards borrow tokens
+ * from it in batches while the home shard has plenty available, so
+ * that during connection storms most accepts are core-local.  When the
+ * home shard runs out it reclaims the borrowed tokens.
  */
 class conn_quota : public ss::peering_sharded_service<conn_quota> {
 public:
@@ -100,6 +105,7 @@ public:
      * Hook for unit tests to validate the reclaim logic.
      */
     bool test_only_is_in_reclaim(ss::net::inet_address addr) const;
+    uint32_t test_only_borrowed(ss::net::inet_address addr) const;
 
 private:
     /**
@@ -184,7 +190,9 @@ private:
     ss::future<bool> do_get(ss::net::inet_address);
     void do_put(ss::net::inet_address);
     ss::future<bool> home_get_units(ss::net::inet_address);
+    ss::future<uint32_t> home_borrow_units(ss::net::inet_address);
     bool try_get_units(home_allowance& allowance);
+    void keep_borrowed(ss::net::inet_address, ss::shard_id, uint32_t);
 
     // Reclaim logic
     ss::future<> reclaim_to(
@@ -149,7 +149,11 @@ connection::connection(
   , _fd(std::move(f))
   , _local_addr(_fd.local_address())
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      _fd.output(),
+      batched_output_stream::default_max_unflushed_bytes,
+      batched_output_stream::default_max_coalesced_message_bytes,
+      &p.output_stats())
   , _probe(p)
   , _tls_enabled(tls_enabled)
   , _log(log) {
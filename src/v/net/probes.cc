@@ -121,6 +121,30 @@ void server_probe::setup_metrics(
           [this] { return _produce_bad_create_time; },
           sm::description("number of produce requests with timestamps too far "
                           "in the future or in the past")),
+        sm::make_counter(
+          "output_flushes",
+          [this] { return _output_stats.flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes of connection output streams", proto))),
+        sm::make_total_bytes(
+          "output_flushed_bytes",
+          [this] { return _output_stats.flushed_bytes; },
+          sm::description(ssx::sformat(
+            "{}: Number of bytes sent to clients by output stream flushes",
+            proto))),
+        sm::make_counter(
+          "output_flushed_fragments",
+          [this] { return _output_stats.flushed_fragments; },
+          sm::description(ssx::sformat(
+            "{}: Number of buffer fragments sent to clients by output stream "
+            "flushes",
+            proto))),
+        sm::make_counter(
+          "output_coalesced_messages",
+          [this] { return _output_stats.coalesced_messages; },
+          sm::description(ssx::sformat(
+            "{}: Number of small responses copied into a coalescing buffer",
+            proto))),
       },
       {},
       {sm::shard_label});
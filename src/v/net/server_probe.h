@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "metrics/metrics.h"
+#include "net/batched_output_stream.h"
 
 #include <seastar/core/metrics_registration.hh>
 
@@ -64,6 +65,8 @@ public:
 
     void waiting_for_conection_rate() { ++_connections_wait_rate; }
 
+    batched_output_stream::stats& output_stats() { return _output_stats; }
+
     // metric used to signal a produce request with a timestamp too far into the
     // future or too far in the past see configuration
     // log_message_timestamp_alert_after_ms and
@@ -99,6 +102,7 @@ private:
     uint32_t _requests_blocked_memory = 0;
     uint32_t _connections_wait_rate = 0;
     uint32_t _produce_bad_create_time = 0;
+    batched_output_stream::stats _output_stats;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
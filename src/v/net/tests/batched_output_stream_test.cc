@@ -0,0 +1,129 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "net/batched_output_stream.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/core/scattered_message.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// Records the data and the number of fragments of every put
+struct recording_sink final : ss::data_sink_impl {
+    explicit recording_sink(std::string& data, std::vector<size_t>& puts)
+      : data(data)
+      , puts(puts) {}
+
+    ss::future<> put(ss::net::packet p) final {
+        puts.push_back(p.nr_frags());
+        for (const auto& f : p.fragments()) {
+            data.append(f.base, f.size);
+        }
+        return ss::make_ready_future<>();
+    }
+    ss::future<> put(std::vector<ss::temporary_buffer<char>> all) final {
+        puts.push_back(all.size());
+        for (const auto& b : all) {
+            data.append(b.get(), b.size());
+        }
+        return ss::make_ready_future<>();
+    }
+    ss::future<> put(ss::temporary_buffer<char> buf) final {
+        puts.push_back(1);
+        data.append(buf.get(), buf.size());
+        return ss::make_ready_future<>();
+    }
+    ss::future<> flush() final { return ss::make_ready_future<>(); }
+    ss::future<> close() final { return ss::make_ready_future<>(); }
+
+    std::string& data;
+    std::vector<size_t>& puts;
+};
+
+ss::scattered_message<char>
+make_message(const std::string& fragment, size_t fragments) {
+    ss::scattered_message<char> msg;
+    for (size_t i = 0; i < fragments; ++i) {
+        msg.append(ss::sstring(fragment));
+    }
+    return msg;
+}
+
+struct fixture {
+    fixture()
+      : out(
+          ss::output_stream<char>(
+            ss::data_sink(std::make_unique<recording_sink>(data, puts)),
+            1024 * 1024),
+          net::batched_output_stream::default_max_unflushed_bytes,
+          net::batched_output_stream::default_max_coalesced_message_bytes,
+          &stats) {}
+
+    ~fixture() { out.stop().get(); }
+
+    std::string data;
+    std::vector<size_t> puts;
+    net::batched_output_stream::stats stats;
+    net::batched_output_stream out;
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(concurrent_small_writes_are_coalesced) {
+    fixture f;
+    std::string expected;
+    std::vector<ss::future<bool>> writes;
+    for (int i = 0; i < 10; ++i) {
+        auto fragment = std::to_string(i) + "-fragment";
+        writes.push_back(f.out.write(make_message(fragment, 3)));
+        expected += fragment + fragment + fragment;
+    }
+    ss::when_all_succeed(writes.begin(), writes.end()).get();
+    f.out.flush().get();
+
+    BOOST_REQUIRE_EQUAL(f.data, expected);
+    BOOST_REQUIRE_EQUAL(f.stats.coalesced_messages, 10);
+    BOOST_REQUIRE_EQUAL(f.stats.flushed_bytes, expected.size());
+    // every flush sends a single coalesced fragment
+    BOOST_REQUIRE_EQUAL(f.stats.flushed_fragments, f.stats.flushes);
+    BOOST_REQUIRE_LT(f.stats.flushed_fragments, 30);
+}
+
+SEASTAR_THREAD_TEST_CASE(large_writes_are_not_copied) {
+    fixture f;
+    const std::string fragment(4096, 'x');
+    f.out.write(make_message(fragment, 2)).get();
+
+    BOOST_REQUIRE_EQUAL(f.data, fragment + fragment);
+    BOOST_REQUIRE_EQUAL(f.stats.coalesced_messages, 0);
+    BOOST_REQUIRE_EQUAL(f.stats.flushes, 1);
+    BOOST_REQUIRE_EQUAL(f.stats.flushed_fragments, 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(mixed_writes_preserve_order) {
+    fixture f;
+    std::string expected;
+    std::vector<ss::future<bool>> writes;
+    for (int i = 0; i < 20; ++i) {
+        const std::string fragment(
+          i % 3 == 0 ? 3000 : 100, static_cast<char>('a' + i));
+        writes.push_back(f.out.write(make_message(fragment, 2)));
+        expected += fragment + fragment;
+    }
+    ss::when_all_succeed(writes.begin(), writes.end()).get();
+    f.out.flush().get();
+
+    BOOST_REQUIRE_EQUAL(f.data, expected);
+    BOOST_REQUIRE_EQUAL(f.stats.flushed_bytes, expected.size());
+}
@@ -306,6 +306,40 @@ FIXTURE_TEST(test_per_ip_borrows, conn_quota_fixture) {
     test_borrows(core_count, 2, std::nullopt, core_count * 2);
 }
 
+/**
+ * While the home shard has plenty of tokens it lends them in batches, so
+ * that other shards can accept connections without cross-shard calls.
+ */
+FIXTURE_TEST(test_batch_borrows, conn_quota_fixture) {
+    auto core_count = ss::smp::count;
+    BOOST_REQUIRE(core_count >= 4);
+    const uint32_t limit = core_count * 100;
+    start(limit, std::nullopt);
+
+    take_on_shard(1, {}, 1);
+    auto borrowed = scq
+                      .invoke_on(
+                        1,
+                        [](conn_quota& cq) {
+                            return cq.test_only_borrowed({});
+                        })
+                      .get();
+    BOOST_REQUIRE_GT(borrowed, 0);
+    BOOST_REQUIRE_LE(borrowed, limit / 2);
+
+    // The limit is still enforced across the shards
+    take_on_shard(1, {}, borrowed);
+    for (ss::shard_id i = 2; i < core_count; ++i) {
+        take_on_shard(i, {}, 1);
+    }
+    const uint32_t taken = 1 + borrowed + (core_count - 2);
+    take_on_shard(0, {}, limit - taken);
+    for (ss::shard_id i = 0; i < core_count; ++i) {
+        scq.invoke_on(i, [this](conn_quota&) { return expect_no_units({}); })
+          .get();
+    }
+}
+
 FIXTURE_TEST(test_change_limits, conn_quota_fixture) {
     auto core_count = ss::smp::count;
     uint32_t initial_limit = core_count * 3;
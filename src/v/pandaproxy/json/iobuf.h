@@ -84,8 +84,7 @@ public:
         if (buf.empty()) {
             return w.Null();
         }
-        // TODO Ben: Implement custom OutputStream to prevent this linearization
-        return w.String(iobuf_to_base64(buf));
+        return w.RawString(iobuf_to_base64_iobuf(buf));
     };
 
     template<typename Buffer>
@@ -22,9 +22,11 @@
 #include "pandaproxy/json/exceptions.h"
 #include "pandaproxy/json/types.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/temporary_buffer.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/http/request.hh>
 
 #include <concepts>
@@ -80,6 +82,55 @@ rjson_serialize(T&& v) {
     return as_body_writer(rjson_serialize_iobuf(std::forward<T>(v)));
 }
 
+namespace impl {
+
+template<typename Range>
+ss::future<> write_json_array(
+  Range range, size_t chunk_size, ss::output_stream<char> os) {
+    std::exception_ptr ex;
+    try {
+        ::json::chunked_buffer buf;
+        ::json::iobuf_writer<::json::chunked_buffer> wrt{buf};
+
+        using ::json::rjson_serialize;
+        using ::pandaproxy::json::rjson_serialize;
+        wrt.StartArray();
+        size_t count = 0;
+        for (const auto& v : range) {
+            rjson_serialize(wrt, v);
+            if (++count % chunk_size == 0) {
+                co_await write_iobuf_to_output_stream(
+                  std::move(buf).as_iobuf(), os);
+                co_await os.flush();
+                co_await ss::coroutine::maybe_yield();
+            }
+        }
+        wrt.EndArray();
+        co_await write_iobuf_to_output_stream(std::move(buf).as_iobuf(), os);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await os.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+} // namespace impl
+
+///\brief Serialize \p range as a JSON array written to the response in
+/// chunks of \p chunk_size elements, yielding in between. The document is
+/// never held in memory as a whole, which matters for large listings.
+template<typename Range>
+ss::noncopyable_function<ss::future<>(ss::output_stream<char>&& os)>
+rjson_serialize_array(Range range, size_t chunk_size = 1024) {
+    return [range{std::move(range)},
+            chunk_size](ss::output_stream<char>&& os) mutable {
+        return impl::write_json_array(
+          std::move(range), chunk_size, std::move(os));
+    };
+}
+
 struct rjson_serialize_fmt_impl {
     explicit rjson_serialize_fmt_impl(serialization_format fmt)
       : fmt{fmt} {}
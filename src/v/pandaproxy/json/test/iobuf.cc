@@ -49,3 +49,41 @@ SEASTAR_THREAD_TEST_CASE(test_iobuf_serialize_binary) {
 
     BOOST_REQUIRE_EQUAL(output, expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_iobuf_serialize_binary_chunked) {
+    iobuf in_buf;
+    in_buf.append_fragments(iobuf::from("panda"));
+    in_buf.append_fragments(iobuf::from("proxy"));
+
+    ::json::chunked_buffer out_buf;
+    ::json::iobuf_writer<::json::chunked_buffer> w(out_buf);
+    w.StartArray();
+    ppj::rjson_serialize_fmt(ppj::serialization_format::binary_v2)(
+      w, std::move(in_buf));
+    ppj::rjson_serialize_fmt(ppj::serialization_format::binary_v2)(
+      w, iobuf{});
+    w.EndArray();
+    iobuf_parser p(std::move(out_buf).as_iobuf());
+
+    BOOST_REQUIRE_EQUAL(
+      p.read_string(p.bytes_left()), R"(["cGFuZGFwcm94eQ==",null])");
+}
+
+SEASTAR_THREAD_TEST_CASE(test_serialize_array_in_chunks) {
+    for (size_t chunk_size : {1, 2, 3, 1024}) {
+        std::vector<ss::sstring> in{"a", "b", "c"};
+        iobuf out;
+        auto writer = ppj::rjson_serialize_array(std::move(in), chunk_size);
+        writer(make_iobuf_ref_output_stream(out)).get();
+        iobuf_parser p(std::move(out));
+        BOOST_REQUIRE_EQUAL(
+          p.read_string(p.bytes_left()), R"(["a","b","c"])");
+    }
+
+    iobuf out;
+    ppj::rjson_serialize_array(std::vector<ss::sstring>{})(
+      make_iobuf_ref_output_stream(out))
+      .get();
+    iobuf_parser p(std::move(out));
+    BOOST_REQUIRE_EQUAL(p.read_string(p.bytes_left()), "[]");
+}
@@ -27,6 +27,8 @@ static constexpr auto gc_timer_period = 10s;
 kafka_client_cache::kafka_client_cache(
   const YAML::Node& cfg, size_t max_size, std::chrono::milliseconds keep_alive)
   : _config{cfg}
+  , _metadata{ss::make_lw_shared<kafka::client::shared_metadata>(
+      kafka::client::shared_metadata::mode::shared)}
   , _cache_max_size{max_size}
   , _keep_alive{keep_alive} {
     _gc_timer.set_callback([this] {
@@ -58,7 +60,9 @@ client_ptr kafka_client_cache::make_client(
     }
 
     return ss::make_lw_shared<kafka::client::client>(
-      to_yaml(cfg, config::redact_secrets::no));
+      to_yaml(cfg, config::redact_secrets::no),
+      kafka::client::impl::default_external_mitigate,
+      _metadata);
 }
 
 std::pair<client_ptr, client_mu_ptr> kafka_client_cache::fetch_or_insert(
@@ -11,6 +11,7 @@
 
 #pragma once
 #include "config/rest_authn_endpoint.h"
+#include "kafka/client/shared_metadata.h"
 #include "pandaproxy/types.h"
 #include "utils/mutex.h"
 
@@ -95,6 +96,8 @@ private:
           std::equal_to<>>>>;
 
     kafka::client::configuration _config;
+    // Metadata shared by the clients of all the users
+    ss::lw_shared_ptr<kafka::client::shared_metadata> _metadata;
     size_t _cache_max_size;
     std::chrono::milliseconds _keep_alive;
     underlying_t _cache;
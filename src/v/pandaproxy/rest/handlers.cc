@@ -10,6 +10,7 @@
 #include "handlers.h"
 
 #include "base/vlog.h"
+#include "container/fragmented_vector.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/protocol/schemata/offset_commit_request.h"
@@ -100,15 +101,16 @@ get_topics_names(server::request_t rq, server::reply_t rp) {
     co_return co_await rq.dispatch(make_list_topics_req)
       .then([res_fmt, rp = std::move(rp)](
               kafka::metadata_request::api_type::response_type res) mutable {
-          std::vector<model::topic_view> names;
+          chunked_vector<model::topic> names;
           names.reserve(res.data.topics.size());
           for (auto& topic : res.data.topics) {
               if (!topic.is_internal) {
-                  names.emplace_back(topic.name);
+                  names.push_back(std::move(topic.name));
               }
           }
 
-          rp.rep->write_body("json", ppj::rjson_serialize(names));
+          rp.rep->write_body(
+            "json", ppj::rjson_serialize_array(std::move(names)));
           rp.mime_type = res_fmt;
           return std::move(rp);
       });
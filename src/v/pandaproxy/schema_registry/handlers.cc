@@ -29,6 +29,10 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/sstring.hh>
 
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+
+#include <algorithm>
 #include <limits>
 
 namespace ppj = pandaproxy::json;
@@ -315,6 +319,55 @@ get_schemas_ids_id(server::request_t rq, server::reply_t rp) {
     co_return rp;
 }
 
+ss::future<server::reply_t>
+get_schemas_ids(server::request_t rq, server::reply_t rp) {
+    // Bounds the response and the time spent on the shard without yielding
+    static constexpr size_t max_ids = 1000;
+
+    parse_accept_header(rq, rp);
+    auto ids_param = parse::query_param<ss::sstring>(*rq.req, "ids");
+    rq.req.reset();
+
+    std::vector<ss::sstring> parts;
+    boost::split(
+      parts, ids_param, boost::is_any_of(","), boost::token_compress_on);
+    std::erase(parts, "");
+    if (parts.size() > max_ids) {
+        throw parse::error(
+          parse::error_code::invalid_param,
+          fmt::format(
+            "Too many ids, got {}, at most {} are allowed",
+            parts.size(),
+            max_ids));
+    }
+    std::vector<schema_id> ids;
+    ids.reserve(parts.size());
+    for (auto& part : parts) {
+        ids.push_back(parse::detail::parse_param<schema_id>(
+          "parameter", "ids", std::move(part)));
+    }
+
+    auto& store = rq.service().schema_store();
+    auto defs = co_await store.get_schema_definitions(ids);
+    if (std::ranges::any_of(defs, [](const auto& d) { return !d; })) {
+        // Load latest writes and retry, like get_or_load
+        co_await rq.service().writer().read_sync();
+        defs = co_await store.get_schema_definitions(ids);
+    }
+
+    // Ids which are not found are left out
+    get_schemas_ids_response res;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (defs[i].has_value()) {
+            res.definitions.push_back(
+              {.id = ids[i], .definition = *std::move(defs[i])});
+        }
+    }
+
+    rp.rep->write_body("json", ppj::rjson_serialize(res));
+    co_return rp;
+}
+
 ss::future<server::reply_t>
 get_schemas_ids_id_versions(server::request_t rq, server::reply_t rp) {
     parse_accept_header(rq, rp);
@@ -354,7 +407,7 @@ ss::future<ctx_server<service>::reply_t> get_schemas_ids_id_subjects(
 
     rp.rep->write_body(
       "json",
-      ppj::rjson_serialize(
+      ppj::rjson_serialize_array(
         co_await rq.service().schema_store().get_schema_subjects(
           id, incl_del)));
     co_return rp;
@@ -375,8 +428,9 @@ get_subjects(server::request_t rq, server::reply_t rp) {
 
     rp.rep->write_body(
       "json",
-      json::rjson_serialize(co_await rq.service().schema_store().get_subjects(
-        inc_del, subject_prefix)));
+      ppj::rjson_serialize_array(
+        co_await rq.service().schema_store().get_subjects(
+          inc_del, subject_prefix)));
     co_return rp;
 }
 
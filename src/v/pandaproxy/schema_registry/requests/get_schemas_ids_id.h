@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "container/fragmented_vector.h"
 #include "json/iobuf_writer.h"
 #include "pandaproxy/json/rjson_util.h"
 #include "pandaproxy/schema_registry/types.h"
@@ -21,20 +22,21 @@ struct get_schemas_ids_id_response {
     canonical_schema_definition definition;
 };
 
+namespace detail {
+
 template<typename Buffer>
-void rjson_serialize(
-  ::json::iobuf_writer<Buffer>& w, const get_schemas_ids_id_response& res) {
-    w.StartObject();
-    if (res.definition.type() != schema_type::avro) {
+void rjson_serialize_definition(
+  ::json::iobuf_writer<Buffer>& w, const canonical_schema_definition& def) {
+    if (def.type() != schema_type::avro) {
         w.Key("schemaType");
-        ::json::rjson_serialize(w, to_string_view(res.definition.type()));
+        ::json::rjson_serialize(w, to_string_view(def.type()));
     }
     w.Key("schema");
-    ::json::rjson_serialize(w, res.definition.raw());
-    if (!res.definition.refs().empty()) {
+    ::json::rjson_serialize(w, def.raw());
+    if (!def.refs().empty()) {
         w.Key("references");
         w.StartArray();
-        for (const auto& ref : res.definition.refs()) {
+        for (const auto& ref : def.refs()) {
             w.StartObject();
             w.Key("name");
             ::json::rjson_serialize(w, ref.name);
@@ -46,7 +48,38 @@ void rjson_serialize(
         }
         w.EndArray();
     }
+}
+
+} // namespace detail
+
+template<typename Buffer>
+void rjson_serialize(
+  ::json::iobuf_writer<Buffer>& w, const get_schemas_ids_id_response& res) {
+    w.StartObject();
+    detail::rjson_serialize_definition(w, res.definition);
     w.EndObject();
 }
 
+struct get_schemas_ids_response {
+    struct entry {
+        schema_id id;
+        canonical_schema_definition definition;
+    };
+    chunked_vector<entry> definitions;
+};
+
+template<typename Buffer>
+void rjson_serialize(
+  ::json::iobuf_writer<Buffer>& w, const get_schemas_ids_response& res) {
+    w.StartArray();
+    for (const auto& e : res.definitions) {
+        w.StartObject();
+        w.Key("id");
+        ::json::rjson_serialize(w, e.id);
+        detail::rjson_serialize_definition(w, e.definition);
+        w.EndObject();
+    }
+    w.EndArray();
+}
+
 } // namespace pandaproxy::schema_registry
@@ -14,12 +14,18 @@
 #include "container/fragmented_vector.h"
 #include "pandaproxy/schema_registry/types.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 
+#include <vector>
+
 namespace pandaproxy::schema_registry {
 
 class schema_getter {
 public:
+    using maybe_definitions
+      = chunked_vector<std::optional<canonical_schema_definition>>;
+
     virtual ss::future<subject_schema> get_subject_schema(
       subject sub,
       std::optional<schema_version> version,
@@ -29,6 +35,21 @@ public:
     get_schema_definition(schema_id id) = 0;
     virtual ss::future<std::optional<canonical_schema_definition>>
     maybe_get_schema_definition(schema_id id) = 0;
+
+    ///\brief Look up many definitions at once, e.g. to warm up a cache.
+    ///
+    /// The result is in the order of \p ids, with std::nullopt for the ids
+    /// which are not found.
+    virtual ss::future<maybe_definitions>
+    get_schema_definitions(std::vector<schema_id> ids) {
+        maybe_definitions defs;
+        defs.reserve(ids.size());
+        for (auto id : ids) {
+            defs.push_back(co_await maybe_get_schema_definition(id));
+        }
+        co_return defs;
+    }
+
     virtual ~schema_getter() = default;
 };
 
@@ -322,6 +322,10 @@ server::routes_t get_schema_registry_routes(ss::gate& gate, one_shot& es) {
       ss::httpd::schema_registry_json::get_schemas_types,
       wrap(gate, es, auth_level::publik, get_schemas_types)});
 
+    routes.routes.emplace_back(server::route_t{
+      ss::httpd::schema_registry_json::get_schemas_ids,
+      wrap(gate, es, auth_level::user, get_schemas_ids)});
+
     routes.routes.emplace_back(server::route_t{
       ss::httpd::schema_registry_json::get_schemas_ids_id,
       wrap(gate, es, auth_level::user, get_schemas_ids_id)});
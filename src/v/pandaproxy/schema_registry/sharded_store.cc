@@ -13,6 +13,7 @@
 
 #include "base/vlog.h"
 #include "config/configuration.h"
+#include "container/chunked_hash_map.h"
 #include "hashing/jump_consistent_hash.h"
 #include "hashing/xx.h"
 #include "pandaproxy/logger.h"
@@ -25,6 +26,7 @@
 #include "pandaproxy/schema_registry/store.h"
 #include "pandaproxy/schema_registry/types.h"
 #include "pandaproxy/schema_registry/util.h"
+#include "utils/chunked_kv_cache.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
@@ -70,12 +72,226 @@ constexpr auto set_accumulator =
 
 } // namespace
 
+///\brief Read only replica of the schema definitions of the store.
+///
+/// A definition never changes once written under an id, a write publishes
+/// a copy of it to every shard and a delete retracts it from every shard.
+/// The owning shard of the id is still the source of truth for everything
+/// else, such as the subjects referring to the schema.
+class schema_definitions {
+public:
+    std::optional<canonical_schema_definition> get(schema_id id) const {
+        auto it = _definitions.find(id);
+        if (it == _definitions.end()) {
+            return std::nullopt;
+        }
+        return it->second.share();
+    }
+
+    bool contains(schema_id id) const { return _definitions.contains(id); }
+
+    void upsert(schema_id id, canonical_schema_definition def) {
+        auto [it, inserted] = _definitions.try_emplace(id, std::move(def));
+        if (!inserted && !(it->second == def)) {
+            it->second = std::move(def);
+            invalidate();
+        }
+    }
+
+    void erase(schema_id id) {
+        if (_definitions.erase(id) != 0) {
+            invalidate();
+        }
+    }
+
+    ss::future<> stop() { return ss::now(); }
+
+    ///\brief Outcome of the compatibility check of a new definition against
+    /// a single old version, without the messages describing the version.
+    struct compatibility_check {
+        bool is_compat;
+        std::vector<ss::sstring> messages;
+        ///\brief The old definition as parsed, only kept for verbose
+        /// failures.
+        ss::sstring old_schema;
+    };
+
+    ///\brief The checks which ran under the same generation, see
+    /// invalidate().
+    uint64_t generation() const { return _generation; }
+
+    ///\brief Forget all parsed definitions and compatibility checks.
+    ///
+    /// Parsing a definition resolves its references through subject
+    /// versions, so anything cached is stale once a definition or a subject
+    /// version changes.
+    void invalidate() { ++_generation; }
+
+    ss::shared_ptr<valid_schema> get_valid(schema_id id) {
+        auto v = _valid.get_value({id, _generation});
+        return v ? *v : nullptr;
+    }
+
+    void put_valid(
+      schema_id id, uint64_t generation, ss::shared_ptr<valid_schema> v) {
+        _valid.try_insert({id, generation}, std::move(v));
+    }
+
+    std::optional<compatibility_check> get_compatibility_check(
+      schema_id old_id,
+      compatibility_level level,
+      verbose is_verbose,
+      const canonical_schema_definition& new_def) {
+        auto v = _checks.get_value(
+          {old_id, _generation, fingerprint(new_def), level, is_verbose});
+        if (!v || !((*v)->new_def == new_def)) {
+            return std::nullopt;
+        }
+        return (*v)->check;
+    }
+
+    void put_compatibility_check(
+      schema_id old_id,
+      uint64_t generation,
+      compatibility_level level,
+      verbose is_verbose,
+      const canonical_schema_definition& new_def,
+      compatibility_check check) {
+        _checks.try_insert(
+          {old_id, generation, fingerprint(new_def), level, is_verbose},
+          ss::make_shared<check_entry>(new_def.share(), std::move(check)));
+    }
+
+private:
+    static constexpr size_t max_valid_schemas = 128;
+    static constexpr size_t max_compatibility_checks = 1024;
+
+    struct valid_key {
+        schema_id id;
+        uint64_t generation;
+
+        bool operator==(const valid_key&) const = default;
+        template<typename H>
+        friend H AbslHashValue(H h, const valid_key& k) {
+            return H::combine(std::move(h), k.id(), k.generation);
+        }
+    };
+
+    struct check_key {
+        schema_id old_id;
+        uint64_t generation;
+        uint64_t new_fingerprint;
+        compatibility_level level;
+        verbose is_verbose;
+
+        bool operator==(const check_key&) const = default;
+        template<typename H>
+        friend H AbslHashValue(H h, const check_key& k) {
+            return H::combine(
+              std::move(h),
+              k.old_id(),
+              k.generation,
+              k.new_fingerprint,
+              k.level,
+              bool(k.is_verbose));
+        }
+    };
+
+    struct check_entry {
+        check_entry(
+          canonical_schema_definition new_def, compatibility_check check)
+          : new_def(std::move(new_def))
+          , check(std::move(check)) {}
+
+        ///\brief Compared on lookup, the fingerprint is only a hash.
+        canonical_schema_definition new_def;
+        compatibility_check check;
+    };
+
+    static uint64_t fingerprint(const canonical_schema_definition& def) {
+        incremental_xxhash64 h;
+        h.update(static_cast<std::underlying_type_t<schema_type>>(def.type()));
+        for (const auto& frag : def.raw()()) {
+            h.update(frag.get(), frag.size());
+        }
+        return h.digest();
+    }
+
+    chunked_hash_map<schema_id, canonical_schema_definition> _definitions;
+    uint64_t _generation{0};
+    utils::chunked_kv_cache<valid_key, valid_schema> _valid{
+      {.cache_size = max_valid_schemas, .small_size = max_valid_schemas / 10}};
+    utils::chunked_kv_cache<check_key, check_entry> _checks{
+      {.cache_size = max_compatibility_checks,
+       .small_size = max_compatibility_checks / 10}};
+};
+
+namespace {
+
+///\brief Check \p new_valid against \p old_valid in the directions
+/// required by \p level.
+schema_definitions::compatibility_check check_compatible(
+  const valid_schema& new_valid,
+  const valid_schema& old_valid,
+  compatibility_level level,
+  verbose is_verbose) {
+    auto formatter = [](std::string_view rdr, std::string_view wrtr) {
+        return [rdr, wrtr](std::string_view msg) {
+            return fmt::format(
+              fmt::runtime(msg),
+              fmt::arg("reader", rdr),
+              fmt::arg("writer", wrtr));
+        };
+    };
+
+    schema_definitions::compatibility_check check{.is_compat = true};
+    auto append = [&](compatibility_result r, auto fmt) {
+        check.is_compat = check.is_compat && r.is_compat;
+        check.messages.reserve(check.messages.size() + r.messages.size());
+        std::transform(
+          std::make_move_iterator(r.messages.begin()),
+          std::make_move_iterator(r.messages.end()),
+          std::back_inserter(check.messages),
+          fmt);
+    };
+
+    if (
+      level == compatibility_level::backward
+      || level == compatibility_level::backward_transitive
+      || level == compatibility_level::full
+      || level == compatibility_level::full_transitive) {
+        append(
+          check_compatible(new_valid, old_valid, is_verbose),
+          formatter("new", "old"));
+    }
+    if (
+      level == compatibility_level::forward
+      || level == compatibility_level::forward_transitive
+      || level == compatibility_level::full
+      || level == compatibility_level::full_transitive) {
+        append(
+          check_compatible(old_valid, new_valid, is_verbose),
+          formatter("old", "new"));
+    }
+
+    if (is_verbose && !check.is_compat) {
+        check.old_schema = to_string(old_valid.raw());
+    }
+    return check;
+}
+
+} // namespace
+
 ss::future<> sharded_store::start(is_mutable mut, ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start(mut);
+    co_await _definitions.start();
+    co_await _store.start(mut);
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _store.stop();
+    co_await _definitions.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema, normalize norm) {
@@ -269,15 +485,14 @@ ss::future<bool> sharded_store::upsert(
 }
 
 ss::future<bool> sharded_store::has_schema(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).has_value();
-      });
+    co_return _definitions.local().contains(id);
 }
 
 ss::future<> sharded_store::delete_schema(schema_id id) {
-    return _store.invoke_on(
+    co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id](store& s) { s.delete_schema(id); });
+    co_await _definitions.invoke_on_all(
+      _smp_opts, [id](schema_definitions& d) { d.erase(id); });
 }
 
 ss::future<subject_schema> sharded_store::has_schema(
@@ -326,26 +541,27 @@ ss::future<subject_schema> sharded_store::has_schema(
 
 ss::future<std::optional<canonical_schema_definition>>
 sharded_store::maybe_get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id),
-      _smp_opts,
-      [id](store& s) -> std::optional<canonical_schema_definition> {
-          auto s_res = s.get_schema_definition(id);
-          if (
-            s_res.has_error()
-            && s_res.error().code() == error_code::schema_id_not_found) {
-              return std::nullopt;
-          }
-          return std::move(s_res.value());
-      });
+    co_return _definitions.local().get(id);
+}
+
+ss::future<sharded_store::maybe_definitions>
+sharded_store::get_schema_definitions(std::vector<schema_id> ids) {
+    const auto& defs = _definitions.local();
+    maybe_definitions result;
+    result.reserve(ids.size());
+    for (auto id : ids) {
+        result.push_back(defs.get(id));
+    }
+    co_return result;
 }
 
 ss::future<canonical_schema_definition>
 sharded_store::get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = _definitions.local().get(id);
+    if (!def) {
+        throw as_exception(not_found(id));
+    }
+    co_return *std::move(def);
 }
 
 ss::future<chunked_vector<subject_version>>
@@ -384,10 +600,7 @@ ss::future<subject_schema> sharded_store::get_subject_schema(
           return s.get_subject_version_id(sub, version, inc_del).value();
       });
 
-    auto def = co_await _store.invoke_on(
-      shard_for(v_id.id), _smp_opts, [id{v_id.id}](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = co_await get_schema_definition(v_id.id);
 
     co_return subject_schema{
       .schema = {sub, std::move(def)},
@@ -484,10 +697,12 @@ ss::future<std::vector<schema_id>> sharded_store::referenced_by(
 ss::future<std::vector<schema_version>> sharded_store::delete_subject(
   seq_marker marker, subject sub, permanent_delete permanent) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto versions = co_await _store.invoke_on(
       sub_shard, _smp_opts, [marker, sub{std::move(sub)}, permanent](store& s) {
           return s.delete_subject(marker, sub, permanent).value();
       });
+    co_await invalidate_definitions();
+    co_return versions;
 }
 
 ss::future<is_deleted> sharded_store::is_subject_deleted(subject sub) {
@@ -555,6 +770,7 @@ ss::future<bool> sharded_store::delete_subject_version(
           auto result = s.delete_subject_version(sub, ver, force).value();
           return std::make_pair(schema_id, result);
       });
+    co_await invalidate_definitions();
 
     auto remaining_subjects_exist = co_await _store.map_reduce0(
       [schema_id](store& s) {
@@ -653,6 +869,11 @@ sharded_store::clear_compatibility(seq_marker marker, subject sub) {
 ss::future<bool>
 sharded_store::upsert_schema(schema_id id, canonical_schema_definition def) {
     co_await maybe_update_max_schema_id(id);
+    co_await _definitions.invoke_on_all(
+      _smp_opts, [id, &def](schema_definitions& d) {
+          // copied on every shard so that it doesn't share foreign memory
+          d.upsert(id, def.copy());
+      });
     co_return co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id, def{std::move(def)}](store& s) mutable {
           return s.upsert_schema(id, std::move(def));
@@ -676,12 +897,22 @@ ss::future<bool> sharded_store::upsert_subject(
   schema_id id,
   is_deleted deleted) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
       [marker, sub{std::move(sub)}, version, id, deleted](store& s) mutable {
           return s.upsert_subject(marker, std::move(sub), version, id, deleted);
       });
+    if (!inserted) {
+        // An existing version was replaced or (un)deleted
+        co_await invalidate_definitions();
+    }
+    co_return inserted;
+}
+
+ss::future<> sharded_store::invalidate_definitions() {
+    co_await _definitions.invoke_on_all(
+      _smp_opts, [](schema_definitions& d) { d.invalidate(); });
 }
 
 /// \brief Get the schema ID to be used for next insert
@@ -792,19 +1023,16 @@ ss::future<compatibility_result> sharded_store::do_is_compatible(
     auto it = std::reverse_iterator(versions.end());
     auto it_end = std::reverse_iterator(ver_it);
 
-    auto new_valid = co_await make_valid_schema(std::move(new_schema));
+    // The checks against old versions are cached per shard, so the new
+    // schema is only parsed when one of them is missing. It is still parsed
+    // when there is nothing to check it against, to validate it.
+    auto& defs = _definitions.local();
+    const auto generation = defs.generation();
+    std::optional<valid_schema> new_valid;
+    bool checked_before = false;
 
     compatibility_result result{.is_compat = true};
 
-    auto formatter = [](std::string_view rdr, std::string_view wrtr) {
-        return [rdr, wrtr](std::string_view msg) {
-            return fmt::format(
-              fmt::runtime(msg),
-              fmt::arg("reader", rdr),
-              fmt::arg("writer", wrtr));
-        };
-    };
-
     for (; result.is_compat && it != it_end; ++it) {
         if (it->deleted) {
             continue;
@@ -812,47 +1040,41 @@ ss::future<compatibility_result> sharded_store::do_is_compatible(
 
         auto old_schema = co_await get_subject_schema(
           sub, it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(
-          std::move(old_schema.schema));
-
-        std::vector<ss::sstring> version_messages;
-
-        if (
-          compat == compatibility_level::backward
-          || compat == compatibility_level::backward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            auto r = check_compatible(new_valid, old_valid, is_verbose);
-            result.is_compat = result.is_compat && r.is_compat;
-            version_messages.reserve(
-              version_messages.size() + r.messages.size());
-            std::transform(
-              std::make_move_iterator(r.messages.begin()),
-              std::make_move_iterator(r.messages.end()),
-              std::back_inserter(version_messages),
-              formatter("new", "old"));
-        }
-        if (
-          compat == compatibility_level::forward
-          || compat == compatibility_level::forward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            auto r = check_compatible(old_valid, new_valid, is_verbose);
-            result.is_compat = result.is_compat && r.is_compat;
-            version_messages.reserve(
-              version_messages.size() + r.messages.size());
-            std::transform(
-              std::make_move_iterator(r.messages.begin()),
-              std::make_move_iterator(r.messages.end()),
-              std::back_inserter(version_messages),
-              formatter("old", "new"));
+
+        auto check = defs.get_compatibility_check(
+          old_schema.id, compat, is_verbose, new_schema.def());
+        if (check.has_value()) {
+            checked_before = true;
+        } else {
+            if (!new_valid.has_value()) {
+                new_valid.emplace(
+                  co_await make_valid_schema(new_schema.share()));
+            }
+            auto old_valid = defs.get_valid(old_schema.id);
+            if (!old_valid) {
+                old_valid = ss::make_shared<valid_schema>(
+                  co_await make_valid_schema(std::move(old_schema.schema)));
+                defs.put_valid(old_schema.id, generation, old_valid);
+            }
+            check.emplace(
+              check_compatible(*new_valid, *old_valid, compat, is_verbose));
+            defs.put_compatibility_check(
+              old_schema.id,
+              generation,
+              compat,
+              is_verbose,
+              new_schema.def(),
+              *check);
         }
 
+        result.is_compat = check->is_compat;
+        auto& version_messages = check->messages;
+
         if (is_verbose && !result.is_compat) {
             version_messages.emplace_back(
               fmt::format("{{oldSchemaVersion: {}}}", old_schema.version));
             version_messages.emplace_back(
-              fmt::format("{{oldSchema: '{}'}}", to_string(old_valid.raw())));
+              fmt::format("{{oldSchema: '{}'}}", check->old_schema));
             version_messages.emplace_back(
               fmt::format("{{compatibility: '{}'}}", compat));
         }
@@ -864,6 +1086,9 @@ ss::future<compatibility_result> sharded_store::do_is_compatible(
           version_messages.end(),
           std::back_inserter(result.messages));
     }
+    if (!new_valid.has_value() && !checked_before) {
+        co_await make_valid_schema(std::move(new_schema));
+    }
     co_return result;
 }
 
@@ -20,6 +20,7 @@
 namespace pandaproxy::schema_registry {
 
 class store;
+class schema_definitions;
 
 ///\brief Dispatch requests to shards based on a a hash of the
 /// subject or schema_id
@@ -82,6 +83,14 @@ public:
     ss::future<std::optional<canonical_schema_definition>>
     maybe_get_schema_definition(schema_id id) override;
 
+    ///\brief Return the definitions of \p ids, std::nullopt for the ids
+    /// which are not found.
+    ///
+    /// Every shard holds all the definitions, so this doesn't leave the
+    /// shard however many ids are requested.
+    ss::future<maybe_definitions>
+    get_schema_definitions(std::vector<schema_id> ids) override;
+
     ///\brief Return a list of subject-versions for the shema id.
     ss::future<chunked_vector<subject_version>>
     get_schema_subject_versions(schema_id id);
@@ -230,10 +239,17 @@ private:
 
     ss::future<> maybe_update_max_schema_id(schema_id id);
 
+    ///\brief Drop the parsed schemas and compatibility checks cached on
+    /// every shard.
+    ss::future<> invalidate_definitions();
+
     ss::future<schema_id> project_schema_id();
 
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ///\brief Every schema definition, replicated on all shards so that
+    /// lookups by id don't cross cores.
+    ss::sharded<schema_definitions> _definitions;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
@@ -76,3 +76,55 @@ SEASTAR_THREAD_TEST_CASE(test_avro_basic_backwards_store_compat) {
     BOOST_REQUIRE(
       !s.is_compatible(pps::schema_version{2}, {sub, schema3.share()}).get());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_avro_repeated_store_compat) {
+    // The result of a check is cached, repeating it or replacing the old
+    // version must give the same answer as a fresh check.
+
+    pps::sharded_store s;
+    s.start(pps::is_mutable::yes, ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    pps::seq_marker dummy_marker;
+
+    s.set_compatibility(pps::compatibility_level::backward).get();
+    auto sub = pps::subject{"sub"};
+    s.upsert(
+       dummy_marker,
+       {sub, schema1.share()},
+       pps::schema_id{1},
+       pps::schema_version{1},
+       pps::is_deleted::no)
+      .get();
+
+    auto check = [&](pps::verbose is_verbose) {
+        return s
+          .is_compatible(
+            pps::schema_version{1}, {sub, schema3.share()}, is_verbose)
+          .get();
+    };
+
+    auto first = check(pps::verbose::yes);
+    BOOST_REQUIRE(!first.is_compat);
+    BOOST_REQUIRE(!first.messages.empty());
+    auto second = check(pps::verbose::yes);
+    BOOST_REQUIRE(!second.is_compat);
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(
+      first.messages.begin(),
+      first.messages.end(),
+      second.messages.begin(),
+      second.messages.end());
+    auto terse = check(pps::verbose::no);
+    BOOST_REQUIRE(!terse.is_compat);
+    BOOST_REQUIRE(terse.messages.empty());
+
+    // Replace the old version with one that schema3 can read
+    s.upsert(
+       dummy_marker,
+       {sub, schema2.share()},
+       pps::schema_id{2},
+       pps::schema_version{1},
+       pps::is_deleted::no)
+      .get();
+    BOOST_REQUIRE(check(pps::verbose::no).is_compat);
+}
@@ -131,3 +131,33 @@ SEASTAR_THREAD_TEST_CASE(test_sharded_store_find_unordered) {
     BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{1});
     BOOST_REQUIRE_EQUAL(res.version, ver1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_get_schema_definitions) {
+    pps::sharded_store store;
+    store.start(pps::is_mutable::yes, ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::schema_version ver1{1};
+    store
+      .upsert(
+        pps::seq_marker{
+          std::nullopt, std::nullopt, ver1, pps::seq_marker_key_type::schema},
+        {pps::subject{"simple.proto"}, simple.share()},
+        pps::schema_id{1},
+        ver1,
+        pps::is_deleted::no)
+      .get();
+
+    auto defs = store
+                  .get_schema_definitions(
+                    {pps::schema_id{2}, pps::schema_id{1}, pps::schema_id{1}})
+                  .get();
+    BOOST_REQUIRE_EQUAL(defs.size(), 3);
+    BOOST_REQUIRE(!defs[0].has_value());
+    BOOST_REQUIRE(defs[1].has_value());
+    BOOST_REQUIRE(defs[1].value() == simple);
+    BOOST_REQUIRE(defs[2].has_value());
+    BOOST_REQUIRE(defs[2].value() == simple);
+
+    BOOST_REQUIRE(store.get_schema_definitions({}).get().empty());
+}
@@ -30,6 +30,7 @@
 #include "pandaproxy/schema_registry/types.h"
 #include "pandaproxy/schema_registry/validation_metrics.h"
 #include "storage/parser_utils.h"
+#include "utils/vint.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
@@ -38,9 +39,12 @@
 #include <seastar/coroutine/exception.hh>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/btree_set.h>
 
+#include <array>
 #include <iterator>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 
@@ -101,6 +105,115 @@ std::vector<int32_t> get_proto_offsets(iobuf_parser& p) {
     return offsets;
 }
 
+/// Same decoding as get_proto_offsets over \p prefix, the first bytes of the
+/// \p len bytes following the schema id. Returns nullopt if \p prefix is
+/// truncated and the indexes may extend past it.
+std::optional<std::vector<int32_t>>
+get_proto_offsets(std::span<const uint8_t> prefix, size_t len) {
+    const bool truncated = prefix.size() < len;
+    size_t pos = 0;
+    auto read_varlong = [&]() -> std::optional<std::pair<int64_t, size_t>> {
+        if (truncated && pos + vint::max_length > prefix.size()) {
+            return std::nullopt;
+        }
+        auto r = vint::deserialize(prefix.subspan(pos));
+        pos += r.second;
+        return r;
+    };
+
+    std::vector<int32_t> offsets;
+    auto count = read_varlong();
+    if (!count) {
+        return std::nullopt;
+    }
+    auto [offset_count, bytes_read] = *count;
+    if (!bytes_read) {
+        return offsets;
+    }
+    if (static_cast<size_t>(offset_count) > len - pos) {
+        return offsets;
+    }
+    offsets.resize(offset_count);
+    for (auto& o : offsets) {
+        auto offset = read_varlong();
+        if (!offset) {
+            return std::nullopt;
+        }
+        if (!offset->second) {
+            return std::vector<int32_t>{};
+        }
+        o = static_cast<int32_t>(offset->first);
+    }
+    if (offsets.empty()) {
+        offsets.push_back(0);
+    }
+    return offsets;
+}
+
+/// The schema a record field refers to
+struct field_schema {
+    field f;
+    schema_id id;
+    // protobuf message indexes, empty if they can't be decoded. The schema
+    // type is only known once the schema is looked up, they are decoded
+    // regardless.
+    std::vector<int32_t> offsets;
+
+    friend bool operator<(const field_schema& l, const field_schema& r) {
+        return std::tie(l.f, l.id, l.offsets) < std::tie(r.f, r.id, r.offsets);
+    }
+};
+
+// Bytes following the schema id copied to decode the protobuf message indexes
+// without copying the whole field
+constexpr size_t max_field_prefix = 128;
+
+/// Decodes the schema of the \p len bytes field at the position of \p p and
+/// consumes it. Returns nullopt if the field doesn't start with a schema id.
+std::optional<field_schema> parse_field_schema(
+  const model::topic& topic, field f, iobuf_const_parser& p, int64_t len) {
+    if (len < 5) {
+        vlog(
+          plog.debug,
+          "validating: topic: {}, field: {}, not enough bytes: {}",
+          topic(),
+          to_string_view(f),
+          std::max(len, int64_t{0}));
+        p.skip(std::max(len, int64_t{0}));
+        return std::nullopt;
+    }
+    auto magic = p.consume_type<int8_t>();
+    auto id = schema_id{p.consume_be_type<int32_t>()};
+    const auto tail = static_cast<size_t>(len - 5);
+    if (magic != 0) {
+        vlog(
+          plog.debug,
+          "validating: topic: {}, field: {}, invalid magic: {}",
+          topic(),
+          to_string_view(f),
+          magic);
+        p.skip(tail);
+        return std::nullopt;
+    }
+
+    std::array<uint8_t, max_field_prefix> prefix{};
+    const auto prefix_len = std::min(tail, prefix.size());
+    p.consume_to(prefix_len, prefix.data());
+    auto offsets = get_proto_offsets(
+      std::span<const uint8_t>(prefix.data(), prefix_len), tail);
+    if (offsets) {
+        p.skip(tail - prefix_len);
+    } else {
+        // the indexes are longer than the prefix, decode the whole field
+        iobuf buf;
+        buf.append(prefix.data(), prefix_len);
+        buf.append(p.copy(tail - prefix_len));
+        iobuf_parser parser(std::move(buf));
+        offsets = get_proto_offsets(parser);
+    }
+    return field_schema{.f = f, .id = id, .offsets = *std::move(offsets)};
+}
+
 ss::future<std::optional<ss::sstring>> get_record_name(
   pandaproxy::schema_registry::sharded_store& store,
   subject_name_strategy sns,
@@ -187,35 +300,13 @@ public:
           props.record_value_subject_name_strategy_compat,
           subject_name_strategy::topic_name)} {}
 
-    auto validate_field(
-      field field,
-      model::topic topic,
-      subject_name_strategy sns,
-      iobuf buf) -> ss::future<bool> {
-        iobuf_parser parser(std::move(buf));
-
-        if (parser.bytes_left() < 5) {
-            vlog(
-              plog.debug,
-              "validating: topic: {}, field: {}, not enough bytes: {}",
-              topic(),
-              to_string_view(field),
-              parser.bytes_left());
-            co_return false;
-        }
-
-        auto magic = parser.consume_type<int8_t>();
-        if (magic != 0) {
-            vlog(
-              plog.debug,
-              "validating: topic: {}, field: {}, invalid magic: {}",
-              topic(),
-              to_string_view(field),
-              magic);
-            co_return false;
-        }
-
-        auto id = schema_id{parser.consume_be_type<int32_t>()};
+    auto validate_field_schema(
+      const model::topic& topic, field_schema fs) -> ss::future<bool> {
+        const auto sns = fs.f == field::key
+                           ? _record_key_subject_name_strategy
+                           : _record_value_subject_name_strategy;
+        const auto field = fs.f;
+        const auto id = fs.id;
 
         // Optimistically check the cache in case just the id matches
         // This is true for Avro with TopicNameStrategy
@@ -246,8 +337,7 @@ public:
 
         std::optional<std::vector<int32_t>> proto_offsets;
         if (schema->type() == schema_type::protobuf) {
-            auto offsets = get_proto_offsets(parser);
-            if (offsets.empty()) {
+            if (fs.offsets.empty()) {
                 vlog(
                   plog.debug,
                   "validating: topic: {}, field: {}, invalid protobuf offsets",
@@ -257,7 +347,7 @@ public:
             }
 
             if (_api->_schema_id_cache.local().has(
-                  topic, field, sns, id, offsets)) {
+                  topic, field, sns, id, fs.offsets)) {
                 vlog(
                   plog.debug,
                   "validating: topic: {}, field: {}, cache hit",
@@ -267,7 +357,7 @@ public:
                 co_return true;
             }
 
-            proto_offsets.emplace(std::move(offsets));
+            proto_offsets.emplace(std::move(fs.offsets));
         }
 
         auto record_name = co_await get_record_name(
@@ -301,6 +391,44 @@ public:
         co_return true;
     };
 
+    /// Decodes the schemas of the validated fields of every record in a single
+    /// pass over the batch, without materializing the records. Returns false
+    /// if a field doesn't refer to a schema.
+    bool collect_field_schemas(
+      const model::record_batch& batch, absl::btree_set<field_schema>& out) {
+        iobuf_const_parser p(batch.data());
+        auto consume_field = [this, &p, &out](bool validated, field f) {
+            auto [len, _] = p.read_varlong();
+            if (!validated) {
+                p.skip(std::max(len, int64_t{0}));
+                return true;
+            }
+            auto fs = parse_field_schema(_topic, f, p, len);
+            if (!fs) {
+                return false;
+            }
+            out.insert(*std::move(fs));
+            return true;
+        };
+        for (int32_t i = 0; i < batch.record_count(); ++i) {
+            auto [record_size, _] = p.read_varlong();
+            const auto record_end = p.bytes_consumed() + record_size;
+            p.skip(sizeof(model::record_attributes::type));
+            p.read_varlong(); // timestamp delta
+            p.read_varlong(); // offset delta
+            if (!consume_field(_record_key_schema_id_validation, field::key)) {
+                return false;
+            }
+            if (!consume_field(
+                  _record_value_schema_id_validation, field::val)) {
+                return false;
+            }
+            // headers
+            p.skip(record_end - p.bytes_consumed());
+        }
+        return true;
+    }
+
     ss::future<bool> validate(const model::record_batch& batch) {
         if (
           !_record_key_schema_id_validation
@@ -308,30 +436,6 @@ public:
             co_return true;
         }
 
-        auto key_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_key_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::key,
-              _topic,
-              _record_key_subject_name_strategy,
-              record.key().copy());
-        };
-
-        auto value_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_value_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::val,
-              _topic,
-              _record_value_subject_name_strategy,
-              record.value().copy());
-        };
-
         const model::record_batch& b = batch;
         std::optional<const model::record_batch> u;
         bool compressed = batch.compressed();
@@ -341,18 +445,18 @@ public:
             _api->_schema_id_validation_probe.local().decompressed();
         }
 
-        bool valid{true};
-        co_await model::for_each_record(
-          compressed ? u.value() : b,
-          [&valid, k{std::move(key_is_valid)}, v{std::move(value_is_valid)}](
-            const model::record& r) {
-              return k(r)
-                .then([&r, v{std::move(v)}](bool k) {
-                    return k ? v(r) : ss::make_ready_future<bool>(false);
-                })
-                .then([&valid](bool v) { valid = v; });
-          });
-        co_return valid;
+        // records of a batch usually share a few schemas, each one is
+        // validated once
+        absl::btree_set<field_schema> schemas;
+        if (!collect_field_schemas(compressed ? u.value() : b, schemas)) {
+            co_return false;
+        }
+        for (const auto& fs : schemas) {
+            if (!co_await validate_field_schema(_topic, fs)) {
+                co_return false;
+            }
+        }
+        co_return true;
     }
 
     ss::future<result> operator()(model::record_batch batch) {
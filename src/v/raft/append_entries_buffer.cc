@@ -47,6 +47,7 @@ ss::future<> append_entries_buffer::stop() {
     // wait for gate to be closed so all the pending requests will finish before
     // we invalidate pending promisses
     co_await std::move(f);
+    co_await std::exchange(_replies_sent, ss::now());
     auto response_promises = std::exchange(_responses, {});
     // set errors
     for (auto& p : response_promises) {
@@ -113,12 +114,28 @@ ss::future<> append_entries_buffer::do_flush(
         }
     }
 
-    // units were released before flushing log
-    co_await std::move(f);
-
-    propagate_results(std::move(replies), std::move(response_promises));
-    _flushed.broadcast();
-    co_return;
+    // units were released before flushing log. The replies of this batch are
+    // sent in the background once the flush is done, so that the next batch
+    // can be appended while the disk is busy flushing this one. Replies of
+    // the previous batch go out first to keep them in request order, this
+    // also limits the buffer to a single batch waiting for its flush.
+    co_await std::exchange(_replies_sent, ss::now());
+    _replies_sent = std::move(f).then_wrapped(
+      [this,
+       replies = std::move(replies),
+       response_promises = std::move(response_promises)](
+        ss::future<> flushed) mutable {
+          if (flushed.failed()) {
+              auto e = flushed.get_exception();
+              for (auto& p : response_promises) {
+                  p.set_exception(e);
+              }
+          } else {
+              propagate_results(
+                std::move(replies), std::move(response_promises));
+          }
+          _flushed.broadcast();
+      });
 }
 
 void append_entries_buffer::propagate_results(
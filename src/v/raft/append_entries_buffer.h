@@ -118,6 +118,11 @@ class consensus;
  * entries to its local log. It can therefore update commit_index as soon as it
  * will receive the first response, still being correct and guaranteeing safety.
  *
+ * Replies of a batch are sent in the background once its flush is done, so
+ * the next batch is appended while the previous one is being flushed. At
+ * most one batch waits for its flush at a time and replies are sent in
+ * request order.
+ *
  * Note on backpressure handling:
  *
  * The backpressure is handled using condition variable. When buffer has free
@@ -152,6 +157,8 @@ private:
     ss::condition_variable _enqueued;
     ss::gate _gate;
     ss::condition_variable _flushed;
+    // replies of the batch waiting for its flush
+    ss::future<> _replies_sent = ss::now();
     const size_t _max_buffered;
 };
 
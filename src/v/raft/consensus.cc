@@ -110,6 +110,7 @@ consensus::consensus(
     recovery_throttle,
   recovery_memory_quota& recovery_mem_quota,
   recovery_scheduler& recovery_scheduler,
+  flush_coordinator& flush_coordinator,
   features::feature_table& ft,
   std::optional<voter_priority> voter_priority_override,
   keep_snapshotted_log should_keep_snapshotted_log)
@@ -137,6 +138,7 @@ consensus::consensus(
   , _recovery_throttle(recovery_throttle)
   , _recovery_mem_quota(recovery_mem_quota)
   , _recovery_scheduler(recovery_scheduler)
+  , _flush_coordinator(flush_coordinator)
   , _features(ft)
   , _snapshot_mgr(
       std::filesystem::path(_log->config().work_directory()),
@@ -1705,6 +1707,24 @@ void consensus::read_voted_for() {
     }
 }
 
+bool consensus::persisted_vote_for(
+  storage::kvstore& kvs, group_id group, model::node_id self) {
+    const auto key = raft::details::serialize_group_key(
+      group, metadata_key::voted_for);
+    auto value = kvs.get(storage::kvstore::key_space::consensus, key);
+    if (!value) {
+        return false;
+    }
+    try {
+        return reflection::adl<consensus::voted_for_configuration>{}
+                 .from(std::move(*value))
+                 .voted_for.id()
+               == self;
+    } catch (...) {
+        return false;
+    }
+}
+
 ss::future<vote_reply> consensus::vote(vote_request&& r) {
     return with_gate(_bg, [this, r = std::move(r)]() mutable {
         auto target_node_id = r.node_id;
@@ -2785,7 +2805,9 @@ ss::future<consensus::flushed> consensus::flush_log() {
     const auto prior_truncations = _log->get_log_truncation_counter();
     _probe->log_flushed();
     _pending_flush_bytes = 0;
-    co_await _log->flush();
+    // flushing later than requested is safe, the log is flushed at least up
+    // to the offset captured above
+    co_await _flush_coordinator.flush(_group, [this] { return _log->flush(); });
     _last_flush_time = clock_type::now();
     const auto lstats = _log->offsets();
     /**
@@ -3147,14 +3169,19 @@ consensus::do_maybe_update_leader_commit_idx(ssx::semaphore_units u) {
      * we have to make sure that we do not advance committed_index beyond the
      * point which is readable in log. Since we are not waiting for flush to
      * happen before updating leader commited index we have to limit committed
-     * index to the log committed offset. This way we make sure that when read
+     * index to the log stable offset. This way we make sure that when read
      * is handled all batches up to committed offset will be visible. Allowing
-     * committed offset to be greater than leader flushed offset may result in
+     * committed offset to be greater than the stable offset may result in
      * stale read i.e. even though the committed_index was updated on the leader
      * batcher aren't readable since some of the writes are still in flight in
      * segment appender.
+     *
+     * The leader itself does not have to be flushed, a majority of followers
+     * which flushed is as durable. This keeps the leader's fsync off the
+     * critical path when its disk is the slow one.
      */
-    majority_match = std::min(majority_match, _flushed_offset);
+    majority_match = std::min(
+      majority_match, std::max(_flushed_offset, _log->offsets().stable_offset));
 
     if (majority_match > _commit_index && get_term(majority_match) == _term) {
         update_confirmed_term();
@@ -25,6 +25,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/coordinated_recovery_throttle.h"
 #include "raft/event_manager.h"
+#include "raft/flush_coordinator.h"
 #include "raft/follower_stats.h"
 #include "raft/group_configuration.h"
 #include "raft/heartbeats.h"
@@ -108,6 +109,7 @@ public:
       std::optional<std::reference_wrapper<coordinated_recovery_throttle>>,
       recovery_memory_quota&,
       recovery_scheduler&,
+      flush_coordinator&,
       features::feature_table&,
       std::optional<voter_priority> = std::nullopt,
       keep_snapshotted_log = keep_snapshotted_log::no);
@@ -123,6 +125,12 @@ public:
     /// Stop consensus instance from accepting requests
     void shutdown_input();
 
+    /// Whether the vote persisted for `group` before a restart was cast for
+    /// `self`, i.e. the node was leading or campaigning in the latest term it
+    /// knew of. Used as a hint only, any decoding error yields false.
+    static bool
+    persisted_vote_for(storage::kvstore&, group_id, model::node_id self);
+
     ss::future<vote_reply> vote(vote_request&& r);
     ss::future<append_entries_reply> append_entries(append_entries_request&& r);
     ss::future<install_snapshot_reply>
@@ -886,6 +894,7 @@ private:
       _recovery_throttle;
     recovery_memory_quota& _recovery_mem_quota;
     recovery_scheduler& _recovery_scheduler;
+    flush_coordinator& _flush_coordinator;
     features::feature_table& _features;
     storage::simple_snapshot_manager _snapshot_mgr;
     uint64_t _snapshot_size{0};
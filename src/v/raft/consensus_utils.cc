@@ -355,6 +355,14 @@ ss::future<> create_offset_translator_state_for_pre_existing_partition(
       "{} Prepare offset_translator_state in kv-store, last ot-offset {}",
       ntp_cfg.ntp(),
       max_rp_offset);
+    // the full map written below supersedes any compact checkpoint left over
+    // from a previous incarnation of the group
+    co_await api.kvs().remove(
+      storage::kvstore::key_space::offset_translator,
+      storage::offset_translator::kvstore_compact_offsetmap_key(group));
+    co_await api.kvs().remove(
+      storage::kvstore::key_space::offset_translator,
+      storage::offset_translator::kvstore_offsetmap_tail_key(group));
     co_await api.kvs().put(
       storage::kvstore::key_space::offset_translator,
       storage::offset_translator::kvstore_offsetmap_key(group),
@@ -0,0 +1,58 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/flush_coordinator.h"
+
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/later.hh>
+#include <seastar/coroutine/as_future.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+
+namespace raft {
+
+ss::future<> flush_coordinator::flush(group_id group, flush_fn fn) {
+    auto holder = _gate.hold();
+    auto [it, inserted] = _pending.try_emplace(group);
+    if (inserted) {
+        it->second = ss::make_lw_shared<request>(std::move(fn));
+    }
+    auto req = it->second;
+    if (!_running) {
+        _running = true;
+        ssx::spawn_with_gate(_gate, [this] { return run_rounds(); });
+    }
+    co_await req->done.get_shared_future();
+}
+
+ss::future<> flush_coordinator::run_rounds() {
+    // let other groups flushing in the same tick join the first round
+    co_await ss::yield();
+    while (!_pending.empty()) {
+        auto round = std::exchange(_pending, {});
+        ++_round_count;
+        co_await ss::coroutine::parallel_for_each(
+          round, [](requests_t::value_type& entry) -> ss::future<> {
+              auto req = entry.second;
+              auto f = co_await ss::coroutine::as_future(
+                ss::futurize_invoke(req->fn));
+              if (f.failed()) {
+                  req->done.set_exception(f.get_exception());
+              } else {
+                  req->done.set_value();
+              }
+          });
+    }
+    _running = false;
+}
+
+ss::future<> flush_coordinator::stop() { return _gate.close(); }
+
+} // namespace raft
@@ -0,0 +1,75 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "raft/fundamental.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+namespace raft {
+
+/**
+ * Shard wide group commit of raft logs.
+ *
+ * With many low throughput groups on a shard every group would otherwise
+ * flush its log on its own schedule, paying for a full device flush per
+ * append. The coordinator collects the flushes requested by all groups on
+ * the shard into rounds. While a round is in progress new requests are
+ * queued, and once it completes all queued groups are flushed concurrently
+ * in the next round, so that the device can coalesce their flushes.
+ *
+ * A round is started as soon as the coordinator is idle, after yielding once
+ * so that groups requesting a flush in the same reactor tick join it, hence
+ * an idle shard does not delay flushes. Requests of the same group queued for
+ * the same round are flushed once.
+ */
+class flush_coordinator {
+public:
+    using flush_fn = ss::noncopyable_function<ss::future<>()>;
+
+    /**
+     * Flush a log of the group with \p fn as part of the next round. The
+     * returned future resolves once the flush completes.
+     */
+    ss::future<> flush(group_id, flush_fn fn);
+
+    ss::future<> stop();
+
+    /// Number of rounds of flushes, exposed for testing.
+    size_t round_count() const { return _round_count; }
+
+private:
+    struct request {
+        explicit request(flush_fn fn)
+          : fn(std::move(fn)) {}
+
+        flush_fn fn;
+        ss::shared_promise<> done;
+    };
+
+    using requests_t
+      = absl::flat_hash_map<group_id, ss::lw_shared_ptr<request>>;
+
+    ss::future<> run_rounds();
+
+    requests_t _pending;
+    bool _running{false};
+    size_t _round_count{0};
+    ss::gate _gate;
+};
+
+} // namespace raft
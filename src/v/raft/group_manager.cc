@@ -105,6 +105,7 @@ ss::future<> group_manager::stop() {
                 return raft->stop().discard_result();
             });
       })
+      .then([this] { return _flush_coordinator.stop(); })
       .then([this] { return _buffered_protocol->stop(); });
 }
 void group_manager::set_ready() {
@@ -146,6 +147,7 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
         : std::nullopt,
       _recovery_mem_quota,
       _recovery_scheduler,
+      _flush_coordinator,
       _feature_table,
       _is_ready ? std::nullopt : std::make_optional(min_voter_priority),
       keep_snapshotted_log);
@@ -14,6 +14,7 @@
 #include "metrics/metrics.h"
 #include "model/metadata.h"
 #include "raft/buffered_protocol.h"
+#include "raft/flush_coordinator.h"
 #include "raft/heartbeat_manager.h"
 #include "raft/notification.h"
 #include "raft/recovery_memory_quota.h"
@@ -123,6 +124,7 @@ private:
     coordinated_recovery_throttle& _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     recovery_scheduler _recovery_scheduler;
+    flush_coordinator _flush_coordinator;
     features::feature_table& _feature_table;
     std::chrono::milliseconds _metric_collection_interval;
     ss::timer<> _metrics_timer;
@@ -262,13 +262,19 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat r) {
       r.meta_map.size(),
       r.target);
 
+    // LZ4 is much cheaper than zstd for the small, frequent heartbeat
+    // payloads, but older nodes can not decompress it.
+    const auto compression
+      = _feature_table.is_active(features::feature::rpc_lz4_compression)
+          ? rpc::compression_type::lz4
+          : rpc::compression_type::zstd;
     auto f = _client_protocol
                .heartbeat_v2(
                  r.target,
                  std::move(r.request),
                  rpc::client_opts(
                    rpc::timeout_spec::from_now(_heartbeat_timeout()),
-                   rpc::compression_type::zstd,
+                   compression,
                    512))
                .then([node = r.target,
                       groups = std::move(r.meta_map),
@@ -632,14 +638,32 @@ ss::future<> heartbeat_manager::deregister_group(group_id g) {
 
 ss::future<>
 heartbeat_manager::register_group(ss::lw_shared_ptr<consensus> ptr) {
-    return _lock.with([this, ptr = std::move(ptr)] {
-        auto ret = _consensus_groups.insert(ptr);
+    _pending_registrations.push_back(std::move(ptr));
+    return _lock.with([this] { merge_pending_registrations(); });
+}
+
+void heartbeat_manager::merge_pending_registrations() {
+    if (_pending_registrations.empty()) {
+        return;
+    }
+    auto pending = std::exchange(_pending_registrations, {});
+    std::sort(
+      pending.begin(), pending.end(), details::consensus_ptr_by_group_id{});
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const auto& ptr = pending[i];
         vassert(
-          ret.second,
+          _consensus_groups.find(ptr->group()) == _consensus_groups.end()
+            && (i == 0 || pending[i - 1]->group() != ptr->group()),
           "double registration of group: {}:{}",
           ptr->ntp(),
           ptr->group());
-    });
+    }
+    // merging a sorted range is linear in the size of the set while
+    // inserting the groups one by one shifts the set for every group
+    _consensus_groups.insert(
+      boost::container::ordered_unique_range,
+      std::make_move_iterator(pending.begin()),
+      std::make_move_iterator(pending.end()));
 }
 
 ss::future<> heartbeat_manager::start() {
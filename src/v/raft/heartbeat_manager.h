@@ -188,6 +188,10 @@ private:
       reply_result status);
 
     ss::future<heartbeat_requests> requests_for_range();
+
+    /// \brief merges all the pending registrations into the consensus set,
+    /// must be called with the lock held
+    void merge_pending_registrations();
     // private members
 
     mutex _lock{"heartbeat_manager"};
@@ -200,6 +204,11 @@ private:
     /// insertion/deletion happens very infrequently.
     /// this is optimized for traversal + finding
     consensus_set _consensus_groups;
+    /// groups waiting for the lock to be registered. When many groups are
+    /// created at once, e.g. on startup, the first registration to get the
+    /// lock merges all of them into the consensus set at once rather than
+    /// inserting them one by one.
+    std::vector<consensus_ptr> _pending_registrations;
     consensus_client_protocol _client_protocol;
     model::node_id _self;
     config::binding<bool> _enable_lw_heartbeat;
@@ -23,6 +23,7 @@
 
 #include <exception>
 #include <filesystem>
+#include <stdexcept>
 namespace raft {
 namespace {
 
@@ -86,17 +87,27 @@ ss::future<> persisted_stm_base<BaseT, T>::stop() {
 
 template<typename BaseT, supported_stm_snapshot T>
 ss::future<> persisted_stm_base<BaseT, T>::remove_persistent_state() {
+    _full_local_snapshot_required = true;
     return _snapshot_backend.remove_persistent_state();
 }
 
+template<typename BaseT, supported_stm_snapshot T>
+ss::future<> persisted_stm_base<BaseT, T>::apply_local_snapshot_delta(
+  stm_snapshot_header header, iobuf&&) {
+    return ss::make_exception_future<>(std::logic_error(fmt::format(
+      "{} does not support local snapshot deltas, found delta at offset {}",
+      name(),
+      header.offset)));
+}
+
 file_backed_stm_snapshot::file_backed_stm_snapshot(
   ss::sstring snapshot_name, prefix_logger& log, raft::consensus* c)
   : _ntp(c->ntp())
   , _log(log)
+  , _work_directory(c->log_config().work_directory())
   , _snapshot_mgr(
-      std::filesystem::path(c->log_config().work_directory()),
-      std::move(snapshot_name),
-      ss::default_priority_class()) {}
+      _work_directory, std::move(snapshot_name), ss::default_priority_class()) {
+}
 
 ss::future<> file_backed_stm_snapshot::perform_initial_cleanup() {
     // Do nothing as the log directory name contains the partition revision,
@@ -110,11 +121,24 @@ ss::future<> file_backed_stm_snapshot::remove_persistent_state() {
     _snapshot_size = 0;
     co_await _snapshot_mgr.remove_snapshot();
     co_await _snapshot_mgr.remove_partial_snapshots();
+    co_await remove_snapshot_deltas();
 }
 
 ss::future<std::optional<stm_snapshot>>
 file_backed_stm_snapshot::load_snapshot() {
-    auto maybe_reader = co_await _snapshot_mgr.open_snapshot();
+    auto snapshot = co_await read_snapshot(_snapshot_mgr);
+    if (!snapshot) {
+        co_return std::nullopt;
+    }
+    _snapshot_size = co_await _snapshot_mgr.get_snapshot_size();
+    co_await _snapshot_mgr.remove_partial_snapshots();
+    co_return snapshot;
+}
+
+ss::future<std::optional<stm_snapshot>>
+file_backed_stm_snapshot::read_snapshot(
+  storage::simple_snapshot_manager& snapshot_mgr) {
+    auto maybe_reader = co_await snapshot_mgr.open_snapshot();
     if (!maybe_reader) {
         co_return std::nullopt;
     }
@@ -130,7 +154,7 @@ file_backed_stm_snapshot::load_snapshot() {
             vlog(
               _log.warn,
               "Skipping snapshot {} due to old format",
-              store_path());
+              snapshot_mgr.snapshot_path());
 
             // can't load old format of the snapshot, since snapshot is missing
             // it will be reconstructed by replaying the log
@@ -140,25 +164,80 @@ file_backed_stm_snapshot::load_snapshot() {
         snapshot.header = *header;
         snapshot.data = co_await read_iobuf_exactly(
           reader.input(), snapshot.header.snapshot_size);
-
-        _snapshot_size = co_await reader.get_snapshot_size();
     } catch (...) {
         ex = std::current_exception();
         vlog(
           _log.warn,
           "Exception thrown while reading local snapshot: {}, exception: {}",
-          store_path(),
+          snapshot_mgr.snapshot_path(),
           ex);
     }
     co_await reader.close();
     if (ex != nullptr) {
         std::rethrow_exception(ex);
     }
-    co_await _snapshot_mgr.remove_partial_snapshots();
 
     co_return snapshot;
 }
 
+storage::simple_snapshot_manager
+file_backed_stm_snapshot::delta_snapshot_mgr(size_t idx) {
+    return {
+      _work_directory,
+      ssx::sformat("{}.delta.{}", _snapshot_mgr.name(), idx),
+      ss::default_priority_class()};
+}
+
+ss::future<std::vector<stm_snapshot>>
+file_backed_stm_snapshot::load_snapshot_deltas(model::offset base_offset) {
+    std::vector<stm_snapshot> deltas;
+    _deltas_size = 0;
+    _next_delta_idx = 0;
+    auto last_offset = base_offset;
+    while (true) {
+        auto mgr = delta_snapshot_mgr(_next_delta_idx);
+        auto delta = co_await read_snapshot(mgr);
+        /**
+         * Deltas left behind by a previous base snapshot, either because
+         * removing them was interrupted or the base was not loaded, do not
+         * follow the last offset. They are overwritten by the next deltas.
+         */
+        if (!delta || delta->header.offset <= last_offset) {
+            break;
+        }
+        last_offset = delta->header.offset;
+        _deltas_size += co_await mgr.get_snapshot_size();
+        co_await mgr.remove_partial_snapshots();
+        deltas.push_back(std::move(*delta));
+        ++_next_delta_idx;
+    }
+    co_return deltas;
+}
+
+ss::future<>
+file_backed_stm_snapshot::persist_snapshot_delta(stm_snapshot&& delta) {
+    auto mgr = delta_snapshot_mgr(_next_delta_idx);
+    co_await persist_local_snapshot(mgr, std::move(delta));
+    _deltas_size += co_await mgr.get_snapshot_size();
+    ++_next_delta_idx;
+}
+
+ss::future<> file_backed_stm_snapshot::remove_snapshot_deltas() {
+    size_t cnt = 0;
+    while (co_await delta_snapshot_mgr(cnt).snapshot_exists()) {
+        ++cnt;
+    }
+    // newest first so that an interrupted removal leaves a prefix behind
+    while (cnt > 0) {
+        --cnt;
+        auto mgr = delta_snapshot_mgr(cnt);
+        co_await mgr.remove_snapshot();
+        co_await mgr.remove_partial_snapshots();
+    }
+    _deltas_size = 0;
+    _next_delta_idx = 0;
+}
+
 ss::future<> file_backed_stm_snapshot::persist_local_snapshot(
   storage::simple_snapshot_manager& snapshot_mgr, stm_snapshot&& snapshot) {
     iobuf data_size_buf;
@@ -200,6 +279,10 @@ file_backed_stm_snapshot::persist_local_snapshot(stm_snapshot&& snapshot) {
       .then([this] {
           return _snapshot_mgr.get_snapshot_size().then(
             [this](uint64_t size) { _snapshot_size = size; });
+      })
+      .then([this] {
+          // the full snapshot supersedes all the deltas
+          return remove_snapshot_deltas();
       });
 }
 
@@ -212,7 +295,7 @@ ss::sstring file_backed_stm_snapshot::store_path() const {
 }
 
 size_t file_backed_stm_snapshot::get_snapshot_size() const {
-    return _snapshot_size;
+    return _snapshot_size + _deltas_size;
 }
 
 kvstore_backed_stm_snapshot::kvstore_backed_stm_snapshot(
@@ -313,11 +396,80 @@ ss::future<> persisted_stm_base<BaseT, T>::wait_for_snapshot_hydrated() {
 template<typename BaseT, supported_stm_snapshot T>
 ss::future<> persisted_stm_base<BaseT, T>::do_write_local_snapshot() {
     auto u = co_await BaseT::_apply_lock.get_units();
+    if (co_await maybe_write_local_snapshot_delta(u)) {
+        co_return;
+    }
     auto snapshot = co_await take_local_snapshot(std::move(u));
     auto offset = snapshot.header.offset;
+    auto size = snapshot.header.snapshot_size;
 
+    // the state machine considers the changes persisted once it took the
+    // snapshot, if persisting fails they may not be in the next delta
+    _full_local_snapshot_required = true;
     co_await _snapshot_backend.persist_local_snapshot(std::move(snapshot));
     _last_snapshot_offset = std::max(_last_snapshot_offset, offset);
+    _local_snapshot_size = size;
+    _local_snapshot_deltas = 0;
+    _local_snapshot_deltas_size = 0;
+    _full_local_snapshot_required = false;
+}
+
+template<typename BaseT, supported_stm_snapshot T>
+ss::future<bool> persisted_stm_base<BaseT, T>::maybe_write_local_snapshot_delta(
+  ssx::semaphore_units& apply_units) {
+    if constexpr (supported_stm_snapshot_deltas<T>) {
+        if (
+          _full_local_snapshot_required
+          || _local_snapshot_deltas >= max_local_snapshot_deltas
+          || _local_snapshot_deltas_size > _local_snapshot_size) {
+            co_return false;
+        }
+        auto delta = co_await take_local_snapshot_delta(apply_units);
+        if (!delta) {
+            co_return false;
+        }
+        apply_units.return_all();
+        auto offset = delta->header.offset;
+        auto size = delta->header.snapshot_size;
+        if (offset <= _last_snapshot_offset) {
+            // nothing was applied since the last snapshot
+            co_return true;
+        }
+
+        _full_local_snapshot_required = true;
+        co_await _snapshot_backend.persist_snapshot_delta(std::move(*delta));
+        _last_snapshot_offset = offset;
+        ++_local_snapshot_deltas;
+        _local_snapshot_deltas_size += size;
+        _full_local_snapshot_required = false;
+        co_return true;
+    } else {
+        co_return false;
+    }
+}
+
+template<typename BaseT, supported_stm_snapshot T>
+ss::future<model::offset>
+persisted_stm_base<BaseT, T>::apply_local_snapshot_deltas(
+  model::offset base_offset) {
+    _local_snapshot_deltas = 0;
+    _local_snapshot_deltas_size = 0;
+    if constexpr (supported_stm_snapshot_deltas<T>) {
+        auto deltas = co_await _snapshot_backend.load_snapshot_deltas(
+          base_offset);
+        for (auto& delta : deltas) {
+            vlog(
+              _log.trace,
+              "applying local snapshot delta at offset {}",
+              delta.header.offset);
+            base_offset = delta.header.offset;
+            _local_snapshot_deltas_size += delta.header.snapshot_size;
+            ++_local_snapshot_deltas;
+            co_await apply_local_snapshot_delta(
+              delta.header, std::move(delta.data));
+        }
+    }
+    co_return base_offset;
 }
 
 template<typename BaseT, supported_stm_snapshot T>
@@ -567,11 +719,29 @@ ss::future<> persisted_stm_base<BaseT, T>::start() {
             auto snapshot_applied = co_await apply_local_snapshot(
               snapshot.header, std::move(snapshot.data));
             if (snapshot_applied == local_snapshot_applied::yes) {
+                _local_snapshot_size = snapshot.header.snapshot_size;
+                model::offset last_offset;
+                try {
+                    last_offset = co_await apply_local_snapshot_deltas(
+                      snapshot.header.offset);
+                } catch (...) {
+                    vassert(
+                      false,
+                      "[[{}] ({})] Can't apply snapshot deltas from '{}'. Got "
+                      "error: {}",
+                      _raft->ntp(),
+                      name(),
+                      _snapshot_backend.store_path(),
+                      std::current_exception());
+                }
+                next_offset = model::next_offset(last_offset);
                 vlog(
                   _log.debug,
-                  "start with applied snapshot, set_next {}",
+                  "start with applied snapshot and {} deltas, set_next {}",
+                  _local_snapshot_deltas,
                   next_offset);
-                _last_snapshot_offset = snapshot.header.offset;
+                _last_snapshot_offset = last_offset;
+                _full_local_snapshot_required = false;
                 BaseT::set_next(next_offset);
             } else {
                 vlog(
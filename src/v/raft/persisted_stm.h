@@ -23,6 +23,10 @@
 
 #include <seastar/core/sharded.hh>
 
+#include <filesystem>
+#include <optional>
+#include <vector>
+
 namespace raft {
 
 inline constexpr const int8_t stm_snapshot_version_v0 = 0;
@@ -60,6 +64,9 @@ struct stm_snapshot {
 //
 // This is the default backend for stm_snapshots and works well when
 // there are very few partitions (ie for internal topics).
+//
+// Snapshot deltas are stored next to the snapshot in files suffixed with
+// `.delta.<n>`, persisting a full snapshot removes them.
 class file_backed_stm_snapshot {
 public:
     file_backed_stm_snapshot(
@@ -72,14 +79,28 @@ public:
     ss::future<> remove_persistent_state();
     size_t get_snapshot_size() const;
 
+    /// Returns the deltas persisted on top of the snapshot at `base_offset`
+    /// in the order they were written.
+    ss::future<std::vector<stm_snapshot>>
+    load_snapshot_deltas(model::offset base_offset);
+    ss::future<> persist_snapshot_delta(stm_snapshot&&);
+    ss::future<> remove_snapshot_deltas();
+
     static ss::future<>
     persist_local_snapshot(storage::simple_snapshot_manager&, stm_snapshot&&);
 
 private:
+    ss::future<std::optional<stm_snapshot>>
+    read_snapshot(storage::simple_snapshot_manager&);
+    storage::simple_snapshot_manager delta_snapshot_mgr(size_t idx);
+
     model::ntp _ntp;
     prefix_logger& _log;
+    std::filesystem::path _work_directory;
     storage::simple_snapshot_manager _snapshot_mgr;
     size_t _snapshot_size{0};
+    size_t _deltas_size{0};
+    size_t _next_delta_idx{0};
 };
 
 // stm_snapshots powered by the kvstore.
@@ -138,6 +159,21 @@ concept supported_stm_snapshot = requires(T s, stm_snapshot&& snapshot) {
     { s.store_path() } -> std::convertible_to<ss::sstring>;
 };
 
+/// Snapshot backends which can persist a snapshot as a base followed by
+/// deltas, each holding the changes made after the previous one was taken.
+template<typename T>
+concept supported_stm_snapshot_deltas
+  = supported_stm_snapshot<T>
+    && requires(T s, stm_snapshot&& snapshot, model::offset o) {
+           {
+               s.load_snapshot_deltas(o)
+           } -> std::same_as<ss::future<std::vector<stm_snapshot>>>;
+           {
+               s.persist_snapshot_delta(std::move(snapshot))
+           } -> std::same_as<ss::future<>>;
+           { s.remove_snapshot_deltas() } -> std::same_as<ss::future<>>;
+       };
+
 /**
  * persisted_stm is a base class for building ingestion time (*) state
  * machines. Ingestion time means a state machine doesn't need to
@@ -160,6 +196,12 @@ concept supported_stm_snapshot = requires(T s, stm_snapshot&& snapshot) {
  *
  * To speed up the catch up process persisted_stm snapshots the state
  * and uses it as a base for replaying the commands.
+ *
+ * State machines with large state may opt in for incremental snapshots by
+ * implementing take_local_snapshot_delta() and apply_local_snapshot_delta().
+ * When supported by the snapshot backend only the changes are persisted and a
+ * full snapshot is taken once there are `max_local_snapshot_deltas` deltas or
+ * they are larger than the full snapshot.
  */
 
 template<typename BaseT, supported_stm_snapshot T = file_backed_stm_snapshot>
@@ -238,6 +280,28 @@ protected:
     virtual ss::future<stm_snapshot>
     take_local_snapshot(ssx::semaphore_units apply_units) = 0;
 
+    /**
+     * Called instead of take_local_snapshot when the snapshot may be persisted
+     * as a delta. The delta must contain all the changes applied since the
+     * previous local snapshot, full or delta, was taken. The state machine
+     * returns std::nullopt when the changes can not be expressed as a delta,
+     * e.g. after a raft snapshot was applied, and a full snapshot is taken
+     * instead.
+     */
+    virtual ss::future<std::optional<stm_snapshot>>
+    take_local_snapshot_delta(const ssx::semaphore_units&) {
+        return ss::make_ready_future<std::optional<stm_snapshot>>();
+    }
+
+    /**
+     * Called on start for each delta persisted after the local snapshot
+     * passed to apply_local_snapshot, in the order they were taken.
+     */
+    virtual ss::future<>
+    apply_local_snapshot_delta(stm_snapshot_header, iobuf&&);
+
+    static constexpr size_t max_local_snapshot_deltas = 16;
+
     /*
      * `sync` checks that current node is a leader and if `sync` wasn't
      * called within its term it waits until the state machine is caught
@@ -260,12 +324,20 @@ private:
     ss::future<> wait_for_snapshot_hydrated();
 
     ss::future<> do_write_local_snapshot();
+    ss::future<bool> maybe_write_local_snapshot_delta(ssx::semaphore_units&);
+    ss::future<model::offset> apply_local_snapshot_deltas(model::offset);
     mutex _op_lock{"persisted_stm::op_lock"};
     std::vector<ss::lw_shared_ptr<expiring_promise<bool>>> _sync_waiters;
     ss::condition_variable _on_snapshot_hydrated;
     bool _snapshot_hydrated{false};
     T _snapshot_backend;
     model::offset _last_snapshot_offset;
+    // deltas written on top of the last full local snapshot
+    size_t _local_snapshot_size{0};
+    size_t _local_snapshot_deltas{0};
+    size_t _local_snapshot_deltas_size{0};
+    // set when the changes since the last snapshot may not be in a delta
+    bool _full_local_snapshot_required{true};
 };
 
 template<supported_stm_snapshot T = file_backed_stm_snapshot>
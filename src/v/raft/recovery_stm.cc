@@ -11,6 +11,7 @@
 
 #include "base/outcome_future_utils.h"
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "raft/consensus.h"
@@ -18,6 +19,7 @@
 #include "raft/errc.h"
 #include "raft/logger.h"
 #include "raft/raftgen_service.h"
+#include "ssx/future-util.h"
 #include "ssx/sformat.h"
 #include "storage/snapshot.h"
 #include "utils/human.h"
@@ -53,7 +55,10 @@ recovery_stm::recovery_stm(
         _term,
         _ptr->group(),
         _ptr->ntp()))
-  , _memory_quota(quota) {}
+  , _memory_quota(quota)
+  , _max_inflight_requests(
+      config::shard_local_cfg().raft_recovery_max_inflight_requests())
+  , _inflight_requests(_max_inflight_requests, "raft/recovery-inflight") {}
 
 ss::future<> recovery_stm::recover() {
     auto meta = get_follower_meta();
@@ -75,6 +80,7 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     // We have to send all the records that leader have, event those that are
     // beyond commit index, thanks to that after majority have recovered
     // leader can update its commit index
+    auto inflight_units = co_await ss::get_units(_inflight_requests, 1);
     auto meta = get_follower_meta();
     if (!meta) {
         // stop recovery when node was removed
@@ -88,6 +94,13 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     const required_snapshot_type snapshot_needed = get_required_snapshot_type(
       *meta.value());
     if (snapshot_needed != required_snapshot_type::none) {
+        if (has_inflight_requests()) {
+            // let the pipelined requests finish and re-evaluate the follower
+            // state before switching to snapshot delivery
+            auto drained = co_await ss::get_units(
+              _inflight_requests, _max_inflight_requests - 1);
+            co_return;
+        }
         co_return co_await install_snapshot(snapshot_needed);
     }
 
@@ -124,6 +137,13 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     _committed_offset = _ptr->committed_offset();
 
     auto follower_next_offset = meta.value()->next_index;
+    if (has_inflight_requests()) {
+        // the follower next index is only updated when the reply is received,
+        // continue from the end of the last dispatched range
+        follower_next_offset = std::max(
+          follower_next_offset,
+          model::next_offset(meta.value()->expected_log_end_offset));
+    }
     auto follower_committed_match_index = meta.value()->match_committed_index();
     auto is_learner = meta.value()->is_learner;
 
@@ -174,7 +194,17 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     }
 
     co_await replicate(
-      std::move(reader), flush, std::move(read_memory_units), range_size);
+      std::move(reader),
+      flush,
+      std::move(read_memory_units),
+      std::move(inflight_units),
+      range_size);
+}
+
+bool recovery_stm::has_inflight_requests() const {
+    // the caller always holds one unit for the request it is about to send
+    return _inflight_requests.available_units() + 1
+           < static_cast<ssize_t>(_max_inflight_requests);
 }
 
 flush_after_append
@@ -529,6 +559,7 @@ ss::future<> recovery_stm::replicate(
   model::record_batch_reader&& reader,
   flush_after_append flush,
   ssx::semaphore_units mem_units,
+  ssx::semaphore_units inflight_units,
   size_t range_size) {
     // collect metadata for append entries request
     // last persisted offset is last_offset of batch before the first one in the
@@ -604,53 +635,87 @@ ss::future<> recovery_stm::replicate(
 
     std::vector<ssx::semaphore_units> units;
     units.push_back(std::move(mem_units));
-    return dispatch_append_entries(std::move(r), std::move(units))
-      .finally([append_guard = std::move(append_guard)] {})
-      .then([this, seq, dirty_offset = lstats.dirty_offset](auto r) {
-          if (!r) {
-              vlog(
-                _ctxlog.warn,
-                "recovery append entries error: {}",
-                r.error().message());
-              _stop_requested = true;
-              _ptr->get_probe().recovery_request_error();
-          }
-          _ptr->process_append_entries_reply(
-            _node_id.id(), r.value(), seq, dirty_offset);
-          // If follower stats aren't present we have to stop recovery as
-          // follower was removed from configuration
-          if (!_ptr->_fstats.contains(_node_id)) {
-              _stop_requested = true;
-              return;
-          }
-          // If request was reordered we have to stop recovery as follower state
-          // is not known
-          if (seq < _ptr->_fstats.get(_node_id).last_received_seq) {
-              _stop_requested = true;
-              return;
-          }
-          // move the follower next index backward if recovery were not
-          // successful
-          //
-          // Raft paper:
-          // If AppendEntries fails because of log inconsistency: decrement
-          // nextIndex and retry(§5.3)
-
-          if (r.value().result == reply_result::failure) {
-              auto meta = get_follower_meta();
-              if (!meta) {
-                  _stop_requested = true;
-                  return;
-              }
-              meta.value()->next_index = std::max(
-                model::offset(0), model::prev_offset(_base_batch_offset));
-
-              vlog(
-                _ctxlog.trace,
-                "Move next index {} backward",
-                meta.value()->next_index);
-          }
+    ssx::spawn_with_gate(
+      _inflight_gate,
+      [this,
+       r = std::move(r),
+       units = std::move(units),
+       inflight_units = std::move(inflight_units),
+       append_guard = std::move(append_guard),
+       seq,
+       dirty_offset = lstats.dirty_offset,
+       base_batch_offset = _base_batch_offset]() mutable {
+          return dispatch_append_entries(std::move(r), std::move(units))
+            .then([this, seq, dirty_offset, base_batch_offset](
+                    result<append_entries_reply> reply) {
+                handle_recovery_reply(
+                  std::move(reply), seq, dirty_offset, base_batch_offset);
+            })
+            .handle_exception([this](const std::exception_ptr& e) {
+                vlog(_ctxlog.warn, "recovery append entries failed: {}", e);
+                _stop_requested = true;
+                if (auto meta = get_follower_meta(); meta) {
+                    meta.value()->follower_state_change.broadcast();
+                }
+            })
+            .finally([inflight_units = std::move(inflight_units),
+                      append_guard = std::move(append_guard)] {});
       });
+    return ss::now();
+}
+
+void recovery_stm::handle_recovery_reply(
+  result<append_entries_reply> r,
+  follower_req_seq seq,
+  model::offset dirty_offset,
+  model::offset base_batch_offset) {
+    if (!r) {
+        vlog(
+          _ctxlog.warn, "recovery append entries error: {}", r.error().message());
+        _stop_requested = true;
+        _ptr->get_probe().recovery_request_error();
+        // wake up the recovery loop waiting for the follower state to change
+        if (auto meta = get_follower_meta(); meta) {
+            meta.value()->follower_state_change.broadcast();
+        }
+        return;
+    }
+    _ptr->process_append_entries_reply(
+      _node_id.id(), r.value(), seq, dirty_offset);
+    // If follower stats aren't present we have to stop recovery as
+    // follower was removed from configuration
+    if (!_ptr->_fstats.contains(_node_id)) {
+        _stop_requested = true;
+        return;
+    }
+    // If request was reordered we have to stop recovery as follower state
+    // is not known
+    if (seq < _ptr->_fstats.get(_node_id).last_received_seq) {
+        _stop_requested = true;
+        return;
+    }
+    // move the follower next index backward if recovery were not
+    // successful
+    //
+    // Raft paper:
+    // If AppendEntries fails because of log inconsistency: decrement
+    // nextIndex and retry(§5.3)
+    if (r.value().result == reply_result::failure) {
+        auto meta = get_follower_meta();
+        if (!meta) {
+            _stop_requested = true;
+            return;
+        }
+        // pipelined requests dispatched after the failed one fail as well,
+        // never move the next index forward when processing their replies
+        meta.value()->next_index = std::min(
+          meta.value()->next_index,
+          std::max(model::offset(0), model::prev_offset(base_batch_offset)));
+        vlog(
+          _ctxlog.trace,
+          "Move next index {} backward",
+          meta.value()->next_index);
+    }
 }
 
 clock_type::time_point recovery_stm::append_entries_timeout() {
@@ -710,6 +775,7 @@ ss::future<> recovery_stm::apply() {
                        [this] { return recover(); });
                  });
              })
+      .finally([this] { return _inflight_gate.close(); })
       .finally([this] {
           vlog(_ctxlog.trace, "Finished recovery");
           auto meta = get_follower_meta();
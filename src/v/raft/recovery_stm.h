@@ -15,9 +15,12 @@
 #include "raft/fwd.h"
 #include "raft/recovery_memory_quota.h"
 #include "raft/types.h"
+#include "ssx/semaphore.h"
 #include "storage/snapshot.h"
 #include "utils/prefix_logger.h"
 
+#include <seastar/core/gate.hh>
+
 #include <vector>
 
 namespace raft {
@@ -65,7 +68,14 @@ private:
       model::record_batch_reader&& batches,
       flush_after_append request_flush_after_append,
       ssx::semaphore_units recovery_memory_units,
+      ssx::semaphore_units inflight_units,
       size_t batches_size);
+    void handle_recovery_reply(
+      result<append_entries_reply>,
+      follower_req_seq,
+      model::offset dirty_offset,
+      model::offset base_batch_offset);
+    bool has_inflight_requests() const;
 
     ss::future<result<append_entries_reply>> dispatch_append_entries(
       append_entries_request&&, std::vector<ssx::semaphore_units>);
@@ -107,6 +117,15 @@ private:
     bool _stop_requested = false;
     recovery_memory_quota& _memory_quota;
     size_t _recovered_bytes_since_flush = 0;
+    /**
+     * Recovery pipelines append entries requests to the follower. The next
+     * range is read and dispatched while replies for the previous ones are
+     * still pending, up to _max_inflight_requests. Replies are processed in
+     * the background, under _inflight_gate.
+     */
+    size_t _max_inflight_requests;
+    ssx::semaphore _inflight_requests;
+    ss::gate _inflight_gate;
 };
 
 } // namespace raft
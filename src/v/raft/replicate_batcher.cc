@@ -48,14 +48,30 @@ replicate_batcher::cache_and_wait_for_result(
   chunked_vector<model::record_batch> r,
   replicate_options opts) {
     item_ptr item;
+    std::optional<ss::gate::holder> holder;
+    std::optional<mutex::units> inline_flush_units;
     try {
-        auto holder = _bg.hold();
+        holder.emplace(_bg.hold());
         item = co_await do_cache(expected_term, std::move(r), opts);
 
         // now request is already enqueued, we can release first
         // stage future
         enqueued.set_value();
 
+        /**
+         * Fast path for relaxed consistency requests. When nothing else is
+         * waiting to be flushed the item is flushed by the caller, without
+         * a background fiber which has to be scheduled and wait for the
+         * batcher lock. For acks=0/1 requests the result is ready as soon
+         * as the leader appended the batches, the followers are replicated
+         * to in the background as usual.
+         */
+        if (
+          !_flush_pending && _item_cache.size() == 1
+          && opts.consistency != consistency_level::quorum_ack) {
+            inline_flush_units = _lock.try_get_units();
+        }
+
         /**
          * Dispatching flush in a background.
          *
@@ -65,7 +81,7 @@ replicate_batcher::cache_and_wait_for_result(
          * replicate batcher stop method
          *
          */
-        if (!_flush_pending) {
+        if (!inline_flush_units.has_value() && !_flush_pending) {
             _flush_pending = true;
             ssx::background = ssx::spawn_with_gate_then(_bg, [this]() {
                 return _lock.get_units()
@@ -90,6 +106,11 @@ replicate_batcher::cache_and_wait_for_result(
         co_return errc::replicate_batcher_cache_error;
     }
 
+    if (inline_flush_units.has_value()) {
+        // flush() doesn't throw, errors are propagated to the items
+        co_await flush(std::move(*inline_flush_units), false);
+    }
+
     co_return co_await item->get_future();
 }
 
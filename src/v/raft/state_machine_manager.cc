@@ -27,6 +27,7 @@
 #include "storage/types.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/with_scheduling_group.hh>
@@ -45,7 +46,12 @@ namespace raft {
 /**
  * Applicator which is a batch consumer that applies the same batch to multiple
  * state machines. If one of the STMs throws an exception from `apply` method
- * then not further batches are applied to that STM but the others continue
+ * then not further batches are applied to that STM but the others continue.
+ *
+ * When created with a manager, an STM which did not apply the batch within
+ * `detach_apply_timeout` while at least one of the others did is detached i.e.
+ * its apply is handed over to the manager and no further batches are applied
+ * to it by this applicator.
  */
 class batch_applicator {
 public:
@@ -53,7 +59,8 @@ public:
       const char* ctx,
       const std::vector<state_machine_manager::entry_ptr>& machines,
       ss::abort_source& as,
-      ctx_log& log);
+      ctx_log& log,
+      state_machine_manager* manager = nullptr);
 
     ss::future<ss::stop_iteration> operator()(model::record_batch);
 
@@ -63,71 +70,130 @@ private:
     struct apply_state {
         state_machine_manager::entry_ptr stm_entry;
         bool error{false};
+        bool detached{false};
     };
     using applied_successfully
       = ss::bool_class<struct applied_successfully_tag>;
-    ss::future<applied_successfully>
-    apply_to_stm(const model::record_batch& batch, apply_state& state);
+    using state_ptr = ss::lw_shared_ptr<apply_state>;
+    // does not refer to the applicator as a detached apply may outlive it
+    static ss::future<applied_successfully> apply_to_stm(
+      const char* ctx,
+      ctx_log& log,
+      ss::lw_shared_ptr<model::record_batch> batch,
+      state_ptr state);
+
+    bool diverged(model::offset last_offset) const;
 
     const char* _ctx;
-    std::vector<apply_state> _machines;
+    std::vector<state_ptr> _machines;
     model::offset _max_last_applied;
     ss::abort_source& _as;
     ctx_log& _log;
+    state_machine_manager* _manager;
 };
 
 batch_applicator::batch_applicator(
   const char* ctx,
   const std::vector<state_machine_manager::entry_ptr>& entries,
   ss::abort_source& as,
-  ctx_log& log)
+  ctx_log& log,
+  state_machine_manager* manager)
   : _ctx(ctx)
   , _as(as)
-  , _log(log) {
+  , _log(log)
+  , _manager(manager) {
     for (auto& m : entries) {
-        _machines.push_back(apply_state{.stm_entry = m});
+        _machines.push_back(
+          ss::make_lw_shared<apply_state>(apply_state{.stm_entry = m}));
     }
 }
 
 ss::future<ss::stop_iteration>
-batch_applicator::operator()(model::record_batch batch) {
-    const auto last_offset = batch.last_offset();
-    std::vector<ss::future<applied_successfully>> futures;
-    futures.reserve(_machines.size());
+batch_applicator::operator()(model::record_batch b) {
+    auto batch = ss::make_lw_shared<model::record_batch>(std::move(b));
+    const auto last_offset = batch->last_offset();
+    std::vector<state_ptr> selected;
+    std::vector<ss::shared_future<applied_successfully>> applies;
+    selected.reserve(_machines.size());
+    applies.reserve(_machines.size());
     for (auto& state : _machines) {
-        if (state.error) {
+        if (state->error || state->detached) {
             continue;
         }
-        futures.push_back(apply_to_stm(batch, state));
+        selected.push_back(state);
+        applies.emplace_back(apply_to_stm(_ctx, _log, batch, state));
     }
-    if (futures.empty()) {
+    if (applies.empty()) {
         co_return ss::stop_iteration::yes;
     }
 
-    auto results = co_await ss::when_all_succeed(
-      futures.begin(), futures.end());
+    const auto deadline = _manager != nullptr && applies.size() > 1
+                            ? ss::lowres_clock::now()
+                                + state_machine_manager::detach_apply_timeout
+                            : ss::lowres_clock::time_point::max();
+    std::vector<ss::future<applied_successfully>> futures;
+    futures.reserve(applies.size());
+    for (auto& apply : applies) {
+        futures.push_back(apply.get_future(deadline));
+    }
+    auto results = co_await ss::when_all(futures.begin(), futures.end());
+
+    const bool any_finished = std::any_of(
+      results.begin(), results.end(), [](auto& r) { return !r.failed(); });
+    bool any_applied = false;
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto applied = applied_successfully::no;
+        if (!results[i].failed()) {
+            applied = results[i].get();
+        } else {
+            // apply_to_stm never fails, this is the detach timeout
+            results[i].ignore_ready_future();
+            if (any_finished) {
+                selected[i]->detached = true;
+                co_await _manager->detach_apply(
+                  selected[i]->stm_entry,
+                  applies[i].get_future().discard_result());
+                continue;
+            }
+            // all of the STMs are slow, there is no one to detach from
+            applied = co_await applies[i].get_future();
+        }
+        any_applied = any_applied || applied == applied_successfully::yes;
+    }
     /**
      * If any of the STMs applied batch successfully update _max_last_applied
      */
-    if (std::any_of(
-          results.begin(),
-          results.end(),
-          std::bind_front(std::equal_to<>(), applied_successfully::yes))) {
+    if (any_applied) {
         _max_last_applied = last_offset;
     }
 
-    co_return ss::stop_iteration(_as.abort_requested());
+    co_return ss::stop_iteration(
+      _as.abort_requested() || diverged(last_offset));
+}
+
+bool batch_applicator::diverged(model::offset last_offset) const {
+    return std::any_of(
+      _machines.begin(), _machines.end(), [last_offset](const state_ptr& s) {
+          return s->detached
+                 && s->stm_entry->stm->next()
+                        + state_machine_manager::max_apply_divergence
+                      <= last_offset;
+      });
 }
+
 ss::future<batch_applicator::applied_successfully>
 batch_applicator::apply_to_stm(
-  const model::record_batch& batch, apply_state& state) {
-    const auto last_offset = batch.last_offset();
+  const char* ctx,
+  ctx_log& log,
+  ss::lw_shared_ptr<model::record_batch> batch,
+  state_ptr state) {
+    const auto last_offset = batch->last_offset();
     vlog(
-      _log.trace,
+      log.trace,
       "[{}][{}] applying batch with base {} and last {} offsets",
-      _ctx,
-      state.stm_entry->name,
-      batch.header().base_offset,
+      ctx,
+      state->stm_entry->name,
+      batch->header().base_offset,
       last_offset);
 
     try {
@@ -135,21 +201,21 @@ batch_applicator::apply_to_stm(
          * If an apply timed out (took long time) the stm may already advanced
          * past what was requested to read
          */
-        if (state.stm_entry->stm->next() > batch.base_offset()) {
+        if (state->stm_entry->stm->next() > batch->base_offset()) {
             co_return applied_successfully::no;
         }
 
-        co_await state.stm_entry->stm->apply(batch);
+        co_await state->stm_entry->stm->apply(*batch);
         co_return applied_successfully::yes;
     } catch (...) {
         vlog(
-          _log.warn,
+          log.warn,
           "[{}][{}] error applying batch with base_offset: {} - {}",
-          _ctx,
-          state.stm_entry->name,
-          batch.base_offset(),
+          ctx,
+          state->stm_entry->name,
+          batch->base_offset(),
           std::current_exception());
-        state.error = true;
+        state->error = true;
         co_return applied_successfully::no;
     }
 }
@@ -337,6 +403,7 @@ ss::future<> state_machine_manager::try_apply_in_foreground() {
             if (
               entry->stm->next() == _next
               && entry->background_apply_mutex.ready()) {
+                entry->slow_apply = false;
                 machines.push_back(entry);
             }
         }
@@ -348,6 +415,21 @@ ss::future<> state_machine_manager::try_apply_in_foreground() {
               _next);
             co_return;
         }
+        auto max_offset = _raft->committed_offset();
+        if (auto slowest = slowest_detached_next(); slowest.has_value()) {
+            const auto limit = *slowest + max_apply_divergence;
+            if (limit < _next) {
+                vlog(
+                  _log.debug,
+                  "waiting for detached state machines to catch up, slowest "
+                  "next offset: {}, current next offset: {}",
+                  *slowest,
+                  _next);
+                co_await ss::sleep_abortable(detach_apply_timeout, _as);
+                co_return;
+            }
+            max_offset = std::min(max_offset, limit);
+        }
         /**
          * Raft make_reader method allows callers reading up to
          * last_visible index. In order to make the STMs safe and working
@@ -355,21 +437,18 @@ ss::future<> state_machine_manager::try_apply_in_foreground() {
          * we have to limit reading to the committed offset.
          */
         vlog(
-          _log.trace,
-          "reading batches in range [{}, {}]",
-          _next,
-          _raft->committed_offset());
+          _log.trace, "reading batches in range [{}, {}]", _next, max_offset);
         /**
          * Use default priority for now, it is going to be unified with apply
          * scheduling group soon
          */
         storage::log_reader_config config(
-          _next, _raft->committed_offset(), ss::default_priority_class());
+          _next, max_offset, ss::default_priority_class());
 
         model::record_batch_reader reader = co_await _raft->make_reader(config);
 
         auto max_last_applied = co_await std::move(reader).consume(
-          batch_applicator(default_ctx, machines, _as, _log),
+          batch_applicator(default_ctx, machines, _as, _log, this),
           model::no_timeout);
 
         if (max_last_applied == model::offset{}) {
@@ -474,6 +553,8 @@ ss::future<> state_machine_manager::background_apply_fiber(
               std::current_exception());
         }
         if (error) {
+            // a failing STM is not slow, it must not hold back the others
+            entry->slow_apply = false;
             co_await ss::sleep_abortable(100ms, _as);
         }
     }
@@ -484,6 +565,56 @@ ss::future<> state_machine_manager::background_apply_fiber(
       entry->name);
 }
 
+ss::future<> state_machine_manager::detach_apply(
+  const entry_ptr& entry, ss::future<> in_flight) {
+    /**
+     * The foreground apply only selects STMs without a background apply in
+     * progress, there are no scheduling points in between
+     */
+    auto units = entry->background_apply_mutex.try_get_units();
+    vassert(
+      units.has_value(),
+      "background apply of '{}' state machine started during foreground "
+      "apply",
+      entry->name);
+    if (_gate.is_closed()) {
+        // shutting down, there is no background apply to hand over to
+        return in_flight;
+    }
+    vlog(
+      _log.debug,
+      "detaching slow '{}' state machine from foreground apply",
+      entry->name);
+    entry->slow_apply = true;
+    ssx::spawn_with_gate(
+      _gate,
+      [this,
+       entry,
+       in_flight = std::move(in_flight),
+       u = std::move(*units)]() mutable {
+          return std::move(in_flight).then(
+            [this, entry, u = std::move(u)]() mutable {
+                return ss::with_scheduling_group(
+                  _apply_sg, [this, entry, u = std::move(u)]() mutable {
+                      return background_apply_fiber(entry, std::move(u));
+                  });
+            });
+      });
+    return ss::now();
+}
+
+std::optional<model::offset>
+state_machine_manager::slowest_detached_next() const {
+    std::optional<model::offset> slowest;
+    for (const auto& [_, entry] : _machines) {
+        if (entry->slow_apply) {
+            slowest = std::min(
+              slowest.value_or(model::offset::max()), entry->stm->next());
+        }
+    }
+    return slowest;
+}
+
 ss::future<state_machine_manager::snapshot_result>
 state_machine_manager::take_snapshot(model::offset last_included_offset) {
     vassert(
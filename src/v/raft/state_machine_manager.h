@@ -29,7 +29,9 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <chrono>
 #include <concepts>
+#include <optional>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -53,7 +55,11 @@ concept StateMachineIterateFunc = requires(
  *
  * When a machine throws an exception or timeouts when applying batches to
  * its state subsequent applies are executed in the separate apply fiber
- * specific for that STM.
+ * specific for that STM. A machine which takes longer than
+ * `detach_apply_timeout` to apply a batch while the others are already done
+ * is detached from the shared fiber in the same way, so that a slow STM does
+ * not hold back visibility of the fast ones. The shared fiber never runs more
+ * than `max_apply_divergence` offsets ahead of a detached STM.
  *
  * State machine manager also takes care of the snapshot consistency. It
  * wraps state machine snapshots in its own snapshot format which is a map
@@ -151,6 +157,8 @@ private:
     friend class state_machine_manager_builder;
     static constexpr const char* default_ctx = "default";
     static constexpr const char* background_ctx = "background";
+    static constexpr auto detach_apply_timeout = std::chrono::milliseconds(50);
+    static constexpr model::offset max_apply_divergence{10'000};
 
     struct state_machine_entry {
         explicit state_machine_entry(
@@ -168,6 +176,9 @@ private:
         ss::shared_ptr<state_machine_base> stm;
         mutex background_apply_mutex{
           "state_machine_manager::background_apply_mutex"};
+        // set when the STM was detached from the foreground apply for being
+        // slow, cleared once it rejoins the foreground apply
+        bool slow_apply{false};
     };
     using entry_ptr = ss::lw_shared_ptr<state_machine_entry>;
     using state_machines_t
@@ -175,6 +186,8 @@ private:
 
     void maybe_start_background_apply(const entry_ptr&);
     ss::future<> background_apply_fiber(entry_ptr, ssx::semaphore_units);
+    ss::future<> detach_apply(const entry_ptr&, ss::future<> in_flight);
+    std::optional<model::offset> slowest_detached_next() const;
 
     ss::future<> apply_raft_snapshot();
     ss::future<> do_apply_raft_snapshot(
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -18,6 +19,7 @@
 #include "random/generators.h"
 #include "storage/record_batch_builder.h"
 #include "test_utils/async.h"
+#include "test_utils/scoped_config.h"
 #include "test_utils/test.h"
 
 #include <seastar/core/circular_buffer.hh>
@@ -204,6 +206,35 @@ TEST_P_CORO(all_acks_fixture, validate_recovery) {
     co_await assert_logs_equal();
 }
 
+TEST_F_CORO(raft_fixture, validate_pipelined_recovery) {
+    scoped_config cfg;
+    // small reads make the recovery span many append entries requests
+    cfg.get("raft_recovery_default_read_size").set_value(size_t(4_KiB));
+    cfg.get("raft_recovery_max_inflight_requests").set_value(size_t(8));
+
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto follower = leader == model::node_id(2) ? model::node_id(1)
+                                                : model::node_id(2);
+    co_await stop_node(follower);
+
+    leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    for (int i = 0; i < 10; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(10, 10, 128),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+    }
+    auto committed_offset = leader_node.raft()->committed_offset();
+
+    auto& recovering = add_node(follower, model::revision_id(0));
+    co_await recovering.init_and_start(all_vnodes());
+
+    co_await wait_for_committed_offset(committed_offset, 10s);
+    co_await assert_logs_equal();
+}
+
 TEST_F_CORO(raft_fixture, validate_adding_nodes_to_cluster) {
     co_await create_simple_group(1);
     // wait for leader
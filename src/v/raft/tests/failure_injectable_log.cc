@@ -202,6 +202,10 @@ int64_t failure_injectable_log::compaction_backlog() const {
     return _underlying_log->compaction_backlog();
 }
 
+int64_t failure_injectable_log::compaction_reclaimable_bytes() const {
+    return _underlying_log->compaction_reclaimable_bytes();
+}
+
 ss::future<storage::usage_report>
 failure_injectable_log::disk_usage(storage::gc_config cfg) {
     return _underlying_log->disk_usage(cfg);
@@ -0,0 +1,81 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/seastarx.h"
+#include "raft/flush_coordinator.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(flushes_of_same_tick_share_a_round) {
+    raft::flush_coordinator coordinator;
+    int flushes = 0;
+    auto flush = [&flushes] {
+        ++flushes;
+        return ss::now();
+    };
+
+    auto f1 = coordinator.flush(raft::group_id(1), flush);
+    auto f2 = coordinator.flush(raft::group_id(2), flush);
+    auto f3 = coordinator.flush(raft::group_id(3), flush);
+    ss::when_all_succeed(std::move(f1), std::move(f2), std::move(f3)).get();
+
+    BOOST_REQUIRE_EQUAL(flushes, 3);
+    BOOST_REQUIRE_EQUAL(coordinator.round_count(), 1);
+    coordinator.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(flushes_queue_behind_round_in_progress) {
+    raft::flush_coordinator coordinator;
+    ss::promise<> release;
+    int slow_flushes = 0;
+    int flushes = 0;
+
+    auto f1 = coordinator.flush(raft::group_id(1), [&] {
+        ++slow_flushes;
+        return release.get_future();
+    });
+    // wait for the first round to start
+    while (slow_flushes == 0) {
+        ss::yield().get();
+    }
+
+    auto flush = [&flushes] {
+        ++flushes;
+        return ss::now();
+    };
+    auto f2 = coordinator.flush(raft::group_id(2), flush);
+    auto f3 = coordinator.flush(raft::group_id(3), flush);
+    // a second request of the same group shares the queued flush
+    auto f4 = coordinator.flush(raft::group_id(3), flush);
+    ss::yield().get();
+    BOOST_REQUIRE_EQUAL(flushes, 0);
+
+    release.set_value();
+    ss::when_all_succeed(
+      std::move(f1), std::move(f2), std::move(f3), std::move(f4))
+      .get();
+
+    BOOST_REQUIRE_EQUAL(slow_flushes, 1);
+    BOOST_REQUIRE_EQUAL(flushes, 2);
+    BOOST_REQUIRE_EQUAL(coordinator.round_count(), 2);
+    coordinator.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(flush_errors_are_not_shared) {
+    raft::flush_coordinator coordinator;
+    auto failed = coordinator.flush(raft::group_id(1), [] {
+        return ss::make_exception_future<>(std::runtime_error("io error"));
+    });
+    auto ok = coordinator.flush(raft::group_id(2), [] { return ss::now(); });
+
+    BOOST_REQUIRE_THROW(failed.get(), std::runtime_error);
+    BOOST_REQUIRE_NO_THROW(ok.get());
+    coordinator.stop().get();
+}
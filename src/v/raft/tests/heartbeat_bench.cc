@@ -73,13 +73,14 @@ struct fixture {
         return req;
     }
 
-    raft::heartbeat_request_v2 make_new_request(size_t full_heartbeat_count) {
+    raft::heartbeat_request_v2 make_new_request(
+      const raft::heartbeat_request& source, size_t full_heartbeat_count) {
         raft::heartbeat_request_v2 req(
-          old_req.heartbeats.front().node_id.id(),
-          old_req.heartbeats.front().target_node_id.id());
+          source.heartbeats.front().node_id.id(),
+          source.heartbeats.front().target_node_id.id());
 
         auto i = 0;
-        for (auto& hb_meta : old_req.heartbeats) {
+        for (auto& hb_meta : source.heartbeats) {
             raft::group_heartbeat group_beat{.group = hb_meta.meta.group};
             if (std::cmp_less(i, full_heartbeat_count)) {
                 group_beat.data = raft::heartbeat_request_data{
@@ -148,15 +149,34 @@ struct fixture {
         sz += buffer.size_bytes();
     }
 
+    template<typename T>
+    ss::future<> test_serde_read(const T& data) {
+        iobuf buffer;
+        co_await serde::write_async(buffer, data.copy());
+        iobuf_parser parser(std::move(buffer));
+        perf_tests::start_measuring_time();
+
+        auto decoded = co_await serde::read_async<T>(parser);
+
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(decoded);
+    }
+
     fixture() {
         old_req = make_request(10000);
-        new_req_full = make_new_request(10000);
-        new_req_lw = make_new_request(0);
-        new_req_mixed = make_new_request(2000);
+        new_req_full = make_new_request(old_req, 10000);
+        new_req_lw = make_new_request(old_req, 0);
+        new_req_mixed = make_new_request(old_req, 2000);
         old_reply = make_reply();
         new_reply_full = make_new_reply(new_req_full);
         new_reply_mixed = make_new_reply(new_req_mixed);
         new_reply_lw = make_new_reply(new_req_lw);
+        /**
+         * A follower of an idle node with 30k partitions, where only a small
+         * fraction of groups changed state since the last acked heartbeat.
+         */
+        new_req_idle = make_new_request(make_request(30000), 300);
+        new_reply_idle = make_new_reply(new_req_idle);
     }
 
     raft::heartbeat_request old_req;
@@ -164,11 +184,13 @@ struct fixture {
     raft::heartbeat_request_v2 new_req_full;
     raft::heartbeat_request_v2 new_req_mixed;
     raft::heartbeat_request_v2 new_req_lw;
+    raft::heartbeat_request_v2 new_req_idle;
 
     raft::heartbeat_reply old_reply;
     raft::heartbeat_reply_v2 new_reply_full;
     raft::heartbeat_reply_v2 new_reply_mixed;
     raft::heartbeat_reply_v2 new_reply_lw;
+    raft::heartbeat_reply_v2 new_reply_idle;
 
     size_t cnt = 0;
     size_t sz = 0;
@@ -201,6 +223,18 @@ PERF_TEST_C(fixture, test_new_hb_request_lw) {
     co_await test_serde_write(new_req_lw);
 }
 
+PERF_TEST_C(fixture, test_new_hb_request_idle) {
+    co_await test_serde_write(new_req_idle);
+}
+
+PERF_TEST_C(fixture, test_new_hb_request_full_read) {
+    co_await test_serde_read(new_req_full);
+}
+
+PERF_TEST_C(fixture, test_new_hb_request_idle_read) {
+    co_await test_serde_read(new_req_idle);
+}
+
 PERF_TEST_C(fixture, test_old_hb_reply) {
     perf_tests::start_measuring_time();
 
@@ -223,3 +257,11 @@ PERF_TEST_C(fixture, test_new_hb_reply_mixed) {
 PERF_TEST_C(fixture, test_new_hb_reply_lw) {
     co_await test_serde_write(new_reply_lw);
 }
+
+PERF_TEST_C(fixture, test_new_hb_reply_idle) {
+    co_await test_serde_write(new_reply_idle);
+}
+
+PERF_TEST_C(fixture, test_new_hb_reply_idle_read) {
+    co_await test_serde_read(new_reply_idle);
+}
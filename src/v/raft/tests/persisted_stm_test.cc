@@ -122,6 +122,18 @@ struct kv_state
     auto serde_fields() { return std::tie(kv_map); }
 };
 
+/**
+ * Changes made to the kv_state since the previous local snapshot
+ */
+struct kv_state_delta
+  : serde::
+      envelope<kv_state_delta, serde::version<0>, serde::compat_version<0>> {
+    kv_state::state_t updated;
+    std::vector<ss::sstring> removed;
+
+    auto serde_fields() { return std::tie(updated, removed); }
+};
+
 class persisted_kv : public persisted_stm<> {
 public:
     static constexpr std::string_view name = "persited_kv_stm";
@@ -166,6 +178,7 @@ public:
             co_return raft::local_snapshot_applied::no;
         }
         state = serde::from_iobuf<kv_state>(std::move(buffer));
+        persisted_state = state;
         co_return raft::local_snapshot_applied::yes;
     };
 
@@ -174,10 +187,48 @@ public:
      */
     ss::future<stm_snapshot> take_local_snapshot(
       [[maybe_unused]] ssx::semaphore_units apply_units) final {
+        persisted_state = state;
         co_return stm_snapshot::create(
           0, last_applied_offset(), serde::to_iobuf(state));
     };
 
+    ss::future<std::optional<stm_snapshot>>
+    take_local_snapshot_delta(const ssx::semaphore_units&) final {
+        if (!snapshot_deltas) {
+            co_return std::nullopt;
+        }
+        kv_state_delta delta;
+        for (const auto& [k, v] : state.kv_map) {
+            auto it = persisted_state.kv_map.find(k);
+            if (it == persisted_state.kv_map.end() || it->second != v) {
+                delta.updated.emplace(k, v);
+            }
+        }
+        for (const auto& [k, _] : persisted_state.kv_map) {
+            if (!state.kv_map.contains(k)) {
+                delta.removed.push_back(k);
+            }
+        }
+        persisted_state = state;
+        ++deltas_taken;
+        co_return stm_snapshot::create(
+          0, last_applied_offset(), serde::to_iobuf(std::move(delta)));
+    }
+
+    ss::future<>
+    apply_local_snapshot_delta(stm_snapshot_header, iobuf&& buffer) final {
+        auto delta = serde::from_iobuf<kv_state_delta>(std::move(buffer));
+        for (auto& [k, v] : delta.updated) {
+            state.kv_map.insert_or_assign(k, std::move(v));
+        }
+        for (const auto& k : delta.removed) {
+            state.kv_map.erase(k);
+        }
+        persisted_state = state;
+        ++deltas_applied;
+        co_return;
+    }
+
     static std::optional<kv_operation>
     apply_to_state(const model::record_batch& batch, kv_state& state) {
         if (batch.header().type != model::record_batch_type::raft_data) {
@@ -276,9 +327,14 @@ public:
     }
 
     kv_state state;
+    // state included in the local snapshot and its deltas
+    kv_state persisted_state;
     kv_operation last_operation;
     raft_node_instance& raft_node;
     bool reject_local_snapshots = false;
+    bool snapshot_deltas = false;
+    size_t deltas_taken = 0;
+    size_t deltas_applied = 0;
 };
 
 class other_persisted_kv : public persisted_kv {
@@ -317,6 +373,7 @@ struct persisted_stm_test_fixture : state_machine_fixture {
             co_await node->initialise(all_vnodes());
             raft::state_machine_manager_builder builder;
             auto stm = builder.create_stm<persisted_kv>(*node);
+            stm->snapshot_deltas = snapshot_deltas;
             co_await node->start(std::move(builder));
             node_stms.emplace(node->get_vnode(), std::move(stm));
         }
@@ -415,6 +472,7 @@ struct persisted_stm_test_fixture : state_machine_fixture {
             raft::state_machine_manager_builder builder;
             auto stm = builder.create_stm<persisted_kv>(
               *node, reject_local_snapshots_after_restart);
+            stm->snapshot_deltas = snapshot_deltas;
             co_await node->start(std::move(builder));
             node_stms.emplace(node->get_vnode(), std::move(stm));
         }
@@ -460,6 +518,7 @@ struct persisted_stm_test_fixture : state_machine_fixture {
     }
 
     absl::flat_hash_map<raft::vnode, ss::shared_ptr<persisted_kv>> node_stms;
+    bool snapshot_deltas = false;
 };
 
 class slow_persisted_stm : public persisted_stm<> {
@@ -603,6 +662,44 @@ TEST_F_CORO(persisted_stm_test_fixture, test_local_snapshot) {
     }
 }
 
+TEST_F_CORO(persisted_stm_test_fixture, test_local_snapshot_deltas) {
+    snapshot_deltas = true;
+    co_await initialize_state_machines();
+    kv_state expected;
+    auto ops = random_operations(1000);
+    for (auto batch : ops) {
+        co_await apply_operations(expected, std::move(batch));
+    }
+    co_await wait_for_apply();
+    // the first snapshot is always a full one
+    co_await take_local_snapshot_on_every_node();
+
+    for (int i = 0; i < 3; ++i) {
+        auto more_ops = random_operations(50);
+        for (auto batch : more_ops) {
+            co_await apply_operations(expected, std::move(batch));
+        }
+        co_await wait_for_apply();
+        co_await take_local_snapshot_on_every_node();
+    }
+    for (const auto& [_, stm] : node_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+        ASSERT_EQ_CORO(stm->deltas_taken, 3U);
+    }
+
+    auto committed = node(model::node_id(0)).raft()->committed_offset();
+    co_await restart_cluster();
+    for (const auto& [_, stm] : node_stms) {
+        ASSERT_EQ_CORO(stm->deltas_applied, 3U);
+    }
+    co_await wait_for_committed_offset(committed, 30s);
+    co_await wait_for_apply();
+
+    for (const auto& [_, stm] : node_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+}
+
 TEST_F_CORO(persisted_stm_test_fixture, test_skipping_local_snapshot_on_start) {
     co_await initialize_state_machines();
     kv_state expected;
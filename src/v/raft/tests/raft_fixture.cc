@@ -463,6 +463,7 @@ raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
       _recovery_throttle.local(),
       _recovery_mem_quota,
       _recovery_scheduler,
+      _flush_coordinator,
       _features.local());
     _group_manager.local().raft = _raft;
     co_await _hb_manager->register_group(_raft);
@@ -492,6 +493,7 @@ ss::future<> raft_node_instance::stop() {
         _f_log = nullptr;
         vlog(_logger.debug, "stopping raft");
         co_await _raft->stop();
+        co_await _flush_coordinator.stop();
         vlog(_logger.debug, "stopping recovery throttle");
         co_await _recovery_throttle.stop();
         vlog(_logger.debug, "stopping log");
@@ -184,6 +184,7 @@ struct raft_node {
           recovery_throttle.local(),
           recovery_mem_quota,
           recovery_scheduler.local(),
+          flush_coordinator,
           feature_table.local(),
           std::nullopt);
     }
@@ -289,6 +290,11 @@ struct raft_node {
               consensus = nullptr;
               return ss::now();
           })
+          .then([this] {
+              tstlog.info(
+                "Stopping flush_coordinator at node {}", broker.id());
+              return flush_coordinator.stop();
+          })
           .then([this] {
               tstlog.info(
                 "Stopping recovery_scheduler at node {}", broker.id());
@@ -354,6 +360,7 @@ struct raft_node {
     ss::sharded<storage::api> storage;
     ss::sharded<raft::coordinated_recovery_throttle> recovery_throttle;
     ss::sharded<raft::recovery_scheduler> recovery_scheduler;
+    raft::flush_coordinator flush_coordinator;
     ss::shared_ptr<storage::log> log;
     ss::sharded<ss::abort_source> as_service;
     ss::sharded<rpc::connection_cache> cache;
@@ -10,6 +10,9 @@
 #include "raft/tests/raft_fixture_retry_policy.h"
 #include "raft/tests/stm_test_fixture.h"
 
+#include <seastar/core/condition-variable.hh>
+#include <seastar/util/defer.hh>
+
 using namespace raft;
 
 inline ss::logger logger("stm-test-logger");
@@ -618,3 +621,74 @@ TEST_F_CORO(state_machine_fixture, test_opt_out_from_snapshot_at_offset) {
           n->raft()->start_offset(), model::next_offset(offsets[id]));
     }
 }
+
+// Blocks the first apply until released
+class blocking_kv : public simple_kv {
+public:
+    static constexpr std::string_view name = "blocking_kv";
+
+    explicit blocking_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    ss::future<> apply(
+      const model::record_batch& batch,
+      const ssx::semaphore_units& apply_units) override {
+        if (!_released) {
+            co_await _release.wait([this] { return _released; });
+        }
+        co_return co_await simple_kv::apply(batch, apply_units);
+    }
+
+    void release() {
+        _released = true;
+        _release.broadcast();
+    }
+
+private:
+    bool _released = false;
+    ss::condition_variable _release;
+};
+
+TEST_F_CORO(state_machine_fixture, test_slow_stm_does_not_hold_back_others) {
+    create_nodes();
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        builder.create_stm<simple_kv>(*node);
+        builder.create_stm<blocking_kv>(*node);
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+    }
+
+    auto expected = co_await build_random_state(500);
+    auto committed_offset = co_await with_leader(
+      10s, [](raft_node_instance& node) {
+          return node.raft()->committed_offset();
+      });
+
+    // make sure the blocked applies can finish when an assertion fails
+    auto release = ss::defer([this] {
+        for (auto& [_, node] : nodes()) {
+            node->raft()->stm_manager()->get<blocking_kv>()->release();
+        }
+    });
+    for (auto& [_, node] : nodes()) {
+        auto& manager = node->raft()->stm_manager();
+        // the fast STM is detached from the blocked one and catches up
+        co_await manager->get<simple_kv>()->wait(
+          committed_offset, model::timeout_clock::now() + 10s);
+        ASSERT_EQ_CORO(manager->get<simple_kv>()->state, expected);
+        ASSERT_LT_CORO(
+          manager->get<blocking_kv>()->last_applied_offset(),
+          committed_offset);
+    }
+
+    release.cancel();
+    for (auto& [_, node] : nodes()) {
+        node->raft()->stm_manager()->get<blocking_kv>()->release();
+    }
+    co_await wait_for_apply();
+
+    for (auto& [_, node] : nodes()) {
+        ASSERT_EQ_CORO(
+          node->raft()->stm_manager()->get<blocking_kv>()->state, expected);
+    }
+}
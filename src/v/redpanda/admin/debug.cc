@@ -714,11 +714,14 @@ admin_server::sampled_memory_profile_handler(
     std::vector<ss::httpd::debug_json::memory_profile> resp(profiles.size());
     for (size_t i = 0; i < resp.size(); ++i) {
         resp[i].shard = profiles[i].shard_id;
+        resp[i].baseline_age_ms = profiles[i].baseline_age.count();
 
         for (auto& allocation_sites : profiles[i].allocation_sites) {
             ss::httpd::debug_json::allocation_site allocation_site;
             allocation_site.size = allocation_sites.size;
             allocation_site.count = allocation_sites.count;
+            allocation_site.size_delta = allocation_sites.size_delta;
+            allocation_site.count_delta = allocation_sites.count_delta;
             allocation_site.backtrace = std::move(allocation_sites.backtrace);
             resp[i].allocation_sites.push(allocation_site);
         }
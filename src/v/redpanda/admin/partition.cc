@@ -532,10 +532,31 @@ admin_server::force_set_partition_replicas_handler(
     co_return ss::json::json_void();
 }
 
+namespace {
+
+cluster::reconfiguration_policy
+parse_reconfiguration_policy(const ss::http::request& req) {
+    auto param = req.get_query_param("policy");
+    if (param.empty() || param == "full_local_retention") {
+        return cluster::reconfiguration_policy::full_local_retention;
+    }
+    if (param == "target_initial_retention") {
+        return cluster::reconfiguration_policy::target_initial_retention;
+    }
+    if (param == "min_local_retention") {
+        return cluster::reconfiguration_policy::min_local_retention;
+    }
+    throw ss::httpd::bad_param_exception(
+      fmt::format("Invalid reconfiguration policy: {}", param));
+}
+
+} // namespace
+
 ss::future<ss::json::json_return_type>
 admin_server::set_partition_replicas_handler(
   std::unique_ptr<ss::http::request> req) {
     auto ntp = parse_ntp_from_request(req->param);
+    const auto policy = parse_reconfiguration_policy(*req);
 
     if (ntp == model::controller_ntp) {
         throw ss::httpd::bad_request_exception(
@@ -562,16 +583,17 @@ admin_server::set_partition_replicas_handler(
 
     vlog(
       adminlog.info,
-      "Request to change ntp {} replica set to {}",
+      "Request to change ntp {} replica set to {} with {} policy",
       ntp,
-      replicas);
+      replicas,
+      policy);
 
     auto err = co_await _controller->get_topics_frontend()
                  .local()
                  .move_partition_replicas(
                    ntp,
                    replicas,
-                   cluster::reconfiguration_policy::full_local_retention,
+                   policy,
                    model::timeout_clock::now()
                      + 10s); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 
@@ -79,6 +79,7 @@
 #include "cluster/tx_topic_manager.h"
 #include "cluster/types.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/lz4_decompression_buffers.h"
 #include "compression/stream_zstd.h"
 #include "config/configuration.h"
@@ -160,6 +161,7 @@
 #include <seastar/core/sleep.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/json/json_elements.hh>
 #include <seastar/net/tls.hh>
 #include <seastar/util/conversions.hh>
@@ -577,6 +579,15 @@ void application::initialize(
       .get();
     _cpu_profiler.invoke_on_all(&resources::cpu_profiler::start).get();
 
+    construct_service(
+      _task_slice_tracker, ss::sharded_parameter([] {
+          return config::shard_local_cfg()
+            .task_slice_tracking_threshold_ms.bind();
+      }))
+      .get();
+    _task_slice_tracker.invoke_on_all(&resources::task_slice_tracker::start)
+      .get();
+
     /*
      * Disable the logger for protobuf; some interfaces don't allow a pluggable
      * error collector.
@@ -954,6 +965,9 @@ void application::check_environment() {
     storage::directories::initialize(
       config::node().data_directory().as_sstring())
       .get();
+    for (const auto& dir : config::node().additional_data_directories()) {
+        storage::directories::initialize(dir).get();
+    }
     cloud_storage::cache::initialize(config::node().cloud_storage_cache_path())
       .get();
 
@@ -1699,6 +1713,9 @@ void application::wire_up_redpanda_services(
       ss::sharded_parameter([]() {
           return config::shard_local_cfg()
             .virtual_cluster_min_producer_ids.bind();
+      }),
+      ss::sharded_parameter([]() {
+          return config::shard_local_cfg().max_spilled_producer_ids.bind();
       }))
       .get();
 
@@ -2278,6 +2295,11 @@ void application::wire_up_redpanda_services(
 
               c.stream_recv_buf
                 = config::shard_local_cfg().kafka_rpc_server_stream_recv_buf;
+              if (config::shard_local_cfg()
+                    .kafka_connection_shard_by_client_port()) {
+                  c.load_balancing_algo
+                    = ss::server_socket::load_balancing_algorithm::port;
+              }
               auto& tls_config = config::node().kafka_api_tls.value();
               for (const auto& ep : config::node().kafka_api()) {
                   ss::shared_ptr<ss::tls::server_credentials> credentials
@@ -2432,6 +2454,24 @@ void application::trigger_abort_source() {
       .get();
 }
 
+void application::wire_up_and_start_compression_offload() {
+    auto min_bytes = config::shard_local_cfg().compression_offload_min_bytes();
+    if (!min_bytes) {
+        return;
+    }
+    construct_single_service(compression_worker);
+    compression_worker->start({.name = "compress"}).get();
+    ss::smp::invoke_on_all([this, min_bytes = *min_bytes] {
+        return compression::enable_offload(
+          *compression_worker,
+          min_bytes,
+          config::shard_local_cfg().zstd_decompress_workspace_bytes());
+    }).get();
+    // Stop offloading before the worker is stopped.
+    _deferred.emplace_back(
+      [] { ss::smp::invoke_on_all(compression::disable_offload).get(); });
+}
+
 void application::wire_up_and_start_crypto_services() {
     construct_single_service(thread_worker);
     thread_worker->start({.name = "worker"}).get();
@@ -2743,6 +2783,7 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
 
     // Bootstrap services.
     wire_up_and_start_crypto_services();
+    wire_up_and_start_compression_offload();
     wire_up_bootstrap_services();
     start_bootstrap_services();
 
@@ -2876,21 +2917,27 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
 
     start_runtime_services(cd, app_signal);
 
+    // Pandaproxy and Schema Registry don't depend on each other, start them
+    // concurrently
+    std::vector<ss::future<>> http_services;
     if (_proxy_config && !config::node().recovery_mode_enabled) {
-        _proxy->start().get();
-        vlog(
-          _log.info,
-          "Started Pandaproxy listening at {}",
-          _proxy_config->pandaproxy_api());
+        http_services.push_back(_proxy->start().then([this] {
+            vlog(
+              _log.info,
+              "Started Pandaproxy listening at {}",
+              _proxy_config->pandaproxy_api());
+        }));
     }
 
     if (_schema_reg_config && !config::node().recovery_mode_enabled) {
-        _schema_registry->start().get();
-        vlog(
-          _log.info,
-          "Started Schema Registry listening at {}",
-          _schema_reg_config->schema_registry_api());
+        http_services.push_back(_schema_registry->start().then([this] {
+            vlog(
+              _log.info,
+              "Started Schema Registry listening at {}",
+              _schema_reg_config->schema_registry_api());
+        }));
     }
+    ss::when_all_succeed(http_services.begin(), http_services.end()).get();
 
     audit_mgr.invoke_on_all(&security::audit::audit_log_manager::start).get();
 
@@ -2920,6 +2967,9 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           .cpu = {
             .per_invocation_timeout = cluster.data_transforms_runtime_limit_ms.value(),
           },
+          .code_cache = {
+            .directory = config::node().data_directory().path / "wasm_code_cache",
+          },
         };
         _wasm_runtime->start(config).get();
         _transform_rpc_client.invoke_on_all(&transform::rpc::client::start)
@@ -55,6 +55,7 @@
 #include "resource_mgmt/scheduling_groups_probe.h"
 #include "resource_mgmt/smp_groups.h"
 #include "resource_mgmt/storage.h"
+#include "resource_mgmt/task_slice_tracker.h"
 #include "rpc/fwd.h"
 #include "rpc/rpc_server.h"
 #include "security/fwd.h"
@@ -183,6 +184,7 @@ public:
     std::unique_ptr<cluster::controller> controller;
 
     std::unique_ptr<ssx::singleton_thread_worker> thread_worker;
+    std::unique_ptr<ssx::sharded_thread_worker> compression_worker;
 
     ss::sharded<crypto::ossl_context_service> ossl_context_service;
     kafka::server_app _kafka_server;
@@ -224,6 +226,7 @@ private:
     // Constructs and starts the services required to provide cryptographic
     // algorithm support to Redpanda
     void wire_up_and_start_crypto_services();
+    void wire_up_and_start_compression_offload();
 
     // Constructs services across shards required to get bootstrap metadata.
     void wire_up_bootstrap_services();
@@ -345,6 +348,7 @@ private:
     std::unique_ptr<kafka::rm_group_proxy_impl> _rm_group_proxy;
 
     ss::sharded<resources::cpu_profiler> _cpu_profiler;
+    ss::sharded<resources::task_slice_tracker> _task_slice_tracker;
     ss::sharded<debug_bundle::service> _debug_bundle_service;
 
     std::unique_ptr<cluster::node_isolation_watcher> _node_isolation_watcher;
@@ -11,6 +11,8 @@
 
 #include "resource_mgmt/cpu_profiler.h"
 
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
 #include "random/generators.h"
 #include "resource_mgmt/logger.h"
 #include "ssx/future-util.h"
@@ -19,6 +21,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/internal/cpu_profiler.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/util/later.hh>
@@ -49,6 +52,7 @@ cpu_profiler::cpu_profiler(
 ss::future<> cpu_profiler::start() {
     on_sample_period_change();
     on_enabled_change();
+    setup_metrics();
 
     return ss::now();
 }
@@ -57,9 +61,35 @@ ss::future<> cpu_profiler::stop() {
     _as.request_abort();
     _query_timer.cancel();
     co_await _gate.close();
+    _metrics.clear();
     ss::engine().set_cpu_profiler_enabled(false);
 }
 
+void cpu_profiler::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cpu_profiler"),
+      {
+        sm::make_counter(
+          "samples",
+          [this] { return _total_samples; },
+          sm::description("Number of stack samples collected")),
+        sm::make_counter(
+          "dropped_samples",
+          [this] { return _total_dropped_samples; },
+          sm::description(
+            "Number of stack samples dropped because the profiler buffer was "
+            "full")),
+        sm::make_gauge(
+          "enabled",
+          [this] { return is_enabled() ? 1 : 0; },
+          sm::description("Whether the profiler is currently sampling")),
+      });
+}
+
 ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
   std::optional<ss::shard_id> shard_id,
   std::optional<ss::lowres_clock::time_point> filter_before) {
@@ -132,6 +162,8 @@ void cpu_profiler::poll_samples() {
     }
 
     auto dropped_samples = ss::engine().profiler_results(results_buffer);
+    _total_samples += results_buffer.size();
+    _total_dropped_samples += dropped_samples;
 
     resourceslog.trace(
       "Polled {} samples from the CPU profiler", results_buffer.size());
@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "config/property.h"
+#include "metrics/metrics.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
@@ -125,6 +126,14 @@ private:
     void on_sample_period_change();
 
     bool is_enabled() const;
+
+    void setup_metrics();
+
+    // Totals since startup, exported as metrics so that an always-on
+    // profiler's activity can be tracked without querying the admin API.
+    uint64_t _total_samples{0};
+    uint64_t _total_dropped_samples{0};
+    metrics::internal_metric_groups _metrics;
 };
 
 } // namespace resources
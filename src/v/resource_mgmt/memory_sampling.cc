@@ -202,13 +202,33 @@ void memory_sampling::start() {
     on_enabled_change();
 
     start_low_available_memory_logging();
+
+    _baseline_timer.set_callback([this] { reset_baseline(); });
+    _baseline_timer.arm_periodic(baseline_interval);
 }
 
 ss::future<> memory_sampling::stop() {
     _logging_timer.cancel();
+    _baseline_timer.cancel();
     co_return;
 }
 
+void memory_sampling::reset_baseline() {
+    _baseline.clear();
+    _baseline_time = ss::lowres_clock::now();
+    if (!_enabled()) {
+        return;
+    }
+
+    auto stacks = ss::memory::sampled_memory_profile();
+    _baseline.reserve(stacks.size());
+    for (auto& stack : stacks) {
+        _baseline.emplace(
+          ssx::sformat("{}", std::move(stack.backtrace)),
+          baseline_site{.size = stack.size, .count = stack.count});
+    }
+}
+
 memory_sampling::serialized_memory_profile
 memory_sampling::get_sampled_memory_profile() {
     auto stacks = ss::memory::sampled_memory_profile();
@@ -218,14 +238,25 @@ memory_sampling::get_sampled_memory_profile() {
     allocation_sites.reserve(stacks.size());
 
     for (auto& stack : stacks) {
-        allocation_sites.emplace_back(
+        auto& site = allocation_sites.emplace_back(
           stack.size,
           stack.count,
           ssx::sformat("{}", std::move(stack.backtrace)));
+
+        site.size_delta = static_cast<int64_t>(site.size);
+        site.count_delta = static_cast<int64_t>(site.count);
+        if (auto it = _baseline.find(site.backtrace); it != _baseline.end()) {
+            site.size_delta -= static_cast<int64_t>(it->second.size);
+            site.count_delta -= static_cast<int64_t>(it->second.count);
+        }
     }
 
-    return memory_sampling::serialized_memory_profile{
+    serialized_memory_profile profile{
       ss::this_shard_id(), std::move(allocation_sites)};
+    profile.baseline_age
+      = std::chrono::duration_cast<std::chrono::milliseconds>(
+        ss::lowres_clock::now() - _baseline_time);
+    return profile;
 }
 
 ss::future<std::vector<memory_sampling::serialized_memory_profile>>
@@ -234,12 +265,12 @@ memory_sampling::get_sampled_memory_profiles(std::optional<size_t> shard_id) {
     std::vector<result_t> resp;
 
     if (shard_id.has_value()) {
-        resp.push_back(co_await container().invoke_on(*shard_id, [](auto&) {
-            return memory_sampling::get_sampled_memory_profile();
-        }));
+        resp.push_back(co_await container().invoke_on(
+          *shard_id,
+          [](memory_sampling& s) { return s.get_sampled_memory_profile(); }));
     } else {
         resp = co_await container().map_reduce0(
-          [](auto&) { return memory_sampling::get_sampled_memory_profile(); },
+          [](memory_sampling& s) { return s.get_sampled_memory_profile(); },
           std::vector<result_t>{},
           [](std::vector<result_t> all, result_t result) {
               all.push_back(std::move(result));
@@ -14,6 +14,8 @@
 #include "base/seastarx.h"
 #include "config/property.h"
 
+#include <absl/container/flat_hash_map.h>
+
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -49,6 +51,10 @@ public:
             size_t count;
             // backtrace of this allocation site
             ss::sstring backtrace;
+            // change of size and count since the last baseline, the whole
+            // size for sites which weren't live back then
+            int64_t size_delta{0};
+            int64_t count_delta{0};
 
             allocation_site(size_t size, size_t count, ss::sstring backtrace)
               : size(size)
@@ -58,6 +64,8 @@ public:
 
         /// shard id of this profile
         ss::shard_id shard_id;
+        /// How long ago the baseline for the deltas was taken
+        std::chrono::milliseconds baseline_age{0};
         /// Backtraces of this shard
         std::vector<allocation_site> allocation_sites;
 
@@ -90,6 +98,10 @@ public:
       double first_log_limit_fraction,
       double second_log_limit_fraction);
 
+    /// Remembers the current live set as the reference for the size and count
+    /// deltas of later profiles. Runs periodically, exposed for testing.
+    void reset_baseline();
+
     /// Returns the callback we register to run on OOM to add the memory
     /// sampling output
     static ss::noncopyable_function<void(ss::memory::memory_diagnostics_writer)>
@@ -101,8 +113,7 @@ private:
     void start_low_available_memory_logging();
 
     /// Returns the serialized memory_profile for the current shard
-    static memory_sampling::serialized_memory_profile
-    get_sampled_memory_profile();
+    memory_sampling::serialized_memory_profile get_sampled_memory_profile();
 
     void on_enabled_change();
 
@@ -119,4 +130,16 @@ private:
     double _second_log_limit_fraction;
     std::chrono::seconds _log_check_frequency;
     ss::timer<ss::lowres_clock> _logging_timer;
+
+    struct baseline_site {
+        size_t size;
+        size_t count;
+    };
+
+    // Live set at the last baseline keyed by backtrace. Comparing against it
+    // tells which sites are growing rather than just which are big.
+    static constexpr std::chrono::seconds baseline_interval{60};
+    absl::flat_hash_map<ss::sstring, baseline_site> _baseline;
+    ss::lowres_clock::time_point _baseline_time{ss::lowres_clock::now()};
+    ss::timer<ss::lowres_clock> _baseline_timer;
 };
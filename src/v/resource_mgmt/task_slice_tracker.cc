@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/task_slice_tracker.h"
+
+#include "base/vlog.h"
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
+#include "resource_mgmt/logger.h"
+#include "ssx/task_slice.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace resources {
+
+task_slice_tracker::task_slice_tracker(
+  config::binding<std::optional<std::chrono::milliseconds>> threshold)
+  : _threshold(std::move(threshold)) {
+    _threshold.watch([this] { on_threshold_change(); });
+}
+
+ss::future<> task_slice_tracker::start() {
+    on_threshold_change();
+    return ss::now();
+}
+
+ss::future<> task_slice_tracker::stop() {
+    // the metrics refer to the stats owned by the tracking state
+    _metrics.clear();
+    ssx::task_slice::disable();
+    return ss::now();
+}
+
+void task_slice_tracker::on_threshold_change() {
+    _metrics.clear();
+    ssx::task_slice::disable();
+
+    auto threshold = _threshold();
+    if (!threshold.has_value()) {
+        return;
+    }
+
+    ssx::task_slice::enable(
+      *threshold,
+      ssx::task_slice::observer{
+        .on_new_operation =
+          [this](std::string_view op, const ssx::task_slice::stats& s) {
+              if (config::shard_local_cfg().disable_metrics()) {
+                  return;
+              }
+              namespace sm = ss::metrics;
+              const std::vector<sm::label_instance> labels{
+                sm::label("operation")(op)};
+              _metrics.add_group(
+                prometheus_sanitize::metrics_name("task_slice"),
+                {
+                  sm::make_counter(
+                    "slices",
+                    [&s] { return s.slices; },
+                    sm::description("Number of task slices of the operation"),
+                    labels),
+                  sm::make_counter(
+                    "long_slices",
+                    [&s] { return s.long_slices; },
+                    sm::description(
+                      "Number of task slices of the operation at or above "
+                      "task_slice_tracking_threshold_ms"),
+                    labels),
+                  sm::make_gauge(
+                    "longest_slice_seconds",
+                    [&s] {
+                        return std::chrono::duration<double>(s.longest)
+                          .count();
+                    },
+                    sm::description(
+                      "Longest task slice of the operation since tracking "
+                      "was enabled"),
+                    labels),
+                });
+          },
+        .on_long_slice =
+          [](std::string_view op, std::chrono::steady_clock::duration d) {
+              vlog(
+                resourceslog.warn,
+                "Long task slice of {}: {}us",
+                op,
+                std::chrono::duration_cast<std::chrono::microseconds>(d)
+                  .count());
+          },
+      });
+}
+
+} // namespace resources
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "metrics/metrics.h"
+
+#include <seastar/core/future.hh>
+
+#include <chrono>
+#include <optional>
+
+namespace resources {
+
+/**
+ * Turns ssx::task_slice tracking on and off on a shard following the
+ * configured threshold. Long slices are logged with their operation and the
+ * per operation stats are exported as metrics.
+ */
+class task_slice_tracker {
+public:
+    explicit task_slice_tracker(
+      config::binding<std::optional<std::chrono::milliseconds>> threshold);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+private:
+    void on_threshold_change();
+
+    config::binding<std::optional<std::chrono::milliseconds>> _threshold;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace resources
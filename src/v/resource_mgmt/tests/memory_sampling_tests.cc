@@ -15,6 +15,7 @@
 
 #include <seastar/core/memory.hh>
 #include <seastar/core/reactor.hh>
+#include <seastar/core/sharded.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/log.hh>
 
@@ -134,4 +135,42 @@ SEASTAR_THREAD_TEST_CASE(test_low_watermark_logging) {
     sampling.stop().get();
 }
 
+SEASTAR_THREAD_TEST_CASE(test_profile_deltas_against_baseline) {
+    seastar::logger dummy_logger("dummy");
+    ss::sharded<memory_sampling> sampling;
+    sampling
+      .start(
+        std::ref(dummy_logger),
+        ss::sharded_parameter([] { return config::mock_binding<bool>(true); }))
+      .get();
+    sampling.invoke_on_all([](memory_sampling& s) { s.start(); }).get();
+    sampling.local().reset_baseline();
+
+    auto growing_size = [&sampling] {
+        auto profiles
+          = sampling.local().get_sampled_memory_profiles(ss::this_shard_id())
+              .get();
+        BOOST_REQUIRE_EQUAL(profiles.size(), 1);
+        int64_t growth = 0;
+        for (const auto& site : profiles[0].allocation_sites) {
+            growth += std::max<int64_t>(site.size_delta, 0);
+        }
+        return growth;
+    };
+
+    std::vector<std::vector<char>> dummy_bufs;
+    for (int i = 0; i < 100; ++i) {
+        dummy_bufs.emplace_back(1000000);
+    }
+
+    // the new buffers show up as growth since the baseline ...
+    BOOST_REQUIRE_GT(growing_size(), 50000000);
+
+    // ... but not any more once they are part of it
+    sampling.local().reset_baseline();
+    BOOST_REQUIRE_LT(growing_size(), 50000000);
+
+    sampling.stop().get();
+}
+
 #endif // SEASTAR_DEFAULT_ALLOCATOR
@@ -11,6 +11,7 @@
 #include "bytes/iobuf.h"
 #include "bytes/scattered_message.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "hashing/xx.h"
 #include "reflection/adl.h"
 #include "rpc/types.h"
@@ -37,6 +38,11 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
       && rpc::compression_type::zstd == hdr.compression) {
         auto& zstd_inst = compression::async_stream_zstd_instance();
         out_buf = co_await zstd_inst.compress(std::move(out_buf));
+    } else if (
+      out_buf.size_bytes() >= _min_compression_bytes
+      && rpc::compression_type::lz4 == hdr.compression) {
+        out_buf = co_await compression::stream_compressor::compress(
+          std::move(out_buf), compression::type::lz4);
     } else {
         // didn't meet min requirements
         hdr.compression = rpc::compression_type::none;
@@ -52,7 +58,9 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
     hdr.header_checksum = rpc::checksum_header_only(hdr);
     out_buf.prepend(header_as_iobuf(hdr));
 
-    // prepare for output
+    // prepare for output, coalescing the tiny fragments left by encoding
+    static constexpr size_t small_fragment_bytes = 512;
+    out_buf.linearize_if_fragmented(small_fragment_bytes);
     co_return iobuf_as_scattered(std::move(out_buf));
 }
 
@@ -13,9 +13,11 @@
 
 #include "base/likely.h"
 #include "base/seastarx.h"
+#include "base/units.h"
 #include "base/vlog.h"
 #include "bytes/iostream.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "hashing/xx.h"
 #include "reflection/async_adl.h"
 #include "rpc/logger.h"
@@ -269,9 +271,22 @@ struct v0_message_codec {
     }
 };
 
+/// Payloads at least this large are read without linearizing the stream
+/// buffers. They are mostly record batches which are kept around after the
+/// request is decoded, copying them buys nothing.
+inline constexpr size_t zero_copy_payload_threshold = 32_KiB;
+
+inline ss::future<iobuf>
+read_payload(ss::input_stream<char>& in, const header& h) {
+    if (h.payload_size >= zero_copy_payload_threshold) {
+        return read_iobuf_exactly_zero_copy(in, h.payload_size);
+    }
+    return read_iobuf_exactly(in, h.payload_size);
+}
+
 template<typename T, typename Codec>
 ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
-    return read_iobuf_exactly(in, h.payload_size).then([h](iobuf io) {
+    return read_payload(in, h).then([h](iobuf io) {
         validate_payload_and_header(io, h);
 
         ss::future<iobuf> iobuf_fut = ss::make_ready_future<iobuf>();
@@ -285,6 +300,10 @@ ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
             iobuf_fut = zstd_inst.uncompress(std::move(io));
             break;
         }
+        case compression_type::lz4:
+            iobuf_fut = compression::stream_compressor::uncompress(
+              std::move(io), compression::type::lz4);
+            break;
         default:
             iobuf_fut = ss::make_exception_future<iobuf>(std::runtime_error(
               fmt::format("no compression supported. header: {}", h)));
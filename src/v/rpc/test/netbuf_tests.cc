@@ -45,3 +45,28 @@ SEASTAR_THREAD_TEST_CASE(netbuf_pod) {
     BOOST_REQUIRE_EQUAL(src.y, dst.y);
     BOOST_REQUIRE_EQUAL(src.z, dst.z);
 }
+
+SEASTAR_THREAD_TEST_CASE(netbuf_compressed_pod) {
+    for (auto c : {rpc::compression_type::zstd, rpc::compression_type::lz4}) {
+        auto n = rpc::netbuf();
+        pod src;
+        src.x = 88;
+        src.y = 88;
+        src.z = 88;
+        n.set_correlation_id(42);
+        n.set_service_method({"test::test", 66});
+        n.set_compression(c);
+        n.set_min_compression_bytes(0);
+        reflection::async_adl<pod>{}.to(n.buffer(), src).get();
+        auto bufs = std::move(n).as_scattered().get().release().release();
+        auto in = make_iobuf_input_stream(iobuf(std::move(bufs)));
+        auto hdr = rpc::parse_header(in).get();
+        BOOST_REQUIRE(hdr.has_value());
+        BOOST_REQUIRE(hdr->compression == c);
+        const pod dst
+          = rpc::parse_type<pod, rpc::default_message_codec>(in, *hdr).get();
+        BOOST_REQUIRE_EQUAL(src.x, dst.x);
+        BOOST_REQUIRE_EQUAL(src.y, dst.y);
+        BOOST_REQUIRE_EQUAL(src.z, dst.z);
+    }
+}
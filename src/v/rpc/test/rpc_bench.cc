@@ -7,7 +7,9 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "random/generators.h"
 #include "reflection/adl.h"
+#include "rpc/types.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -85,3 +87,32 @@ PERF_TEST(big_10mb, serialize) {
 PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
+
+/*
+ * Cost of framing a 64KB payload of compressible text with each of the
+ * compression types available to internal RPC.
+ */
+inline ss::future<> frame_compressed(rpc::compression_type c) {
+    auto data = random_generators::gen_alphanum_string(1 << 10);
+    rpc::netbuf n;
+    n.set_compression(c);
+    for (size_t i = 0; i < 64; ++i) {
+        n.buffer().append(data.data(), data.size());
+    }
+    perf_tests::start_measuring_time();
+    auto msg = co_await std::move(n).as_scattered();
+    perf_tests::do_not_optimize(msg);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(netbuf_64kb, none) {
+    return frame_compressed(rpc::compression_type::none);
+}
+
+PERF_TEST(netbuf_64kb, zstd) {
+    return frame_compressed(rpc::compression_type::zstd);
+}
+
+PERF_TEST(netbuf_64kb, lz4) {
+    return frame_compressed(rpc::compression_type::lz4);
+}
@@ -165,14 +165,16 @@ using connection_cache_label
 enum class compression_type : uint8_t {
     none = 0,
     zstd,
+    lz4,
     min = none,
-    max = zstd,
+    max = lz4,
 };
 
 struct negotiation_frame {
     int8_t version = 0;
     /// \brief 0 - no compression
     ///        1 - zstd
+    ///        2 - lz4
     compression_type compression = compression_type::none;
 };
 
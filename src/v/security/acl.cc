@@ -147,8 +147,20 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
         literals = {it->first, it->second};
     }
 
-    auto prefixes = get_prefix_view<acl_matches::entry_set_ref>(
-      _acls, resource, name);
+    std::vector<acl_matches::entry_set_ref> prefixes;
+    if (auto lengths = _prefix_lengths.find(resource);
+        lengths != _prefix_lengths.end()) {
+        for (auto len : lengths->second) {
+            if (len == 0 || len > name.size()) {
+                continue;
+            }
+            const resource_pattern prefix_pattern(
+              resource, name.substr(0, len), pattern_type::prefixed);
+            if (const auto it = _acls.find(prefix_pattern); it != _acls.end()) {
+                prefixes.push_back({it->first, it->second});
+            }
+        }
+    }
 
     return acl_matches(wildcards, literals, std::move(prefixes));
 }
@@ -234,6 +246,10 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
         maybe_roles.clear();
     }
 
+    if (!dry_run) {
+        ++_generation;
+    }
+
     std::vector<std::vector<acl_binding>> res;
     res.assign(filters.size(), {});
 
@@ -273,13 +289,19 @@ ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
     _acls.clear();
+    _prefix_lengths.clear();
+    ++_generation;
     return ss::do_for_each(
              bindings,
              [this](const auto& binding) {
-                 _acls[binding.pattern()].insert(binding.entry());
+                 add_pattern(binding.pattern()).insert(binding.entry());
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
+      })
+      .then([this] {
+          // results derived while the bindings were being reset are stale
+          ++_generation;
       });
 }
 
@@ -14,8 +14,10 @@
 #include "security/acl_entry_set.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
 
-#include <ranges>
+#include <vector>
 
 namespace security {
 
@@ -34,10 +36,11 @@ public:
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
         for (auto& binding : bindings) {
-            auto& entries = _acls[binding.pattern()];
+            auto& entries = add_pattern(binding.pattern());
             entries.insert(binding.entry());
             entries.rehash();
         }
+        ++_generation;
     }
 
     // remove bindings according the input filters and return the bindings that
@@ -61,6 +64,10 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    /// Incremented on every change of the ACLs, the results derived from the
+    /// store are valid as long as the generation doesn't change.
+    uint64_t generation() const { return _generation; }
+
 private:
     /*
      * resource pattern ordering:
@@ -86,39 +93,22 @@ private:
       btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>;
     container_type _acls;
 
-    /**
-     * WARNING: The view returned by this function contains iterators into a
-     * container which is NOT iterator stable. Use of this view across a yield
-     * point or acl_store update of any kind may (and likely will) result in
-     * UNDEFINED BEHAVIOR.
-     */
-    template<typename RefT>
-    static auto get_prefix_view(
-      const container_type& acls,
-      resource_type resource,
-      const ss::sstring& name) {
-        auto it = acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        return std::ranges::subrange(it, end)
-               | std::views::filter([&name](const auto& e) {
-                     return std::string_view(name).starts_with(e.first.name());
-                 })
-               | std::views::transform(
-                 [](const auto& e) { return RefT{e.first, e.second}; });
-    }
+    // Lengths of the names of the prefixed patterns of every resource type,
+    // longest first. Looking up the prefixes of a name only probes these
+    // lengths instead of scanning all the prefixed patterns. Patterns are
+    // never removed from the store (only their entries are), so neither are
+    // the lengths, until the bindings are reset.
+    absl::flat_hash_map<resource_type, absl::btree_set<size_t, std::greater<>>>
+      _prefix_lengths;
 
-public:
-    template<
-      typename RefT,
-      typename ViewT = decltype(get_prefix_view<RefT>(
-        std::declval<container_type>(),
-        std::declval<resource_type>(),
-        std::declval<ss::sstring>()))>
-    using prefix_view = ViewT;
+    uint64_t _generation{0};
+
+    acl_entry_set& add_pattern(const resource_pattern& pattern) {
+        if (pattern.pattern() == pattern_type::prefixed) {
+            _prefix_lengths[pattern.resource()].insert(pattern.name().size());
+        }
+        return _acls[pattern];
+    }
 };
 
 /*
@@ -139,7 +129,7 @@ public:
     acl_matches(
       std::optional<entry_set_ref> wildcards,
       std::optional<entry_set_ref> literals,
-      acl_store::prefix_view<entry_set_ref> prefixes)
+      std::vector<entry_set_ref> prefixes)
       : wildcards(wildcards)
       , literals(literals)
       , prefixes(std::move(prefixes)) {}
@@ -169,10 +159,8 @@ public:
 private:
     std::optional<entry_set_ref> wildcards;
     std::optional<entry_set_ref> literals;
-    // NOTE(oren): mutable because filter_view & transform_view don't support
-    // const iterators as of C++20. Both are slated for C++23, so we can remove
-    // the mutable specifier when we bump compilers.
-    mutable acl_store::prefix_view<entry_set_ref> prefixes;
+    // longest prefix first
+    std::vector<entry_set_ref> prefixes;
 };
 
 } // namespace security
@@ -965,18 +965,18 @@ ss::future<> audit_log_manager::drain() {
     chunked_vector<partition_batch> p_batches;
     p_batches.reserve(batches.size());
 
-    // attach a partition ID to each batch and call into the audit_sink
-
-    std::transform(
-      std::make_move_iterator(batches.begin()),
-      std::make_move_iterator(batches.end()),
-      std::back_inserter(p_batches),
-      [this](model::record_batch recs) {
-          return partition_batch{
-            .pid = compute_partition_id(),
-            .batch = std::move(recs),
-          };
-      });
+    // attach a partition ID to each batch and call into the audit_sink.
+    // Audit records are repetitive JSON documents, compressing them shrinks
+    // the memory held by the audit client until the produce completes as
+    // well as the bytes sent to and stored by the audit log partitions.
+    for (auto& recs : batches) {
+        auto batch = co_await storage::internal::compress_batch(
+          audit_batch_compression, std::move(recs));
+        p_batches.push_back(partition_batch{
+          .pid = compute_partition_id(),
+          .batch = std::move(batch),
+        });
+    }
 
     /// This call may block if the audit_clients semaphore is exhausted,
     /// this represents the amount of memory used within its kafka::client
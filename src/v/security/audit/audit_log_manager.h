@@ -15,6 +15,7 @@
 #include "kafka/client/fwd.h"
 #include "kafka/client/types.h"
 #include "kafka/protocol/types.h"
+#include "model/compression.h"
 #include "model/namespace.h"
 #include "model/timeout_clock.h"
 #include "net/types.h"
@@ -58,6 +59,9 @@ class audit_log_manager
   : public ss::peering_sharded_service<audit_log_manager> {
 public:
     static constexpr auto client_shard_id = ss::shard_id{0};
+    /// Compression of the batches produced to the audit log, favours speed
+    /// since draining runs on the same shards as the audited requests
+    static constexpr auto audit_batch_compression = model::compression::lz4;
 
     using audit_event_passthrough
       = ss::bool_class<struct audit_event_permitted_tag>;
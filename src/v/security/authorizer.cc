@@ -133,6 +133,18 @@ authorizer::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     return store().reset_bindings(bindings);
 }
 
+void authorizer::maybe_reset_decisions() const {
+    const auto acl_generation = _store->generation();
+    const auto role_generation = _role_store ? _role_store->generation() : 0;
+    if (
+      acl_generation != _decisions_acl_generation
+      || role_generation != _decisions_role_generation) {
+        _decisions.clear();
+        _decisions_acl_generation = acl_generation;
+        _decisions_role_generation = role_generation;
+    }
+}
+
 acl_store& authorizer::store() & { return *_store; }
 const acl_store& authorizer::store() const& { return *_store; }
 
@@ -165,7 +177,22 @@ auth_result authorizer::authorized(
   acl_operation operation,
   const acl_principal& principal,
   const acl_host& host) const {
-    auth_result r = do_authorized(resource_name, operation, principal, host);
+    maybe_reset_decisions();
+    const auto type = get_resource_type<T>();
+    const decision_key_view key{
+      principal, host, type, resource_name(), operation};
+    auth_result r = [&] {
+        if (auto it = _decisions.find(key); it != _decisions.end()) {
+            return it->second;
+        }
+        auto r = do_authorized(resource_name, operation, principal, host);
+        if (_decisions.size() >= max_cached_decisions) {
+            _decisions.clear();
+        }
+        _decisions.emplace(
+          decision_key{principal, host, type, resource_name(), operation}, r);
+        return r;
+    }();
     _probe->record_authz_result(
       r.is_authorized() ? authz_result::allow
       : r.empty_matches ? authz_result::empty
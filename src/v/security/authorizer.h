@@ -22,6 +22,7 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 #include <iosfwd>
@@ -257,6 +258,74 @@ private:
       const acl_principal_base& principal,
       const acl_host& host,
       const acl_operation operation) const;
+
+    /*
+     * Cache of the authorization decisions. The decisions hold references
+     * into the ACL store, the cache is dropped whenever the ACLs, the roles or
+     * the superusers change.
+     */
+    struct decision_key_view {
+        const acl_principal& principal;
+        const acl_host& host;
+        resource_type type;
+        std::string_view name;
+        acl_operation operation;
+
+        bool operator==(const decision_key_view& o) const {
+            return type == o.type && operation == o.operation && name == o.name
+                   && host == o.host && principal == o.principal;
+        }
+    };
+    struct decision_key {
+        acl_principal principal;
+        acl_host host;
+        resource_type type;
+        ss::sstring name;
+        acl_operation operation;
+
+        decision_key_view view() const {
+            return {principal, host, type, name, operation};
+        }
+    };
+    struct decision_key_hash {
+        using is_transparent = void;
+        size_t operator()(const decision_key& k) const {
+            return (*this)(k.view());
+        }
+        size_t operator()(const decision_key_view& k) const {
+            return absl::HashOf(
+              k.principal.type(),
+              k.principal.name_view(),
+              k.host,
+              k.type,
+              k.name,
+              k.operation);
+        }
+    };
+    struct decision_key_eq {
+        using is_transparent = void;
+        static decision_key_view view(const decision_key& k) {
+            return k.view();
+        }
+        static decision_key_view view(const decision_key_view& k) { return k; }
+        template<typename L, typename R>
+        bool operator()(const L& l, const R& r) const {
+            return view(l) == view(r);
+        }
+    };
+    static constexpr size_t max_cached_decisions = 10'000;
+
+    void maybe_reset_decisions() const;
+
+    mutable absl::flat_hash_map<
+      decision_key,
+      auth_result,
+      decision_key_hash,
+      decision_key_eq>
+      _decisions;
+    mutable uint64_t _decisions_acl_generation{0};
+    mutable uint64_t _decisions_role_generation{0};
+
     std::unique_ptr<acl_store> _store;
 
     // The list of superusers is stored twice: once as a vector in the
@@ -269,6 +338,7 @@ private:
         // in any case involve constructing a set to do a comparison
         // between old and new.
         _superusers.clear();
+        _decisions.clear();
         for (const auto& username : _superusers_conf()) {
             auto principal = acl_principal(principal_type::user, username);
             vlog(seclog.info, "Registered superuser account: {}", principal);
@@ -10,6 +10,7 @@
  */
 #pragma once
 #include "bytes/bytes.h"
+#include "crypto/crypto.h"
 #include "security/scram_credential.h"
 #include "security/types.h"
 
@@ -47,6 +48,7 @@ public:
 
     template<typename T>
     void put(const credential_user& name, T&& credential) {
+        _verified.erase(name);
         _credentials.insert_or_assign(name, std::forward<T>(credential));
     }
 
@@ -59,6 +61,7 @@ public:
     }
 
     bool remove(const credential_user& user) {
+        _verified.erase(user);
         return _credentials.erase(user) > 0;
     }
 
@@ -85,10 +88,70 @@ public:
     auto range(auto pred) {
         return boost::adaptors::filter(_credentials, std::move(pred));
     }
-    void clear() { _credentials.clear(); }
+    void clear() {
+        _verified.clear();
+        _credentials.clear();
+    }
+
+    /// Checking a password against a scram credential salts it, which costs
+    /// as many HMACs as the credential has iterations. The last password
+    /// which matched the credential of a user is remembered, as a digest
+    /// keyed with a per-shard secret, until the credential changes.
+    ///
+    /// Returns the SASL mechanism the password was verified for, if it was.
+    std::optional<std::string_view> verified_mechanism(
+      const credential_user& name,
+      const credential_password& password,
+      const scram_credential& cred) const {
+        auto it = _verified.find(name);
+        if (
+          it == _verified.end() || it->second.stored_key != cred.stored_key()
+          || it->second.digest != password_digest(password)) {
+            return std::nullopt;
+        }
+        return it->second.mechanism;
+    }
+
+    /// Remember that \p password matches \p cred for \p mechanism, which has
+    /// to be a string with static storage duration.
+    void set_verified_mechanism(
+      const credential_user& name,
+      const credential_password& password,
+      const scram_credential& cred,
+      std::string_view mechanism) const {
+        _verified.insert_or_assign(
+          name,
+          verified_password{
+            .digest = password_digest(password),
+            .stored_key = cred.stored_key(),
+            .mechanism = mechanism});
+    }
 
 private:
+    struct verified_password {
+        bytes digest;
+        bytes stored_key;
+        std::string_view mechanism;
+    };
+
+    bytes password_digest(const credential_password& password) const {
+        if (_secret.empty()) {
+            _secret = crypto::generate_random(
+              crypto::digest_ctx::size(crypto::digest_type::SHA256),
+              crypto::use_private_rng::yes);
+        }
+        return crypto::hmac(
+          crypto::digest_type::SHA256,
+          _secret,
+          bytes_view(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            reinterpret_cast<const uint8_t*>(password().data()),
+            password().size()));
+    }
+
     container_type _credentials;
+    mutable absl::node_hash_map<credential_user, verified_password> _verified;
+    mutable bytes _secret;
 };
 
 } // namespace security
@@ -26,8 +26,11 @@
 
 #include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <boost/algorithm/string/split.hpp>
 
+#include <algorithm>
+#include <array>
 #include <iosfwd>
 #include <optional>
 #include <string_view>
@@ -536,6 +539,15 @@ public:
             verifier = _verifiers.begin();
         }
 
+        // A client which reconnects presents the same token again, checking
+        // the signature is the expensive part so it is only done once per
+        // token and set of keys. The claims are still validated every time
+        // by the caller, an expired token fails regardless of the cache.
+        auto digest = token_digest(sv);
+        if (_verified.contains(digest)) {
+            return jwt;
+        }
+
         auto second_dot = jose_enc[0].length() + 1 + jose_enc[1].length();
         auto msg = sv.substr(0, second_dot);
         bytes_view msg_view(
@@ -546,6 +558,10 @@ public:
             return errc::jws_invalid_sig;
         }
 
+        if (_verified.size() >= max_verified_tokens) {
+            _verified.clear();
+        }
+        _verified.insert(digest);
         return jwt;
     }
 
@@ -556,11 +572,25 @@ public:
             return verifiers.assume_error();
         }
         _verifiers = std::move(verifiers).assume_value();
+        // A key may have been revoked
+        _verified.clear();
         return outcome::success();
     }
 
 private:
+    static constexpr size_t max_verified_tokens = 4096;
+    using digest_t = std::array<uint8_t, 32>;
+
+    static digest_t token_digest(std::string_view encoded) {
+        auto d = crypto::digest(crypto::digest_type::SHA256, encoded);
+        digest_t key;
+        std::copy_n(d.begin(), key.size(), key.begin());
+        return key;
+    }
+
     detail::verifiers _verifiers;
+    /// SHA-256 of the tokens whose signature was verified with _verifiers
+    mutable absl::flat_hash_set<digest_t> _verified;
 };
 
 } // namespace security::oidc
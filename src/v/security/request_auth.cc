@@ -124,7 +124,7 @@ request_auth_result request_authenticator::do_authenticate(
               std::move(username), "Unauthorized");
         } else {
             auto sasl_mechanism = validate_scram_credential(
-              *cred_opt, password);
+              cred_store, username, *cred_opt, password);
             if (!sasl_mechanism.has_value()) {
                 // User found, password doesn't match
                 vlog(
@@ -92,6 +92,7 @@ bool role_store::remove(const role_name& name) {
       _members_store, [&name](members_store_type::value_type& e) {
           e.second.erase(role_name_view{name});
       });
+    ++_generation;
     return _roles.erase(name) > 0;
 }
 
@@ -103,6 +103,7 @@ public:
             for (const auto& m : role) {
                 _members_store[m].emplace(*it);
             }
+            ++_generation;
         }
         return inserted;
     }
@@ -122,9 +123,13 @@ public:
     void clear() {
         _members_store.clear();
         _roles.clear();
+        ++_generation;
     }
     size_t size() const { return _roles.size(); }
 
+    /// Incremented on every change of the roles or their members
+    uint64_t generation() const { return _generation; }
+
     // Retrieve a list of role_names that satisfy some predicate
     //
     // e.g.:
@@ -155,6 +160,7 @@ public:
 private:
     members_store_type _members_store;
     role_set_type _roles;
+    uint64_t _generation{0};
 };
 
 } // namespace security
@@ -155,4 +155,19 @@ std::optional<std::string_view> validate_scram_credential(
     return sasl_mechanism;
 }
 
+std::optional<std::string_view> validate_scram_credential(
+  const credential_store& store,
+  const credential_user& user,
+  const scram_credential& cred,
+  const credential_password& password) {
+    if (auto mechanism = store.verified_mechanism(user, password, cred)) {
+        return mechanism;
+    }
+    auto mechanism = validate_scram_credential(cred, password);
+    if (mechanism.has_value()) {
+        store.set_verified_mechanism(user, password, cred, *mechanism);
+    }
+    return mechanism;
+}
+
 } // namespace security
@@ -84,4 +84,12 @@ struct scram_sha512_authenticator {
 std::optional<std::string_view> validate_scram_credential(
   const scram_credential& cred, const credential_password& password);
 
+/// As above, for the credential of \p user in \p store. A password which
+/// was verified before is not salted again.
+std::optional<std::string_view> validate_scram_credential(
+  const credential_store& store,
+  const credential_user& user,
+  const scram_credential& cred,
+  const credential_password& password);
+
 } // namespace security
@@ -1593,4 +1593,77 @@ BOOST_AUTO_TEST_CASE(role_authz_remove_binding_multiple_match) {
     BOOST_REQUIRE(get_acls(auth, wildcard_resource) == expected);
 }
 
+BOOST_AUTO_TEST_CASE(authz_nested_prefixes_longest_first) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+
+    const resource_pattern short_prefix(
+      resource_type::topic, "fo", pattern_type::prefixed);
+    const resource_pattern long_prefix(
+      resource_type::topic, "foo-3lk", pattern_type::prefixed);
+    const resource_pattern other_prefix(
+      resource_type::topic, "foo-4", pattern_type::prefixed);
+    const resource_pattern group_prefix(
+      resource_type::group, "foo-3lkj", pattern_type::prefixed);
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(short_prefix, allow_read_acl);
+    bindings.emplace_back(long_prefix, allow_read_acl);
+    bindings.emplace_back(other_prefix, allow_read_acl);
+    bindings.emplace_back(group_prefix, allow_read_acl);
+    auth.add_bindings(bindings);
+
+    auto result = auth.authorized(
+      model::topic(default_resource.name()), acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+    BOOST_REQUIRE_EQUAL(result.resource_pattern, long_prefix);
+
+    // a name shorter than some of the prefixes
+    result = auth.authorized(
+      model::topic("fox"), acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+    BOOST_REQUIRE_EQUAL(result.resource_pattern, short_prefix);
+
+    result = auth.authorized(model::topic("f"), acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE(result.empty_matches);
+}
+
+BOOST_AUTO_TEST_CASE(authz_cached_decisions_follow_acl_changes) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+    const model::topic topic(default_resource.name());
+
+    auto auth = make_test_instance();
+
+    std::vector<acl_binding> allow;
+    allow.emplace_back(default_resource, allow_read_acl);
+    auth.add_bindings(allow);
+
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(
+          auth.authorized(topic, acl_operation::read, user, host).authorized);
+    }
+
+    std::vector<acl_binding> deny;
+    deny.emplace_back(prefixed_resource, deny_read_acl);
+    auth.add_bindings(deny);
+    auto result = auth.authorized(topic, acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE_EQUAL(result.resource_pattern, prefixed_resource);
+
+    // dry run doesn't change anything
+    std::vector<acl_binding_filter> filters{acl_binding_filter(
+      resource_pattern_filter(prefixed_resource), acl_entry_filter::any())};
+    auth.remove_bindings(filters, true);
+    BOOST_REQUIRE(
+      !auth.authorized(topic, acl_operation::read, user, host).authorized);
+
+    auth.remove_bindings(filters);
+    BOOST_REQUIRE(
+      auth.authorized(topic, acl_operation::read, user, host).authorized);
+}
+
 } // namespace security
@@ -11,6 +11,7 @@
 #include "security/credential_store.h"
 #include "security/ephemeral_credential.h"
 #include "security/sasl_authentication.h"
+#include "security/scram_authenticator.h"
 #include "security/scram_credential.h"
 #include "security/types.h"
 #include "utils/base64.h"
@@ -98,4 +99,36 @@ BOOST_AUTO_TEST_CASE(credential_store_test_principal) {
     BOOST_REQUIRE_EQUAL(r1->principal()->name(), "ephemeral");
 }
 
+BOOST_AUTO_TEST_CASE(credential_store_test_verified_password) {
+    const credential_user user{"user"};
+    const credential_password password{"password"};
+    const credential_password other{"other password"};
+
+    credential_store store;
+    auto cred = scram_sha256::make_credentials(
+      password(), scram_sha256::min_iterations);
+    store.put(user, cred);
+
+    BOOST_REQUIRE(!store.verified_mechanism(user, password, cred));
+    auto mechanism = validate_scram_credential(store, user, cred, password);
+    BOOST_REQUIRE_EQUAL(
+      mechanism.value_or(""), scram_sha256_authenticator::name);
+    BOOST_REQUIRE_EQUAL(
+      store.verified_mechanism(user, password, cred).value_or(""),
+      scram_sha256_authenticator::name);
+    BOOST_REQUIRE(!validate_scram_credential(store, user, cred, other));
+
+    // Changing the password forgets the previous one
+    auto new_cred = scram_sha256::make_credentials(
+      other(), scram_sha256::min_iterations);
+    store.put(user, new_cred);
+    BOOST_REQUIRE(!store.verified_mechanism(user, password, new_cred));
+    BOOST_REQUIRE(
+      !validate_scram_credential(store, user, new_cred, password));
+    BOOST_REQUIRE(validate_scram_credential(store, user, new_cred, other));
+
+    // A stale credential never matches the remembered password
+    BOOST_REQUIRE(!store.verified_mechanism(user, other, cred));
+}
+
 } // namespace security
@@ -291,6 +291,32 @@ BOOST_DATA_TEST_CASE(test_oidc_verifier, bdata::make(oidc_verify_data), d) {
     BOOST_REQUIRE(!verify.has_error());
 }
 
+BOOST_AUTO_TEST_CASE(test_oidc_verifier_reverifies_after_key_update) {
+    const auto& auth0 = oidc_verify_data[0];
+    const auto& okta = oidc_verify_data[4];
+
+    auto jws = oidc::jws::make(ss::sstring{auth0.jws});
+    BOOST_REQUIRE(!jws.has_error());
+
+    oidc::verifier v;
+    auto jwks = oidc::jwks::make(ss::sstring{auth0.jwks});
+    BOOST_REQUIRE(!jwks.has_error());
+    BOOST_REQUIRE(!v.update_keys(std::move(jwks).assume_value()).has_error());
+
+    // The second time around the signature is already known to be valid
+    BOOST_REQUIRE(!v.verify(jws.assume_value()).has_error());
+    BOOST_REQUIRE(!v.verify(jws.assume_value()).has_error());
+
+    // The keys were rotated, the token is no longer signed by a known key
+    auto rotated = oidc::jwks::make(ss::sstring{okta.jwks});
+    BOOST_REQUIRE(!rotated.has_error());
+    BOOST_REQUIRE(
+      !v.update_keys(std::move(rotated).assume_value()).has_error());
+    auto verify = v.verify(jws.assume_value());
+    BOOST_REQUIRE(verify.has_error());
+    BOOST_REQUIRE_EQUAL(verify.error(), oidc::errc::jws_invalid_sig);
+}
+
 struct auth_test_data {
     time_t now;
     std::string_view jwks;
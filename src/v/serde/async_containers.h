@@ -0,0 +1,138 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "serde/async.h"
+#include "serde/rw/map.h"
+#include "serde/rw/optional.h"
+#include "serde/rw/reservable.h"
+#include "serde/rw/vector.h"
+
+#include <seastar/core/loop.hh>
+
+#include <limits>
+#include <optional>
+
+/**
+ * Counterparts of the vector, map and optional serde encodings which yield
+ * between elements. The elements are encoded with write_async() and
+ * read_async_nested() so that nested async types are handled too. The
+ * encoding is the same as the synchronous one, the two can be mixed freely.
+ */
+namespace serde {
+
+template<Vector Vec>
+ss::future<> write_vector_async(iobuf& out, Vec t) {
+    if (unlikely(t.size() > std::numeric_limits<serde_size_t>::max())) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "serde: {} size {} exceeds serde_size_t",
+          type_str<Vec>(),
+          t.size()));
+    }
+    write(out, static_cast<serde_size_t>(t.size()));
+    return ss::do_with(std::move(t), [&out](Vec& t) {
+        return ss::do_for_each(
+          t, [&out](auto& el) { return write_async(out, std::move(el)); });
+    });
+}
+
+template<Map M>
+ss::future<> write_map_async(iobuf& out, M t) {
+    if (unlikely(t.size() > std::numeric_limits<serde_size_t>::max())) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "serde: {} size {} exceeds serde_size_t",
+          type_str<M>(),
+          t.size()));
+    }
+    write(out, static_cast<serde_size_t>(t.size()));
+    return ss::do_with(std::move(t), [&out](M& t) {
+        return ss::do_for_each(t, [&out](auto& el) {
+            write(out, el.first);
+            return write_async(out, std::move(el.second));
+        });
+    });
+}
+
+template<typename T>
+ss::future<> write_optional_async(iobuf& out, std::optional<T> t) {
+    if (!t) {
+        write(out, false);
+        return ss::now();
+    }
+    write(out, true);
+    return write_async(out, std::move(t.value()));
+}
+
+template<Vector Vec>
+ss::future<Vec>
+read_vector_async_nested(iobuf_parser& in, const std::size_t bytes_left_limit) {
+    using value_type = typename Vec::value_type;
+    const auto size = read_nested<serde_size_t>(in, bytes_left_limit);
+    return ss::do_with(Vec{}, [size, &in, bytes_left_limit](Vec& t) {
+        if constexpr (Reservable<Vec>) {
+            t.reserve(size);
+        }
+        return ss::do_until(
+                 [size, &t] { return t.size() == size; },
+                 [&t, &in, bytes_left_limit] {
+                     return read_async_nested<value_type>(in, bytes_left_limit)
+                       .then([&t](value_type v) { t.push_back(std::move(v)); });
+                 })
+          .then([&t] {
+              t.shrink_to_fit();
+              return std::move(t);
+          });
+    });
+}
+
+template<Map M>
+ss::future<M>
+read_map_async_nested(iobuf_parser& in, const std::size_t bytes_left_limit) {
+    using key_type = typename M::key_type;
+    using mapped_type = typename M::mapped_type;
+    const auto size = read_nested<serde_size_t>(in, bytes_left_limit);
+    return ss::do_with(
+      M{},
+      serde_size_t{0},
+      [size, &in, bytes_left_limit](M& t, serde_size_t& read) {
+          if constexpr (Reservable<M>) {
+              t.reserve(size);
+          }
+          // counted separately from the map size, duplicate keys collapse
+          return ss::do_until(
+                   [size, &read] { return read == size; },
+                   [&t, &read, &in, bytes_left_limit] {
+                       ++read;
+                       auto key = read_nested<key_type>(in, bytes_left_limit);
+                       return read_async_nested<mapped_type>(
+                                in, bytes_left_limit)
+                         .then(
+                           [&t, key = std::move(key)](mapped_type v) mutable {
+                               t.emplace(std::move(key), std::move(v));
+                           });
+                   })
+            .then([&t] { return std::move(t); });
+      });
+}
+
+template<typename T>
+ss::future<std::optional<T>> read_optional_async_nested(
+  iobuf_parser& in, const std::size_t bytes_left_limit) {
+    if (!read_nested<bool>(in, bytes_left_limit)) {
+        return ss::make_ready_future<std::optional<T>>(std::nullopt);
+    }
+    return read_async_nested<T>(in, bytes_left_limit).then([](T v) {
+        return std::optional<T>(std::move(v));
+    });
+}
+
+} // namespace serde
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "serde/parquet/bloom_filter.h"
+
+#include "base/vassert.h"
+#include "hashing/xx.h"
+#include "serde/parquet/metadata.h"
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/util/variant_utils.hh>
+
+#include <bit>
+#include <cmath>
+
+namespace serde::parquet {
+
+namespace {
+
+// The salts used to derive the bit to set within each word of a block.
+constexpr std::array<uint32_t, 8> salt = {
+  0x47b6137bU,
+  0x44974d91U,
+  0x8824ad5bU,
+  0xa2b7289dU,
+  0x705495c7U,
+  0x2df1424bU,
+  0x9efc4947U,
+  0x5c6bfb31U,
+};
+
+// Fixed width values are plain encoded as their little endian bytes.
+template<typename T>
+uint64_t hash_plain(T v) {
+    using bits_t = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    auto le = ss::cpu_to_le(std::bit_cast<bits_t>(v));
+    // NOLINTNEXTLINE(*reinterpret-cast*)
+    return xxhash_64(reinterpret_cast<const char*>(&le), sizeof(le));
+}
+
+uint64_t hash_bytes(const iobuf& b) {
+    if (b.empty()) {
+        return xxhash_64("", 0);
+    }
+    if (std::distance(b.begin(), b.end()) == 1) {
+        return xxhash_64(b.begin()->get(), b.begin()->size());
+    }
+    incremental_xxhash64 h;
+    for (const auto& frag : b) {
+        h.update(frag.get(), frag.size());
+    }
+    return h.digest();
+}
+
+} // namespace
+
+size_t split_block_bloom_filter::optimal_size_bytes(size_t ndv, double fpp) {
+    // From the parquet spec, the number of bits needed for a false positive
+    // probability of fpp is -8 * ndv / ln(1 - fpp^(1/8)).
+    auto bits = -8.0 * static_cast<double>(ndv)
+                / std::log(1.0 - std::pow(fpp, 1.0 / 8.0));
+    auto bytes = std::max(bits, 0.0) / 8.0;
+    if (!std::isfinite(bytes) || bytes >= static_cast<double>(max_size_bytes)) {
+        return max_size_bytes;
+    }
+    return std::clamp(
+      std::bit_ceil(static_cast<size_t>(bytes)),
+      min_size_bytes,
+      max_size_bytes);
+}
+
+split_block_bloom_filter::split_block_bloom_filter(size_t size_bytes) {
+    vassert(
+      std::has_single_bit(size_bytes) && size_bytes >= min_size_bytes
+        && size_bytes <= max_size_bytes,
+      "invalid bloom filter size: {}",
+      size_bytes);
+    _blocks.resize(size_bytes / sizeof(block), block{});
+}
+
+size_t split_block_bloom_filter::block_index(uint64_t hash) const {
+    return static_cast<size_t>(((hash >> 32) * _blocks.size()) >> 32);
+}
+
+split_block_bloom_filter::block split_block_bloom_filter::mask(uint32_t key) {
+    block m;
+    for (size_t i = 0; i < words_per_block; ++i) {
+        m[i] = uint32_t(1) << ((key * salt[i]) >> 27);
+    }
+    return m;
+}
+
+void split_block_bloom_filter::insert(uint64_t hash) {
+    auto& b = _blocks[block_index(hash)];
+    auto m = mask(static_cast<uint32_t>(hash));
+    for (size_t i = 0; i < words_per_block; ++i) {
+        b[i] |= m[i];
+    }
+}
+
+bool split_block_bloom_filter::contains(uint64_t hash) const {
+    const auto& b = _blocks[block_index(hash)];
+    auto m = mask(static_cast<uint32_t>(hash));
+    for (size_t i = 0; i < words_per_block; ++i) {
+        if ((b[i] & m[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+iobuf split_block_bloom_filter::serialize() const {
+    iobuf out = encode(bloom_filter_header{
+      .num_bytes = static_cast<int32_t>(size_bytes()),
+    });
+    for (const auto& b : _blocks) {
+        block le;
+        for (size_t i = 0; i < words_per_block; ++i) {
+            le[i] = ss::cpu_to_le(b[i]);
+        }
+        // NOLINTNEXTLINE(*reinterpret-cast*)
+        out.append(reinterpret_cast<const uint8_t*>(le.data()), sizeof(le));
+    }
+    return out;
+}
+
+std::optional<uint64_t> bloom_filter_hash(const value& v) {
+    return ss::visit(
+      v,
+      [](const boolean_value& v) -> std::optional<uint64_t> {
+          uint8_t b = v.val ? 1 : 0;
+          return xxhash_64(&b, sizeof(b));
+      },
+      [](const int32_value& v) -> std::optional<uint64_t> {
+          return hash_plain(v.val);
+      },
+      [](const int64_value& v) -> std::optional<uint64_t> {
+          return hash_plain(v.val);
+      },
+      [](const float32_value& v) -> std::optional<uint64_t> {
+          return hash_plain(v.val);
+      },
+      [](const float64_value& v) -> std::optional<uint64_t> {
+          return hash_plain(v.val);
+      },
+      [](const byte_array_value& v) -> std::optional<uint64_t> {
+          return hash_bytes(v.val);
+      },
+      [](const fixed_byte_array_value& v) -> std::optional<uint64_t> {
+          return hash_bytes(v.val);
+      },
+      [](const auto&) -> std::optional<uint64_t> { return std::nullopt; });
+}
+
+} // namespace serde::parquet
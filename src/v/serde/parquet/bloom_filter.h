@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "container/fragmented_vector.h"
+#include "serde/parquet/value.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace serde::parquet {
+
+// A split block bloom filter as defined by the parquet spec.
+//
+// The filter is a sequence of 256 bit blocks, each value sets a single bit in
+// each of the eight 32 bit words of the block its hash selects. Query engines
+// use these to skip column chunks that cannot contain a value when filtering
+// on equality, which min/max statistics cannot do for high cardinality
+// columns such as keys.
+//
+// See: https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+class split_block_bloom_filter {
+public:
+    static constexpr size_t min_size_bytes = 32;
+    static constexpr size_t max_size_bytes = 128_MiB;
+
+    // The size of the bitset needed to hold `ndv` distinct values with a
+    // false positive probability of `fpp`, rounded up to a power of two.
+    static size_t optimal_size_bytes(size_t ndv, double fpp);
+
+    // Create an empty filter with a bitset of `size_bytes`, which must be a
+    // power of two between `min_size_bytes` and `max_size_bytes`.
+    explicit split_block_bloom_filter(size_t size_bytes);
+
+    void insert(uint64_t hash);
+    bool contains(uint64_t hash) const;
+
+    size_t size_bytes() const { return _blocks.size() * sizeof(block); }
+
+    // Serialize the filter as the bloom filter header followed by the bitset,
+    // which is the layout expected at `column_meta_data::bloom_filter_offset`.
+    iobuf serialize() const;
+
+private:
+    static constexpr size_t words_per_block = 8;
+    using block = std::array<uint32_t, words_per_block>;
+
+    size_t block_index(uint64_t hash) const;
+    static block mask(uint32_t key);
+
+    chunked_vector<block> _blocks;
+};
+
+// The hash of a value as it must be inserted into a parquet bloom filter, this
+// is XXH64 of the value's plain encoding without a length prefix for byte
+// arrays.
+//
+// Returns std::nullopt for values that are not added to bloom filters (nulls
+// and non leaf values).
+std::optional<uint64_t> bloom_filter_hash(const value&);
+
+} // namespace serde::parquet
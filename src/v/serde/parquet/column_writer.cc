@@ -18,10 +18,14 @@
 
 #include <seastar/util/variant_utils.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/numeric/int128.h>
 
+#include <array>
+#include <bit>
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -58,13 +62,100 @@ crc::crc32 compute_crc32(Args&&... args) {
     return crc;
 }
 
+// The size of a value when it's plain encoded.
+template<typename value_type>
+size_t plain_encoded_size(const value_type& v) {
+    if constexpr (std::is_same_v<value_type, byte_array_value>) {
+        return sizeof(int32_t) + v.val.size_bytes();
+    } else if constexpr (std::is_same_v<value_type, fixed_byte_array_value>) {
+        return v.val.size_bytes();
+    } else {
+        return sizeof(value_type);
+    }
+}
+
+// The key used to deduplicate values in a dictionary. Values are compared by
+// their binary representation, as that is what is written to the dictionary,
+// so for example NaNs with different payloads are different entries.
+template<typename value_type>
+auto dictionary_key(const value_type& v) {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+        return std::bit_cast<std::array<uint8_t, sizeof(value_type)>>(v);
+    } else {
+        std::string key;
+        key.reserve(v.val.size_bytes());
+        for (const auto& frag : v.val) {
+            key.append(frag.get(), frag.size());
+        }
+        return key;
+    }
+}
+
+// Collects the distinct values of a page into a dictionary, and the index
+// into the dictionary of every value in the page.
+template<typename value_type>
+class dictionary_builder {
+public:
+    // Add a value to the page, returning the memory used to do so.
+    uint64_t add(value_type v) {
+        auto size = plain_encoded_size(v);
+        _plain_size += size;
+        auto [it, inserted] = _index.try_emplace(
+          dictionary_key(v), static_cast<uint32_t>(_values.size()));
+        _indices.push_back(it->second);
+        if (!inserted) {
+            return sizeof(uint32_t);
+        }
+        _dictionary_size += size;
+        _values.push_back(std::move(v));
+        // New values are held by both the dictionary and the index.
+        return sizeof(uint32_t) + 2 * size;
+    }
+
+    // The number of distinct values.
+    size_t size() const { return _values.size(); }
+    // The size of the plain encoded dictionary.
+    size_t dictionary_size() const { return _dictionary_size; }
+    // The size of the values in the page if they were plain encoded.
+    size_t plain_size() const { return _plain_size; }
+
+    const chunked_vector<uint32_t>& indices() const { return _indices; }
+
+    chunked_vector<value_type> take_dictionary() {
+        return std::exchange(_values, {});
+    }
+
+    // The values of the page in the order they were added, for when the page
+    // is plain encoded instead.
+    chunked_vector<value_type> materialize() {
+        chunked_vector<value_type> values;
+        values.reserve(_indices.size());
+        for (auto i : _indices) {
+            values.push_back(internal::copy(_values[i]));
+        }
+        return values;
+    }
+
+private:
+    using key_type = decltype(dictionary_key(std::declval<value_type>()));
+
+    chunked_vector<value_type> _values;
+    absl::flat_hash_map<key_type, uint32_t> _index;
+    chunked_vector<uint32_t> _indices;
+    size_t _dictionary_size = 0;
+    size_t _plain_size = 0;
+};
+
 template<typename value_type, auto comparator>
 class buffered_column_writer final : public column_writer::impl {
 public:
     buffered_column_writer(const schema_element& schema_element, options opts)
       : _max_rep_level(schema_element.max_repetition_level)
       , _max_def_level(schema_element.max_definition_level)
-      , _opts(opts) {}
+      , _opts(opts)
+      , _value_encoding(value_encoding(opts)) {
+        reset_dictionary();
+    }
 
     incremental_column_stats
     add(value val, rep_level rl, def_level dl) override {
@@ -86,6 +177,16 @@ public:
                   value_memory_usage = sizeof(value_type);
               }
               _stats.record_value(v);
+              if (_dictionary.has_value()) {
+                  value_memory_usage = _dictionary->add(std::move(v));
+                  if (
+                    _dictionary->dictionary_size()
+                    > _opts.dictionary_page_size_limit) {
+                      _value_buffer = _dictionary->materialize();
+                      _dictionary.reset();
+                  }
+                  return;
+              }
               _value_buffer.push_back(std::move(v));
           },
           [this](null_value&) {
@@ -125,11 +226,26 @@ public:
         }
         _rep_levels.clear();
         iobuf encoded_data;
-        if constexpr (std::is_trivially_copyable_v<value_type>) {
-            encoded_data = encode_plain(_value_buffer);
-            _value_buffer.clear();
-        } else {
-            encoded_data = encode_plain(std::exchange(_value_buffer, {}));
+        encoding data_encoding = _value_encoding;
+        std::optional<dictionary_page> dictionary;
+        if (_dictionary.has_value()) {
+            auto indices = encode_dictionary_indices(
+              _dictionary->size(), _dictionary->indices());
+            // Only dictionary encode the page if that's smaller, which is not
+            // the case for columns with mostly unique values.
+            if (
+              _dictionary->dictionary_size() + indices.size_bytes()
+              < _dictionary->plain_size()) {
+                encoded_data = std::move(indices);
+                data_encoding = encoding::rle_dictionary;
+                auto values = _dictionary->take_dictionary();
+                dictionary = co_await flush_dictionary_page(std::move(values));
+            } else {
+                _value_buffer = _dictionary->materialize();
+            }
+        }
+        if (data_encoding != encoding::rle_dictionary) {
+            encoded_data = encode_value_buffer();
         }
         size_t uncompressed_page_size = encoded_def_levels.size_bytes()
                                         + encoded_rep_levels.size_bytes()
@@ -153,7 +269,7 @@ public:
             .num_values = std::exchange(_num_values, 0),
             .num_nulls = static_cast<int32_t>(_stats.null_count()),
             .num_rows = std::exchange(_num_rows, 0),
-            .data_encoding = encoding::plain,
+            .data_encoding = data_encoding,
             .definition_levels_byte_length = static_cast<int32_t>(encoded_def_levels.size_bytes()),
             .repetition_levels_byte_length = static_cast<int32_t>(encoded_rep_levels.size_bytes()),
             .is_compressed = _opts.compress,
@@ -177,16 +293,113 @@ public:
         full_page_data.append(std::move(encoded_def_levels));
         full_page_data.append(std::move(encoded_data));
         _stats.reset();
+        reset_dictionary();
         co_return data_page{
           .header = std::move(header),
           .serialized_header_size = header_size,
           .serialized = std::move(full_page_data),
+          .dictionary = std::move(dictionary),
         };
     }
 
 private:
+    static encoding value_encoding(const options& opts) {
+        if (!opts.type_specific_encoding) {
+            return encoding::plain;
+        }
+        if constexpr (
+          std::is_same_v<value_type, int32_value>
+          || std::is_same_v<value_type, int64_value>) {
+            return encoding::delta_binary_packed;
+        } else if constexpr (
+          std::is_same_v<value_type, float32_value>
+          || std::is_same_v<value_type, float64_value>) {
+            return encoding::byte_stream_split;
+        } else {
+            return encoding::plain;
+        }
+    }
+
+    // Encode and clear the buffered values using `_value_encoding`.
+    iobuf encode_value_buffer() {
+        iobuf encoded;
+        if constexpr (
+          std::is_same_v<value_type, int32_value>
+          || std::is_same_v<value_type, int64_value>) {
+            if (_value_encoding == encoding::delta_binary_packed) {
+                encoded = encode_delta_binary_packed(_value_buffer);
+                _value_buffer.clear();
+                return encoded;
+            }
+        } else if constexpr (
+          std::is_same_v<value_type, float32_value>
+          || std::is_same_v<value_type, float64_value>) {
+            if (_value_encoding == encoding::byte_stream_split) {
+                encoded = encode_byte_stream_split(_value_buffer);
+                _value_buffer.clear();
+                return encoded;
+            }
+        }
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            encoded = encode_plain(_value_buffer);
+            _value_buffer.clear();
+        } else {
+            encoded = encode_plain(std::exchange(_value_buffer, {}));
+        }
+        return encoded;
+    }
+
+    // Start a new dictionary if the column should be dictionary encoded. It's
+    // not worth it for booleans, which are bit packed by plain encoding.
+    void reset_dictionary() {
+        if (
+          _opts.dictionary_encoding
+          && !std::is_same_v<value_type, boolean_value>) {
+            _dictionary.emplace();
+        } else {
+            _dictionary.reset();
+        }
+    }
+
+    ss::future<dictionary_page>
+    flush_dictionary_page(chunked_vector<value_type> values) {
+        auto num_values = static_cast<int32_t>(values.size());
+        iobuf encoded_data = encode_plain(std::move(values));
+        size_t uncompressed_page_size = encoded_data.size_bytes();
+        if (uncompressed_page_size > std::numeric_limits<int32_t>::max()) {
+            throw std::runtime_error(fmt::format(
+              "page size limit exceeded: {} bytes", uncompressed_page_size));
+        }
+        if (_opts.compress) {
+            encoded_data = co_await compression::stream_compressor::compress(
+              std::move(encoded_data), compression::type::zstd);
+        }
+        page_header header{
+          .uncompressed_page_size = static_cast<int32_t>(uncompressed_page_size),
+          .compressed_page_size = static_cast<int32_t>(
+            encoded_data.size_bytes()),
+          .crc = compute_crc32(encoded_data),
+          .type = dictionary_page_header{
+            .num_values = num_values,
+            .data_encoding = encoding::plain,
+            .is_sorted = false,
+          },
+        };
+        iobuf full_page_data = encode(header);
+        auto header_size = static_cast<int64_t>(full_page_data.size_bytes());
+        full_page_data.append(std::move(encoded_data));
+        co_return dictionary_page{
+          .header = std::move(header),
+          .serialized_header_size = header_size,
+          .serialized = std::move(full_page_data),
+        };
+    }
+
     column_stats_collector<value_type, comparator> _stats;
     chunked_vector<value_type> _value_buffer;
+    // Set while the page is dictionary encoded, in which case the values are
+    // buffered in the dictionary instead of `_value_buffer`.
+    std::optional<dictionary_builder<value_type>> _dictionary;
     chunked_vector<def_level> _def_levels;
     chunked_vector<rep_level> _rep_levels;
     int32_t _num_rows = 0;
@@ -194,6 +407,8 @@ private:
     rep_level _max_rep_level;
     def_level _max_def_level;
     options _opts;
+    // The encoding of pages that are not dictionary encoded.
+    encoding _value_encoding;
 };
 
 template class buffered_column_writer<boolean_value, ordering::boolean>;
@@ -11,11 +11,23 @@
 
 #pragma once
 
+#include "base/units.h"
 #include "serde/parquet/metadata.h"
 #include "serde/parquet/value.h"
 
 namespace serde::parquet {
 
+// A serialized dictionary page for a column along with the page header.
+struct dictionary_page {
+    // The unencoded header for this page.
+    page_header header;
+    // The size of the encoded header.
+    int64_t serialized_header_size;
+    // This serialized data already includes the header encoded in
+    // Apache Thrift format.
+    iobuf serialized;
+};
+
 // A serialized page for a column along with the page header metadata
 // as that is used when creating the metadata for the entire column.
 struct data_page {
@@ -26,6 +38,9 @@ struct data_page {
     // This serialized data already includes the header encoded in
     // Apache Thrift format.
     iobuf serialized;
+    // If the page is dictionary encoded, the dictionary that must be written
+    // before this page in the column chunk.
+    std::optional<dictionary_page> dictionary;
 };
 
 // The delta in stats when a value is written to a column.
@@ -44,6 +59,18 @@ public:
     struct options {
         // If true, use zstd compression for the column data.
         bool compress = false;
+        // If true, dictionary encode the column data when that is smaller
+        // than plain encoding. Boolean columns are always plain encoded.
+        bool dictionary_encoding = false;
+        // The maximum size of the plain encoded dictionary for a page. If the
+        // dictionary grows past this size the page falls back to plain
+        // encoding.
+        size_t dictionary_page_size_limit = 1_MiB;
+        // If true, pages that are not dictionary encoded use an encoding
+        // suited to the column type instead of plain encoding:
+        // DELTA_BINARY_PACKED for integers and BYTE_STREAM_SPLIT for floating
+        // point numbers.
+        bool type_specific_encoding = false;
     };
 
     explicit column_writer(const schema_element&, options);
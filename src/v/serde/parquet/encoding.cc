@@ -11,11 +11,18 @@
 
 #include "serde/parquet/encoding.h"
 
+#include "base/units.h"
 #include "utils/vint.h"
 
+#include <absl/numeric/int128.h>
+
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <climits>
+#include <iterator>
+#include <limits>
+#include <type_traits>
 
 namespace serde::parquet {
 
@@ -156,6 +163,227 @@ iobuf encode_levels(
     return encode_levels_impl(max_value, levels);
 }
 
+namespace {
+
+// Bit packed runs are made of groups of 8 values.
+constexpr size_t bit_packed_group_size = 8;
+// Repeated values shorter than a group are cheaper to bit pack, as a run
+// length header and value costs at least two bytes.
+constexpr size_t min_rle_run_length = bit_packed_group_size;
+
+void write_uvint(iobuf& buf, uint64_t v) {
+    std::array<uint8_t, vint::max_length> b{};
+    buf.append(b.data(), unsigned_vint::serialize(v, b.data()));
+}
+
+// Bit pack a group of values starting from the least significant bit of each
+// byte. A group is exactly `bit_width` bytes.
+template<typename T>
+void write_bit_packed_group(
+  iobuf& buf,
+  size_t bit_width,
+  const std::array<T, bit_packed_group_size>& group) {
+    std::array<uint8_t, sizeof(T) * CHAR_BIT> packed{};
+    absl::uint128 acc = 0;
+    size_t acc_bits = 0;
+    size_t out = 0;
+    for (T v : group) {
+        acc |= absl::uint128(v) << acc_bits;
+        acc_bits += bit_width;
+        for (; acc_bits >= CHAR_BIT; acc_bits -= CHAR_BIT) {
+            packed[out++] = static_cast<uint8_t>(acc);
+            acc >>= CHAR_BIT;
+        }
+    }
+    buf.append(packed.data(), bit_width);
+}
+
+void write_rle_run(iobuf& buf, size_t bit_width, uint32_t value, size_t count) {
+    write_uvint(buf, count << 1U);
+    auto v = ss::cpu_to_le(value);
+    buf.append(
+      // NOLINTNEXTLINE(*reinterpret-cast*)
+      reinterpret_cast<const uint8_t*>(&v),
+      (bit_width + CHAR_BIT - 1) / CHAR_BIT);
+}
+
+// If the run is not a multiple of the group size the last group is padded with
+// zeros, which decoders ignore as the number of values is in the page header.
+void write_bit_packed_run(
+  iobuf& buf,
+  size_t bit_width,
+  const chunked_vector<uint32_t>& values,
+  size_t begin,
+  size_t end) {
+    size_t groups = (end - begin + bit_packed_group_size - 1)
+                    / bit_packed_group_size;
+    write_uvint(buf, (groups << 1U) | 1U);
+    std::array<uint32_t, bit_packed_group_size> group{};
+    for (size_t i = begin; i < end; i += bit_packed_group_size) {
+        for (size_t j = 0; j < bit_packed_group_size; ++j) {
+            group[j] = i + j < end ? values[i + j] : 0;
+        }
+        write_bit_packed_group(buf, bit_width, group);
+    }
+}
+
+// The block parameters for DELTA_BINARY_PACKED, these are the same that other
+// writers use.
+constexpr size_t delta_block_size = 128;
+constexpr size_t delta_miniblocks_per_block = 4;
+constexpr size_t delta_miniblock_size = delta_block_size
+                                        / delta_miniblocks_per_block;
+
+// Write a block of deltas, padding the last miniblock if the block is not
+// full. Unused miniblocks have a bit width of zero and no data.
+template<typename unsigned_t>
+void write_delta_block(
+  iobuf& buf, std::array<unsigned_t, delta_block_size>& deltas, size_t size) {
+    using signed_t = std::make_signed_t<unsigned_t>;
+    auto min_delta = std::numeric_limits<signed_t>::max();
+    for (size_t i = 0; i < size; ++i) {
+        min_delta = std::min(min_delta, static_cast<signed_t>(deltas[i]));
+    }
+    write_uvint(buf, vint::encode_zigzag(min_delta));
+
+    std::array<uint8_t, delta_miniblocks_per_block> bit_widths{};
+    size_t miniblocks = (size + delta_miniblock_size - 1)
+                        / delta_miniblock_size;
+    for (size_t i = 0; i < delta_block_size; ++i) {
+        // Relative deltas are non-negative, but may need the full width of
+        // the type if the deltas overflow.
+        deltas[i] = i < size ? deltas[i] - static_cast<unsigned_t>(min_delta)
+                             : 0;
+        auto& width = bit_widths[i / delta_miniblock_size];
+        width = std::max(
+          width, static_cast<uint8_t>(std::bit_width(deltas[i])));
+    }
+    buf.append(bit_widths.data(), bit_widths.size());
+
+    std::array<unsigned_t, bit_packed_group_size> group{};
+    for (size_t m = 0; m < miniblocks; ++m) {
+        for (size_t i = m * delta_miniblock_size;
+             i < (m + 1) * delta_miniblock_size;
+             i += bit_packed_group_size) {
+            std::copy_n(&deltas[i], bit_packed_group_size, group.begin());
+            write_bit_packed_group(buf, bit_widths[m], group);
+        }
+    }
+}
+
+template<typename value_type>
+iobuf encode_delta_binary_packed_impl(const chunked_vector<value_type>& vals) {
+    // Deltas are computed with wrap around, so they always fit in the type.
+    using unsigned_t = std::make_unsigned_t<decltype(value_type::val)>;
+    iobuf buf;
+    write_uvint(buf, delta_block_size);
+    write_uvint(buf, delta_miniblocks_per_block);
+    write_uvint(buf, vals.size());
+    write_uvint(
+      buf, vint::encode_zigzag(vals.empty() ? 0 : vals.front().val));
+    if (vals.empty()) {
+        return buf;
+    }
+    std::array<unsigned_t, delta_block_size> deltas{};
+    auto prev = static_cast<unsigned_t>(vals.front().val);
+    size_t size = 0;
+    for (auto it = std::next(vals.begin()); it != vals.end(); ++it) {
+        auto v = static_cast<unsigned_t>(it->val);
+        deltas[size++] = v - prev;
+        prev = v;
+        if (size == delta_block_size) {
+            write_delta_block(buf, deltas, size);
+            size = 0;
+        }
+    }
+    if (size > 0) {
+        write_delta_block(buf, deltas, size);
+    }
+    return buf;
+}
+
+template<typename value_type>
+iobuf encode_byte_stream_split_impl(const chunked_vector<value_type>& vals) {
+    constexpr size_t width = sizeof(value_type::val);
+    // Streams are staged through a small buffer to avoid appending to the
+    // iobuf a byte at a time.
+    constexpr size_t staging_size = 4_KiB;
+    std::array<uint8_t, staging_size> staging{};
+    iobuf buf;
+    for (size_t stream = 0; stream < width; ++stream) {
+        size_t n = 0;
+        for (const auto& v : vals) {
+            // Like plain encoding this assumes a little endian host.
+            staging[n++] = std::bit_cast<std::array<uint8_t, width>>(
+              v.val)[stream];
+            if (n == staging.size()) {
+                buf.append(staging.data(), n);
+                n = 0;
+            }
+        }
+        buf.append(staging.data(), n);
+    }
+    return buf;
+}
+
+} // namespace
+
+iobuf encode_dictionary_indices(
+  uint32_t dictionary_size, const chunked_vector<uint32_t>& indices) {
+    // Use at least one bit, a width of zero is valid for single entry
+    // dictionaries but not all readers handle it.
+    size_t bit_width = std::bit_width(
+      std::max<uint32_t>(dictionary_size, 2) - 1);
+    iobuf buf;
+    auto width_byte = static_cast<uint8_t>(bit_width);
+    buf.append(&width_byte, 1);
+
+    // Alternate between bit packing and run length encoding. Only the last
+    // bit packed run may contain a partial group, so before a repeated run
+    // can be run length encoded the pending literals are topped up to a group
+    // boundary with values from the start of the repeated run.
+    size_t literal_start = 0;
+    size_t i = 0;
+    while (i < indices.size()) {
+        size_t run_end = i + 1;
+        while (run_end < indices.size() && indices[run_end] == indices[i]) {
+            ++run_end;
+        }
+        size_t pending = (i - literal_start) % bit_packed_group_size;
+        size_t pad = pending == 0 ? 0 : bit_packed_group_size - pending;
+        if (run_end - i >= pad + min_rle_run_length) {
+            i += pad;
+            if (i > literal_start) {
+                write_bit_packed_run(buf, bit_width, indices, literal_start, i);
+            }
+            write_rle_run(buf, bit_width, indices[i], run_end - i);
+            literal_start = run_end;
+        }
+        i = run_end;
+    }
+    if (literal_start < indices.size()) {
+        write_bit_packed_run(
+          buf, bit_width, indices, literal_start, indices.size());
+    }
+    return buf;
+}
+
+iobuf encode_delta_binary_packed(const chunked_vector<int32_value>& vals) {
+    return encode_delta_binary_packed_impl(vals);
+}
+
+iobuf encode_delta_binary_packed(const chunked_vector<int64_value>& vals) {
+    return encode_delta_binary_packed_impl(vals);
+}
+
+iobuf encode_byte_stream_split(const chunked_vector<float32_value>& vals) {
+    return encode_byte_stream_split_impl(vals);
+}
+
+iobuf encode_byte_stream_split(const chunked_vector<float64_value>& vals) {
+    return encode_byte_stream_split_impl(vals);
+}
+
 iobuf encode_for_stats(boolean_value v) { return encode_plain({v}); }
 iobuf encode_for_stats(int32_value v) { return encode_plain({v}); }
 iobuf encode_for_stats(int64_value v) { return encode_plain({v}); }
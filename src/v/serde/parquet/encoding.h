@@ -50,6 +50,34 @@ iobuf encode_levels(
 iobuf encode_levels(
   def_level max_value, const chunked_vector<def_level>& levels);
 
+// Dictionary encoded data pages contain the indices into the column chunk's
+// dictionary. They are encoded using the same hybrid run-length
+// encoding/bitpacking scheme as levels, prefixed with a single byte holding the
+// bit width used for the indices, which is derived from `dictionary_size`.
+//
+// See:
+// https://parquet.apache.org/docs/file-format/data-pages/encodings/#dictionary-encoding-plain_dictionary--2-and-rle_dictionary--8
+iobuf encode_dictionary_indices(
+  uint32_t dictionary_size, const chunked_vector<uint32_t>& indices);
+
+// Integers can be encoded as deltas between consecutive values, which are bit
+// packed in miniblocks using the minimum bit width needed for the miniblock.
+// This is very compact for the monotonic values common in Kafka data, such as
+// offsets and timestamps.
+//
+// See:
+// https://parquet.apache.org/docs/file-format/data-pages/encodings/#delta-encoding-delta_binary_packed--5
+iobuf encode_delta_binary_packed(const chunked_vector<int32_value>& vals);
+iobuf encode_delta_binary_packed(const chunked_vector<int64_value>& vals);
+
+// Floating point values can be split into a stream per byte of the value. This
+// does not reduce the size of the data, but makes it much more compressible.
+//
+// See:
+// https://parquet.apache.org/docs/file-format/data-pages/encodings/#byte-stream-split-byte_stream_split--9
+iobuf encode_byte_stream_split(const chunked_vector<float32_value>& vals);
+iobuf encode_byte_stream_split(const chunked_vector<float64_value>& vals);
+
 // Stats are encoded using plain encoding, except variable length arrays
 // which don't have a length prefix.
 iobuf encode_for_stats(boolean_value);
@@ -485,6 +485,8 @@ iobuf encode(const column_meta_data& metadata) {
     constexpr auto index_page_offset_field_id = thrift::field_id(10);
     constexpr auto dictionary_page_offset_field_id = thrift::field_id(11);
     constexpr auto stats_field_id = thrift::field_id(12);
+    constexpr auto bloom_filter_offset_field_id = thrift::field_id(14);
+    constexpr auto bloom_filter_length_field_id = thrift::field_id(15);
     thrift::struct_encoder encoder;
     enum physical_type : int8_t {
         boolean = 0,
@@ -610,6 +612,18 @@ iobuf encode(const column_meta_data& metadata) {
           thrift::field_type::structure,
           encode(*metadata.stats));
     }
+    if (metadata.bloom_filter_offset) {
+        encoder.write_field(
+          bloom_filter_offset_field_id,
+          thrift::field_type::i64,
+          vint::to_bytes(*metadata.bloom_filter_offset));
+    }
+    if (metadata.bloom_filter_length) {
+        encoder.write_field(
+          bloom_filter_length_field_id,
+          thrift::field_type::i32,
+          vint::to_bytes(*metadata.bloom_filter_length));
+    }
     return std::move(encoder).write_stop();
 }
 
@@ -617,6 +631,10 @@ iobuf encode(const column_chunk& chunk) {
     constexpr auto file_path_field_id = thrift::field_id(1);
     constexpr auto file_offset_field_id = thrift::field_id(2);
     constexpr auto meta_data_field_id = thrift::field_id(3);
+    constexpr auto offset_index_offset_field_id = thrift::field_id(4);
+    constexpr auto offset_index_length_field_id = thrift::field_id(5);
+    constexpr auto column_index_offset_field_id = thrift::field_id(6);
+    constexpr auto column_index_length_field_id = thrift::field_id(7);
     thrift::struct_encoder encoder;
     if (chunk.file_path) {
         encoder.write_field(
@@ -631,6 +649,30 @@ iobuf encode(const column_chunk& chunk) {
       meta_data_field_id,
       thrift::field_type::structure,
       encode(chunk.meta_data));
+    if (chunk.offset_index_offset) {
+        encoder.write_field(
+          offset_index_offset_field_id,
+          thrift::field_type::i64,
+          vint::to_bytes(*chunk.offset_index_offset));
+    }
+    if (chunk.offset_index_length) {
+        encoder.write_field(
+          offset_index_length_field_id,
+          thrift::field_type::i32,
+          vint::to_bytes(*chunk.offset_index_length));
+    }
+    if (chunk.column_index_offset) {
+        encoder.write_field(
+          column_index_offset_field_id,
+          thrift::field_type::i64,
+          vint::to_bytes(*chunk.column_index_offset));
+    }
+    if (chunk.column_index_length) {
+        encoder.write_field(
+          column_index_length_field_id,
+          thrift::field_type::i32,
+          vint::to_bytes(*chunk.column_index_length));
+    }
 
     return std::move(encoder).write_stop();
 }
@@ -922,4 +964,127 @@ iobuf encode(const page_header& header) {
     return std::move(encoder).write_stop();
 }
 
+namespace {
+
+iobuf encode(const page_location& location) {
+    constexpr auto offset_field_id = thrift::field_id(1);
+    constexpr auto compressed_page_size_field_id = thrift::field_id(2);
+    constexpr auto first_row_index_field_id = thrift::field_id(3);
+    thrift::struct_encoder encoder;
+    encoder.write_field(
+      offset_field_id,
+      thrift::field_type::i64,
+      vint::to_bytes(location.offset));
+    encoder.write_field(
+      compressed_page_size_field_id,
+      thrift::field_type::i32,
+      vint::to_bytes(location.compressed_page_size));
+    encoder.write_field(
+      first_row_index_field_id,
+      thrift::field_type::i64,
+      vint::to_bytes(location.first_row_index));
+    return std::move(encoder).write_stop();
+}
+
+} // namespace
+
+iobuf encode(const column_index& index) {
+    constexpr auto null_pages_field_id = thrift::field_id(1);
+    constexpr auto min_values_field_id = thrift::field_id(2);
+    constexpr auto max_values_field_id = thrift::field_id(3);
+    constexpr auto boundary_order_field_id = thrift::field_id(4);
+    constexpr auto null_counts_field_id = thrift::field_id(5);
+    thrift::struct_encoder encoder;
+    // Booleans within lists are encoded as a single byte, using the same
+    // values as the field types.
+    thrift::list_encoder null_pages_encoder(
+      index.null_pages.size(), thrift::field_type::boolean_true);
+    for (bool null_page : index.null_pages) {
+        null_pages_encoder.write_element(bytes{static_cast<uint8_t>(
+          null_page ? thrift::field_type::boolean_true
+                    : thrift::field_type::boolean_false)});
+    }
+    encoder.write_field(
+      null_pages_field_id,
+      thrift::field_type::list,
+      std::move(null_pages_encoder).finish());
+    auto encode_values = [](const chunked_vector<iobuf>& values) {
+        thrift::list_encoder values_encoder(
+          values.size(), thrift::field_type::binary);
+        for (const auto& v : values) {
+            values_encoder.write_element(thrift::encode_binary(v.copy()));
+        }
+        return std::move(values_encoder).finish();
+    };
+    encoder.write_field(
+      min_values_field_id,
+      thrift::field_type::list,
+      encode_values(index.min_values));
+    encoder.write_field(
+      max_values_field_id,
+      thrift::field_type::list,
+      encode_values(index.max_values));
+    encoder.write_field(
+      boundary_order_field_id,
+      thrift::field_type::i32,
+      vint::to_bytes(static_cast<int32_t>(index.order)));
+    if (!index.null_counts.empty()) {
+        thrift::list_encoder null_counts_encoder(
+          index.null_counts.size(), thrift::field_type::i64);
+        for (int64_t null_count : index.null_counts) {
+            null_counts_encoder.write_element(vint::to_bytes(null_count));
+        }
+        encoder.write_field(
+          null_counts_field_id,
+          thrift::field_type::list,
+          std::move(null_counts_encoder).finish());
+    }
+    return std::move(encoder).write_stop();
+}
+
+iobuf encode(const offset_index& index) {
+    constexpr auto page_locations_field_id = thrift::field_id(1);
+    thrift::struct_encoder encoder;
+    thrift::list_encoder page_locations_encoder(
+      index.page_locations.size(), thrift::field_type::structure);
+    for (const auto& location : index.page_locations) {
+        page_locations_encoder.write_element(encode(location));
+    }
+    encoder.write_field(
+      page_locations_field_id,
+      thrift::field_type::list,
+      std::move(page_locations_encoder).finish());
+    return std::move(encoder).write_stop();
+}
+
+iobuf encode(const bloom_filter_header& header) {
+    constexpr auto num_bytes_field_id = thrift::field_id(1);
+    constexpr auto algorithm_field_id = thrift::field_id(2);
+    constexpr auto hash_field_id = thrift::field_id(3);
+    constexpr auto compression_field_id = thrift::field_id(4);
+    // The algorithm, hash and compression are unions of empty structs, the
+    // first member of each is the only one defined by the spec: BLOCK, XXHASH
+    // and UNCOMPRESSED respectively.
+    auto first_member = [] {
+        thrift::struct_encoder union_encoder;
+        union_encoder.write_field(
+          thrift::field_id(1),
+          thrift::field_type::structure,
+          thrift::struct_encoder::empty_struct);
+        return std::move(union_encoder).write_stop();
+    };
+    thrift::struct_encoder encoder;
+    encoder.write_field(
+      num_bytes_field_id,
+      thrift::field_type::i32,
+      vint::to_bytes(header.num_bytes));
+    encoder.write_field(
+      algorithm_field_id, thrift::field_type::structure, first_member());
+    encoder.write_field(
+      hash_field_id, thrift::field_type::structure, first_member());
+    encoder.write_field(
+      compression_field_id, thrift::field_type::structure, first_member());
+    return std::move(encoder).write_stop();
+}
+
 } // namespace serde::parquet
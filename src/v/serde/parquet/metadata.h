@@ -386,6 +386,17 @@ struct column_meta_data {
 
     /** optional statistics for this column chunk */
     std::optional<statistics> stats;
+
+    /** Byte offset from beginning of file to Bloom filter data. **/
+    std::optional<int64_t> bloom_filter_offset;
+
+    /** Size of Bloom filter data including the serialized header, in bytes.
+     * Added in 2.10 so readers may not read this field from old files and
+     * it can be obtained after the BloomFilterHeader has been deserialized.
+     * Writers should write this field so readers can read the bloom filter
+     * in a single I/O.
+     */
+    std::optional<int32_t> bloom_filter_length;
 };
 
 struct column_chunk {
@@ -400,6 +411,18 @@ struct column_chunk {
      *implementations. As such, writers MUST populate this field.
      **/
     column_meta_data meta_data;
+
+    /** File offset of ColumnChunk's OffsetIndex **/
+    std::optional<int64_t> offset_index_offset;
+
+    /** Size of ColumnChunk's OffsetIndex, in bytes **/
+    std::optional<int32_t> offset_index_length;
+
+    /** File offset of ColumnChunk's ColumnIndex **/
+    std::optional<int64_t> column_index_offset;
+
+    /** Size of ColumnChunk's ColumnIndex, in bytes **/
+    std::optional<int32_t> column_index_length;
 };
 
 /**
@@ -498,4 +521,104 @@ struct file_metadata {
  */
 iobuf encode(const file_metadata& metadata);
 
+/**
+ * Enum to annotate whether lists of min/max elements inside ColumnIndex
+ * are ordered and if so, in which direction.
+ */
+enum class boundary_order : int32_t {
+    unordered = 0,
+    ascending = 1,
+    descending = 2,
+};
+
+/**
+ * Description for ColumnIndex.
+ * Each <array-field>[i] refers to the page at OffsetIndex.page_locations[i]
+ */
+struct column_index {
+    /**
+     * A list of Boolean values to determine the validity of the corresponding
+     * min and max values. If true, a page contains only null values, and
+     * writers have to set the corresponding entries in min_values and
+     * max_values to byte[0], so that all lists have the same length. If
+     * false, the corresponding entries in min_values and max_values must be
+     * valid.
+     */
+    chunked_vector<bool> null_pages;
+
+    /**
+     * Two lists containing lower and upper bounds for the values of each page
+     * determined by the ColumnOrder of the column. These may be the actual
+     * minimum and maximum values found on a page, but can also be (more
+     * compact) values that do not exist on a page.
+     */
+    chunked_vector<iobuf> min_values;
+    chunked_vector<iobuf> max_values;
+
+    /**
+     * Stores whether both min_values and max_values are ordered and if so, in
+     * which direction. This allows readers to perform binary searches in both
+     * lists. Readers cannot assume that max_values[i] <= min_values[i+1], even
+     * if the lists are ordered.
+     */
+    boundary_order order = boundary_order::unordered;
+
+    /** A list containing the number of null values for each page **/
+    chunked_vector<int64_t> null_counts;
+};
+
+struct page_location {
+    /** Offset of the page in the file **/
+    int64_t offset;
+
+    /**
+     * Size of the page, including header. Sum of compressed_page_size and
+     * header length
+     */
+    int32_t compressed_page_size;
+
+    /**
+     * Index within the RowGroup of the first row of the page. When an
+     * OffsetIndex is present, pages must begin on row boundaries
+     * (repetition_level = 0).
+     */
+    int64_t first_row_index;
+};
+
+/**
+ * Optional offsets for each data page in a ColumnChunk.
+ *
+ * Forms part of the page index, along with ColumnIndex.
+ */
+struct offset_index {
+    /**
+     * PageLocations, ordered by increasing PageLocation.offset. It is required
+     * that page_locations[i].first_row_index < page_locations[i+1].first_row_index.
+     */
+    chunked_vector<page_location> page_locations;
+};
+
+/**
+ * Encode the page index structures into binary form using the Apache Thift
+ * compact wire format.
+ */
+iobuf encode(const column_index&);
+iobuf encode(const offset_index&);
+
+/**
+ * The header written before the bitset of a bloom filter. The only algorithm,
+ * hash and compression defined by the spec are the split block algorithm,
+ * XXH64 and no compression, so only the size of the bitset is variable.
+ */
+struct bloom_filter_header {
+    /** The size of bitset in bytes **/
+    int32_t num_bytes;
+};
+
+/**
+ * Encode the bloom filter header into binary form using the Apache Thift
+ * compact wire format.
+ */
+iobuf encode(const bloom_filter_header&);
+
 } // namespace serde::parquet
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "serde/parquet/bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+namespace serde::parquet {
+
+TEST(BloomFilter, OptimalSize) {
+    using filter = split_block_bloom_filter;
+    EXPECT_EQ(filter::optimal_size_bytes(0, 0.01), filter::min_size_bytes);
+    EXPECT_EQ(filter::optimal_size_bytes(1, 0.01), filter::min_size_bytes);
+    // ~9.6 bits per value for a 1% false positive probability.
+    EXPECT_EQ(filter::optimal_size_bytes(10000, 0.01), 16_KiB);
+    EXPECT_GT(
+      filter::optimal_size_bytes(10000, 0.001),
+      filter::optimal_size_bytes(10000, 0.01));
+    EXPECT_EQ(
+      filter::optimal_size_bytes(size_t(1) << 40, 0.01),
+      filter::max_size_bytes);
+}
+
+TEST(BloomFilter, InsertedValuesAreFound) {
+    constexpr int64_t num_values = 10000;
+    split_block_bloom_filter filter(
+      split_block_bloom_filter::optimal_size_bytes(num_values, 0.01));
+    for (int64_t i = 0; i < num_values; ++i) {
+        filter.insert(*bloom_filter_hash(int64_value{i}));
+    }
+    for (int64_t i = 0; i < num_values; ++i) {
+        EXPECT_TRUE(filter.contains(*bloom_filter_hash(int64_value{i})));
+    }
+    int64_t false_positives = 0;
+    for (int64_t i = num_values; i < 2 * num_values; ++i) {
+        if (filter.contains(*bloom_filter_hash(int64_value{i}))) {
+            ++false_positives;
+        }
+    }
+    // Allow for some slack over the 1% target.
+    EXPECT_LT(false_positives, num_values * 2 / 100);
+}
+
+TEST(BloomFilter, HashesPlainEncoding) {
+    // XXH64 with a seed of zero over the empty input.
+    constexpr uint64_t empty_hash = 0xef46db3751d8e999;
+    EXPECT_EQ(bloom_filter_hash(byte_array_value{}), empty_hash);
+    EXPECT_EQ(bloom_filter_hash(fixed_byte_array_value{}), empty_hash);
+    EXPECT_EQ(bloom_filter_hash(null_value{}), std::nullopt);
+    EXPECT_EQ(bloom_filter_hash(group_value{}), std::nullopt);
+
+    // The hash of a byte array doesn't depend on how it is fragmented.
+    iobuf fragmented;
+    fragmented.append_fragments(iobuf::from("hello "));
+    fragmented.append_fragments(iobuf::from("world"));
+    EXPECT_EQ(
+      bloom_filter_hash(byte_array_value{std::move(fragmented)}),
+      bloom_filter_hash(byte_array_value{iobuf::from("hello world")}));
+
+    // Integers are hashed as their little endian bytes.
+    auto le_one = iobuf::from(std::string_view("\1\0\0\0", 4));
+    EXPECT_EQ(
+      bloom_filter_hash(int32_value{1}),
+      bloom_filter_hash(fixed_byte_array_value{std::move(le_one)}));
+}
+
+TEST(BloomFilter, SerializedLayout) {
+    split_block_bloom_filter filter(1_KiB);
+    filter.insert(*bloom_filter_hash(byte_array_value{iobuf::from("key")}));
+    auto serialized = filter.serialize();
+    // The header precedes the bitset.
+    EXPECT_GT(serialized.size_bytes(), filter.size_bytes());
+    EXPECT_LT(serialized.size_bytes(), filter.size_bytes() + 32);
+}
+
+} // namespace serde::parquet
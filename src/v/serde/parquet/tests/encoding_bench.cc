@@ -0,0 +1,74 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "serde/parquet/encoding.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+using namespace serde::parquet;
+
+/*
+ * Encoding a page worth of the columns datalake writes for every record: the
+ * kafka offset and timestamp, which are monotonic, and a floating point value.
+ * The time per run is the cost of encoding a single value.
+ */
+class encoding_bench {
+public:
+    static constexpr size_t values = 64 * 1024;
+
+    encoding_bench() {
+        int64_t offset = random_generators::get_int<int64_t>(0, 1'000'000);
+        int64_t timestamp = 1'700'000'000'000;
+        for (size_t i = 0; i < values; ++i) {
+            _offsets.push_back({offset++});
+            timestamp += random_generators::get_int(0, 5);
+            _timestamps.push_back({timestamp});
+            _doubles.push_back({random_generators::get_real<double>()});
+        }
+    }
+
+    template<typename Encode>
+    size_t run(Encode encode) {
+        perf_tests::start_measuring_time();
+        auto encoded = encode();
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(encoded);
+        return values;
+    }
+
+protected:
+    chunked_vector<int64_value> _offsets;
+    chunked_vector<int64_value> _timestamps;
+    chunked_vector<float64_value> _doubles;
+};
+
+PERF_TEST_F(encoding_bench, offsets_plain) {
+    return run([this] { return encode_plain(_offsets); });
+}
+
+PERF_TEST_F(encoding_bench, offsets_delta_binary_packed) {
+    return run([this] { return encode_delta_binary_packed(_offsets); });
+}
+
+PERF_TEST_F(encoding_bench, timestamps_plain) {
+    return run([this] { return encode_plain(_timestamps); });
+}
+
+PERF_TEST_F(encoding_bench, timestamps_delta_binary_packed) {
+    return run([this] { return encode_delta_binary_packed(_timestamps); });
+}
+
+PERF_TEST_F(encoding_bench, doubles_plain) {
+    return run([this] { return encode_plain(_doubles); });
+}
+
+PERF_TEST_F(encoding_bench, doubles_byte_stream_split) {
+    return run([this] { return encode_byte_stream_split(_doubles); });
+}
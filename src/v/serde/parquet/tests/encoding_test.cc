@@ -172,6 +172,132 @@ TEST(PlainEncoding, FixedBytes) {
     EXPECT_EQ(encoded, buf<4>("\x00\x05\xFF\xEE"));
 }
 
+TEST(DeltaBinaryPackedEncoding, Empty) {
+    auto encoded = encode_delta_binary_packed(chunked_vector<int64_value>{});
+    EXPECT_EQ(encoded, buf_from(0x80, 0x01, 0x04, 0x00, 0x00));
+}
+
+TEST(DeltaBinaryPackedEncoding, ConstantDeltas) {
+    // All relative deltas are zero so miniblocks have no data.
+    auto encoded = encode_delta_binary_packed(
+      chunked_vector<int32_value>{{1}, {2}, {3}, {4}, {5}});
+    EXPECT_EQ(
+      encoded,
+      buf_from(0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00));
+    encoded = encode_delta_binary_packed(
+      chunked_vector<int64_value>{{7}, {5}, {3}, {1}});
+    EXPECT_EQ(
+      encoded,
+      buf_from(0x80, 0x01, 0x04, 0x04, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x00));
+}
+
+TEST(DeltaBinaryPackedEncoding, BitPacksMiniblocks) {
+    auto encoded = encode_delta_binary_packed(
+      chunked_vector<int32_value>{{0}, {1}, {3}});
+    EXPECT_EQ(
+      encoded,
+      buf_from(
+        0x80,
+        0x01,
+        0x04,
+        0x03,
+        0x00,
+        // min delta and miniblock bit widths
+        0x02,
+        0x01,
+        0x00,
+        0x00,
+        0x00,
+        // a full miniblock of 32 values at 1 bit each
+        0x02,
+        0x00,
+        0x00,
+        0x00));
+}
+
+TEST(DeltaBinaryPackedEncoding, DeltasWrapAround) {
+    auto encoded = encode_delta_binary_packed(chunked_vector<int32_value>{
+      {std::numeric_limits<int32_t>::max()},
+      {std::numeric_limits<int32_t>::min()}});
+    EXPECT_EQ(
+      encoded,
+      buf_from(
+        0x80,
+        0x01,
+        0x04,
+        0x02,
+        0xFE,
+        0xFF,
+        0xFF,
+        0xFF,
+        0x0F,
+        0x02,
+        0x00,
+        0x00,
+        0x00,
+        0x00));
+}
+
+TEST(DeltaBinaryPackedEncoding, MultipleBlocks) {
+    chunked_vector<int64_value> offsets;
+    for (int64_t i = 0; i < 200; ++i) {
+        offsets.push_back({i});
+    }
+    auto encoded = encode_delta_binary_packed(offsets);
+    EXPECT_EQ(
+      encoded,
+      buf_from(
+        0x80,
+        0x01,
+        0x04,
+        0xC8,
+        0x01,
+        0x00,
+        // first block
+        0x02,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        // second block
+        0x02,
+        0x00,
+        0x00,
+        0x00,
+        0x00));
+}
+
+TEST(ByteStreamSplitEncoding, Float32) {
+    auto encoded = encode_byte_stream_split(
+      chunked_vector<float32_value>{{1.0F}, {-2.0F}});
+    EXPECT_EQ(
+      encoded, buf_from(0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x3F, 0xC0));
+}
+
+TEST(ByteStreamSplitEncoding, Float64) {
+    auto encoded = encode_byte_stream_split(
+      chunked_vector<float64_value>{{1.0}, {-2.0}});
+    EXPECT_EQ(
+      encoded,
+      buf_from(
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xF0,
+        0x00,
+        0x3F,
+        0xC0));
+}
+
 struct level_encoding_test_case {
     std::vector<int32_t> levels;
     std::vector<uint8_t> encoding;
@@ -309,6 +435,83 @@ INSTANTIATE_TEST_SUITE_P(
       }
     }));
 
+struct dictionary_indices_test_case {
+    uint32_t dictionary_size;
+    std::vector<uint32_t> indices;
+    std::vector<uint8_t> encoding;
+
+    friend void
+    PrintTo(const dictionary_indices_test_case& b, std::ostream* os) {
+        *os << fmt::format(
+          "{{dictionary_size:{},indices:[{}]}}",
+          b.dictionary_size,
+          fmt::join(b.indices, ","));
+    }
+};
+
+class DictionaryIndicesEncoding
+  : public testing::TestWithParam<dictionary_indices_test_case> {};
+
+TEST_P(DictionaryIndicesEncoding, CanEncode) {
+    auto testcase = GetParam();
+    chunked_vector<uint32_t> indices;
+    for (auto i : testcase.indices) {
+        indices.push_back(i);
+    }
+    iobuf actual = encode_dictionary_indices(testcase.dictionary_size, indices);
+    iobuf expected;
+    expected.append(testcase.encoding.data(), testcase.encoding.size());
+    EXPECT_EQ(actual, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  HybridEncoding,
+  DictionaryIndicesEncoding,
+  testing::Values(
+    dictionary_indices_test_case{
+      .dictionary_size = 0,
+      .indices = {},
+      .encoding = {0x01},
+    },
+    dictionary_indices_test_case{
+      // single entry dictionaries still use a bit width of one
+      .dictionary_size = 1,
+      .indices = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      .encoding = {0x01, 0x14, 0x00},
+    },
+    dictionary_indices_test_case{
+      // a partial group is padded
+      .dictionary_size = 4,
+      .indices = {0, 1, 2, 3, 0, 1},
+      .encoding = {0x02, 0x03, 0xE4, 0x04},
+    },
+    dictionary_indices_test_case{
+      .dictionary_size = 4,
+      .indices = {0, 1, 2, 3, 0, 1, 2, 3},
+      .encoding = {0x02, 0x03, 0xE4, 0xE4},
+    },
+    dictionary_indices_test_case{
+      // the repeated run is too short to be run length encoded after topping
+      // up the literals to a full group
+      .dictionary_size = 4,
+      .indices = {0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+      .encoding = {0x02, 0x05, 0xE4, 0xFF, 0xFF, 0x00},
+    },
+    dictionary_indices_test_case{
+      .dictionary_size = 4,
+      .indices = {0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+      .encoding = {0x02, 0x03, 0xE4, 0xFF, 0x10, 0x03},
+    },
+    dictionary_indices_test_case{
+      // indices wider than a byte
+      .dictionary_size = 1000,
+      .indices = {999, 999, 999, 999, 999, 999, 999, 999, 1},
+      .encoding = {
+        0x0A, 0x10, 0xE7, 0x03,
+        0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      },
+    }));
+
 // NOLINTEND(*magic-number*)
 
 } // namespace serde::parquet
@@ -341,6 +341,9 @@ ss::future<iobuf> serialize_testcase(size_t test_case) {
         .schema = all_types_schema(),
         .metadata = {{"foo", "bar"}},
         .compress = test_case % 2 == 0,
+        .dictionary_encoding = test_case % 4 < 2,
+        .type_specific_encoding = test_case % 8 < 4,
+        .page_index = test_case % 16 < 8,
       },
       make_iobuf_ref_output_stream(file));
     co_await w.init();
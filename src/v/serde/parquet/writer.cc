@@ -13,11 +13,15 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iostream.h"
+#include "container/chunked_hash_map.h"
 #include "container/contiguous_range_map.h"
+#include "serde/parquet/bloom_filter.h"
 #include "serde/parquet/column_writer.h"
 #include "serde/parquet/metadata.h"
 #include "serde/parquet/shredder.h"
 
+#include <algorithm>
+
 namespace serde::parquet {
 
 namespace {
@@ -33,6 +37,44 @@ chunked_vector<ss::sstring> path_in_schema(const schema_element& element) {
     return path;
 }
 
+bool has_bloom_filter(
+  const writer::options& opts, const chunked_vector<ss::sstring>& path) {
+    auto dotted = fmt::format("{}", fmt::join(path, "."));
+    return std::ranges::find(opts.bloom_filter_columns, dotted)
+           != opts.bloom_filter_columns.end();
+}
+
+// The page index of a column chunk, because each column chunk is a single
+// page this is derived from the chunk's metadata.
+column_index make_column_index(const column_meta_data& meta) {
+    column_index index;
+    const auto& stats = meta.stats;
+    bool null_page = !stats || !stats->min || !stats->max;
+    index.null_pages.push_back(null_page);
+    index.min_values.push_back(null_page ? iobuf{} : stats->min->value.copy());
+    index.max_values.push_back(null_page ? iobuf{} : stats->max->value.copy());
+    if (stats && stats->null_count) {
+        index.null_counts.push_back(*stats->null_count);
+    }
+    return index;
+}
+
+offset_index make_offset_index(const column_meta_data& meta) {
+    // The dictionary page is written before the data page and is not part of
+    // the offset index.
+    int64_t dictionary_size = meta.data_page_offset
+                              - meta.dictionary_page_offset.value_or(
+                                meta.data_page_offset);
+    offset_index index;
+    index.page_locations.push_back({
+      .offset = meta.data_page_offset,
+      .compressed_page_size = static_cast<int32_t>(
+        meta.total_compressed_size - dictionary_size),
+      .first_row_index = 0,
+    });
+    return index;
+}
+
 } // namespace
 
 class writer::impl {
@@ -55,7 +97,13 @@ public:
                   element,
                   {
                     .compress = _opts.compress,
+                    .dictionary_encoding = _opts.dictionary_encoding,
+                    .type_specific_encoding = _opts.type_specific_encoding,
                   }),
+                .bloom_filter_hashes =
+                  has_bloom_filter(_opts, path_in_schema(element))
+                    ? std::make_optional<chunked_hash_set<uint64_t>>()
+                    : std::nullopt,
               });
         });
         // write the leading magic bytes
@@ -65,11 +113,21 @@ public:
     ss::future<> write_row(group_value row) {
         co_await shred_record(
           _opts.schema, std::move(row), [this](shredded_value sv) {
-              return write_value(std::move(sv));
+              add_value(std::move(sv));
+              return ss::now();
           });
         ++_stats.current_row_group.rows;
     }
 
+    void write_shredded_row(std::span<shredded_value> values) {
+        for (auto& sv : values) {
+            add_value(std::move(sv));
+        }
+        ++_stats.current_row_group.rows;
+    }
+
+    const schema_element& schema() const { return _opts.schema; }
+
     file_stats stats() const { return _stats; }
 
     ss::future<> flush_row_group() {
@@ -86,16 +144,32 @@ public:
         for (auto& [pos, col] : _columns) {
             auto page = co_await col.writer.flush_page();
             auto& data_header = std::get<data_page_header>(page.header.type);
-            auto uncompressed_size = page.header.uncompressed_page_size
-                                     + page.serialized_header_size;
-            auto compressed_size = page.header.compressed_page_size
-                                   + page.serialized_header_size;
+            int64_t uncompressed_size = page.header.uncompressed_page_size
+                                        + page.serialized_header_size;
+            int64_t compressed_size = page.header.compressed_page_size
+                                      + page.serialized_header_size;
+            std::vector<encoding> encodings;
+            std::optional<int64_t> dictionary_page_offset;
+            // The dictionary page is the first page of the column chunk.
+            if (page.dictionary.has_value()) {
+                auto& dict = page.dictionary.value();
+                uncompressed_size += dict.header.uncompressed_page_size
+                                     + dict.serialized_header_size;
+                compressed_size += dict.header.compressed_page_size
+                                   + dict.serialized_header_size;
+                encodings.push_back(
+                  std::get<dictionary_page_header>(dict.header.type)
+                    .data_encoding);
+                dictionary_page_offset = static_cast<int64_t>(_stats.size);
+                co_await write_iobuf(std::move(dict.serialized));
+            }
+            encodings.push_back(data_header.data_encoding);
             rg.total_byte_size += uncompressed_size;
             rg.total_compressed_size += compressed_size;
             rg.columns.push_back(column_chunk{
               .meta_data = column_meta_data{
                 .type = col.leaf->type,
-                .encodings = {data_header.data_encoding},
+                .encodings = std::move(encodings),
                 .path_in_schema = path_in_schema(*col.leaf),
                 .codec = _opts.compress ? compression_codec::zstd : compression_codec::uncompressed,
                 .num_values = data_header.num_values,
@@ -103,6 +177,7 @@ public:
                 .total_compressed_size = compressed_size,
                 .key_value_metadata = {},
                 .data_page_offset = static_cast<int64_t>(_stats.size),
+                .dictionary_page_offset = dictionary_page_offset,
                 // Because we only write a single page per row group at the moment,
                 // a column chunk's stats are trivially the same as it's page.
                 // When we have multiple pages in a row group we'll have to 
@@ -112,6 +187,27 @@ public:
             });
             co_await write_iobuf(std::move(page.serialized));
         }
+        // Bloom filters are written after the column chunks of their row
+        // group so their hashes don't need to be kept until the file is closed.
+        size_t i = 0;
+        for (auto& [pos, col] : _columns) {
+            auto& meta = rg.columns[i++].meta_data;
+            if (!col.bloom_filter_hashes) {
+                continue;
+            }
+            auto hashes = std::exchange(*col.bloom_filter_hashes, {});
+            split_block_bloom_filter filter(
+              split_block_bloom_filter::optimal_size_bytes(
+                hashes.size(), _opts.bloom_filter_fpp));
+            for (uint64_t h : hashes) {
+                filter.insert(h);
+            }
+            auto serialized = filter.serialize();
+            meta.bloom_filter_offset = static_cast<int64_t>(_stats.size);
+            meta.bloom_filter_length = static_cast<int32_t>(
+              serialized.size_bytes());
+            co_await write_iobuf(std::move(serialized));
+        }
         _stats.rows += _stats.current_row_group.rows;
         _stats.current_row_group = {};
         _row_groups.push_back(std::move(rg));
@@ -119,6 +215,9 @@ public:
 
     ss::future<> close() {
         co_await flush_row_group();
+        if (_opts.page_index) {
+            co_await write_page_index();
+        }
         int64_t num_rows = 0;
         for (const auto& rg : _row_groups) {
             num_rows += rg.num_rows;
@@ -147,6 +246,30 @@ public:
     }
 
 private:
+    // The page index goes between the last row group and the footer, all the
+    // column indexes first and then all the offset indexes, as readers that
+    // use them need to fetch the whole index of a row group anyway.
+    ss::future<> write_page_index() {
+        for (auto& rg : _row_groups) {
+            for (auto& chunk : rg.columns) {
+                auto encoded = encode(make_column_index(chunk.meta_data));
+                chunk.column_index_offset = static_cast<int64_t>(_stats.size);
+                chunk.column_index_length = static_cast<int32_t>(
+                  encoded.size_bytes());
+                co_await write_iobuf(std::move(encoded));
+            }
+        }
+        for (auto& rg : _row_groups) {
+            for (auto& chunk : rg.columns) {
+                auto encoded = encode(make_offset_index(chunk.meta_data));
+                chunk.offset_index_offset = static_cast<int64_t>(_stats.size);
+                chunk.offset_index_length = static_cast<int32_t>(
+                  encoded.size_bytes());
+                co_await write_iobuf(std::move(encoded));
+            }
+        }
+    }
+
     iobuf encode_footer_size(size_t size) {
         iobuf b;
         auto le_size = ss::cpu_to_le(static_cast<uint32_t>(size));
@@ -155,12 +278,18 @@ private:
         return b;
     }
 
-    ss::future<> write_value(shredded_value sv) {
+    void add_value(shredded_value sv) {
         auto& col = _columns.at(sv.schema_element_position);
+        if (col.bloom_filter_hashes) {
+            if (auto h = bloom_filter_hash(sv.val); h) {
+                if (col.bloom_filter_hashes->insert(*h).second) {
+                    _stats.current_row_group.memory_usage += sizeof(*h);
+                }
+            }
+        }
         auto stats = col.writer.add(
           std::move(sv.val), sv.rep_level, sv.def_level);
         _stats.current_row_group.memory_usage += stats.memory_usage;
-        return ss::now();
     }
 
     ss::future<> write_iobuf(iobuf b) {
@@ -171,6 +300,9 @@ private:
     struct column {
         const schema_element* leaf;
         column_writer writer;
+        // The distinct hashes of the values in the current row group, only
+        // set for columns with a bloom filter.
+        std::optional<chunked_hash_set<uint64_t>> bloom_filter_hashes;
     };
 
     options _opts;
@@ -193,6 +325,12 @@ ss::future<> writer::write_row(group_value row) {
     return _impl->write_row(std::move(row));
 }
 
+void writer::write_shredded_row(std::span<shredded_value> values) {
+    _impl->write_shredded_row(values);
+}
+
+const schema_element& writer::schema() const { return _impl->schema(); }
+
 file_stats writer::stats() const { return _impl->stats(); }
 
 ss::future<> writer::flush_row_group() { return _impl->flush_row_group(); }
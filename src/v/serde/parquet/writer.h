@@ -13,10 +13,13 @@
 
 #include "container/fragmented_vector.h"
 #include "serde/parquet/schema.h"
+#include "serde/parquet/shredder.h"
 #include "serde/parquet/value.h"
 
 #include <seastar/core/iostream.hh>
 
+#include <span>
+
 namespace serde::parquet {
 
 // Statistics about the current row group.
@@ -57,6 +60,23 @@ public:
         ss::sstring build = "dev";
         // If true, compress the parquet column chunks using zstd compression
         bool compress = false;
+        // If true, dictionary encode column chunks when that is smaller than
+        // plain encoding them.
+        bool dictionary_encoding = false;
+        // If true, use DELTA_BINARY_PACKED for integer columns and
+        // BYTE_STREAM_SPLIT for floating point columns when they are not
+        // dictionary encoded.
+        bool type_specific_encoding = false;
+        // If true, write a column index and offset index for every column
+        // chunk, which lets readers skip pages using their statistics without
+        // reading the footer's column metadata first.
+        bool page_index = false;
+        // The columns to write bloom filters for, as their dotted path in the
+        // schema without the root's name (i.e. "a.b" for the leaf "b" of the
+        // top level group "a").
+        chunked_vector<ss::sstring> bloom_filter_columns;
+        // The target false positive probability of the bloom filters.
+        double bloom_filter_fpp = 0.01;
         // TODO(parquet): add settings around buffer settings, etc.
     };
 
@@ -82,6 +102,21 @@ public:
     // class.
     ss::future<> write_row(group_value);
 
+    // Write a row that has already been shredded into the values of its leaf
+    // columns against `schema()`, the values are moved out of the span.
+    //
+    // This lets callers with their own representation of a row skip building
+    // a `group_value` for it. The values must form exactly one complete row,
+    // and the values of each column must be in shredding order.
+    //
+    // This method may not be called concurrently with other methods on this
+    // class.
+    void write_shredded_row(std::span<shredded_value>);
+
+    // The indexed schema of the values written to the writer. Only valid after
+    // `init` has completed.
+    const schema_element& schema() const;
+
     // The current stats on the file being written.
     //
     // This can be used to monitor the current file size.
@@ -16,7 +16,13 @@
 #include "serde/read_header.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_size_t.h"
+#include "utils/named_type.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <tuple>
 #include <type_traits>
 
 namespace serde {
@@ -32,6 +38,118 @@ concept has_serde_read = requires(T t, iobuf_parser& in, const header& h) {
 template<typename T>
 concept has_serde_fields = requires(T t) { t.serde_fields(); };
 
+namespace detail {
+
+// Fields whose serde encoding is their little endian in-memory representation.
+// Bools and enums are left out, their encoding is normalized or widened.
+template<typename T>
+inline constexpr bool is_memcpy_field_v = std::is_integral_v<T>
+                                          && !std::is_same_v<T, bool>;
+
+template<typename T, typename Tag, typename IsConstexpr>
+inline constexpr bool
+  is_memcpy_field_v<::detail::base_named_type<T, Tag, IsConstexpr>>
+  = is_memcpy_field_v<T>;
+
+template<typename Tuple>
+struct memcpy_fields;
+
+template<typename... F>
+struct memcpy_fields<std::tuple<F...>> {
+    static constexpr bool value = (is_memcpy_field_v<std::decay_t<F>> && ...);
+    static constexpr std::size_t size
+      = (std::size_t{0} + ... + sizeof(std::decay_t<F>));
+};
+
+template<typename T>
+using envelope_fields_t = decltype(envelope_to_tuple(std::declval<T&>()));
+
+/**
+ * An envelope whose fields are fixed size integers, or named types of those,
+ * packed without padding. Its serialized body is then a copy of the object on
+ * little endian machines. Whether serde_fields() lists the fields in memory
+ * order can't be checked at compile time, see is_memcpy_envelope().
+ */
+template<typename T>
+concept memcpy_envelope_candidate
+  = std::endian::native == std::endian::little && is_envelope<T>
+    && inherits_from_envelope<T> && !is_checksum_envelope<T>
+    && !has_serde_write<T> && !has_serde_read<T> && has_serde_fields<T>
+    && std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    && memcpy_fields<envelope_fields_t<T>>::value
+    && memcpy_fields<envelope_fields_t<T>>::size == sizeof(T);
+
+template<memcpy_envelope_candidate T>
+bool fields_in_layout_order() {
+    T probe{};
+    const auto* base = reinterpret_cast<const char*>(&probe);
+    std::ptrdiff_t expected = 0;
+    bool in_order = true;
+    std::apply(
+      [&](auto&... f) {
+          auto check = [&](const auto& field) {
+              in_order = in_order
+                         && reinterpret_cast<const char*>(&field) - base
+                              == expected;
+              expected += sizeof(field);
+          };
+          (check(f), ...);
+      },
+      envelope_to_tuple(probe));
+    return in_order;
+}
+
+template<typename T>
+bool is_memcpy_envelope() {
+    if constexpr (memcpy_envelope_candidate<T>) {
+        static const bool in_order = fields_in_layout_order<T>();
+        return in_order;
+    } else {
+        return false;
+    }
+}
+
+template<memcpy_envelope_candidate T>
+inline constexpr std::size_t memcpy_envelope_size = envelope_header_size
+                                                    + sizeof(T);
+
+template<memcpy_envelope_candidate T>
+void encode_memcpy_envelope(char* dst, const T& t) {
+    dst[0] = static_cast<char>(T::redpanda_serde_version);
+    dst[1] = static_cast<char>(T::redpanda_serde_compat_version);
+    const auto size = ss::cpu_to_le(static_cast<serde_size_t>(sizeof(T)));
+    std::memcpy(dst + 2, &size, sizeof(size));
+    std::memcpy(dst + envelope_header_size, &t, sizeof(T));
+}
+
+template<memcpy_envelope_candidate T>
+void write_memcpy_envelope(iobuf& out, const T& t) {
+    std::array<char, memcpy_envelope_size<T>> buf;
+    encode_memcpy_envelope(buf.data(), t);
+    out.append(buf.data(), buf.size());
+}
+
+/// Encodes the elements of a range in a few appends of up to 512 bytes
+template<memcpy_envelope_candidate T, typename Range>
+void write_memcpy_envelopes(iobuf& out, const Range& range) {
+    constexpr auto encoded = memcpy_envelope_size<T>;
+    constexpr auto per_append = std::max<std::size_t>(1, 512 / encoded);
+    std::array<char, per_append * encoded> buf;
+    std::size_t n = 0;
+    for (const auto& el : range) {
+        encode_memcpy_envelope(buf.data() + n * encoded, el);
+        if (++n == per_append) {
+            out.append(buf.data(), buf.size());
+            n = 0;
+        }
+    }
+    if (n > 0) {
+        out.append(buf.data(), n * encoded);
+    }
+}
+
+} // namespace detail
+
 template<typename T>
 requires is_envelope<std::decay_t<T>>
 void tag_invoke(
@@ -63,6 +181,17 @@ void tag_invoke(
         }
     }
 
+    if constexpr (detail::memcpy_envelope_candidate<Type>) {
+        // an envelope of the same size has all the fields we know about and
+        // nothing more, it can be copied over the object
+        if (
+          detail::is_memcpy_envelope<Type>()
+          && in.bytes_left() - h._bytes_left_limit == sizeof(Type)) {
+            in.consume_to(sizeof(Type), reinterpret_cast<char*>(&t));
+            return;
+        }
+    }
+
     if constexpr (has_serde_read<Type>) {
         static_assert(!has_serde_fields<Type>);
         t.serde_read(in, h);
@@ -96,6 +225,13 @@ requires is_envelope<std::decay_t<T>>
 void tag_invoke(tag_t<write_tag>, iobuf& out, T t) {
     using Type = std::decay_t<T>;
 
+    if constexpr (detail::memcpy_envelope_candidate<Type>) {
+        if (detail::is_memcpy_envelope<Type>()) {
+            detail::write_memcpy_envelope(out, t);
+            return;
+        }
+    }
+
     write(out, Type::redpanda_serde_version);
     write(out, Type::redpanda_serde_compat_version);
 
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "base/vlog.h"
+#include "serde/rw/envelope.h"
 #include "serde/rw/reservable.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_exception.h"
@@ -64,6 +65,13 @@ void tag_invoke(tag_t<write_tag>, iobuf& out, Vector auto t) {
           t.size()));
     }
     write(out, static_cast<serde_size_t>(t.size()));
+    using value_type = typename std::decay_t<decltype(t)>::value_type;
+    if constexpr (detail::memcpy_envelope_candidate<value_type>) {
+        if (detail::is_memcpy_envelope<value_type>()) {
+            detail::write_memcpy_envelopes<value_type>(out, t);
+            return;
+        }
+    }
     for (auto& el : t) {
         write(out, std::move(el));
     }
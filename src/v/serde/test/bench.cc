@@ -12,7 +12,12 @@
 #include "cluster/node/types.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
+#include "raft/heartbeats.h"
+#include "raft/types.h"
 #include "serde/envelope.h"
+#include "serde/rw/envelope.h"
+#include "serde/rw/named_type.h"
+#include "serde/rw/vector.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -96,3 +101,151 @@ PERF_TEST(big_10mb, serialize) {
 PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
+
+namespace {
+
+// raft::protocol_metadata encoded field by field, the baseline for the bulk
+// copy of memcpy-able envelopes
+struct field_by_field_metadata
+  : serde::envelope<
+      field_by_field_metadata,
+      serde::version<2>,
+      serde::compat_version<0>> {
+    raft::protocol_metadata m;
+
+    void serde_write(iobuf& out) {
+        serde::envelope_for_each_field(
+          m, [&out](auto& f) { serde::write(out, f); });
+    }
+    void serde_read(iobuf_parser& in, const serde::header& h) {
+        serde::envelope_for_each_field(m, [&](auto& f) {
+            f = serde::read_nested<std::decay_t<decltype(f)>>(
+              in, h._bytes_left_limit);
+        });
+    }
+};
+
+struct field_by_field_heartbeat
+  : serde::envelope<
+      field_by_field_heartbeat,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    raft::heartbeat_request_data d;
+
+    void serde_write(iobuf& out) {
+        serde::envelope_for_each_field(
+          d, [&out](auto& f) { serde::write(out, f); });
+    }
+    void serde_read(iobuf_parser& in, const serde::header& h) {
+        serde::envelope_for_each_field(d, [&](auto& f) {
+            f = serde::read_nested<std::decay_t<decltype(f)>>(
+              in, h._bytes_left_limit);
+        });
+    }
+};
+
+static_assert(serde::detail::memcpy_envelope_candidate<raft::protocol_metadata>);
+static_assert(
+  serde::detail::memcpy_envelope_candidate<raft::heartbeat_request_data>);
+
+raft::protocol_metadata make_metadata(int64_t i) {
+    return raft::protocol_metadata{
+      .group = raft::group_id(i),
+      .commit_index = model::offset(i * 100),
+      .term = model::term_id(3),
+      .prev_log_index = model::offset(i * 100 + 10),
+      .prev_log_term = model::term_id(3),
+      .last_visible_index = model::offset(i * 100),
+      .dirty_offset = model::offset(i * 100 + 10),
+      .prev_log_delta = model::offset_delta(i),
+    };
+}
+
+raft::heartbeat_request_data make_heartbeat(int64_t i) {
+    return raft::heartbeat_request_data{
+      .source_revision = model::revision_id(i),
+      .target_revision = model::revision_id(i),
+      .commit_index = model::offset(i * 100),
+      .term = model::term_id(3),
+      .prev_log_index = model::offset(i * 100 + 10),
+      .prev_log_term = model::term_id(3),
+      .last_visible_index = model::offset(i * 100),
+    };
+}
+
+template<typename T, typename Gen>
+std::vector<T> make_many(Gen gen, size_t n = 1000) {
+    std::vector<T> ret;
+    ret.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        ret.push_back(gen(static_cast<int64_t>(i)));
+    }
+    return ret;
+}
+
+template<typename T>
+size_t serialize_vector(const std::vector<T>& v) {
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(v);
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+    return v.size();
+}
+
+template<typename T>
+size_t deserialize_vector(const std::vector<T>& v) {
+    auto b = serde::to_iobuf(v);
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<std::vector<T>>(std::move(b));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+    return v.size();
+}
+
+std::vector<raft::protocol_metadata> many_metadata() {
+    return make_many<raft::protocol_metadata>(make_metadata);
+}
+
+std::vector<field_by_field_metadata> many_metadata_field_by_field() {
+    return make_many<field_by_field_metadata>([](int64_t i) {
+        return field_by_field_metadata{.m = make_metadata(i)};
+    });
+}
+
+std::vector<raft::heartbeat_request_data> many_heartbeats() {
+    return make_many<raft::heartbeat_request_data>(make_heartbeat);
+}
+
+std::vector<field_by_field_heartbeat> many_heartbeats_field_by_field() {
+    return make_many<field_by_field_heartbeat>([](int64_t i) {
+        return field_by_field_heartbeat{.d = make_heartbeat(i)};
+    });
+}
+
+} // namespace
+
+PERF_TEST(append_entries_metadata, serialize) {
+    return serialize_vector(many_metadata());
+}
+PERF_TEST(append_entries_metadata, serialize_field_by_field) {
+    return serialize_vector(many_metadata_field_by_field());
+}
+PERF_TEST(append_entries_metadata, deserialize) {
+    return deserialize_vector(many_metadata());
+}
+PERF_TEST(append_entries_metadata, deserialize_field_by_field) {
+    return deserialize_vector(many_metadata_field_by_field());
+}
+
+PERF_TEST(heartbeat_data, serialize) {
+    return serialize_vector(many_heartbeats());
+}
+PERF_TEST(heartbeat_data, serialize_field_by_field) {
+    return serialize_vector(many_heartbeats_field_by_field());
+}
+PERF_TEST(heartbeat_data, deserialize) {
+    return deserialize_vector(many_heartbeats());
+}
+PERF_TEST(heartbeat_data, deserialize_field_by_field) {
+    return deserialize_vector(many_heartbeats_field_by_field());
+}
@@ -14,6 +14,7 @@
 #include "model/metadata.h"
 #include "random/generators.h"
 #include "serde/async.h"
+#include "serde/async_containers.h"
 #include "serde/peek.h"
 #include "serde/rw/array.h"
 #include "serde/rw/bool_class.h"
@@ -24,10 +25,12 @@
 #include "serde/rw/inet_address.h"
 #include "serde/rw/iobuf.h"
 #include "serde/rw/map.h"
+#include "serde/rw/named_type.h"
 #include "serde/rw/rw.h"
 #include "serde/rw/set.h"
 #include "serde/rw/sstring.h"
 #include "serde/rw/variant.h"
+#include "serde/rw/vector.h"
 #include "test_utils/randoms.h"
 #include "utils/tristate.h"
 
@@ -532,6 +535,78 @@ SEASTAR_THREAD_TEST_CASE(snapshot_test) {
     }
 }
 
+struct async_containers_msg
+  : serde::envelope<
+      async_containers_msg,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    fragmented_vector<test_snapshot_header> headers;
+    absl::flat_hash_map<int32_t, test_snapshot_header> by_id;
+    std::optional<test_snapshot_header> last;
+
+    bool operator==(const async_containers_msg&) const = default;
+
+    ss::future<> serde_async_write(iobuf& out) {
+        co_await serde::write_vector_async(out, std::move(headers));
+        co_await serde::write_map_async(out, std::move(by_id));
+        co_await serde::write_optional_async(out, std::move(last));
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, const serde::header h) {
+        headers = co_await serde::read_vector_async_nested<decltype(headers)>(
+          in, h._bytes_left_limit);
+        by_id = co_await serde::read_map_async_nested<decltype(by_id)>(
+          in, h._bytes_left_limit);
+        last = co_await serde::read_optional_async_nested<test_snapshot_header>(
+          in, h._bytes_left_limit);
+    }
+};
+
+SEASTAR_THREAD_TEST_CASE(async_containers_test) {
+    auto make_header = [](int32_t i) {
+        test_snapshot_header h{
+          .ns_ = model::ns(fmt::format("ns-{}", i)),
+          .metadata_crc = i,
+          .version = 1,
+          .metadata_size = i * 2};
+        crc::crc32c crc;
+        crc.extend(ss::cpu_to_le(h.metadata_crc));
+        crc.extend(ss::cpu_to_le(h.version));
+        crc.extend(ss::cpu_to_le(h.metadata_size));
+        h.header_crc = static_cast<int32_t>(crc.value());
+        return h;
+    };
+
+    auto make_msg = [&make_header] {
+        async_containers_msg msg;
+        for (int32_t i = 0; i < 10000; ++i) {
+            msg.headers.push_back(make_header(i));
+            if (i % 10 == 0) {
+                msg.by_id.emplace(i, make_header(i));
+            }
+        }
+        msg.last = make_header(-1);
+        return msg;
+    };
+
+    iobuf b;
+    serde::write_async(b, make_msg()).get();
+    iobuf_parser parser{std::move(b)};
+    BOOST_REQUIRE(
+      serde::read_async<async_containers_msg>(parser).get() == make_msg());
+
+    // the encoding matches the synchronous one of the same containers
+    const fragmented_vector<int64_t> ints{1, 2, 3};
+    iobuf async_buf;
+    serde::write_vector_async(async_buf, ints.copy()).get();
+    BOOST_REQUIRE_EQUAL(async_buf, serde::to_iobuf(ints.copy()));
+
+    const std::optional<int64_t> empty;
+    iobuf empty_buf;
+    serde::write_optional_async(empty_buf, empty).get();
+    BOOST_REQUIRE_EQUAL(empty_buf, serde::to_iobuf(empty));
+}
+
 struct small
   : public serde::envelope<small, serde::version<0>, serde::compat_version<0>> {
     bool operator==(const small&) const = default;
@@ -1178,3 +1253,155 @@ SEASTAR_THREAD_TEST_CASE(variant) {
       serde::from_iobuf<decltype(v1)>(serde::to_iobuf(v0)),
       serde::serde_exception);
 }
+
+namespace {
+using packed_term = named_type<int64_t, struct packed_term_tag>;
+using packed_offset = named_type<int64_t, struct packed_offset_tag>;
+
+struct packed_meta
+  : serde::envelope<packed_meta, serde::version<1>, serde::compat_version<0>> {
+    packed_term term;
+    packed_offset commit_index;
+    packed_offset last_visible_index;
+    int32_t node_id{0};
+    uint32_t flags{0};
+
+    bool operator==(const packed_meta&) const = default;
+    auto serde_fields() {
+        return std::tie(term, commit_index, last_visible_index, node_id, flags);
+    }
+};
+
+// same layout, serialized in a different order than the memory layout
+struct packed_meta_reordered
+  : serde::envelope<
+      packed_meta_reordered,
+      serde::version<1>,
+      serde::compat_version<0>> {
+    packed_term term;
+    packed_offset commit_index;
+    int32_t node_id{0};
+    int32_t other_id{0};
+
+    bool operator==(const packed_meta_reordered&) const = default;
+    auto serde_fields() {
+        return std::tie(node_id, term, other_id, commit_index);
+    }
+};
+
+// packed_meta with one more field
+struct packed_meta_v2
+  : serde::
+      envelope<packed_meta_v2, serde::version<2>, serde::compat_version<0>> {
+    packed_term term;
+    packed_offset commit_index;
+    packed_offset last_visible_index;
+    int32_t node_id{0};
+    uint32_t flags{0};
+    int64_t extra{0};
+
+    auto serde_fields() {
+        return std::tie(
+          term, commit_index, last_visible_index, node_id, flags, extra);
+    }
+};
+
+struct padded_meta
+  : serde::envelope<padded_meta, serde::version<1>, serde::compat_version<0>> {
+    int8_t a{0};
+    int64_t b{0};
+
+    auto serde_fields() { return std::tie(a, b); }
+};
+
+struct bool_meta
+  : serde::envelope<bool_meta, serde::version<1>, serde::compat_version<0>> {
+    int64_t a{0};
+    bool b{false};
+    int8_t c[7]{};
+
+    auto serde_fields() { return std::tie(a, b); }
+};
+} // namespace
+
+static_assert(serde::detail::memcpy_envelope_candidate<packed_meta>);
+static_assert(serde::detail::memcpy_envelope_candidate<packed_meta_reordered>);
+static_assert(!serde::detail::memcpy_envelope_candidate<padded_meta>);
+static_assert(!serde::detail::memcpy_envelope_candidate<bool_meta>);
+static_assert(!serde::detail::memcpy_envelope_candidate<complex_msg>);
+
+SEASTAR_THREAD_TEST_CASE(memcpy_envelope_test) {
+    BOOST_REQUIRE(serde::detail::is_memcpy_envelope<packed_meta>());
+    BOOST_REQUIRE(!serde::detail::is_memcpy_envelope<packed_meta_reordered>());
+
+    const packed_meta m{
+      .term = packed_term(7),
+      .commit_index = packed_offset(-1),
+      .last_visible_index = packed_offset(1234567890123),
+      .node_id = -3,
+      .flags = 0xdeadbeef,
+    };
+
+    // the encoding is the same as the field by field one
+    iobuf expected;
+    serde::write(expected, packed_meta::redpanda_serde_version);
+    serde::write(expected, packed_meta::redpanda_serde_compat_version);
+    serde::write(expected, static_cast<serde::serde_size_t>(sizeof(m)));
+    serde::write(expected, m.term);
+    serde::write(expected, m.commit_index);
+    serde::write(expected, m.last_visible_index);
+    serde::write(expected, m.node_id);
+    serde::write(expected, m.flags);
+    BOOST_REQUIRE_EQUAL(serde::to_iobuf(m), expected);
+
+    BOOST_REQUIRE(serde::from_iobuf<packed_meta>(serde::to_iobuf(m)) == m);
+
+    const packed_meta_reordered r{
+      .term = packed_term(1),
+      .commit_index = packed_offset(2),
+      .node_id = 3,
+      .other_id = 4,
+    };
+    auto r_buf = serde::to_iobuf(r);
+    iobuf_parser r_parser(r_buf.copy());
+    r_parser.skip(serde::envelope_header_size);
+    BOOST_REQUIRE_EQUAL(r_parser.consume_type<int32_t>(), r.node_id);
+    BOOST_REQUIRE(
+      serde::from_iobuf<packed_meta_reordered>(std::move(r_buf)) == r);
+
+    // other versions of different sizes are read field by field
+    const packed_meta_v2 v2{
+      .term = packed_term(7),
+      .commit_index = packed_offset(8),
+      .last_visible_index = packed_offset(9),
+      .node_id = 10,
+      .flags = 11,
+      .extra = 12,
+    };
+    const auto from_v2 = serde::from_iobuf<packed_meta>(serde::to_iobuf(v2));
+    BOOST_REQUIRE_EQUAL(from_v2.term, v2.term);
+    BOOST_REQUIRE_EQUAL(from_v2.last_visible_index, v2.last_visible_index);
+    BOOST_REQUIRE_EQUAL(from_v2.flags, v2.flags);
+    const auto to_v2 = serde::from_iobuf<packed_meta_v2>(serde::to_iobuf(m));
+    BOOST_REQUIRE_EQUAL(to_v2.commit_index, m.commit_index);
+    BOOST_REQUIRE_EQUAL(to_v2.node_id, m.node_id);
+    BOOST_REQUIRE_EQUAL(to_v2.extra, 0);
+
+    std::vector<packed_meta> vec;
+    for (int i = 0; i < 100; ++i) {
+        vec.push_back(packed_meta{
+          .term = packed_term(i),
+          .commit_index = packed_offset(i * 2),
+          .last_visible_index = packed_offset(i * 3),
+          .node_id = i,
+          .flags = static_cast<uint32_t>(i),
+        });
+    }
+    auto vec_buf = serde::to_iobuf(vec);
+    BOOST_REQUIRE_EQUAL(
+      vec_buf.size_bytes(),
+      sizeof(serde::serde_size_t)
+        + vec.size() * (serde::envelope_header_size + sizeof(packed_meta)));
+    BOOST_REQUIRE(
+      serde::from_iobuf<std::vector<packed_meta>>(std::move(vec_buf)) == vec);
+}
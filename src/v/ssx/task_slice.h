@@ -0,0 +1,154 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <seastar/core/reactor.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+namespace ssx {
+
+/// Names the logical operation a synchronous stretch of code belongs to, so
+/// that a long task slice can be attributed to e.g. "compaction" rather than
+/// to the continuation machinery which shows up in stall backtraces.
+///
+/// \code
+///   for (auto& seg : segments) {
+///       ssx::task_slice slice("compaction_index_build");
+///       build_index(seg); // no scheduling points
+///       co_await ss::coroutine::maybe_yield();
+///   }
+/// \endcode
+///
+/// The slice covers the lifetime of the guard and has to stay within a single
+/// task, a guard which lives across a scheduling point is not measured. The
+/// operation name must outlive the process, string literals are expected.
+///
+/// Tracking is off by default and costs a branch when disabled. Once enabled
+/// on a shard, each operation accumulates task_slice::stats and slices
+/// longer than the threshold are passed to the observer.
+class task_slice {
+    using clock = std::chrono::steady_clock;
+
+    static uint64_t current_task_cnt() {
+        return seastar::engine().get_sched_stats().tasks_processed;
+    }
+
+public:
+    struct stats {
+        uint64_t slices{0};
+        uint64_t long_slices{0};
+        clock::duration longest{0};
+    };
+
+    struct observer {
+        /// Called the first time an operation is seen on a shard. The stats
+        /// reference stays valid until tracking is disabled.
+        seastar::noncopyable_function<void(std::string_view, const stats&)>
+          on_new_operation;
+        /// Called for every slice at or above the threshold.
+        seastar::noncopyable_function<void(std::string_view, clock::duration)>
+          on_long_slice;
+    };
+
+    explicit task_slice(std::string_view operation) noexcept
+      : _previous(current_slice) {
+        if (state != nullptr) [[unlikely]] {
+            _operation = operation;
+            _task_cnt = current_task_cnt();
+            _start = clock::now();
+            current_slice = this;
+        }
+    }
+
+    ~task_slice() noexcept {
+        if (state != nullptr && !_operation.empty()) [[unlikely]] {
+            current_slice = _previous;
+            if (_task_cnt == current_task_cnt()) {
+                try {
+                    record(_operation, clock::now() - _start);
+                } catch (...) {
+                    // best effort diagnostics, never fail the operation
+                }
+            }
+        }
+    }
+
+    task_slice(const task_slice&) = delete;
+    task_slice& operator=(const task_slice&) = delete;
+    task_slice(task_slice&&) = delete;
+    task_slice& operator=(task_slice&&) = delete;
+
+    /// The innermost operation running on this shard, empty if there is none
+    /// or tracking is disabled.
+    static std::string_view current() noexcept {
+        return current_slice ? current_slice->_operation : std::string_view{};
+    }
+
+    /// Enables tracking on this shard. Slices of at least `threshold` are
+    /// reported to the observer.
+    static void enable(clock::duration threshold, observer obs) {
+        state = std::make_unique<tracking_state>(threshold, std::move(obs));
+    }
+
+    /// Disables tracking on this shard and drops the accumulated stats.
+    static void disable() noexcept {
+        state.reset();
+        current_slice = nullptr;
+    }
+
+    static bool enabled() noexcept { return state != nullptr; }
+
+private:
+    struct tracking_state {
+        tracking_state(clock::duration threshold, observer obs)
+          : threshold(threshold)
+          , obs(std::move(obs)) {}
+
+        clock::duration threshold;
+        observer obs;
+        // node based so that references handed to the observer are stable
+        std::unordered_map<std::string_view, stats> operations;
+    };
+
+    static void record(std::string_view operation, clock::duration d) {
+        auto [it, inserted] = state->operations.try_emplace(operation);
+        auto& s = it->second;
+        if (inserted && state->obs.on_new_operation) {
+            state->obs.on_new_operation(operation, s);
+        }
+        ++s.slices;
+        s.longest = std::max(s.longest, d);
+        if (d >= state->threshold) {
+            ++s.long_slices;
+            if (state->obs.on_long_slice) {
+                state->obs.on_long_slice(operation, d);
+            }
+        }
+    }
+
+    static inline thread_local std::unique_ptr<tracking_state> state;
+    static inline thread_local task_slice* current_slice = nullptr;
+
+    task_slice* _previous;
+    std::string_view _operation;
+    uint64_t _task_cnt{0};
+    clock::time_point _start;
+};
+
+} // namespace ssx
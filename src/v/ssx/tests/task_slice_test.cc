@@ -0,0 +1,77 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "ssx/task_slice.h"
+
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/later.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(task_slice_disabled_by_default) {
+    BOOST_REQUIRE(!ssx::task_slice::enabled());
+    ssx::task_slice slice("op");
+    BOOST_REQUIRE(ssx::task_slice::current().empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(task_slice_records_slices) {
+    std::vector<std::string> seen;
+    std::vector<std::string> long_slices;
+    const ssx::task_slice::stats* op_stats = nullptr;
+
+    ssx::task_slice::enable(
+      5ms,
+      ssx::task_slice::observer{
+        .on_new_operation =
+          [&](std::string_view op, const ssx::task_slice::stats& s) {
+              seen.emplace_back(op);
+              op_stats = &s;
+          },
+        .on_long_slice =
+          [&](std::string_view op, std::chrono::steady_clock::duration) {
+              long_slices.emplace_back(op);
+          },
+      });
+
+    {
+        ssx::task_slice outer("outer");
+        BOOST_REQUIRE_EQUAL(ssx::task_slice::current(), "outer");
+        {
+            ssx::task_slice inner("outer");
+            BOOST_REQUIRE_EQUAL(ssx::task_slice::current(), "outer");
+        }
+        std::this_thread::sleep_for(10ms);
+    }
+    BOOST_REQUIRE(ssx::task_slice::current().empty());
+
+    BOOST_REQUIRE_EQUAL(seen.size(), 1);
+    BOOST_REQUIRE_EQUAL(seen[0], "outer");
+    BOOST_REQUIRE_EQUAL(op_stats->slices, 2);
+    BOOST_REQUIRE_EQUAL(op_stats->long_slices, 1);
+    BOOST_REQUIRE_GE(op_stats->longest, 10ms);
+    BOOST_REQUIRE_EQUAL(long_slices.size(), 1);
+
+    // a guard living across a scheduling point spans several tasks and is
+    // not a slice
+    {
+        ssx::task_slice slice("outer");
+        seastar::yield().get();
+    }
+    BOOST_REQUIRE_EQUAL(op_stats->slices, 2);
+
+    ssx::task_slice::disable();
+    BOOST_REQUIRE(!ssx::task_slice::enabled());
+}
@@ -89,6 +89,9 @@ public:
     kvstore& kvs() { return *_kvstore; }
     log_manager& log_mgr() { return *_log_mgr; }
     storage_resources& resources() { return _resources; }
+    ss::sharded<features::feature_table>& feature_table() {
+        return _feature_table;
+    }
 
     /*
      * Return disk space usage for kvstore and all logs. The information
@@ -171,7 +171,7 @@ batch_cache::entry batch_cache::put(
 
     if (static_cast<size_t>(input.size_bytes()) > range::range_size) {
         auto r = new range(index, input, dirty);
-        _lru.push_back(*r);
+        admit(*r, dirty);
         _size_bytes += r->memory_size();
         return entry(0, r->weak_from_this());
     }
@@ -180,9 +180,13 @@ batch_cache::entry batch_cache::put(
       !index._small_batches_range || !index._small_batches_range->valid()
       || !index._small_batches_range->fits(input)) {
         auto r = new range(index);
-        _lru.push_back(*r);
+        admit(*r, dirty);
         _size_bytes += r->memory_size();
         index._small_batches_range = r->weak_from_this();
+    } else if (dirty && index._small_batches_range->_probationary) {
+        // ranges with dirty data aren't reclaimable until flushed, keep them
+        // out of the way of the probationary reclaim.
+        touch(index._small_batches_range);
     }
 
     auto initial_sz = index._small_batches_range->memory_size();
@@ -194,10 +198,15 @@ batch_cache::entry batch_cache::put(
     return entry(offset, index._small_batches_range->weak_from_this());
 }
 
+void batch_cache::admit(range& r, is_dirty_entry dirty) {
+    r._probationary = !dirty;
+    list_of(r).push_back(r);
+}
+
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
-      _size_bytes == 0 && _lru.empty(),
+      _size_bytes == 0 && empty(),
       "Detected incorrect batch_cache accounting. {}",
       *this);
 }
@@ -214,8 +223,9 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
-        _lru.erase_and_dispose(
-          _lru.iterator_to(*p), [](range* e) { delete e; });
+        auto& list = list_of(*p);
+        list.erase_and_dispose(
+          list.iterator_to(*p), [](range* e) { delete e; });
     }
 }
 
@@ -257,10 +267,42 @@ size_t batch_cache::reclaim(size_t size) {
      * invalidated. invalidation is important because the batch reference in the
      * index still exists even though the batch data was removed.
      */
-    size_t reclaimed = 0;
-    intrusive_list<range, &range::_hook> reclaimed_ranges;
+    range_list reclaimed_ranges;
+    size_t reclaimed = reclaim_from(_probation, 0, reclaimed_ranges);
+    reclaimed = reclaim_from(_lru, reclaimed, reclaimed_ranges);
+
+    /*
+     * final removal from the index is deferred because there is some chance
+     * that removal allocates, so waiting until the bulk of the reclaims have
+     * occurred reduces the probability of an allocation failure.
+     */
+
+    reclaimed_ranges.clear_and_dispose([](range* e) {
+        auto* index = &e->_index;
+        auto offsets = std::move(e->_offsets);
+        delete e; // NOLINT
+
+        /*
+         * since reclaim may be invoked at any moment and removals may be
+         * deferred if an index is locked, one can imagine races in which a
+         * batch is removed by offset here which is not the same batch that was
+         * reclaimed in a prior pass. at worst this would raise the miss ratio,
+         * but is still generally safe since all batch cache users are prepared
+         * to handle a miss.
+         */
+        for (auto& o : offsets) {
+            index->remove(o);
+        }
+    });
+
+    _last_reclaim = ss::lowres_clock::now();
+    _size_bytes -= reclaimed;
+    return reclaimed;
+}
 
-    for (auto it = _lru.begin(); it != _lru.end();) {
+size_t batch_cache::reclaim_from(
+  range_list& list, size_t reclaimed, range_list& reclaimed_ranges) {
+    for (auto it = list.begin(); it != list.end();) {
         if (reclaimed >= _reclaim_size) {
             break;
         }
@@ -290,37 +332,10 @@ size_t batch_cache::reclaim(size_t size) {
         }
 
         // collect the entries that will be fully removed
-        it = _lru.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
+        it = list.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
             reclaimed_ranges.push_back(*e);
         });
     }
-
-    /*
-     * final removal from the index is deferred because there is some chance
-     * that removal allocates, so waiting until the bulk of the reclaims have
-     * occurred reduces the probability of an allocation failure.
-     */
-
-    reclaimed_ranges.clear_and_dispose([](range* e) {
-        auto* index = &e->_index;
-        auto offsets = std::move(e->_offsets);
-        delete e; // NOLINT
-
-        /*
-         * since reclaim may be invoked at any moment and removals may be
-         * deferred if an index is locked, one can imagine races in which a
-         * batch is removed by offset here which is not the same batch that was
-         * reclaimed in a prior pass. at worst this would raise the miss ratio,
-         * but is still generally safe since all batch cache users are prepared
-         * to handle a miss.
-         */
-        for (auto& o : offsets) {
-            index->remove(o);
-        }
-    });
-
-    _last_reclaim = ss::lowres_clock::now();
-    _size_bytes -= reclaimed;
     return reclaimed;
 }
 
@@ -357,8 +372,10 @@ batch_cache_index::get(model::offset offset) {
     if (auto it = find_first_contains(offset); it != _index.end()) {
         batch_cache::range::lock_guard g(*it->second.range());
         _cache->touch(it->second.range());
+        ++_cache->_hits;
         return it->second.batch();
     }
+    ++_cache->_misses;
     return std::nullopt;
 }
 
@@ -426,6 +443,11 @@ batch_cache_index::read_result batch_cache_index::read(
         }
     }
     ret.next_batch = offset;
+    if (ret.batches.empty()) {
+        ++_cache->_misses;
+    } else {
+        ++_cache->_hits;
+    }
     return ret;
 }
 
@@ -515,6 +537,10 @@ ss::future<> batch_cache::background_reclaimer::reclaim_loop() {
             auto to_reclaim = _min_free_memory - free;
             _cache.reclaim(to_reclaim);
         }
+
+        if (auto over = _cache.bytes_over_max_size(); over > 0) {
+            _cache.reclaim(over);
+        }
     }
     co_return;
 }
@@ -536,7 +562,8 @@ std::ostream& operator<<(std::ostream& o, const batch_cache& b) {
     // Do _not_ print size of _lru
     return o << "{is_reclaiming:" << b.is_memory_reclaiming()
              << ", size_bytes: " << b._size_bytes
-             << ", lru_empty:" << b._lru.empty() << "}";
+             << ", lru_empty:" << b._lru.empty()
+             << ", probation_empty:" << b._probation.empty() << "}";
 }
 std::ostream&
 operator<<(std::ostream& o, const batch_cache_index::read_result& c) {
@@ -29,6 +29,7 @@
 #include <absl/container/btree_map.h>
 
 #include <limits>
+#include <optional>
 #include <type_traits>
 
 class batch_cache_test_fixture;
@@ -57,6 +58,20 @@ class batch_cache_index;
  * example, a batch cache index is created for each log segment, all of which
  * share the same LRU cache.
  *
+ * Scan resistance
+ * ===============
+ *
+ * Ranges populated by reads start on a probationary FIFO and are moved to the
+ * LRU the first time they are hit. Ranges holding appended (dirty) batches go
+ * to the LRU directly. Reclaim drains the probationary FIFO before the LRU, so
+ * a one-off scan of historical data only displaces other one-off reads rather
+ * than the hot tail of the logs.
+ *
+ * A scan usually hits the ranges it populated itself, the next read of a
+ * consumer starts where its read-ahead ended. Lookups can therefore skip the
+ * promotion: readers with `skip_batch_cache` set and reads of segments which
+ * are no longer appended to leave the ranges they hit on the FIFO.
+ *
  * The LRU cache serves as an entry point for the Seastar memory reclaimer.
  * During a low-memory event Seastar may make an upcall to the LRU cache to free
  * memory. When memory is reclaimed cache entries are invalidated. Since this
@@ -204,6 +219,10 @@ public:
 
         bool _pinned{false};
 
+        // Whether the range is on the probationary FIFO rather than the LRU,
+        // i.e. it was populated by reads and hasn't been hit since.
+        bool _probationary{false};
+
         // Maximum dirty batch offset that is stored in this range. If a range
         // contains any dirty batch offsets we prevent its eviction so that
         // readers get cache hits until the data is persisted to disk and we can
@@ -312,7 +331,7 @@ public:
     ss::future<> stop() { return _background_reclaimer.stop(); }
 
     /// Returns true if the cache is empty, and false otherwise.
-    bool empty() const { return _lru.empty(); }
+    bool empty() const { return _lru.empty() && _probation.empty(); }
 
     /// Removes all entries from the cache.
     void clear() { reclaim(std::numeric_limits<size_t>::max()); }
@@ -342,12 +361,14 @@ public:
     void evict(range_ptr&& e);
 
     /**
-     * Notify the cache that the specified range was recently used.
+     * Notify the cache that the specified range was recently used. A range on
+     * the probationary FIFO is promoted to the LRU.
      */
     void touch(range_ptr& e) {
         if (e) {
             auto p = e.get();
             p->_hook.unlink();
+            p->_probationary = false;
             _lru.push_back(*p);
         }
     }
@@ -378,8 +399,35 @@ public:
      */
     size_t size_bytes() const { return _size_bytes; }
 
+    struct stats {
+        /// Number of lookups served from the cache
+        uint64_t hits{0};
+        /// Number of lookups that found nothing in the cache
+        uint64_t misses{0};
+    };
+
+    stats get_stats() const { return {.hits = _hits, .misses = _misses}; }
+
+    /**
+     * @brief Bound the size of the cache.
+     *
+     * When the cache grows beyond the limit the background reclaimer evicts
+     * the least recently used ranges. With std::nullopt the size of the cache
+     * is only bounded by the memory reclaimer.
+     */
+    void set_max_size(std::optional<size_t> max_size) {
+        _max_size = max_size;
+        _background_reclaimer.notify();
+    }
+
 private:
     friend batch_cache_test_fixture;
+    friend batch_cache_index;
+
+    size_t bytes_over_max_size() const {
+        return _max_size && _size_bytes > *_max_size ? _size_bytes - *_max_size
+                                                     : 0;
+    }
     struct batch_reclaiming_lock {
         explicit batch_reclaiming_lock(batch_cache& b) noexcept
           : ref(b)
@@ -412,7 +460,8 @@ private:
 
     private:
         bool have_to_reclaim() const {
-            return ss::memory::stats().free_memory() < _min_free_memory;
+            return ss::memory::stats().free_memory() < _min_free_memory
+                   || _cache.bytes_over_max_size() > 0;
         }
         bool _stopped = false;
         ssx::semaphore _change{0, "s/batch-reclaim"};
@@ -440,10 +489,28 @@ private:
                               : reclaim_result::reclaimed_nothing;
     }
 
-    intrusive_list<range, &range::_hook> _lru;
+    using range_list = intrusive_list<range, &range::_hook>;
+
+    range_list& list_of(range& r) {
+        return r._probationary ? _probation : _lru;
+    }
+
+    // Places a new range on the probationary FIFO or the LRU.
+    void admit(range& r, is_dirty_entry dirty);
+
+    // Reclaims ranges from the front of the list until `_reclaim_size` bytes
+    // (including `reclaimed`) have been reclaimed.
+    size_t reclaim_from(
+      range_list& list, size_t reclaimed, range_list& reclaimed_ranges);
+
+    range_list _lru;
+    range_list _probation;
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
+    std::optional<size_t> _max_size;
+    uint64_t _hits{0};
+    uint64_t _misses{0};
 
     reclaim_options _reclaim_opts;
     ss::lowres_clock::time_point _last_reclaim;
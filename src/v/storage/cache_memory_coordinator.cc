@@ -0,0 +1,265 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/cache_memory_coordinator.h"
+
+#include "base/units.h"
+#include "base/vassert.h"
+#include "base/vlog.h"
+#include "config/configuration.h"
+#include "metrics/prometheus_sanitize.h"
+#include "storage/logger.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+
+namespace storage {
+
+cache_memory_coordinator::cache_memory_coordinator(
+  config::binding<std::optional<size_t>> total_budget,
+  config::binding<std::chrono::milliseconds> rebalance_interval)
+  : _total_budget(std::move(total_budget))
+  , _rebalance_interval(std::move(rebalance_interval))
+  , _timer([this] { rebalance(); }) {
+    _total_budget.watch([this] {
+        if (_total_budget().has_value()) {
+            reset_budgets();
+        } else {
+            release_budgets();
+        }
+    });
+    _rebalance_interval.watch([this] {
+        if (_timer.armed()) {
+            _timer.cancel();
+            _timer.arm_periodic(_rebalance_interval());
+        }
+    });
+}
+
+void cache_memory_coordinator::register_cache(cache_config cfg) {
+    vassert(
+      !_timer.armed(),
+      "cache {} must be registered before the coordinator is started",
+      cfg.name);
+    _caches.push_back(cache{.config = std::move(cfg)});
+}
+
+void cache_memory_coordinator::start() {
+    setup_metrics();
+    if (_total_budget().has_value()) {
+        reset_budgets();
+    }
+    _timer.arm_periodic(_rebalance_interval());
+}
+
+ss::future<> cache_memory_coordinator::stop() {
+    _timer.cancel();
+    _metrics.clear();
+    return ss::now();
+}
+
+void cache_memory_coordinator::apply(cache& c, size_t budget) {
+    c.state.budget = budget;
+    c.config.set_budget_fn(budget);
+}
+
+void cache_memory_coordinator::reset_budgets() {
+    if (_caches.empty()) {
+        return;
+    }
+    const auto total = _total_budget().value();
+
+    // every cache gets at least its minimum, the rest is split evenly among
+    // the caches that can take more
+    size_t remaining = total;
+    for (auto& c : _caches) {
+        c.state.budget = c.config.min_budget;
+        remaining -= std::min(remaining, c.config.min_budget);
+    }
+    while (remaining > 0) {
+        auto open = std::count_if(
+          _caches.begin(), _caches.end(), [](const cache& c) {
+              return c.state.budget < c.config.max_budget;
+          });
+        if (open == 0) {
+            break;
+        }
+        const auto share = std::max<size_t>(remaining / open, 1);
+        for (auto& c : _caches) {
+            auto add = std::min(
+              {share, c.config.max_budget - c.state.budget, remaining});
+            c.state.budget += add;
+            remaining -= add;
+        }
+    }
+
+    for (auto& c : _caches) {
+        vlog(
+          stlog.info,
+          "Assigning {} bytes of the {} bytes shard cache budget to {}",
+          c.state.budget,
+          total,
+          c.config.name);
+        apply(c, c.state.budget);
+    }
+    _budgets_assigned = true;
+}
+
+void cache_memory_coordinator::release_budgets() {
+    for (auto& c : _caches) {
+        c.state.budget = 0;
+        c.config.set_budget_fn(std::nullopt);
+    }
+    _budgets_assigned = false;
+}
+
+void cache_memory_coordinator::rebalance() {
+    if (!_total_budget().has_value() || _caches.empty()) {
+        return;
+    }
+    if (!_budgets_assigned) {
+        reset_budgets();
+    }
+
+    for (auto& c : _caches) {
+        const auto s = c.config.sample_fn();
+        // counters are cumulative, a reset is treated as a fresh start
+        const auto hits = s.hits >= c.last_sample.hits
+                            ? s.hits - c.last_sample.hits
+                            : s.hits;
+        const auto misses = s.misses >= c.last_sample.misses
+                              ? s.misses - c.last_sample.misses
+                              : s.misses;
+        const auto lookups = hits + misses;
+        c.state.size_bytes = s.size_bytes;
+        c.state.hit_ratio = lookups == 0 ? 0.0
+                                         : static_cast<double>(hits)
+                                             / static_cast<double>(lookups);
+        const auto mib = std::max(
+          static_cast<double>(s.size_bytes) / static_cast<double>(1_MiB), 1.0);
+        c.state.hits_per_mib = static_cast<double>(hits) / mib;
+        c.last_sample = s;
+    }
+
+    // the receiver is the cache with the highest benefit among the ones that
+    // are constrained by their budget
+    cache* receiver = nullptr;
+    for (auto& c : _caches) {
+        const bool constrained
+          = c.state.budget < c.config.max_budget
+            && static_cast<double>(c.state.size_bytes)
+                 >= static_cast<double>(c.state.budget) * pressure_threshold;
+        if (
+          constrained
+          && (!receiver || c.state.hits_per_mib > receiver->state.hits_per_mib)) {
+            receiver = &c;
+        }
+    }
+    if (!receiver || receiver->state.hits_per_mib == 0) {
+        return;
+    }
+
+    cache* donor = nullptr;
+    for (auto& c : _caches) {
+        if (&c == receiver || c.state.budget <= c.config.min_budget) {
+            continue;
+        }
+        if (!donor || c.state.hits_per_mib < donor->state.hits_per_mib) {
+            donor = &c;
+        }
+    }
+    if (
+      !donor
+      || receiver->state.hits_per_mib
+           <= donor->state.hits_per_mib * benefit_hysteresis) {
+        return;
+    }
+
+    const auto total = _total_budget().value();
+    const auto step = std::min(
+      {std::max<size_t>(static_cast<size_t>(total * step_fraction), 1),
+       donor->state.budget - donor->config.min_budget,
+       receiver->config.max_budget - receiver->state.budget});
+
+    vlog(
+      stlog.debug,
+      "Moving {} bytes of cache budget from {} ({:.2f} hits/MiB) to {} "
+      "({:.2f} hits/MiB)",
+      step,
+      donor->config.name,
+      donor->state.hits_per_mib,
+      receiver->config.name,
+      receiver->state.hits_per_mib);
+
+    // shrink the donor first so that the caches never exceed the total
+    apply(*donor, donor->state.budget - step);
+    apply(*receiver, receiver->state.budget + step);
+    ++_moves;
+}
+
+std::optional<cache_memory_coordinator::cache_state>
+cache_memory_coordinator::state(std::string_view name) const {
+    auto it = std::find_if(
+      _caches.begin(), _caches.end(), [name](const cache& c) {
+          return c.config.name == name;
+      });
+    if (it == _caches.end()) {
+        return std::nullopt;
+    }
+    return it->state;
+}
+
+void cache_memory_coordinator::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    auto cache_label = sm::label("cache");
+    std::vector<sm::metric_definition> defs;
+    for (auto& c : _caches) {
+        const std::vector<sm::label_instance> labels = {
+          cache_label(c.config.name)};
+        auto* state = &c.state;
+        defs.emplace_back(sm::make_gauge(
+          "budget_bytes",
+          [state] { return state->budget; },
+          sm::description("Memory budget assigned to the cache, in bytes. "
+                          "Zero if the cache manages its own memory."),
+          labels));
+        defs.emplace_back(sm::make_gauge(
+          "size_bytes",
+          [state] { return state->size_bytes; },
+          sm::description("Memory used by the cache as of the last "
+                          "rebalance, in bytes."),
+          labels));
+        defs.emplace_back(sm::make_gauge(
+          "hit_ratio",
+          [state] { return state->hit_ratio; },
+          sm::description("Hit ratio of the cache during the last "
+                          "rebalance interval."),
+          labels));
+        defs.emplace_back(sm::make_gauge(
+          "hits_per_mib",
+          [state] { return state->hits_per_mib; },
+          sm::description("Hits per MiB held by the cache during the last "
+                          "rebalance interval."),
+          labels));
+    }
+    defs.emplace_back(sm::make_counter(
+      "budget_moves",
+      [this] { return _moves; },
+      sm::description("Number of times budget was moved between caches")));
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:cache_coordinator"), defs);
+}
+
+} // namespace storage
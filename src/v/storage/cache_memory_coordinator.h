@@ -0,0 +1,132 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "metrics/metrics.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <chrono>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace storage {
+
+/**
+ * Shard local coordinator of the memory budgets of the storage caches.
+ *
+ * The batch cache, the chunk cache and the readers cache each bound their
+ * memory independently, so under memory pressure they compete for the same
+ * memory without regard to how useful it is to each of them. When a shard
+ * budget is configured the coordinator splits it between the registered
+ * caches and periodically moves budget from the cache that benefits the least
+ * from its memory to the one that benefits the most.
+ *
+ * The benefit of a cache is the number of hits per MiB it held during the
+ * last interval. Budget is only moved to a cache that is using most of its
+ * current budget and whose benefit is clearly higher than the one of the
+ * donor, so that budgets stay stable under a steady workload.
+ *
+ * When no budget is configured the caches are released to their own memory
+ * management.
+ */
+class cache_memory_coordinator {
+public:
+    /// Fraction of the total budget moved in a single rebalancing step
+    static constexpr double step_fraction = 0.05;
+    /// A cache must use this fraction of its budget to receive more
+    static constexpr double pressure_threshold = 0.9;
+    /// Ratio between the benefit of the receiver and the donor required to
+    /// move budget between them
+    static constexpr double benefit_hysteresis = 1.25;
+
+    /// Cumulative counters reported by a cache
+    struct sample {
+        size_t size_bytes{0};
+        uint64_t hits{0};
+        uint64_t misses{0};
+    };
+
+    struct cache_config {
+        ss::sstring name;
+        size_t min_budget{0};
+        size_t max_budget{std::numeric_limits<size_t>::max()};
+        ss::noncopyable_function<sample()> sample_fn;
+        /// Applies a budget to the cache, std::nullopt releases the cache to
+        /// its own memory management
+        ss::noncopyable_function<void(std::optional<size_t>)> set_budget_fn;
+    };
+
+    /// Budget and cost/benefit metrics of a cache as of the last rebalance
+    struct cache_state {
+        size_t budget{0};
+        size_t size_bytes{0};
+        double hit_ratio{0};
+        double hits_per_mib{0};
+    };
+
+    cache_memory_coordinator(
+      config::binding<std::optional<size_t>> total_budget,
+      config::binding<std::chrono::milliseconds> rebalance_interval);
+
+    cache_memory_coordinator(const cache_memory_coordinator&) = delete;
+    cache_memory_coordinator& operator=(const cache_memory_coordinator&)
+      = delete;
+    cache_memory_coordinator(cache_memory_coordinator&&) = delete;
+    cache_memory_coordinator& operator=(cache_memory_coordinator&&) = delete;
+    ~cache_memory_coordinator() = default;
+
+    /// Caches must be registered before the coordinator is started and must
+    /// outlive it.
+    void register_cache(cache_config);
+
+    void start();
+    ss::future<> stop();
+
+    /// Samples the caches and moves budget between them if one benefits
+    /// clearly more from memory than another. Invoked periodically.
+    void rebalance();
+
+    /// State of the cache registered under \p name, if any
+    std::optional<cache_state> state(std::string_view name) const;
+
+    /// Number of rebalancing steps that moved budget between caches
+    uint64_t moves() const { return _moves; }
+
+private:
+    struct cache {
+        cache_config config;
+        sample last_sample;
+        cache_state state;
+    };
+
+    void reset_budgets();
+    void release_budgets();
+    void apply(cache&, size_t budget);
+    void setup_metrics();
+
+    config::binding<std::optional<size_t>> _total_budget;
+    config::binding<std::chrono::milliseconds> _rebalance_interval;
+    std::vector<cache> _caches;
+    bool _budgets_assigned{false};
+    uint64_t _moves{0};
+    ss::timer<> _timer;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace storage
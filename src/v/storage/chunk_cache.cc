@@ -10,14 +10,22 @@
  */
 #include "storage/chunk_cache.h"
 
+#include "base/vlog.h"
 #include "config/configuration.h"
 #include "metrics/prometheus_sanitize.h"
 #include "resource_mgmt/memory_groups.h"
+#include "storage/logger.h"
 
 #include <seastar/core/loop.hh>
 
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
 namespace storage::internal {
 
 chunk_cache::chunk_cache() noexcept
@@ -29,6 +37,9 @@ ss::future<> chunk_cache::start() {
     setup_metrics();
     const auto num_chunks = memory_groups().chunk_cache_min_memory()
                             / _chunk_size;
+    if (config::shard_local_cfg().append_chunk_arena_enabled()) {
+        return reserve_arena(num_chunks);
+    }
     return ss::do_for_each(
       boost::counting_iterator<size_t>(0),
       boost::counting_iterator<size_t>(num_chunks),
@@ -39,6 +50,38 @@ ss::future<> chunk_cache::start() {
       });
 }
 
+ss::future<> chunk_cache::reserve_arena(size_t num_chunks) {
+    _arena_size = num_chunks * _chunk_size;
+    if (_arena_size == 0) {
+        return ss::now();
+    }
+    _arena = ss::allocate_aligned_buffer<char>(_arena_size, arena_alignment);
+    // Only a hint, the arena is pre-faulted and retained either way.
+    if (::madvise(_arena.get(), _arena_size, MADV_HUGEPAGE) != 0) {
+        vlog(
+          stlog.debug,
+          "Unable to back the {} bytes chunk arena with huge pages: {}",
+          _arena_size,
+          std::strerror(errno));
+    }
+    vlog(
+      stlog.info,
+      "Reserved {} bytes for {} segment appender chunks",
+      _arena_size,
+      num_chunks);
+    return ss::do_for_each(
+      boost::counting_iterator<size_t>(0),
+      boost::counting_iterator<size_t>(num_chunks),
+      [this](size_t i) {
+          // constructing the chunk zeroes its memory, which faults in the
+          // pages of the arena
+          auto c = ss::make_lw_shared<chunk>(
+            _arena.get() + i * _chunk_size, _chunk_size, alignment);
+          _size_total += _chunk_size;
+          add(c);
+      });
+}
+
 ss::future<> chunk_cache::stop() {
     _metrics.clear();
     return ss::now();
@@ -63,6 +106,11 @@ void chunk_cache::setup_metrics() {
           [this] { return _size_available; },
           sm::description("Total size of all free segment appender chunks in "
                           "the cache, in bytes.")),
+        sm::make_gauge(
+          "arena_size_bytes",
+          [this] { return _arena_size; },
+          sm::description("Size of the memory reserved at startup for segment "
+                          "appender chunks, in bytes.")),
         sm::make_counter(
           "wait_count",
           [this] { return _wait_for_chunk_count; },
@@ -72,7 +120,8 @@ void chunk_cache::setup_metrics() {
 }
 
 void chunk_cache::add(const chunk_ptr& chunk) {
-    if (_size_available >= _size_target) {
+    // chunks of the arena are always retained
+    if (_size_available >= _size_target && !chunk->borrowed()) {
         _size_total -= _chunk_size;
         return;
     }
@@ -115,8 +164,10 @@ chunk_cache::chunk_ptr chunk_cache::pop_or_allocate() {
         _chunks.pop_front();
         _size_available -= _chunk_size;
         c->reset();
+        _hits++;
         return c;
     }
+    _misses++;
     if (_size_total < _size_limit) {
         auto c = ss::make_lw_shared<chunk>(_chunk_size, alignment);
         _size_total += _chunk_size;
@@ -125,6 +176,35 @@ chunk_cache::chunk_ptr chunk_cache::pop_or_allocate() {
     return nullptr;
 }
 
+chunk_cache::stats chunk_cache::get_stats() const {
+    return {
+      .available_bytes = _size_available,
+      .total_bytes = _size_total,
+      .hits = _hits,
+      .misses = _misses,
+    };
+}
+
+void chunk_cache::set_size_target(std::optional<size_t> target) {
+    _size_target = std::clamp(
+      target.value_or(memory_groups().chunk_cache_min_memory()),
+      _chunk_size,
+      _size_limit);
+    // free chunks beyond the new target are released right away, retained
+    // chunks in use are released when they are returned to the cache
+    for (auto n = _chunks.size(); n > 0 && _size_available > _size_target;
+         --n) {
+        auto c = std::move(_chunks.front());
+        _chunks.pop_front();
+        if (c->borrowed()) {
+            _chunks.push_back(std::move(c));
+            continue;
+        }
+        _size_available -= _chunk_size;
+        _size_total -= _chunk_size;
+    }
+}
+
 chunk_cache& chunks() {
     static thread_local chunk_cache cache;
     return cache;
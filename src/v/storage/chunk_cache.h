@@ -15,10 +15,14 @@
 #include "ssx/semaphore.h"
 #include "storage/segment_appender_chunk.h"
 
+#include <seastar/core/aligned_buffer.hh>
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <memory>
+#include <optional>
+
 namespace storage::internal {
 
 class chunk_cache {
@@ -35,6 +39,10 @@ public:
      */
     static constexpr const alignment alignment{4_KiB};
 
+    /// Alignment of the reserved arena, such that it can be backed by huge
+    /// pages.
+    static constexpr size_t arena_alignment = 2_MiB;
+
     chunk_cache() noexcept;
     chunk_cache(chunk_cache&&) = delete;
     chunk_cache& operator=(chunk_cache&&) = delete;
@@ -51,23 +59,54 @@ public:
 
     size_t chunk_size() const { return _chunk_size; }
 
+    struct stats {
+        /// Memory held by free chunks, in bytes
+        size_t available_bytes{0};
+        /// Memory held by chunks in any state, in bytes
+        size_t total_bytes{0};
+        /// Number of chunks handed out from the free list
+        uint64_t hits{0};
+        /// Number of chunks that had to be allocated or waited for
+        uint64_t misses{0};
+    };
+
+    stats get_stats() const;
+
+    /**
+     * Set how much memory is retained by free chunks. The target is bounded
+     * by the chunk size and the chunk cache memory limit. With std::nullopt
+     * the target reverts to the chunk cache memory group minimum.
+     */
+    void set_size_target(std::optional<size_t>);
+
+    /// Largest memory that free chunks may be allowed to retain
+    size_t size_limit() const { return _size_limit; }
+
 private:
     ss::future<chunk_ptr> do_get();
     void setup_metrics();
     ss::future<chunk_cache::chunk_ptr> wait_and_get();
 
     chunk_ptr pop_or_allocate();
+    ss::future<> reserve_arena(size_t num_chunks);
+
+    // Memory of the chunks reserved at startup if append_chunk_arena_enabled
+    // is set. Declared before the chunks so that it outlives them.
+    std::unique_ptr<char[], ss::free_deleter> _arena;
+    size_t _arena_size{0};
 
     ss::chunked_fifo<chunk_ptr> _chunks;
     ssx::semaphore _sem{0, "s/chunk-cache"};
     size_t _size_available{0};
     size_t _size_total{0};
-    const size_t _size_target;
+    size_t _size_target;
     const size_t _size_limit;
 
     const size_t _chunk_size{0};
 
     size_t _wait_for_chunk_count{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
     metrics::internal_metric_groups _metrics;
 };
 
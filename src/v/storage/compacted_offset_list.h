@@ -35,6 +35,8 @@ public:
 
     bool contains(model::offset) const;
     void add(model::offset);
+    /// Number of offsets to keep in [first, last]
+    uint64_t count(model::offset first, model::offset last) const;
 
 private:
     model::offset _base;
@@ -61,4 +63,16 @@ inline bool compacted_offset_list::contains(model::offset o) const {
     return _to_keep.contains(x);
 }
 
+inline uint64_t compacted_offset_list::count(
+  model::offset first, model::offset last) const {
+    if (last < _base || last < first) {
+        return 0;
+    }
+    const auto rank = [this](model::offset o) {
+        return _to_keep.rank(static_cast<uint32_t>((o - _base)()));
+    };
+    const uint64_t below = first > _base ? rank(first - model::offset(1)) : 0;
+    return rank(last) - below;
+}
+
 } // namespace storage::internal
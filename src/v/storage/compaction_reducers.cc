@@ -15,6 +15,7 @@
 #include "model/record_batch_types.h"
 #include "model/record_utils.h"
 #include "random/generators.h"
+#include "ssx/task_slice.h"
 #include "storage/index_state.h"
 #include "storage/logger.h"
 #include "storage/parser_utils.h"
@@ -34,6 +35,7 @@ namespace storage::internal {
 ss::future<ss::stop_iteration>
 compaction_key_reducer::operator()(compacted_index::entry&& e) {
     using stop_t = ss::stop_iteration;
+    ssx::task_slice slice("compaction_key_index");
     const model::offset o = e.offset + model::offset(e.delta);
 
     auto [begin, end] = _indices.equal_range(_hasher(e.key));
@@ -118,17 +120,6 @@ compacted_offset_list_reducer::operator()(compacted_index::entry&& e) {
     return ss::make_ready_future<stop_t>(stop_t::no);
 }
 
-ss::future<> copy_data_segment_reducer::maybe_keep_offset(
-  const model::record_batch& batch,
-  const model::record& r,
-  bool is_last_record_in_batch,
-  std::vector<int32_t>& offset_deltas) {
-    if (co_await _should_keep_fn(batch, r, is_last_record_in_batch)) {
-        offset_deltas.push_back(r.offset_delta());
-        co_return;
-    }
-}
-
 model::record_batch copy_data_segment_reducer::make_placeholder_batch(
   model::record_batch_header& hdr) {
     model::record_batch_header new_hdr;
@@ -151,19 +142,25 @@ copy_data_segment_reducer::filter(model::record_batch batch) {
         co_return std::move(batch);
     }
 
-    // 1. compute which records to keep
-    std::vector<int32_t> offset_deltas;
-    offset_deltas.reserve(batch.record_count());
-
+    // 1. compute which records to keep, in a single pass over the records.
+    // The kept records share the buffers of the batch, so the batch can be
+    // rebuilt from them without parsing it again. The keep decision usually
+    // resolves immediately, awaiting it in the loop avoids a coroutine frame
+    // per record.
+    std::vector<model::record> kept;
+    kept.reserve(batch.record_count());
     int32_t records_seen = 0;
-    co_await batch.for_each_record_async(
-      [this, &batch, &offset_deltas, &records_seen](const model::record& r) {
-          records_seen++;
-          return maybe_keep_offset(
-            batch, r, batch.record_count() == records_seen, offset_deltas);
-      });
-
-    if (batch.last_offset() == _segment_last_offset && offset_deltas.empty()) {
+    auto it = model::record_batch_iterator::create(batch);
+    while (it.has_next()) {
+        auto r = it.next();
+        records_seen++;
+        if (co_await _should_keep_fn(
+              batch, r, batch.record_count() == records_seen)) {
+            kept.push_back(std::move(r));
+        }
+    }
+
+    if (batch.last_offset() == _segment_last_offset && kept.empty()) {
         // last batch in the segment has been compacted away.
         // This is most likely caused by aborted data batches getting compacted
         // away during self compaction of the segment if they are the last batch
@@ -179,45 +176,32 @@ copy_data_segment_reducer::filter(model::record_batch batch) {
     }
 
     // 2. no record to keep
-    if (offset_deltas.empty()) {
+    if (kept.empty()) {
         co_return std::nullopt;
     }
 
     // 3. keep all records
-    if (offset_deltas.size() == static_cast<size_t>(batch.record_count())) {
+    if (kept.size() == static_cast<size_t>(batch.record_count())) {
         co_return std::move(batch);
     }
 
-    // 4. filter
+    // 4. filter, the kept records fit in the size of the original records
     iobuf ret;
-    int32_t rec_count = 0;
-    std::optional<int64_t> first_timestamp_delta;
-    int64_t last_timestamp_delta;
-    batch.for_each_record([&rec_count,
-                           &first_timestamp_delta,
-                           &last_timestamp_delta,
-                           &ret,
-                           &offset_deltas](model::record record) {
-        // contains the key
-        if (std::count(
-              offset_deltas.begin(),
-              offset_deltas.end(),
-              record.offset_delta())) {
-            /*
-             * TODO when we further optimize lazy record materialization ot
-             * make use of views we can avoid this re-encoding by copying or
-             * sharing the view. either way, we were building
-             * record batch with the uncompressed records so they were being
-             * re-encoded.
-             */
-            if (!first_timestamp_delta) {
-                first_timestamp_delta = record.timestamp_delta();
-            }
-            last_timestamp_delta = record.timestamp_delta();
-            model::append_record_to_buffer(ret, record);
-            ++rec_count;
-        }
-    });
+    ret.reserve_memory(batch.data().size_bytes());
+    /*
+     * TODO when we further optimize lazy record materialization ot
+     * make use of views we can avoid this re-encoding by copying or
+     * sharing the view. either way, we were building
+     * record batch with the uncompressed records so they were being
+     * re-encoded.
+     */
+    for (const auto& record : kept) {
+        model::append_record_to_buffer(ret, record);
+    }
+    const auto rec_count = static_cast<int32_t>(kept.size());
+    std::optional<int64_t> first_timestamp_delta
+      = kept.front().timestamp_delta();
+    int64_t last_timestamp_delta = kept.back().timestamp_delta();
     // From: DefaultRecordBatch.java
     // On Compaction: Unlike the older message formats, magic v2 and above
     // preserves the first and last offset/sequence numbers from the
@@ -306,6 +290,51 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
           });
     }
     auto batch = co_await compress_batch(original, std::move(to_copy.value()));
+    co_await append(batch, compactible_batch);
+    co_return stop_t::no;
+}
+
+ss::future<> copy_data_segment_reducer::index_copied_record(
+  const model::record_batch_header& hdr, const model::record& r) {
+    if (_track_copied_tombstones && r.is_tombstone()) {
+        ++_stats.tombstones_copied;
+    }
+    if (_compacted_idx) {
+        co_await _compacted_idx->index(
+          hdr.type,
+          hdr.attrs.is_control(),
+          r.key(),
+          hdr.base_offset,
+          r.offset_delta());
+    }
+}
+
+ss::future<ss::stop_iteration>
+copy_data_segment_reducer::copy(model::record_batch b) {
+    ++_stats.batches_processed;
+    ++_stats.batches_copied;
+    // the records are only read if they have to be indexed or checked for
+    // tombstones, and then one at a time
+    if (_compacted_idx || _track_copied_tombstones) {
+        if (b.compressed()) {
+            decompressing_record_cursor cursor(b);
+            while (cursor.has_next()) {
+                auto r = cursor.next();
+                co_await index_copied_record(b.header(), r);
+            }
+        } else {
+            co_await b.for_each_record_async(
+              [this, &b](const model::record& r) {
+                  return index_copied_record(b.header(), r);
+              });
+        }
+    }
+    co_await append(b, true);
+    co_return ss::stop_iteration::no;
+}
+
+ss::future<> copy_data_segment_reducer::append(
+  const model::record_batch& batch, bool compactible_batch) {
     const auto start_pos = _appender->file_byte_offset();
     const auto header_size = batch.header().size_bytes;
     _acc += header_size;
@@ -331,8 +360,6 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
       "Size must be deterministic. Expected:{} == {}",
       _appender->file_byte_offset(),
       start_pos + header_size);
-
-    co_return stop_t::no;
 }
 
 ss::future<ss::stop_iteration>
@@ -343,6 +370,9 @@ copy_data_segment_reducer::operator()(model::record_batch b) {
     if (_as) {
         _as->check();
     }
+    if (_keep_batch_fn && is_compactible(b) && _keep_batch_fn(b.header())) {
+        co_return co_await copy(std::move(b));
+    }
     const auto comp = b.header().attrs.compression();
     if (!b.compressed()) {
         co_return co_await filter_and_append(comp, std::move(b));
@@ -359,14 +389,25 @@ index_rebuilder_reducer::operator()(model::record_batch&& b) {
     if (!b.compressed()) {
         f = do_index(std::move(b));
     } else {
-        f = internal::decompress_batch(std::move(b))
-              .then([this](model::record_batch&& b) {
-                  return do_index(std::move(b));
-              });
+        f = do_index_compressed(std::move(b));
     }
     return f.then([] { return ss::make_ready_future<stop_t>(stop_t::no); });
 }
 
+ss::future<>
+index_rebuilder_reducer::do_index_compressed(model::record_batch b) {
+    // only keys are indexed, decompress one record at a time rather than the
+    // whole batch
+    const auto bt = b.header().type;
+    const auto ctrl = b.header().attrs.is_control();
+    const auto o = b.base_offset();
+    internal::decompressing_record_cursor cursor(b);
+    while (cursor.has_next()) {
+        auto r = cursor.next();
+        co_await _w->index(bt, ctrl, r.key(), o, r.offset_delta());
+    }
+}
+
 ss::future<> index_rebuilder_reducer::do_index(model::record_batch&& b) {
     return ss::do_with(std::move(b), [this](model::record_batch& b) {
         return model::for_each_record(
@@ -121,6 +121,11 @@ class copy_data_segment_reducer : public compaction_reducer {
 public:
     using filter_t = ss::noncopyable_function<ss::future<bool>(
       const model::record_batch&, const model::record&, bool)>;
+    // Returns true if every record of the batch is known to be retained,
+    // e.g. from the compacted index, without looking at the records. Such
+    // batches are copied as they are, without being filtered nor recompressed.
+    using batch_filter_t
+      = ss::noncopyable_function<bool(const model::record_batch_header&)>;
     struct stats {
         // Total number of batches passed to this reducer.
         size_t batches_processed{0};
@@ -132,6 +137,12 @@ public:
         // Number of batches that were ignored because they are not
         // of a compactible type.
         size_t non_compactible_batches{0};
+        // Number of compactible batches that were copied without being
+        // filtered.
+        size_t batches_copied{0};
+        // Number of tombstones in the batches that were copied without being
+        // filtered. Only counted if tombstones are tracked.
+        size_t tombstones_copied{0};
 
         // Returns whether any data was removed by this reducer.
         bool has_removed_data() const {
@@ -142,11 +153,13 @@ public:
             fmt::print(
               os,
               "{{ batches_processed: {}, batches_discarded: {}, "
-              "records_discarded: {}, non_compactible_batches: {} }}",
+              "records_discarded: {}, non_compactible_batches: {}, "
+              "batches_copied: {} }}",
               s.batches_processed,
               s.batches_discarded,
               s.records_discarded,
-              s.non_compactible_batches);
+              s.non_compactible_batches,
+              s.batches_copied);
             return os;
         }
     };
@@ -163,8 +176,12 @@ public:
       model::offset segment_last_offset,
       compacted_index_writer* cidx = nullptr,
       bool inject_failure = false,
-      ss::abort_source* as = nullptr)
+      ss::abort_source* as = nullptr,
+      batch_filter_t keep_batch_fn = {},
+      bool track_copied_tombstones = true)
       : _should_keep_fn(std::move(f))
+      , _keep_batch_fn(std::move(keep_batch_fn))
+      , _track_copied_tombstones(track_copied_tombstones)
       , _segment_last_offset(segment_last_offset)
       , _appender(a)
       , _compacted_idx(cidx)
@@ -180,18 +197,24 @@ private:
     ss::future<ss::stop_iteration>
       filter_and_append(model::compression, model::record_batch);
 
-    ss::future<> maybe_keep_offset(
-      const model::record_batch&,
-      const model::record&,
-      bool,
-      std::vector<int32_t>&);
-
     ss::future<std::optional<model::record_batch>> filter(model::record_batch);
 
+    // Appends a batch from which no record is removed as it is
+    ss::future<ss::stop_iteration> copy(model::record_batch);
+
+    ss::future<> index_copied_record(
+      const model::record_batch_header&, const model::record&);
+
+    ss::future<> append(const model::record_batch&, bool compactible);
+
     // Creates a placeholder batch with same offset range as the input header.
     model::record_batch make_placeholder_batch(model::record_batch_header&);
 
     filter_t _should_keep_fn;
+    batch_filter_t _keep_batch_fn;
+    // Whether the records of the copied batches have to be read to count
+    // their tombstones.
+    bool _track_copied_tombstones;
 
     // Offset to keep in case the index is empty as of getting to this offset.
     model::offset _segment_last_offset;
@@ -227,6 +250,7 @@ public:
 
 private:
     ss::future<> do_index(model::record_batch&&);
+    ss::future<> do_index_compressed(model::record_batch);
 
     compacted_index_writer* _w;
 };
@@ -20,6 +20,7 @@
 #include "model/timestamp.h"
 #include "reflection/adl.h"
 #include "ssx/future-util.h"
+#include "ssx/semaphore.h"
 #include "storage/api.h"
 #include "storage/chunk_cache.h"
 #include "storage/compacted_offset_list.h"
@@ -38,6 +39,7 @@
 #include "storage/segment_deduplication_utils.h"
 #include "storage/segment_set.h"
 #include "storage/segment_utils.h"
+#include "storage/spilling_key_offset_map.h"
 #include "storage/types.h"
 #include "storage/version.h"
 #include "utils/human.h"
@@ -58,6 +60,7 @@
 #include <fmt/format.h>
 #include <roaring/roaring.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <iterator>
@@ -134,7 +137,8 @@ disk_log_impl::disk_log_impl(
       group,
       config().ntp(),
       _kvstore,
-      resources())
+      resources(),
+      _feature_table)
   , _probe(std::make_unique<storage::probe>())
   , _max_segment_size(compute_max_segment_size())
   , _readers_cache(std::make_unique<readers_cache>(
@@ -156,7 +160,9 @@ disk_log_impl::~disk_log_impl() {
 }
 
 size_t disk_log_impl::compute_max_segment_size() {
-    auto segment_size = std::min(max_segment_size(), segment_size_hard_limit);
+    auto segment_size = std::min(
+      adaptive_segment_size().value_or(max_segment_size()),
+      segment_size_hard_limit);
     return segment_size * (1 + _segment_size_jitter);
 }
 
@@ -634,6 +640,19 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
       segs.front()->filename(),
       segs.back()->filename());
 
+    if (cfg.spill_key_map_memory.has_value()) {
+        // The spilling map indexes every key in the range, so the whole
+        // sliding range is de-duplicated in a single pass.
+        spilling_key_offset_map spilling_map(
+          std::filesystem::path(config().work_directory()),
+          cfg.spill_key_map_memory.value(),
+          cfg);
+        auto fut = co_await ss::coroutine::as_future(
+          sliding_window_deduplicate(cfg, segs, spilling_map));
+        co_await spilling_map.close();
+        co_return co_await std::move(fut);
+    }
+
     // TODO: add configuration to use simple_key_offset_map.
     std::unique_ptr<simple_key_offset_map> simple_map;
     if (cfg.hash_key_map) {
@@ -645,10 +664,24 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
     key_offset_map& map = cfg.hash_key_map
                             ? dynamic_cast<key_offset_map&>(*cfg.hash_key_map)
                             : dynamic_cast<key_offset_map&>(*simple_map);
+    co_return co_await sliding_window_deduplicate(cfg, segs, map);
+}
+
+ss::future<bool> disk_log_impl::sliding_window_deduplicate(
+  const compaction_config& cfg, segment_set& segs, key_offset_map& map) {
     model::offset idx_start_offset;
+    // Saves reading the compacted index of the fully indexed segments a
+    // second time when they are deduplicated
+    retained_records_cache retained_cache;
     try {
         idx_start_offset = co_await build_offset_map(
-          cfg, segs, _stm_manager, _manager.resources(), *_probe, map);
+          cfg,
+          segs,
+          _stm_manager,
+          _manager.resources(),
+          *_probe,
+          map,
+          &retained_cache);
     } catch (...) {
         auto eptr = std::current_exception();
         if (ssx::is_shutdown_exception(eptr)) {
@@ -775,7 +808,9 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
               compacted_idx_writer,
               *_probe,
               storage::internal::should_apply_delta_time_offset(_feature_table),
-              _feature_table);
+              _feature_table,
+              /*inject_reader_failure=*/false,
+              &retained_cache);
 
         } catch (...) {
             eptr = std::current_exception();
@@ -1524,6 +1559,7 @@ offset_stats disk_log_impl::offsets() const {
         if (ret.start_offset > model::offset(0)) {
             ret.dirty_offset = ret.start_offset - model::offset(1);
             ret.committed_offset = ret.dirty_offset;
+            ret.stable_offset = ret.dirty_offset;
         }
         return ret;
     }
@@ -1543,6 +1579,7 @@ offset_stats disk_log_impl::offsets() const {
         if (ret.start_offset > model::offset(0)) {
             ret.dirty_offset = ret.start_offset - model::offset(1);
             ret.committed_offset = ret.dirty_offset;
+            ret.stable_offset = ret.dirty_offset;
         }
         return ret;
     }
@@ -1561,6 +1598,8 @@ offset_stats disk_log_impl::offsets() const {
 
       .dirty_offset = eof.get_dirty_offset(),
       .dirty_offset_term = eof.get_term(),
+
+      .stable_offset = eof.get_stable_offset(),
     };
 }
 
@@ -1615,6 +1654,7 @@ ss::future<> disk_log_impl::new_segment(
       o() >= 0 && t() >= 0, "offset:{} and term:{} must be initialized", o, t);
     // Recomputing here means that any roll size checks after this takes into
     // account updated segment size.
+    sample_ingest_rate();
     _max_segment_size = compute_max_segment_size();
     return _manager
       .make_log_segment(
@@ -1707,6 +1747,58 @@ size_t disk_log_impl::max_segment_size() const {
     return result;
 }
 
+std::optional<size_t> disk_log_impl::adaptive_segment_size() const {
+    auto target_count = config::shard_local_cfg().log_segment_target_count();
+    if (
+      !target_count || *target_count == 0 || config().is_compacted()
+      || (config().has_overrides() && config().get_overrides().segment_size)) {
+        return std::nullopt;
+    }
+
+    auto gc = apply_overrides(_manager.default_gc_config());
+    std::optional<size_t> retained_bytes = gc.max_bytes;
+    // time based retention is translated into bytes with the ingest rate
+    const auto now = model::timestamp::now();
+    if (gc.eviction_time > model::timestamp(0) && _ingest_rate.get() > 0) {
+        const auto retention_s = static_cast<double>(
+                                   now.value() - gc.eviction_time.value())
+                                 / 1000.0;
+        const auto bytes = static_cast<size_t>(
+          _ingest_rate.get() * retention_s);
+        retained_bytes = std::min(retained_bytes.value_or(bytes), bytes);
+    }
+    if (!retained_bytes) {
+        return std::nullopt;
+    }
+
+    const size_t min_limit
+      = config::shard_local_cfg().log_segment_size_min().value_or(1_MiB);
+    const size_t max_limit
+      = config::shard_local_cfg().log_segment_size_max().value_or(
+        segment_size_hard_limit);
+    return std::clamp(
+      *retained_bytes / *target_count, min_limit, std::max(min_limit, max_limit));
+}
+
+void disk_log_impl::sample_ingest_rate() {
+    if (_segs.empty()) {
+        return;
+    }
+    auto& last = _segs.back();
+    auto first_write = last->first_write_ts();
+    if (!first_write) {
+        return;
+    }
+    const auto elapsed = std::chrono::duration<double>(
+      ss::lowres_clock::now() - *first_write);
+    // too short to tell apart from a burst
+    if (elapsed < 1s) {
+        return;
+    }
+    _ingest_rate.update(
+      static_cast<double>(last->size_bytes()) / elapsed.count());
+}
+
 uint64_t disk_log_impl::size_bytes_after_offset(model::offset o) const {
     if (_segs.empty()) {
         return 0;
@@ -2614,52 +2706,51 @@ bool keep_segment_after_prefix_truncate(
 } // namespace
 ss::future<>
 disk_log_impl::remove_prefix_full_segments(truncate_prefix_config cfg) {
-    return ss::do_until(
-      [this, cfg] {
-          // base_offset check is for the case of an empty segment
-          // (where dirty = base - 1). We don't want to remove it because
-          // batches may be concurrently appended to it and we should keep them.
-          return _segs.empty()
-                 || keep_segment_after_prefix_truncate(
-                   _segs.front(), cfg.start_offset);
-      },
-      [this, prefix_truncate_offset = cfg.start_offset] {
-          // it is safe to capture the front segment pointer here. This
-          // operation is executed under the segment_rewrite_lock, we are
-          // guaranteed that no other operation will remove the segment from the
-          // segment list head (front).
-          auto ptr = _segs.front();
-          return _readers_cache->evict_segment_readers(ptr).then(
-            [this, ptr, prefix_truncate_offset](
-              readers_cache::range_lock_holder cache_lock) {
-                return ptr->write_lock().then(
-                  [this,
-                   ptr,
-                   prefix_truncate_offset,
-                   cache_lock = std::move(cache_lock)](
-                    ss::rwlock::holder lock_holder) {
-                      // after the lock is acquired, check if the segment is
-                      // still eligible for deletion as there might have been
-                      // concurrent appends. If segments collection is empty we
-                      // can skip prefix truncation as the segments were removed
-                      if (
-                        keep_segment_after_prefix_truncate(
-                          ptr, prefix_truncate_offset)
-                        || _segs.empty()) {
-                          return ss::make_ready_future<>();
-                      }
-                      _segs.pop_front();
-                      _probe->add_bytes_prefix_truncated(ptr->file_size());
-                      // first call the remove segments, then release the lock
-                      // before waiting for future to finish
-                      auto f = remove_segment_permanently(
-                        ptr, "remove_prefix_full_segments");
-                      lock_holder.return_all();
-
-                      return f;
-                  });
-            });
-      });
+    // Closing and unlinking a segment is dominated by I/O latency. After a
+    // retention change a single prefix truncation can drop many segments, so
+    // a bounded number of removals is kept in flight instead of waiting for
+    // each of them before detaching the next segment.
+    static constexpr size_t max_concurrent_removals = 8;
+    ssx::semaphore removal_slots{
+      max_concurrent_removals, "s/prefix-truncate-removals"};
+    std::vector<ss::future<>> removals;
+    // base_offset check is for the case of an empty segment
+    // (where dirty = base - 1). We don't want to remove it because
+    // batches may be concurrently appended to it and we should keep them.
+    while (!_segs.empty()
+           && !keep_segment_after_prefix_truncate(
+             _segs.front(), cfg.start_offset)) {
+        auto slot = co_await ss::get_units(removal_slots, 1);
+        if (_segs.empty()) {
+            break;
+        }
+        // it is safe to capture the front segment pointer here. This
+        // operation is executed under the segment_rewrite_lock, we are
+        // guaranteed that no other operation will remove the segment from the
+        // segment list head (front).
+        auto ptr = _segs.front();
+        auto cache_lock = co_await _readers_cache->evict_segment_readers(ptr);
+        auto lock_holder = co_await ptr->write_lock();
+        // after the lock is acquired, check if the segment is still eligible
+        // for deletion as there might have been concurrent appends. If
+        // segments collection is empty we can skip prefix truncation as the
+        // segments were removed
+        if (
+          keep_segment_after_prefix_truncate(ptr, cfg.start_offset)
+          || _segs.empty()) {
+            break;
+        }
+        _segs.pop_front();
+        _probe->add_bytes_prefix_truncated(ptr->file_size());
+        // first call the remove segments, then release the lock before
+        // waiting for future to finish
+        removals.push_back(
+          remove_segment_permanently(ptr, "remove_prefix_full_segments")
+            .finally([slot = std::move(slot)] {}));
+        lock_holder.return_all();
+    }
+    // removal failures are logged by remove_segment_permanently
+    co_await ss::when_all(removals.begin(), removals.end());
 }
 
 ss::future<> disk_log_impl::truncate_prefix(truncate_prefix_config cfg) {
@@ -3078,6 +3169,16 @@ int64_t compaction_backlog_term(
  *  backlog = sum(n=1,cnt) [sum(k=0, cnt - n + 1)][cf^k * sizeof(sn)] -
  *  cf^(cnt-1) * s1
  */
+int64_t disk_log_impl::compaction_reclaimable_bytes() const {
+    auto backlog = compaction_backlog();
+    if (backlog == 0) {
+        return 0;
+    }
+    // The ratio is the size of the compacted data relative to its input
+    auto ratio = std::clamp(_compaction_ratio.get(), 0.0, 1.0);
+    return static_cast<int64_t>(static_cast<double>(backlog) * (1.0 - ratio));
+}
+
 int64_t disk_log_impl::compaction_backlog() const {
     if (!config().is_compacted() || _segs.empty()) {
         return 0;
@@ -3832,11 +3933,13 @@ ss::future<> disk_log_impl::copy_kvstore_state(
       ks, internal::start_offset_key(ntp));
     std::optional<iobuf> clean_segment = source_kvs.get(
       ks, internal::clean_segment_key(ntp));
+    std::optional<iobuf> manifest = source_kvs.get(
+      ks, internal::segment_manifest_key(ntp));
 
     co_await storage.invoke_on(target_shard, [&](storage::api& api) {
         const auto ks = kvstore::key_space::storage;
         std::vector<ss::future<>> write_futures;
-        write_futures.reserve(2);
+        write_futures.reserve(3);
         if (start_offset) {
             write_futures.push_back(api.kvs().put(
               ks, internal::start_offset_key(ntp), start_offset->copy()));
@@ -3845,6 +3948,10 @@ ss::future<> disk_log_impl::copy_kvstore_state(
             write_futures.push_back(api.kvs().put(
               ks, internal::clean_segment_key(ntp), clean_segment->copy()));
         }
+        if (manifest) {
+            write_futures.push_back(api.kvs().put(
+              ks, internal::segment_manifest_key(ntp), manifest->copy()));
+        }
         return ss::when_all_succeed(std::move(write_futures));
     });
 }
@@ -3854,7 +3961,8 @@ ss::future<> disk_log_impl::remove_kvstore_state(
     const auto ks = kvstore::key_space::storage;
     return ss::when_all_succeed(
              kvs.remove(ks, internal::start_offset_key(ntp)),
-             kvs.remove(ks, internal::clean_segment_key(ntp)))
+             kvs.remove(ks, internal::clean_segment_key(ntp)),
+             kvs.remove(ks, internal::segment_manifest_key(ntp)))
       .discard_result();
 }
 
@@ -160,6 +160,7 @@ public:
     bool notify_compaction_update() final;
 
     int64_t compaction_backlog() const final;
+    int64_t compaction_reclaimable_bytes() const final;
 
     ss::future<usage_report> disk_usage(gc_config) override;
 
@@ -233,6 +234,11 @@ public:
       const compaction_config& cfg,
       std::optional<model::offset> new_start_offset = std::nullopt);
 
+    // Builds the key offset map for the segments of the sliding range and
+    // de-duplicates them with it. Returns true if any segment was rewritten.
+    ss::future<bool> sliding_window_deduplicate(
+      const compaction_config& cfg, segment_set& segs, key_offset_map& map);
+
     const auto& compaction_ratio() const { return _compaction_ratio; }
 
     static ss::future<> copy_kvstore_state(
@@ -382,6 +388,14 @@ private:
     // configuration. This takes into consideration any segment size
     // overrides since the last time it was called.
     size_t compute_max_segment_size();
+    // With log_segment_target_count set, the segment size that spreads the
+    // partition's retained data over that many segments. std::nullopt when
+    // adaptive sizing doesn't apply (disabled, explicit segment.bytes,
+    // compacted topic or no retention bound known yet).
+    std::optional<size_t> adaptive_segment_size() const;
+    // Folds the ingest rate of the active segment into _ingest_rate, called
+    // when rolling.
+    void sample_ingest_rate();
     struct eviction_monitor {
         ss::promise<model::offset> promise;
         ss::abort_source::subscription subscription;
@@ -391,6 +405,8 @@ private:
     ss::gate _compaction_housekeeping_gate;
     log_manager& _manager;
     float _segment_size_jitter;
+    // bytes per second appended to recently rolled segments
+    moving_average<double, 5> _ingest_rate{0};
     segment_set _segs;
     kvstore& _kvstore;
     ss::sharded<features::feature_table>& _feature_table;
@@ -28,6 +28,8 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
+
 namespace storage {
 
 uint32_t index_columns::get_relative_offset_index(int ix) const noexcept {
@@ -42,43 +44,101 @@ uint64_t index_columns::get_position_index(int ix) const noexcept {
     return _position_index[ix];
 }
 
-std::optional<int>
-index_columns::offset_lower_bound(uint32_t needle) const noexcept {
-    auto it = std::lower_bound(
-      std::begin(_relative_offset_index),
-      std::end(_relative_offset_index),
-      needle,
-      std::less<uint32_t>());
-    if (it == std::end(_relative_offset_index)) {
+namespace {
+
+/*
+ * Searches narrow the range with a branchless binary search until at most
+ * this many elements are left, and then count the matching elements of the
+ * window. The counting loop has no data dependent branches so the compiler
+ * vectorizes it (SSE/AVX2 on x86-64, NEON on aarch64), and a window of this
+ * size spans only a few cache lines.
+ */
+constexpr size_t linear_search_window = 32;
+
+/*
+ * Returns the index of the first element of the sorted range [base, base + n)
+ * for which `pred` is false, like std::partition_point.
+ */
+template<typename T, typename Pred>
+size_t contiguous_partition_point(const T* base, size_t n, Pred pred) {
+    const T* const start = base;
+    while (n > linear_search_window) {
+        const size_t half = n / 2;
+        // compiles to a conditional move rather than a branch
+        base = pred(base[half]) ? base + half : base;
+        n -= half;
+    }
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+        count += pred(base[i]) ? 1 : 0;
+    }
+    return (base - start) + count;
+}
+
+/*
+ * std::partition_point over a chunked_vector. Going through the vector's
+ * iterators resolves the fragment of every element that is probed. Instead,
+ * first find the fragment containing the partition point using the last
+ * element of each fragment, and then search that fragment's contiguous
+ * storage directly.
+ */
+template<typename T, typename Pred>
+size_t partition_point(const chunked_vector<T>& v, Pred pred) {
+    constexpr size_t elems_per_frag = chunked_vector<T>::elements_per_fragment();
+    const size_t size = v.size();
+    const size_t frags = (size + elems_per_frag - 1) / elems_per_frag;
+    size_t lo = 0;
+    size_t hi = frags;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const size_t last = std::min((mid + 1) * elems_per_frag, size) - 1;
+        if (pred(v[last])) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == frags) {
+        return size;
+    }
+    const size_t first = lo * elems_per_frag;
+    return first
+           + contiguous_partition_point(
+             &v[first], std::min(elems_per_frag, size - first), pred);
+}
+
+template<typename T>
+std::optional<int> to_optional_index(const chunked_vector<T>& v, size_t ix) {
+    if (ix == v.size()) {
         return std::nullopt;
     }
-    return std::distance(std::begin(_relative_offset_index), it);
+    return static_cast<int>(ix);
+}
+
+} // namespace
+
+std::optional<int>
+index_columns::offset_lower_bound(uint32_t needle) const noexcept {
+    return to_optional_index(
+      _relative_offset_index,
+      partition_point(
+        _relative_offset_index, [needle](uint32_t v) { return v < needle; }));
 }
 
 std::optional<int>
 index_columns::position_upper_bound(uint64_t needle) const noexcept {
-    auto it = std::upper_bound(
-      std::begin(_position_index),
-      std::end(_position_index),
-      needle,
-      std::less<uint64_t>());
-    if (it == std::end(_position_index)) {
-        return std::nullopt;
-    }
-    return std::distance(std::begin(_position_index), it);
+    return to_optional_index(
+      _position_index,
+      partition_point(
+        _position_index, [needle](uint64_t v) { return v <= needle; }));
 }
 
 std::optional<int>
 index_columns::time_lower_bound(uint32_t needle) const noexcept {
-    auto it = std::lower_bound(
-      std::begin(_relative_time_index),
-      std::end(_relative_time_index),
-      needle,
-      std::less<uint32_t>());
-    if (it == std::end(_relative_time_index)) {
-        return std::nullopt;
-    }
-    return std::distance(std::begin(_relative_time_index), it);
+    return to_optional_index(
+      _relative_time_index,
+      partition_point(
+        _relative_time_index, [needle](uint32_t v) { return v < needle; }));
 }
 
 bool index_columns::try_reset_relative_time_index(uint32_t t) {
@@ -10,6 +10,8 @@
  */
 #include "storage/key_offset_map.h"
 
+#include <seastar/util/variant_utils.hh>
+
 namespace storage {
 
 simple_key_offset_map::simple_key_offset_map(std::optional<size_t> max_keys)
@@ -49,18 +51,43 @@ model::offset simple_key_offset_map::max_offset() const { return _max_offset; }
 size_t simple_key_offset_map::size() const { return _map.size(); }
 size_t simple_key_offset_map::capacity() const { return _max_keys; }
 
+hash_key_offset_map::hash_key_offset_map(model::compaction_key_digest digest)
+  : digest_(digest) {
+    switch (digest_) {
+    case model::compaction_key_digest::sha256:
+        entries_.emplace<chunked_vector<sha256_entry>>();
+        break;
+    case model::compaction_key_digest::xxhash3:
+        entries_.emplace<chunked_vector<xxhash_entry>>();
+        break;
+    }
+}
+
 seastar::future<std::optional<model::offset>>
 hash_key_offset_map::get(const compaction_key& key) const {
-    const auto hash = hash_key(key);
+    auto value = ss::visit(
+      entries_,
+      [this, &key](const chunked_vector<sha256_entry>& entries) {
+          return do_get(entries, hash_key_sha256(key));
+      },
+      [this, &key](const chunked_vector<xxhash_entry>& entries) {
+          return do_get(entries, hash_key_xxhash(key));
+      });
+    return seastar::make_ready_future<std::optional<model::offset>>(value);
+}
 
+template<typename Entry>
+std::optional<model::offset> hash_key_offset_map::do_get(
+  const chunked_vector<Entry>& entries,
+  const typename Entry::digest_type& hash) const {
     // handle a non-normalized probe position
     // (true, value) -> stop and return value
     // (false, _)    -> keep probing
     auto handle_entry =
       [&](size_t index) -> std::pair<bool, std::optional<model::offset>> {
         ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
+        index = index % entries.size();
+        const auto& entry = entries[index];
         if (entry.empty()) {
             return std::make_pair(true, std::nullopt);
         } else if (entry.digest == hash) {
@@ -72,13 +99,12 @@ hash_key_offset_map::get(const compaction_key& key) const {
     ++search_count_;
 
     // probe using the hash
-    probe probe(hash);
+    probe<typename Entry::digest_type> probe(hash);
     auto index = probe.next();
     while (index.has_value()) {
         const auto [stop, value] = handle_entry(index.value());
         if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
+            return value;
         }
         const auto next_index = probe.next();
         if (next_index.has_value()) {
@@ -90,22 +116,34 @@ hash_key_offset_map::get(const compaction_key& key) const {
 
     // fall back to linear probe
     const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
+    for (size_t probe = 0; probe < entries.size(); ++probe) {
         const auto [stop, value] = handle_entry(linear_base + probe);
         if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
+            return value;
         }
     }
 
-    return seastar::make_ready_future<std::optional<model::offset>>(
-      std::nullopt);
+    return std::nullopt;
 }
 
 seastar::future<bool>
 hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
-    const auto hash = hash_key(key);
+    auto inserted = ss::visit(
+      entries_,
+      [this, &key, offset](chunked_vector<sha256_entry>& entries) {
+          return do_put(entries, hash_key_sha256(key), offset);
+      },
+      [this, &key, offset](chunked_vector<xxhash_entry>& entries) {
+          return do_put(entries, hash_key_xxhash(key), offset);
+      });
+    return seastar::make_ready_future<bool>(inserted);
+}
 
+template<typename Entry>
+bool hash_key_offset_map::do_put(
+  chunked_vector<Entry>& entries,
+  const typename Entry::digest_type& hash,
+  model::offset offset) {
     const auto full = size_ >= capacity_;
 
     enum class handle {
@@ -117,8 +155,8 @@ hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
     // handle a non-normalized probe position
     auto handle_entry = [&](size_t index) {
         ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
+        index = index % entries.size();
+        auto& entry = entries[index];
         if (entry.empty()) {
             if (full) {
                 return handle::not_inserted_full;
@@ -141,15 +179,15 @@ hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
     ++search_count_;
 
     // probe using the hash
-    probe probe(hash);
+    probe<typename Entry::digest_type> probe(hash);
     auto index = probe.next();
     while (index.has_value()) {
         const auto res = handle_entry(index.value());
         if (res == handle::inserted) {
-            return seastar::make_ready_future<bool>(true);
+            return true;
         }
         if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
+            return false;
         }
         const auto next_index = probe.next();
         if (next_index.has_value()) {
@@ -161,17 +199,17 @@ hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
 
     // fall back to linear probe
     const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
+    for (size_t probe = 0; probe < entries.size(); ++probe) {
         const auto res = handle_entry(linear_base + probe);
         if (res == handle::inserted) {
-            return seastar::make_ready_future<bool>(true);
+            return true;
         }
         if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
+            return false;
         }
     }
 
-    return seastar::make_ready_future<bool>(false);
+    return false;
 }
 
 model::offset hash_key_offset_map::max_offset() const { return max_offset_; }
@@ -179,11 +217,26 @@ model::offset hash_key_offset_map::max_offset() const { return max_offset_; }
 size_t hash_key_offset_map::size() const { return size_; }
 size_t hash_key_offset_map::capacity() const { return capacity_; }
 
+size_t hash_key_offset_map::entry_size() const {
+    return ss::visit(
+      entries_,
+      [](const chunked_vector<sha256_entry>&) { return sizeof(sha256_entry); },
+      [](const chunked_vector<xxhash_entry>&) { return sizeof(xxhash_entry); });
+}
+
 seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
-    co_await fragmented_vector_clear_async(entries_);
-    while (entries_.memory_size() < size_bytes) {
-        for (size_t i = 0; i < entries_.elements_per_fragment(); ++i) {
-            entries_.push_back(entry{});
+    co_await ss::visit(entries_, [this, size_bytes](auto& entries) {
+        return do_initialize(entries, size_bytes);
+    });
+}
+
+template<typename Entry>
+seastar::future<> hash_key_offset_map::do_initialize(
+  chunked_vector<Entry>& entries, size_t size_bytes) {
+    co_await fragmented_vector_clear_async(entries);
+    while (entries.memory_size() < size_bytes) {
+        for (size_t i = 0; i < entries.elements_per_fragment(); ++i) {
+            entries.push_back(Entry{});
         }
         if (seastar::need_preempt()) {
             co_await seastar::maybe_yield();
@@ -191,11 +244,11 @@ seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
     }
     size_ = 0;
     max_offset_ = model::offset{};
-    if (entries_.size() > 0) {
+    if (entries.size() > 0) {
         capacity_ = std::max(
           size_t(1),
           static_cast<size_t>(
-            static_cast<double>(entries_.size()) * max_load_factor));
+            static_cast<double>(entries.size()) * max_load_factor));
     } else {
         capacity_ = 0;
     }
@@ -204,7 +257,10 @@ seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
 }
 
 seastar::future<> hash_key_offset_map::reset() {
-    co_await fragmented_vector_fill_async(entries_, entry{});
+    co_await ss::visit(entries_, [](auto& entries) {
+        using entry_type = typename std::decay_t<decltype(entries)>::value_type;
+        return fragmented_vector_fill_async(entries, entry_type{});
+    });
     size_ = 0;
     max_offset_ = model::offset{};
     search_count_ = 0;
@@ -219,16 +275,14 @@ double hash_key_offset_map::hit_rate() const {
            / static_cast<double>(probe_count_);
 }
 
-bool hash_key_offset_map::entry::empty() const {
-    return digest == hash_type::digest_type{};
-}
-
-hash_key_offset_map::probe::probe(const hash_type::digest_type& hash)
+template<typename DigestType>
+hash_key_offset_map::probe<DigestType>::probe(const DigestType& hash)
   : iter(hash.data())
-  , end(iter + hash_type::digest_size) {}
+  , end(iter + hash.size()) {}
 
-std::optional<hash_key_offset_map::probe::index_type>
-hash_key_offset_map::probe::next() {
+template<typename DigestType>
+std::optional<typename hash_key_offset_map::probe<DigestType>::index_type>
+hash_key_offset_map::probe<DigestType>::next() {
     if ((iter + sizeof(index_type)) > end) {
         return std::nullopt;
     }
@@ -242,8 +296,8 @@ hash_key_offset_map::probe::next() {
     return index;
 }
 
-hash_key_offset_map::hash_type::digest_type
-hash_key_offset_map::hash_key(const compaction_key& key) const {
+hash_sha256::digest_type
+hash_key_offset_map::hash_key_sha256(const compaction_key& key) const {
     try {
         hasher_.update(key);
         return hasher_.reset();
@@ -253,4 +307,15 @@ hash_key_offset_map::hash_key(const compaction_key& key) const {
     }
 }
 
+hash_key_offset_map::xxhash_entry::digest_type
+hash_key_offset_map::hash_key_xxhash(const compaction_key& key) {
+    XXH128_canonical_t canonical;
+    XXH128_canonicalFromHash(
+      &canonical,
+      xxhash_128(reinterpret_cast<const char*>(key.data()), key.size()));
+    xxhash_entry::digest_type digest;
+    std::memcpy(digest.data(), canonical.digest, digest.size());
+    return digest;
+}
+
 } // namespace storage
@@ -10,7 +10,9 @@
 
 #include "container/fragmented_vector.h"
 #include "hashing/secure.h"
+#include "hashing/xx.h"
 #include "model/fundamental.h"
+#include "model/metadata.h"
 #include "storage/compaction.h"
 #include "utils/tracking_allocator.h"
 
@@ -18,6 +20,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <variant>
+
 namespace storage {
 
 /**
@@ -96,7 +100,18 @@ private:
 };
 
 /**
- * A key_offset_map in which the key space is mapped to sha256(key).
+ * A key_offset_map in which the key space is mapped to a fixed size digest of
+ * the key.
+ *
+ * The digest is selected at construction time:
+ *
+ *   - sha256: 32 byte cryptographic digest. Table entries are 40 bytes.
+ *   - xxhash3: 128-bit xxh3 digest. Table entries are 24 bytes, so the same
+ *     amount of memory holds ~1.6x as many keys, and hashing is much cheaper
+ *     since xxh3 uses the widest vector unit available on the host (SSE2,
+ *     AVX2 or NEON). The digest is not cryptographic, but the probability of
+ *     any collision among n keys is bounded by n^2 / 2^129. Deployments that
+ *     need a stronger guarantee should stay on sha256.
  *
  * This container does not auto-grow on insert, and a default initialized
  * instance has zero capacity. To add capacity call `reset(size_bytes)`. This is
@@ -110,6 +125,10 @@ class hash_key_offset_map : public key_offset_map {
     static constexpr double max_load_factor = 0.95;
 
 public:
+    explicit hash_key_offset_map(
+      model::compaction_key_digest digest
+      = model::compaction_key_digest::sha256);
+
     seastar::future<std::optional<model::offset>>
     get(const compaction_key& key) const override;
 
@@ -144,44 +163,80 @@ public:
      */
     double hit_rate() const;
 
-private:
-    using hash_type = hash_sha256;
+    /**
+     * The digest used to map keys into the table.
+     */
+    model::compaction_key_digest digest() const { return digest_; }
 
+    /**
+     * Size in bytes of a single table entry for the configured digest.
+     */
+    size_t entry_size() const;
+
+private:
     /**
      * hash table entry.
      */
+    template<size_t DigestSize>
     struct entry {
-        hash_type::digest_type digest{};
+        using digest_type = std::array<char, DigestSize>;
+
+        digest_type digest{};
         model::offset offset;
-        bool empty() const;
+        bool empty() const { return digest == digest_type{}; }
     };
 
+    using sha256_entry = entry<hash_sha256::digest_size>;
+    using xxhash_entry = entry<sizeof(XXH128_canonical_t)>;
+    static_assert(sizeof(xxhash_entry) == 24);
+
     /**
      * Uses successive chunks of sizeof(index_type) bytes taken from hash(key)
      * as probes into the hash table. When `next()` returns null then the caller
      * should switch to linear probing.
      */
+    template<typename DigestType>
     struct probe {
         using index_type = uint32_t;
-        static_assert(sizeof(index_type) <= hash_type::digest_size);
+        static_assert(sizeof(index_type) <= std::tuple_size_v<DigestType>);
 
-        explicit probe(const hash_type::digest_type&);
+        explicit probe(const DigestType&);
 
         std::optional<index_type> next();
 
-        hash_type::digest_type::const_pointer iter;
-        hash_type::digest_type::const_pointer end;
+        typename DigestType::const_pointer iter;
+        typename DigestType::const_pointer end;
     };
 
+    template<typename Entry>
+    std::optional<model::offset> do_get(
+      const chunked_vector<Entry>&, const typename Entry::digest_type&) const;
+
+    template<typename Entry>
+    bool do_put(
+      chunked_vector<Entry>&,
+      const typename Entry::digest_type&,
+      model::offset offset);
+
+    template<typename Entry>
+    seastar::future<> do_initialize(chunked_vector<Entry>&, size_t size_bytes);
+
     /**
      * hash the compaction key. this helper will catch exceptions and reset the
      * hashing object which is reused to avoid reinitialization of OpenSSL
      * state.
      */
-    hash_type::digest_type hash_key(const compaction_key&) const;
+    hash_sha256::digest_type hash_key_sha256(const compaction_key&) const;
+
+    /**
+     * hash the compaction key with xxh3.
+     */
+    static xxhash_entry::digest_type hash_key_xxhash(const compaction_key&);
 
-    mutable hash_type hasher_;
-    chunked_vector<entry> entries_;
+    model::compaction_key_digest digest_;
+    mutable hash_sha256 hasher_;
+    std::variant<chunked_vector<sha256_entry>, chunked_vector<xxhash_entry>>
+      entries_;
 
     size_t size_{0};
     model::offset max_offset_;
@@ -90,7 +90,7 @@ ss::future<> kvstore::start() {
               ss::metrics::description("Size of the database in memory")),
             ss::metrics::make_counter(
               "key_count",
-              [this] { return _db.size(); },
+              [this] { return key_count(); },
               ss::metrics::description("Number of keys in the database")),
           });
     }
@@ -165,20 +165,45 @@ static inline bytes make_spaced_key(kvstore::key_space ks, bytes_view key) {
     return spaced_key;
 }
 
+/*
+ * Split a key prefixed by a key-space, the inverse of make_spaced_key
+ */
+static std::pair<kvstore::key_space, bytes> split_spaced_key(bytes key) {
+    using ks_native = std::underlying_type<kvstore::key_space>::type;
+    vassert(
+      key.size() >= sizeof(ks_native),
+      "kvstore key of {} bytes is missing its key space",
+      key.size());
+    ks_native ks_le;
+    std::copy_n(key.begin(), sizeof(ks_le), reinterpret_cast<char*>(&ks_le));
+    auto ks = static_cast<kvstore::key_space>(ss::le_to_cpu(ks_le));
+    return {ks, bytes(bytes_view(key).substr(sizeof(ks_le)))};
+}
+
 std::optional<iobuf> kvstore::get(key_space ks, bytes_view key) {
     _probe.entry_fetched();
     vassert(_started, "kvstore has not been started");
 
-    // do not re-assign to string_view -> temporary
-    auto kkey = make_spaced_key(ks, key);
     // _db_mut lock is not required here; it's ok to observe a partial apply
     // since _next_offset is not needed here.
-    if (auto it = _db.find(kkey); it != _db.end()) {
+    auto db = _db.find(ks);
+    if (db == _db.end()) {
+        return std::nullopt;
+    }
+    if (auto it = db->second.find(key); it != db->second.end()) {
         return it->second.copy();
     }
     return std::nullopt;
 }
 
+size_t kvstore::key_count() const {
+    size_t count = 0;
+    for (const auto& [_, db] : _db) {
+        count += db.size();
+    }
+    return count;
+}
+
 ss::future<> kvstore::put(key_space ks, bytes key, iobuf value) {
     _probe.entry_written();
     return put(ks, std::move(key), std::make_optional<iobuf>(std::move(value)));
@@ -192,10 +217,10 @@ ss::future<> kvstore::remove(key_space ks, bytes key) {
 ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
     vassert(_started, "kvstore has not been started");
 
-    key = make_spaced_key(ks, key);
     return ss::with_gate(
-      _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
-          auto& w = _ops.emplace_back(std::move(key), std::move(value));
+      _gate,
+      [this, ks, key = std::move(key), value = std::move(value)]() mutable {
+          auto& w = _ops.emplace_back(ks, std::move(key), std::move(value));
           if (!_timer.armed()) {
               _timer.arm(_conf.commit_interval());
           }
@@ -210,22 +235,24 @@ ss::future<> kvstore::for_each(
     auto gh = _gate.hold();
     auto units = co_await _db_mut.get_units();
 
-    auto prefix = make_spaced_key(ks, bytes_view{});
+    auto db = _db.find(ks);
+    if (db == _db.end()) {
+        co_return;
+    }
     co_await ssx::async_for_each(
-      _db.begin(), _db.end(), [&](const map_t::value_type& kv) {
-          auto spaced_key = bytes_view{kv.first};
-          if (!spaced_key.starts_with(prefix)) {
-              return;
-          }
-          auto key = spaced_key.substr(prefix.size());
-          visitor(key, kv.second);
-      });
+      db->second.begin(),
+      db->second.end(),
+      [&](const map_t::value_type& kv) { visitor(kv.first, kv.second); });
 }
 
 void kvstore::apply_op(
-  bytes key, std::optional<iobuf> value, const ssx::semaphore_units&) {
-    auto it = _db.find(key);
-    bool found = it != _db.end();
+  key_space ks,
+  bytes key,
+  std::optional<iobuf> value,
+  const ssx::semaphore_units&) {
+    auto& db = _db[ks];
+    auto it = db.find(key);
+    bool found = it != db.end();
     if (value) {
         vlog(
           lg.trace,
@@ -239,7 +266,7 @@ void kvstore::apply_op(
             it->second = std::move(*value);
         } else {
             _probe.add_cached_bytes(key.size() + value->size_bytes());
-            _db.emplace(std::move(key), std::move(*value));
+            db.emplace(std::move(key), std::move(*value));
         }
     } else {
         if (!found) {
@@ -247,7 +274,7 @@ void kvstore::apply_op(
         } else {
             vlog(lg.trace, "Apply op: delete: key={}", key);
             _probe.dec_cached_bytes(it->first.size() + it->second.size_bytes());
-            _db.erase(it);
+            db.erase(it);
         }
     }
 }
@@ -269,7 +296,8 @@ ss::future<> kvstore::flush_and_apply_ops() {
             value = op.value->share(0, op.value->size_bytes());
         }
         builder.add_raw_kv(
-          bytes_to_iobuf(op.key), reflection::to_iobuf(std::move(value)));
+          bytes_to_iobuf(make_spaced_key(op.ks, op.key)),
+          reflection::to_iobuf(std::move(value)));
     }
     auto batch = std::move(builder).build();
     auto last_offset = batch.last_offset();
@@ -285,7 +313,7 @@ ss::future<> kvstore::flush_and_apply_ops() {
       .then([this]() { return _db_mut.get_units(); })
       .then([this, last_offset, ops = std::move(ops)](auto units) mutable {
           for (auto& op : ops) {
-              apply_op(std::move(op.key), std::move(op.value), units);
+              apply_op(op.ks, std::move(op.key), std::move(op.value), units);
               op.done.set_value();
           }
           _next_offset = last_offset + model::offset(1);
@@ -376,11 +404,13 @@ ss::future<> kvstore::save_snapshot() {
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, model::offset(0));
     auto units = co_await _db_mut.get_units();
-    for (auto& entry : _db) {
-        builder.add_raw_kv(
-          bytes_to_iobuf(entry.first),
-          entry.second.share(0, entry.second.size_bytes()));
-        co_await ss::coroutine::maybe_yield();
+    for (auto& [ks, db] : _db) {
+        for (auto& entry : db) {
+            builder.add_raw_kv(
+              bytes_to_iobuf(make_spaced_key(ks, entry.first)),
+              entry.second.share(0, entry.second.size_bytes()));
+            co_await ss::coroutine::maybe_yield();
+        }
     }
     units.return_all();
     auto batch = std::move(builder).build();
@@ -430,6 +460,7 @@ ss::future<> kvstore::recover() {
       config::shard_local_cfg().storage_read_buffer_size(),
       config::shard_local_cfg().storage_read_readahead_count(),
       std::nullopt,
+      std::nullopt,
       _resources,
       _feature_table,
       _ntp_sanitizer_config);
@@ -509,11 +540,14 @@ ss::future<> kvstore::load_snapshot_from_reader(snapshot_reader& reader) {
 
     auto lock = co_await _db_mut.get_units();
     co_await batch.for_each_record_async([this](model::record r) {
-        auto key = iobuf_to_bytes(r.release_key());
+        auto [ks, key] = split_spaced_key(iobuf_to_bytes(r.release_key()));
         _probe.add_cached_bytes(key.size() + r.value().size_bytes());
-        auto res = _db.emplace(std::move(key), r.release_value());
+        auto res = _db[ks].emplace(std::move(key), r.release_value());
         vassert(
-          res.second, "Snapshot contained duplicate key {}", res.first->first);
+          res.second,
+          "Snapshot contained duplicate key {} in key space {}",
+          res.first->first,
+          static_cast<int>(ks));
         vlog(
           lg.trace,
           "Load snapshot: restoring key={} value={}",
@@ -655,10 +689,10 @@ kvstore::replay_consumer::consume_batch_end() {
 
     auto lock = co_await _store->_db_mut.get_units();
     co_await batch.for_each_record_async([this, &lock](model::record r) {
-        auto key = iobuf_to_bytes(r.release_key());
+        auto [ks, key] = split_spaced_key(iobuf_to_bytes(r.release_key()));
         auto value = reflection::from_iobuf<std::optional<iobuf>>(
           r.release_value());
-        _store->apply_op(std::move(key), std::move(value), lock);
+        _store->apply_op(ks, std::move(key), std::move(value), lock);
         _store->_next_offset += model::offset(1);
     });
 
@@ -15,6 +15,7 @@
 #include "bytes/iobuf.h"
 #include "container/chunked_hash_map.h"
 #include "container/fragmented_vector.h"
+#include "hashing/xx.h"
 #include "metrics/metrics.h"
 #include "storage/fwd.h"
 #include "storage/ntp_config.h"
@@ -29,6 +30,10 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/timer.hh>
 
+#include <absl/container/node_hash_map.h>
+
+#include <algorithm>
+
 namespace storage {
 
 /**
@@ -51,6 +56,11 @@ namespace storage {
  * flushed to disk. Once the flush is complete the operations are applied to the
  * in-memory cache, and the associated promise is resolved.
  *
+ * The in-memory cache is partitioned by key space: lookups don't need to
+ * build a prefixed key and iterating over a key space only visits its own
+ * keys. On disk all key spaces share the log and the snapshot, where keys are
+ * prefixed with their key space.
+ *
  * Concurrency
  * ===========
  *
@@ -92,7 +102,11 @@ struct kvstore_config {
 
 class kvstore {
 public:
-    using map_t = chunked_hash_map<bytes, iobuf>;
+    using map_t = chunked_hash_map<
+      bytes,
+      iobuf,
+      bytes_hasher<uint64_t, xxhash_64>,
+      bytes_type_eq>;
 
     enum class key_space : int8_t {
         testing = 0,
@@ -129,7 +143,8 @@ public:
 
     bool empty() const {
         vassert(_started, "kvstore has not been started");
-        return _db.empty();
+        return std::ranges::all_of(
+          _db, [](const auto& ks) { return ks.second.empty(); });
     }
 
     /*
@@ -154,12 +169,14 @@ private:
      * Database operation. A std::nullopt value is a deletion.
      */
     struct op {
+        key_space ks;
         bytes key;
         std::optional<iobuf> value;
         ss::promise<> done;
 
-        op(bytes&& key, std::optional<iobuf>&& value)
-          : key(std::move(key))
+        op(key_space ks, bytes&& key, std::optional<iobuf>&& value)
+          : ks(ks)
+          , key(std::move(key))
           , value(std::move(value)) {}
     };
 
@@ -176,12 +193,18 @@ private:
     // Protect _db and _next_offset across asynchronous mutations.
     mutex _db_mut{"kvstore::db_mut"};
     model::offset _next_offset;
-    map_t _db;
+    // node map: references to a key space's map stay valid while for_each()
+    // yields
+    absl::node_hash_map<key_space, map_t> _db;
     std::optional<ntp_sanitizer_config> _ntp_sanitizer_config;
 
     ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
     void apply_op(
-      bytes key, std::optional<iobuf> value, const ssx::semaphore_units&);
+      key_space ks,
+      bytes key,
+      std::optional<iobuf> value,
+      const ssx::semaphore_units&);
+    size_t key_count() const;
     ss::future<> flush_and_apply_ops();
     ss::future<> roll();
     ss::future<> save_snapshot();
@@ -199,6 +199,10 @@ public:
 
     virtual int64_t compaction_backlog() const = 0;
 
+    /// Estimated number of bytes a compaction of the backlog would reclaim,
+    /// based on the compaction ratio observed for this log
+    virtual int64_t compaction_reclaimable_bytes() const = 0;
+
     virtual ss::future<usage_report> disk_usage(gc_config) = 0;
     virtual ss::future<reclaimable_offsets>
     get_reclaimable_offsets(gc_config cfg) = 0;
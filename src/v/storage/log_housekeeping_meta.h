@@ -27,6 +27,9 @@ struct log_housekeeping_meta {
     ss::shared_ptr<log> handle;
     bitflags flags{bitflags::none};
     ss::lowres_clock::time_point last_compaction;
+    /// Estimated bytes reclaimed by compacting the log, refreshed when the
+    /// compaction order is computed
+    int64_t reclaimable_bytes{0};
 
     intrusive_list_hook link;
 };
@@ -20,6 +20,7 @@
 #include "ssx/async-clear.h"
 #include "ssx/future-util.h"
 #include "storage/batch_cache.h"
+#include "storage/chunk_cache.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/disk_log_impl.h"
 #include "storage/file_sanitizer.h"
@@ -145,12 +146,108 @@ log_manager::log_manager(
   , _jitter(_config.compaction_interval())
   , _trigger_gc_jitter(0s, 5s)
   , _batch_cache(_config.reclaim_opts)
+  , _cache_coordinator(
+      config::shard_local_cfg().storage_cache_memory_budget.bind(),
+      config::shard_local_cfg().storage_cache_rebalance_interval_ms.bind())
   , _probe(std::make_unique<log_manager_probe>()) {
     _config.compaction_interval.watch([this]() {
         _jitter = simple_time_jitter<ss::lowres_clock>{
           _config.compaction_interval()};
         _housekeeping_sem.signal();
     });
+    register_cache_budgets();
+}
+
+namespace {
+/// Estimated memory held by a cached reader, which keeps the read buffers of
+/// its segment stream.
+size_t estimated_reader_memory() {
+    const auto& cfg = config::shard_local_cfg();
+    return cfg.storage_read_buffer_size()
+           * (1 + std::max<int16_t>(cfg.storage_read_readahead_count(), 0));
+}
+} // namespace
+
+void log_manager::register_cache_budgets() {
+    _cache_coordinator.register_cache({
+      .name = "batch_cache",
+      .min_budget = batch_cache::range::range_size,
+      .sample_fn =
+        [this] {
+            const auto s = _batch_cache.get_stats();
+            return cache_memory_coordinator::sample{
+              .size_bytes = _batch_cache.size_bytes(),
+              .hits = s.hits,
+              .misses = s.misses,
+            };
+        },
+      .set_budget_fn =
+        [this](std::optional<size_t> budget) {
+            _batch_cache.set_max_size(budget);
+        },
+    });
+
+    auto& chunks = internal::chunks();
+    _cache_coordinator.register_cache({
+      .name = "chunk_cache",
+      .min_budget = chunks.chunk_size(),
+      .max_budget = chunks.size_limit(),
+      .sample_fn =
+        [&chunks] {
+            const auto s = chunks.get_stats();
+            return cache_memory_coordinator::sample{
+              .size_bytes = s.total_bytes,
+              .hits = s.hits,
+              .misses = s.misses,
+            };
+        },
+      .set_budget_fn =
+        [&chunks](std::optional<size_t> budget) {
+            chunks.set_size_target(budget);
+        },
+    });
+
+    _cache_coordinator.register_cache({
+      .name = "readers_cache",
+      .sample_fn =
+        [this] {
+            cache_memory_coordinator::sample ret;
+            size_t readers = 0;
+            for (auto& [_, meta] : _logs) {
+                auto* l = dynamic_cast<disk_log_impl*>(meta->handle.get());
+                if (!l) {
+                    continue;
+                }
+                const auto s = l->readers().get_stats();
+                readers += s.cached_readers + s.in_use_readers;
+                ret.hits += s.cache_hits;
+                ret.misses += s.cache_misses;
+            }
+            ret.size_bytes = readers * estimated_reader_memory();
+            return ret;
+        },
+      .set_budget_fn =
+        [this](std::optional<size_t> budget) {
+            set_readers_cache_budget(budget);
+        },
+    });
+}
+
+void log_manager::set_readers_cache_budget(std::optional<size_t> budget) {
+    // the budget is split evenly between the logs known at this point, logs
+    // created later use the same per log limit until the next rebalance
+    _readers_cache_limit = std::nullopt;
+    if (budget) {
+        _readers_cache_limit = std::max<size_t>(
+          1,
+          *budget
+            / (estimated_reader_memory() * std::max<size_t>(_logs.size(), 1)));
+    }
+    for (auto& [_, meta] : _logs) {
+        if (auto* l = dynamic_cast<disk_log_impl*>(meta->handle.get()); l) {
+            l->readers().set_max_size_limit(_readers_cache_limit);
+        }
+    }
 }
 
 log_manager::~log_manager() = default;
@@ -171,11 +268,19 @@ ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
             .segment_name = std::filesystem::path(clean_segment.value())
                               .filename()
                               .string()}));
+        // lets the next startup open the segments without listing the
+        // partition directory
+        co_await _kvstore.put(
+          kvstore::key_space::storage,
+          internal::segment_manifest_key(log->config().ntp()),
+          serde::to_iobuf(
+            internal::make_segment_manifest(log->segments(), true)));
     }
 }
 
 ss::future<> log_manager::start() {
     _probe->setup_metrics();
+    _cache_coordinator.start();
     if (unlikely(config::shard_local_cfg()
                    .log_disable_housekeeping_for_tests.value())) {
         co_return;
@@ -188,6 +293,7 @@ ss::future<> log_manager::stop() {
     _abort_source.request_abort();
     _housekeeping_sem.broken();
 
+    co_await _cache_coordinator.stop();
     co_await _gate.close();
     co_await ss::coroutine::parallel_for_each(
       _logs, [this](logs_type::value_type& entry) {
@@ -250,13 +356,18 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
         co_await current_log.handle->apply_segment_ms();
     }
 
+    order_logs_for_compaction();
+
+    const bool spill_key_map
+      = config::shard_local_cfg().storage_compaction_key_map_spill_to_disk();
     if (
       config::shard_local_cfg().log_compaction_use_sliding_window.value()
-      && !_compaction_hash_key_map && !_logs_list.empty()
+      && !spill_key_map && !_compaction_hash_key_map && !_logs_list.empty()
       && is_not_set(_logs_list.front().flags, bflags::compacted)) {
         auto compaction_mem_bytes
           = memory_groups().compaction_reserved_memory();
-        auto compaction_map = std::make_unique<hash_key_offset_map>();
+        auto compaction_map = std::make_unique<hash_key_offset_map>(
+          config::shard_local_cfg().storage_compaction_key_map_digest());
         co_await compaction_map->initialize(compaction_mem_bytes);
         _compaction_hash_key_map = std::move(compaction_map);
     }
@@ -278,7 +389,7 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
         // NOTE: housekeeping holds _compaction_housekeeping_gate, that prevents
         // the removal of the parent object. this makes awaiting housekeeping
         // safe against removal of segments from _logs_list
-        co_await current_log.handle->housekeeping(housekeeping_config(
+        housekeeping_config cfg(
           collection_threshold,
           _config.retention_bytes(),
           current_log.handle->stm_manager()->max_collectible_offset(),
@@ -286,7 +397,12 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
           _config.compaction_priority,
           _abort_source,
           std::move(ntp_sanitizer_cfg),
-          _compaction_hash_key_map.get()));
+          _compaction_hash_key_map.get());
+        if (spill_key_map) {
+            cfg.compact.spill_key_map_memory
+              = memory_groups().compaction_reserved_memory();
+        }
+        co_await current_log.handle->housekeeping(std::move(cfg));
         _probe->housekeeping_log_processed();
 
         // bail out of compaction early in order to get back to gc
@@ -296,6 +412,29 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
     }
 }
 
+void log_manager::order_logs_for_compaction() {
+    // The compaction pass is cut short whenever gc is triggered and the key
+    // map is shared by the logs compacted in the pass, so the logs which
+    // free the most disk space are compacted first. Logs which were never
+    // compacted go first: their compaction ratio is not known yet and they
+    // would otherwise always rank last.
+    for (auto& log_meta : _logs_list) {
+        log_meta.reclaimable_bytes
+          = log_meta.handle->compaction_reclaimable_bytes();
+    }
+    _logs_list.sort(
+      [](const log_housekeeping_meta& a, const log_housekeeping_meta& b) {
+          const auto a_new = a.last_compaction
+                             == ss::lowres_clock::time_point{};
+          const auto b_new = b.last_compaction
+                             == ss::lowres_clock::time_point{};
+          if (a_new != b_new) {
+              return a_new;
+          }
+          return a.reclaimable_bytes > b.reclaimable_bytes;
+      });
+}
+
 ss::future<> log_manager::housekeeping() {
     while (!_gate.is_closed()) {
         try {
@@ -501,7 +640,8 @@ log_manager::create_cache(with_cache ntp_cache_enabled) {
 ss::future<ss::shared_ptr<log>> log_manager::manage(
   ntp_config cfg,
   raft::group_id group,
-  std::vector<model::record_batch_type> translator_batch_types) {
+  std::vector<model::record_batch_type> translator_batch_types,
+  prioritized_recovery prioritized) {
     auto gate = _gate.hold();
     if (!translator_batch_types.empty()) {
         // Sanity check to avoid multiple logs overwriting each others'
@@ -511,7 +651,7 @@ ss::future<ss::shared_ptr<log>> log_manager::manage(
           "When configured to translate offsets, must supply a valid group id");
     }
 
-    auto units = co_await _resources.get_recovery_units();
+    auto units = co_await _resources.get_recovery_units(prioritized);
     co_return co_await do_manage(
       std::move(cfg), group, std::move(translator_batch_types));
 }
@@ -520,7 +660,8 @@ ss::future<> log_manager::maybe_clear_kvstore(const ntp_config& cfg) {
     return ss::file_exists(cfg.work_directory())
       .then([this,
              offset_key = internal::start_offset_key(cfg.ntp()),
-             segment_key = internal::clean_segment_key(cfg.ntp())](
+             segment_key = internal::clean_segment_key(cfg.ntp()),
+             manifest_key = internal::segment_manifest_key(cfg.ntp())](
               bool dir_exists) {
           if (dir_exists) {
               return ss::now();
@@ -532,6 +673,10 @@ ss::future<> log_manager::maybe_clear_kvstore(const ntp_config& cfg) {
             .then([this, segment_key] {
                 return _kvstore.remove(
                   kvstore::key_space::storage, segment_key);
+            })
+            .then([this, manifest_key] {
+                return _kvstore.remove(
+                  kvstore::key_space::storage, manifest_key);
             });
       });
 }
@@ -556,6 +701,18 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(
                                std::move(clean_iobuf.value()))
                                .segment_name;
     }
+    std::optional<internal::segment_manifest> manifest;
+    auto manifest_key = internal::segment_manifest_key(cfg.ntp());
+    auto manifest_iobuf = _kvstore.get(
+      kvstore::key_space::storage, manifest_key);
+    if (manifest_iobuf) {
+        manifest = serde::from_iobuf<internal::segment_manifest>(
+          std::move(manifest_iobuf.value()));
+        // the manifest describes the log as it was closed, once the log is
+        // open again segments may be rolled, compacted or removed. It is
+        // rewritten on the next clean shutdown.
+        co_await _kvstore.remove(kvstore::key_space::storage, manifest_key);
+    }
 
     co_await maybe_clear_kvstore(cfg);
 
@@ -570,6 +727,7 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(
       config::shard_local_cfg().storage_read_buffer_size(),
       config::shard_local_cfg().storage_read_readahead_count(),
       last_clean_segment,
+      std::move(manifest),
       _resources,
       _feature_table,
       std::move(ntp_sanitizer_cfg));
@@ -582,6 +740,11 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(
       _kvstore,
       _feature_table,
       std::move(translator_batch_types));
+    if (_readers_cache_limit) {
+        if (auto* disk_log = dynamic_cast<disk_log_impl*>(l.get()); disk_log) {
+            disk_log->readers().set_max_size_limit(_readers_cache_limit);
+        }
+    }
     auto [it, success] = _logs.emplace(
       l->config().ntp(), std::make_unique<log_housekeeping_meta>(l));
     _logs_list.push_back(*it->second);
@@ -21,6 +21,7 @@
 #include "model/metadata.h"
 #include "random/simple_time_jitter.h"
 #include "storage/batch_cache.h"
+#include "storage/cache_memory_coordinator.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/key_offset_map.h"
 #include "storage/log.h"
@@ -175,10 +176,16 @@ public:
       ss::sharded<features::feature_table>&) noexcept;
     ~log_manager();
 
+    /**
+     * Open (recovering if needed) the log for an ntp. At most
+     * storage_max_concurrent_replay logs are recovered at once across the
+     * node; prioritized logs are recovered ahead of every other waiting log.
+     */
     ss::future<ss::shared_ptr<log>> manage(
       ntp_config,
       raft::group_id = raft::group_id{},
-      std::vector<model::record_batch_type> translator_batch_types = {});
+      std::vector<model::record_batch_type> translator_batch_types = {},
+      prioritized_recovery = prioritized_recovery::no);
 
     ss::future<> shutdown(model::ntp);
 
@@ -284,8 +291,15 @@ private:
 
     ss::future<> housekeeping_scan(model::timestamp);
 
+    // Orders _logs_list so that the compaction pass starts with the logs
+    // which reclaim the most space
+    void order_logs_for_compaction();
+
     void update_log_count();
 
+    void register_cache_budgets();
+    void set_readers_cache_budget(std::optional<size_t>);
+
     log_config _config;
     kvstore& _kvstore;
     storage_resources& _resources;
@@ -295,6 +309,10 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
+    cache_memory_coordinator _cache_coordinator;
+    // Limit on the number of cached readers of each log, derived from the
+    // readers cache share of the shard cache budget.
+    std::optional<size_t> _readers_cache_limit;
 
     // Hash key-map to use across multiple compactions to reuse reserved memory
     // rather than reallocating repeatedly.
@@ -239,6 +239,11 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
     /*
      * fetch batches from the cache covering the range [_base, end] where
      * end is either the configured max offset or the end of the segment.
+     *
+     * Reads of segments which are no longer appended to are historical, e.g.
+     * a consumer replaying the log. Their hits don't promote ranges from the
+     * probationary FIFO so that the replay can reuse its own read-ahead
+     * without displacing the tail of the log which other readers rely on.
      */
     auto cache_read = _seg.cache_get(
       _config.start_offset,
@@ -246,7 +251,7 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
       _config.type_filter,
       _config.first_timestamp,
       std::min(max_buffer_size, _config.max_bytes),
-      _config.skip_batch_cache);
+      _config.skip_batch_cache || !_seg.has_appender());
 
     // handles cases where the type filter skipped batches. see
     // batch_cache_index::read for more details.
@@ -65,6 +65,11 @@ public:
         co_return in_batches;
     }
 
+    ss::future<> truncate(versioned_log* log, model::offset o) {
+        co_await log->truncate(o);
+        next_offset_ = log->next_offset().value_or(o);
+    }
+
 private:
     model::ntp ntp_;
     ss::sstring base_dir_;
@@ -187,3 +192,46 @@ TEST_F(ActiveSegmentTest, TestApplySegmentMsEmpty) {
     write_random_batches(log, 1).get();
     ASSERT_EQ(1, log->segment_count());
 }
+
+TEST_F(ActiveSegmentTest, TestTruncateActiveSegment) {
+    auto* log = make_log(128_MiB, tristate<std::chrono::milliseconds>{});
+    auto batches = write_random_batches(log, 10).get();
+    ASSERT_EQ(1, log->segment_count());
+
+    // Truncating past the end is a no-op.
+    auto end = model::next_offset(batches.back().last_offset());
+    truncate(log, end).get();
+    ASSERT_EQ(end, log->next_offset());
+
+    // Truncation hides the suffix, and appends continue from the truncation
+    // point in the same segment.
+    truncate(log, batches[5].base_offset()).get();
+    ASSERT_EQ(batches[5].base_offset(), log->next_offset());
+    ASSERT_EQ(1, log->segment_count());
+    ASSERT_TRUE(log->has_active_segment());
+    write_random_batches(log, 5).get();
+    ASSERT_EQ(1, log->segment_count());
+
+    // Truncating to the base of the segment removes it.
+    truncate(log, batches[0].base_offset()).get();
+    ASSERT_EQ(0, log->segment_count());
+    ASSERT_FALSE(log->next_offset().has_value());
+    write_random_batches(log, 1).get();
+    ASSERT_EQ(1, log->segment_count());
+}
+
+TEST_F(ActiveSegmentTest, TestTruncateAcrossSegments) {
+    auto* log = make_log(128, tristate<std::chrono::milliseconds>{});
+    auto batches = write_random_batches(log, 10).get();
+    ASSERT_EQ(10, log->segment_count());
+
+    // Segments wholly above the truncation point are removed.
+    truncate(log, batches[6].base_offset()).get();
+    ASSERT_EQ(6, log->segment_count());
+    ASSERT_FALSE(log->has_active_segment());
+    ASSERT_EQ(batches[6].base_offset(), log->next_offset());
+
+    write_random_batches(log, 2).get();
+    ASSERT_EQ(8, log->segment_count());
+    ASSERT_TRUE(log->has_active_segment());
+}
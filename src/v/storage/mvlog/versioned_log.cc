@@ -20,12 +20,36 @@
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/lowres_clock.hh>
 
+#include <algorithm>
 #include <chrono>
 
 using namespace std::literals::chrono_literals;
 
 namespace storage::experimental::mvlog {
 
+namespace {
+
+// Hides the batches at and above the given offset from new readers of the
+// segment, dropping their positions.
+void truncate_segment(
+  batch_positions_t& positions,
+  readable_segment& seg,
+  size_t file_size,
+  model::offset offset) {
+    auto it = std::ranges::lower_bound(
+      positions, offset, std::less<>{}, &batch_position::base_offset);
+    vassert(
+      it != positions.end() && it->base_offset == offset,
+      "Truncation offset {} is not the base offset of a batch",
+      offset);
+    // Any gap added by an earlier truncation of the same segment is merged
+    // into this one.
+    seg.add_gap(file_gap(it->file_pos, file_size - it->file_pos));
+    positions.erase_to_end(it);
+}
+
+} // namespace
+
 active_segment::active_segment(
   std::unique_ptr<file> f, model::offset o, segment_id id, size_t target_size)
   : segment_file(std::move(f))
@@ -45,7 +69,8 @@ readonly_segment::readonly_segment(std::unique_ptr<active_segment> active_seg)
   , readable_seg(std::move(active_seg->readable_seg))
   , id(active_seg->id)
   , offsets(model::bounded_offset_interval::checked(
-      active_seg->base_offset, model::prev_offset(active_seg->next_offset))) {}
+      active_seg->base_offset, model::prev_offset(active_seg->next_offset)))
+  , batch_positions(std::move(active_seg->batch_positions)) {}
 
 versioned_log::versioned_log(storage::ntp_config cfg)
   : ntp_cfg_(std::move(cfg)) {}
@@ -142,16 +167,85 @@ ss::future<> versioned_log::append(model::record_batch b) {
       b.base_offset(),
       active_seg_->next_offset);
     auto next = model::next_offset(b.last_offset());
+    active_seg_->batch_positions.push_back(batch_position{
+      .base_offset = b.base_offset(),
+      .file_pos = active_seg_->segment_file->size(),
+    });
     co_await active_seg_->appender->append(std::move(b));
     active_seg_->next_offset = next;
 }
 
+ss::future<> versioned_log::remove_unlocked(
+  file& segment_file, const readable_segment& readable_seg) {
+    vassert(
+      readable_seg.num_readers() == 0,
+      "Removing truncated segment {} with {} readers",
+      segment_file.filepath().c_str(),
+      readable_seg.num_readers());
+    vlog(
+      log.info,
+      "Removing truncated segment file {}",
+      segment_file.filepath().c_str());
+    co_await segment_file.close();
+    co_await file_mgr_.remove_file(segment_file.filepath());
+}
+
+ss::future<> versioned_log::truncate(model::offset offset) {
+    auto lock = co_await active_segment_lock_.get_units();
+    const auto next = next_offset();
+    if (!next.has_value() || offset >= next.value()) {
+        co_return;
+    }
+    vlog(log.debug, "Truncating log at offset {}", offset);
+    if (has_active_segment()) {
+        if (offset > active_seg_->base_offset) {
+            truncate_segment(
+              active_seg_->batch_positions,
+              *active_seg_->readable_seg,
+              active_seg_->segment_file->size(),
+              offset);
+            active_seg_->next_offset = offset;
+            co_return;
+        }
+        co_await remove_unlocked(
+          *active_seg_->segment_file, *active_seg_->readable_seg);
+        active_seg_.reset();
+    }
+    while (!segs_.empty()) {
+        auto& seg = *segs_.back();
+        if (offset > seg.offsets.max()) {
+            break;
+        }
+        if (offset > seg.offsets.min()) {
+            truncate_segment(
+              seg.batch_positions,
+              *seg.readable_seg,
+              seg.segment_file->size(),
+              offset);
+            seg.offsets = model::bounded_offset_interval::checked(
+              seg.offsets.min(), model::prev_offset(offset));
+            break;
+        }
+        co_await remove_unlocked(*seg.segment_file, *seg.readable_seg);
+        segs_.pop_back();
+    }
+}
+
 size_t versioned_log::segment_count() const {
     return segs_.size() + (active_seg_ ? 1 : 0);
 }
 bool versioned_log::has_active_segment() const {
     return active_seg_ != nullptr;
 }
+std::optional<model::offset> versioned_log::next_offset() const {
+    if (active_seg_) {
+        return active_seg_->next_offset;
+    }
+    if (!segs_.empty()) {
+        return model::next_offset(segs_.back()->offsets.max());
+    }
+    return std::nullopt;
+}
 
 size_t versioned_log::compute_max_segment_size() const {
     if (
@@ -26,6 +26,13 @@ namespace storage::experimental::mvlog {
 class readable_segment;
 class segment_appender;
 
+// The position in a segment file at which a record batch begins.
+struct batch_position {
+    model::offset base_offset;
+    size_t file_pos{0};
+};
+using batch_positions_t = chunked_vector<batch_position>;
+
 struct active_segment {
     active_segment(active_segment&) = delete;
     active_segment(active_segment&&) = delete;
@@ -50,6 +57,9 @@ struct active_segment {
     const segment_id id;
     model::offset base_offset;
     model::offset next_offset;
+
+    // Positions of the batches appended to the segment, ordered by offset.
+    batch_positions_t batch_positions;
 };
 
 struct readonly_segment {
@@ -65,6 +75,7 @@ struct readonly_segment {
     std::unique_ptr<readable_segment> readable_seg;
     const segment_id id;
     model::bounded_offset_interval offsets;
+    batch_positions_t batch_positions;
 };
 
 class versioned_log {
@@ -92,9 +103,23 @@ public:
     // segment, leaving the log without an active segment.
     ss::future<> apply_segment_ms();
 
+    // Removes all batches with offsets at or above the given offset, which
+    // must be the base offset of a batch in the log. Offsets past the end of
+    // the log are ignored.
+    //
+    // The truncation doesn't rewrite any data: the truncated suffix of the
+    // segment that contains the offset is hidden from new readers with a
+    // file gap, while readers created before the call continue to see it.
+    // Segments that are truncated entirely are removed and must not have
+    // outstanding readers. Subsequent appends continue from the given offset.
+    ss::future<> truncate(model::offset);
+
     // Returns the total of segments in the log.
     size_t segment_count() const;
 
+    // Returns the offset expected of the next append, if the log isn't empty.
+    std::optional<model::offset> next_offset() const;
+
     // Returns whether or not the log has an active segment.
     bool has_active_segment() const;
 
@@ -117,6 +142,9 @@ private:
     // no active segment.
     ss::future<> create_unlocked(model::offset base);
 
+    // Closes and removes the file of a segment that was truncated entirely.
+    ss::future<> remove_unlocked(file&, const readable_segment&);
+
     // NTP config with which to get segment properties.
     const ntp_config ntp_cfg_;
 
@@ -12,6 +12,7 @@
 #include "storage/offset_translator.h"
 
 #include "base/vlog.h"
+#include "features/feature_table.h"
 #include "reflection/adl.h"
 #include "storage/api.h"
 #include "storage/kvstore.h"
@@ -30,13 +31,15 @@ offset_translator::offset_translator(
   raft::group_id group,
   model::ntp ntp,
   storage::kvstore& kvs,
-  storage::storage_resources& resources)
+  storage::storage_resources& resources,
+  ss::sharded<features::feature_table>& feature_table)
   : _filtered_types(std::move(filtered_types))
   , _state(ss::make_lw_shared<storage::offset_translator_state>(std::move(ntp)))
   , _group(group)
   , _logger(logger, ssx::sformat("ntp: {}", _state->ntp()))
   , _kvs(kvs)
-  , _resources(resources) {}
+  , _resources(resources)
+  , _feature_table(feature_table) {}
 
 offset_translator::offset_translator(
   std::vector<model::record_batch_type> filtered_types,
@@ -48,7 +51,8 @@ offset_translator::offset_translator(
       group,
       std::move(ntp),
       storage_api.kvs(),
-      storage_api.resources()) {}
+      storage_api.resources(),
+      storage_api.feature_table()) {}
 
 void offset_translator::process(const model::record_batch& batch) {
     if (_filtered_types.empty()) {
@@ -87,6 +91,8 @@ namespace {
 enum class kvstore_key_type : int8_t {
     offsets_map = 0,
     highest_known_offset = 1,
+    compact_offsets_map = 2,
+    offsets_map_tail = 3,
 };
 
 bytes serialize_kvstore_key(raft::group_id group, kvstore_key_type key_type) {
@@ -106,6 +112,20 @@ bytes offset_translator::kvstore_highest_known_offset_key(
     return serialize_kvstore_key(group, kvstore_key_type::highest_known_offset);
 }
 
+bytes offset_translator::kvstore_compact_offsetmap_key(raft::group_id group) {
+    return serialize_kvstore_key(group, kvstore_key_type::compact_offsets_map);
+}
+
+bytes offset_translator::kvstore_offsetmap_tail_key(raft::group_id group) {
+    return serialize_kvstore_key(group, kvstore_key_type::offsets_map_tail);
+}
+
+bool offset_translator::use_compact_checkpoints() const {
+    return _feature_table.local_is_initialized()
+           && _feature_table.local().is_active(
+             features::feature::offset_translator_compact_checkpoints);
+}
+
 ss::future<> offset_translator::start(must_reset reset) {
     vassert(
       _state->empty(),
@@ -122,17 +142,40 @@ ss::future<> offset_translator::start(must_reset reset) {
         *_state = storage::offset_translator_state(
           _state->ntp(), model::offset::min(), 0);
         ++_map_version;
+        ++_map_rewrites;
         _highest_known_offset = model::offset::min();
+        _legacy_map_persisted = _kvs.get(
+                                      storage::kvstore::key_space::
+                                        offset_translator,
+                                      offsets_map_key())
+                                  .has_value();
 
         co_await _checkpoint_lock.with([this] { return do_checkpoint(); });
     } else {
-        auto map_buf = _kvs.get(
-          storage::kvstore::key_space::offset_translator, offsets_map_key());
+        static constexpr auto ks
+          = storage::kvstore::key_space::offset_translator;
+        auto compact_map_buf = _kvs.get(
+          ks, kvstore_compact_offsetmap_key(_group));
+        auto map_buf = _kvs.get(ks, offsets_map_key());
         auto highest_known_offset_buf = _kvs.get(
-          storage::kvstore::key_space::offset_translator,
-          highest_known_offset_key());
-
-        if (map_buf && highest_known_offset_buf) {
+          ks, highest_known_offset_key());
+        _legacy_map_persisted = map_buf.has_value();
+
+        if (compact_map_buf && highest_known_offset_buf) {
+            auto checkpoint
+              = storage::offset_translator_state::from_compact_map(
+                _state->ntp(),
+                std::move(*compact_map_buf),
+                _kvs.get(ks, kvstore_offsetmap_tail_key(_group)));
+            *_state = std::move(checkpoint.state);
+            _compact_generation = checkpoint.generation;
+            _compact_map_last_offset = checkpoint.map_last_offset;
+            _compact_map_size = checkpoint.map_size;
+            _highest_known_offset = reflection::from_iobuf<model::offset>(
+              std::move(*highest_known_offset_buf));
+            _highest_known_offset = std::max(
+              _highest_known_offset, _state->last_gap_offset());
+        } else if (map_buf && highest_known_offset_buf) {
             *_state = storage::offset_translator_state::from_serialized_map(
               _state->ntp(), std::move(*map_buf));
             _highest_known_offset = reflection::from_iobuf<model::offset>(
@@ -150,6 +193,7 @@ ss::future<> offset_translator::start(must_reset reset) {
             *_state = storage::offset_translator_state(
               _state->ntp(), model::offset::min(), 0);
             ++_map_version;
+            ++_map_rewrites;
             _highest_known_offset = model::offset::min();
         }
     }
@@ -183,6 +227,7 @@ ss::future<> offset_translator::sync_with_log(
     // happen if the offsets map was persisted, but the log wasn't flushed).
     if (_state->truncate(model::next_offset(log_offsets.dirty_offset))) {
         ++_map_version;
+        ++_map_rewrites;
     }
 
     if (log_offsets.dirty_offset < _highest_known_offset) {
@@ -245,6 +290,7 @@ ss::future<> offset_translator::truncate(model::offset offset) {
 
     if (_state->truncate(offset)) {
         ++_map_version;
+        ++_map_rewrites;
     }
 
     model::offset prev = model::prev_offset(offset);
@@ -280,6 +326,7 @@ ss::future<> offset_translator::prefix_truncate(
     }
 
     ++_map_version;
+    ++_map_rewrites;
 
     vlogl(
       _logger,
@@ -298,11 +345,7 @@ ss::future<> offset_translator::remove_persistent_state() {
         co_return;
     }
 
-    co_await _kvs.remove(
-      storage::kvstore::key_space::offset_translator,
-      highest_known_offset_key());
-    co_await _kvs.remove(
-      storage::kvstore::key_space::offset_translator, offsets_map_key());
+    co_await remove_persistent_state(_group, _kvs);
 }
 
 bytes offset_translator::offsets_map_key() const {
@@ -343,6 +386,10 @@ ss::future<> offset_translator::maybe_checkpoint(size_t checkpoint_threshold) {
 }
 
 ss::future<> offset_translator::do_checkpoint() {
+    if (use_compact_checkpoints()) {
+        co_return co_await do_compact_checkpoint();
+    }
+
     // Read state in a single continuation to get a consistent snapshot.
 
     size_t bytes_processed = _bytes_processed;
@@ -365,6 +412,7 @@ ss::future<> offset_translator::do_checkpoint() {
           offsets_map_key(),
           std::move(*map_buf));
         _map_version_at_checkpoint = map_version;
+        _legacy_map_persisted = true;
     }
 
     co_await _kvs.put(
@@ -377,6 +425,68 @@ ss::future<> offset_translator::do_checkpoint() {
     _checkpoint_hint = false;
 }
 
+ss::future<> offset_translator::do_compact_checkpoint() {
+    static constexpr auto ks = storage::kvstore::key_space::offset_translator;
+    // Read state in a single continuation to get a consistent snapshot.
+
+    size_t bytes_processed = _bytes_processed;
+    size_t map_version = _map_version;
+    size_t map_rewrites = _map_rewrites;
+
+    // Rewriting the whole map once the tail is as large as the map keeps the
+    // amortized cost of a checkpoint proportional to the number of new gaps.
+    std::optional<iobuf> map_buf;
+    std::optional<iobuf> tail_buf;
+    std::optional<model::offset> map_last_offset = _compact_map_last_offset;
+    size_t map_size = _compact_map_size;
+    const auto generation = _compact_generation + 1;
+    if (map_version > _map_version_at_checkpoint) {
+        const bool full = !_compact_map_last_offset
+                          || map_rewrites > _map_rewrites_at_checkpoint
+                          || _state->size() - _compact_map_size
+                               > std::max(_compact_map_size, size_t{16});
+        if (full) {
+            map_buf.emplace(_state->serialize_compact_map(generation));
+            map_last_offset = _state->last_gap_offset();
+            map_size = _state->size();
+        } else {
+            tail_buf.emplace(_state->serialize_compact_tail(
+              _compact_generation, *_compact_map_last_offset));
+        }
+    }
+
+    iobuf hko_buf = reflection::to_iobuf(_highest_known_offset);
+
+    // As with the full map, the offsets map is persisted before the highest
+    // known offset. A stale tail left behind by a crash after writing a new
+    // map belongs to a previous generation and is ignored at startup.
+    if (map_buf) {
+        co_await _kvs.put(
+          ks, kvstore_compact_offsetmap_key(_group), std::move(*map_buf));
+        _compact_generation = generation;
+        _compact_map_last_offset = map_last_offset;
+        _compact_map_size = map_size;
+        _map_rewrites_at_checkpoint = map_rewrites;
+        co_await _kvs.remove(ks, kvstore_offsetmap_tail_key(_group));
+        if (_legacy_map_persisted) {
+            co_await _kvs.remove(ks, offsets_map_key());
+            _legacy_map_persisted = false;
+        }
+    } else if (tail_buf) {
+        co_await _kvs.put(
+          ks, kvstore_offsetmap_tail_key(_group), std::move(*tail_buf));
+    }
+    if (map_buf || tail_buf) {
+        _map_version_at_checkpoint = map_version;
+    }
+
+    co_await _kvs.put(ks, highest_known_offset_key(), std::move(hko_buf));
+    _bytes_processed_at_checkpoint = bytes_processed;
+    _bytes_processed_units.return_all();
+
+    _checkpoint_hint = false;
+}
+
 ss::future<> offset_translator::copy_persistent_state(
   raft::group_id group,
   storage::kvstore& source_kvs,
@@ -385,6 +495,8 @@ ss::future<> offset_translator::copy_persistent_state(
     struct ot_state {
         std::optional<iobuf> highest_known_offset;
         std::optional<iobuf> offset_map;
+        std::optional<iobuf> compact_offset_map;
+        std::optional<iobuf> offset_map_tail;
     };
     vlog(
       storage::stlog.debug,
@@ -398,12 +510,30 @@ ss::future<> offset_translator::copy_persistent_state(
         serialize_kvstore_key(group, kvstore_key_type::highest_known_offset)),
       .offset_map = source_kvs.get(
         ks, serialize_kvstore_key(group, kvstore_key_type::offsets_map)),
+      .compact_offset_map = source_kvs.get(
+        ks,
+        serialize_kvstore_key(group, kvstore_key_type::compact_offsets_map)),
+      .offset_map_tail = source_kvs.get(
+        ks, serialize_kvstore_key(group, kvstore_key_type::offsets_map_tail)),
     };
 
     co_await api.invoke_on(
       target_shard, [gr = group, &state](storage::api& api) -> ss::future<> {
           std::vector<ss::future<>> write_futures;
-          write_futures.reserve(2);
+          write_futures.reserve(4);
+          if (state.compact_offset_map) {
+              write_futures.push_back(api.kvs().put(
+                ks,
+                serialize_kvstore_key(
+                  gr, kvstore_key_type::compact_offsets_map),
+                state.compact_offset_map->copy()));
+          }
+          if (state.offset_map_tail) {
+              write_futures.push_back(api.kvs().put(
+                ks,
+                serialize_kvstore_key(gr, kvstore_key_type::offsets_map_tail),
+                state.offset_map_tail->copy()));
+          }
           if (state.offset_map) {
               write_futures.push_back(api.kvs().put(
                 ks,
@@ -426,12 +556,16 @@ ss::future<> offset_translator::remove_persistent_state(
   raft::group_id group, storage::kvstore& kvs) {
     static constexpr auto ks = storage::kvstore::key_space::offset_translator;
     std::vector<ss::future<>> remove_futures;
-    remove_futures.reserve(2);
+    remove_futures.reserve(4);
     remove_futures.push_back(kvs.remove(
       ks,
       serialize_kvstore_key(group, kvstore_key_type::highest_known_offset)));
     remove_futures.push_back(kvs.remove(
       ks, serialize_kvstore_key(group, kvstore_key_type::offsets_map)));
+    remove_futures.push_back(kvs.remove(
+      ks, serialize_kvstore_key(group, kvstore_key_type::compact_offsets_map)));
+    remove_futures.push_back(kvs.remove(
+      ks, serialize_kvstore_key(group, kvstore_key_type::offsets_map_tail)));
     co_await ss::when_all_succeed(std::move(remove_futures));
 }
 
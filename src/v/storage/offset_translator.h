@@ -12,6 +12,7 @@
 #pragma once
 
 #include "base/units.h"
+#include "features/fwd.h"
 #include "model/fundamental.h"
 #include "raft/fundamental.h"
 #include "ssx/semaphore.h"
@@ -22,6 +23,7 @@
 #include "utils/mutex.h"
 #include "utils/prefix_logger.h"
 
+#include <seastar/core/sharded.hh>
 #include <seastar/util/bool_class.hh>
 
 #include <absl/container/btree_map.h>
@@ -54,7 +56,8 @@ public:
       raft::group_id group,
       model::ntp ntp,
       storage::kvstore& kvstore,
-      storage::storage_resources& resources);
+      storage::storage_resources& resources,
+      ss::sharded<features::feature_table>& feature_table);
 
     offset_translator(const offset_translator&) = delete;
     offset_translator& operator=(const offset_translator&) = delete;
@@ -124,8 +127,15 @@ public:
     /// Generate kv-store highest-known-offset key
     static bytes kvstore_highest_known_offset_key(raft::group_id group);
 
+    /// Generate kv-store keys of the compact offset map and of the gaps
+    /// appended after it
+    static bytes kvstore_compact_offsetmap_key(raft::group_id group);
+    static bytes kvstore_offsetmap_tail_key(raft::group_id group);
+
 private:
     ss::future<> do_checkpoint();
+    ss::future<> do_compact_checkpoint();
+    bool use_compact_checkpoints() const;
 
 private:
     std::vector<model::record_batch_type> _filtered_types;
@@ -154,8 +164,19 @@ private:
     size_t _bytes_processed_at_checkpoint = 0;
     size_t _map_version_at_checkpoint = 0;
 
+    // Compact checkpoints persist the whole map once and then only the gaps
+    // appended after it (the tail) until the map is modified other than by
+    // appending or the tail outgrows it. `_map_rewrites` counts the former.
+    size_t _map_rewrites = 0;
+    size_t _map_rewrites_at_checkpoint = 0;
+    uint64_t _compact_generation = 0;
+    std::optional<model::offset> _compact_map_last_offset;
+    size_t _compact_map_size = 0;
+    bool _legacy_map_persisted = false;
+
     storage::kvstore& _kvs;
     storage::storage_resources& _resources;
+    ss::sharded<features::feature_table>& _feature_table;
 };
 
 } // namespace storage
@@ -16,11 +16,14 @@
 #include "container/fragmented_vector.h"
 #include "model/fundamental.h"
 #include "serde/rw/envelope.h"
+#include "serde/rw/iobuf.h"
 #include "serde/rw/rw.h"
 #include "serde/rw/scalar.h"
 #include "serde/rw/vector.h"
 #include "storage/logger.h"
+#include "utils/delta_for.h"
 
+#include <array>
 #include <iterator>
 
 namespace storage {
@@ -357,6 +360,167 @@ struct persisted_batches_map
     auto serde_fields() { return std::tie(start_delta, batches); }
 };
 
+using offsets_column
+  = deltafor_encoder<int64_t, details::delta_delta<int64_t>, true>;
+using lengths_column = deltafor_encoder<int64_t, details::delta_xor, true>;
+constexpr size_t row_width = details::FOR_buffer_depth;
+
+template<typename Column>
+void write_column(iobuf& out, const Column& c) {
+    serde::write(out, c.get_initial_value());
+    serde::write(out, c.get_row_count());
+    serde::write(out, c.get_last_value());
+    serde::write(out, c.copy());
+}
+
+template<typename Column>
+Column read_column(iobuf_parser& in, const size_t bytes_left_limit) {
+    auto initial = serde::read_nested<int64_t>(in, bytes_left_limit);
+    auto cnt = serde::read_nested<uint32_t>(in, bytes_left_limit);
+    auto last = serde::read_nested<int64_t>(in, bytes_left_limit);
+    auto data = serde::read_nested<iobuf>(in, bytes_left_limit);
+    return Column(initial, cnt, last, std::move(data));
+}
+
+/// Column-wise encoding of persisted batches: base offsets are increasing and
+/// lengths are small, full rows of both are delta-FoR encoded. The last partial
+/// row is kept as is.
+struct compact_batches {
+    uint32_t size{0};
+    offsets_column base_offsets{0};
+    lengths_column lengths{0};
+    chunked_vector<persisted_batch> partial_row;
+
+    friend inline void read_nested(
+      iobuf_parser& in, compact_batches& b, const size_t bytes_left_limit) {
+        serde::read_nested(in, b.size, bytes_left_limit);
+        b.base_offsets = read_column<offsets_column>(in, bytes_left_limit);
+        b.lengths = read_column<lengths_column>(in, bytes_left_limit);
+        serde::read_nested(in, b.partial_row, bytes_left_limit);
+    }
+
+    friend inline void write(iobuf& out, compact_batches b) {
+        serde::write(out, b.size);
+        write_column(out, b.base_offsets);
+        write_column(out, b.lengths);
+        serde::write(out, std::move(b.partial_row));
+    }
+};
+
+/// The whole map. The first entry stands for all the gaps before the start
+/// of the translation range and may have an arbitrary base offset (e.g.
+/// offset::min()), it is kept out of the offsets column.
+struct compact_batches_map
+  : serde::envelope<
+      compact_batches_map,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    uint64_t generation{0};
+    int64_t start_delta{0};
+    persisted_batch base;
+    compact_batches batches;
+
+    auto serde_fields() {
+        return std::tie(generation, start_delta, base, batches);
+    }
+};
+
+/// Gaps appended after the compact map checkpoint `map_generation` whose last
+/// gap offset is `map_last_offset`.
+struct compact_batches_tail
+  : serde::envelope<
+      compact_batches_tail,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    uint64_t map_generation{0};
+    model::offset map_last_offset;
+    compact_batches batches;
+
+    auto serde_fields() {
+        return std::tie(map_generation, map_last_offset, batches);
+    }
+};
+
+persisted_batch
+to_persisted_batch(model::offset last_offset, model::offset base_offset) {
+    return persisted_batch{
+      .base_offset = base_offset,
+      .length = int32_t(last_offset - base_offset) + 1};
+}
+
+template<typename It>
+compact_batches encode_batches(It begin, It end, size_t size) {
+    compact_batches out;
+    out.size = size;
+    const size_t full_rows = size / row_width;
+    if (full_rows > 0) {
+        out.base_offsets = offsets_column(begin->second.base_offset());
+        out.lengths = lengths_column(0);
+    }
+    std::array<int64_t, row_width> offsets{};
+    std::array<int64_t, row_width> lengths{};
+    for (size_t row = 0; row < full_rows; ++row) {
+        for (size_t i = 0; i < row_width; ++i, ++begin) {
+            auto b = to_persisted_batch(begin->first, begin->second.base_offset);
+            offsets[i] = b.base_offset();
+            lengths[i] = b.length;
+        }
+        out.base_offsets.add(offsets);
+        out.lengths.add(lengths);
+    }
+    out.partial_row.reserve(size - full_rows * row_width);
+    for (; begin != end; ++begin) {
+        out.partial_row.push_back(
+          to_persisted_batch(begin->first, begin->second.base_offset));
+    }
+    return out;
+}
+
+chunked_vector<persisted_batch>
+decode_batches(const model::ntp& ntp, const compact_batches& in) {
+    chunked_vector<persisted_batch> out;
+    out.reserve(in.size);
+    if (in.base_offsets.get_row_count() != in.lengths.get_row_count()) {
+        throw std::runtime_error{fmt::format(
+          "ntp {}: inconsistency in serialized offset translator state: {} "
+          "rows of offsets and {} rows of lengths",
+          ntp,
+          in.base_offsets.get_row_count(),
+          in.lengths.get_row_count())};
+    }
+    if (in.base_offsets.get_row_count() > 0) {
+        deltafor_decoder<int64_t, details::delta_delta<int64_t>> offsets(
+          in.base_offsets.get_initial_value(),
+          in.base_offsets.get_row_count(),
+          in.base_offsets.share());
+        deltafor_decoder<int64_t> lengths(
+          in.lengths.get_initial_value(),
+          in.lengths.get_row_count(),
+          in.lengths.share());
+        std::array<int64_t, row_width> offsets_row{};
+        std::array<int64_t, row_width> lengths_row{};
+        while (offsets.read(offsets_row) && lengths.read(lengths_row)) {
+            for (size_t i = 0; i < row_width; ++i) {
+                out.push_back(persisted_batch{
+                  .base_offset = model::offset(offsets_row[i]),
+                  .length = int32_t(lengths_row[i])});
+            }
+        }
+    }
+    for (const auto& b : in.partial_row) {
+        out.push_back(b);
+    }
+    if (out.size() != in.size) {
+        throw std::runtime_error{fmt::format(
+          "ntp {}: inconsistency in serialized offset translator state: "
+          "decoded {} batches out of {}",
+          ntp,
+          out.size(),
+          in.size)};
+    }
+    return out;
+}
+
 } // namespace
 
 iobuf offset_translator_state::serialize_map() const {
@@ -368,9 +532,7 @@ iobuf offset_translator_state::serialize_map() const {
     chunked_vector<persisted_batch> batches;
     batches.reserve(_last_offset2batch.size());
     for (const auto& [o, b] : _last_offset2batch) {
-        int32_t length = int32_t(o - b.base_offset) + 1;
-        batches.push_back(
-          persisted_batch{.base_offset = b.base_offset, .length = length});
+        batches.push_back(to_persisted_batch(o, b.base_offset));
     }
 
     persisted_batches_map persisted{
@@ -381,21 +543,17 @@ iobuf offset_translator_state::serialize_map() const {
     return serde::to_iobuf(std::move(persisted));
 }
 
-offset_translator_state
-offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
-    auto persisted = serde::from_iobuf<persisted_batches_map>(std::move(buf));
-    if (persisted.batches.empty()) {
-        throw std::runtime_error{fmt::format(
-          "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
-    }
-
-    absl::btree_map<model::offset, batch_info> last_offset2batch;
-    int64_t cur_delta = persisted.start_delta;
-    model::offset prev_last_offset;
-    for (auto it = persisted.batches.begin(); it != persisted.batches.end();
-         ++it) {
+template<typename Batches>
+void offset_translator_state::append_batches(
+  const model::ntp& ntp,
+  batches_map_t& last_offset2batch,
+  int64_t& cur_delta,
+  const Batches& batches,
+  bool first_is_base) {
+    for (auto it = batches.begin(); it != batches.end(); ++it) {
         const persisted_batch& b = *it;
-        if (it != persisted.batches.begin()) {
+        if (!last_offset2batch.empty()) {
+            auto prev_last_offset = last_offset2batch.rbegin()->first;
             if (b.base_offset <= prev_last_offset) {
                 throw std::runtime_error{fmt::format(
                   "ntp {}: inconsistency in serialized offset translator "
@@ -404,6 +562,8 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
                   b.base_offset,
                   prev_last_offset)};
             }
+        }
+        if (!(first_is_base && it == batches.begin())) {
             cur_delta += b.length;
         }
 
@@ -411,14 +571,108 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
         last_offset2batch.emplace(
           last_offset,
           batch_info{.base_offset = b.base_offset, .next_delta = cur_delta});
-        prev_last_offset = last_offset;
+    }
+}
+
+offset_translator_state
+offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
+    auto persisted = serde::from_iobuf<persisted_batches_map>(std::move(buf));
+    if (persisted.batches.empty()) {
+        throw std::runtime_error{fmt::format(
+          "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
     }
 
     offset_translator_state state(std::move(ntp));
-    state._last_offset2batch = std::move(last_offset2batch);
+    int64_t cur_delta = persisted.start_delta;
+    append_batches(
+      state._ntp, state._last_offset2batch, cur_delta, persisted.batches, true);
     return state;
 }
 
+iobuf offset_translator_state::serialize_compact_map(
+  uint64_t generation) const {
+    vassert(
+      !_last_offset2batch.empty(),
+      "ntp {}: offsets map shouldn't be empty",
+      _ntp);
+    auto it = _last_offset2batch.begin();
+    compact_batches_map persisted{
+      .generation = generation,
+      .start_delta = it->second.next_delta,
+      .base = to_persisted_batch(it->first, it->second.base_offset),
+      .batches = encode_batches(
+        std::next(it), _last_offset2batch.end(), _last_offset2batch.size() - 1),
+    };
+    return serde::to_iobuf(std::move(persisted));
+}
+
+iobuf offset_translator_state::serialize_compact_tail(
+  uint64_t generation, model::offset after) const {
+    auto it = _last_offset2batch.upper_bound(after);
+    compact_batches_tail persisted{
+      .map_generation = generation,
+      .map_last_offset = after,
+      .batches = encode_batches(
+        it,
+        _last_offset2batch.end(),
+        std::distance(it, _last_offset2batch.end())),
+    };
+    return serde::to_iobuf(std::move(persisted));
+}
+
+offset_translator_state::compact_checkpoint
+offset_translator_state::from_compact_map(
+  model::ntp ntp, iobuf map_buf, std::optional<iobuf> tail_buf) {
+    auto persisted = serde::from_iobuf<compact_batches_map>(std::move(map_buf));
+
+    compact_checkpoint ret{
+      .state = offset_translator_state(std::move(ntp)),
+      .generation = persisted.generation,
+    };
+    auto& state = ret.state;
+    int64_t cur_delta = persisted.start_delta;
+    append_batches(
+      state._ntp,
+      state._last_offset2batch,
+      cur_delta,
+      std::array{persisted.base},
+      true);
+    append_batches(
+      state._ntp,
+      state._last_offset2batch,
+      cur_delta,
+      decode_batches(state._ntp, persisted.batches),
+      false);
+    ret.map_last_offset = state._last_offset2batch.rbegin()->first;
+    ret.map_size = state._last_offset2batch.size();
+
+    if (tail_buf) {
+        auto tail = serde::from_iobuf<compact_batches_tail>(
+          std::move(*tail_buf));
+        if (
+          tail.map_generation == ret.generation
+          && tail.map_last_offset == ret.map_last_offset) {
+            append_batches(
+              state._ntp,
+              state._last_offset2batch,
+              cur_delta,
+              decode_batches(state._ntp, tail.batches),
+              false);
+        } else {
+            vlog(
+              stlog.debug,
+              "ntp {}: ignoring offset translator tail of map {} ending at {}, "
+              "current map {} ends at {}",
+              state._ntp,
+              tail.map_generation,
+              tail.map_last_offset,
+              ret.generation,
+              ret.map_last_offset);
+        }
+    }
+    return ret;
+}
+
 offset_translator_state offset_translator_state::from_bootstrap_state(
   model::ntp ntp, const absl::btree_map<model::offset, int64_t>& offset2delta) {
     offset_translator_state state(std::move(ntp));
@@ -15,6 +15,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <optional>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -95,6 +97,25 @@ public:
     static offset_translator_state
     from_serialized_map(model::ntp ntp, iobuf buf);
 
+    /// Delta-FoR encoded counterpart of serialize_map(), tagged with the
+    /// `generation` of the checkpoint.
+    iobuf serialize_compact_map(uint64_t generation) const;
+
+    /// Encodes only the gaps whose last offset is greater than `after`, so that
+    /// they can be applied on top of the compact map checkpoint `generation`
+    /// whose last gap offset is `after`.
+    iobuf serialize_compact_tail(uint64_t generation, model::offset after) const;
+
+    struct compact_checkpoint;
+
+    /// Restores the state from a compact map and, if it extends that map, a
+    /// compact tail. A tail that belongs to another generation is ignored.
+    static compact_checkpoint from_compact_map(
+      model::ntp ntp, iobuf map_buf, std::optional<iobuf> tail_buf);
+
+    /// Number of entries in the map.
+    size_t size() const { return _last_offset2batch.size(); }
+
     /// Bootstrap offset translator state from the raft configuration manager
     /// state.
     static offset_translator_state from_bootstrap_state(
@@ -124,9 +145,25 @@ private:
     // way we can calculate delta for any offset starting from log_start.
     using batches_map_t = absl::btree_map<model::offset, batch_info>;
 
+    template<typename Batches>
+    static void append_batches(
+      const model::ntp&,
+      batches_map_t&,
+      int64_t& cur_delta,
+      const Batches&,
+      bool first_is_base);
+
 private:
     model::ntp _ntp;
     batches_map_t _last_offset2batch;
 };
 
+struct offset_translator_state::compact_checkpoint {
+    offset_translator_state state;
+    uint64_t generation{0};
+    // last gap offset and size of the compact map, not counting the tail
+    model::offset map_last_offset;
+    size_t map_size{0};
+};
+
 } // namespace storage
@@ -10,6 +10,7 @@
 #include "storage/parser_utils.h"
 
 #include "base/vlog.h"
+#include "bytes/iobuf_parser.h"
 #include "compression/compression.h"
 #include "model/compression.h"
 #include "model/record.h"
@@ -31,12 +32,44 @@ model::record_batch_reader decompress_batch_consumer::end_of_stream() {
     return model::make_memory_record_batch_reader(std::move(_batches));
 }
 
+namespace {
+
+model::record_batch
+make_decompressed_batch(const model::record_batch& b, iobuf body_buf) {
+    // must remove compression first!
+    auto h = b.header();
+    h.attrs.remove_compression();
+    reset_size_checksum_metadata(h, body_buf);
+    return model::record_batch(
+      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
+}
+
+} // namespace
+
 ss::future<model::record_batch> decompress_batch(model::record_batch&& b) {
-    return ss::futurize_invoke(decompress_batch_sync, std::move(b));
+    if (!b.compressed()) {
+        return ss::make_ready_future<model::record_batch>(std::move(b));
+    }
+    return ss::do_with(std::move(b), [](const model::record_batch& b) {
+        return decompress_batch(b);
+    });
 }
 
 ss::future<model::record_batch> decompress_batch(const model::record_batch& b) {
-    return ss::futurize_invoke(maybe_decompress_batch_sync, b);
+    if (unlikely(!b.compressed())) {
+        return ss::make_exception_future<model::record_batch>(
+          std::runtime_error(fmt_with_ctx(
+            fmt::format,
+            "Asked to decompressed a non-compressed batch:{}",
+            b.header())));
+    }
+    // Large batches may be decompressed off the reactor, the batch is kept
+    // alive by the caller until the returned future resolves.
+    return compression::offloading_compressor::uncompress(
+             b.data(), b.header().attrs.compression())
+      .then([&b](iobuf body_buf) {
+          return make_decompressed_batch(b, std::move(body_buf));
+      });
 }
 
 model::record_batch decompress_batch_sync(model::record_batch&& b) {
@@ -56,13 +89,46 @@ model::record_batch maybe_decompress_batch_sync(const model::record_batch& b) {
     }
     iobuf body_buf = compression::compressor::uncompress(
       b.data(), b.header().attrs.compression());
-    // must remove compression first!
-    auto h = b.header();
-    h.attrs.remove_compression();
-    reset_size_checksum_metadata(h, body_buf);
-    auto batch = model::record_batch(
-      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
-    return batch;
+    return make_decompressed_batch(b, std::move(body_buf));
+}
+
+decompressing_record_cursor::decompressing_record_cursor(
+  const model::record_batch& b)
+  : _decompressor(b.data(), b.header().attrs.compression())
+  , _remaining(b.record_count()) {}
+
+bool decompressing_record_cursor::fill() {
+    return _decompressor.next(_buffered) > 0;
+}
+
+model::record decompressing_record_cursor::next() {
+    // the record length is a varint, make sure it is buffered entirely
+    while (_buffered.size_bytes() < vint::max_length && fill()) {
+    }
+    if (_buffered.empty()) {
+        throw std::runtime_error(fmt::format(
+          "Compressed batch ended with {} records left", _remaining));
+    }
+    auto [record_size, length_size] = iobuf_const_parser(_buffered)
+                                        .read_varlong();
+    if (record_size < 0) {
+        throw std::runtime_error(
+          fmt::format("Invalid record size: {}", record_size));
+    }
+    const auto total = static_cast<size_t>(record_size) + length_size;
+    while (_buffered.size_bytes() < total) {
+        if (!fill()) {
+            throw std::runtime_error(fmt::format(
+              "Compressed batch ended in the middle of a record of {} bytes, "
+              "{} bytes available",
+              total,
+              _buffered.size_bytes()));
+        }
+    }
+    iobuf_parser parser(_buffered.share(0, total));
+    _buffered.trim_front(total);
+    --_remaining;
+    return model::parse_one_record_from_buffer(parser);
 }
 
 compress_batch_consumer::compress_batch_consumer(
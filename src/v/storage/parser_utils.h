@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "compression/stream_decompressor.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 
@@ -41,7 +42,9 @@ private:
 
 /// \brief batch decompression
 ss::future<model::record_batch> decompress_batch(model::record_batch&&);
-/// \brief batch decompression
+/// \brief batch decompression, the batch must be kept alive until the
+/// returned future resolves as large batches may be decompressed off the
+/// reactor.
 ss::future<model::record_batch> decompress_batch(const model::record_batch&);
 /// \brief synchronous batch decompression
 model::record_batch decompress_batch_sync(model::record_batch&&);
@@ -49,6 +52,28 @@ model::record_batch decompress_batch_sync(model::record_batch&&);
 /// \throw std::runtime_error If provided batch is not compressed
 model::record_batch maybe_decompress_batch_sync(const model::record_batch&);
 
+/// \brief Iterates over the records of a compressed batch decompressing them
+/// as they are consumed. Only the records that are being parsed are kept
+/// decompressed in memory, bounded by the decompression window, instead of the
+/// whole decompressed batch. The batch must outlive the cursor.
+class decompressing_record_cursor {
+public:
+    explicit decompressing_record_cursor(const model::record_batch&);
+
+    bool has_next() const { return _remaining > 0; }
+
+    /// \throw std::runtime_error If the batch is corrupted
+    model::record next();
+
+private:
+    // decompresses more of the batch, false once it is fully decompressed
+    bool fill();
+
+    compression::stream_decompressor _decompressor;
+    iobuf _buffered;
+    int32_t _remaining;
+};
+
 /// \brief batch compression
 ss::future<model::record_batch>
   compress_batch(model::compression, model::record_batch);
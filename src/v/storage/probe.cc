@@ -9,6 +9,7 @@
 
 #include "storage/probe.h"
 
+#include "base/unreachable.h"
 #include "config/configuration.h"
 #include "metrics/prometheus_sanitize.h"
 #include "storage/logger.h"
@@ -17,6 +18,8 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <type_traits>
 
 namespace storage {
@@ -92,10 +95,275 @@ void node_probe::setup_node_metrics() {
       });
 }
 
+struct probe::metric {
+    enum class kind { counter, total_bytes, gauge };
+
+    std::string_view name;
+    std::string_view description;
+    kind type;
+    // whether the values of partitions leaving a topic rollup are kept,
+    // false for metrics which are current values, e.g. the partition size
+    bool cumulative;
+    int64_t (*get)(const probe&);
+};
+
+namespace {
+template<typename F>
+ss::metrics::impl::metric_definition_impl make_metric(
+  const auto& m, F f, const std::vector<ss::metrics::label_instance>& labels) {
+    namespace sm = ss::metrics;
+    using kind = typename std::decay_t<decltype(m)>::kind;
+    auto name = ss::sstring(m.name);
+    auto description = sm::description(ss::sstring(m.description));
+    switch (m.type) {
+    case kind::counter:
+        return sm::make_counter(name, std::move(f), description, labels);
+    case kind::total_bytes:
+        return sm::make_total_bytes(name, std::move(f), description, labels);
+    case kind::gauge:
+        return sm::make_gauge(name, std::move(f), description, labels);
+    }
+    unreachable();
+}
+} // namespace
+
+const std::vector<probe::metric>& probe::partition_metrics() {
+    using enum metric::kind;
+    static const std::vector<metric> metrics{
+      {"written_bytes",
+       "Total number of bytes written",
+       total_bytes,
+       true,
+       [](const probe& p) -> int64_t { return p._bytes_written; }},
+      {"batches_written",
+       "Total number of batches written",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._batches_written; }},
+      {"read_bytes",
+       "Total number of bytes read",
+       total_bytes,
+       true,
+       [](const probe& p) -> int64_t { return p._bytes_read; }},
+      {"cached_read_bytes",
+       "Total number of cached bytes read",
+       total_bytes,
+       true,
+       [](const probe& p) -> int64_t { return p._cached_bytes_read; }},
+      {"batches_read",
+       "Total number of batches read",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._batches_read; }},
+      {"cached_batches_read",
+       "Total number of cached batches read",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._cached_batches_read; }},
+      {"log_segments_created",
+       "Total number of local log segments created since node startup",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._log_segments_created; }},
+      {"log_segments_removed",
+       "Total number of local log segments removed since node startup",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._log_segments_removed; }},
+      {"log_segments_active",
+       "Current number of local log segments",
+       counter,
+       false,
+       [](const probe& p) -> int64_t { return p._log_segments_active; }},
+      {"batch_parse_errors",
+       "Number of batch parsing (reading) errors",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._batch_parse_errors; }},
+      {"batch_write_errors",
+       "Number of batch write errors",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._batch_write_errors; }},
+      {"corrupted_compaction_indices",
+       "Number of times we had to re-construct the .compaction index on a "
+       "segment",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._corrupted_compaction_index; }},
+      {"compacted_segment",
+       "Number of compacted segments",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._segment_compacted; }},
+      {"partition_size",
+       "Current size of partition in bytes",
+       gauge,
+       false,
+       [](const probe& p) -> int64_t { return p._partition_bytes; }},
+      {"bytes_prefix_truncated",
+       "Number of bytes removed by prefix truncation.",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._bytes_prefix_truncated; }},
+      {"compaction_removed_bytes",
+       "Number of bytes removed by a compaction operation",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._compaction_removed_bytes; }},
+      {"tombstones_removed",
+       "Number of tombstone records removed by compaction due to the "
+       "delete.retention.ms setting.",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._tombstones_removed; }},
+      {"cleanly_compacted_segment",
+       "Number of segments cleanly compacted (i.e, had their keys "
+       "de-duplicated with all previous segments before them to the front "
+       "of the log)",
+       counter,
+       true,
+       [](const probe& p) -> int64_t { return p._segment_cleanly_compacted; }},
+      {"segments_marked_tombstone_free",
+       "Number of segments that have been verified through the compaction "
+       "process to be tombstone free.",
+       counter,
+       true,
+       [](const probe& p) -> int64_t {
+           return p._segments_marked_tombstone_free;
+       }},
+      {"complete_sliding_window_rounds",
+       "Number of rounds of sliding window compaction that have been driven "
+       "to completion.",
+       counter,
+       true,
+       [](const probe& p) -> int64_t {
+           return p._num_rounds_window_compaction;
+       }},
+    };
+    return metrics;
+}
+
+/*
+ * Storage metrics of the partitions of one topic on this shard.
+ *
+ * A shard with tens of thousands of partitions exports a series per
+ * partition and metric, scrapes then spend most of their time formatting
+ * them and the payload gets huge. With storage_metrics_topic_rollup the
+ * partitions of a topic register with its rollup instead, which exports a
+ * single series per metric and sums the values of its partitions when
+ * scraped. Cumulative values of partitions leaving the shard are kept so
+ * that the counters never go backwards.
+ */
+class probe::topic_rollup {
+public:
+    explicit topic_rollup(model::topic_namespace tn);
+    topic_rollup(const topic_rollup&) = delete;
+    topic_rollup& operator=(const topic_rollup&) = delete;
+    topic_rollup(topic_rollup&&) = delete;
+    topic_rollup& operator=(topic_rollup&&) = delete;
+    ~topic_rollup() = default;
+
+    /// Adds the partition to the rollup of its topic
+    static topic_rollup* attach(probe& p, const model::ntp& ntp);
+    /// Removes the partition, the rollup is gone after its last partition
+    void detach(probe& p);
+
+private:
+    int64_t value(size_t idx) const;
+
+    // rollups of the topics with partitions on this shard
+    static thread_local absl::
+      flat_hash_map<model::topic_namespace, std::unique_ptr<topic_rollup>>
+        _rollups;
+
+    model::topic_namespace _tn;
+    uncounted_intrusive_list<probe, &probe::_rollup_hook> _probes;
+    std::vector<int64_t> _retired;
+    metrics::internal_metric_groups _metrics;
+};
+
+thread_local absl::
+  flat_hash_map<model::topic_namespace, std::unique_ptr<probe::topic_rollup>>
+    probe::topic_rollup::_rollups;
+
+probe::topic_rollup*
+probe::topic_rollup::attach(probe& p, const model::ntp& ntp) {
+    model::topic_namespace tn(ntp.ns, ntp.tp.topic);
+    auto it = _rollups.find(tn);
+    if (it == _rollups.end()) {
+        auto rollup = std::make_unique<topic_rollup>(tn);
+        it = _rollups.emplace(std::move(tn), std::move(rollup)).first;
+    }
+    it->second->_probes.push_back(p);
+    return it->second.get();
+}
+
+probe::topic_rollup::topic_rollup(model::topic_namespace tn)
+  : _tn(std::move(tn))
+  , _retired(partition_metrics().size(), 0) {
+    namespace sm = ss::metrics;
+    const std::vector<sm::label_instance> labels = {
+      sm::label("namespace")(_tn.ns()),
+      sm::label("topic")(_tn.tp()),
+    };
+    std::vector<sm::impl::metric_definition_impl> defs;
+    const auto& metrics = partition_metrics();
+    for (size_t i = 0; i < metrics.size(); ++i) {
+        defs.push_back(
+          make_metric(metrics[i], [this, i] { return value(i); }, labels));
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:log"),
+      std::move(defs),
+      {},
+      {sm::shard_label});
+}
+
+void probe::topic_rollup::detach(probe& p) {
+    const auto& metrics = partition_metrics();
+    for (size_t i = 0; i < metrics.size(); ++i) {
+        if (metrics[i].cumulative) {
+            _retired[i] += metrics[i].get(p);
+        }
+    }
+    _probes.erase(_probes.iterator_to(p));
+    if (_probes.empty()) {
+        _rollups.erase(_tn);
+    }
+}
+
+int64_t probe::topic_rollup::value(size_t idx) const {
+    auto get = partition_metrics()[idx].get;
+    int64_t ret = _retired[idx];
+    for (const auto& p : _probes) {
+        ret += get(p);
+    }
+    return ret;
+}
+
+probe::~probe() { clear_metrics(); }
+
+void probe::clear_metrics() {
+    _metrics.clear();
+    if (_topic_rollup) {
+        _topic_rollup->detach(*this);
+        _topic_rollup = nullptr;
+    }
+}
+
+void probe::setup_topic_rollup(const model::ntp& ntp) {
+    _topic_rollup = topic_rollup::attach(*this, ntp);
+}
+
 void probe::setup_metrics(const model::ntp& ntp) {
     if (config::shard_local_cfg().disable_metrics()) {
         return;
     }
+    if (config::shard_local_cfg().storage_metrics_topic_rollup()) {
+        setup_topic_rollup(ntp);
+        return;
+    }
 
     namespace sm = ss::metrics;
     auto ns_label = sm::label("namespace");
@@ -109,121 +377,13 @@ void probe::setup_metrics(const model::ntp& ntp) {
 
     auto group_name = prometheus_sanitize::metrics_name("storage:log");
 
+    std::vector<sm::impl::metric_definition_impl> defs;
+    for (const auto& m : partition_metrics()) {
+        defs.push_back(make_metric(
+          m, [this, get = m.get] { return get(*this); }, labels));
+    }
     _metrics.add_group(
-      group_name,
-      {
-        sm::make_total_bytes(
-          "written_bytes",
-          [this] { return _bytes_written; },
-          sm::description("Total number of bytes written"),
-          labels),
-        sm::make_counter(
-          "batches_written",
-          [this] { return _batches_written; },
-          sm::description("Total number of batches written"),
-          labels),
-        sm::make_total_bytes(
-          "read_bytes",
-          [this] { return _bytes_read; },
-          sm::description("Total number of bytes read"),
-          labels),
-        sm::make_total_bytes(
-          "cached_read_bytes",
-          [this] { return _cached_bytes_read; },
-          sm::description("Total number of cached bytes read"),
-          labels),
-        sm::make_counter(
-          "batches_read",
-          [this] { return _batches_read; },
-          sm::description("Total number of batches read"),
-          labels),
-        sm::make_counter(
-          "cached_batches_read",
-          [this] { return _cached_batches_read; },
-          sm::description("Total number of cached batches read"),
-          labels),
-        sm::make_counter(
-          "log_segments_created",
-          [this] { return _log_segments_created; },
-          sm::description(
-            "Total number of local log segments created since node startup"),
-          labels),
-        sm::make_counter(
-          "log_segments_removed",
-          [this] { return _log_segments_removed; },
-          sm::description(
-            "Total number of local log segments removed since node startup"),
-          labels),
-        sm::make_counter(
-          "log_segments_active",
-          [this] { return _log_segments_active; },
-          sm::description("Current number of local log segments"),
-          labels),
-        sm::make_counter(
-          "batch_parse_errors",
-          [this] { return _batch_parse_errors; },
-          sm::description("Number of batch parsing (reading) errors"),
-          labels),
-        sm::make_counter(
-          "batch_write_errors",
-          [this] { return _batch_write_errors; },
-          sm::description("Number of batch write errors"),
-          labels),
-        sm::make_counter(
-          "corrupted_compaction_indices",
-          [this] { return _corrupted_compaction_index; },
-          sm::description("Number of times we had to re-construct the "
-                          ".compaction index on a segment"),
-          labels),
-        sm::make_counter(
-          "compacted_segment",
-          [this] { return _segment_compacted; },
-          sm::description("Number of compacted segments"),
-          labels),
-        sm::make_gauge(
-          "partition_size",
-          [this] { return _partition_bytes; },
-          sm::description("Current size of partition in bytes"),
-          labels),
-        sm::make_counter(
-          "bytes_prefix_truncated",
-          [this] { return _bytes_prefix_truncated; },
-          sm::description("Number of bytes removed by prefix truncation."),
-          labels),
-        sm::make_counter(
-          "compaction_removed_bytes",
-          [this] { return _compaction_removed_bytes; },
-          sm::description("Number of bytes removed by a compaction operation"),
-          labels),
-        sm::make_counter(
-          "tombstones_removed",
-          [this] { return _tombstones_removed; },
-          sm::description("Number of tombstone records removed by compaction "
-                          "due to the delete.retention.ms setting."),
-          labels),
-        sm::make_counter(
-          "cleanly_compacted_segment",
-          [this] { return _segment_cleanly_compacted; },
-          sm::description(
-            "Number of segments cleanly compacted (i.e, had their "
-            "keys de-duplicated with all previous segments "
-            "before them to the front of the log)"),
-          labels),
-        sm::make_counter(
-          "segments_marked_tombstone_free",
-          [this] { return _segments_marked_tombstone_free; },
-          sm::description("Number of segments that have been verified through "
-                          "the compaction process to be tombstone free."),
-          labels),
-        sm::make_counter(
-          "complete_sliding_window_rounds",
-          [this] { return _num_rounds_window_compaction; },
-          sm::description("Number of rounds of sliding window compaction that "
-                          "have been driven to completion."),
-          labels),
-      },
-      {},
-      {sm::shard_label, partition_label});
+      group_name, std::move(defs), {}, {sm::shard_label, partition_label});
 
     _metrics.add_group(
       group_name,
@@ -289,6 +449,23 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _cache_misses; },
           sm::description("Reader cache misses"),
           labels),
+        sm::make_counter(
+          "filtered_cache_hits",
+          [this] { return _filtered_cache_hits; },
+          sm::description("Reader cache hits for batch type filtered reads"),
+          labels),
+        sm::make_counter(
+          "filtered_cache_misses",
+          [this] { return _filtered_cache_misses; },
+          sm::description("Reader cache misses for batch type filtered reads"),
+          labels),
+        sm::make_counter(
+          "readers_retained",
+          [this] { return _readers_retained; },
+          sm::description(
+            "Number of eviction passes that kept an idle reader past the "
+            "eviction timeout because of its reuse interval"),
+          labels),
       },
       {},
       {sm::shard_label, partition_label});
@@ -10,6 +10,7 @@
  */
 
 #pragma once
+#include "container/intrusive_list_helpers.h"
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
 #include "storage/fwd.h"
@@ -57,7 +58,7 @@ public:
     probe& operator=(const probe&) = delete;
     probe(probe&&) = delete;
     probe& operator=(probe&&) = delete;
-    ~probe() = default;
+    ~probe();
 
     void add_bytes_written(uint64_t written) {
         _partition_bytes += written;
@@ -121,13 +122,19 @@ public:
     /**
      * Clears all probe related metrics
      */
-    void clear_metrics() { _metrics.clear(); }
+    void clear_metrics();
 
     void add_bytes_prefix_truncated(size_t bytes) {
         _bytes_prefix_truncated += bytes;
     }
 
 private:
+    class topic_rollup;
+    struct metric;
+    static const std::vector<metric>& partition_metrics();
+
+    void setup_topic_rollup(const model::ntp&);
+
     uint64_t _partition_bytes = 0;
     uint64_t _bytes_written = 0;
     uint64_t _bytes_read = 0;
@@ -154,5 +161,9 @@ private:
     ssize_t _compaction_removed_bytes = 0;
 
     metrics::internal_metric_groups _metrics;
+
+    // set when storage_metrics_topic_rollup is enabled
+    topic_rollup* _topic_rollup{nullptr};
+    safe_intrusive_list_hook _rollup_hook;
 };
 } // namespace storage
@@ -137,15 +137,17 @@ readers_cache::get_reader(const log_reader_config& cfg) {
      * dispose unused readers in background
      */
     dispose_in_background(std::move(to_evict), "evicted in get_reader");
+    const bool filtered = cfg.type_filter.has_value();
     if (it == _readers.end()) {
-        _probe.cache_miss();
+        _probe.cache_miss(filtered);
         vlog(stlog.trace, "{} - reader cache miss for: {}", _ntp, cfg);
         return std::nullopt;
     }
     auto& e = *it;
     vlog(stlog.trace, "{} - reader cache hit for: {}", _ntp, cfg);
     it->reader->reset_config(cfg);
-    _probe.cache_hit();
+    it->record_reuse(ss::lowres_clock::now());
+    _probe.cache_hit(filtered);
 
     // we use cached_reader wrapper to track reader usage, when cached_reader is
     // destroyed we unlock reader and trigger eviction
@@ -350,14 +352,25 @@ ss::future<> readers_cache::maybe_evict() {
     auto now = ss::lowres_clock::now();
     co_await evict_if([this, now](entry& e) {
         const auto invalid = !e.reader->is_reusable() || !e.valid;
-        const auto outdated = e.last_used + _eviction_timeout < now;
+        const auto idle = now - e.last_used;
+        const auto outdated = idle > retention(e);
+        if (!invalid && !outdated && idle > _eviction_timeout) {
+            _probe.reader_retained();
+        }
         return invalid || outdated;
     });
 }
 
+ss::lowres_clock::duration readers_cache::retention(const entry& e) const {
+    const ss::lowres_clock::duration timeout = _eviction_timeout;
+    return std::clamp(
+      e.reuse_interval * 2, timeout, timeout * max_retention_factor);
+}
+
 inline bool readers_cache::over_size_limit() const {
-    return !_readers.empty()
-           && _readers.size() + _in_use.size() > _target_max_size();
+    const auto max_size = std::min(
+      _target_max_size(), _max_size_limit.value_or(_target_max_size()));
+    return !_readers.empty() && _readers.size() + _in_use.size() > max_size;
 }
 
 void readers_cache::maybe_evict_size() {
@@ -377,7 +390,10 @@ void readers_cache::maybe_evict_size() {
 
 readers_cache::stats readers_cache::get_stats() const {
     return readers_cache::stats{
-      .in_use_readers = _in_use.size(), .cached_readers = _readers.size()};
+      .in_use_readers = _in_use.size(),
+      .cached_readers = _readers.size(),
+      .cache_hits = _probe.cache_hits(),
+      .cache_misses = _probe.cache_misses()};
 }
 
 } // namespace storage
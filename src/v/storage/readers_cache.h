@@ -35,12 +35,20 @@ namespace storage {
  * interface to force readers eviction in face of truncation and segments
  * removal. Readers are evicted from the cache according to LRU policy and
  * automatically when they can not longer be reused (f.e. EOF).
+ *
+ * Idle readers are kept for at least the eviction timeout. Consumers fetching
+ * at a steady but slower cadence would otherwise lose their reader between
+ * every fetch, so each entry tracks a moving average of the idle time between
+ * its reuses and its retention is stretched to cover the next expected fetch,
+ * up to `max_retention_factor` times the eviction timeout.
  */
 class readers_cache {
 public:
     struct stats {
         size_t in_use_readers;
         size_t cached_readers;
+        uint64_t cache_hits{0};
+        uint64_t cache_misses{0};
     };
     using offset_range = std::pair<model::offset, model::offset>;
     class range_lock_holder {
@@ -84,6 +92,14 @@ public:
 
     stats get_stats() const;
 
+    /**
+     * Further limit the number of readers kept in the cache below the
+     * configured target size, std::nullopt removes the limit.
+     */
+    void set_max_size_limit(std::optional<size_t> limit) {
+        _max_size_limit = limit;
+    }
+
     /**
      * Evict readers. No new readers holding log to given offset can be added to
      * the cache under range_lock_holder is destroyed
@@ -105,6 +121,8 @@ public:
 private:
     friend struct readers_cache_test_fixture;
     struct entry;
+    static constexpr int max_retention_factor = 4;
+
     void touch(entry* e) {
         e->last_used = ss::lowres_clock::now();
         _readers.erase(_readers.iterator_to(*e));
@@ -116,11 +134,30 @@ private:
      */
     struct entry {
         model::record_batch_reader make_cached_reader(readers_cache*);
+        /**
+         * Called when the reader is taken out of the cache, folds the idle
+         * time since it was last returned into the reuse interval average.
+         */
+        void record_reuse(ss::lowres_clock::time_point now) {
+            const auto idle = now - last_used;
+            reuse_interval = reuse_interval == ss::lowres_clock::duration{0}
+                               ? idle
+                               : (reuse_interval * 3 + idle) / 4;
+            last_used = now;
+        }
+
         std::unique_ptr<log_reader> reader;
         ss::lowres_clock::time_point last_used = ss::lowres_clock::now();
+        ss::lowres_clock::duration reuse_interval{0};
         bool valid = true;
         safe_intrusive_list_hook _hook;
     };
+
+    /**
+     * How long an idle entry is kept, enough to survive twice its reuse
+     * interval but never less than the eviction timeout.
+     */
+    ss::lowres_clock::duration retention(const entry&) const;
     /**
      * RAII based entry lock guard, it touches entry in a cache and handles
      * locking logic. Entry is unlocked when cached reader is destroyed
@@ -143,6 +180,7 @@ private:
              * requested to be evicted
              */
             if (_e->reader->is_reusable() && _e->valid) {
+                _e->last_used = ss::lowres_clock::now();
                 _cache->_readers.push_back(*_e);
             } else {
                 auto msg = _e->reader->is_reusable()
@@ -210,6 +248,7 @@ private:
     counted_intrusive_list<entry, &entry::_hook> _readers;
     counted_intrusive_list<entry, &entry::_hook> _in_use;
     config::binding<size_t> _target_max_size;
+    std::optional<size_t> _max_size_limit;
     /**
      * When offset range is locked any new readers for given offset will not be
      * added to cache.
@@ -13,17 +13,33 @@ class readers_cache_probe {
 public:
     void reader_added() { _readers_added++; }
     void reader_evicted() { _readers_evicted++; }
-    void cache_hit() { _cache_hits++; }
-    void cache_miss() { _cache_misses++; }
+    /// filtered readers only return batches of a single type (f.e. raft
+    /// configuration lookups), they are tracked separately as they rarely
+    /// share a reader with data fetches
+    void cache_hit(bool filtered) {
+        _cache_hits++;
+        _filtered_cache_hits += filtered;
+    }
+    void cache_miss(bool filtered) {
+        _cache_misses++;
+        _filtered_cache_misses += filtered;
+    }
+    void reader_retained() { _readers_retained++; }
     void clear() { _metrics.clear(); }
 
     void setup_metrics(const model::ntp& ntp);
 
+    uint64_t cache_hits() const { return _cache_hits; }
+    uint64_t cache_misses() const { return _cache_misses; }
+
 private:
     uint64_t _readers_added{0};
     uint64_t _readers_evicted{0};
     uint64_t _cache_misses{0};
     uint64_t _cache_hits{0};
+    uint64_t _filtered_cache_misses{0};
+    uint64_t _filtered_cache_hits{0};
+    uint64_t _readers_retained{0};
 
     metrics::internal_metric_groups _metrics;
 };
@@ -153,6 +153,37 @@ ss::future<usage> segment::persistent_size() {
     co_return u;
 }
 
+ss::future<> segment::truncate_gradually(
+  std::filesystem::path path, size_t file_size, size_t step) {
+    ss::file f;
+    try {
+        f = co_await ss::open_file_dma(path.string(), ss::open_flags::rw);
+        // the last step is released by the unlink
+        while (file_size > step) {
+            file_size -= std::min(file_size - step, step);
+            co_await f.truncate(file_size);
+        }
+    } catch (...) {
+        // the unlink which follows releases whatever is left
+        vlog(
+          stlog.debug,
+          "error truncating {} before removal: {}",
+          path,
+          std::current_exception());
+    }
+    if (f) {
+        try {
+            co_await f.close();
+        } catch (...) {
+            vlog(
+              stlog.debug,
+              "error closing {} before removal: {}",
+              path,
+              std::current_exception());
+        }
+    }
+}
+
 ss::future<size_t>
 segment::remove_persistent_state(std::filesystem::path path) {
     size_t file_size = 0;
@@ -166,6 +197,12 @@ segment::remove_persistent_state(std::filesystem::path path) {
          */
     }
 
+    const auto truncate_step
+      = config::shard_local_cfg().storage_file_removal_truncate_step();
+    if (truncate_step.has_value() && file_size > *truncate_step) {
+        co_await truncate_gradually(path, file_size, *truncate_step);
+    }
+
     try {
         co_await ss::remove_file(path.c_str());
         vlog(stlog.debug, "removed: {} size {}", path, file_size);
@@ -294,6 +294,10 @@ private:
     void release_appender_in_background(readers_cache* readers_cache);
 
     ss::future<size_t> remove_persistent_state(std::filesystem::path);
+    /// Shrinks the file in \p step sized decrements, so that the file system
+    /// releases its extents gradually instead of all at once on unlink.
+    static ss::future<>
+    truncate_gradually(std::filesystem::path, size_t file_size, size_t step);
 
     struct appender_callbacks : segment_appender::callbacks {
         explicit appender_callbacks(segment* segment)
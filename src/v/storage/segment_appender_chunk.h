@@ -19,6 +19,7 @@
 #include <seastar/core/aligned_buffer.hh>
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <ostream>
 
@@ -31,12 +32,23 @@ public:
     explicit segment_appender_chunk(size_t size, alignment alignment)
       : _chunk_size(size)
       , _alignment(alignment)
-      , _buf(ss::allocate_aligned_buffer<char>(_chunk_size, alignment)) {
+      , _buf(
+          ss::allocate_aligned_buffer<char>(_chunk_size, alignment).release(),
+          buffer_deleter{}) {
         // zero-out the buffer in case the alloctor gaves us a recycled buffer
         // that was from a valid previous segment.
         reset();
     }
 
+    /// Chunk over memory owned by someone else, e.g. a reserved arena. The
+    /// memory must be aligned and outlive the chunk.
+    segment_appender_chunk(char* buf, size_t size, alignment alignment)
+      : _chunk_size(size)
+      , _alignment(alignment)
+      , _buf(buf, buffer_deleter{.owned = false}) {
+        reset();
+    }
+
     segment_appender_chunk(const segment_appender_chunk&) = delete;
     segment_appender_chunk& operator=(const segment_appender_chunk&) = delete;
     segment_appender_chunk(segment_appender_chunk&&) noexcept = delete;
@@ -49,6 +61,8 @@ public:
     alignment alignment() const { return _alignment; }
     size_t space_left() const { return _chunk_size - _pos; }
     size_t size() const { return _pos; }
+    /// true if the chunk memory is not owned by the chunk
+    bool borrowed() const { return !_buf.get_deleter().owned; }
 
     /// \brief size() aligned to the _alignment
     size_t dma_size() const {
@@ -109,11 +123,20 @@ public:
     intrusive_list_hook hook;
 
 private:
+    struct buffer_deleter {
+        bool owned{true};
+        void operator()(char* p) const noexcept {
+            if (owned) {
+                ::free(p); // NOLINT(cppcoreguidelines-no-malloc)
+            }
+        }
+    };
+
     size_t _chunk_size{0};
     storage::alignment _alignment{0};
     size_t _pos{0};
     size_t _flushed_pos{0};
-    std::unique_ptr<char[], ss::free_deleter> _buf;
+    std::unique_ptr<char[], buffer_deleter> _buf;
     friend std::ostream&
     operator<<(std::ostream& o, const segment_appender_chunk& c) {
         return o << "{_alignment:" << c._alignment << ", _pos:" << c._pos
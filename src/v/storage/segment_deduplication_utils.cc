@@ -9,6 +9,7 @@
 
 #include "storage/segment_deduplication_utils.h"
 
+#include "container/chunked_hash_map.h"
 #include "model/timestamp.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
@@ -57,10 +58,99 @@ ss::future<bool> should_keep(
     // that indexed.
     co_return o >= latest_offset_indexed.value();
 }
+
+ss::future<ss::stop_iteration> count_retained_entry(
+  const key_offset_map& map,
+  const compacted_index::entry& e,
+  retained_records_t& retained,
+  bool& usable) {
+    if (e.type != compacted_index::entry_type::key) {
+        // entries of truncated batches may still be in the index
+        usable = false;
+        co_return ss::stop_iteration::yes;
+    }
+    if (retained[e.offset] < 0) {
+        co_return ss::stop_iteration::no;
+    }
+    const auto o = e.offset + model::offset_delta(e.delta);
+    auto latest = co_await map.get(e.key);
+    auto& count = retained[e.offset];
+    count = !latest.has_value() || o >= latest.value() ? count + 1 : -1;
+    co_return ss::stop_iteration::no;
+}
+
+ss::future<std::optional<retained_records_t>> count_retained_records(
+  const compaction_config& cfg, const key_offset_map& map, const segment& seg) {
+    auto compaction_idx_path = seg.path().to_compacted_index();
+    std::optional<compacted_index_reader> rdr;
+    std::exception_ptr eptr;
+    retained_records_t retained;
+    bool usable = true;
+    try {
+        rdr.emplace(make_file_backed_compacted_reader(
+          compaction_idx_path,
+          co_await internal::make_reader_handle(
+            compaction_idx_path, cfg.sanitizer_config),
+          cfg.iopc,
+          64_KiB,
+          cfg.asrc));
+        co_await rdr->verify_integrity();
+        co_await rdr->for_each_async(
+          [&map, &retained, &usable](const compacted_index::entry& e) {
+              return count_retained_entry(map, e, retained, usable);
+          },
+          model::no_timeout);
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    if (rdr) {
+        co_await rdr->close();
+    }
+    if (eptr) {
+        vlog(
+          gclog.debug,
+          "Filtering every batch of {}, couldn't read its compacted index: {}",
+          seg.path(),
+          eptr);
+        co_return std::nullopt;
+    }
+    if (!usable) {
+        co_return std::nullopt;
+    }
+    co_return retained;
+}
+
 } // anonymous namespace
 
+void retained_records_cache::put(
+  const segment& seg, retained_records_t retained) {
+    // rough estimate of the hash map footprint
+    static constexpr size_t bytes_per_batch = 32;
+    _memory_bytes += retained.size() * bytes_per_batch;
+    _segments.insert_or_assign(
+      seg.offsets().get_base_offset(),
+      entry{
+        .generation = seg.get_generation_id(),
+        .retained = std::move(retained),
+      });
+}
+
+const retained_records_t*
+retained_records_cache::get(const segment& seg) const {
+    auto it = _segments.find(seg.offsets().get_base_offset());
+    if (
+      it == _segments.end()
+      || it->second.generation != seg.get_generation_id()) {
+        return nullptr;
+    }
+    return &it->second.retained;
+}
+
 ss::future<bool> build_offset_map_for_segment(
-  const compaction_config& cfg, const segment& seg, key_offset_map& m) {
+  const compaction_config& cfg,
+  const segment& seg,
+  key_offset_map& m,
+  retained_records_cache* cache) {
     auto compaction_idx_path = seg.path().to_compacted_index();
     auto compaction_idx_file = co_await internal::make_reader_handle(
       compaction_idx_path, cfg.sanitizer_config);
@@ -83,11 +173,47 @@ ss::future<bool> build_offset_map_for_segment(
         std::rethrow_exception(eptr);
     }
     bool fully_indexed = true;
+    std::optional<chunked_vector<compacted_index::entry>> buffered;
+    size_t buffered_bytes = 0;
+    if (cache != nullptr && cache->has_room()) {
+        buffered.emplace();
+    }
+    const auto generation = seg.get_generation_id();
     co_await rdr.for_each_async(
-      [&m, &fully_indexed](const compacted_index::entry& idx_entry) {
+      [&m, &fully_indexed, &buffered, &buffered_bytes](
+        const compacted_index::entry& idx_entry) {
+          if (buffered.has_value()) {
+              buffered_bytes += sizeof(idx_entry) + idx_entry.key.size();
+              if (
+                buffered_bytes
+                > retained_records_cache::max_buffered_entries_bytes) {
+                  buffered.reset();
+              } else {
+                  buffered->emplace_back(
+                    idx_entry.type,
+                    idx_entry.key,
+                    idx_entry.offset,
+                    idx_entry.delta);
+              }
+          }
           return put_entry(m, idx_entry, fully_indexed);
       },
       model::no_timeout);
+    if (
+      fully_indexed && buffered.has_value()
+      && generation == seg.get_generation_id()) {
+        retained_records_t retained;
+        bool usable = true;
+        for (const auto& e : *buffered) {
+            auto stop = co_await count_retained_entry(m, e, retained, usable);
+            if (stop == ss::stop_iteration::yes) {
+                break;
+            }
+        }
+        if (usable) {
+            cache->put(seg, std::move(retained));
+        }
+    }
     co_return fully_indexed;
 }
 
@@ -97,7 +223,8 @@ ss::future<model::offset> build_offset_map(
   ss::lw_shared_ptr<storage::stm_manager> stm_manager,
   storage_resources& resources,
   storage::probe& probe,
-  key_offset_map& m) {
+  key_offset_map& m,
+  retained_records_cache* cache) {
     if (segs.empty()) {
         throw std::runtime_error("No segments to build offset map");
     }
@@ -141,7 +268,7 @@ ss::future<model::offset> build_offset_map(
         }
 
         auto seg_fully_indexed = co_await build_offset_map_for_segment(
-          cfg, *seg, m);
+          cfg, *seg, m, cache);
         if (!seg_fully_indexed) {
             // The offset map is full. Note that we may have only partially
             // indexed a segment, but it's safe to use this index. If no new
@@ -174,7 +301,8 @@ ss::future<index_state> deduplicate_segment(
   probe& probe,
   offset_delta_time should_offset_delta_times,
   ss::sharded<features::feature_table>& feature_table,
-  bool inject_reader_failure) {
+  bool inject_reader_failure,
+  const retained_records_cache* cache) {
     auto read_holder = co_await seg->read_lock();
     if (seg->is_closed()) {
         throw segment_closed_exception();
@@ -187,6 +315,28 @@ ss::future<index_state> deduplicate_segment(
     const bool past_tombstone_delete_horizon
       = internal::is_past_tombstone_delete_horizon(seg, cfg);
     bool may_have_tombstone_records = false;
+
+    // batches none of whose records are superseded are copied without being
+    // decompressed, unless they may have tombstones to remove
+    std::optional<retained_records_t> counted;
+    const retained_records_t* retained = nullptr;
+    internal::copy_data_segment_reducer::batch_filter_t keep_batch;
+    if (
+      !past_tombstone_delete_horizon
+      || !seg->index().may_have_tombstone_records()) {
+        retained = cache != nullptr ? cache->get(*seg) : nullptr;
+        if (retained == nullptr) {
+            counted = co_await count_retained_records(cfg, map, *seg);
+            retained = counted.has_value() ? &counted.value() : nullptr;
+        }
+    }
+    if (retained != nullptr) {
+        keep_batch = [retained](const model::record_batch_header& h) {
+            auto it = retained->find(h.base_offset);
+            return it != retained->end() && it->second == h.record_count;
+        };
+    }
+
     auto copy_reducer = internal::copy_data_segment_reducer(
       [&map,
        &may_have_tombstone_records,
@@ -233,7 +383,8 @@ ss::future<index_state> deduplicate_segment(
       seg->offsets().get_committed_offset(),
       &cmp_idx_writer,
       inject_reader_failure,
-      cfg.asrc);
+      cfg.asrc,
+      std::move(keep_batch));
 
     auto res = co_await std::move(rdr).consume(
       std::move(copy_reducer), model::no_timeout);
@@ -258,6 +409,7 @@ ss::future<index_state> deduplicate_segment(
     new_idx.clean_compact_timestamp = seg->index().clean_compact_timestamp();
 
     // Set may_have_tombstone_records
+    may_have_tombstone_records |= stats.tombstones_copied > 0;
     new_idx.may_have_tombstone_records = may_have_tombstone_records;
 
     if (
@@ -9,20 +9,62 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/units.h"
+#include "container/chunked_hash_map.h"
 #include "model/fundamental.h"
 #include "storage/fwd.h"
 #include "storage/index_state.h"
+#include "storage/segment.h"
 #include "storage/segment_set.h"
 
 namespace storage {
 using segment_list_t = fragmented_vector<segment_set::type>;
 class stm_manager;
 
+// Number of records of every batch of a segment that are retained given the
+// offset map, according to the segment's compacted index. Batches with a
+// superseded record are set to -1.
+using retained_records_t = chunked_hash_map<model::offset, int32_t>;
+
+// Retained record counts of the segments which were fully indexed while
+// building an offset map. Once a segment is fully indexed, the entries of
+// its keys in the map are final, so the counts can be computed from the
+// index entries read for the map instead of reading the compacted index
+// again when the segment is deduplicated.
+class retained_records_cache {
+public:
+    // Index entries of a segment kept in memory to compute its counts
+    static constexpr size_t max_buffered_entries_bytes = 4_MiB;
+    // Estimated memory of all the cached counts
+    static constexpr size_t max_memory_bytes = 16_MiB;
+
+    bool has_room() const { return _memory_bytes < max_memory_bytes; }
+
+    void put(const segment& seg, retained_records_t retained);
+
+    // Returns the counts of the segment if they were computed for its
+    // current generation
+    const retained_records_t* get(const segment& seg) const;
+
+private:
+    struct entry {
+        segment::generation_id generation;
+        retained_records_t retained;
+    };
+    chunked_hash_map<model::offset, entry> _segments;
+    size_t _memory_bytes{0};
+};
+
 // Adds the keys from the given compacted index reader to the map. Returns
 // true if the entire reader was successfully indexed, false if the index was
-// full before reaching the end of the segment.
+// full before reaching the end of the segment. If the segment is fully
+// indexed its retained record counts are added to the cache, if one is given
+// and has room.
 ss::future<bool> build_offset_map_for_segment(
-  const compaction_config& cfg, const segment& seg, key_offset_map& m);
+  const compaction_config& cfg,
+  const segment& seg,
+  key_offset_map& m,
+  retained_records_cache* cache = nullptr);
 
 // Builds a map from key to latest offset from the last segment to the
 // earliest segment in 'segs'.
@@ -45,10 +87,13 @@ ss::future<model::offset> build_offset_map(
   ss::lw_shared_ptr<storage::stm_manager> stm_manager,
   storage::storage_resources&,
   storage::probe&,
-  key_offset_map&);
+  key_offset_map&,
+  retained_records_cache* cache = nullptr);
 
 // Rewrites 'seg' according to the parameters in 'cfg' to 'appender' and
 // 'cmp_idx_writer', deduplicating with latest offsets per key from 'map'.
+// The retained record counts are taken from 'cache' if they were computed
+// while building 'map', otherwise they are read from the compacted index.
 ss::future<index_state> deduplicate_segment(
   const compaction_config& cfg,
   const key_offset_map& map,
@@ -58,6 +103,7 @@ ss::future<index_state> deduplicate_segment(
   storage::probe& probe,
   offset_delta_time should_offset_delta_times,
   ss::sharded<features::feature_table>&,
-  bool inject_reader_failure = false);
+  bool inject_reader_failure = false,
+  const retained_records_cache* cache = nullptr);
 
 } // namespace storage
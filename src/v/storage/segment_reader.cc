@@ -11,6 +11,7 @@
 
 #include "base/vassert.h"
 #include "base/vlog.h"
+#include "config/configuration.h"
 #include "ssx/future-util.h"
 #include "storage/logger.h"
 #include "storage/segment_utils.h"
@@ -74,10 +75,7 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
 
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
+    auto options = stream_options(pc);
 
     ss::gate::holder guard{_gate};
 
@@ -87,6 +85,33 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     co_return std::move(handle);
 }
 
+ss::file_input_stream_options
+segment_reader::stream_options(const ss::io_priority_class pc) {
+    ss::file_input_stream_options options;
+    options.buffer_size = _buffer_size;
+    options.io_priority_class = pc;
+    options.read_ahead = _read_ahead;
+
+    // Streams of the same segment share a history of how much of the data
+    // that was read ahead was actually consumed. Seastar uses it to grow the
+    // read-ahead and buffer size of sequential readers up to the configured
+    // bounds and to shrink them for readers that stop early.
+    const auto max_read_ahead
+      = config::shard_local_cfg().storage_read_max_readahead_count();
+    if (max_read_ahead.has_value() && *max_read_ahead > 0) {
+        const auto max = static_cast<unsigned>(*max_read_ahead);
+        if (max > _read_ahead) {
+            if (!_read_history) {
+                _read_history
+                  = ss::make_lw_shared<ss::file_input_stream_history>();
+            }
+            options.read_ahead = max;
+            options.dynamic_adjustments = _read_history;
+        }
+    }
+    return options;
+}
+
 ss::future<segment_reader_handle> segment_reader::get() {
     vlog(
       stlog.trace,
@@ -155,10 +180,7 @@ ss::future<segment_reader_handle> segment_reader::data_stream(
       pos_begin,
       pos_end,
       *this);
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
+    auto options = stream_options(pc);
 
     ss::gate::holder guard{_gate};
     auto handle = co_await get();
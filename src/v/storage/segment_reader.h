@@ -163,6 +163,9 @@ private:
     size_t _file_size{0};
     size_t _buffer_size{0};
     unsigned _read_ahead{0};
+    // Consumption history driving adaptive read-ahead of sequential readers.
+    // Only allocated if storage_read_max_readahead_count is set.
+    ss::lw_shared_ptr<ss::file_input_stream_history> _read_history;
     std::optional<ntp_sanitizer_config> _sanitizer_config;
 
     // Keeps track of operations that cannot be pre-empted by close()
@@ -170,6 +173,9 @@ private:
     // Acquire a handle to use the underlying file handle
     ss::future<segment_reader_handle> get();
 
+    // Options for a new input stream over the underlying file
+    ss::file_input_stream_options stream_options(const ss::io_priority_class);
+
     // Signal destruction of a segment_reader_handle
     ss::future<> put();
 
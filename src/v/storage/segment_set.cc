@@ -16,7 +16,6 @@
 #include "storage/logger.h"
 #include "storage/segment.h"
 #include "utils/directory_walker.h"
-#include "utils/filtered_lower_bound.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
@@ -38,9 +37,6 @@ struct segment_ordering {
     bool operator()(const type& seg, model::offset value) const {
         return seg->offsets().get_dirty_offset() < value;
     }
-    bool operator()(const type& seg, model::timestamp value) const {
-        return seg->index().max_timestamp() < value;
-    }
 
     bool operator()(const type& seg, model::term_id value) const {
         return seg->offsets().get_term() < value;
@@ -70,12 +66,20 @@ void segment_set::add(ss::lw_shared_ptr<segment> h) {
           *this);
     }
     _handles.emplace_back(std::move(h));
+    invalidate_max_timestamps();
 }
 
-void segment_set::pop_back() { _handles.pop_back(); }
-void segment_set::pop_front() { _handles.pop_front(); }
+void segment_set::pop_back() {
+    _handles.pop_back();
+    invalidate_max_timestamps();
+}
+void segment_set::pop_front() {
+    _handles.pop_front();
+    invalidate_max_timestamps();
+}
 void segment_set::erase(iterator begin, iterator end) {
     _handles.erase(begin, end);
+    invalidate_max_timestamps();
 }
 
 template<typename Iterator>
@@ -136,17 +140,70 @@ segment_set::lower_bound(model::offset offset) const {
 // on that time index to find the closest index entry and scan the log from
 // there. Otherwise it will move on to the next log segment.
 segment_set::iterator segment_set::lower_bound(model::timestamp needle) {
-    // Note that we exclude the segments that only contain configuration batches
-    // from our search, as their timestamps may be wildly different from the
-    // user provided timestamps.
-    return filtered_lower_bound(
+    return std::next(
       _handles.begin(),
-      _handles.end(),
-      needle,
-      segment_ordering{},
-      [](const auto& segment) {
-          return segment->index().non_data_timestamps() == false;
-      });
+      static_cast<ptrdiff_t>(timestamp_lower_bound_index(needle)));
+}
+
+segment_set::const_iterator
+segment_set::lower_bound(model::timestamp needle) const {
+    return std::next(
+      _handles.cbegin(),
+      static_cast<ptrdiff_t>(timestamp_lower_bound_index(needle)));
+}
+
+namespace {
+// Note that we exclude the segments that only contain configuration batches
+// from our search, as their timestamps may be wildly different from the
+// user provided timestamps.
+bool has_data_timestamps(const segment& s) {
+    return s.index().non_data_timestamps() == false;
+}
+} // namespace
+
+void segment_set::rebuild_max_timestamps() const {
+    _max_timestamps.clear();
+    _max_timestamps.reserve(_handles.size() - 1);
+    auto running_max = model::timestamp::missing();
+    for (size_t i = 0; i + 1 < _handles.size(); ++i) {
+        const auto& s = *_handles[i];
+        if (has_data_timestamps(s)) {
+            running_max = std::max(running_max, s.index().max_timestamp());
+        }
+        _max_timestamps.push_back(running_max);
+    }
+}
+
+size_t segment_set::timestamp_lower_bound_index(model::timestamp needle) const {
+    if (_handles.empty()) {
+        return 0;
+    }
+    const auto closed = _handles.size() - 1;
+    // closed segments may still be rewritten in place (f.e. by compaction),
+    // the found segment is double checked and the summary rebuilt if stale
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (_max_timestamps.size() != closed || attempt > 0) {
+            rebuild_max_timestamps();
+        }
+        auto it = std::lower_bound(
+          _max_timestamps.begin(), _max_timestamps.end(), needle);
+        if (it == _max_timestamps.end()) {
+            break;
+        }
+        const auto idx = static_cast<size_t>(
+          std::distance(_max_timestamps.begin(), it));
+        const auto& s = *_handles[idx];
+        if (has_data_timestamps(s) && s.index().max_timestamp() >= needle) {
+            return idx;
+        }
+    }
+    // from KIP-33: the first segment whose max timestamp reaches the needle,
+    // the active segment is the last candidate
+    const auto& last = *_handles.back();
+    if (has_data_timestamps(last) && last.index().max_timestamp() >= needle) {
+        return closed;
+    }
+    return _handles.size();
 }
 
 segment_set::iterator segment_set::upper_bound(model::term_id term) {
@@ -160,6 +217,29 @@ segment_set::upper_bound(model::term_id term) const {
       _handles.cbegin(), _handles.cend(), term, segment_ordering{});
 }
 
+namespace internal {
+
+segment_manifest make_segment_manifest(const segment_set& segs, bool clean) {
+    segment_manifest manifest{.clean = clean};
+    manifest.segments.reserve(segs.size());
+    for (const auto& seg : segs) {
+        if (seg->is_tombstone()) {
+            continue;
+        }
+        manifest.segments.push_back(segment_manifest_entry{
+          .segment_name
+          = std::filesystem::path(seg->filename()).filename().string(),
+          .size_bytes = seg->size_bytes(),
+          .base_offset = seg->offsets().get_base_offset(),
+          .dirty_offset = seg->offsets().get_dirty_offset(),
+          .has_compaction_index = seg->has_compaction_index(),
+        });
+    }
+    return manifest;
+}
+
+} // namespace internal
+
 std::ostream& operator<<(std::ostream& o, const segment_set& s) {
     o << "{size: " << s.size() << ", [";
     static constexpr size_t max_to_log = 8;
@@ -464,6 +544,84 @@ static ss::future<segment_set::underlying_t> open_segments(
       });
 }
 
+static bool is_usable_manifest(
+  const std::optional<internal::segment_manifest>& manifest,
+  const std::optional<ss::sstring>& last_clean_segment) {
+    return manifest && manifest->clean && !manifest->segments.empty()
+           && last_clean_segment
+           && manifest->segments.back().segment_name
+                == last_clean_segment.value();
+}
+
+/**
+ * \brief Open the segments listed in a clean segment manifest.
+ *
+ * Returns std::nullopt, after closing anything it opened, if a listed segment
+ * cannot be opened or its size does not match the manifest; the caller then
+ * falls back to listing the directory.
+ */
+static ss::future<std::optional<segment_set::underlying_t>>
+open_manifest_segments(
+  partition_path ppath,
+  internal::segment_manifest manifest,
+  std::function<std::optional<batch_cache_index>()> cache_factory,
+  ss::abort_source& as,
+  size_t buf_size,
+  unsigned read_ahead,
+  storage_resources& resources,
+  ss::sharded<features::feature_table>& feature_table,
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
+    segment_set::underlying_t segs;
+    segs.reserve(manifest.segments.size());
+    bool usable = true;
+    try {
+        for (const auto& entry : manifest.segments) {
+            if (as.abort_requested()) {
+                break;
+            }
+            auto path = segment_full_path::parse(ppath, entry.segment_name);
+            if (!path || path->get_base_offset() != entry.base_offset) {
+                usable = false;
+            } else {
+                auto seg = co_await open_segment(
+                  *path,
+                  cache_factory(),
+                  buf_size,
+                  read_ahead,
+                  resources,
+                  feature_table,
+                  ntp_sanitizer_config);
+                segs.push_back(seg);
+                usable = seg->size_bytes() == entry.size_bytes;
+            }
+            if (!usable) {
+                vlog(
+                  stlog.info,
+                  "Segment {} of {} does not match its manifest, listing "
+                  "directory instead",
+                  entry.segment_name,
+                  ppath);
+                break;
+            }
+        }
+    } catch (...) {
+        vlog(
+          stlog.info,
+          "Unable to open segments of {} from manifest, listing directory "
+          "instead: {}",
+          ppath,
+          std::current_exception());
+        usable = false;
+    }
+    if (usable) {
+        co_return std::move(segs);
+    }
+    co_await ss::parallel_for_each(segs, [](segment_set::type& seg) {
+        return seg->close();
+    });
+    co_return std::nullopt;
+}
+
 ss::future<segment_set> recover_segments(
   partition_path path,
   bool is_compaction_enabled,
@@ -472,9 +630,13 @@ ss::future<segment_set> recover_segments(
   size_t read_buf_size,
   unsigned read_readahead_count,
   std::optional<ss::sstring> last_clean_segment,
+  std::optional<internal::segment_manifest> manifest,
   storage_resources& resources,
   ss::sharded<features::feature_table>& feature_table,
   std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
+    if (!is_usable_manifest(manifest, last_clean_segment)) {
+        manifest = std::nullopt;
+    }
     return ss::recursive_touch_directory(ss::sstring(path))
       .then([&as,
              path,
@@ -482,17 +644,46 @@ ss::future<segment_set> recover_segments(
              ntp_sanitizer_config,
              read_buf_size,
              read_readahead_count,
+             manifest = std::move(manifest),
              &resources,
-             &feature_table] {
-          return open_segments(
-            path,
-            cache_factory,
-            as,
-            read_buf_size,
-            read_readahead_count,
-            resources,
-            feature_table,
-            ntp_sanitizer_config);
+             &feature_table]() mutable {
+          auto from_manifest = ss::make_ready_future<
+            std::optional<segment_set::underlying_t>>(std::nullopt);
+          if (manifest) {
+              from_manifest = open_manifest_segments(
+                path,
+                std::move(*manifest),
+                cache_factory,
+                as,
+                read_buf_size,
+                read_readahead_count,
+                resources,
+                feature_table,
+                ntp_sanitizer_config);
+          }
+          return from_manifest.then(
+            [&as,
+             path,
+             cache_factory,
+             ntp_sanitizer_config,
+             read_buf_size,
+             read_readahead_count,
+             &resources,
+             &feature_table](std::optional<segment_set::underlying_t> segs) {
+                if (segs) {
+                    return ss::make_ready_future<segment_set::underlying_t>(
+                      std::move(*segs));
+                }
+                return open_segments(
+                  path,
+                  cache_factory,
+                  as,
+                  read_buf_size,
+                  read_readahead_count,
+                  resources,
+                  feature_table,
+                  ntp_sanitizer_config);
+            });
       })
       .then([&as,
              is_compaction_enabled,
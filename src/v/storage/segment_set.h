@@ -12,6 +12,7 @@
 #pragma once
 
 #include "features/fwd.h"
+#include "serde/envelope.h"
 #include "storage/batch_cache.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
@@ -22,6 +23,7 @@
 #include <seastar/core/sharded.hh>
 
 #include <deque>
+#include <vector>
 
 namespace storage {
 /*
@@ -77,6 +79,8 @@ public:
 
     iterator lower_bound(model::offset o);
     const_iterator lower_bound(model::offset o) const;
+    /// first segment holding data with a timestamp >= o, segments whose max
+    /// timestamps are not monotonic are handled too
     iterator lower_bound(model::timestamp o);
     const_iterator lower_bound(model::timestamp o) const;
     iterator upper_bound(model::term_id o);
@@ -90,11 +94,71 @@ public:
     const_iterator end() const { return _handles.end(); }
 
 private:
+    size_t timestamp_lower_bound_index(model::timestamp) const;
+    void rebuild_max_timestamps() const;
+    void invalidate_max_timestamps() { _max_timestamps.clear(); }
+
     underlying_t _handles;
+    /**
+     * Running maximum of the data segment max timestamps, for all segments but
+     * the active (last) one whose max timestamp still moves with appends.
+     * Being monotonic even when producer timestamps are not, it can be binary
+     * searched to find the first segment with a max timestamp >= needle. It is
+     * rebuilt lazily after segments are added or removed.
+     */
+    mutable std::vector<model::timestamp> _max_timestamps;
 
     friend std::ostream& operator<<(std::ostream&, const segment_set&);
 };
 
+namespace internal {
+
+struct segment_manifest_entry
+  : serde::envelope<
+      segment_manifest_entry,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    ss::sstring segment_name;
+    uint64_t size_bytes{0};
+    model::offset base_offset;
+    model::offset dirty_offset;
+    bool has_compaction_index{false};
+
+    auto serde_fields() {
+        return std::tie(
+          segment_name,
+          size_bytes,
+          base_offset,
+          dirty_offset,
+          has_compaction_index);
+    }
+};
+
+/**
+ * Persisted description of the segments of a log, stored in the kvstore next
+ * to the clean segment marker. Only a manifest written on clean shutdown
+ * (`clean == true`) is trusted on startup, in which case the listed segments
+ * are opened directly instead of listing the partition directory.
+ */
+struct segment_manifest
+  : serde::
+      envelope<segment_manifest, serde::version<0>, serde::compat_version<0>> {
+    bool clean{false};
+    std::vector<segment_manifest_entry> segments;
+
+    auto serde_fields() { return std::tie(clean, segments); }
+};
+
+segment_manifest make_segment_manifest(const segment_set&, bool clean);
+
+} // namespace internal
+
+/**
+ * Opens and recovers the segments of the log at `path`. When a clean
+ * `manifest` whose last segment matches `last_clean_segment` is given the
+ * segments it lists are opened without walking the directory, falling back to
+ * the walk if any of them is missing or does not match.
+ */
 ss::future<segment_set> recover_segments(
   partition_path path,
   bool is_compaction_enabled,
@@ -103,6 +167,7 @@ ss::future<segment_set> recover_segments(
   size_t read_buf_size,
   unsigned read_readahead_count,
   std::optional<ss::sstring> last_clean_segment,
+  std::optional<internal::segment_manifest> manifest,
   storage_resources&,
   ss::sharded<features::feature_table>& feature_table,
   std::optional<ntp_sanitizer_config> ntp_sanitizer_config);
@@ -403,7 +403,7 @@ ss::future<storage::index_state> do_copy_segment_data(
       tmpname);
     bool may_have_tombstone_records = false;
     auto should_keep =
-      [compacted_list = std::move(compacted_offsets),
+      [&compacted_list = compacted_offsets,
        past_tombstone_delete_horizon,
        &may_have_tombstone_records,
        &pb](const model::record_batch& b, const model::record& r, bool) {
@@ -429,6 +429,17 @@ ss::future<storage::index_state> do_copy_segment_data(
           features::feature::compaction_placeholder_batch))) {
         segment_last_offset = seg->offsets().get_committed_offset();
     }
+    // batches whose offsets all survive are copied without being decompressed,
+    // unless they may have tombstones to remove
+    const bool seg_may_have_tombstones
+      = seg->index().may_have_tombstone_records();
+    copy_data_segment_reducer::batch_filter_t keep_batch;
+    if (!(past_tombstone_delete_horizon && seg_may_have_tombstones)) {
+        keep_batch = [&compacted_offsets](const model::record_batch_header& h) {
+            return compacted_offsets.count(h.base_offset, h.last_offset())
+                   == static_cast<uint64_t>(h.record_count);
+        };
+    }
     auto copy_reducer = copy_data_segment_reducer(
       std::move(should_keep),
       appender.get(),
@@ -437,7 +448,9 @@ ss::future<storage::index_state> do_copy_segment_data(
       segment_last_offset,
       /*cidx=*/nullptr,
       /*inject_failure=*/false,
-      cfg.asrc);
+      cfg.asrc,
+      std::move(keep_batch),
+      seg_may_have_tombstones);
 
     // create the segment, get the in-memory index for the new segment
     auto res = co_await create_segment_full_reader(
@@ -473,6 +486,7 @@ ss::future<storage::index_state> do_copy_segment_data(
     new_index.clean_compact_timestamp = old_clean_compact_timestamp;
 
     // Set may_have_tombstone_records
+    may_have_tombstone_records |= stats.tombstones_copied > 0;
     new_index.may_have_tombstone_records = may_have_tombstone_records;
 
     if (
@@ -1155,6 +1169,13 @@ bytes clean_segment_key(model::ntp ntp) {
     return iobuf_to_bytes(buf);
 }
 
+bytes segment_manifest_key(model::ntp ntp) {
+    iobuf buf;
+    reflection::serialize(
+      buf, kvstore_key_type::segment_manifest, std::move(ntp));
+    return iobuf_to_bytes(buf);
+}
+
 offset_delta_time should_apply_delta_time_offset(
   ss::sharded<features::feature_table>& feature_table) {
     return offset_delta_time{
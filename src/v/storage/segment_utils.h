@@ -214,10 +214,12 @@ float random_jitter(jitter_percents);
 enum class kvstore_key_type : int8_t {
     start_offset = 0,
     clean_segment = 1,
+    segment_manifest = 2,
 };
 
 bytes start_offset_key(model::ntp ntp);
 bytes clean_segment_key(model::ntp ntp);
+bytes segment_manifest_key(model::ntp ntp);
 
 struct clean_segment_value
   : serde::envelope<
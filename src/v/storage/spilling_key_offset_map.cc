@@ -0,0 +1,389 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "storage/spilling_key_offset_map.h"
+
+#include "base/vassert.h"
+#include "base/vlog.h"
+#include "hashing/xx.h"
+#include "storage/logger.h"
+#include "storage/segment_utils.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+
+namespace storage {
+
+/**
+ * Appends sorted records to a run, a block at a time. Blocks are zero padded
+ * so that records never straddle a block boundary.
+ */
+class spilling_key_offset_map::run_writer {
+public:
+    explicit run_writer(run& r)
+      : _run(r)
+      , _buf(ss::temporary_buffer<char>::aligned(
+          r.file.memory_dma_alignment(), write_buffer_blocks * block_size)) {
+        std::memset(_buf.get_write(), 0, _buf.size());
+    }
+
+    ss::future<> append(const digest_type& digest, model::offset offset) {
+        if (_in_block == records_per_block) {
+            _in_block = 0;
+            ++_blocks_in_buf;
+            if (_blocks_in_buf == write_buffer_blocks) {
+                co_await flush();
+            }
+        }
+        if (_in_block == 0) {
+            _run.block_index.push_back(digest);
+        }
+        const record rec{.digest = digest, .offset = offset};
+        std::memcpy(
+          _buf.get_write() + _blocks_in_buf * block_size
+            + _in_block * sizeof(record),
+          &rec,
+          sizeof(record));
+        ++_in_block;
+        ++_run.size;
+    }
+
+    ss::future<> finish() {
+        if (_in_block > 0) {
+            ++_blocks_in_buf;
+            _in_block = 0;
+        }
+        co_await flush();
+        co_await _run.file.flush();
+    }
+
+private:
+    ss::future<> flush() {
+        if (_blocks_in_buf == 0) {
+            co_return;
+        }
+        const auto len = _blocks_in_buf * block_size;
+        auto written = co_await _run.file.dma_write(
+          _file_pos, _buf.get(), len);
+        if (written != len) {
+            throw std::runtime_error(fmt::format(
+              "short write to key map run {}: {} of {} bytes",
+              _run.path,
+              written,
+              len));
+        }
+        _file_pos += len;
+        _blocks_in_buf = 0;
+        std::memset(_buf.get_write(), 0, _buf.size());
+    }
+
+    run& _run;
+    ss::temporary_buffer<char> _buf;
+    size_t _blocks_in_buf{0};
+    size_t _in_block{0};
+    uint64_t _file_pos{0};
+};
+
+/**
+ * Reads the records of a run in order.
+ */
+class spilling_key_offset_map::run_reader {
+public:
+    explicit run_reader(run& r)
+      : _run(r) {}
+
+    /// Returns false once the run is exhausted.
+    ss::future<bool> next() {
+        if (_read == _run.size) {
+            co_return false;
+        }
+        if (_in_block == records_per_block || _buf.empty()) {
+            _in_block = 0;
+            _buf.trim_front(std::min(_buf.size(), block_size));
+            if (_buf.empty()) {
+                _buf = co_await _run.file.dma_read_bulk<char>(
+                  _file_pos, write_buffer_blocks * block_size);
+                _file_pos += _buf.size();
+                if (_buf.size() < block_size) {
+                    throw std::runtime_error(fmt::format(
+                      "unexpected end of key map run {} after {} of {} "
+                      "records",
+                      _run.path,
+                      _read,
+                      _run.size));
+                }
+            }
+        }
+        std::memcpy(
+          &_current, _buf.get() + _in_block * sizeof(record), sizeof(record));
+        ++_in_block;
+        ++_read;
+        co_return true;
+    }
+
+    const record& current() const { return _current; }
+
+private:
+    run& _run;
+    ss::temporary_buffer<char> _buf;
+    uint64_t _file_pos{0};
+    size_t _in_block{0};
+    size_t _read{0};
+    record _current{};
+};
+
+spilling_key_offset_map::spilling_key_offset_map(
+  std::filesystem::path directory,
+  size_t memory_bytes,
+  const compaction_config& cfg,
+  size_t max_runs)
+  : _directory(std::move(directory))
+  , _memory_bytes(memory_bytes)
+  , _max_runs(std::max<size_t>(max_runs, 2))
+  , _sanitizer_config(cfg.sanitizer_config)
+  , _files_to_cleanup(cfg.files_to_cleanup)
+  , _memory_tracker(
+      ss::make_shared<util::mem_tracker>("spilling_key_offset_map"))
+  , _memory(util::mem_tracked::map<absl::btree_map, digest_type, model::offset>(
+      _memory_tracker)) {}
+
+spilling_key_offset_map::~spilling_key_offset_map() {
+    vassert(
+      _runs.empty(),
+      "spilling_key_offset_map must be closed before destruction, runs left: "
+      "{}",
+      _runs.size());
+}
+
+seastar::future<bool>
+spilling_key_offset_map::put(const compaction_key& key, model::offset offset) {
+    const auto digest = hash_key(key);
+    auto [it, inserted] = _memory.try_emplace(digest, offset);
+    if (!inserted) {
+        it->second = std::max(it->second, offset);
+    }
+    _max_offset = std::max(_max_offset, offset);
+    if (
+      static_cast<size_t>(_memory_tracker->consumption()) >= _memory_bytes) {
+        co_await spill();
+        if (_runs.size() > _max_runs) {
+            co_await merge_runs();
+        }
+    }
+    co_return true;
+}
+
+seastar::future<std::optional<model::offset>>
+spilling_key_offset_map::get(const compaction_key& key) const {
+    const auto digest = hash_key(key);
+    std::optional<model::offset> result;
+    if (auto it = _memory.find(digest); it != _memory.end()) {
+        result = it->second;
+    }
+    for (auto& r : _runs) {
+        auto o = co_await lookup(r, digest);
+        if (o.has_value() && (!result.has_value() || *o > *result)) {
+            result = o;
+        }
+    }
+    co_return result;
+}
+
+size_t spilling_key_offset_map::size() const {
+    size_t n = _memory.size();
+    for (const auto& r : _runs) {
+        n += r.size;
+    }
+    return n;
+}
+
+ss::future<std::optional<model::offset>>
+spilling_key_offset_map::lookup(run& r, const digest_type& digest) const {
+    // find the last block with a first digest <= digest
+    auto it = std::upper_bound(
+      r.block_index.begin(), r.block_index.end(), digest);
+    if (it == r.block_index.begin()) {
+        co_return std::nullopt;
+    }
+    const size_t block = std::distance(r.block_index.begin(), it) - 1;
+    if (r.cached_block != block) {
+        r.cached_data = co_await r.file.dma_read_bulk<char>(
+          block * block_size, block_size);
+        r.cached_block = block;
+    }
+    const size_t records = std::min(
+      records_per_block, r.size - block * records_per_block);
+    if (r.cached_data.size() < records * sizeof(record)) {
+        throw std::runtime_error(fmt::format(
+          "short read of block {} from key map run {}: {} bytes",
+          block,
+          r.path,
+          r.cached_data.size()));
+    }
+    // binary search the block
+    size_t lo = 0;
+    size_t hi = records;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        record rec; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::memcpy(
+          &rec, r.cached_data.get() + mid * sizeof(record), sizeof(record));
+        if (rec.digest == digest) {
+            co_return rec.offset;
+        }
+        if (rec.digest < digest) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    co_return std::nullopt;
+}
+
+ss::future<spilling_key_offset_map::run>
+spilling_key_offset_map::create_run() {
+    auto path = _directory
+                / fmt::format("key_map_run_{}.staging", _next_run_id++);
+    if (_files_to_cleanup) {
+        _files_to_cleanup->emplace(path);
+    }
+    run r;
+    r.file = co_await internal::make_writer_handle(
+      path, _sanitizer_config, true);
+    r.path = std::move(path);
+    co_return r;
+}
+
+ss::future<> spilling_key_offset_map::remove_run(run& r) {
+    co_await r.file.close();
+    co_await ss::remove_file(r.path.string());
+}
+
+ss::future<> spilling_key_offset_map::spill() {
+    auto r = co_await create_run();
+    std::exception_ptr eptr;
+    try {
+        run_writer writer(r);
+        for (const auto& [digest, offset] : _memory) {
+            co_await writer.append(digest, offset);
+        }
+        co_await writer.finish();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    if (eptr) {
+        co_await remove_run(r);
+        std::rethrow_exception(eptr);
+    }
+    vlog(
+      gclog.debug,
+      "spilled {} keys from key offset map to {} ({} runs)",
+      r.size,
+      r.path,
+      _runs.size() + 1);
+    _runs.push_back(std::move(r));
+    _memory.clear();
+}
+
+ss::future<> spilling_key_offset_map::merge_runs() {
+    auto merged = co_await create_run();
+    std::exception_ptr eptr;
+    try {
+        std::vector<run_reader> readers;
+        readers.reserve(_runs.size());
+        for (auto& r : _runs) {
+            readers.emplace_back(r);
+        }
+
+        // min-heap of (digest, reader index)
+        using heap_entry = std::pair<digest_type, size_t>;
+        std::priority_queue<
+          heap_entry,
+          std::vector<heap_entry>,
+          std::greater<heap_entry>>
+          heap;
+        for (size_t i = 0; i < readers.size(); ++i) {
+            if (co_await readers[i].next()) {
+                heap.emplace(readers[i].current().digest, i);
+            }
+        }
+
+        run_writer writer(merged);
+        while (!heap.empty()) {
+            const auto digest = heap.top().first;
+            model::offset offset;
+            // each run holds a digest at most once, so duplicates of the
+            // digest are at the top of the heap
+            while (!heap.empty() && heap.top().first == digest) {
+                const auto i = heap.top().second;
+                heap.pop();
+                offset = std::max(offset, readers[i].current().offset);
+                if (co_await readers[i].next()) {
+                    heap.emplace(readers[i].current().digest, i);
+                }
+            }
+            co_await writer.append(digest, offset);
+            co_await ss::coroutine::maybe_yield();
+        }
+        co_await writer.finish();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    if (eptr) {
+        co_await remove_run(merged);
+        std::rethrow_exception(eptr);
+    }
+
+    vlog(
+      gclog.debug,
+      "merged {} key offset map runs into {} with {} keys",
+      _runs.size(),
+      merged.path,
+      merged.size);
+    auto old_runs = std::exchange(_runs, {});
+    _runs.push_back(std::move(merged));
+    for (auto& r : old_runs) {
+        co_await remove_run(r);
+    }
+}
+
+ss::future<> spilling_key_offset_map::close() {
+    auto runs = std::exchange(_runs, {});
+    for (auto& r : runs) {
+        try {
+            co_await remove_run(r);
+        } catch (...) {
+            vlog(
+              gclog.warn,
+              "error removing key offset map run {}: {}",
+              r.path,
+              std::current_exception());
+        }
+    }
+    _memory.clear();
+}
+
+spilling_key_offset_map::digest_type
+spilling_key_offset_map::hash_key(const compaction_key& key) {
+    XXH128_canonical_t canonical;
+    XXH128_canonicalFromHash(
+      &canonical,
+      xxhash_128(reinterpret_cast<const char*>(key.data()), key.size()));
+    digest_type digest;
+    std::memcpy(digest.data(), canonical.digest, digest.size());
+    return digest;
+}
+
+} // namespace storage
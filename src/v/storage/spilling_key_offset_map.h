@@ -0,0 +1,160 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/units.h"
+#include "container/fragmented_vector.h"
+#include "model/fundamental.h"
+#include "storage/key_offset_map.h"
+#include "storage/scoped_file_tracker.h"
+#include "storage/types.h"
+#include "utils/tracking_allocator.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <absl/container/btree_map.h>
+
+#include <array>
+#include <filesystem>
+#include <limits>
+
+namespace storage {
+
+/**
+ * A key_offset_map with bounded memory that can index an unbounded number of
+ * keys by spilling sorted runs to disk.
+ *
+ * Keys are mapped to their 128-bit xxh3 digest and inserted into an in-memory
+ * sorted map. Once the in-memory map reaches its memory budget it is written
+ * out as a sorted run: a file of fixed size (digest, offset) records packed
+ * into 4 KiB blocks, together with an in-memory sparse index holding the first
+ * digest of every block. When more than `max_runs` runs exist they are merged
+ * into a single run with a k-way merge that keeps the highest offset of each
+ * digest. This bounds the number of block reads needed by a lookup.
+ *
+ * A lookup consults the in-memory map and at most one block of every run, and
+ * returns the highest offset found. Puts never fail, so a sliding window
+ * compaction using this map deduplicates its whole range in one pass instead
+ * of rewriting segments once per window.
+ *
+ * Run files are created in the partition directory with a `.staging` suffix
+ * and are registered with the compaction's leftover file tracker so that they
+ * are removed if compaction is aborted. The map is single-owner: call
+ * `close()` before destruction to close and remove the runs.
+ */
+class spilling_key_offset_map final : public key_offset_map {
+public:
+    static constexpr size_t default_max_runs = 8;
+
+    spilling_key_offset_map(
+      std::filesystem::path directory,
+      size_t memory_bytes,
+      const compaction_config& cfg,
+      size_t max_runs = default_max_runs);
+
+    spilling_key_offset_map(const spilling_key_offset_map&) = delete;
+    spilling_key_offset_map& operator=(const spilling_key_offset_map&) = delete;
+    spilling_key_offset_map(spilling_key_offset_map&&) noexcept = delete;
+    spilling_key_offset_map& operator=(spilling_key_offset_map&&) noexcept
+      = delete;
+    ~spilling_key_offset_map() override;
+
+    seastar::future<bool>
+    put(const compaction_key& key, model::offset offset) override;
+
+    seastar::future<std::optional<model::offset>>
+    get(const compaction_key& key) const override;
+
+    model::offset max_offset() const override { return _max_offset; }
+
+    /**
+     * Number of entries held in memory and on disk. Keys that were spilled
+     * more than once and have not been merged yet are counted once per run.
+     */
+    size_t size() const override;
+
+    /**
+     * The map is not bounded by a number of keys.
+     */
+    size_t capacity() const override {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    /**
+     * Close and remove all of the runs.
+     */
+    seastar::future<> close();
+
+    /**
+     * Number of sorted runs currently on disk.
+     */
+    size_t run_count() const { return _runs.size(); }
+
+private:
+    using digest_type = std::array<char, 16>;
+
+    /**
+     * On disk format of a single run entry.
+     */
+    struct record {
+        digest_type digest;
+        model::offset offset;
+    };
+    static_assert(sizeof(record) == 24);
+
+    static constexpr size_t block_size = 4_KiB;
+    static constexpr size_t records_per_block = block_size / sizeof(record);
+    static constexpr size_t write_buffer_blocks = 16;
+
+    /**
+     * A sorted run of records on disk.
+     */
+    struct run {
+        std::filesystem::path path;
+        ss::file file;
+        size_t size{0};
+        // first digest of every block in the run
+        chunked_vector<digest_type> block_index;
+        // last block read from the run
+        std::optional<size_t> cached_block;
+        ss::temporary_buffer<char> cached_data;
+    };
+
+    class run_writer;
+    class run_reader;
+
+    static digest_type hash_key(const compaction_key&);
+
+    ss::future<std::optional<model::offset>>
+    lookup(run&, const digest_type&) const;
+
+    ss::future<> spill();
+    ss::future<> merge_runs();
+    ss::future<run> create_run();
+    ss::future<> remove_run(run&);
+
+    std::filesystem::path _directory;
+    size_t _memory_bytes;
+    size_t _max_runs;
+    std::optional<ntp_sanitizer_config> _sanitizer_config;
+    scoped_file_tracker::set_t* _files_to_cleanup;
+
+    ss::shared_ptr<util::mem_tracker> _memory_tracker;
+    util::mem_tracked::map_t<absl::btree_map, digest_type, model::offset>
+      _memory;
+    mutable std::vector<run> _runs;
+    model::offset _max_offset;
+    size_t _next_run_id{0};
+};
+
+} // namespace storage
@@ -89,6 +89,40 @@ storage_resources::storage_resources()
       config::shard_local_cfg().storage_max_concurrent_replay.bind(),
       config::shard_local_cfg().storage_compaction_index_memory.bind()) {}
 
+ss::future<recovery_slots::units>
+recovery_slots::get_units(prioritized_recovery prioritized) {
+    if (_available > 0 && _prioritized.empty() && _normal.empty()) {
+        --_available;
+        return ss::make_ready_future<units>(units(this));
+    }
+    auto& waiters = prioritized ? _prioritized : _normal;
+    waiters.emplace_back();
+    return waiters.back().get_future().then([this] { return units(this); });
+}
+
+void recovery_slots::set_capacity(size_t capacity) noexcept {
+    _available += static_cast<int64_t>(capacity)
+                  - static_cast<int64_t>(_capacity);
+    _capacity = capacity;
+    dispatch();
+}
+
+void recovery_slots::release() noexcept {
+    ++_available;
+    dispatch();
+}
+
+void recovery_slots::dispatch() noexcept {
+    while (_available > 0 && (!_prioritized.empty() || !_normal.empty())) {
+        auto& waiters = _prioritized.empty() ? _normal : _prioritized;
+        // the slot is taken on behalf of the waiter, its continuation only
+        // wraps it in units
+        --_available;
+        waiters.front().set_value();
+        waiters.pop_front();
+    }
+}
+
 void storage_resources::update_allowance(uint64_t total, uint64_t free) {
     // TODO: also take as an input the disk consumption of the SI cache:
     // it knows this because it calculates it when doing periodic trimming.
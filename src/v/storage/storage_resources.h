@@ -16,12 +16,81 @@
 #include "ssx/semaphore.h"
 #include "utils/adjustable_semaphore.h"
 
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/future.hh>
+#include <seastar/util/bool_class.hh>
+
 #include <cstdint>
+#include <utility>
 
 namespace storage {
 
 class node_api;
 
+using prioritized_recovery = ss::bool_class<struct prioritized_recovery_tag>;
+
+/**
+ * Bounds how many logs are recovered concurrently. Waiters are admitted in
+ * arrival order, except that prioritized waiters (e.g. partitions that were
+ * leading before a restart) go ahead of every waiter without priority so that
+ * they can start serving traffic as early as possible.
+ */
+class recovery_slots {
+public:
+    class units {
+    public:
+        explicit units(recovery_slots* owner) noexcept
+          : _owner(owner) {}
+        units(units&& o) noexcept
+          : _owner(std::exchange(o._owner, nullptr)) {}
+        units& operator=(units&& o) noexcept {
+            if (this != &o) {
+                release();
+                _owner = std::exchange(o._owner, nullptr);
+            }
+            return *this;
+        }
+        units(const units&) = delete;
+        units& operator=(const units&) = delete;
+        ~units() noexcept { release(); }
+
+    private:
+        void release() noexcept {
+            if (_owner) {
+                std::exchange(_owner, nullptr)->release();
+            }
+        }
+
+        recovery_slots* _owner;
+    };
+
+    explicit recovery_slots(size_t capacity) noexcept
+      : _capacity(capacity)
+      , _available(static_cast<int64_t>(capacity)) {}
+    recovery_slots(const recovery_slots&) = delete;
+    recovery_slots& operator=(const recovery_slots&) = delete;
+    recovery_slots(recovery_slots&&) = delete;
+    recovery_slots& operator=(recovery_slots&&) = delete;
+    ~recovery_slots() = default;
+
+    ss::future<units> get_units(prioritized_recovery);
+
+    /// Capacity changes apply to slots in use as they are released.
+    void set_capacity(size_t) noexcept;
+
+    size_t waiters() const { return _prioritized.size() + _normal.size(); }
+    int64_t available_units() const { return _available; }
+
+private:
+    void release() noexcept;
+    void dispatch() noexcept;
+
+    size_t _capacity;
+    int64_t _available;
+    ss::circular_buffer<ss::promise<>> _prioritized;
+    ss::circular_buffer<ss::promise<>> _normal;
+};
+
 /**
  * This class is used by various storage components to control consumption
  * of shared system resources.  It broadly does this in two ways:
@@ -69,8 +138,9 @@ public:
         return _compaction_index_bytes.current() > 0;
     }
 
-    ss::future<ssx::semaphore_units> get_recovery_units() {
-        return _inflight_recovery.get_units(1);
+    ss::future<recovery_slots::units>
+    get_recovery_units(prioritized_recovery prioritized) {
+        return _inflight_recovery.get_units(prioritized);
     }
 
     ss::future<ssx::semaphore_units> get_close_flush_units() {
@@ -143,7 +213,7 @@ private:
 
     // How many logs may be recovered (via log_manager::manage)
     // concurrently?
-    adjustable_semaphore _inflight_recovery{0};
+    recovery_slots _inflight_recovery{0};
 
     // How many logs may be flushed during segment close concurrently?
     // (e.g. when we shut down and ask everyone to flush)
@@ -63,3 +63,25 @@ SEASTAR_THREAD_TEST_CASE(chunk_manipulation) {
         BOOST_REQUIRE_EQUAL(c.dma_size(), 0);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(chunk_over_borrowed_memory) {
+    const auto b = random_generators::gen_alphanum_string(alignment() * 2);
+    auto arena = ss::allocate_aligned_buffer<char>(alignment() * 4, alignment);
+    std::memset(arena.get(), 'x', alignment() * 4);
+    {
+        // second half of the arena, the chunk must not touch the first one
+        chunk c(arena.get() + alignment() * 2, alignment() * 2, alignment);
+        BOOST_REQUIRE(c.borrowed());
+        BOOST_REQUIRE(c.is_empty());
+        BOOST_REQUIRE_EQUAL(c.space_left(), alignment() * 2);
+
+        c.append(b.data(), b.size());
+        BOOST_REQUIRE(c.is_full());
+        BOOST_REQUIRE(std::memcmp(c.dma_ptr(), b.data(), b.size()) == 0);
+    }
+    // the memory outlives the chunk and keeps its contents
+    BOOST_REQUIRE(
+      std::memcmp(arena.get() + alignment() * 2, b.data(), b.size()) == 0);
+    BOOST_REQUIRE_EQUAL(arena[0], 'x');
+    BOOST_REQUIRE(!chunk(alignment(), alignment).borrowed());
+}
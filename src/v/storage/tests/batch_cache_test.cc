@@ -172,6 +172,73 @@ SEASTAR_THREAD_TEST_CASE(touch) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(scan_resistance) {
+    static storage::batch_cache::reclaim_options opts = {
+      .growth_window = std::chrono::milliseconds(3000),
+      .stable_window = std::chrono::milliseconds(10000),
+      .min_size = 1,
+      .max_size = 1,
+    };
+
+    storage::batch_cache cache(opts);
+    auto hot_index = std::make_unique<storage::batch_cache_index>(cache);
+    auto scan_index = std::make_unique<storage::batch_cache_index>(cache);
+
+    // a range that was read again is more recent in the lru than the ranges
+    // populated afterwards by a scan, but the scan is reclaimed first
+    auto hot = cache.put(*hot_index, make_batch(10), is_dirty_entry::no);
+    cache.touch(hot.range());
+    auto scan_0 = cache.put(*scan_index, make_batch(10), is_dirty_entry::no);
+
+    cache.reclaim(1);
+    BOOST_CHECK(hot.range());
+    BOOST_CHECK(!scan_0.range());
+
+    // with the probationary ranges gone the lru is reclaimed
+    cache.reclaim(1);
+    BOOST_CHECK(!hot.range());
+    BOOST_CHECK(cache.empty());
+    cache.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(scan_hits_skip_promotion) {
+    static storage::batch_cache::reclaim_options opts = {
+      .growth_window = std::chrono::milliseconds(3000),
+      .stable_window = std::chrono::milliseconds(10000),
+      .min_size = 1,
+      .max_size = 1,
+    };
+
+    storage::batch_cache cache(opts);
+    storage::batch_cache_index hot_index(cache);
+    storage::batch_cache_index scan_index(cache);
+
+    auto read = [](storage::batch_cache_index& index, bool skip_lru_promote) {
+        return index
+          .read(
+            model::offset(0),
+            model::offset::max(),
+            std::nullopt,
+            std::nullopt,
+            std::numeric_limits<size_t>::max(),
+            skip_lru_promote)
+          .batches.size();
+    };
+
+    hot_index.put(make_batch(10), is_dirty_entry::no);
+    BOOST_CHECK_EQUAL(read(hot_index, false), 1);
+
+    // a scan reading on from its own read-ahead hits the range without
+    // promoting it, so it is still reclaimed before the hot range
+    scan_index.put(make_batch(10), is_dirty_entry::no);
+    BOOST_CHECK_EQUAL(read(scan_index, true), 1);
+
+    cache.reclaim(1);
+    BOOST_CHECK(hot_index.get(model::offset(0)));
+    BOOST_CHECK(!scan_index.get(model::offset(0)));
+    cache.stop().get();
+}
+
 FIXTURE_TEST(index_get_empty, batch_cache_test_fixture) {
     storage::batch_cache_index index(cache);
 
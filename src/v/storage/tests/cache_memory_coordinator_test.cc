@@ -0,0 +1,139 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "base/units.h"
+#include "config/mock_property.h"
+#include "storage/cache_memory_coordinator.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+
+namespace storage {
+
+namespace {
+
+struct fake_cache {
+    cache_memory_coordinator::sample sample;
+    std::optional<size_t> budget;
+
+    cache_memory_coordinator::cache_config
+    config(ss::sstring name, size_t min = 0) {
+        return {
+          .name = std::move(name),
+          .min_budget = min,
+          .sample_fn = [this] { return sample; },
+          .set_budget_fn = [this](std::optional<size_t> b) { budget = b; },
+        };
+    }
+};
+
+} // namespace
+
+struct cache_memory_coordinator_test : public testing::Test {
+    config::mock_property<std::optional<size_t>> total_budget{100_MiB};
+    config::mock_property<std::chrono::milliseconds> interval{
+      std::chrono::seconds(10)};
+    cache_memory_coordinator coordinator{
+      total_budget.bind(), interval.bind()};
+    fake_cache a;
+    fake_cache b;
+
+    void SetUp() override {
+        coordinator.register_cache(a.config("a", 10_MiB));
+        coordinator.register_cache(b.config("b", 10_MiB));
+    }
+};
+
+TEST_F(cache_memory_coordinator_test, budget_is_split_evenly) {
+    coordinator.rebalance();
+    ASSERT_EQ(a.budget, 50_MiB);
+    ASSERT_EQ(b.budget, 50_MiB);
+    ASSERT_EQ(coordinator.moves(), 0);
+}
+
+TEST_F(cache_memory_coordinator_test, budget_moves_to_the_most_useful_cache) {
+    coordinator.rebalance();
+
+    // both caches are full, `a` gets ten times more hits per MiB
+    a.sample = {.size_bytes = 50_MiB, .hits = 10000, .misses = 100};
+    b.sample = {.size_bytes = 50_MiB, .hits = 1000, .misses = 1000};
+    coordinator.rebalance();
+
+    const auto step = static_cast<size_t>(
+      100_MiB * cache_memory_coordinator::step_fraction);
+    ASSERT_EQ(a.budget, 50_MiB + step);
+    ASSERT_EQ(b.budget, 50_MiB - step);
+    ASSERT_EQ(coordinator.moves(), 1);
+
+    auto state = coordinator.state("a");
+    ASSERT_TRUE(state.has_value());
+    ASSERT_EQ(state->budget, 50_MiB + step);
+    ASSERT_DOUBLE_EQ(state->hits_per_mib, 10000.0 / 50);
+    ASSERT_DOUBLE_EQ(state->hit_ratio, 10000.0 / 10100);
+}
+
+TEST_F(cache_memory_coordinator_test, budget_stays_if_receiver_is_not_full) {
+    coordinator.rebalance();
+
+    // `a` gets more hits but doesn't use its budget
+    a.sample = {.size_bytes = 10_MiB, .hits = 10000};
+    b.sample = {.size_bytes = 50_MiB, .hits = 10};
+    coordinator.rebalance();
+
+    ASSERT_EQ(a.budget, 50_MiB);
+    ASSERT_EQ(b.budget, 50_MiB);
+    ASSERT_EQ(coordinator.moves(), 0);
+}
+
+TEST_F(cache_memory_coordinator_test, budget_stays_for_similar_benefit) {
+    coordinator.rebalance();
+
+    a.sample = {.size_bytes = 50_MiB, .hits = 1100};
+    b.sample = {.size_bytes = 50_MiB, .hits = 1000};
+    coordinator.rebalance();
+
+    ASSERT_EQ(coordinator.moves(), 0);
+}
+
+TEST_F(cache_memory_coordinator_test, donor_keeps_its_minimum) {
+    coordinator.rebalance();
+
+    uint64_t hits = 0;
+    for (int i = 0; i < 100; ++i) {
+        hits += 10000;
+        a.sample = {.size_bytes = *a.budget, .hits = hits};
+        b.sample = {.size_bytes = *b.budget, .hits = 0};
+        coordinator.rebalance();
+    }
+
+    ASSERT_EQ(b.budget, 10_MiB);
+    ASSERT_EQ(a.budget, 90_MiB);
+}
+
+TEST_F(cache_memory_coordinator_test, caches_are_released_without_budget) {
+    coordinator.rebalance();
+    ASSERT_TRUE(a.budget.has_value());
+
+    total_budget.update(std::nullopt);
+    ASSERT_FALSE(a.budget.has_value());
+    ASSERT_FALSE(b.budget.has_value());
+
+    // rebalancing is a no-op until a budget is set again
+    coordinator.rebalance();
+    ASSERT_FALSE(a.budget.has_value());
+
+    total_budget.update(40_MiB);
+    ASSERT_EQ(a.budget, 20_MiB);
+    ASSERT_EQ(b.budget, 20_MiB);
+}
+
+} // namespace storage
@@ -7,11 +7,13 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "bytes/random.h"
 #include "model/fundamental.h"
 #include "random/generators.h"
 #include "storage/compacted_index.h"
 #include "storage/compaction_reducers.h"
+#include "storage/key_offset_map.h"
 
 #include <seastar/core/loop.hh>
 #include <seastar/core/reactor.hh>
@@ -41,3 +43,68 @@ PERF_TEST_F(reducer_bench, compaction_key_reducer_test) {
         perf_tests::stop_measuring_time();
     });
 }
+
+/*
+ * Fills a 1 MiB hash_key_offset_map with random 20 byte keys. Each iteration
+ * is a single key, so the time per iteration is the cost of hashing and
+ * inserting one key (i.e. the inverse of keys/sec), and the number of keys
+ * inserted before the map reports it is full is the keys/MiB for the digest.
+ */
+class key_offset_map_bench {
+public:
+    static constexpr size_t map_memory = 1_MiB;
+
+    explicit key_offset_map_bench(model::compaction_key_digest digest)
+      : _digest(digest) {
+        // more keys than can fit in the map for any digest
+        _keys.reserve(map_memory / 16);
+        for (size_t i = 0; i < map_memory / 16; ++i) {
+            _keys.emplace_back(random_generators::get_bytes(20));
+        }
+    }
+
+    ss::future<size_t> run() {
+        storage::hash_key_offset_map map(_digest);
+        co_await map.initialize(map_memory);
+
+        size_t inserted = 0;
+        perf_tests::start_measuring_time();
+        for (const auto& key : _keys) {
+            if (!co_await map.put(key, model::offset(inserted))) {
+                break;
+            }
+            ++inserted;
+        }
+        perf_tests::stop_measuring_time();
+
+        if (!_reported) {
+            fmt::print(
+              "digest {}: entry size {} bytes, {} keys/MiB\n",
+              _digest,
+              map.entry_size(),
+              inserted);
+            _reported = true;
+        }
+        co_await map.initialize(0);
+        co_return inserted;
+    }
+
+private:
+    model::compaction_key_digest _digest;
+    std::vector<storage::compaction_key> _keys;
+    bool _reported{false};
+};
+
+struct sha256_key_offset_map_bench : key_offset_map_bench {
+    sha256_key_offset_map_bench()
+      : key_offset_map_bench(model::compaction_key_digest::sha256) {}
+};
+
+struct xxhash_key_offset_map_bench : key_offset_map_bench {
+    xxhash_key_offset_map_bench()
+      : key_offset_map_bench(model::compaction_key_digest::xxhash3) {}
+};
+
+PERF_TEST_F(sha256_key_offset_map_bench, fill) { return run(); }
+
+PERF_TEST_F(xxhash_key_offset_map_bench, fill) { return run(); }
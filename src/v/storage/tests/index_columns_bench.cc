@@ -0,0 +1,74 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "storage/index_state.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+/*
+ * Lookups in the columns of a large segment index. Each iteration is a batch
+ * of lookups of random needles, reported as one run per lookup, so the time
+ * per run is the cost of a single search.
+ */
+class index_columns_bench {
+public:
+    static constexpr size_t entries = 1'000'000;
+    static constexpr size_t lookups = 1000;
+
+    index_columns_bench() {
+        uint32_t v = 0;
+        for (size_t i = 0; i < entries; ++i) {
+            v += random_generators::get_int(1, 8);
+            _columns.add_entry(v, v, uint64_t(v) * 4096);
+        }
+        _needles.reserve(lookups);
+        for (size_t i = 0; i < lookups; ++i) {
+            _needles.push_back(random_generators::get_int<uint32_t>(0, v));
+        }
+    }
+
+    template<typename Search>
+    size_t run(Search search) {
+        size_t found = 0;
+        perf_tests::start_measuring_time();
+        for (auto needle : _needles) {
+            auto ix = search(_columns, needle);
+            perf_tests::do_not_optimize(ix);
+            found += ix.has_value();
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(found);
+        return lookups;
+    }
+
+private:
+    storage::index_columns _columns;
+    std::vector<uint32_t> _needles;
+};
+
+PERF_TEST_F(index_columns_bench, offset_lower_bound) {
+    return run([](const storage::index_columns& c, uint32_t needle) {
+        return c.offset_lower_bound(needle);
+    });
+}
+
+PERF_TEST_F(index_columns_bench, time_lower_bound) {
+    return run([](const storage::index_columns& c, uint32_t needle) {
+        return c.time_lower_bound(needle);
+    });
+}
+
+PERF_TEST_F(index_columns_bench, position_upper_bound) {
+    return run([](const storage::index_columns& c, uint32_t needle) {
+        return c.position_upper_bound(uint64_t(needle) * 4096);
+    });
+}
@@ -356,3 +356,41 @@ BOOST_AUTO_TEST_CASE(binary_compatibility_test) {
     BOOST_REQUIRE_EQUAL(expected_bytes.size_bytes(), actual_bytes.size_bytes());
     BOOST_REQUIRE(expected_bytes == actual_bytes);
 }
+
+BOOST_AUTO_TEST_CASE(index_columns_search_test) {
+    // sizes around the linear search window and the fragment size of the
+    // underlying columns, with runs of duplicate values
+    constexpr size_t frag
+      = chunked_vector<uint32_t>::elements_per_fragment();
+    for (size_t n : {0UL, 1UL, 31UL, 33UL, 1000UL, frag, frag + 1, 3 * frag}) {
+        storage::index_columns columns;
+        std::vector<uint32_t> offsets;
+        std::vector<uint64_t> positions;
+        uint32_t v = 0;
+        for (size_t i = 0; i < n; ++i) {
+            v += random_generators::get_int(0, 3);
+            offsets.push_back(v);
+            positions.push_back(uint64_t(v) * 4096);
+            columns.add_entry(v, v, uint64_t(v) * 4096);
+        }
+
+        auto expected = [](const auto& xs, auto it) -> std::optional<int> {
+            if (it == xs.end()) {
+                return std::nullopt;
+            }
+            return std::distance(xs.begin(), it);
+        };
+        for (uint32_t needle = 0; needle <= v + 1;
+             needle += random_generators::get_int(1, 16)) {
+            const auto lower = expected(
+              offsets, std::ranges::lower_bound(offsets, needle));
+            BOOST_REQUIRE(columns.offset_lower_bound(needle) == lower);
+            BOOST_REQUIRE(columns.time_lower_bound(needle) == lower);
+
+            const uint64_t pos = uint64_t(needle) * 4096;
+            BOOST_REQUIRE(
+              columns.position_upper_bound(pos)
+              == expected(positions, std::ranges::upper_bound(positions, pos)));
+        }
+    }
+}
@@ -37,8 +37,19 @@ public:
     default_sized_hash_key_offset_map() { initialize(1_MiB).get(); }
 };
 
-using test_types = ::testing::
-  Types<storage::simple_key_offset_map, default_sized_hash_key_offset_map>;
+class default_sized_xxhash_key_offset_map
+  : public storage::hash_key_offset_map {
+public:
+    default_sized_xxhash_key_offset_map()
+      : storage::hash_key_offset_map(model::compaction_key_digest::xxhash3) {
+        initialize(1_MiB).get();
+    }
+};
+
+using test_types = ::testing::Types<
+  storage::simple_key_offset_map,
+  default_sized_hash_key_offset_map,
+  default_sized_xxhash_key_offset_map>;
 
 TYPED_TEST_SUITE(KeyOffsetMapTest, test_types);
 
@@ -261,3 +272,15 @@ TEST(HashKeyOffsetMapTest, Initialize) {
         ASSERT_EQ(val.value(), model::offset(99));
     }
 }
+
+TEST(HashKeyOffsetMapTest, XxhashFitsMoreKeys) {
+    storage::hash_key_offset_map sha_map;
+    storage::hash_key_offset_map xx_map(model::compaction_key_digest::xxhash3);
+    sha_map.initialize(1_MiB).get();
+    xx_map.initialize(1_MiB).get();
+
+    EXPECT_EQ(sha_map.digest(), model::compaction_key_digest::sha256);
+    EXPECT_EQ(xx_map.digest(), model::compaction_key_digest::xxhash3);
+    EXPECT_LT(xx_map.entry_size(), sha_map.entry_size());
+    EXPECT_GT(xx_map.capacity(), sha_map.capacity());
+}
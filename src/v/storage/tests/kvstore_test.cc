@@ -88,6 +88,27 @@ FIXTURE_TEST(key_space, kvstore_test_fixture) {
       kvs->get(storage::kvstore::key_space::consensus, empty_key).value()
       == value_d);
 
+    // key spaces are restored separately from the shared snapshot
+    std::map<bytes, iobuf> consensus_kvs;
+    kvs
+      ->for_each(
+        storage::kvstore::key_space::consensus,
+        [&](bytes_view key, const iobuf& val) {
+            BOOST_REQUIRE(consensus_kvs.emplace(key, val.copy()).second);
+        })
+      .get();
+    BOOST_REQUIRE_EQUAL(consensus_kvs.size(), 2);
+    BOOST_REQUIRE(consensus_kvs.at(key) == value_b);
+    BOOST_REQUIRE(consensus_kvs.at(empty_key) == value_d);
+
+    size_t visited = 0;
+    kvs
+      ->for_each(
+        storage::kvstore::key_space::usage,
+        [&](bytes_view, const iobuf&) { ++visited; })
+      .get();
+    BOOST_REQUIRE_EQUAL(visited, 0);
+
     kvs->stop().get();
 }
 
@@ -20,6 +20,8 @@
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_reader.h"
+#include "storage/segment_set.h"
+#include "storage/segment_utils.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -147,3 +149,88 @@ SEASTAR_THREAD_TEST_CASE(test_can_load_logs) {
     BOOST_CHECK(
       file_exists(seg4->reader().filename() + ".cannotrecover").get());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_clean_restart_uses_segment_manifest) {
+    auto conf = make_config();
+    ss::sharded<features::feature_table> feature_table;
+    feature_table.start().get();
+    feature_table
+      .invoke_on_all(
+        [](features::feature_table& f) { f.testing_activate_all(); })
+      .get();
+
+    storage::api store(
+      [conf]() {
+          return storage::kvstore_config(
+            1_MiB,
+            config::mock_binding(10ms),
+            conf.base_dir,
+            storage::make_sanitized_file_config());
+      },
+      [conf]() { return conf; },
+      feature_table);
+    store.start().get();
+    auto stop_kvstore = ss::defer([&store, &feature_table] {
+        store.stop().get();
+        feature_table.stop().get();
+    });
+    auto& m = store.log_mgr();
+    auto ntp = model::ntp("manifest", "topic-1", 0);
+    auto ntpc = config_from_ntp(ntp);
+    directories::initialize(ntpc.work_directory()).get();
+    const auto manifest_key = internal::segment_manifest_key(ntp);
+
+    auto make_segment = [&](model::offset o) {
+        auto seg = m.make_log_segment(
+                      ntpc,
+                      o,
+                      model::term_id(1),
+                      ss::default_priority_class(),
+                      default_segment_readahead_size,
+                      default_segment_readahead_count,
+                      1_MiB)
+                     .get();
+        write_batches(seg);
+        seg->close().get();
+        return seg;
+    };
+    make_segment(model::offset(0));
+
+    // first start lists the directory and the clean shutdown persists the
+    // manifest
+    m.manage(config_from_ntp(ntp)).get();
+    BOOST_CHECK_EQUAL(m.get(ntp)->segment_count(), 1);
+    m.shutdown(ntp).get();
+    auto buf = store.kvs().get(kvstore::key_space::storage, manifest_key);
+    BOOST_REQUIRE(buf.has_value());
+    auto manifest = serde::from_iobuf<internal::segment_manifest>(
+      std::move(*buf));
+    BOOST_CHECK(manifest.clean);
+    BOOST_REQUIRE_EQUAL(manifest.segments.size(), 1);
+    BOOST_CHECK_EQUAL(manifest.segments[0].base_offset, model::offset(0));
+    BOOST_CHECK_GT(manifest.segments[0].size_bytes, 0);
+
+    // a segment the manifest does not know about is not picked up because
+    // the directory is not listed, and the manifest is consumed
+    auto stray = make_segment(model::offset(1000));
+    m.manage(config_from_ntp(ntp)).get();
+    BOOST_CHECK_EQUAL(m.get(ntp)->segment_count(), 1);
+    BOOST_CHECK(
+      !store.kvs().get(kvstore::key_space::storage, manifest_key).has_value());
+    m.shutdown(ntp).get();
+
+    // a manifest that does not match the files falls back to the walk
+    buf = store.kvs().get(kvstore::key_space::storage, manifest_key);
+    BOOST_REQUIRE(buf.has_value());
+    manifest = serde::from_iobuf<internal::segment_manifest>(std::move(*buf));
+    manifest.segments[0].size_bytes += 1;
+    store.kvs()
+      .put(
+        kvstore::key_space::storage,
+        manifest_key,
+        serde::to_iobuf(std::move(manifest)))
+      .get();
+    m.manage(config_from_ntp(ntp)).get();
+    BOOST_CHECK_EQUAL(m.get(ntp)->segment_count(), 2);
+    BOOST_CHECK(file_exists(stray->reader().filename()).get());
+}
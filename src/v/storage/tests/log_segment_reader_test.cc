@@ -22,6 +22,7 @@
 #include "storage/segment_appender.h"
 #include "storage/segment_reader.h"
 #include "storage/tests/utils/disk_log_builder.h"
+#include "test_utils/scoped_config.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -103,6 +104,32 @@ SEASTAR_THREAD_TEST_CASE(test_can_read_multiple_batches) {
     check_batches(res, batches);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_can_read_multiple_batches_adaptive_readahead) {
+    scoped_config cfg;
+    cfg.get("storage_read_max_readahead_count")
+      .set_value(std::make_optional<int16_t>(8));
+    auto batches = model::test::make_random_batches(model::offset(1)).get();
+    storage::log_reader_config reader_config(
+      batches.front().base_offset(),
+      batches.back().last_offset(),
+      0,
+      model::model_limits<model::offset>::max(),
+      ss::default_priority_class(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+    disk_log_builder b;
+    b | start() | add_segment(batches.front().base_offset());
+    write(copy(batches), b);
+    // read the segment repeatedly so that later streams start from the
+    // read-ahead history collected by the earlier ones
+    for (int i = 0; i < 3; ++i) {
+        auto res = b.consume(reader_config).get();
+        check_batches(res, batches);
+    }
+    b | stop();
+}
+
 SEASTAR_THREAD_TEST_CASE(test_does_not_read_past_committed_offset_one_segment) {
     auto batches = model::test::make_random_batches(model::offset(2)).get();
     storage::log_reader_config reader_config(
@@ -11,6 +11,7 @@
 #include "model/fundamental.h"
 #include "raft/fundamental.h"
 #include "random/generators.h"
+#include "reflection/adl.h"
 #include "storage/api.h"
 #include "storage/fwd.h"
 #include "storage/kvstore.h"
@@ -695,3 +696,99 @@ FIXTURE_TEST(test_moving_persistent_state, base_fixture) {
     BOOST_REQUIRE_EQUAL(map.has_value(), false);
     BOOST_REQUIRE_EQUAL(highest_known_offset.has_value(), false);
 }
+
+FIXTURE_TEST(test_compact_map_roundtrip, base_fixture) {
+    storage::offset_translator_state state(test_ntp, model::offset(9), 3);
+    // more gaps than a single delta-FoR row, with irregular spacing
+    model::offset next(10);
+    for (int i = 0; i < 100; ++i) {
+        auto last = next + model::offset(i % 3);
+        state.add_gap(next, last);
+        next = last + model::offset(2 + i % 5);
+    }
+
+    auto map_last = state.last_gap_offset();
+    auto map_buf = state.serialize_compact_map(7);
+    for (int i = 0; i < 20; ++i) {
+        state.add_gap(next, next);
+        next = next + model::offset(3);
+    }
+    auto tail_buf = state.serialize_compact_tail(7, map_last);
+
+    auto restored = storage::offset_translator_state::from_compact_map(
+      test_ntp, map_buf.copy(), tail_buf.copy());
+    BOOST_REQUIRE_EQUAL(restored.generation, 7);
+    BOOST_REQUIRE_EQUAL(restored.map_last_offset, map_last);
+    BOOST_REQUIRE_EQUAL(restored.map_size, 101);
+    BOOST_REQUIRE_EQUAL(restored.state.size(), state.size());
+    for (model::offset o(9); o <= next; ++o) {
+        BOOST_REQUIRE_EQUAL(restored.state.delta(o), state.delta(o));
+    }
+
+    // a tail written against another generation is not applied
+    auto stale = storage::offset_translator_state::from_compact_map(
+      test_ntp, map_buf.copy(), state.serialize_compact_tail(6, map_last));
+    BOOST_REQUIRE_EQUAL(stale.state.size(), 101);
+    BOOST_REQUIRE_EQUAL(stale.state.last_gap_offset(), map_last);
+}
+
+FIXTURE_TEST(test_compact_checkpoint_replaces_legacy_map, base_fixture) {
+    static constexpr auto ks = storage::kvstore::key_space::offset_translator;
+    auto& kvs = _api.local().kvs();
+    const raft::group_id group(0);
+
+    // start from a legacy map, as written by an older version
+    kvs
+      .put(
+        ks,
+        storage::offset_translator::kvstore_offsetmap_key(group),
+        storage::offset_translator_state(test_ntp, model::offset::min(), 0)
+          .serialize_map())
+      .get();
+    kvs
+      .put(
+        ks,
+        storage::offset_translator::kvstore_highest_known_offset_key(group),
+        reflection::to_iobuf(model::offset::min()))
+      .get();
+
+    auto ot = make_offset_translator();
+    ot.start(storage::offset_translator::must_reset::no).get();
+
+    for (int64_t o = 0; o < 40; o += 2) {
+        ot.process(create_batch(
+          model::record_batch_type::raft_configuration, model::offset(o)));
+        ot.process(
+          create_batch(model::record_batch_type::raft_data, model::offset(o + 1)));
+    }
+    ot.maybe_checkpoint(0).get();
+
+    BOOST_REQUIRE(
+      !kvs.get(ks, storage::offset_translator::kvstore_offsetmap_key(group)));
+    BOOST_REQUIRE(kvs.get(
+      ks, storage::offset_translator::kvstore_compact_offsetmap_key(group)));
+
+    // incremental checkpoints only write the tail
+    for (int64_t o = 40; o < 44; o += 2) {
+        ot.process(create_batch(
+          model::record_batch_type::raft_configuration, model::offset(o)));
+        ot.process(
+          create_batch(model::record_batch_type::raft_data, model::offset(o + 1)));
+    }
+    ot.maybe_checkpoint(0).get();
+    BOOST_REQUIRE(kvs.get(
+      ks, storage::offset_translator::kvstore_offsetmap_tail_key(group)));
+
+    auto restarted = make_offset_translator();
+    restarted.start(storage::offset_translator::must_reset::no).get();
+    for (int64_t o = 1; o < 44; o += 2) {
+        validate_translation(
+          restarted, model::offset(o), model::offset((o - 1) / 2));
+    }
+
+    storage::offset_translator::remove_persistent_state(group, kvs).get();
+    BOOST_REQUIRE(!kvs.get(
+      ks, storage::offset_translator::kvstore_compact_offsetmap_key(group)));
+    BOOST_REQUIRE(!kvs.get(
+      ks, storage::offset_translator::kvstore_offsetmap_tail_key(group)));
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "model/tests/random_batch.h"
+#include "storage/parser_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace storage::internal {
+
+namespace {
+
+model::record_batch make_compressed_batch(model::compression c, int records) {
+    auto b = model::test::make_random_batch(
+      model::test::record_batch_spec{
+        .allow_compression = false,
+        .count = records,
+        .record_sizes = std::vector<size_t>(records, 3000),
+      });
+    return compress_batch(c, std::move(b)).get();
+}
+
+} // namespace
+
+TEST(DecompressingRecordCursor, YieldsAllRecords) {
+    for (auto c : {model::compression::zstd, model::compression::lz4,
+          model::compression::snappy, model::compression::gzip}) {
+        auto b = make_compressed_batch(c, 100);
+        ASSERT_TRUE(b.compressed());
+        auto expected = maybe_decompress_batch_sync(b).copy_records();
+
+        decompressing_record_cursor cursor(b);
+        size_t i = 0;
+        while (cursor.has_next()) {
+            ASSERT_LT(i, expected.size());
+            EXPECT_EQ(cursor.next(), expected[i]) << c << " record " << i;
+            ++i;
+        }
+        EXPECT_EQ(i, expected.size());
+    }
+}
+
+TEST(DecompressingRecordCursor, TruncatedBatch) {
+    auto b = make_compressed_batch(model::compression::zstd, 10);
+    auto h = b.header();
+    auto data = b.data().copy();
+    data.trim_back(data.size_bytes() / 2);
+    model::record_batch truncated(
+      h, std::move(data), model::record_batch::tag_ctor_ng{});
+
+    decompressing_record_cursor cursor(truncated);
+    EXPECT_ANY_THROW({
+        while (cursor.has_next()) {
+            cursor.next();
+        }
+    });
+}
+
+} // namespace storage::internal
@@ -54,6 +54,18 @@ struct readers_cache_test_fixture : seastar_test {
           model::ntp("test", "test", 0), max_age, max_size);
     }
 
+    ss::lowres_clock::duration retention_after_reuses(
+      const readers_cache& cache, std::vector<std::chrono::seconds> idle) {
+        readers_cache::entry e;
+        auto now = ss::lowres_clock::now();
+        e.last_used = now;
+        for (auto i : idle) {
+            now += i;
+            e.record_reuse(now);
+        }
+        return cache.retention(e);
+    }
+
     config::property<size_t> make_max_size_property(size_t default_value) {
         return config::property<size_t>(
           store,
@@ -233,3 +245,21 @@ TEST_F(readers_cache_test_fixture, test_size_based_eviction) {
     RPTEST_REQUIRE_EVENTUALLY(
       5s, [&] { return cache.get_stats().cached_readers == 9; });
 }
+
+TEST_F(readers_cache_test_fixture, test_retention_follows_reuse_interval) {
+    readers_cache cache = make_cache(10s, make_max_size_property(10));
+    auto close = ss::defer([&cache] { cache.stop().get(); });
+
+    // never reused and frequently reused readers get the eviction timeout
+    EXPECT_EQ(retention_after_reuses(cache, {}), 10s);
+    EXPECT_EQ(retention_after_reuses(cache, {1s, 1s, 1s}), 10s);
+
+    // a consumer fetching every 15s keeps its reader for two intervals
+    EXPECT_EQ(retention_after_reuses(cache, {15s, 15s}), 30s);
+
+    // the average adapts to a slower cadence
+    EXPECT_EQ(retention_after_reuses(cache, {15s, 27s}), 36s);
+
+    // and is capped
+    EXPECT_EQ(retention_after_reuses(cache, {10min}), 40s);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "storage/storage_resources.h"
+
+#include <seastar/core/future.hh>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+namespace storage {
+
+TEST(RecoverySlotsTest, PrioritizedWaitersGoFirst) {
+    recovery_slots slots(1);
+    std::optional<recovery_slots::units> held;
+    held.emplace(slots.get_units(prioritized_recovery::no).get());
+    ASSERT_EQ(slots.available_units(), 0);
+
+    std::vector<int> order;
+    std::vector<ss::future<>> waiting;
+    auto wait = [&](int id, prioritized_recovery p) {
+        waiting.push_back(slots.get_units(p).then(
+          [&order, id](recovery_slots::units) { order.push_back(id); }));
+    };
+    wait(1, prioritized_recovery::no);
+    wait(2, prioritized_recovery::no);
+    wait(3, prioritized_recovery::yes);
+    wait(4, prioritized_recovery::yes);
+    ASSERT_EQ(slots.waiters(), 4);
+
+    held.reset();
+    ss::when_all_succeed(waiting.begin(), waiting.end()).get();
+    EXPECT_EQ(order, (std::vector<int>{3, 4, 1, 2}));
+    EXPECT_EQ(slots.waiters(), 0);
+    EXPECT_EQ(slots.available_units(), 1);
+}
+
+TEST(RecoverySlotsTest, CapacityChanges) {
+    recovery_slots slots(2);
+    auto a = slots.get_units(prioritized_recovery::no).get();
+    auto b = slots.get_units(prioritized_recovery::no).get();
+
+    // shrinking below what is in use holds back waiters until enough units
+    // are released
+    slots.set_capacity(1);
+    auto c = slots.get_units(prioritized_recovery::no);
+    { auto released = std::move(a); }
+    EXPECT_EQ(slots.available_units(), 0);
+    EXPECT_EQ(slots.waiters(), 1);
+
+    // growing admits waiters right away
+    slots.set_capacity(2);
+    auto c_units = std::move(c).get();
+    EXPECT_EQ(slots.waiters(), 0);
+    EXPECT_EQ(slots.available_units(), 0);
+}
+
+} // namespace storage
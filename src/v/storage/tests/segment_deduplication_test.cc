@@ -530,3 +530,146 @@ TEST(DeduplicateSegmentsTest, TestBadReader) {
         .get(),
       std::runtime_error);
 }
+
+// Batches with no superseded record are copied as they are, the deduplicated
+// segment is then identical to the original one.
+TEST(DeduplicateSegmentsTest, TestCopyUnsupersededBatches) {
+    storage::disk_log_builder b;
+    build_segments(
+      b,
+      /*num_segs=*/3,
+      /*records_per_seg=*/10,
+      /*start_offset=*/0,
+      /*mark_compacted=*/false,
+      /*may_have_tombstones=*/false);
+    auto cleanup = ss::defer([&] { b.stop().get(); });
+    auto& disk_log = b.get_disk_log_impl();
+    auto& segs = disk_log.segments();
+
+    compaction_config cfg(
+      model::offset{0},
+      std::nullopt,
+      ss::default_priority_class(),
+      never_abort);
+    simple_key_offset_map all_segs_map(50);
+    build_offset_map(
+      cfg,
+      segs,
+      disk_log.stm_manager(),
+      disk_log.resources(),
+      disk_log.get_probe(),
+      all_segs_map)
+      .get();
+
+    auto first_seg = segs[0];
+    const auto tmpname = first_seg->reader().path().to_compaction_staging();
+    auto appender = storage::internal::make_segment_appender(
+                      tmpname,
+                      segment_appender::write_behind_memory
+                        / storage::internal::chunks().chunk_size(),
+                      std::nullopt,
+                      cfg.iopc,
+                      disk_log.resources(),
+                      cfg.sanitizer_config)
+                      .get();
+    const auto cmp_idx_tmpname = tmpname.to_compacted_index();
+    auto compacted_idx_writer = make_file_backed_compacted_index(
+      cmp_idx_tmpname,
+      cfg.iopc,
+      true,
+      disk_log.resources(),
+      cfg.sanitizer_config);
+    auto close = ss::defer([&] {
+        compacted_idx_writer.close().get();
+        appender->close().get();
+    });
+
+    auto new_idx = deduplicate_segment(
+                     cfg,
+                     all_segs_map,
+                     first_seg,
+                     *appender,
+                     compacted_idx_writer,
+                     disk_log.get_probe(),
+                     storage::internal::should_apply_delta_time_offset(
+                       b.feature_table()),
+                     b.feature_table())
+                     .get();
+    ASSERT_EQ(new_idx.max_offset, model::offset{9});
+    ASSERT_EQ(appender->file_byte_offset(), first_seg->size_bytes());
+}
+
+// The retained record counts computed while building the map give the same
+// result as reading them from the compacted index.
+TEST(DeduplicateSegmentsTest, TestRetainedRecordsCache) {
+    storage::disk_log_builder b;
+    build_segments(
+      b,
+      /*num_segs=*/3,
+      /*records_per_seg=*/10,
+      /*start_offset=*/0,
+      /*mark_compacted=*/false,
+      /*may_have_tombstones=*/false);
+    auto cleanup = ss::defer([&] { b.stop().get(); });
+    auto& disk_log = b.get_disk_log_impl();
+    auto& segs = disk_log.segments();
+
+    compaction_config cfg(
+      model::offset{0},
+      std::nullopt,
+      ss::default_priority_class(),
+      never_abort);
+    simple_key_offset_map all_segs_map(50);
+    retained_records_cache cache;
+    build_offset_map(
+      cfg,
+      segs,
+      disk_log.stm_manager(),
+      disk_log.resources(),
+      disk_log.get_probe(),
+      all_segs_map,
+      &cache)
+      .get();
+    for (const auto& seg : segs) {
+        ASSERT_NE(cache.get(*seg), nullptr);
+    }
+
+    auto first_seg = segs[0];
+    const auto tmpname = first_seg->reader().path().to_compaction_staging();
+    auto appender = storage::internal::make_segment_appender(
+                      tmpname,
+                      segment_appender::write_behind_memory
+                        / storage::internal::chunks().chunk_size(),
+                      std::nullopt,
+                      cfg.iopc,
+                      disk_log.resources(),
+                      cfg.sanitizer_config)
+                      .get();
+    const auto cmp_idx_tmpname = tmpname.to_compacted_index();
+    auto compacted_idx_writer = make_file_backed_compacted_index(
+      cmp_idx_tmpname,
+      cfg.iopc,
+      true,
+      disk_log.resources(),
+      cfg.sanitizer_config);
+    auto close = ss::defer([&] {
+        compacted_idx_writer.close().get();
+        appender->close().get();
+    });
+
+    auto new_idx = deduplicate_segment(
+                     cfg,
+                     all_segs_map,
+                     first_seg,
+                     *appender,
+                     compacted_idx_writer,
+                     disk_log.get_probe(),
+                     storage::internal::should_apply_delta_time_offset(
+                       b.feature_table()),
+                     b.feature_table(),
+                     /*inject_reader_failure=*/false,
+                     &cache)
+                     .get();
+    ASSERT_EQ(new_idx.max_offset, model::offset{9});
+    ASSERT_EQ(appender->file_byte_offset(), first_seg->size_bytes());
+}
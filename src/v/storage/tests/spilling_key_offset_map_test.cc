@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "base/units.h"
+#include "storage/spilling_key_offset_map.h"
+#include "test_utils/tmp_dir.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/seastar.hh>
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+namespace {
+storage::compaction_key k(const std::string& key) {
+    return storage::compaction_key(bytes(key.begin(), key.end()));
+}
+
+size_t count_files(const std::filesystem::path& dir) {
+    return std::distance(
+      std::filesystem::directory_iterator(dir),
+      std::filesystem::directory_iterator{});
+}
+} // namespace
+
+class SpillingKeyOffsetMapTest : public ::testing::Test {
+public:
+    // small enough that a few thousand keys spill several runs
+    static constexpr size_t memory_bytes = 16_KiB;
+
+    temporary_dir dir{"spilling_key_offset_map_test"};
+    ss::abort_source as;
+    storage::compaction_config cfg{
+      model::offset::max(), std::nullopt, ss::default_priority_class(), as};
+};
+
+TEST_F(SpillingKeyOffsetMapTest, Empty) {
+    storage::spilling_key_offset_map map(dir.get_path(), memory_bytes, cfg);
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.max_offset(), model::offset{});
+    EXPECT_EQ(map.get(k("key")).get(), std::nullopt);
+    map.close().get();
+}
+
+TEST_F(SpillingKeyOffsetMapTest, SpillsAndMerges) {
+    static constexpr int test_size = 20000;
+    static constexpr size_t max_runs = 2;
+
+    storage::spilling_key_offset_map map(
+      dir.get_path(), memory_bytes, cfg, max_runs);
+    std::unordered_map<std::string, int> truth;
+
+    // every key is written twice so that both the newer and the older offset
+    // of a key end up in different runs
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < test_size; ++i) {
+            const auto key = fmt::format("key-{}", i);
+            const int offset = round * test_size + i;
+            EXPECT_TRUE(map.put(k(key), model::offset(offset)).get());
+            truth[key] = offset;
+        }
+    }
+    EXPECT_GT(map.run_count(), 0);
+    EXPECT_LE(map.run_count(), max_runs);
+    EXPECT_EQ(count_files(dir.get_path()), map.run_count());
+    EXPECT_EQ(map.max_offset(), model::offset(2 * test_size - 1));
+
+    for (const auto& [key, val] : truth) {
+        const auto maybe_val = map.get(k(key)).get();
+        ASSERT_TRUE(maybe_val.has_value()) << key;
+        EXPECT_EQ(maybe_val.value(), model::offset(val)) << key;
+    }
+    EXPECT_EQ(map.get(k("missing")).get(), std::nullopt);
+
+    map.close().get();
+    EXPECT_EQ(map.run_count(), 0);
+    EXPECT_EQ(count_files(dir.get_path()), 0);
+}
+
+TEST_F(SpillingKeyOffsetMapTest, PutKeepsLargestOffset) {
+    storage::spilling_key_offset_map map(dir.get_path(), memory_bytes, cfg);
+
+    EXPECT_TRUE(map.put(k("key"), model::offset(10)).get());
+    // push the first offset out to disk before writing an older one
+    for (int i = 0; map.run_count() == 0; ++i) {
+        EXPECT_TRUE(
+          map.put(k(fmt::format("filler-{}", i)), model::offset(0)).get());
+    }
+    EXPECT_TRUE(map.put(k("key"), model::offset(9)).get());
+    EXPECT_EQ(map.get(k("key")).get(), model::offset(10));
+
+    map.close().get();
+}
@@ -1576,6 +1576,54 @@ FIXTURE_TEST(check_max_segment_size, storage_test_fixture) {
     BOOST_REQUIRE_EQUAL(size3 - size2, 2);
 }
 
+FIXTURE_TEST(check_adaptive_segment_size, storage_test_fixture) {
+    auto cfg = default_log_config(test_dir);
+    config::shard_local_cfg().log_segment_size_min.set_value(
+      std::make_optional(10_KiB));
+    config::shard_local_cfg().log_segment_target_count.set_value(
+      std::make_optional<uint32_t>(4));
+
+    std::exception_ptr ex;
+    try {
+        auto mock = config::mock_property<size_t>(1_MiB);
+        cfg.max_segment_size = mock.bind();
+
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+        auto ntp = model::ntp("default", "test", 0);
+        storage::ntp_config ntp_cfg(ntp, mgr.config().base_dir);
+        auto log = mgr.manage(std::move(ntp_cfg)).get();
+
+        // 400KiB of retention over 4 segments
+        overrides_t ov;
+        ov.retention_bytes = tristate<size_t>{400_KiB};
+        log->set_overrides(ov);
+        log->force_roll(ss::default_priority_class()).get();
+        BOOST_REQUIRE_EQUAL(log->segments().size(), 1);
+
+        append_exactly(log, 50, 1_KiB).get();
+        BOOST_REQUIRE_EQUAL(log->segments().size(), 1);
+        append_exactly(log, 100, 1_KiB).get();
+        BOOST_REQUIRE_EQUAL(log->segments().size(), 2);
+
+        // an explicit segment.bytes wins over the adaptive size
+        ov.segment_size = 1_MiB;
+        log->set_overrides(ov);
+        log->force_roll(ss::default_priority_class()).get();
+        append_exactly(log, 200, 1_KiB).get();
+        BOOST_REQUIRE_EQUAL(log->segments().size(), 3);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+
+    config::shard_local_cfg().log_segment_size_min.reset();
+    config::shard_local_cfg().log_segment_target_count.reset();
+
+    if (ex) {
+        throw ex;
+    }
+}
+
 FIXTURE_TEST(check_max_segment_size_limits, storage_test_fixture) {
     auto cfg = default_log_config(test_dir);
 
@@ -380,6 +380,58 @@ FIXTURE_TEST(timequery_non_monotonic_log, log_builder_fixture) {
     b | stop();
 }
 
+FIXTURE_TEST(timequery_non_monotonic_segments, log_builder_fixture) {
+    using namespace storage; // NOLINT
+
+    b | start();
+
+    // segment max timestamps are not ordered: [50, 10, 30, 100]
+    const std::vector<int64_t> first_ts = {41, 1, 21, 91};
+    for (int s = 0; s < 4; ++s) {
+        b | add_segment(s * 10);
+        for (int i = 0; i < 10; ++i) {
+            auto batch = make_random_batch(
+              model::offset(s * 10 + i), model::timestamp(first_ts[s] + i));
+            b | add_batch(std::move(batch));
+        }
+    }
+    BOOST_TEST(b.get_log_segments().size() == 4);
+
+    auto log = b.get_log();
+    auto query = [&log](model::offset min_offset, int64_t ts) {
+        storage::timequery_config config(
+          min_offset,
+          model::timestamp(ts),
+          log->offsets().dirty_offset,
+          ss::default_priority_class(),
+          std::nullopt);
+        return log->timequery(config).get();
+    };
+
+    // the first segment reaching the needle wins, even though later segments
+    // hold lower timestamps
+    auto res = query(log->offsets().start_offset, 45);
+    BOOST_TEST(res);
+    BOOST_TEST(res->offset == model::offset(4));
+
+    res = query(log->offsets().start_offset, 21);
+    BOOST_TEST(res);
+    BOOST_TEST(res->offset == model::offset(0));
+
+    res = query(log->offsets().start_offset, 60);
+    BOOST_TEST(res);
+    BOOST_TEST(res->offset == model::offset(30));
+
+    res = query(model::offset(10), 25);
+    BOOST_TEST(res);
+    BOOST_TEST(res->offset == model::offset(24));
+
+    res = query(log->offsets().start_offset, 101);
+    BOOST_TEST(!res);
+
+    b | stop();
+}
+
 FIXTURE_TEST(timequery_clamp, log_builder_fixture) {
     using namespace storage; // NOLINT
 
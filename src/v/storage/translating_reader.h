@@ -25,6 +25,9 @@ namespace storage {
 struct translating_reader {
     model::record_batch_reader reader;
     ss::lw_shared_ptr<const offset_translator_state> ot_state;
+    // set when the reader serves from tiered storage rather than the local
+    // log, for attributing reads
+    bool from_cloud{false};
 
     explicit translating_reader(
       model::record_batch_reader&& reader,
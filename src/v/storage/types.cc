@@ -184,12 +184,14 @@ std::ostream& operator<<(std::ostream& o, const offset_stats& s) {
     fmt::print(
       o,
       "{{start_offset:{}, committed_offset:{}, "
-      "committed_offset_term:{}, dirty_offset:{}, dirty_offset_term:{}}}",
+      "committed_offset_term:{}, dirty_offset:{}, dirty_offset_term:{}, "
+      "stable_offset:{}}}",
       s.start_offset,
       s.committed_offset,
       s.committed_offset_term,
       s.dirty_offset,
-      s.dirty_offset_term);
+      s.dirty_offset_term,
+      s.stable_offset);
     return o;
 }
 
@@ -217,6 +217,10 @@ struct offset_stats {
     model::offset dirty_offset;
     model::term_id dirty_offset_term;
 
+    // last offset written out of the appender and readable, it may not be
+    // flushed yet. committed_offset <= stable_offset <= dirty_offset
+    model::offset stable_offset;
+
     friend std::ostream& operator<<(std::ostream&, const offset_stats&);
 };
 
@@ -513,6 +517,11 @@ struct compaction_config {
     // Hash key-offset map to reuse across compactions.
     hash_key_offset_map* hash_key_map;
 
+    // When set, sliding window compaction indexes keys with a key-offset map
+    // that holds at most this many bytes in memory and spills the rest to
+    // disk, instead of using `hash_key_map`.
+    std::optional<size_t> spill_key_map_memory;
+
     // Set of intermediary files added by compactions that need to be removed,
     // e.g. because they were leftover from an aborted compaction.
     scoped_file_tracker::set_t* files_to_cleanup;
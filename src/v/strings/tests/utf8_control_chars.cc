@@ -71,3 +71,17 @@ BOOST_AUTO_TEST_CASE(control_char_replace) {
       "hello,\xe2\x90\x8athere\xe2\x90\x8d",
       replace_control_chars_in_string(test_string_newline));
 }
+
+BOOST_AUTO_TEST_CASE(utf8_validation) {
+    BOOST_CHECK(is_ascii(""));
+    BOOST_CHECK(is_ascii("a"));
+    BOOST_CHECK(is_ascii("abcdefghijklmnopqrstuvwxyz0123456789"));
+    // non-ascii bytes in the word loop and in the tail
+    BOOST_CHECK(!is_ascii("abcdefg\xc3\xa9hijklmnop"));
+    BOOST_CHECK(!is_ascii("abcdefgh\xc3\xa9"));
+
+    BOOST_CHECK(is_valid_utf8("abcdefghijklmnopqrstuvwxyz"));
+    BOOST_CHECK(is_valid_utf8("caf\xc3\xa9 au lait"));
+    BOOST_CHECK(!is_valid_utf8("caf\xc3 au lait"));
+    BOOST_CHECK(!is_valid_utf8("abcdefgh\xff"));
+}
@@ -16,6 +16,8 @@
 #include <boost/locale.hpp>
 #include <boost/locale/encoding_utf.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -105,9 +107,33 @@ inline void validate_no_control(std::string_view s) {
     validate_no_control(s, default_control_character_thrower{s});
 }
 
+/*
+ * Returns true if none of the bytes of \p s has the high bit set. ASCII is
+ * valid UTF-8, looking at eight bytes at a time is much cheaper than the
+ * general validation below, which also copies the string.
+ */
+inline bool is_ascii(std::string_view s) {
+    constexpr uint64_t high_bits = 0x8080808080808080ULL;
+    uint64_t acc = 0;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= s.size(); i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, s.data() + i, sizeof(word));
+        acc |= word;
+    }
+    for (; i < s.size(); ++i) {
+        acc |= static_cast<uint8_t>(s[i]);
+    }
+    return (acc & high_bits) == 0;
+}
+
 template<typename Thrower>
 requires ExceptionThrower<Thrower>
 inline void validate_utf8(std::string_view s, Thrower&& thrower) {
+    // by far the common case for names and identifiers in requests
+    if (likely(is_ascii(s))) {
+        return;
+    }
     try {
         boost::locale::conv::utf_to_utf<char>(
           s.begin(), s.end(), boost::locale::conv::stop);
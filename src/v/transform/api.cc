@@ -12,6 +12,7 @@
 #include "transform/api.h"
 
 #include "cluster/errc.h"
+#include "cluster/partition.h"
 #include "cluster/partition_manager.h"
 #include "cluster/plugin_frontend.h"
 #include "cluster/topic_table.h"
@@ -29,6 +30,7 @@
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
 #include "model/transform.h"
+#include "raft/consensus.h"
 #include "resource_mgmt/io_priority.h"
 #include "ssx/future-util.h"
 #include "ssx/semaphore.h"
@@ -126,8 +128,9 @@ private:
 
 class partition_source final : public source {
 public:
-    explicit partition_source(kafka::partition_proxy p)
-      : _partition(std::move(p)) {}
+    explicit partition_source(ss::lw_shared_ptr<cluster::partition> p)
+      : _raft(p->raft())
+      , _partition(kafka::make_partition_proxy(p)) {}
 
     ss::future<> start() final {
         _gate = {};
@@ -171,6 +174,9 @@ public:
     ss::future<model::record_batch_reader>
     read_batch(kafka::offset offset, ss::abort_source* as) final {
         auto _ = _gate.hold();
+        // Captured before reading, so that anything appended after the read
+        // starts wakes up a waiter in `wait_for_records`.
+        _last_visible_index = _raft->last_visible_index();
         // There currently no way to abort the call to get the sync start, so
         // instead we wrap the resulting future in our abort source.
         auto result = co_await ssx::with_timeout_abortable(
@@ -228,11 +234,23 @@ public:
           std::move(tracker), std::move(translater.reader));
     }
 
+    ss::future<>
+    wait_for_records(kafka::offset, ss::abort_source* as) final {
+        auto _ = _gate.hold();
+        // The visible index is the high watermark, when there are open
+        // transactions the reads are clamped below it, but finishing them
+        // appends a control batch which moves the visible index as well.
+        co_await _raft->visible_offset_monitor().wait(
+          model::next_offset(_last_visible_index), model::no_timeout, *as);
+    }
+
 private:
     // This gate is only to guard against the case when the abort has fired and
     // there is still a live future that holds a reference to _partition.
     ss::gate _gate;
+    ss::lw_shared_ptr<raft::consensus> _raft;
     kafka::partition_proxy _partition;
+    model::offset _last_visible_index;
 };
 
 class registry_adapter : public registry {
@@ -391,11 +409,11 @@ public:
         if (!engine) {
             throw std::runtime_error("unable to create wasm engine");
         }
-        auto partition = kafka::make_partition_proxy(ntp, *_partition_manager);
+        auto partition = _partition_manager->get(ntp);
         if (!partition) {
             throw std::runtime_error("unable to create transform source");
         }
-        auto src = std::make_unique<partition_source>(*std::move(partition));
+        auto src = std::make_unique<partition_source>(std::move(partition));
 
         std::vector<std::unique_ptr<sink>> sinks;
         sinks.reserve(meta.output_topics.size());
@@ -77,6 +77,17 @@ public:
      */
     virtual ss::future<model::record_batch_reader>
     read_batch(kafka::offset, ss::abort_source*) = 0;
+
+    /**
+     * Wait for the log to have records at or after a given offset, after a
+     * read has returned no records. This can resolve without new records being
+     * readable, so the caller must read again to find out.
+     *
+     * NOTE: It's not valid to have pending futures outstanding from this
+     * method before calling stop.
+     */
+    virtual ss::future<>
+    wait_for_records(kafka::offset, ss::abort_source*) = 0;
 };
 
 /**
@@ -222,10 +222,14 @@ ss::future<cluster::errc> client::do_produce_once(produce_request req) {
         co_return cluster::errc::not_leader;
     }
     vlog(log.trace, "do_produce_once_request(node={}): {}", *leader, req);
-    auto reply = co_await (
-      *leader == _self ? do_local_produce(std::move(req))
-                       : do_remote_produce(*leader, std::move(req)));
-    vlog(log.trace, "do_produce_once_reply(node={}): {}", *leader, req);
+    if (*leader == _self) {
+        auto ec = co_await do_local_produce(
+          std::move(req.topic_data.front()), req.timeout);
+        vlog(log.trace, "do_produce_once_reply(node={}): {}", *leader, ec);
+        co_return ec;
+    }
+    auto reply = co_await do_remote_produce(*leader, std::move(req));
+    vlog(log.trace, "do_produce_once_reply(node={}): {}", *leader, reply);
     vassert(
       reply.results.size() == 1,
       "expected a single result: {}",
@@ -250,10 +254,12 @@ ss::future<> client::stop() {
     co_await _gate.close();
 }
 
-ss::future<produce_reply> client::do_local_produce(produce_request req) {
-    auto r = co_await _local_service->local().produce(
-      std::move(req.topic_data), req.timeout);
-    co_return produce_reply(std::move(r));
+ss::future<cluster::errc> client::do_local_produce(
+  transformed_topic_data data, model::timeout_clock::duration timeout) {
+    // The batches are appended directly to the partition on the shard that
+    // owns it, skipping the fan out over the partitions of a request.
+    auto r = co_await _local_service->local().produce(std::move(data), timeout);
+    co_return r.err;
 }
 
 ss::future<produce_reply>
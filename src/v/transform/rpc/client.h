@@ -160,7 +160,8 @@ private:
       generate_remote_report(model::node_id);
 
     ss::future<cluster::errc> do_produce_once(produce_request);
-    ss::future<produce_reply> do_local_produce(produce_request);
+    ss::future<cluster::errc>
+      do_local_produce(transformed_topic_data, model::timeout_clock::duration);
     ss::future<produce_reply>
       do_remote_produce(model::node_id, produce_request);
 
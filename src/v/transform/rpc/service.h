@@ -38,6 +38,9 @@ public:
       ss::chunked_fifo<transformed_topic_data> topic_data,
       model::timeout_clock::duration timeout);
 
+    ss::future<transformed_topic_data_result>
+      produce(transformed_topic_data, model::timeout_clock::duration);
+
     ss::future<result<stored_wasm_binary_metadata, cluster::errc>>
     store_wasm_binary(
       model::wasm_binary_iobuf, model::timeout_clock::duration timeout);
@@ -62,9 +65,6 @@ public:
       model::partition_id, absl::btree_set<model::transform_id>);
 
 private:
-    ss::future<transformed_topic_data_result>
-      produce(transformed_topic_data, model::timeout_clock::duration);
-
     ss::future<result<model::offset, cluster::errc>> produce(
       model::any_ntp auto,
       ss::chunked_fifo<model::record_batch>,
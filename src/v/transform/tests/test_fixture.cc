@@ -96,6 +96,14 @@ kafka::offset fake_source::start_offset() const {
 
 ss::future<model::record_batch_reader>
 fake_source::read_batch(kafka::offset offset, ss::abort_source* as) {
+    co_await wait_for_records(offset, as);
+    as->check();
+    auto it = _batches.lower_bound(offset);
+    co_return model::make_memory_record_batch_reader(it->second.copy());
+}
+
+ss::future<>
+fake_source::wait_for_records(kafka::offset offset, ss::abort_source* as) {
     auto sub = as->subscribe([this]() noexcept { _cond_var.broadcast(); });
     co_await _cond_var.wait([this, as, offset] {
         if (as->abort_requested()) {
@@ -104,9 +112,6 @@ fake_source::read_batch(kafka::offset offset, ss::abort_source* as) {
         auto it = _batches.lower_bound(offset);
         return it != _batches.end();
     });
-    as->check();
-    auto it = _batches.lower_bound(offset);
-    co_return model::make_memory_record_batch_reader(it->second.copy());
 }
 
 ss::future<> fake_source::push_batch(model::record_batch batch) {
@@ -82,6 +82,8 @@ public:
     kafka::offset start_offset() const override;
     ss::future<model::record_batch_reader>
     read_batch(kafka::offset offset, ss::abort_source* as) override;
+    ss::future<>
+    wait_for_records(kafka::offset offset, ss::abort_source* as) override;
 
     ss::future<> push_batch(model::record_batch batch);
 
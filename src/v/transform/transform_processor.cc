@@ -28,6 +28,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/queue.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/variant_utils.hh>
 
 #include <algorithm>
@@ -198,6 +199,23 @@ ss::future<> processor::poll_sleep() {
     }
 }
 
+ss::future<> processor::wait_for_records(kafka::offset offset) {
+    auto fut = co_await ss::coroutine::as_future(
+      _source->wait_for_records(offset, &_as));
+    if (!fut.failed() || _as.abort_requested()) {
+        fut.ignore_ready_future();
+        co_return;
+    }
+    // Fallback to polling so that we don't spin if the source is unable to
+    // notify us.
+    vlog(
+      _logger.debug,
+      "unable to wait for records at offset {}: {}",
+      offset,
+      fut.get_exception());
+    co_await poll_sleep();
+}
+
 ss::future<absl::flat_hash_map<model::output_topic_index, kafka::offset>>
 processor::load_latest_committed() {
     co_await _offset_tracker->wait_for_previous_flushes(&_as);
@@ -293,9 +311,9 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
         if (!last_offset) {
             vlog(
               _logger.trace,
-              "received no results, sleeping before polling at offset {}",
+              "received no results, waiting for records at offset {}",
               offset);
-            co_await poll_sleep();
+            co_await wait_for_records(offset);
             continue;
         }
         offset = kafka::next_offset(*last_offset);
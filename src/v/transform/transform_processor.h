@@ -116,6 +116,7 @@ private:
       transfer_queue<transformed_output>*,
       sink*,
       kafka::offset);
+    ss::future<> wait_for_records(kafka::offset);
     ss::future<> poll_sleep();
     ss::future<absl::flat_hash_map<model::output_topic_index, kafka::offset>>
     load_latest_committed();
@@ -17,6 +17,8 @@
 
 #include <absl/strings/escaping.h>
 
+#include <array>
+
 // Required length is ceil(4n/3) rounded up to 4 bytes
 static inline size_t encode_capacity(size_t input_size) {
     return (((4 * input_size) / 3) + 3) & ~0x3U;
@@ -112,6 +114,31 @@ ss::sstring iobuf_to_base64(const iobuf& input) {
     return output;
 }
 
+iobuf iobuf_to_base64_iobuf(const iobuf& input) {
+    base64_state state{};
+    base64_stream_encode_init(&state, 0);
+    iobuf out;
+    for (const details::io_fragment& frag : input) {
+        // up to two bytes of the previous fragment are carried over
+        iobuf::fragment out_frag{encode_capacity(frag.size() + 2)};
+        size_t written{};
+        base64_stream_encode(
+          &state, frag.get(), frag.size(), out_frag.get_write(), &written);
+        vassert(
+          written <= out_frag.capacity(),
+          "base64 encode overflow: {} > {}",
+          written,
+          out_frag.capacity());
+        out_frag.reserve(written);
+        out.append(std::move(out_frag).release());
+    }
+    std::array<char, 4> tail{};
+    size_t written{};
+    base64_stream_encode_final(&state, tail.data(), &written);
+    out.append(tail.data(), written);
+    return out;
+}
+
 bytes base64url_to_bytes(std::string_view data) {
     std::string srv;
     if (!absl::WebSafeBase64Unescape(data, &srv)) {
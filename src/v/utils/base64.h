@@ -41,6 +41,8 @@ iobuf base64_to_iobuf(const iobuf&);
 
 // base64 <-> iobuf
 ss::sstring iobuf_to_base64(const iobuf&);
+// iobuf -> base64, without linearizing large inputs
+iobuf iobuf_to_base64_iobuf(const iobuf&);
 
 /// \brief Used to decode URL encoded base64 values
 ///
@@ -37,11 +37,9 @@ template<
 class chunked_kv_cache {
     struct cached_value;
     struct evict;
-    using cache_t = s3_fifo::cache<
-      cached_value,
-      &cached_value::hook,
-      evict,
-      s3_fifo::default_cache_cost>;
+    struct entry_cost;
+    using cache_t
+      = s3_fifo::cache<cached_value, &cached_value::hook, evict, entry_cost>;
 
 public:
     using config = cache_t::config;
@@ -60,10 +58,15 @@ public:
     /**
      * Inserts a value for a given key into the cache.
      *
+     * The \p cost of the value is expressed in the same units as the cache
+     * size in the config. The default of one is appropriate for a cache sized
+     * by its number of entries, but e.g. passing the size of the value in
+     * bytes bounds the memory held by the cache.
+     *
      * Returns true if the value was inserted and false if there was already a
      * value for the given key in the cache.
      */
-    bool try_insert(const Key& key, ss::shared_ptr<Value> val);
+    bool try_insert(const Key& key, ss::shared_ptr<Value> val, size_t cost = 1);
 
     /**
      * Gets the key's corresponding value from the cache.
@@ -72,6 +75,13 @@ public:
      */
     ss::optimized_optional<ss::shared_ptr<Value>> get_value(const Key& key);
 
+    /**
+     * Evicts one entry from the cache, e.g. to release memory on demand.
+     *
+     * Returns true if an entry was evicted, or false otherwise.
+     */
+    bool evict() noexcept { return _cache.evict_any(); }
+
     using cache_stat = struct cache_t::stat;
     /**
      * Cache statistics.
@@ -97,6 +107,7 @@ private:
     struct cached_value {
         Key key;
         ss::shared_ptr<Value> value;
+        size_t cost;
         s3_fifo::cache_hook hook;
         ghost_hook_t ghost_hook;
     };
@@ -128,15 +139,20 @@ struct chunked_kv_cache<Key, Value, Hash, EqualTo>::evict {
     }
 };
 
+template<typename Key, typename Value, typename Hash, typename EqualTo>
+struct chunked_kv_cache<Key, Value, Hash, EqualTo>::entry_cost {
+    size_t operator()(const cached_value& e) noexcept { return e.cost; }
+};
+
 template<typename Key, typename Value, typename Hash, typename EqualTo>
 bool chunked_kv_cache<Key, Value, Hash, EqualTo>::try_insert(
-  const Key& key, ss::shared_ptr<Value> val) {
+  const Key& key, ss::shared_ptr<Value> val, size_t cost) {
     gc_ghost_fifo();
 
     auto e_it = _map.find(key);
     if (e_it == _map.end()) {
         auto [e_it, succ] = _map.try_emplace(
-          key, std::make_unique<cached_value>(key, std::move(val)));
+          key, std::make_unique<cached_value>(key, std::move(val), cost));
         if (!succ) {
             return false;
         }
@@ -148,6 +164,7 @@ bool chunked_kv_cache<Key, Value, Hash, EqualTo>::try_insert(
     auto& entry = *e_it->second;
     if (entry.hook.evicted()) {
         entry.value = std::move(val);
+        entry.cost = cost;
         _ghost_fifo.erase(_ghost_fifo.iterator_to(entry));
         _cache.insert(entry);
         return true;
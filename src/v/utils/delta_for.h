@@ -26,6 +26,7 @@
 
 #include <seastar/util/log.hh>
 
+#include <algorithm>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -609,6 +610,15 @@ public:
         return true;
     }
 
+    /// Return position inside the stream, the next row is read from it
+    deltafor_stream_pos_t<TVal> get_position() const {
+        return {
+          .initial = _initial,
+          .offset = uint32_t(_data.bytes_consumed()),
+          .num_rows = _pos,
+        };
+    }
+
     /// Skip rows
     void skip(const deltafor_stream_pos_t<TVal>& st) {
         _data.skip(st.offset);
@@ -951,6 +961,31 @@ public:
 
     const_iterator end() const { return const_iterator(); }
 
+    /// Decode all values of the frame into \p out which has to hold size()
+    /// values. Rows are unpacked straight into the output, which avoids the
+    /// per-value overhead of the iterator when the whole frame is scanned.
+    void decode_into(std::span<value_t> out) const {
+        vassert(
+          out.size() >= _size,
+          "Output buffer is too small: {} < {}",
+          out.size(),
+          _size);
+        size_t pos = 0;
+        if (_tail.has_value()) {
+            decoder_t decoder(
+              _tail->get_initial_value(),
+              _tail->get_row_count(),
+              _tail->share(),
+              delta_alg_instance);
+            while (pos + buffer_depth <= _size
+                   && decoder.read(std::span<value_t, buffer_depth>(
+                     out.data() + pos, buffer_depth))) {
+                pos += buffer_depth;
+            }
+        }
+        std::copy_n(_head.begin(), _size - pos, out.begin() + pos);
+    }
+
     const_iterator find(value_t value) const {
         return pred_search<std::equal_to<value_t>>(value);
     }
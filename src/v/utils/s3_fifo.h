@@ -407,6 +407,14 @@ public:
      */
     bool evict() noexcept;
 
+    /**
+     * Evict one entry from the cache even if the queues are within their
+     * capacity, e.g. to release memory on demand.
+     *
+     * Returns true if an entry was evicted, or false otherwise.
+     */
+    bool evict_any() noexcept;
+
     /**
      * Cache statistics.
      */
@@ -556,6 +564,15 @@ bool cache<T, Hook, Evictor, Cost>::evict() noexcept {
     return evict_main();
 }
 
+template<
+  typename T,
+  cache_hook T::*Hook,
+  cache_evictor<T> Evictor,
+  cache_cost<T> Cost>
+bool cache<T, Hook, Evictor, Cost>::evict_any() noexcept {
+    return evict() || evict_small() || evict_main();
+}
+
 template<
   typename T,
   cache_hook T::*Hook,
@@ -51,6 +51,29 @@ BOOST_AUTO_TEST_CASE(iobuf_type) {
     BOOST_REQUIRE_EQUAL(decoded, iobuf_to_bytes(buf));
 }
 
+BOOST_AUTO_TEST_CASE(test_iobuf_to_base64_iobuf) {
+    auto to_str = [](iobuf buf) {
+        iobuf_parser p{std::move(buf)};
+        return p.read_string(p.bytes_left());
+    };
+    BOOST_REQUIRE_EQUAL(to_str(iobuf_to_base64_iobuf(iobuf::from(""))), "");
+    BOOST_REQUIRE_EQUAL(
+      to_str(iobuf_to_base64_iobuf(iobuf::from("this is a string"))),
+      "dGhpcyBpcyBhIHN0cmluZw==");
+
+    // fragments which are not a multiple of 3 bytes carry over
+    for (size_t frag_size : {1, 2, 3, 127, 128}) {
+        iobuf buf;
+        while (std::distance(buf.begin(), buf.end()) < 5) {
+            auto data = random_generators::get_bytes(frag_size);
+            buf.append_fragments(iobuf::from(
+              {reinterpret_cast<const char*>(data.data()), data.size()}));
+        }
+        BOOST_REQUIRE_EQUAL(
+          to_str(iobuf_to_base64_iobuf(buf)), iobuf_to_base64(buf));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_base64_to_iobuf) {
     const std::string_view a_string = "dGhpcyBpcyBhIHN0cmluZw==";
     iobuf buf;
@@ -143,3 +143,43 @@ TEST(ChunkedKVTest, GhostToMainTest) {
     EXPECT_EQ(stat.small_queue_size, 4);
     EXPECT_EQ(stat.index_size, 6);
 }
+
+TEST(ChunkedKVTest, CostTest) {
+    using cache_type = utils::chunked_kv_cache<int, std::string>;
+
+    cache_type cache(cache_type::config{.cache_size = 10, .small_size = 5});
+    auto str = "avaluestr";
+
+    EXPECT_EQ(cache.try_insert(0, ss::make_shared<std::string>(str), 4), true);
+    auto stats = cache.stat();
+    EXPECT_EQ(stats.small_queue_size + stats.main_queue_size, 4);
+
+    // entries are evicted before an insert until the queues fit in the cache
+    // size, so the queues hold at most the cache size plus one entry
+    for (int i = 1; i < 10; ++i) {
+        cache.try_insert(i, ss::make_shared<std::string>(str), 4);
+        stats = cache.stat();
+        EXPECT_LE(stats.small_queue_size + stats.main_queue_size, 14);
+    }
+}
+
+TEST(ChunkedKVTest, EvictTest) {
+    using cache_type = utils::chunked_kv_cache<int, std::string>;
+
+    cache_type cache(cache_type::config{.cache_size = 10, .small_size = 5});
+    auto str = "avaluestr";
+
+    EXPECT_EQ(cache.evict(), false);
+
+    EXPECT_EQ(cache.try_insert(0, ss::make_shared<std::string>(str), 4), true);
+    EXPECT_EQ(cache.try_insert(1, ss::make_shared<std::string>(str), 4), true);
+
+    EXPECT_EQ(cache.evict(), true);
+    EXPECT_EQ(cache.evict(), true);
+    EXPECT_EQ(cache.evict(), false);
+
+    auto stats = cache.stat();
+    EXPECT_EQ(stats.small_queue_size + stats.main_queue_size, 0);
+    EXPECT_EQ(cache.get_value(0), std::nullopt);
+    EXPECT_EQ(cache.get_value(1), std::nullopt);
+}
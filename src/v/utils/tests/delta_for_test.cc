@@ -319,6 +319,12 @@ void skip_test(const std::vector<std::pair<TVal, TVal>>& deltas, DeltaT delta) {
 
         // maybe read another item
         if (i != expected.size() - 1) {
+            // the decoder reports the position the encoder had before the row
+            auto next_pos = dec.get_position();
+            BOOST_REQUIRE_EQUAL(next_pos.initial, positions.at(i + 1).initial);
+            BOOST_REQUIRE_EQUAL(next_pos.offset, positions.at(i + 1).offset);
+            BOOST_REQUIRE_EQUAL(
+              next_pos.num_rows, positions.at(i + 1).num_rows);
             row = expected.at(i + 1);
             buf = {};
             success = dec.read(buf);
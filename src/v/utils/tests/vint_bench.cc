@@ -9,6 +9,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "random/generators.h"
 #include "utils/vint.h"
@@ -316,3 +317,54 @@ PERF_TEST(vint_bench, make_stream) {
     perf_tests::do_not_optimize(b);
     return count;
 }
+
+namespace {
+
+// zigzag varints with the size distribution of record headers: mostly one or
+// two byte deltas and lengths, some timestamps deltas and sizes
+iobuf make_record_header_vints(size_t count) {
+    iobuf ret;
+    for (size_t c = 0; c < count; c++) {
+        const auto bits = random_generators::get_int<int>(0, 3) == 0
+                            ? random_generators::get_int<int>(14, 40)
+                            : random_generators::get_int<int>(0, 13);
+        const auto v = random_generators::get_int<int64_t>(
+          -(int64_t{1} << bits), int64_t{1} << bits);
+        ret.append(bytes_to_iobuf(vint::to_bytes(v)));
+    }
+    // a single fragment, as for a record batch read from disk
+    return ret.copy();
+}
+
+constexpr size_t record_vints = 10000;
+
+} // namespace
+
+PERF_TEST(vint_bench, decode_parser_byte_iterator) {
+    auto buf = make_record_header_vints(record_vints);
+    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
+    perf_tests::start_measuring_time();
+    size_t count = 0;
+    while (in.bytes_consumed() < buf.size_bytes()) {
+        auto [v, len] = vint::deserialize(in);
+        in.skip(len);
+        perf_tests::do_not_optimize(v);
+        ++count;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
+
+PERF_TEST(vint_bench, decode_parser_word) {
+    auto buf = make_record_header_vints(record_vints);
+    iobuf_const_parser parser(buf);
+    perf_tests::start_measuring_time();
+    size_t count = 0;
+    while (parser.bytes_left() > 0) {
+        auto [v, len] = parser.read_varlong();
+        perf_tests::do_not_optimize(v);
+        ++count;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
@@ -8,6 +8,8 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "random/generators.h"
 #include "utils/vint.h"
@@ -20,7 +22,9 @@
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <vector>
 
 namespace {
 
@@ -65,3 +69,57 @@ SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
       = unsigned_vint::stream_deserialize(istream).get();
     BOOST_CHECK_EQUAL(result, test_number);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_word_deserializer) {
+    auto check = [](int64_t v) {
+        std::array<char, vint::max_length + unsigned_vint::detail::word_length>
+          buf{};
+        // garbage with continuation bits set after the varint
+        buf.fill(static_cast<char>(0xff));
+        const auto len = vint::serialize(
+          v, reinterpret_cast<uint8_t*>(buf.data()));
+        const auto [word, word_len] = unsigned_vint::detail::deserialize_word(
+          buf.data());
+        if (len > unsigned_vint::detail::word_length) {
+            BOOST_REQUIRE_EQUAL(word_len, 0);
+            return;
+        }
+        BOOST_REQUIRE_EQUAL(word_len, len);
+        BOOST_REQUIRE_EQUAL(vint::decode_zigzag(word), v);
+    };
+    for (int shift = 0; shift < 63; ++shift) {
+        const auto v = int64_t{1} << shift;
+        for (auto x : {v - 1, v, v + 1, -v, -v - 1}) {
+            check(x);
+        }
+    }
+    check(std::numeric_limits<int64_t>::max());
+    check(std::numeric_limits<int64_t>::min());
+    for (int i = 0; i < 10000; ++i) {
+        check(random_generators::get_int<int64_t>());
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_parser_varint_across_fragments) {
+    std::vector<int64_t> values;
+    iobuf buf;
+    for (int i = 0; i < 1000; ++i) {
+        const auto v = random_generators::get_int<int64_t>(
+          -(int64_t{1} << (i % 63)), int64_t{1} << (i % 63));
+        values.push_back(v);
+        // a fragment per varint or two so that some of them are split
+        const auto b = vint::to_bytes(v);
+        const auto split = random_generators::get_int<size_t>(0, b.size());
+        buf.append(b.data(), split);
+        buf.append_fragments(
+          iobuf::from({reinterpret_cast<const char*>(b.data()) + split,
+                       b.size() - split}));
+    }
+    iobuf_parser parser(std::move(buf));
+    for (auto v : values) {
+        const auto [decoded, len] = parser.read_varlong();
+        BOOST_REQUIRE_EQUAL(decoded, v);
+        BOOST_REQUIRE_EQUAL(len, vint::vint_size(v));
+    }
+    BOOST_REQUIRE_EQUAL(parser.bytes_left(), 0);
+}
@@ -12,7 +12,9 @@
 #pragma once
 #include "bytes/bytes.h"
 
+#include <bit>
 #include <cstdint>
+#include <cstring>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -64,6 +66,38 @@ deserialize(Range&& r, size_t max_bytes) noexcept {
     return std::make_pair(decoder.result, decoder.bytes_read);
 }
 
+/// Bytes that must be readable for deserialize_word()
+inline constexpr size_t word_length = sizeof(uint64_t);
+
+/**
+ * Decodes a varint of at most 8 bytes without looping over its bytes: the
+ * terminating byte is found from the mask of the continuation bits of an 8
+ * byte word and the 7 bit groups are then compacted in three steps, as in
+ * Masked VByte but with a general purpose register.
+ *
+ * At least word_length bytes must be readable at \p src. Returns a length of 0
+ * when the varint is longer than 8 bytes.
+ */
+inline std::pair<uint64_t, size_t> deserialize_word(const char* src) noexcept {
+    uint64_t w = 0;
+    std::memcpy(&w, src, sizeof(w));
+    if constexpr (std::endian::native == std::endian::big) {
+        w = std::byteswap(w);
+    }
+    const uint64_t last_bytes = ~w & 0x8080808080808080ULL;
+    if (unlikely(last_bytes == 0)) {
+        return {0, 0};
+    }
+    const size_t len = (std::countr_zero(last_bytes) / 8) + 1;
+    if (len < sizeof(w)) {
+        w &= (uint64_t{1} << (len * 8)) - 1;
+    }
+    w = ((w & 0x7f007f007f007f00ULL) >> 1) | (w & 0x007f007f007f007fULL);
+    w = ((w & 0x3fff00003fff0000ULL) >> 2) | (w & 0x00003fff00003fffULL);
+    w = ((w & 0x0fffffff00000000ULL) >> 4) | (w & 0x000000000fffffffULL);
+    return {w, len};
+}
+
 } // namespace detail
 
 inline size_t serialize(uint64_t value, uint8_t* out) noexcept {
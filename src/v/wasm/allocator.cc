@@ -26,6 +26,8 @@
 
 #include <unistd.h>
 
+#include <utility>
+
 namespace wasm {
 
 heap_allocator::heap_allocator(config c)
@@ -51,6 +53,16 @@ ss::future<std::optional<heap_memory>> heap_allocator::allocate(request req) {
     if (_size < req.minimum || _size > req.maximum) {
         co_return std::nullopt;
     }
+    // Prefer memory that has already been zeroed, so restarting an instance
+    // doesn't wait on a large memory that was just returned to the pool.
+    for (auto& m : _memory_pool) {
+        if (m.available()) {
+            if (&m != &_memory_pool.front()) {
+                std::swap(m, _memory_pool.front());
+            }
+            break;
+        }
+    }
     ss::future<heap_memory> front = std::move(_memory_pool.front());
     _memory_pool.pop_front();
     co_return co_await std::move(front);
@@ -84,7 +84,9 @@ public:
      * request does not fix within our bounds or because all memory is currently
      * allocated.
      *
-     * Memory returned from this method will be zero-filled.
+     * Memory returned from this method will be zero-filled. Memory that is
+     * already zero-filled is handed out before memory that is still being
+     * zeroed asynchronously.
      */
     ss::future<std::optional<heap_memory>> allocate(request);
 
@@ -22,7 +22,9 @@
 #include <seastar/util/noncopyable_function.hh>
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace wasm {
 
@@ -122,6 +124,14 @@ public:
             std::chrono::milliseconds per_invocation_timeout;
         };
         cpu cpu;
+        struct code_cache {
+            // The directory where compiled modules are persisted, so that a
+            // module doesn't need to be compiled again after a restart.
+            //
+            // The cache is disabled if unset.
+            std::optional<std::filesystem::path> directory;
+        };
+        code_cache code_cache;
     };
 
     virtual ss::future<> start(config) = 0;
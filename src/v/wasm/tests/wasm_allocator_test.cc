@@ -180,6 +180,27 @@ TEST(HeapAllocatorTest, AsyncDeallocationNotEnoughMemory) {
     EXPECT_THAT(waiter1.get(), Optional(_));
     EXPECT_EQ(waiter2.get(), std::nullopt);
 }
+
+TEST(HeapAllocatorTest, PrefersZeroedMemory) {
+    size_t page_size = ::getpagesize();
+    // force deallocations to be asynchronous.
+    size_t test_chunk_size = page_size / 4;
+    heap_allocator allocator(heap_allocator::config{
+      .heap_memory_size = page_size,
+      .num_heaps = 2,
+      .memset_chunk_size = test_chunk_size,
+    });
+    heap_allocator::request req{.minimum = page_size, .maximum = page_size};
+    auto first = allocator.allocate(req).get().value();
+    auto second = allocator.allocate(req).get().value();
+    // The first memory is zeroed in the background, the second one is unused
+    // so there is nothing to zero.
+    allocator.deallocate(std::move(first), page_size);
+    allocator.deallocate(std::move(second), 0);
+    auto waiter = allocator.allocate(req);
+    EXPECT_TRUE(waiter.available());
+    EXPECT_THAT(waiter.get(), Optional(_));
+}
 #endif
 
 MATCHER(HeapIsZeroed, "is zeroed") {
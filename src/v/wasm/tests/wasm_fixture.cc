@@ -65,11 +65,34 @@ void WasmTestFixture::SetUpTestSuite() {
 
 void WasmTestFixture::SetUp() {
     _probe = std::make_unique<wasm::transform_probe>();
+    start_runtime(std::nullopt);
+    _meta = {
+      .name = model::transform_name(ss::sstring("test_wasm_transform")),
+      .input_topic = model::random_topic_namespace(),
+      .output_topics = {model::random_topic_namespace()},
+      .environment = {},
+      .source_ptr = model::offset(0),
+    };
+}
+void WasmTestFixture::TearDown() {
+    if (_engine) {
+        _engine->stop().get();
+        _log_lines.clear();
+    }
+    _engine = nullptr;
+    _factory = nullptr;
+    _runtime->stop().get();
+    _runtime = nullptr;
+    _probe = nullptr;
+}
+
+void WasmTestFixture::start_runtime(
+  std::optional<std::filesystem::path> code_cache_dir) {
     auto sr = std::make_unique<schema::fake_registry>();
     _sr = sr.get();
     _runtime = wasm::wasmtime::create_runtime(std::move(sr));
     // Support creating up to 4 instances in a test
-    constexpr wasm::runtime::config wasm_runtime_config {
+    const wasm::runtime::config wasm_runtime_config {
         .heap_memory = {
           .per_core_pool_size_bytes = MAX_MEMORY,
           .per_engine_memory_limit = MAX_MEMORY,
@@ -89,17 +112,15 @@ void WasmTestFixture::SetUp() {
         .cpu = {
           .per_invocation_timeout = 3s,
         },
+        .code_cache = {
+          .directory = std::move(code_cache_dir),
+        },
     };
     _runtime->start(wasm_runtime_config).get();
-    _meta = {
-      .name = model::transform_name(ss::sstring("test_wasm_transform")),
-      .input_topic = model::random_topic_namespace(),
-      .output_topics = {model::random_topic_namespace()},
-      .environment = {},
-      .source_ptr = model::offset(0),
-    };
 }
-void WasmTestFixture::TearDown() {
+
+void WasmTestFixture::restart_runtime(
+  std::optional<std::filesystem::path> code_cache_dir) {
     if (_engine) {
         _engine->stop().get();
         _log_lines.clear();
@@ -107,8 +128,7 @@ void WasmTestFixture::TearDown() {
     _engine = nullptr;
     _factory = nullptr;
     _runtime->stop().get();
-    _runtime = nullptr;
-    _probe = nullptr;
+    start_runtime(std::move(code_cache_dir));
 }
 
 void WasmTestFixture::load_wasm(std::string file) {
@@ -22,7 +22,9 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace schema {
@@ -39,6 +41,9 @@ public:
     void SetUp() override;
     void TearDown() override;
 
+    // Restart the runtime, persisting compiled modules in the directory.
+    void restart_runtime(std::optional<std::filesystem::path> code_cache_dir);
+
     void load_wasm(std::string file);
     model::record_batch make_tiny_batch();
     model::record_batch make_tiny_batch(iobuf record_value);
@@ -68,6 +73,8 @@ public:
     std::vector<ss::sstring> log_lines() const { return _log_lines; }
 
 private:
+    void start_runtime(std::optional<std::filesystem::path> code_cache_dir);
+
     std::unique_ptr<wasm::runtime> _runtime;
     ss::shared_ptr<wasm::factory> _factory;
     ss::shared_ptr<wasm::engine> _engine;
@@ -10,12 +10,15 @@
  */
 
 #include "wasm/errc.h"
+#include "test_utils/tmp_dir.h"
 #include "wasm/tests/wasm_fixture.h"
 
 #include <seastar/core/reactor.hh>
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 TEST_F(WasmTestFixture, CanRestartEngine) {
     load_wasm("identity");
     engine()->stop().get();
@@ -26,6 +29,24 @@ TEST_F(WasmTestFixture, CanRestartEngine) {
     ASSERT_EQ(transformed.copy_records(), batch.copy_records());
 }
 
+TEST_F(WasmTestFixture, CachesCompiledModules) {
+    temporary_dir dir("wasm_code_cache");
+    auto cached_modules = [&dir] {
+        auto it = std::filesystem::directory_iterator(dir.get_path());
+        return std::distance(it, std::filesystem::directory_iterator{});
+    };
+    restart_runtime(dir.get_path());
+    load_wasm("identity");
+    EXPECT_EQ(cached_modules(), 1);
+    // Loaded from the cache after a restart
+    restart_runtime(dir.get_path());
+    load_wasm("identity");
+    EXPECT_EQ(cached_modules(), 1);
+    auto batch = make_tiny_batch();
+    auto transformed = transform(batch);
+    ASSERT_EQ(transformed.copy_records(), batch.copy_records());
+}
+
 TEST_F(WasmTestFixture, HandlesSetupPanic) {
     EXPECT_THROW(load_wasm("setup-panic"), wasm::wasm_exception);
 }
@@ -103,7 +103,9 @@ public:
         _runtime = nullptr;
     }
 
-    ss::future<> run_test() {
+    // Returns the number of records transformed, so the results are reported
+    // per record and the inverse is the records/sec of the transform.
+    ss::future<size_t> run_test() {
         model::record_batch batch = model::test::make_random_batch(
           model::test::record_batch_spec{
             .allow_compression = false,
@@ -125,6 +127,7 @@ public:
               perf_tests::do_not_optimize(model::transformed_data::make_batch(
                 model::timestamp::now(), std::move(*output)));
               perf_tests::stop_measuring_time();
+              return BatchSize;
           });
     }
 
@@ -147,6 +150,10 @@ private:
 WASM_IDENTITY_PERF_TEST(1, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 512);
+// Small records, where the cost of entering the VM dominates.
+WASM_IDENTITY_PERF_TEST(1, 100);
+WASM_IDENTITY_PERF_TEST(100, 100);
+WASM_IDENTITY_PERF_TEST(1000, 100);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define MEMSET_PERF_TEST(buf_size)                                             \
@@ -120,6 +120,11 @@ void transform_module::check_abi_version_2() {
     // static analysis of the module to determine which ABI version to use.
 }
 
+void transform_module::check_abi_version_3() {
+    // This function does nothing at runtime, it's only an opportunity for
+    // static analysis of the module to determine which ABI version to use.
+}
+
 // NOLINTBEGIN(bugprone-easily-swappable-parameters)
 ss::future<int32_t> transform_module::read_batch_header(
   int64_t* base_offset,
@@ -256,6 +261,85 @@ ss::future<int32_t> transform_module::write_record_with_options(
     co_return success ? int32_t(buf.size()) : INVALID_WRITE;
 }
 
+ss::future<int32_t> transform_module::read_batch_records(
+  ffi::array<uint8_t> buf, int32_t* records_size) {
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    // The records we have not surfaced yet are at the front of the batch data,
+    // which is already in the wire format so it can be copied as is.
+    size_t size = _call_ctx->batch_data.size_bytes();
+    *records_size = int32_t(size);
+    if (buf.size() < size) {
+        // The guest can retry with a buffer of the returned size.
+        co_return INVALID_BUFFER;
+    }
+    if (_call_ctx->records.empty()) {
+        co_return 0;
+    }
+
+    // Callback that we finished processing the previous record if the guest
+    // read some of the batch record by record.
+    if (
+      _call_ctx->records.size()
+      != size_t(_call_ctx->batch_header.record_count)) {
+        _call_ctx->callback->post_record();
+    }
+
+    co_await ss::coroutine::maybe_yield();
+
+    {
+        iobuf_const_parser parser(_call_ctx->batch_data);
+        parser.consume_to(size, buf.data());
+    }
+    _call_ctx->batch_data.clear();
+    auto record_count = _call_ctx->records.size();
+    _call_ctx->records.clear();
+
+    // Call back so we can refuel for the whole batch.
+    _call_ctx->callback->pre_batch(record_count);
+
+    co_return int32_t(size);
+}
+
+// NOLINTBEGIN(bugprone-easily-swappable-parameters)
+ss::future<int32_t> transform_module::write_records(
+  ffi::array<uint8_t> buf, ffi::array<uint8_t> options_buf) {
+    // NOLINTEND(bugprone-easily-swappable-parameters)
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    auto options = write_options::parse(options_buf);
+    if (!options) {
+        co_return INVALID_BUFFER;
+    }
+    // Each record is the size prefixed payload as passed to write_record.
+    // Validate all of them first so that a malformed buffer writes nothing.
+    ss::chunked_fifo<model::transformed_data> records;
+    try {
+        ffi::reader r(buf);
+        while (r.remaining_bytes() > 0) {
+            auto d = model::transformed_data::create_validated(
+              r.read_sized_iobuf());
+            if (!d) {
+                co_return INVALID_BUFFER;
+            }
+            records.push_back(*std::move(d));
+        }
+    } catch (const std::out_of_range& ex) {
+        vlog(wasm_log.debug, "write_records invalid buffer: {}", ex);
+        co_return INVALID_BUFFER;
+    }
+    for (auto& d : records) {
+        auto success = co_await _call_ctx->callback->emit(
+          options->topic, std::move(d));
+        if (!success) {
+            co_return INVALID_WRITE;
+        }
+    }
+    co_return int32_t(buf.size());
+}
+
 void transform_module::start() {
     _guest_cond_var.emplace();
     _host_cond_var.emplace();
@@ -56,6 +56,13 @@ struct record_metadata {
  * emit({...});
  * post_record();
  *
+ * Guests using the batch ABI consume all the records of a batch at once:
+ *
+ * pre_batch(3);
+ * emit({...});
+ * emit({...});
+ * post_record();
+ *
  */
 class record_callback {
 public:
@@ -68,6 +75,9 @@ public:
 
     // Called before surfacing a record to the VM.
     virtual void pre_record() = 0;
+    // Called before surfacing all the remaining records of a batch to the VM
+    // at once, the VM is then done with the batch in a single post_record.
+    virtual void pre_batch(size_t record_count) = 0;
     // Called for each record output from the VM.
     virtual ss::future<write_success>
       emit(std::optional<model::topic_view>, model::transformed_data) = 0;
@@ -133,6 +143,7 @@ public:
 
     void check_abi_version_1();
     void check_abi_version_2();
+    void check_abi_version_3();
 
     ss::future<int32_t> read_batch_header(
       int64_t* base_offset,
@@ -157,6 +168,15 @@ public:
     ss::future<int32_t>
       write_record_with_options(ffi::array<uint8_t>, ffi::array<uint8_t>);
 
+    // Batch ABI (version 3), the remaining records of the batch are copied
+    // into guest memory with a single call, laid out as in the record batch,
+    // and the output records are written back in bulk.
+
+    ss::future<int32_t> read_batch_records(ffi::array<uint8_t>, int32_t*);
+
+    ss::future<int32_t>
+      write_records(ffi::array<uint8_t>, ffi::array<uint8_t>);
+
     // End ABI exports
 
 private:
@@ -15,6 +15,7 @@
 #include "base/vassert.h"
 #include "base/vlog.h"
 #include "engine_probe.h"
+#include "hashing/xx.h"
 #include "ffi.h"
 #include "logger.h"
 #include "metrics/metrics.h"
@@ -53,9 +54,12 @@
 #include <absl/strings/escaping.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <alloca.h>
 #include <csignal>
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -86,6 +90,15 @@ constexpr size_t max_host_function_stack_usage = vm_stack_size
 // infinite loop workload on x86_64.
 constexpr uint64_t millisecond_fuel_amount = 2'000'000;
 
+// Compiled modules in the code cache, bump the version to invalidate the
+// modules cached by previous versions. Modules compiled by a different version
+// of wasmtime or a different engine config are detected when loaded.
+constexpr std::string_view code_cache_version = "v1";
+constexpr std::string_view code_cache_extension = ".cwasm";
+// The maximum number of compiled modules kept in the code cache, the least
+// recently used ones are removed at startup.
+constexpr size_t max_code_cache_entries = 512;
+
 // The reserved memory for an instance of a WebAssembly VM.
 //
 // The wasmtime memory APIs don't allow us to pass information into an
@@ -171,6 +184,14 @@ public:
 private:
     void register_metrics();
 
+    // The following methods must be called on the alien thread.
+    handle<wasmtime_module_t, wasmtime_module_delete>
+    load_or_compile_module(const model::transform_metadata&, const iobuf&);
+    handle<wasmtime_module_t, wasmtime_module_delete>
+    load_cached_module(const std::filesystem::path&);
+    void cache_module(wasmtime_module_t*, const std::filesystem::path&);
+    void prune_code_cache();
+
     static wasmtime_error_t* allocate_stack_memory(
       void* env, size_t size, wasmtime_stack_memory_t* memory_ret);
 
@@ -201,6 +222,7 @@ private:
     metrics::public_metric_groups _public_metrics;
     ss::sharded<wasm::engine_probe_cache> _engine_probe_cache;
     size_t _per_invocation_fuel_amount = 0;
+    std::optional<std::filesystem::path> _code_cache_dir;
 };
 
 void check_error(const wasmtime_error_t* error) {
@@ -817,6 +839,16 @@ private:
                 _measurement = _probe->latency_measurement();
             }
 
+            void pre_batch(size_t record_count) final {
+                // The fuel budget is per record, so the guest has the same
+                // budget for a batch regardless of the ABI it uses.
+                handle<wasmtime_error_t, wasmtime_error_delete> error(
+                  wasmtime_context_set_fuel(
+                    _context, _fuel_amt * std::max<size_t>(record_count, 1)));
+                check_error(error.get());
+                _measurement = _probe->latency_measurement();
+            }
+
             ss::future<write_success> emit(
               std::optional<model::topic_view> topic,
               model::transformed_data data) final {
@@ -1256,10 +1288,13 @@ void register_transform_module(
     host_function<&transform_module::name>::reg(linker, #name, ssc)
     REG_HOST_FN(check_abi_version_1);
     REG_HOST_FN(check_abi_version_2);
+    REG_HOST_FN(check_abi_version_3);
     REG_HOST_FN(read_batch_header);
     REG_HOST_FN(read_next_record);
     REG_HOST_FN(write_record);
     REG_HOST_FN(write_record_with_options);
+    REG_HOST_FN(read_batch_records);
+    REG_HOST_FN(write_records);
 #undef REG_HOST_FN
 }
 
@@ -1407,6 +1442,22 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
       .tracking_enabled = c.stack_memory.debug_host_stack_usage,
     });
     co_await _alien_thread.start({.name = "wasm"});
+    if (c.code_cache.directory) {
+        _code_cache_dir = std::move(c.code_cache.directory);
+        auto fut = co_await ss::coroutine::as_future(
+          _alien_thread.submit([this] {
+              std::filesystem::create_directories(*_code_cache_dir);
+              prune_code_cache();
+          }));
+        if (fut.failed()) {
+            vlog(
+              wasm_log.warn,
+              "unable to use {} to cache compiled wasm modules: {}",
+              _code_cache_dir->native(),
+              fut.get_exception());
+            _code_cache_dir = std::nullopt;
+        }
+    }
     co_await ss::smp::invoke_on_all([] {
         // wasmtime needs some signals for it's handling, make sure we
         // unblock them.
@@ -1457,18 +1508,7 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
     };
     size_t memory_usage_size = co_await _alien_thread.submit(
       [this, &meta, buf = buf().get(), &preinitialized, &ssc] {
-          vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
-          // This can be a large contiguous allocation, however it happens
-          // on an alien thread so it bypasses the seastar allocator.
-          bytes b = iobuf_to_bytes(*buf);
-          wasmtime_module_t* user_module_ptr = nullptr;
-          handle<wasmtime_error_t, wasmtime_error_delete> error{
-            wasmtime_module_new(
-              _engine.get(), b.data(), b.size(), &user_module_ptr)};
-          check_error(error.get());
-          handle<wasmtime_module_t, wasmtime_module_delete> user_module{
-            user_module_ptr};
-          wasm_log.info("Finished compiling wasm module {}", meta.name);
+          auto user_module = load_or_compile_module(meta, *buf);
 
           handle<wasmtime_linker_t, wasmtime_linker_delete> linker{
             wasmtime_linker_new(_engine.get())};
@@ -1477,10 +1517,11 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
           register_sr_module(linker.get(), ssc);
           register_wasi_module(linker.get(), ssc);
 
-          error.reset(wasmtime_linker_instantiate_pre(
-            linker.get(),
-            user_module.get(),
-            out_handle(preinitialized->_underlying)));
+          handle<wasmtime_error_t, wasmtime_error_delete> error{
+            wasmtime_linker_instantiate_pre(
+              linker.get(),
+              user_module.get(),
+              out_handle(preinitialized->_underlying))};
           preinitialized->_memory_limits = lookup_memory_limits(
             user_module.get());
           check_error(error.get());
@@ -1505,6 +1546,166 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
       _sr.get());
 }
 
+handle<wasmtime_module_t, wasmtime_module_delete>
+wasmtime_runtime::load_or_compile_module(
+  const model::transform_metadata& meta, const iobuf& buf) {
+    // This can be a large contiguous allocation, however it happens
+    // on an alien thread so it bypasses the seastar allocator.
+    bytes b = iobuf_to_bytes(buf);
+
+    std::optional<std::filesystem::path> cache_path;
+    if (_code_cache_dir) {
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        auto h = xxhash_128(reinterpret_cast<const char*>(b.data()), b.size());
+        cache_path = *_code_cache_dir
+                     / fmt::format(
+                       "{}-{:016x}{:016x}{}",
+                       code_cache_version,
+                       h.high64,
+                       h.low64,
+                       code_cache_extension);
+        auto cached = load_cached_module(*cache_path);
+        if (cached) {
+            vlog(
+              wasm_log.info,
+              "Loaded compiled wasm module {} from {}",
+              meta.name,
+              cache_path->native());
+            return cached;
+        }
+    }
+
+    vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+    wasmtime_module_t* user_module_ptr = nullptr;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{wasmtime_module_new(
+      _engine.get(), b.data(), b.size(), &user_module_ptr)};
+    check_error(error.get());
+    handle<wasmtime_module_t, wasmtime_module_delete> user_module{
+      user_module_ptr};
+    wasm_log.info("Finished compiling wasm module {}", meta.name);
+
+    if (cache_path) {
+        cache_module(user_module.get(), *cache_path);
+    }
+    return user_module;
+}
+
+handle<wasmtime_module_t, wasmtime_module_delete>
+wasmtime_runtime::load_cached_module(const std::filesystem::path& path) {
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return nullptr;
+    }
+    // The artifact is memory mapped, wasmtime checks that it was compiled by
+    // the same version of wasmtime with a compatible engine config.
+    wasmtime_module_t* module_ptr = nullptr;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{
+      wasmtime_module_deserialize_file(
+        _engine.get(), path.c_str(), &module_ptr)};
+    if (error) {
+        wasm_name_t msg;
+        wasmtime_error_message(error.get(), &msg);
+        vlog(
+          wasm_log.warn,
+          "unable to load compiled wasm module {}, it will be recompiled: {}",
+          path.native(),
+          std::string_view(msg.data, msg.size));
+        wasm_byte_vec_delete(&msg);
+        std::filesystem::remove(path, ec);
+        return nullptr;
+    }
+    // Keep track of recently used modules for pruning.
+    std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), ec);
+    return handle<wasmtime_module_t, wasmtime_module_delete>{module_ptr};
+}
+
+void wasmtime_runtime::cache_module(
+  wasmtime_module_t* module, const std::filesystem::path& path) {
+    wasm_byte_vec_t serialized;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{
+      wasmtime_module_serialize(module, &serialized)};
+    if (error) {
+        wasm_name_t msg;
+        wasmtime_error_message(error.get(), &msg);
+        vlog(
+          wasm_log.warn,
+          "unable to serialize compiled wasm module: {}",
+          std::string_view(msg.data, msg.size));
+        wasm_byte_vec_delete(&msg);
+        return;
+    }
+    auto cleanup = ss::defer(
+      [&serialized]() noexcept { wasm_byte_vec_delete(&serialized); });
+    // Write to a temporary file first so that a crash never leaves a partial
+    // module behind.
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out.write(serialized.data, std::streamsize(serialized.size));
+        out.close();
+        if (!out) {
+            vlog(
+              wasm_log.warn,
+              "unable to write compiled wasm module to {}",
+              tmp_path.native());
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        vlog(
+          wasm_log.warn,
+          "unable to write compiled wasm module to {}: {}",
+          path.native(),
+          ec.message());
+        std::filesystem::remove(tmp_path, ec);
+    }
+}
+
+void wasmtime_runtime::prune_code_cache() {
+    struct entry {
+        std::filesystem::file_time_type last_used;
+        std::filesystem::path path;
+    };
+    std::vector<entry> entries;
+    for (const auto& dirent :
+         std::filesystem::directory_iterator(*_code_cache_dir)) {
+        const auto& path = dirent.path();
+        std::error_code ec;
+        if (
+          path.extension() != code_cache_extension
+          || !path.filename().native().starts_with(
+            fmt::format("{}-", code_cache_version))) {
+            // Leftovers of an interrupted write or of previous versions.
+            std::filesystem::remove(path, ec);
+            continue;
+        }
+        auto last_used = dirent.last_write_time(ec);
+        if (ec) {
+            continue;
+        }
+        entries.push_back({.last_used = last_used, .path = path});
+    }
+    if (entries.size() <= max_code_cache_entries) {
+        return;
+    }
+    std::ranges::sort(entries, std::greater<>{}, &entry::last_used);
+    for (size_t i = max_code_cache_entries; i < entries.size(); ++i) {
+        std::error_code ec;
+        std::filesystem::remove(entries[i].path, ec);
+    }
+    vlog(
+      wasm_log.info,
+      "removed {} compiled wasm modules from {}",
+      entries.size() - max_code_cache_entries,
+      _code_cache_dir->native());
+}
+
 wasm_engine_t* wasmtime_runtime::engine() const { return _engine.get(); }
 heap_allocator* wasmtime_runtime::heap_allocator() {
     return &_heap_allocator.local();
@@ -1648,7 +1849,7 @@ bool is_exported_memory(const parser::module_export& mod_export) {
 }
 
 bool is_transform_abi_check_fn(const parser::module_import& mod_import) {
-    constexpr std::array version = {1, 2};
+    constexpr std::array version = {1, 2, 3};
     return absl::c_any_of(version, [&mod_import](int version) {
         return mod_import
                == parser::module_import{
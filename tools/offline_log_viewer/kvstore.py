@@ -217,8 +217,12 @@ def decode_offset_translator_key(k):
     ret['type'] = rdr.read_int8()
     if ret['type'] == 0:
         ret['name'] = "offset_map"
-    else:
+    elif ret['type'] == 1:
         ret['name'] = 'highest_known_offset'
+    elif ret['type'] == 2:
+        ret['name'] = 'compact_offset_map'
+    else:
+        ret['name'] = 'offset_map_tail'
 
     ret['group'] = rdr.read_int64()
     return ret
@@ -333,6 +337,9 @@ def decode_offset_translator_value(type, v):
 
     if type == 1:
         ret['offset'] = rdr.read_int64()
+    elif type in (2, 3):
+        # delta-FoR encoded, not decoded here
+        ret['raw'] = v.hex()
     else:
         rdr.read_envelope()
         ret['start_delta'] = rdr.read_int64()